@@ -1,4 +1,5 @@
 #include "gem/gem.h"
+#include <array>
 #include <sstream>
 #include "imgui_impl_opengl3.h"
 using namespace nlohmann;
@@ -24,6 +25,8 @@ struct vxgi_data_n
   std::array<glm::mat4, _NumSlices>       m_slice_vp_matrices;
   std::array<uint32_t, _NumSlices>        m_current_slice_indices;
   std::array<GLFramebuffer, _NumSlices>   m_slice_renders;
+  glm::mat4                               m_volume_vp; // culls the slice draws
+  GLDrawList                              m_draw_list;
 
   void update_bounding_volume(const glm::vec3& camera_pos)
   {
@@ -33,6 +36,9 @@ struct vxgi_data_n
     glm::vec3 half_dim = m_aabb_dim * 0.5f;
     m_bounding_volume.m_min = camera_pos - half_dim;
     m_bounding_volume.m_max = camera_pos + half_dim;
+    m_volume_vp = glm::ortho(m_bounding_volume.m_min.x, m_bounding_volume.m_max.x,
+                             m_bounding_volume.m_min.y, m_bounding_volume.m_max.y,
+                             -m_bounding_volume.m_max.z, -m_bounding_volume.m_min.z);
 
     for(size_t n = 0; n < _NumSlices; n++)
     {
@@ -64,7 +70,7 @@ struct vxgi_data_n
   }
 
   void render(gem::AssetManager& am,
-              std::vector<gem::Scene*>& scenes,
+              gem::DrawRange draws,
               gem::Camera& cam,
               GLShader& forward_lighting_shader,
               GLFramebuffer &dir_light_shadow_buffer,
@@ -98,20 +104,30 @@ struct vxgi_data_n
 
     int num_point_lights = std::min((int)point_lights.size(), 16);
 
+    // member names are hashed once rather than built per light per frame
+    struct PointLightNames {
+      HashString position, colour, radius, intensity;
+    };
+    static const std::array<PointLightNames, 16> s_point_light_names = [] {
+      std::array<PointLightNames, 16> names{};
+      for (int i = 0; i < 16; i++) {
+        std::stringstream prefix;
+        prefix << "u_point_lights[" << i << "].";
+        names[i] = {HashString(prefix.str() + "position"),
+                    HashString(prefix.str() + "colour"),
+                    HashString(prefix.str() + "radius"),
+                    HashString(prefix.str() + "intensity")};
+      }
+      return names;
+    }();
+
     for (int i = 0; i < num_point_lights; i++) {
-      std::stringstream pos_name;
-      pos_name << "u_point_lights[" << i << "].position";
-      std::stringstream col_name;
-      col_name << "u_point_lights[" << i << "].colour";
-      std::stringstream rad_name;
-      rad_name << "u_point_lights[" << i << "].radius";
-      std::stringstream int_name;
-      int_name << "u_point_lights[" << i << "].intensity";
-
-      forward_lighting_shader.set_vec3(pos_name.str(), point_lights[i].position);
-      forward_lighting_shader.set_vec3(col_name.str(), point_lights[i].colour);
-      forward_lighting_shader.set_float(rad_name.str(), point_lights[i].radius);
-      forward_lighting_shader.set_float(int_name.str(), point_lights[i].intensity);
+      const PointLightNames &names = s_point_light_names[i];
+      forward_lighting_shader.set_vec3(names.position, point_lights[i].position);
+      forward_lighting_shader.set_vec3(names.colour, point_lights[i].colour);
+      forward_lighting_shader.set_float(names.radius, point_lights[i].radius);
+      forward_lighting_shader.set_float(names.intensity,
+                                        point_lights[i].intensity);
     }
     // set dirlight shadow map
     Texture::bind_sampler_handle(dir_light_shadow_buffer.m_depth_attachment,
@@ -126,78 +142,34 @@ struct vxgi_data_n
       forward_lighting_shader.set_mat4("u_vp", m_slice_vp_matrices[n]);
       forward_lighting_shader.set_vec3("u_cam_pos", cam.m_pos);
 
-      for(auto* s : scenes)
-      {
-
-        auto scene_renderables = s->m_registry.view<Transform, MeshComponent, Material>();
-        for (auto [e, trans, emesh, ematerial] : scene_renderables.each()) {
-          // TODO:
-          // this wont work, we need the samplers and material values
-          // but this pass uses a different shader from the gbuffer pass.
-          // in this particular case, the forward shader mirrors the gbuffer pass
-          // so we can likely just fudge this slightly and push the same values to
-          // the forward pass shader.
-
-          if(ematerial.m_uniform_values.find("u_diffuse_map") != ematerial.m_uniform_values.end()) {
-            auto sampler = std::any_cast<SamplerInfo>(
-                ematerial.m_uniform_values["u_diffuse_map"]);
-
-            if(sampler.tex_entry.m_texture) {
-              Texture::bind_sampler_handle(
-                  sampler.tex_entry.m_texture->m_handle, GL_TEXTURE0);
-            }
-          }
-
-          if(ematerial.m_uniform_values.find("u_normal_map") != ematerial.m_uniform_values.end()) {
-            auto sampler = std::any_cast<SamplerInfo>(
-                ematerial.m_uniform_values["u_normal_map"]);
-
-            if(sampler.tex_entry.m_texture) {
-              Texture::bind_sampler_handle(
-                  sampler.tex_entry.m_texture->m_handle, GL_TEXTURE1);
-            }
-          }
-
-          if(ematerial.m_uniform_values.find("u_metallic_map") != ematerial.m_uniform_values.end()) {
-            auto sampler = std::any_cast<SamplerInfo>(
-                ematerial.m_uniform_values["u_metallic_map"]);
-
-            if(sampler.tex_entry.m_texture) {
-              Texture::bind_sampler_handle(
-                  sampler.tex_entry.m_texture->m_handle, GL_TEXTURE2);
-            }
+      // the forward shader mirrors the gbuffer pass so it draws gbuffer packets,
+      // sorted by material so textures are only bound when it changes
+      const MaterialInstance* bound_instance = nullptr;
+      for (DrawPacket& packet : draws) {
+        Material& ematerial = *packet.m_material;
+        if (ematerial.m_instance.get() != bound_instance) {
+          bound_instance = ematerial.m_instance.get();
+          const char* sampler_names[] = {"u_diffuse_map", "u_normal_map",
+                                         "u_metallic_map", "u_roughness_map",
+                                         "u_ao_map"};
+          for (u32 unit = 0; unit < 5; unit++) {
+            const TextureEntry* tex_entry =
+                ematerial.find_texture(sampler_names[unit]);
+            Texture::bind_sampler_handle(
+                tex_entry && tex_entry->m_texture
+                    ? tex_entry->m_texture->m_handle
+                    : 0,
+                GL_TEXTURE0 + unit);
           }
-
-          if(ematerial.m_uniform_values.find("u_roughness_map") != ematerial.m_uniform_values.end()) {
-            auto sampler = std::any_cast<SamplerInfo>(
-                ematerial.m_uniform_values["u_roughness_map"]);
-
-            if(sampler.tex_entry.m_texture) {
-              Texture::bind_sampler_handle(
-                  sampler.tex_entry.m_texture->m_handle, GL_TEXTURE3);
-            }
-          }
-
-          if(ematerial.m_uniform_values.find("u_ao_map") != ematerial.m_uniform_values.end()) {
-            auto sampler = std::any_cast<SamplerInfo>(
-                ematerial.m_uniform_values["u_ao_map"]);
-
-            if(sampler.tex_entry.m_texture) {
-              Texture::bind_sampler_handle(
-                  sampler.tex_entry.m_texture->m_handle, GL_TEXTURE4);
-            }
-          }
-
-          forward_lighting_shader.set_mat4("u_model", trans.m_model);
-          forward_lighting_shader.set_mat4("u_normal", trans.m_normal_matrix);
-          emesh.m_mesh.draw();
-
-          Texture::bind_sampler_handle(0, GL_TEXTURE0);
-          Texture::bind_sampler_handle(0, GL_TEXTURE1);
-          Texture::bind_sampler_handle(0, GL_TEXTURE2);
-          Texture::bind_sampler_handle(0, GL_TEXTURE3);
-          Texture::bind_sampler_handle(0, GL_TEXTURE4);
         }
+
+        forward_lighting_shader.set_mat4("u_model", packet.m_transform->m_model);
+        forward_lighting_shader.set_mat4("u_normal",
+                                         packet.m_transform->m_normal_matrix);
+        packet.m_mesh->m_mesh.draw();
+      }
+      for (u32 unit = 0; unit < 5; unit++) {
+        Texture::bind_sampler_handle(0, GL_TEXTURE0 + unit);
       }
       m_slice_renders[n].unbind();
     }
@@ -400,18 +372,25 @@ int main()
         glm::vec2 mouse_pos = Input::get_mouse_position();
         if (Input::get_mouse_button(MouseButton::left) && !ImGui::GetIO().WantCaptureMouse)
         {
-            renderer.get_mouse_entity(mouse_pos);
+            renderer.pick_entity(mouse_pos);
         }
 
         on_imgui(renderer, s, mouse_pos, dir2, cube_trans, lights);
 
 
-        vxgi.render(Engine::assets, scenes, cam,
+        renderer.render(Engine::assets, cam, scenes);
+        // the renderer's gbuffer packets are culled to the camera, the slices
+        // need everything inside the voxel volume
+        vxgi.m_draw_list.set_view(DrawView::camera, vxgi.m_volume_vp);
+        vxgi.m_draw_list.set_pass(DrawPass::gbuffer, true,
+                                  renderer.m_gbuffer_shader->m_data.m_shader_id);
+        vxgi.m_draw_list.build(scenes, cam.m_pos);
+        vxgi.render(Engine::assets,
+                    vxgi.m_draw_list.get_packets(DrawPass::gbuffer), cam,
                     renderer.m_forward_lighting_shader->m_data,
                     renderer.m_dir_light_shadow_buffer, lights, dir);
 
         vxgi.on_imgui();
-        renderer.render(Engine::assets, cam, scenes);
         GPUBackend::selected()->engine_post_frame();
     }
     GPUBackend::selected()->engine_shut_down();
@@ -1,4 +1,6 @@
 #include "gem/gem.h"
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 
 using namespace nlohmann;
@@ -70,10 +72,37 @@ void on_imgui(GLRenderer & renderer, Scene * s, glm::vec2 mouse_pos,
     }
 }
 
-int main()
+int main(int argc, char ** argv)
 {
+    // --headless <frames> renders offscreen without a window, e.g. in CI
+    bool headless = false;
+    u32 headless_frames = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string(argv[i]) == "--headless")
+        {
+            headless = true;
+            headless_frames = 100;
+            if (i + 1 < argc)
+            {
+                char * end = nullptr;
+                const unsigned long frames = std::strtoul(argv[++i], &end, 10);
+                if (end == argv[i] || *end != '\0' || frames == 0 ||
+                    frames > std::numeric_limits<u32>::max())
+                {
+                    spdlog::error("renderer demo : --headless expects a frame count, got {}", argv[i]);
+                    return 1;
+                }
+                headless_frames = static_cast<u32>(frames);
+            }
+        }
+    }
+
     glm::ivec2 resolution = {1920, 1080};
-    Engine::init();
+    if (!Engine::init(headless, headless_frames))
+    {
+        return 1;
+    }
     GLRenderer renderer{};
     renderer.init(Engine::assets, resolution);
 
@@ -111,9 +140,9 @@ int main()
     auto& cube_mat = cube_entity.add_component<Material>(
         renderer.m_gbuffer_textureless_shader->m_handle,
                 renderer.m_gbuffer_textureless_shader->m_data);
-    cube_mat.set_uniform_value("u_diffuse_map", glm::vec3(1.0, 0.0, 0.0));
-    cube_mat.set_uniform_value("u_metallic_map", 0.0f);
-    cube_mat.set_uniform_value("u_roughness_map", 0.0f);
+    cube_mat.set_uniform_value("u_diffuse", glm::vec3(1.0, 0.0, 0.0));
+    cube_mat.set_uniform_value("u_metallic", 0.0f);
+    cube_mat.set_uniform_value("u_roughness", 0.0f);
     cube_entity.add_component<MeshComponent>(
         MeshComponent{Shapes::s_torus_mesh, {}, 0});
 
@@ -154,7 +183,7 @@ int main()
         glm::vec2 mouse_pos = Input::get_mouse_position();
         if (Input::get_mouse_button(MouseButton::left) && !ImGui::GetIO().WantCaptureMouse)
         {
-            renderer.get_mouse_entity(mouse_pos);
+            renderer.pick_entity(mouse_pos);
         }
 
         on_imgui(renderer, s, mouse_pos, dir2, cube_trans, lights);
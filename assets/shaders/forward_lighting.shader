@@ -73,11 +73,8 @@ vec3 UnpackNormalMap( vec3 TextureSample )
 }
 
 vec3 GetNormalFromMap() {
-    vec3 tangentNormal = texture(u_normal_map, aUV).xyz * 2.0 - 1.0;
-
-    if(abs(tangentNormal.z) < 0.0001) {
-        tangentNormal = UnpackNormalMap(tangentNormal);
-    }
+    // normal maps may be BC5 (rg only), always rebuild z
+    vec3 tangentNormal = UnpackNormalMap(texture(u_normal_map, aUV).xyz);
 
     vec3 Q1 = dFdx(aPos.xyz);
     vec3 Q2 = dFdy(aPos.xyz);
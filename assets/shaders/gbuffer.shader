@@ -1,5 +1,9 @@
 #version 450
 #vert
+#pragma variant GPU_DRIVEN
+#ifdef GPU_DRIVEN
+#extension GL_ARB_shader_draw_parameters : require
+#endif
 
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
@@ -11,36 +15,22 @@ layout(location = 2) out vec3 oNormal;
 layout(location = 3) out vec4 oClipPos;
 layout(location = 4) out vec4 oLastClipPos;
 
-uniform mat4      u_vp;
-uniform mat4      u_model;
-uniform mat4      u_last_vp;
-uniform mat4      u_last_model;
-uniform mat4      u_normal;
-uniform int       u_frame_index;
-uniform vec2      u_resolution;
-
-const vec2 halton_seq[16] = vec2[16] 
-(
-    vec2(0.500000, 0.333333),
-    vec2(0.250000, 0.666667),
-    vec2(0.750000, 0.111111),
-    vec2(0.125000, 0.444444),
-    vec2(0.625000, 0.777778),
-    vec2(0.375000, 0.222222),
-    vec2(0.875000, 0.555556),
-    vec2(0.062500, 0.888889),
-    vec2(0.562500, 0.037037),
-    vec2(0.312500, 0.370370),
-    vec2(0.812500, 0.703704),
-    vec2(0.187500, 0.148148),
-    vec2(0.687500, 0.481481),
-    vec2(0.437500, 0.814815),
-    vec2(0.937500, 0.259259),
-    vec2(0.031250, 0.592593)
-);
+#include "include/frame_constants.glsl"
+#include "include/draw_constants.glsl"
+
+#ifdef GPU_DRIVEN
+// GLIndirectDraws, the base instance is the object index
+layout(location = 5) flat out ivec4 oDrawIds;
+#define u_model      u_objects[gl_BaseInstanceARB].model
+#define u_last_model u_objects[gl_BaseInstanceARB].last_model
+#define u_normal     u_objects[gl_BaseInstanceARB].normal
+#endif
 
 void main()
 {
+#ifdef GPU_DRIVEN
+    oDrawIds = u_objects[gl_BaseInstanceARB].ids;
+#endif
     oUV = aUV;
     oNormal = (vec4(aNormal, 1.0) * u_normal).xyz;
     oPosition = (u_model * vec4(aPos , 1.0));
@@ -49,61 +39,130 @@ void main()
 
     oLastClipPos = u_last_vp * u_last_model * vec4(aPos, 1.0);
 
-    int jitter_index = u_frame_index % 16;
-    vec2 offset = halton_seq[jitter_index];
-    offset.x = ((offset.x-0.5) / u_resolution.x) * 4.0;
-    offset.y = ((offset.y-0.5) / u_resolution.y ) * 4.0;
+    vec2 offset = u_resolution_jitter.zw * 4.0;
 
     pos += vec4(offset * pos.z, 0.0, 0.0);
     gl_Position = pos;
 }
 
 #frag
+#extension GL_ARB_bindless_texture : enable
+// bindless samplers have no GL SPIR-V path, keep the GLSL front end
+#pragma no_spirv
 
 layout(location = 0) in vec2 aUV;
 layout(location = 1) in vec4 aPosition;
 layout(location = 2) in vec3 aNormal;
 layout(location = 3) in vec4 aClipPos;
 layout(location = 4) in vec4 aLastClipPos;
+#ifdef GPU_DRIVEN
+layout(location = 5) flat in ivec4 aDrawIds;
+#endif
+
 
+#pragma variant GBUFFER_COMPACT
 
+// attachment order mirrors open_gl::tech::GBuffer::create_gbuffer
+#ifdef GBUFFER_COMPACT
+layout(location = 0) out vec3 oDiffuse;
+layout(location = 1) out vec2 oNormal;
+layout(location = 2) out vec3 oPBR;
+layout(location = 3) out vec2 oVelocity;
+layout(location = 4) out uint oEntityID;
+#else
 layout(location = 0) out vec3 oDiffuse;
 layout(location = 1) out vec4 oPosition;
 layout(location = 2) out vec3 oNormal;
 layout(location = 3) out vec3 oPBR;
 layout(location = 4) out vec2 oVelocity;
-layout(location = 5) out vec3 oEntityID;
+layout(location = 5) out uint oEntityID;
+#endif
+
+// with u_prev_position_map this stays within the 16 fragment samplers GL 4.5
+// guarantees, mirrors GLMaterialTable::s_max_texture_arrays
+#pragma constant MATERIAL_ARRAY_COUNT 15
 
-uniform sampler2D u_diffuse_map;
-uniform sampler2D u_normal_map;
-uniform sampler2D u_metallic_map;
-uniform sampler2D u_roughness_map;
-uniform sampler2D u_ao_map;
 uniform sampler2D u_prev_position_map;
+uniform sampler2DArray u_material_arrays[MATERIAL_ARRAY_COUNT];
+
+#include "include/frame_constants.glsl"
+#include "include/draw_constants.glsl"
+#include "include/gbuffer_common.glsl"
+
+#ifdef GPU_DRIVEN
+// uniform per sub draw of a multi draw, which is what the material lookups
+// below rely on
+#define u_draw_ids aDrawIds
+#endif
+
+uniform int     u_bindless_materials;
+
+// indexed by TextureMapType, mirrors GLMaterialTable::GPUEntry
+const int MAP_DIFFUSE   = 0;
+const int MAP_NORMAL    = 1;
+const int MAP_METALLIC  = 3;
+const int MAP_ROUGHNESS = 4;
+const int MAP_AO        = 5;
+
+struct MaterialTextures
+{
+    uvec2 handles[6];
+    ivec2 layers[6];
+    ivec2 lods[6];
+};
 
-uniform mat4    u_last_vp;
-uniform int     u_frame_index;
-uniform int     u_entity_index;
-
-const vec2 halton_seq[16] = vec2[16] 
-(
-    vec2(0.500000, 0.333333),
-    vec2(0.250000, 0.666667),
-    vec2(0.750000, 0.111111),
-    vec2(0.125000, 0.444444),
-    vec2(0.625000, 0.777778),
-    vec2(0.375000, 0.222222),
-    vec2(0.875000, 0.555556),
-    vec2(0.062500, 0.888889),
-    vec2(0.562500, 0.037037),
-    vec2(0.312500, 0.370370),
-    vec2(0.812500, 0.703704),
-    vec2(0.187500, 0.148148),
-    vec2(0.687500, 0.481481),
-    vec2(0.437500, 0.814815),
-    vec2(0.937500, 0.259259),
-    vec2(0.031250, 0.592593)
-);
+layout(std430, binding = 8) readonly buffer MaterialTable
+{
+    MaterialTextures u_materials[];
+};
+
+// finest uv footprint per draw, read back by the texture streamer
+layout(std430, binding = 7) buffer TextureStreamFeedback
+{
+    uint u_stream_feedback[];
+};
+
+// levels outside lods hold no valid data, lod is the unclamped query
+bool materialLodInRange(float lod, ivec2 lods)
+{
+    return lod >= float(lods.x) && lod <= float(lods.y);
+}
+
+// handles / layers are per material so indexing stays dynamically uniform
+vec4 sampleMaterialMap(int map, vec2 uv, vec4 fallback)
+{
+    ivec2 lods = u_materials[u_draw_ids.y].lods[map];
+#ifdef GL_ARB_bindless_texture
+    if (u_bindless_materials != 0)
+    {
+        uvec2 handle = u_materials[u_draw_ids.y].handles[map];
+        if (handle == uvec2(0))
+        {
+            return fallback;
+        }
+        float lod = textureQueryLod(sampler2D(handle), uv).y;
+        if (materialLodInRange(lod, lods))
+        {
+            return texture(sampler2D(handle), uv);
+        }
+        return textureLod(sampler2D(handle), uv,
+                          clamp(lod, float(lods.x), float(lods.y)));
+    }
+#endif
+    ivec2 layer = u_materials[u_draw_ids.y].layers[map];
+    if (layer.x < 0)
+    {
+        return fallback;
+    }
+    vec3 coord = vec3(uv, float(layer.y));
+    float lod = textureQueryLod(u_material_arrays[layer.x], uv).y;
+    if (materialLodInRange(lod, lods))
+    {
+        return texture(u_material_arrays[layer.x], coord);
+    }
+    return textureLod(u_material_arrays[layer.x], coord,
+                      clamp(lod, float(lods.x), float(lods.y)));
+}
 
 vec3 UnpackNormalMap( vec3 TextureSample )
 {
@@ -116,11 +175,9 @@ vec3 UnpackNormalMap( vec3 TextureSample )
 }
 
 vec3 getNormalFromMap() {
-    vec3 tangentNormal = texture(u_normal_map, aUV).xyz * 2.0 - 1.0;
-
-    if(abs(tangentNormal.z) < 0.0001) {
-        tangentNormal = UnpackNormalMap(tangentNormal);
-    }
+    // normal maps may be BC5 (rg only), always rebuild z
+    vec3 tangentNormal = UnpackNormalMap(
+        sampleMaterialMap(MAP_NORMAL, aUV, vec4(0.5, 0.5, 1.0, 1.0)).xyz);
 
     vec3 Q1 = dFdx(aPosition.xyz);
     vec3 Q2 = dFdy(aPosition.xyz);
@@ -136,37 +193,49 @@ vec3 getNormalFromMap() {
     return normalize(TBN * tangentNormal);
 }
 
+void writeStreamFeedback()
+{
+    vec2 uvDx = dFdx(aUV);
+    vec2 uvDy = dFdy(aUV);
+    // one texel of each 8x8 tile per frame keeps the feedback low resolution
+    ivec2 tileTexel = ivec2(gl_FragCoord.xy) & 7;
+    ivec2 frameTexel = ivec2(u_frame.x & 7, (u_frame.x >> 3) & 7);
+    if (u_draw_ids.z < 0 || tileTexel != frameTexel)
+    {
+        return;
+    }
+    float uvLod = log2(max(max(length(uvDx), length(uvDy)), 1e-8));
+    uint encoded = uint(clamp((uvLod + 32.0) * 16.0, 0.0, 4095.0));
+    atomicMin(u_stream_feedback[u_draw_ids.z], encoded);
+}
+
 void main()
 {
-    vec4 inDiffuse = texture(u_diffuse_map, aUV);
+    writeStreamFeedback();
+
+    vec4 inDiffuse = sampleMaterialMap(MAP_DIFFUSE, aUV, vec4(0.0, 0.0, 0.0, 1.0));
     if(inDiffuse.w < 0.25)
     {
         discard;
     }
 
+    // compact stores diffuse as sRGB, the encode happens on write
     oDiffuse = pow(inDiffuse.xyz, vec3(2.2));
+#ifndef GBUFFER_COMPACT
 	oPosition = aPosition;
-    oNormal = getNormalFromMap();
-
-    float r = ((u_entity_index & 0x000000FF) >>  0);
-    float g = ((u_entity_index & 0x0000FF00) >>  8);
-    float b = ((u_entity_index & 0x00FF0000) >> 16);
+#endif
+    oNormal = encodeGBufferNormal(getNormalFromMap());
 
-    oEntityID = vec3(r,g,b);
+    // every bit of the entity, picking reads it back exactly
+    oEntityID = uint(u_draw_ids.x);
 
     vec2 currentPosNDC = aClipPos.xy / aClipPos.z;
     vec2 previousPosNDC = aLastClipPos.xy / aLastClipPos.z;
 
     // velocity 
     oVelocity = currentPosNDC - previousPosNDC;
-    float metallic = texture(u_metallic_map, aUV).r;
-
-    float roughness = 1.0;
-    if(textureSize(u_roughness_map, 0).x > 0)
-    {
-        roughness = texture(u_roughness_map, aUV).g;
-    }
-
-    float ao = texture(u_ao_map, aUV).r;
+    float metallic = sampleMaterialMap(MAP_METALLIC, aUV, vec4(0.0)).r;
+    float roughness = sampleMaterialMap(MAP_ROUGHNESS, aUV, vec4(0.0, 1.0, 0.0, 1.0)).g;
+    float ao = sampleMaterialMap(MAP_AO, aUV, vec4(0.0)).r;
     oPBR = vec3(metallic, roughness, ao);
 }
\ No newline at end of file
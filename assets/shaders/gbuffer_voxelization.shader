@@ -3,54 +3,30 @@
 
 layout(local_size_x = 10, local_size_y = 10, local_size_z = 1) in;
 
-struct AABB
-{
-	vec3 min;
-	vec3 max;
-};
-
-uniform sampler2D u_gbuffer_pos;
+uniform sampler2D u_gbuffer_pos; // depth when GBUFFER_COMPACT
 uniform sampler2D u_gbuffer_lighting;
-uniform AABB	  u_aabb;
-uniform vec3	  u_voxel_resolution;
 uniform vec2	  u_input_resolution;
 
-layout(binding = 0, rgba16f) uniform image3D imgOutput;
-
-bool is_in_aabb(vec3 pos)
-{
-	if (pos.x < u_aabb.min.x) { return false; }
-	if (pos.y < u_aabb.min.y) { return false; }
-	if (pos.z < u_aabb.min.z) { return false; }
+#include "include/voxel_constants.glsl"
+#include "include/gbuffer_common.glsl"
 
-	if (pos.x > u_aabb.max.x) { return false; }
-	if (pos.y > u_aabb.max.y) { return false; }
-	if (pos.z > u_aabb.max.z) { return false; }
+#pragma variant GBUFFER_COMPACT
 
-	return true;
-}
-
-ivec3 get_texel_from_pos(vec3 position, vec3 resolution)
-{
-	vec3 t = position - u_aabb.min;
-	vec3 a = abs(u_aabb.max - u_aabb.min);
-	vec3 n = t / a;
-	vec3 s = n * resolution;
-
-	return ivec3(int(s.x), int(s.y), int(s.z));
-}
+layout(binding = 0, rgba16f) uniform image3D imgOutput;
 
 void main() {
+	loadVoxelConstants();
 	ivec2 pix = ivec2(gl_GlobalInvocationID.xy);
 	ivec2 size = ivec2(u_input_resolution.x, u_input_resolution.y);
 	if (pix.x >= size.x || pix.y >= size.y) {
 		return;
 	}
 	vec2 uv = vec2(pix) / size;
-	vec3 pos = texture(u_gbuffer_pos, uv).xyz;
+	// runs ahead of this frame's gbuffer pass
+	vec3 pos = sampleLastGBufferPosition(u_gbuffer_pos, uv);
 
 	// is the pixel position within the bounding volume, if not do nothing
-	if (!is_in_aabb(pos))
+	if (!is_in_aabb(pos, u_aabb))
 	{
 		return;
 	}
@@ -61,7 +37,7 @@ void main() {
 	vec4 light = texture(u_gbuffer_lighting, uv);
 	light.w = 1.0;
 
-	ivec3 sample_pos = get_texel_from_pos(pos.xyz, u_voxel_resolution);
+	ivec3 sample_pos = get_texel_from_pos(pos.xyz, u_voxel_resolution, u_aabb);
 	if(isnan(light.x) || isnan(light.y) || isnan(light.z))
 	{
 		return;
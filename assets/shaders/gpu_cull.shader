@@ -0,0 +1,157 @@
+#version 450
+#compute
+
+// GLIndirectDraws::dispatch_cull, one invocation per object. visible objects
+// append a command to their batch's range, the batch count is the parameter
+// buffer of its glMultiDrawElementsIndirectCount.
+// phase 0 frustum culls and, with u_occlusion, tests against last frame's
+// depth pyramid, flagging the objects it hides. phase 1 retests the flagged
+// objects against the pyramid of phase 0's depth and writes to the second
+// command / count region
+layout(local_size_x = 64) in;
+
+#define GPU_DRIVEN
+#include "include/draw_constants.glsl"
+
+// DrawElementsIndirectCommand
+struct DrawCommand
+{
+    uint count;
+    uint instance_count;
+    uint first_index;
+    int  base_vertex;
+    uint base_instance;
+};
+
+layout(std430, binding = 10) writeonly buffer DrawCommands
+{
+    DrawCommand u_commands[];
+};
+
+layout(std430, binding = 11) buffer DrawCounts
+{
+    uint u_counts[];
+};
+
+layout(std430, binding = 13) buffer CullState
+{
+    uint u_frustum_culled;
+    uint u_occluded;
+    uint u_disoccluded;
+    uint u_pad;
+    uint u_occluded_flags[];
+};
+
+// L,R,B,T,N,F, inside when dot(xyz, p) + w >= 0
+uniform vec4 u_planes[6];
+uniform uint u_object_count;
+uniform int u_phase;
+uniform uint u_command_offset;
+uniform uint u_count_offset;
+
+// HiZ::Pyramid, level 0 is half the depth resolution
+uniform int u_occlusion;
+uniform sampler2D u_hiz;
+uniform mat4 u_hiz_vp;
+uniform ivec2 u_hiz_depth_size;
+uniform int u_hiz_levels;
+
+bool is_occluded(vec3 centre, vec3 extent)
+{
+    vec3 ndc_min = vec3(1.0);
+    vec3 ndc_max = vec3(-1.0);
+    for (int corner = 0; corner < 8; corner++)
+    {
+        vec3 corner_sign = vec3((corner & 1) != 0 ? 1.0 : -1.0,
+                                (corner & 2) != 0 ? 1.0 : -1.0,
+                                (corner & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = u_hiz_vp * vec4(centre + corner_sign * extent, 1.0);
+        // crossing the camera plane, can't bound the projection
+        if (clip.w <= 1e-4)
+        {
+            return false;
+        }
+        vec3 ndc = clip.xyz / clip.w;
+        ndc_min = min(ndc_min, ndc);
+        ndc_max = max(ndc_max, ndc);
+    }
+
+    // widened by a depth texel for the jitter the pyramid was rendered with
+    vec2 depth_size = vec2(u_hiz_depth_size);
+    vec2 uv_min = clamp(ndc_min.xy * 0.5 + 0.5 - 1.0 / depth_size, 0.0, 1.0);
+    vec2 uv_max = clamp(ndc_max.xy * 0.5 + 0.5 + 1.0 / depth_size, 0.0, 1.0);
+
+    // first level where the rect covers at most 2x2 texels
+    vec2 span = (uv_max - uv_min) * depth_size * 0.5;
+    int level = int(ceil(log2(max(max(span.x, span.y), 1.0))));
+    level = clamp(level, 0, u_hiz_levels - 1);
+    ivec2 t0 = ivec2(0);
+    ivec2 t1 = ivec2(0);
+    for (; level < u_hiz_levels; level++)
+    {
+        vec2 scale = depth_size / float(2 << level);
+        t0 = ivec2(uv_min * scale);
+        t1 = ivec2(uv_max * scale);
+        if (all(lessThanEqual(t1 - t0, ivec2(1))))
+        {
+            break;
+        }
+    }
+    if (level == u_hiz_levels)
+    {
+        return false;
+    }
+
+    ivec2 last = textureSize(u_hiz, level) - 1;
+    float farthest = max(
+        max(texelFetch(u_hiz, min(t0, last), level).r,
+            texelFetch(u_hiz, min(ivec2(t1.x, t0.y), last), level).r),
+        max(texelFetch(u_hiz, min(ivec2(t0.x, t1.y), last), level).r,
+            texelFetch(u_hiz, min(t1, last), level).r));
+    return ndc_min.z * 0.5 + 0.5 > farthest;
+}
+
+void main()
+{
+    uint object = gl_GlobalInvocationID.x;
+    if (object >= u_object_count)
+    {
+        return;
+    }
+
+    vec3 centre = u_objects[object].bounds_centre.xyz;
+    vec3 extent = u_objects[object].bounds_extent.xyz;
+    if (u_phase == 0)
+    {
+        u_occluded_flags[object] = 0u;
+        for (int i = 0; i < 6; i++)
+        {
+            vec4 plane = u_planes[i];
+            if (dot(plane.xyz, centre) + plane.w +
+                    dot(abs(plane.xyz), extent) < 0.0)
+            {
+                atomicAdd(u_frustum_culled, 1u);
+                return;
+            }
+        }
+        if (u_occlusion != 0 && is_occluded(centre, extent))
+        {
+            u_occluded_flags[object] = 1u;
+            atomicAdd(u_occluded, 1u);
+            return;
+        }
+    }
+    else
+    {
+        if (u_occluded_flags[object] == 0u || is_occluded(centre, extent))
+        {
+            return;
+        }
+        atomicAdd(u_disoccluded, 1u);
+    }
+
+    uvec4 draw = u_objects[object].draw;
+    uint slot = atomicAdd(u_counts[u_count_offset + draw.z], 1u);
+    u_commands[u_command_offset + draw.w + slot] =
+        DrawCommand(draw.x, 1u, draw.y, 0, object);
+}
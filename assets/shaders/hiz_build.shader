@@ -0,0 +1,134 @@
+#version 450
+#compute
+
+// HiZ::dispatch_build, max depth pyramid in a single dispatch. each group
+// reduces a 64x64 depth tile to levels 0-5 (32x32 down to 1x1), the last
+// group to finish reduces the remaining levels from level 5.
+layout(local_size_x = 16, local_size_y = 16) in;
+
+#define MAX_LEVELS 8
+#define GROUP_LEVELS 6
+
+layout(r32f, binding = 0) uniform coherent image2D u_hiz[MAX_LEVELS];
+
+layout(std430, binding = 12) coherent buffer HiZCounter
+{
+    uint u_groups_done;
+};
+
+uniform sampler2D u_depth;
+uniform ivec2 u_depth_size;
+uniform int u_levels;
+uniform uint u_group_count;
+
+shared float s_depth[16][16];
+shared bool s_last_group;
+
+float load_depth(ivec2 texel)
+{
+    return texelFetch(u_depth, min(texel, u_depth_size - 1), 0).r;
+}
+
+float load_level(int level, ivec2 texel)
+{
+    return imageLoad(u_hiz[level], min(texel, imageSize(u_hiz[level]) - 1)).r;
+}
+
+void store_level(int level, ivec2 texel, float depth)
+{
+    // units past the last level alias it
+    if (level < u_levels)
+    {
+        imageStore(u_hiz[level], texel, vec4(depth));
+    }
+}
+
+void main()
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+
+    // level 0, 2x2 texels per invocation each covering 2x2 depth texels
+    ivec2 level0 = group * 32 + local * 2;
+    float farthest = 0.0;
+    for (int y = 0; y < 2; y++)
+    {
+        for (int x = 0; x < 2; x++)
+        {
+            ivec2 texel = level0 + ivec2(x, y);
+            ivec2 depth_texel = texel * 2;
+            float d = max(max(load_depth(depth_texel),
+                              load_depth(depth_texel + ivec2(1, 0))),
+                          max(load_depth(depth_texel + ivec2(0, 1)),
+                              load_depth(depth_texel + ivec2(1, 1))));
+            store_level(0, texel, d);
+            farthest = max(farthest, d);
+        }
+    }
+
+    // level 1 from registers, 2-5 through shared memory
+    store_level(1, group * 16 + local, farthest);
+    s_depth[local.y][local.x] = farthest;
+    barrier();
+
+    int width = 8;
+    for (int level = 2; level < GROUP_LEVELS; level++)
+    {
+        if (all(lessThan(local, ivec2(width))))
+        {
+            ivec2 src = local * 2;
+            float d = max(max(s_depth[src.y][src.x], s_depth[src.y][src.x + 1]),
+                          max(s_depth[src.y + 1][src.x],
+                              s_depth[src.y + 1][src.x + 1]));
+            store_level(level, group * width + local, d);
+            farthest = d;
+        }
+        barrier();
+        if (all(lessThan(local, ivec2(width))))
+        {
+            s_depth[local.y][local.x] = farthest;
+        }
+        barrier();
+        width /= 2;
+    }
+
+    if (u_levels <= GROUP_LEVELS)
+    {
+        return;
+    }
+
+    // publish this group's tile before counting it as done
+    memoryBarrierImage();
+    if (gl_LocalInvocationIndex == 0)
+    {
+        s_last_group = atomicAdd(u_groups_done, 1u) == u_group_count - 1u;
+    }
+    barrier();
+    if (!s_last_group)
+    {
+        return;
+    }
+    memoryBarrier();
+
+    for (int level = GROUP_LEVELS; level < u_levels; level++)
+    {
+        ivec2 size = imageSize(u_hiz[level]);
+        for (int i = int(gl_LocalInvocationIndex); i < size.x * size.y; i += 256)
+        {
+            ivec2 texel = ivec2(i % size.x, i / size.x);
+            ivec2 src = texel * 2;
+            float d = max(max(load_level(level - 1, src),
+                              load_level(level - 1, src + ivec2(1, 0))),
+                          max(load_level(level - 1, src + ivec2(0, 1)),
+                              load_level(level - 1, src + ivec2(1, 1))));
+            imageStore(u_hiz[level], texel, vec4(d));
+        }
+        memoryBarrierImage();
+        barrier();
+    }
+
+    if (gl_LocalInvocationIndex == 0)
+    {
+        u_groups_done = 0u;
+    }
+}
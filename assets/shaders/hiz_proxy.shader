@@ -0,0 +1,24 @@
+#version 450
+#vert
+
+// GLOcclusionQueries, a packet's world bounds over Shapes::s_cube_pos_only
+layout (location = 0) in vec3 aPos;
+
+#include "include/frame_constants.glsl"
+
+uniform vec3 u_bounds_centre;
+uniform vec3 u_bounds_extent;
+
+void main()
+{
+    // the cube spans [-0.5, 0.5]
+    vec3 world = u_bounds_centre + aPos * 2.0 * u_bounds_extent;
+    gl_Position = u_vp * vec4(world, 1.0);
+}
+
+#frag
+
+// depth test only, colour writes are masked
+void main()
+{
+}
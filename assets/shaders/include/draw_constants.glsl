@@ -0,0 +1,27 @@
+#ifdef GPU_DRIVEN
+// mirrors GLIndirectDraws::GPUObject, indexed by the command's base instance
+struct DrawObject
+{
+    mat4  model;
+    mat4  last_model;
+    mat4  normal;
+    ivec4 ids;  // x = entity, y = material, z = stream feedback slot
+    vec4  bounds_centre;
+    vec4  bounds_extent;
+    uvec4 draw; // x = index count, y = first index, z = batch, w = first command
+};
+
+layout(std430, binding = 9) readonly buffer DrawObjects
+{
+    DrawObject u_objects[];
+};
+#else
+// mirrors DrawConstants in gl_constant_ring.h
+layout(std140, binding = 1) uniform DrawConstants
+{
+    mat4  u_model;
+    mat4  u_last_model;
+    mat4  u_normal;
+    ivec4 u_draw_ids; // x = entity, y = material, z = stream feedback slot
+};
+#endif
@@ -0,0 +1,14 @@
+// mirrors FrameConstants in gl_constant_ring.h
+layout(std140, binding = 0) uniform FrameConstants
+{
+    mat4  u_view;
+    mat4  u_proj;
+    mat4  u_vp;
+    mat4  u_last_vp;
+    mat4  u_inv_proj;
+    mat4  u_inv_vp;
+    mat4  u_last_inv_vp;
+    vec4  u_cam_pos;
+    vec4  u_resolution_jitter; // xy = resolution, zw = jitter
+    ivec4 u_frame;             // x = frame index
+};
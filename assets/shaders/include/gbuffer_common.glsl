@@ -0,0 +1,82 @@
+// gbuffer encode / decode, GBUFFER_COMPACT mirrors
+// open_gl::tech::GBuffer::Layout::compact. compact has no position target,
+// positions are rebuilt from depth and normals are octahedral in RG16.
+#include "frame_constants.glsl"
+
+vec2 octahedralWrap(vec2 v)
+{
+    return (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec2 encodeOctahedral(vec3 n)
+{
+    n /= max(abs(n.x) + abs(n.y) + abs(n.z), 1e-6);
+    n.xy = n.z >= 0.0 ? n.xy : octahedralWrap(n.xy);
+    return n.xy * 0.5 + 0.5;
+}
+
+vec3 decodeOctahedral(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// gbuffer.shader offsets clip xy by jitter * 4 * clip z, the textureless
+// variant's smaller offset leaves a sub pixel error
+vec3 reconstructWorldPosition(vec2 uv, float depth, mat4 inv_vp, vec2 jitter)
+{
+    vec3 ndc = vec3(uv, depth) * 2.0 - 1.0;
+    ndc.xy -= jitter * 4.0 * ndc.z;
+    vec4 world = inv_vp * vec4(ndc, 1.0);
+    return world.xyz / world.w;
+}
+
+#ifdef GBUFFER_COMPACT
+#define GBufferNormal vec2
+#else
+#define GBufferNormal vec3
+#endif
+
+GBufferNormal encodeGBufferNormal(vec3 n)
+{
+#ifdef GBUFFER_COMPACT
+    return encodeOctahedral(n);
+#else
+    return n;
+#endif
+}
+
+vec3 sampleGBufferNormal(sampler2D normal_map, vec2 uv)
+{
+#ifdef GBUFFER_COMPACT
+    return decodeOctahedral(texture(normal_map, uv).xy);
+#else
+    return texture(normal_map, uv).xyz;
+#endif
+}
+
+// position_map is the depth attachment in the compact layout
+vec3 sampleGBufferPosition(sampler2D position_map, vec2 uv)
+{
+#ifdef GBUFFER_COMPACT
+    return reconstructWorldPosition(uv, texture(position_map, uv).r, u_inv_vp,
+                                    u_resolution_jitter.zw);
+#else
+    return texture(position_map, uv).xyz;
+#endif
+}
+
+// last frame's gbuffer, sampled before this frame's gbuffer pass
+vec3 sampleLastGBufferPosition(sampler2D position_map, vec2 uv)
+{
+#ifdef GBUFFER_COMPACT
+    return reconstructWorldPosition(uv, texture(position_map, uv).r,
+                                    u_last_inv_vp, vec2(0.0));
+#else
+    return texture(position_map, uv).xyz;
+#endif
+}
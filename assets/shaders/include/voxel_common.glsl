@@ -0,0 +1,50 @@
+struct AABB
+{
+	vec3 min;
+	vec3 max;
+};
+
+bool is_in_aabb(vec3 point, AABB bb)
+{
+	if(point.x > bb.max.x) return false;
+	if(point.y > bb.max.y) return false;
+	if(point.z > bb.max.z) return false;
+	if(point.x < bb.min.x) return false;
+	if(point.y < bb.min.y) return false;
+	if(point.z < bb.min.z) return false;
+	return true;
+}
+
+bool is_in_grid(ivec3 point, ivec3 resolution)
+{
+	if(point.x >= resolution.x) return false;
+	if(point.y >= resolution.y) return false;
+	if(point.z >= resolution.z) return false;
+
+	if(point.x < 0) return false;
+	if(point.y < 0) return false;
+	if(point.z < 0) return false;
+
+	return true;
+}
+
+ivec3 get_texel_from_pos(vec3 position, vec3 resolution, AABB bb)
+{
+	vec3 aabb_dim = bb.max - bb.min;
+	vec3 unit = vec3((aabb_dim.x / resolution.x), (aabb_dim.y / resolution.y) , (aabb_dim.z / resolution.z));
+
+	vec3 new_pos = position - bb.min;
+	int x = int(new_pos.x / unit.x) ;
+	int y = int(new_pos.y / unit.y) ;
+	int z = int(new_pos.z / unit.z) ;
+
+	return ivec3(x, y, z);
+}
+
+vec3 get_pos_from_texel(ivec3 texel, vec3 resolution, AABB bb)
+{
+	vec3 aabb_dim = bb.max - bb.min;
+	vec3 unit = vec3((aabb_dim.x / resolution.x), (aabb_dim.y / resolution.y) , (aabb_dim.z / resolution.z));
+
+	return bb.min + (texel * unit);
+}
@@ -0,0 +1,21 @@
+#include "voxel_common.glsl"
+
+// mirrors VoxelConstants in gl_constant_ring.h
+layout(std140, binding = 3) uniform VoxelConstants
+{
+    vec4 u_voxel_aabb_min;
+    vec4 u_voxel_aabb_max;
+    vec4 u_voxel_grid_resolution;
+    vec4 u_voxel_grid_unit;
+};
+
+// unpacked from VoxelConstants at the start of main
+AABB u_aabb;
+vec3 u_voxel_resolution;
+
+void loadVoxelConstants()
+{
+    u_aabb.min = u_voxel_aabb_min.xyz;
+    u_aabb.max = u_voxel_aabb_max.xyz;
+    u_voxel_resolution = u_voxel_grid_resolution.xyz;
+}
@@ -36,15 +36,48 @@ const int NUM_POINT_LIGHTS = 16;
 const float PI = 3.14159265359;
 const float SHADOW_AMBIENT = 0.1;
 
+#pragma variant NO_SHADOWS
+#pragma variant GBUFFER_COMPACT
+#pragma constant SHADOW_PCF_RADIUS 1
+
 uniform sampler2D   u_diffuse_map;
-uniform sampler2D   u_position_map;
+uniform sampler2D   u_position_map; // depth when GBUFFER_COMPACT
 uniform sampler2D   u_normal_map;
 uniform sampler2D   u_pbr_map; // x = metallic, y = roughness, z = AO
 uniform sampler2D   u_dir_light_shadow_map; // x = metallic, y = roughness, z = AO
-uniform vec3        u_dir_light_pos;
-uniform vec3        u_cam_pos;
-uniform DirLight    u_dir_light;
-uniform PointLight  u_point_lights[NUM_POINT_LIGHTS];
+
+#include "include/frame_constants.glsl"
+#include "include/gbuffer_common.glsl"
+
+struct PointLightData
+{
+    vec4    position_radius;
+    vec4    colour_intensity;
+};
+
+layout(std140, binding = 2) uniform LightingConstants
+{
+    mat4            u_dir_light_space_matrix;
+    vec4            u_dir_light_direction_intensity;
+    vec4            u_dir_light_colour;
+    vec4            u_dir_light_position;
+    ivec4           u_light_counts; // x = point lights
+    PointLightData  u_point_light_data[NUM_POINT_LIGHTS];
+};
+
+// unpacked from LightingConstants at the start of main
+DirLight    u_dir_light;
+vec3        u_dir_light_pos;
+
+PointLight getPointLight(int i)
+{
+    PointLight light;
+    light.position = u_point_light_data[i].position_radius.xyz;
+    light.radius = u_point_light_data[i].position_radius.w;
+    light.colour = u_point_light_data[i].colour_intensity.xyz;
+    light.intensity = u_point_light_data[i].colour_intensity.w;
+    return light;
+}
 
 float DistributionGGX(vec3 N, vec3 H, float roughness)
 {
@@ -149,7 +182,7 @@ float ShadowCalculationV2(vec3 f_normal, vec4 fragPosLightSpace)
     float currentDepth = projCoords.z;
     // calculate bias (based on depth map resolution and slope)
     vec3 normal = normalize(f_normal);
-    vec3 frag_pos = texture(u_position_map, projCoords.xy).xyz;
+    vec3 frag_pos = sampleGBufferPosition(u_position_map, projCoords.xy);
     vec3 lightDir = normalize(u_dir_light_pos - frag_pos);
     float bias = max(0.05 * (1.0 - dot(normal, lightDir)), 0.005);
     // check whether current frag pos is in shadow
@@ -157,15 +190,16 @@ float ShadowCalculationV2(vec3 f_normal, vec4 fragPosLightSpace)
     // PCF
     float shadow = 0.0;
     vec2 texelSize = 1.0 / textureSize(u_dir_light_shadow_map, 0);
-    for(int x = -1; x <= 1; ++x)
+    for(int x = -SHADOW_PCF_RADIUS; x <= SHADOW_PCF_RADIUS; ++x)
     {
-        for(int y = -1; y <= 1; ++y)
+        for(int y = -SHADOW_PCF_RADIUS; y <= SHADOW_PCF_RADIUS; ++y)
         {
             float pcfDepth = texture(u_dir_light_shadow_map, projCoords.xy + vec2(x, y) * texelSize).r; 
             shadow += currentDepth - bias > pcfDepth  ? 1.0 : 0.0;        
         }    
     }
-    shadow /= 9.0;
+    const int pcf_width = SHADOW_PCF_RADIUS * 2 + 1;
+    shadow /= float(pcf_width * pcf_width);
     
     // keep the shadow at 0.0 when outside the far_plane region of the light's frustum.
     if(projCoords.z > 1.0)
@@ -177,10 +211,16 @@ float ShadowCalculationV2(vec3 f_normal, vec4 fragPosLightSpace)
 
 void main()
 {
+   u_dir_light.direction = u_dir_light_direction_intensity.xyz;
+   u_dir_light.intensity = u_dir_light_direction_intensity.w;
+   u_dir_light.colour = u_dir_light_colour.xyz;
+   u_dir_light.light_space_matrix = u_dir_light_space_matrix;
+   u_dir_light_pos = u_dir_light_position.xyz;
+
    vec3 albedo = texture(u_diffuse_map, aUV).xyz;
-   vec3 WorldPos = texture(u_position_map, aUV).xyz;
-   vec3 N = texture(u_normal_map, aUV).xyz;
-   vec3 V = normalize(u_cam_pos - WorldPos);
+   vec3 WorldPos = sampleGBufferPosition(u_position_map, aUV);
+   vec3 N = sampleGBufferNormal(u_normal_map, aUV);
+   vec3 V = normalize(u_cam_pos.xyz - WorldPos);
    vec3 pbr = texture(u_pbr_map, aUV).xyz;
 
    vec4 frag_pos_light_space = u_dir_light.light_space_matrix * vec4(WorldPos, 1.0);
@@ -195,22 +235,27 @@ void main()
    // reflectance equation
    vec3 Lo = vec3(0.0);
 
+#ifdef NO_SHADOWS
+   float shadow = 0.0;
+#else
    float shadow = ShadowCalculationV2(N, frag_pos_light_space);
+#endif
 
    Lo += handle_dir_light(N, roughness, metallic, albedo, V, F0, shadow);
 
-   for (int i = 0; i < NUM_POINT_LIGHTS; ++i)
+   for (int i = 0; i < min(u_light_counts.x, NUM_POINT_LIGHTS); ++i)
    {
-       vec3 LightDir = u_point_lights[i].position - WorldPos;
+       PointLight light = getPointLight(i);
+       vec3 LightDir = light.position - WorldPos;
        // calculate per-light radiance
        vec3 L = normalize(LightDir);
        vec3 H = normalize(V + L);
        //vec3 H = normalize(L);
 
        float distance = length(LightDir);
-       float attenuation = blinnPhongAttenuation(u_point_lights[i].radius, distance);
+       float attenuation = blinnPhongAttenuation(light.radius, distance);
        attenuation *= attenuation;
-       vec3 radiance = u_point_lights[i].colour;
+       vec3 radiance = light.colour;
 
        // Cook-Torrance BRDF
        float NDF = DistributionGGX(N, H, roughness);
@@ -236,7 +281,7 @@ void main()
        float NdotL = max(dot(N, L), 0.0);
        vec3 diffuse = NdotL * albedo;
        // add to outgoing radiance Lo
-       Lo += (kD * attenuation * (diffuse / PI + specular)) * (radiance * u_point_lights[i].intensity)* NdotL;  // note that we already multiplied the BRDF by the Fresnel (kS) so we won't multiply by kS again
+       Lo += (kD * attenuation * (diffuse / PI + specular)) * (radiance * light.intensity)* NdotL;  // note that we already multiplied the BRDF by the Fresnel (kS) so we won't multiply by kS again
    }
 
    // ambient lighting (note that the next IBL tutorial will replace 
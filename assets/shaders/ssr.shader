@@ -24,10 +24,13 @@ uniform sampler2D u_depth_buffer;
 
 uniform float u_screen_width;
 uniform float u_screen_height;
-uniform mat4  u_inv_projection;
-uniform mat4  u_projection;
 uniform mat4  u_rotation;
 
+#pragma variant GBUFFER_COMPACT
+
+#include "include/frame_constants.glsl"
+#include "include/gbuffer_common.glsl"
+
 bool rayIsOutofScreen(vec2 ray) {
 	return (ray.x > 1 || ray.y > 1 || ray.x < 0 || ray.y < 0) ? true : false;
 }
@@ -68,10 +71,10 @@ void main(){
 		return;
 	}
 
-	vec3 normalView = (u_rotation * texture(u_gnormal_buffer, pixelPositionTexture.xy)).rgb;
+	vec3 normalView = (u_rotation * vec4(sampleGBufferNormal(u_gnormal_buffer, pixelPositionTexture.xy), 0.0)).rgb;
 	float pixelDepth = texture(u_depth_buffer, pixelPositionTexture.xy).r;	// 0< <1
 	pixelPositionTexture.z = pixelDepth;		
-	vec4 positionView = u_inv_projection *  vec4(pixelPositionTexture * 2 - vec3(1), 1);
+	vec4 positionView = u_inv_proj *  vec4(pixelPositionTexture * 2 - vec3(1), 1);
 	positionView /= positionView.w;
 	vec3 reflectionView = normalize(reflect(positionView.xyz, normalView));
 	if(reflectionView.z > 0){
@@ -82,7 +85,7 @@ void main(){
 
 
 	//Texture Space ray calculation
-	vec4 rayEndPositionTexture = u_projection * vec4(rayEndPositionView,1);
+	vec4 rayEndPositionTexture = u_proj * vec4(rayEndPositionView,1);
 	rayEndPositionTexture /= rayEndPositionTexture.w;
 	rayEndPositionTexture.xyz = (rayEndPositionTexture.xyz + vec3(1)) / 2.0f;
 	vec3 rayDirectionTexture = rayEndPositionTexture.xyz - pixelPositionTexture;
@@ -21,7 +21,10 @@ layout (location = 0) in vec2 aUV;
 uniform sampler2D u_current_buffer;
 uniform sampler2D u_history_buffer;
 uniform sampler2D u_velocity_buffer;
-uniform vec2      u_resolution;
+// rendered fraction of each buffer, see GLRenderer's dynamic resolution
+uniform float u_current_scale;
+uniform float u_history_scale;
+#include "include/frame_constants.glsl"
 vec3 encodePalYuv(vec3 rgb)
 {
     rgb = pow(rgb, vec3(2.0)); // gamma correction
@@ -63,11 +66,24 @@ float mitchellNetravali(float x, float B, float C)
     }
 }
 
+// full screen uv to the rendered corner of a buffer, kept half a texel
+// inside it so filtering doesn't pick up texels that weren't rendered
+vec2 scale_uv(sampler2D buffer, vec2 uv, float scale)
+{
+    vec2 half_texel = 0.5 / vec2(textureSize(buffer, 0));
+    return clamp(uv * scale, half_texel, vec2(scale) - half_texel);
+}
+
+vec4 sample_current(vec2 uv)
+{
+    return texture(u_current_buffer, scale_uv(u_current_buffer, uv, u_current_scale));
+}
+
 void main()
 {
-      vec4 current_colour = texture(u_current_buffer, aUV);
-      const vec2 unit = vec2(1.0) / u_resolution;
-      vec2 velocity       = texture(u_velocity_buffer, aUV).xy / u_resolution;
+      vec4 current_colour = sample_current(aUV);
+      const vec2 unit = vec2(1.0) / u_resolution_jitter.xy;
+      vec2 velocity       = texture(u_velocity_buffer, aUV).xy / u_resolution_jitter.xy;
       if(velocity.x < unit.x)
       {
           velocity.x = 0.0;
@@ -76,13 +92,14 @@ void main()
       {
           velocity.y = 0.0;
       }
-      vec3 history_colour = texture(u_history_buffer, aUV - velocity).xyz;
+      vec3 history_colour = texture(u_history_buffer,
+          scale_uv(u_history_buffer, aUV - velocity, u_history_scale)).xyz;
 
       // Apply clamping on the history color.
-      vec3 NearColor0 = texture(u_current_buffer, aUV + vec2(unit.x, 0)).xyz;
-      vec3 NearColor1 = texture(u_current_buffer, aUV + vec2(0, unit.y)).xyz;
-      vec3 NearColor2 = texture(u_current_buffer, aUV + vec2(-unit.x, 0)).xyz;
-      vec3 NearColor3 = texture(u_current_buffer, aUV + vec2(0, -unit.y)).xyz;
+      vec3 NearColor0 = sample_current(aUV + vec2(unit.x, 0)).xyz;
+      vec3 NearColor1 = sample_current(aUV + vec2(0, unit.y)).xyz;
+      vec3 NearColor2 = sample_current(aUV + vec2(-unit.x, 0)).xyz;
+      vec3 NearColor3 = sample_current(aUV + vec2(0, -unit.y)).xyz;
     
       vec3 BoxMin = min(current_colour.xyz, min(NearColor0, min(NearColor1, min(NearColor2, NearColor3))));
       vec3 BoxMax = max(current_colour.xyz, max(NearColor0, max(NearColor1, max(NearColor2, NearColor3))));;
@@ -24,23 +24,21 @@ out vec4 FragColor;
 #define LINEAR 0 /* Looks meh when using gamma correction. */
 #define QUADRATIC 1
 
-struct AABB
-{
-	vec3 min;
-	vec3 max;
-};
-
-uniform sampler2D   u_position_map;
+uniform sampler2D   u_position_map; // depth when GBUFFER_COMPACT
 uniform sampler2D   u_colour_map;
 uniform sampler2D   u_normal_map;
 uniform sampler3D   u_voxel_map; // x = metallic, y = roughness, z = AO
-uniform AABB		u_aabb;
-uniform vec3		u_voxel_resolution;
-uniform vec3		u_cam_position;
 uniform float		u_max_trace_distance;
 uniform float		u_diffuse_spec_mix;
+
+#include "include/voxel_constants.glsl"
+#include "include/gbuffer_common.glsl"
 #define VOXEL_SIZE (1/128.0)
 
+#pragma variant LOW_QUALITY
+#pragma variant GBUFFER_COMPACT
+#pragma constant SPECULAR_TRACE_STEPS 512
+
 vec3 orthogonal(vec3 u) {
 	u = normalize(u);
 	vec3 v = vec3(0.99146, 0.11664, 0.05832); // Pick any normalized vector.
@@ -51,18 +49,7 @@ float rand(vec2 co){
     return fract(sin(dot(co, vec2(12.9898, 78.233))) * 43758.5453);
 }
 
-bool is_in_aabb(vec3 pos)
-{
-	if (pos.x < u_aabb.min.x) { return false; }
-	if (pos.y < u_aabb.min.y) { return false; }
-	if (pos.z < u_aabb.min.z) { return false; }
-	if (pos.x > u_aabb.max.x) { return false; }
-	if (pos.y > u_aabb.max.y) { return false; }
-	if (pos.z > u_aabb.max.z) { return false; }
-	return true;
-}
-
-vec3 get_texel_from_pos(vec3 position, vec3 unit)
+vec3 get_uvw_from_pos(vec3 position, vec3 unit)
 {
 	vec3 clip_pos = position - u_aabb.min;
 	float x = clip_pos.x / unit.x;
@@ -71,34 +58,20 @@ vec3 get_texel_from_pos(vec3 position, vec3 unit)
 	return vec3(x/ u_voxel_resolution.x, y / u_voxel_resolution.y, z / u_voxel_resolution.z);
 }
 
-ivec3 get_absolute_texel_from_pos(vec3 position, vec3 resolution)
-{
-	vec3 aabb_dim = u_aabb.max - u_aabb.min;
-	vec3 unit = vec3((aabb_dim.x / resolution.x), (aabb_dim.y / resolution.y) , (aabb_dim.z / resolution.z));
-
-	// 0,0,0 is aabb.min
-	vec3 new_pos = position - u_aabb.min;
-	int x = int(new_pos.x / unit.x) ;
-	int y = int(new_pos.y / unit.y) ;
-	int z = int(new_pos.z / unit.z) ;
-
-	return ivec3(x, y, z);
-}
-
 vec4 get_voxel_colour(vec3 position, vec3 unit, float lod)
 {
-	return textureLod(u_voxel_map, get_texel_from_pos(position, unit), lod);
+	return textureLod(u_voxel_map, get_uvw_from_pos(position, unit), lod);
 }
 
 vec3 trace_ray(vec3 from, vec3 dir, vec3 unit)
 {
 	vec4 accum = vec4(0.0);
 	vec3 pos = from;
-	const int MAX_STEPS = 512;
+	const int MAX_STEPS = SPECULAR_TRACE_STEPS;
 	int steps = 0;
 	const int MAX_LOD = 5;
 	int lod = 5;
-	while (accum.w < 0.99 && is_in_aabb(pos) && steps < MAX_STEPS)
+	while (accum.w < 0.99 && is_in_aabb(pos, u_aabb) && steps < MAX_STEPS)
 	{
 		pos += unit * (lod + 1) * dir;
 		vec4 result = get_voxel_colour(pos, unit, lod);
@@ -128,7 +101,11 @@ float easeOutQuart(float x) {
 
 vec3 trace_cone(vec3 from, vec3 dir, vec3 unit, float aperture)
 {
+#ifdef LOW_QUALITY
+	const int MAX_STEPS = int(u_voxel_resolution.x) / 4;
+#else
 	const int MAX_STEPS = int(u_voxel_resolution.x); // should probs be the longest axis of minimum mip dimension
+#endif
 	const int MIN_LOD	= 2;
 	const int MAX_LOD	= 5;
 	vec4 accum = vec4(0.0);
@@ -138,7 +115,7 @@ vec3 trace_cone(vec3 from, vec3 dir, vec3 unit, float aperture)
 	pos += dir * (length(unit * lod));
 	float cone_distance = distance(from, pos);
 
-	while (accum.w < 0.05 && is_in_aabb(pos) && cone_distance < u_max_trace_distance && steps < MAX_STEPS)
+	while (accum.w < 0.05 && is_in_aabb(pos, u_aabb) && cone_distance < u_max_trace_distance && steps < MAX_STEPS)
 	{
 		vec4 result = get_voxel_colour(pos, unit, lod);
 		cone_distance = distance(from, pos);
@@ -250,11 +227,12 @@ vec3 trace_cones_32(vec3 from, vec3 dir, vec3 unit)
 
 void main()
 {
+	loadVoxelConstants();
 	vec3 aabb_dim = u_aabb.max - u_aabb.min;
 	vec3 unit = vec3((aabb_dim.x / u_voxel_resolution.x), (aabb_dim.y / u_voxel_resolution.y), (aabb_dim.z / u_voxel_resolution.z));
 	vec3 diffuse = texture(u_colour_map, aUV).xyz;
-	vec3 position = texture(u_position_map, aUV).xyz;
-	vec3 normal = texture(u_normal_map, aUV).xyz;
+	vec3 position = sampleGBufferPosition(u_position_map, aUV);
+	vec3 normal = sampleGBufferNormal(u_normal_map, aUV);
 	vec3 normalized_n = normalize(normal);
 	vec3 v_diffuse = trace_cones_16(position, normalized_n, unit);
 	vec3 v_spec = trace_ray(position, reflect(position, normalized_n), unit);
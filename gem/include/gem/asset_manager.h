@@ -1,6 +1,7 @@
 #pragma once
 #include "gem/asset.h"
 #include "gem/asset_hot_reload.h"
+#include "gem/texture.h"
 #include <functional>
 #include <future>
 #include <map>
@@ -11,12 +12,16 @@ namespace gem {
 using AssetLoadCallback = void (*)(AssetIntermediate *);
 using AssetLoadedCallback = std::function<void(Asset *)>;
 using AssetUnloadCallback = void (*)(Asset *);
+// returns true once work started by the sync callbacks has completed
+using AssetLoadPollCallback = bool (*)(AssetIntermediate *);
 
 enum class AssetLoadProgress { not_loaded, loading, loaded, unloading };
 
 struct AssetLoadInfo {
   std::string m_path;
   AssetType m_type;
+  // only used by texture loads, selects the block compression format
+  TextureMapType m_texture_map_type = TextureMapType::diffuse;
 
   bool operator==(const AssetLoadInfo &o) const {
     return m_path == o.m_path && m_type == o.m_type;
@@ -37,6 +42,9 @@ struct AssetLoadResult {
   std::vector<AssetLoadInfo> m_new_assets_to_load;
   // synchronous tasks associated with this asset e.g. submit texture mem to GPU
   std::vector<AssetLoadCallback> m_asset_load_sync_callbacks;
+  // polled every tick after the sync callbacks have run, does not count
+  // towards the per tick callback budget e.g. waiting on a driver compile
+  AssetLoadPollCallback m_asset_load_poll = nullptr;
 
   GEM_IMPL_ALLOC(AssetLoadResult)
 };
@@ -48,6 +56,9 @@ public:
   AssetHandle load_asset(const std::string &path, const AssetType &assetType,
                          AssetLoadedCallback on_asset_loaded = nullptr);
 
+  AssetHandle load_asset(const AssetLoadInfo &info,
+                         AssetLoadedCallback on_asset_loaded = nullptr);
+
   void unload_asset(const AssetHandle &handle);
 
   Asset *get_asset(AssetHandle &handle);
@@ -33,7 +33,11 @@ private:
   inline static GPUBackend *s_selected_backend = nullptr;
 
 public:
-  virtual void init(BackendInit &init_props) = 0;
+  // backends are deleted through this type, see init_backend
+  virtual ~GPUBackend() = default;
+
+  // false when no usable context was created
+  virtual bool init(BackendInit &init_props) = 0;
   virtual void process_sdl_event() = 0;
   virtual void engine_pre_frame() = 0;
   virtual void engine_post_frame() = 0;
@@ -51,13 +55,18 @@ public:
   static GPUBackend *selected() { return s_selected_backend; }
   static BackendAPI get_backend_api() { return s_selected_backend_api; }
 
+  // on failure no backend is selected
   template <typename _Backend, typename... Args>
-  static void init_backend(BackendInit &props, Args &&...args) {
+  static bool init_backend(BackendInit &props, Args &&...args) {
     static_assert(std::is_base_of<GPUBackend, _Backend>());
     auto *backend = new _Backend(std::forward<Args>(args)...);
-    backend->init(props);
+    if (!backend->init(props)) {
+      delete backend;
+      return false;
+    }
     s_selected_backend = static_cast<GPUBackend *>(backend);
     s_selected_backend_api = s_selected_backend->get_backend_api_enum();
+    return true;
   }
 };
 } // namespace gem
\ No newline at end of file
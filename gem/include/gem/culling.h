@@ -0,0 +1,91 @@
+#pragma once
+#include "gem/AABB.h"
+#include "gem/alias.h"
+#include "glm.hpp"
+#include <array>
+#include <vector>
+
+namespace gem {
+
+// A level of the max depth pyramid copied back from the GPU, see
+// open_gl::tech::HiZ. Depth is window space, 0 near 1 far.
+struct DepthPyramidLevel {
+  std::vector<float> m_depth;
+  glm::ivec2 m_size{0};
+  // a texel covers 2^(level + 1) texels of the depth buffer
+  glm::ivec2 m_depth_resolution{0};
+  u32 m_level = 0;
+  // camera the depth was rendered with
+  glm::mat4 m_view_proj{1.0f};
+  bool m_valid = false;
+};
+
+// World space bounds of a batch of boxes kept as structure of arrays (centre
+// and half extent per axis) so cull() tests 8 boxes per iteration with AVX, 4
+// with SSE. The arrays are padded to the widest lane count, cull() writes a
+// byte per box so a draw loop can index the result with the add() order.
+// resize() / set() and the ranged overloads let disjoint index ranges be
+// filled and tested from different threads.
+class FrustumCuller {
+public:
+  static constexpr u32 s_lane_count = 8;
+
+  // values written to the visibility lists
+  enum Visibility : u8 { outside = 0, inside = 1, occluded = 2 };
+
+  void clear();
+
+  // local bounds under an affine model matrix, the world box is the
+  // conservative fit of the transformed box
+  void add(const AABB &local, const glm::mat4 &model);
+
+  // count boxes whose bounds are then given with set()
+  void resize(u32 count);
+  void set(u32 index, const AABB &local, const glm::mat4 &model);
+
+  // the world centre and half extent add() stores for the box
+  static void get_world_bounds(const AABB &local, const glm::mat4 &model,
+                               glm::vec3 &centre, glm::vec3 &extent);
+
+  // planes as ax + by + cz + d >= 0 inside, need not be normalised (see
+  // Utils::get_planes_from_view_proj). returns the number of visible boxes
+  u32 cull(const std::array<glm::vec4, 6> &planes,
+           std::vector<u8> &visible) const;
+  // boxes [first, last), visible is indexed by box and sized by the caller
+  u32 cull(const std::array<glm::vec4, 6> &planes, u8 *visible, u32 first,
+           u32 last) const;
+
+  // the widest compiled path is the one cull() uses, the others exist to be
+  // compared against it. a path not compiled in runs scalar
+  enum class SimdPath : u8 { scalar, sse, avx };
+  static bool has_path(SimdPath path);
+  u32 cull(const std::array<glm::vec4, 6> &planes, u8 *visible, u32 first,
+           u32 last, SimdPath path) const;
+
+  // marks inside boxes whose nearest point is behind the farthest depth of
+  // the pyramid texels they cover as occluded, boxes are projected with the
+  // pyramid's camera. returns the number of occluded boxes
+  u32 occlusion_cull(const DepthPyramidLevel &pyramid,
+                     std::vector<u8> &visible) const;
+  u32 occlusion_cull(const DepthPyramidLevel &pyramid, u8 *visible, u32 first,
+                     u32 last) const;
+
+  glm::vec3 get_centre(u32 index) const;
+
+  u32 size() const { return p_count; }
+
+protected:
+  enum Bound {
+    centre_x = 0,
+    centre_y,
+    centre_z,
+    extent_x,
+    extent_y,
+    extent_z,
+    bound_count
+  };
+
+  std::array<std::vector<float>, bound_count> p_bounds;
+  u32 p_count = 0;
+};
+} // namespace gem
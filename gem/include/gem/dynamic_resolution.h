@@ -0,0 +1,46 @@
+#pragma once
+#include "gem/alias.h"
+#include <string>
+#include <vector>
+
+namespace gem {
+
+// Render scale controller for passes whose cost follows their pixel count.
+// Each update splits the gap between the measured and target frame time
+// across the passes in proportion to their own GPU time and moves every
+// scale part of the way towards the one that would close its share, as
+// cost goes with scale squared. Timings arrive a few frames late, the
+// partial steps keep that from oscillating.
+class DynamicResolution {
+public:
+  struct Pass {
+    std::string m_name;
+    float m_scale = 1.0f;
+    float m_min_scale = 0.5f;
+    // targets are allocated for this scale, it can't change after add_pass
+    float m_max_scale = 1.0f;
+    // latest measurement, 0 while the pass isn't running
+    float m_gpu_ms = 0.0f;
+  };
+
+  // returns the index scales and timings are set / read with
+  u32 add_pass(const std::string &name, float scale, float min_scale,
+               float max_scale);
+
+  void set_gpu_time(u32 pass, float gpu_ms);
+  float get_scale(u32 pass) const;
+
+  // call when a new frame time arrives, scales don't move while disabled
+  void update(float frame_gpu_ms);
+
+  bool m_enabled = true;
+  float m_target_frame_ms = 16.6f;
+  // errors within this fraction of the target are left alone
+  float m_tolerance = 0.05f;
+  // fraction of the step towards a pass's ideal scale taken per update
+  float m_rate = 0.25f;
+  float m_last_frame_ms = 0.0f;
+
+  std::vector<Pass> m_passes;
+};
+} // namespace gem
@@ -25,7 +25,10 @@ public:
   inline static Project active_project;
   inline static DebugCallbackCollection debug_callbacks;
 
-  static void init();
+  // headless renders frame_limit frames offscreen without a window, see
+  // GLHeadlessBackend. false if the backend failed to create a context,
+  // nothing else may be initialised then
+  static bool init(bool headless = false, u32 frame_limit = 0);
   static void update();
   static void save_project_to_disk(const std::string &filename,
                                    const std::string &directory);
@@ -5,7 +5,7 @@
 namespace gem {
 class GLBackend : public GPUBackend {
 public:
-  void init(BackendInit &init_props) override;
+  bool init(BackendInit &init_props) override;
   void process_sdl_event() override;
   void engine_pre_frame() override;
   void engine_post_frame() override;
@@ -16,6 +16,11 @@ public:
   };
   glm::vec2 get_window_dim() override;
 
-  SDL_GLContext *m_sdl_gl_context;
+  SDL_GLContext *m_sdl_gl_context = nullptr;
+
+protected:
+  // state every GL backend sets once its context is current
+  static void init_gl_defaults();
+  void init_imgui_context();
 };
 } // namespace gem
\ No newline at end of file
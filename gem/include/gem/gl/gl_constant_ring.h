@@ -0,0 +1,130 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "glm.hpp"
+#include <array>
+#include <vector>
+
+namespace gem {
+
+// C++ mirrors of the std140 blocks declared in the .shader files. Only
+// vec4 / mat4 sized members so the C++ layout matches std140 without padding.
+
+// written once per frame, binding 0
+struct FrameConstants {
+  static constexpr u32 s_binding = 0;
+
+  glm::mat4 m_view;
+  glm::mat4 m_proj;
+  glm::mat4 m_vp;
+  glm::mat4 m_last_vp;
+  glm::mat4 m_inv_proj;
+  // world positions are rebuilt from depth with these, see GBuffer::Layout
+  glm::mat4 m_inv_vp;
+  glm::mat4 m_last_inv_vp;
+  glm::vec4 m_cam_pos;
+  // xy = resolution, zw = halton jitter in uv units
+  glm::vec4 m_resolution_jitter;
+  // x = frame index
+  glm::ivec4 m_frame;
+};
+
+// written per draw, binding 1
+struct DrawConstants {
+  static constexpr u32 s_binding = 1;
+
+  glm::mat4 m_model;
+  glm::mat4 m_last_model;
+  glm::mat4 m_normal;
+  // x = entity index, y = material index, z = stream feedback slot
+  glm::ivec4 m_ids;
+};
+
+// lighting pass, binding 2
+struct LightingConstants {
+  static constexpr u32 s_binding = 2;
+  static constexpr u32 s_max_point_lights = 16;
+
+  struct PointLightData {
+    // xyz = position, w = radius
+    glm::vec4 m_position_radius;
+    // xyz = colour, w = intensity
+    glm::vec4 m_colour_intensity;
+  };
+
+  glm::mat4 m_dir_light_space_matrix;
+  // xyz = direction, w = intensity
+  glm::vec4 m_dir_light_direction_intensity;
+  glm::vec4 m_dir_light_colour;
+  glm::vec4 m_dir_light_pos;
+  // x = point light count
+  glm::ivec4 m_counts;
+  std::array<PointLightData, s_max_point_lights> m_point_lights;
+};
+
+// voxel grid bounds, binding 3
+struct VoxelConstants {
+  static constexpr u32 s_binding = 3;
+
+  glm::vec4 m_aabb_min;
+  glm::vec4 m_aabb_max;
+  glm::vec4 m_resolution;
+  glm::vec4 m_voxel_unit;
+};
+
+static_assert(sizeof(FrameConstants) % 16 == 0, "std140 size");
+static_assert(sizeof(DrawConstants) % 16 == 0, "std140 size");
+static_assert(sizeof(LightingConstants) % 16 == 0, "std140 size");
+static_assert(sizeof(VoxelConstants) % 16 == 0, "std140 size");
+
+// Persistently mapped uniform buffer split into one region per frame in
+// flight. Constants are appended with push() and bound with
+// glBindBufferRange, a region is only rewritten once the fence placed at the
+// end of its frame has signalled. A frame that outgrows its region spills
+// into an overflow buffer written with glNamedBufferSubData, the ring is then
+// resized at the end of the frame.
+class GLConstantRing {
+public:
+  static void init();
+  static void cleanup();
+
+  static void begin_frame();
+  static void end_frame();
+
+  // copies data into the current frame region, returns its offset. offsets
+  // past the ring address the overflow buffer, pass them on to bind() as is
+  static u32 push(const void *data, u32 size);
+
+  static void bind(u32 binding, u32 offset, u32 size);
+
+  template <typename _Ty> static void push_and_bind(const _Ty &data) {
+    const u32 offset = push(&data, static_cast<u32>(sizeof(_Ty)));
+    bind(_Ty::s_binding, offset, static_cast<u32>(sizeof(_Ty)));
+  }
+
+  static glm::vec2 get_jitter(u32 frame_index, glm::vec2 resolution);
+
+  static constexpr u32 s_frames_in_flight = 3;
+  inline static u32 s_frame_region_size = 4 * 1024 * 1024;
+
+  inline static u32 s_bytes_last_frame = 0;
+
+protected:
+  static void create_ring();
+  static void destroy_ring();
+  static u32 push_overflow(const void *data, u32 size, u32 aligned_size);
+
+  inline static gl_handle s_buffer = INVALID_GL_HANDLE;
+  inline static u8 *s_mapped = nullptr;
+  inline static i32 s_alignment = 256;
+  inline static u32 s_region = 0;
+  inline static u32 s_head = 0;
+  inline static std::array<GLsync, s_frames_in_flight> s_fences{};
+
+  inline static gl_handle s_overflow_buffer = INVALID_GL_HANDLE;
+  inline static u32 s_overflow_capacity = 0;
+  inline static u32 s_overflow_head = 0;
+  // replaced by a larger buffer this frame, may still be bound
+  inline static std::vector<gl_handle> s_retired_overflow_buffers;
+};
+} // namespace gem
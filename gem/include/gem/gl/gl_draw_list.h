@@ -0,0 +1,147 @@
+#pragma once
+#include "gem/alias.h"
+#include "gem/culling.h"
+#include "glm.hpp"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace gem {
+
+class Scene;
+class Material;
+class MaterialInstance;
+struct Transform;
+struct MeshComponent;
+
+enum class DrawPass : u8 { gbuffer = 0, gbuffer_textureless, shadow, count };
+
+// frustum a pass is culled against, passes sharing a view share its result.
+// unculled keeps every renderable, for passes culled on the GPU
+enum class DrawView : u8 { camera = 0, light, unculled, count };
+
+struct DrawPacket {
+  u64 m_key;
+  u32 m_entity;
+  Transform *m_transform;
+  MeshComponent *m_mesh;
+  Material *m_material;
+};
+
+struct DrawRange {
+  DrawPacket *m_first = nullptr;
+  u32 m_count = 0;
+
+  DrawPacket *begin() const { return m_first; }
+  DrawPacket *end() const { return m_first + m_count; }
+};
+
+// Packets for every renderable of every scene, built once per frame with a
+// single walk of the registries. Keys are laid out (msb to lsb) as
+// pass 4 | shader 10 | material 16 | vao 16 | depth 18 and radix sorted, so
+// each pass reads a contiguous range ordered to minimise program, texture and
+// VAO changes, front to back within a state bucket.
+// Renderables are frustum culled once per view used by an enabled pass, only
+// visible ones get packets. With occluders set, camera view renderables
+// hidden in that depth get their packets in a separate occluded range per
+// pass instead, for the caller to test again against this frame's depth.
+// The registry walk is serial, bounds, culling and packet recording run over
+// partitions of the renderables on Parallel's workers, each into its own
+// list. The lists are concatenated before the sort, so the GL thread only
+// replays sorted packets.
+// Packets point into the registries, they are valid until a renderable
+// component is added or removed.
+class GLDrawList {
+public:
+  static constexpr u32 s_pass_count = static_cast<u32>(DrawPass::count);
+  static constexpr u32 s_view_count = static_cast<u32>(DrawView::count);
+  // smaller partitions cost more to hand out than to record
+  static constexpr u32 s_min_record_range = 512;
+
+  struct PassStats {
+    u32 m_visible = 0;
+    u32 m_culled = 0;
+    u32 m_occluded = 0;
+  };
+
+  // program a material has to use to be drawn in the pass, INVALID_GL_HANDLE
+  // accepts every renderable (depth only passes)
+  void set_pass(DrawPass pass, bool enabled,
+                gl_handle program = INVALID_GL_HANDLE,
+                DrawView view = DrawView::camera);
+
+  void set_view(DrawView view, const glm::mat4 &view_proj);
+
+  // depth the camera view is occlusion culled against, nullptr disables it.
+  // must outlive build
+  void set_occluders(const DepthPyramidLevel *occluders);
+
+  void build(std::vector<Scene *> &scenes, glm::vec3 view_position);
+
+  DrawRange get_packets(DrawPass pass);
+  // packets of the pass hidden by the occluders, not part of get_packets
+  DrawRange get_occluded_packets(DrawPass pass);
+
+  // packet key from its fields, each masked to its width. range_index is the
+  // pass, plus s_pass_count for occluded packets
+  static u64 make_key(u32 range_index, u32 shader_bits, u32 material_bits,
+                      u32 vao, u32 depth);
+  // stable sort by m_key, scratch is resized to match
+  static void radix_sort(std::vector<DrawPacket> &packets,
+                         std::vector<DrawPacket> &scratch);
+
+  u32 m_packet_count = 0;
+  bool m_frustum_culling = true;
+  bool m_multithreaded = true;
+  // partitions the last build was recorded in
+  u32 m_record_ranges = 0;
+  // renderables accepted by each pass's filter split by visibility
+  std::array<PassStats, s_pass_count> m_pass_stats{};
+
+protected:
+  struct PassFilter {
+    bool m_enabled = false;
+    gl_handle m_program = INVALID_GL_HANDLE;
+    DrawView m_view = DrawView::camera;
+  };
+
+  struct Renderable {
+    u32 m_entity;
+    Transform *m_transform;
+    MeshComponent *m_mesh;
+    Material *m_material;
+    // key fields, resolved during the serial walk
+    u32 m_shader_bits;
+    u32 m_material_bits;
+  };
+
+  using PassStatsArray = std::array<PassStats, s_pass_count>;
+
+  u32 get_shader_bits(gl_handle program);
+  u32 get_material_bits(const MaterialInstance *instance);
+  // bounds, culling and packets for renderables [first, last), safe to run
+  // concurrently for disjoint ranges
+  void record(u32 first, u32 last, u32 range, glm::vec3 view_position);
+  void sort();
+
+  std::array<PassFilter, s_pass_count> p_passes{};
+  // visible ranges then occluded ranges, the key's pass field indexes them
+  std::array<DrawRange, s_pass_count * 2> p_ranges{};
+  std::array<std::array<glm::vec4, 6>, s_view_count> p_view_planes{};
+  const DepthPyramidLevel *p_occluders = nullptr;
+  // a FrustumCuller::Visibility per renderable in gather order, one list
+  // per view
+  std::array<std::vector<u8>, s_view_count> p_visible;
+  std::vector<Renderable> p_renderables;
+  FrustumCuller p_culler;
+  std::array<bool, s_view_count> p_view_used{};
+  // per partition packets and stats, merged after recording
+  std::vector<std::vector<DrawPacket>> p_range_packets;
+  std::vector<PassStatsArray> p_range_stats;
+  std::vector<DrawPacket> p_packets;
+  std::vector<DrawPacket> p_scratch;
+  // dense ids so the key fields stay small, rebuilt each frame
+  std::unordered_map<gl_handle, u32> p_shader_ids;
+  std::unordered_map<const MaterialInstance *, u32> p_material_ids;
+};
+} // namespace gem
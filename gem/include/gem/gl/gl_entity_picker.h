@@ -0,0 +1,55 @@
+#pragma once
+#include "GL/glew.h"
+#include "entt.hpp"
+#include "gem/alias.h"
+#include "glm.hpp"
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace gem {
+
+// Reads the entity under a pixel of the R32UI gbuffer entity target without
+// stalling. dispatch_readbacks copies each queued pixel into a pixel buffer
+// and fences it, poll hands the result to the request's callback once the
+// fence has signalled, typically 1-2 frames later. Pixels with nothing drawn
+// read as entt::null.
+class GLEntityPicker {
+public:
+  using Callback = std::function<void(entt::entity)>;
+
+  // copies in flight at once, further requests wait in the queue
+  static constexpr u32 s_ring_size = 4;
+
+  void init();
+  void cleanup();
+
+  // pixel in the entity target, origin bottom left
+  void request(glm::ivec2 pixel, Callback callback);
+  // call after the entity target has been written for the frame
+  void dispatch_readbacks(gl_handle entity_texture, glm::ivec2 resolution);
+  // runs the callbacks of every finished copy
+  void poll();
+
+  u32 m_in_flight = 0;
+
+protected:
+  struct Request {
+    glm::ivec2 m_pixel;
+    Callback m_callback;
+  };
+
+  // value initialised in p_readbacks
+  struct Readback {
+    GLsync m_fence;
+    Callback m_callback;
+  };
+
+  // a u32 per slot
+  gl_handle p_buffer = INVALID_GL_HANDLE;
+  std::array<Readback, s_ring_size> p_readbacks{};
+  std::vector<Request> p_queued;
+  // slot of the oldest copy in flight
+  u32 p_read = 0;
+};
+} // namespace gem
@@ -28,6 +28,10 @@ public:
                                         GLenum format = GL_DEPTH24_STENCIL8);
   void check();
 
+  // swaps the texture behind an existing colour attachment, the old texture
+  // is not deleted
+  void replace_colour_attachment(u32 index, gl_handle texture);
+
   template <typename _Ty, size_t w, size_t h>
   std::array<_Ty, w * h> read_pixels(u32 x, u32 y, u32 attachment_index,
                                      GLenum pixel_format, GLenum pixel_type) {
@@ -56,4 +60,24 @@ public:
   gl_handle m_depth_attachment;
   uint32_t m_width, m_height;
 };
+
+// Pair of framebuffers for temporal passes. The pass writes current() while
+// sampling history(), swap() at the end of the frame turns this frame's output
+// into next frame's history without copying it.
+class GLHistoryFramebuffer {
+public:
+  static GLHistoryFramebuffer
+  create(glm::vec2 resolution,
+         std::vector<GLFramebuffer::attachment_info> colour_attachments,
+         bool add_depth = false);
+
+  GLFramebuffer &current() { return m_framebuffers[m_current]; }
+  GLFramebuffer &history() { return m_framebuffers[m_current ^ 1u]; }
+
+  void swap();
+  void cleanup();
+
+  std::array<GLFramebuffer, 2> m_framebuffers;
+  u32 m_current = 0;
+};
 } // namespace gem
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "gem/json.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace gem {
+
+// GPU time per named pass, without a Tracy server. Every begin_pass and
+// end_frame writes a GL_TIMESTAMP, a pass costs the time between its
+// timestamp and the next one. A frame's queries are read back once the GPU
+// has written its last one, usually 2-3 frames later, a frame started while
+// every slot is still in flight isn't measured rather than waited on.
+class GLGpuProfiler {
+public:
+  static constexpr u32 s_frames_in_flight = 4;
+  static constexpr u32 s_history_size = 128;
+
+  struct PassTiming {
+    std::string m_name;
+    float m_last_ms = 0.0f;
+    float m_smoothed_ms = 0.0f;
+    // over the history window
+    float m_max_ms = 0.0f;
+    // ms per resolved frame, 0 when the pass didn't run
+    std::array<float, s_history_size> m_history{};
+    u64 m_last_frame = 0;
+  };
+
+  // ends the previous pass of this frame
+  static void begin_pass(const char *name);
+  // ends the last pass and reads back every frame the GPU has finished
+  static void end_frame();
+  static void cleanup();
+
+  // passes measured in the last resolved frame
+  static bool was_measured(const PassTiming &pass);
+  // nullptr until a pass of that name has begun
+  static const PassTiming *find_pass(const char *name);
+  static nlohmann::json to_json();
+
+  inline static bool s_enabled = true;
+  // weight of a new measurement in m_smoothed_ms
+  inline static float s_smoothing = 0.1f;
+  // in order of first appearance
+  inline static std::vector<PassTiming> s_passes;
+  inline static float s_frame_ms = 0.0f;
+  inline static float s_smoothed_frame_ms = 0.0f;
+  inline static std::array<float, s_history_size> s_frame_history{};
+  // next history entry written, the oldest one
+  inline static u32 s_history_offset = 0;
+  inline static u64 s_resolved_frames = 0;
+  inline static u32 s_skipped_frames = 0;
+
+protected:
+  // value initialised in s_frames
+  struct Frame {
+    // s_passes index of each pass
+    std::vector<u32> m_passes;
+    // one per pass and the end of the frame
+    std::vector<gl_handle> m_queries;
+    u32 m_count;
+    bool m_pending;
+  };
+
+  static void timestamp(Frame &frame);
+  static bool resolve(Frame &frame);
+  static void resolve_finished();
+  // names are compared, not copied, once a pass has been seen
+  static u32 get_pass(const char *name);
+
+  inline static std::array<Frame, s_frames_in_flight> s_frames{};
+  // slot of the oldest frame in flight / of the frame being recorded
+  inline static u32 s_read = 0;
+  inline static u32 s_write = 0;
+  inline static bool s_frame_open = false;
+  inline static bool s_recording = false;
+  // passes mostly begin in the same order each frame, the one after the
+  // last pass is checked first
+  inline static u32 s_last_pass = 0;
+};
+} // namespace gem
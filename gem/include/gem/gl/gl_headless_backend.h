@@ -0,0 +1,46 @@
+#pragma once
+#include "gem/alias.h"
+#include "gem/gl/gl_backend.h"
+#include <vector>
+
+namespace gem {
+// GL backend without a window, for running the renderer on machines with no
+// display or GPU (CI, llvmpipe). A surfaceless EGL context renders into an
+// offscreen framebuffer which GLState binds in place of framebuffer 0. There
+// are no events and nothing is swapped, ImGui still runs so apps don't need
+// a headless path of their own.
+// Select with GPUBackend::init_backend<GLHeadlessBackend>(props, frames),
+// m_quit is set once frames have been rendered (0 runs until the app quits).
+// Needs EGL, see GEM_ENABLE_HEADLESS_EGL in gem/CMakeLists.txt.
+class GLHeadlessBackend : public GLBackend {
+public:
+  explicit GLHeadlessBackend(u32 frame_limit = 0);
+
+  bool init(BackendInit &init_props) override;
+  void process_sdl_event() override;
+  void engine_pre_frame() override;
+  void engine_post_frame() override;
+  void engine_shut_down() override;
+  glm::vec2 get_window_dim() override;
+
+  // RGBA8 copy of the offscreen colour target, bottom row first
+  void read_colour(std::vector<u8> &rgba);
+
+  u32 m_frame_limit = 0;
+  u32 m_frame_count = 0;
+  glm::ivec2 m_resolution{0};
+
+  gl_handle m_framebuffer = INVALID_GL_HANDLE;
+  gl_handle m_colour = INVALID_GL_HANDLE;
+  gl_handle m_depth_stencil = INVALID_GL_HANDLE;
+
+protected:
+  bool create_context();
+  void destroy_context();
+
+  // EGLDisplay / EGLContext, kept opaque so EGL stays out of the headers
+  void *p_display = nullptr;
+  void *p_context = nullptr;
+  float p_total_frametime = 0.0f;
+};
+} // namespace gem
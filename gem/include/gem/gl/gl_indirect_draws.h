@@ -0,0 +1,129 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "gem/gl/gl_draw_list.h"
+#include "gem/gl/tech/hiz.h"
+#include "glm.hpp"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace gem {
+
+class GLShader;
+class GLMaterialTable;
+
+// GPU driven submission of a packet range. Per object transforms, world
+// bounds and ids are uploaded to an SSBO, gpu_cull.shader tests the bounds
+// against the view frustum and appends a DrawElementsIndirectCommand per
+// visible object. Commands are grouped by VAO and each group is drawn with
+// one glMultiDrawElementsIndirectCount, so the number of GL calls depends on
+// the number of distinct vertex buffers rather than the number of objects.
+// Draws index their object with gl_BaseInstanceARB, see GPU_DRIVEN in
+// draw_constants.glsl.
+// With a depth pyramid the first cull phase also drops objects hidden in last
+// frame's depth and flags them, the second phase retests the flagged objects
+// against a pyramid of the first phase's depth and draws the ones that came
+// into view from a separate command range.
+class GLIndirectDraws {
+public:
+  static constexpr u32 s_object_binding = 9;
+  static constexpr u32 s_command_binding = 10;
+  static constexpr u32 s_count_binding = 11;
+  static constexpr u32 s_cull_state_binding = 13;
+  static constexpr u32 s_cull_group_size = 64;
+
+  // mirrors DrawObject in draw_constants.glsl (std430)
+  struct GPUObject {
+    glm::mat4 m_model;
+    glm::mat4 m_last_model;
+    glm::mat4 m_normal;
+    // x = entity index, y = material index, z = stream feedback slot
+    glm::ivec4 m_ids;
+    glm::vec4 m_bounds_centre;
+    glm::vec4 m_bounds_extent;
+    // x = index count, y = first index, z = batch, w = batch's first command
+    glm::uvec4 m_draw;
+  };
+  static_assert(sizeof(GPUObject) == 256, "GPUObject must match std430 layout");
+
+  // DrawElementsIndirectCommand
+  struct GPUCommand {
+    u32 m_count;
+    u32 m_instance_count;
+    u32 m_first_index;
+    i32 m_base_vertex;
+    u32 m_base_instance;
+  };
+
+  enum class CullPhase : u8 { first = 0, second, count };
+
+  // needs GL_ARB_indirect_parameters and GL_ARB_shader_draw_parameters
+  static bool is_supported();
+
+  void init();
+  void cleanup();
+
+  // uploads an object per indexed packet, non indexed meshes draw nothing
+  // through VAO::draw either and are skipped. call between
+  // GLTextureStreamer::begin_feedback / end_feedback
+  void build(DrawRange draws, GLMaterialTable &material_table);
+
+  // writes the phase's commands and counts. the first phase occlusion culls
+  // against occluders when given and valid, the second phase only runs after
+  // an occluded first phase and needs them
+  void dispatch_cull(GLShader &cull_shader,
+                     const std::array<glm::vec4, 6> &planes,
+                     CullPhase phase = CullPhase::first,
+                     const open_gl::tech::HiZ::Pyramid *occluders = nullptr);
+
+  // one multi draw per batch with the bound program
+  void draw(CullPhase phase = CullPhase::first);
+
+  // copies the cull counters of the last dispatches back, they land in the
+  // stats below during a later build
+  void request_stats();
+
+  u32 m_object_count = 0;
+  u32 m_batch_count = 0;
+  u32 m_frustum_culled = 0;
+  // hidden after both phases / rejected by the first but drawn by the second
+  u32 m_occluded = 0;
+  u32 m_disoccluded = 0;
+
+protected:
+  struct Batch {
+    gl_handle m_vao = INVALID_GL_HANDLE;
+    u32 m_first_command = 0;
+    u32 m_command_count = 0;
+  };
+
+  // mirrors the header of CullState in gpu_cull.shader, an occluded flag per
+  // object follows it
+  struct CullStats {
+    u32 m_frustum_culled;
+    u32 m_occluded;
+    u32 m_disoccluded;
+    u32 m_pad;
+  };
+
+  void reserve(u32 object_count, u32 batch_count);
+  void poll_stats();
+
+  gl_handle p_object_ssbo = INVALID_GL_HANDLE;
+  // a region of object capacity commands / batch capacity counts per phase
+  gl_handle p_command_buffer = INVALID_GL_HANDLE;
+  gl_handle p_count_buffer = INVALID_GL_HANDLE;
+  gl_handle p_cull_state_buffer = INVALID_GL_HANDLE;
+  gl_handle p_stats_readback = INVALID_GL_HANDLE;
+  GLsync p_stats_fence = nullptr;
+  // the first phase flagged occluded objects for the second
+  bool p_occlusion_culled = false;
+  u32 p_object_capacity = 0;
+  u32 p_batch_capacity = 0;
+
+  std::vector<GPUObject> p_objects;
+  std::vector<Batch> p_batches;
+  std::unordered_map<gl_handle, u32> p_batch_lookup;
+};
+} // namespace gem
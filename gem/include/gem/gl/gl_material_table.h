@@ -0,0 +1,110 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "gem/asset.h"
+#include "gem/texture.h"
+#include "glm.hpp"
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace gem {
+
+class AssetManager;
+class GLShader;
+class Material;
+
+// Per material texture table so a draw only has to pass a material index.
+// Uses GL_ARB_bindless_texture handles when available, otherwise textures
+// are copied into 2D texture arrays grouped by size / format, each with the
+// full mip chain for its size, and the table stores the array + layer to
+// sample. Arrays left without live layers are freed.
+class GLMaterialTable {
+public:
+  // one slot per TextureMapType
+  static constexpr u32 s_map_count = 6;
+  static constexpr u32 s_table_binding = 8;
+  // GL 4.5 guarantees 16 fragment samplers, gbuffer.shader also samples
+  // u_prev_position_map. mirrors MATERIAL_ARRAY_COUNT in gbuffer.shader
+  static constexpr u32 s_max_texture_arrays = 15;
+  static constexpr u32 s_first_array_unit = 8;
+
+  // mirrors MaterialTextures in gbuffer.shader (std430)
+  struct GPUEntry {
+    std::array<u64, s_map_count> m_handles;
+    std::array<glm::ivec2, s_map_count> m_layers;
+    // finest / coarsest level holding valid data, sampling is clamped to it
+    std::array<glm::ivec2, s_map_count> m_lods;
+  };
+  static_assert(sizeof(GPUEntry) == 144, "GPUEntry must match std430 layout");
+
+  void init();
+  void cleanup();
+
+  // registers the material's texture set on first use, result is cached on
+  // the material instance
+  i32 get_material_index(Material &material);
+
+  // resolve loaded textures, follow handle and resident level changes (mip
+  // streaming) and upload the table if anything changed
+  void update(AssetManager &am);
+
+  void bind(GLShader &shader);
+
+  const std::array<Texture *, s_map_count> &get_textures(i32 material_index);
+
+  bool m_bindless = false;
+  u32 m_material_count = 0;
+  u32 m_texture_count = 0;
+
+protected:
+  struct Entry {
+    std::array<AssetHandle, s_map_count> m_handles;
+    std::array<Texture *, s_map_count> m_textures;
+  };
+
+  struct TextureRecord {
+    AssetHandle m_asset;
+    gl_handle m_source = INVALID_GL_HANDLE;
+    u64 m_bindless_handle = 0;
+    i32 m_array = -1;
+    i32 m_layer = -1;
+    glm::ivec2 m_lods = glm::ivec2(0);
+    bool m_referenced = false;
+  };
+
+  // a group with m_handle == INVALID_GL_HANDLE is a free slot
+  struct ArrayGroup {
+    gl_handle m_handle = INVALID_GL_HANDLE;
+    i32 m_width = 0;
+    i32 m_height = 0;
+    i32 m_levels = 0;
+    GLenum m_format = GL_NONE;
+    i32 m_capacity = 0;
+    i32 m_next_layer = 0;
+    std::vector<i32> m_free_layers;
+  };
+
+  void refresh_record(Texture *texture, TextureRecord &record);
+  // follows mip streaming, copies newly resident levels into the layer
+  void sync_resident_level(Texture *texture, TextureRecord &record);
+  // handles of a deleted source died with it, only a live one is made
+  // non-resident
+  void release_record(TextureRecord &record, bool source_alive);
+  i32 find_or_create_group(i32 width, i32 height, GLenum format);
+  void grow_group(ArrayGroup &group);
+  void free_empty_groups();
+  void upload_table();
+
+  gl_handle p_table_ssbo = INVALID_GL_HANDLE;
+  u32 p_table_capacity = 0;
+  bool p_table_dirty = false;
+
+  std::vector<Entry> p_entries;
+  std::vector<GPUEntry> p_gpu_entries;
+  std::map<std::array<u64, s_map_count>, i32> p_entry_lookup;
+  std::unordered_map<Texture *, TextureRecord> p_records;
+  std::vector<ArrayGroup> p_groups;
+};
+} // namespace gem
@@ -0,0 +1,37 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "gem/gl/gl_draw_list.h"
+#include "glm.hpp"
+#include <vector>
+
+namespace gem {
+
+class GLShader;
+
+// Occlusion queries for packets the draw list found hidden in a previous
+// frame's depth. dispatch_proxies renders each packet's world bounds against
+// the bound depth buffer, then the packet's draw is wrapped in a conditional
+// render on its query so the GPU skips packets whose bounds are still hidden
+// without the CPU waiting on results.
+class GLOcclusionQueries {
+public:
+  void cleanup();
+
+  // proxies are depth tested only, nothing is written. packets whose bounds
+  // contain the view position can't be tested and are always drawn
+  void dispatch_proxies(GLShader &proxy_shader, DrawRange draws,
+                        glm::vec3 view_position);
+
+  // index is the packet's position in the range given to dispatch_proxies
+  void begin_conditional(u32 index);
+  void end_conditional(u32 index);
+
+  u32 m_query_count = 0;
+
+protected:
+  std::vector<gl_handle> p_queries;
+  // a byte per packet, 0 when it was drawn unconditionally
+  std::vector<u8> p_tested;
+};
+} // namespace gem
@@ -0,0 +1,41 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include <string>
+
+namespace gem {
+
+// On disk cache of linked program binaries. Entries are keyed on the shader
+// source and the GL vendor / renderer / version strings so a driver change
+// misses the cache, and a binary the driver refuses is deleted and rebuilt.
+class GLProgramCache {
+public:
+  static u64 get_key(const std::string &source);
+
+  // returns a linked program or INVALID_GL_HANDLE on a miss
+  static gl_handle load(u64 key);
+  static void store(u64 key, gl_handle program);
+
+  inline static bool s_enabled = true;
+  inline static std::string s_cache_directory = "cache/shaders";
+
+  inline static u32 s_hits = 0;
+  inline static u32 s_misses = 0;
+
+protected:
+  struct Header {
+    u32 m_magic;
+    u32 m_version;
+    u64 m_key;
+    u32 m_format;
+    u32 m_size;
+  };
+
+  static constexpr u32 s_magic = 0x50524f47; // "PROG"
+  static constexpr u32 s_version = 1;
+
+  static bool is_supported();
+  static std::string get_path(u64 key);
+  static const std::string &get_driver_id();
+};
+} // namespace gem
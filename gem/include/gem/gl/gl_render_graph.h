@@ -0,0 +1,94 @@
+#pragma once
+#include "gem/alias.h"
+#include "gem/gl/gl_framebuffer.h"
+#include "glm.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace gem {
+
+using RGTarget = u32;
+
+// Frame graph over framebuffers. Passes are declared every frame in execution
+// order with the targets they read and write, compile() culls passes nothing
+// consumes and places transient targets with non overlapping lifetimes on the
+// same pooled framebuffer. Imported targets live outside the graph (history,
+// shadow map, gbuffer) and writing one keeps a pass alive, as does declaring
+// it as having side effects (drawing to the back buffer, compute writes).
+class GLRenderGraph {
+public:
+  struct TargetDesc {
+    glm::ivec2 m_resolution;
+    std::vector<GLFramebuffer::attachment_info> m_colour_attachments;
+    bool m_depth = false;
+
+    bool operator==(const TargetDesc &o) const;
+  };
+
+  using ExecuteCallback = std::function<void()>;
+
+  // drops the previous frame's declarations, pooled framebuffers are kept
+  void begin_frame();
+
+  RGTarget import_target(const std::string &name, GLFramebuffer &framebuffer);
+  RGTarget create_target(const std::string &name, const TargetDesc &desc);
+
+  void add_pass(const std::string &name, std::vector<RGTarget> reads,
+                std::vector<RGTarget> writes, ExecuteCallback execute,
+                bool side_effects = false);
+
+  void compile();
+  void execute();
+
+  // only valid for targets used by a live pass, while executing
+  GLFramebuffer &get(RGTarget target);
+
+  void release();
+
+  u32 m_live_pass_count = 0;
+  u32 m_culled_pass_count = 0;
+  u32 m_pooled_target_count = 0;
+  // bytes of pooled framebuffers vs bytes the transient targets would need
+  // without aliasing
+  u64 m_pooled_bytes = 0;
+  u64 m_requested_bytes = 0;
+
+protected:
+  struct Target {
+    std::string m_name;
+    TargetDesc m_desc;
+    GLFramebuffer *m_imported = nullptr;
+    i32 m_physical = -1;
+    i32 m_first_use = -1;
+    i32 m_last_use = -1;
+    // transient and read before any live pass wrote it, cleared on first use
+    bool m_clear = false;
+  };
+
+  struct Pass {
+    std::string m_name;
+    std::vector<RGTarget> m_reads;
+    std::vector<RGTarget> m_writes;
+    ExecuteCallback m_execute;
+    bool m_side_effects;
+    bool m_live = false;
+  };
+
+  struct PhysicalTarget {
+    TargetDesc m_desc;
+    GLFramebuffer m_framebuffer;
+    i32 m_busy_until = -1;
+    bool m_used = false;
+  };
+
+  static u64 get_size_bytes(const TargetDesc &desc);
+  static void release_physical(PhysicalTarget &physical);
+
+  std::vector<Target> p_targets;
+  std::vector<Pass> p_passes;
+  // indices into p_passes of live passes, in execution order
+  std::vector<u32> p_order;
+  std::vector<PhysicalTarget> p_pool;
+};
+} // namespace gem
@@ -1,8 +1,17 @@
 #pragma once
 #include "gem/asset_definitions.h"
 #include "gem/camera.h"
+#include "gem/dynamic_resolution.h"
+#include "gem/gl/gl_draw_list.h"
+#include "gem/gl/gl_entity_picker.h"
 #include "gem/gl/gl_framebuffer.h"
 #include "gem/gl/gl_im3d.h"
+#include "gem/gl/gl_indirect_draws.h"
+#include "gem/gl/gl_material_table.h"
+#include "gem/gl/gl_occlusion_queries.h"
+#include "gem/gl/gl_render_graph.h"
+#include "gem/gl/tech/gbuffer.h"
+#include "gem/gl/tech/hiz.h"
 #include "gem/scene.h"
 #include "gem/voxelisation.h"
 #include <memory>
@@ -20,7 +29,11 @@ public:
   void render(AssetManager &am, Camera &cam, std::vector<Scene *> &scenes);
   void cleanup(AssetManager &am);
 
-  entt::entity get_mouse_entity(glm::vec2 mouse_position);
+  // reads the entity under the mouse from the gbuffer without waiting on
+  // the GPU. the result lands in m_last_selected_entity and on_picked a
+  // frame or two later, entt::null when nothing was drawn there
+  void pick_entity(glm::vec2 mouse_position,
+                   GLEntityPicker::Callback on_picked = {});
 
   GLShaderAsset *m_gbuffer_shader;
   GLShaderAsset *m_gbuffer_textureless_shader;
@@ -41,23 +54,31 @@ public:
   GLShaderAsset *m_compute_voxel_reprojection_shader;
   GLShaderAsset *m_compute_voxel_blit_shader;
   GLShaderAsset *m_compute_voxel_clear_shader;
+  GLShaderAsset *m_compute_gpu_cull_shader;
+  GLShaderAsset *m_compute_hiz_build_shader;
+  GLShaderAsset *m_hiz_proxy_shader;
 
   GLFramebuffer m_gbuffer;
-  GLFramebuffer m_gbuffer_downsample;
   GLFramebuffer m_dir_light_shadow_buffer;
   GLFramebuffer m_lightpass_buffer;
-  GLFramebuffer m_lightpass_buffer_resolve;
-  GLFramebuffer m_lightpass_buffer_history;
-  GLFramebuffer m_position_buffer_history;
-  GLFramebuffer m_conetracing_buffer;
-  GLFramebuffer m_conetracing_buffer_denoise;
-  GLFramebuffer m_conetracing_buffer_resolve;
-  GLFramebuffer m_conetracing_buffer_history;
-  GLFramebuffer m_ssr_buffer;
-  GLFramebuffer m_ssr_buffer_denoise;
-  GLFramebuffer m_ssr_buffer_resolve;
-  GLFramebuffer m_ssr_buffer_history;
-  GLFramebuffer m_final_pass;
+  GLHistoryFramebuffer m_lightpass_buffer_history;
+  GLHistoryFramebuffer m_position_buffer_history;
+  GLHistoryFramebuffer m_conetracing_buffer_history;
+  GLHistoryFramebuffer m_ssr_buffer_history;
+
+  GLMaterialTable m_material_table;
+  GLDrawList m_draw_list;
+  GLIndirectDraws m_indirect_draws;
+  GLOcclusionQueries m_occlusion_queries;
+  GLEntityPicker m_entity_picker;
+
+  // built from the gbuffer depth, the last build of a frame is the next
+  // frame's occluders
+  open_gl::tech::HiZ::Pyramid m_hiz_pyramid;
+  // latest copy of a pyramid level, occluders for CPU listed draws
+  DepthPyramidLevel m_hiz_readback;
+  // transient targets are created by the graph each frame
+  GLRenderGraph m_render_graph;
 
   Im3dState m_im3d_state;
   Voxel::Grid m_voxel_data;
@@ -65,14 +86,34 @@ public:
 
   glm::vec2     m_window_resolution;
   u32           m_frame_index;
-  entt::entity  m_last_selected_entity;
+  entt::entity  m_last_selected_entity = entt::null;
 
   GLfloat m_vxgi_cone_trace_distance = 45.0f;
   GLfloat m_vxgi_diffuse_specular_mix = 0.0f;
+  // render scales of the cone tracing and ssr passes, set by
+  // m_dynamic_resolution while it's enabled. targets are allocated at the
+  // controller's max scale and rendered with a viewport
   GLfloat m_vxgi_resolution_scale = 0.75f;
+  bool    m_vxgi_low_quality = false;
+
+  bool m_lighting_shadows = true;
+  int  m_lighting_shadow_pcf_radius = 1;
 
   GLfloat m_ssr_resolution_scale = 1.0f;
 
+  // fed from GLGpuProfiler, scales hold while it's disabled
+  DynamicResolution m_dynamic_resolution;
+
+  // full is kept as a debug option, the gbuffer is rebuilt on change
+  open_gl::tech::GBuffer::Layout m_gbuffer_layout =
+      open_gl::tech::GBuffer::Layout::compact;
+  // textured gbuffer draws are culled and submitted on the GPU, cleared at
+  // init when the extensions are missing
+  bool m_gpu_driven_gbuffer = true;
+  // gbuffer draws hidden by the previous frame's depth are held back and
+  // drawn only if this frame's depth reveals them
+  bool m_occlusion_culling = true;
+
   GLfloat m_denoise_sigma = 0.01f;
   GLfloat m_denoise_threshold = 0.1f;
   GLfloat m_denoise_k_sigma = 0.01f;
@@ -98,6 +139,20 @@ public:
   void on_imgui(AssetManager &am);
 
 protected:
+  void create_gbuffer();
+  // feeds each newly resolved GLGpuProfiler frame to the controller and
+  // applies its scales
+  void update_dynamic_resolution();
+
   bool p_clear_voxel_grid = false;
+  // layout m_gbuffer was created with
+  open_gl::tech::GBuffer::Layout p_gbuffer_layout;
+
+  u32 p_vxgi_scale_pass = 0;
+  u32 p_ssr_scale_pass = 0;
+  // GLGpuProfiler::s_resolved_frames the controller last saw
+  u64 p_resolution_frame = 0;
+  // scale the cone tracing history was rendered at
+  float p_conetracing_history_scale = 1.0f;
 };
 } // namespace gem
\ No newline at end of file
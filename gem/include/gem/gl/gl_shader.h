@@ -1,9 +1,12 @@
 #pragma once
 #include "GL/glew.h"
 #include "gem/alias.h"
+#include "gem/hash_string.h"
 #include "glm.hpp"
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace gem {
 
@@ -26,7 +29,12 @@ public:
 
   enum class stage { UNKNOWN, vertex, fragment, geometry, compute };
 
-  unsigned int m_shader_id;
+  struct Define {
+    std::string m_name;
+    std::string m_value = "1";
+  };
+
+  unsigned int m_shader_id = 0;
 
   GLShader() = default;
   GLShader(const std::string &comp);
@@ -37,18 +45,45 @@ public:
   void use();
   void release();
 
-  void set_bool(const std::string &name, bool value) const;
-  void set_int(const std::string &name, int value) const;
-  void set_uint(const std::string &name, unsigned int value) const;
-  void set_float(const std::string &name, float value) const;
-  void set_vec2(const std::string &name, glm::vec2 value) const;
-  void set_vec3(const std::string &name, glm::vec3 value) const;
-  void set_vec4(const std::string &name, glm::vec4 value) const;
-  void set_ivec2(const std::string &name, glm::ivec2 value) const;
-  void set_ivec3(const std::string &name, glm::ivec3 value) const;
-  void set_ivec4(const std::string &name, glm::ivec4 value) const;
-  void set_mat3(const std::string &name, glm::mat3 value) const;
-  void set_mat4(const std::string &name, glm::mat4 value) const;
+  // names are looked up in the reflected uniform table, string literals hash
+  // at compile time, std::string names are hashed per call
+  void set_bool(HashString name, bool value) const;
+  void set_int(HashString name, int value) const;
+  void set_uint(HashString name, unsigned int value) const;
+  void set_float(HashString name, float value) const;
+  void set_vec2(HashString name, glm::vec2 value) const;
+  void set_vec3(HashString name, glm::vec3 value) const;
+  void set_vec4(HashString name, glm::vec4 value) const;
+  void set_ivec2(HashString name, glm::ivec2 value) const;
+  void set_ivec3(HashString name, glm::ivec3 value) const;
+  void set_ivec4(HashString name, glm::ivec4 value) const;
+  void set_mat3(HashString name, glm::mat3 value) const;
+  void set_mat4(HashString name, glm::mat4 value) const;
+
+  struct UniformInfo {
+    i32 m_location;
+    uniform_type m_type;
+  };
+
+  // -1 when the uniform is not active, which glUniform* ignores
+  i32 get_uniform_location(HashString name) const;
+
+  // builds m_uniforms from the linked program, called after every link or
+  // binary load
+  void reflect_uniforms();
+
+  std::unordered_map<u64, UniformInfo> m_uniforms;
+
+  // returns the permutation of this shader compiled with the given defines,
+  // compiled on first use and cached per define set. defines should name a
+  // #pragma variant or #pragma constant declared in the source
+  GLShader &get_variant(const std::vector<Define> &defines);
+
+  // preprocessed composite source, variants are compiled from this
+  std::string m_source;
+  std::vector<std::string> m_variant_keys;
+  std::vector<std::string> m_constant_keys;
+  std::unordered_map<u64, std::shared_ptr<GLShader>> m_variants;
 
   static gl_handle compile_shader(const std::string &source,
                                   GLenum shader_stage);
@@ -56,10 +91,57 @@ public:
   static int link_shader(gl_handle vert, gl_handle frag);
   static int link_shader(gl_handle vert, gl_handle geom, gl_handle frag);
 
+  // prelude is inserted after the #version line of every stage
   static std::unordered_map<GLShader::stage, std::string>
-  split_composite_shader(const std::string &input);
+  split_composite_shader(const std::string &input,
+                         const std::string &prelude = "");
+
+  // checks GLProgramCache first, compiles and stores the binary on a miss.
+  // blocks until the link has finished
+  static GLShader create_from_composite(const std::string &composite_shader,
+                                        const std::string &prelude = "");
+
+  // a composite program whose compiles and link have been issued but not
+  // waited on
+  struct PendingLink {
+    std::string m_source;
+    std::string m_prelude;
+    gl_handle m_program = INVALID_GL_HANDLE;
+    std::vector<gl_handle> m_stages;
+    u64 m_cache_key = 0;
+    bool m_from_cache = false;
+    bool m_spirv = false;
+  };
+
+  // issues every stage compile and the link without querying any status so
+  // the driver is free to compile on its own threads. stages found in
+  // s_spirv_directory are loaded as SPIR-V instead of compiled from GLSL
+  static PendingLink begin_composite(const std::string &composite_shader,
+                                     const std::string &prelude = "",
+                                     bool allow_spirv = true);
+  // polls GL_COMPLETION_STATUS, always true without parallel compile support
+  // in which case finish_composite blocks on the driver instead
+  static bool is_link_complete(const PendingLink &pending);
+  static GLShader finish_composite(PendingLink &pending);
+
+  // call once after glewInit, enables KHR / ARB_parallel_shader_compile
+  static void init_parallel_compile();
+  inline static bool s_parallel_compile = false;
+
+  // call once after glewInit, enables loading stages precompiled by
+  // tools/shader_compiler through ARB_gl_spirv
+  static void init_spirv();
+  inline static bool s_spirv = false;
+  inline static std::string s_spirv_directory = "assets/spirv";
+
+  // resolves #include "file" relative to the including file, then
+  // s_include_directory. each file is included once per stage. expands
+  // #pragma constant NAME value into an overridable #define, #pragma variant
+  // lines are left for the driver to ignore
+  static std::string preprocess(const std::string &source,
+                                const std::string &path);
 
-  static GLShader create_from_composite(const std::string &composite_shader);
+  inline static std::string s_include_directory = "assets/shaders";
 
   static uniform_type get_type_from_gl(GLenum type);
 };
@@ -0,0 +1,104 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "glm.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace gem {
+
+// Shadow copy of the bind points the renderer touches every frame. Calls
+// that match the cached value are skipped, the rest are counted against the
+// current pass. Code binding behind the cache's back (Im3d, ImGui, texture
+// creation) has to invalidate what it touched.
+class GLState {
+public:
+  static constexpr u32 s_texture_units = 32;
+  static constexpr u32 s_image_units = 8;
+
+  struct Counters {
+    u32 m_program = 0;
+    u32 m_vao = 0;
+    u32 m_framebuffer = 0;
+    u32 m_texture = 0;
+    u32 m_image = 0;
+    u32 m_viewport = 0;
+    u32 m_enable = 0;
+    u32 m_skipped = 0;
+
+    u32 get_total() const {
+      return m_program + m_vao + m_framebuffer + m_texture + m_image +
+             m_viewport + m_enable;
+    }
+  };
+
+  struct PassCounters {
+    std::string m_name;
+    Counters m_counters;
+  };
+
+  static void use_program(gl_handle program);
+  static void bind_vertex_array(gl_handle vao);
+  static void bind_framebuffer(gl_handle framebuffer);
+  // binds with glBindTextureUnit, the unit's previous target is replaced
+  static void bind_texture(u32 unit, gl_handle texture);
+  static void bind_image(u32 unit, gl_handle texture, u32 level, bool layered,
+                         u32 layer, GLenum access, GLenum format);
+  static void set_viewport(glm::ivec4 viewport);
+  static void set_enabled(GLenum capability, bool enabled);
+
+  // forget everything, the next call of each kind always reaches GL
+  static void invalidate();
+  static void invalidate_texture_unit(u32 unit);
+
+  // counts after this are attributed to the named pass
+  static void begin_pass(const char *name);
+  // publishes this frame's counts and starts a new frame
+  static void end_frame();
+
+  inline static bool s_enabled = true;
+  // what binding framebuffer 0 binds, an offscreen target when there's no
+  // window to present to
+  inline static gl_handle s_default_framebuffer = 0;
+  // counts of the last completed frame, one entry per pass
+  inline static std::vector<PassCounters> s_last_frame_passes;
+  // defined in gl_state.cpp, Counters' initialisers aren't usable before the
+  // end of GLState
+  static Counters s_last_frame_totals;
+
+protected:
+  struct ImageBinding {
+    gl_handle m_texture;
+    u32 m_level;
+    bool m_layered;
+    u32 m_layer;
+    GLenum m_access;
+    GLenum m_format;
+
+    bool operator==(const ImageBinding &o) const {
+      return m_texture == o.m_texture && m_level == o.m_level &&
+             m_layered == o.m_layered && m_layer == o.m_layer &&
+             m_access == o.m_access && m_format == o.m_format;
+    }
+  };
+
+  struct Capability {
+    GLenum m_capability;
+    // -1 unknown
+    i32 m_enabled;
+  };
+
+  static Counters &get_counters();
+
+  inline static gl_handle s_program = INVALID_GL_HANDLE;
+  inline static gl_handle s_vao = INVALID_GL_HANDLE;
+  inline static gl_handle s_framebuffer = INVALID_GL_HANDLE;
+  inline static std::array<gl_handle, s_texture_units> s_textures{};
+  inline static std::array<ImageBinding, s_image_units> s_images{};
+  inline static glm::ivec4 s_viewport{-1};
+  inline static std::vector<Capability> s_capabilities;
+
+  inline static std::vector<PassCounters> s_passes;
+};
+} // namespace gem
@@ -0,0 +1,79 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace gem {
+
+class Texture;
+struct TextureMipChain;
+
+// Streams the high resolution mips of stb textures in and out of VRAM.
+// Only the mip tail is uploaded when a texture is submitted, the gbuffer pass
+// then writes the finest uv footprint each draw needs into a sparse feedback
+// buffer which is read back a few frames later to decide which levels to
+// upload (or evict) within the VRAM budget. Textures keep full chain storage,
+// the budget counts resident levels and evicted ones are invalidated so the
+// driver may reclaim them.
+class GLTextureStreamer {
+public:
+  static void init();
+  static void cleanup();
+
+  // read back feedback, then upload / evict levels, call once per frame
+  static void update();
+
+  // feedback recording around the gbuffer draws
+  static void begin_feedback();
+  static i32 add_feedback_draw(Texture *const *textures, u32 texture_count);
+  static void end_feedback();
+
+  static void register_texture(Texture *texture);
+  static void unregister_texture(Texture *texture);
+
+  static i32 get_tail_level(const TextureMipChain &chain);
+
+  inline static bool s_enabled = true;
+  inline static i32 s_vram_budget_mb = 512;
+  inline static i32 s_upload_kb_per_frame = 8192;
+  // mips at or below this size are always resident
+  inline static i32 s_tail_dimension = 128;
+  // frames without feedback before a texture may drop back to its tail
+  inline static u32 s_unused_frames = 300;
+
+  inline static u64 s_resident_bytes = 0;
+  inline static u32 s_uploads_last_frame = 0;
+  inline static u32 s_evictions_last_frame = 0;
+
+  inline static constexpr u32 s_feedback_binding = 7;
+  inline static constexpr u32 s_max_feedback_slots = 4096;
+  inline static constexpr u32 s_invalid_feedback = UINT32_MAX;
+
+protected:
+  // value initialised in s_feedback_frames, m_ssbo is 0 until init. cleared
+  // rather than freed between frames so recording doesn't allocate
+  struct FeedbackFrame {
+    gl_handle m_ssbo;
+    GLsync m_fence;
+    // streamed textures of every slot back to back, slot i starts at
+    // m_slot_offsets[i] and ends where the next slot starts
+    std::vector<Texture *> m_slot_textures;
+    std::vector<u32> m_slot_offsets;
+  };
+
+  static void read_feedback(FeedbackFrame &frame);
+  static bool evict_one(bool needed_only);
+
+  inline static std::array<FeedbackFrame, 3> s_feedback_frames{};
+  inline static u32 s_feedback_write_index = 0;
+  inline static bool s_feedback_active = false;
+  inline static std::unordered_set<Texture *> s_textures;
+  // read_feedback scratch
+  inline static std::vector<u32> s_feedback;
+  inline static std::unordered_map<Texture *, i32> s_requested;
+  inline static u64 s_frame = 0;
+};
+} // namespace gem
@@ -1,28 +1,67 @@
 #pragma once
+#include "gem/gl/gl_draw_list.h"
 #include "gem/gl/gl_framebuffer.h"
+#include "gem/gl/gl_indirect_draws.h"
 #include "gem/gl/gl_shader.h"
+#include "gem/gl/tech/hiz.h"
 
 namespace gem {
 
-class Camera;
-class Scene;
 class AssetManager;
+class GLMaterialTable;
+class GLOcclusionQueries;
 namespace open_gl {
 namespace tech {
 class GBuffer {
 public:
-  static void dispatch_gbuffer_with_id(u32 frame_index, GLFramebuffer &gbuffer,
+  // full keeps a RGBA32F world position target and 16 bit floats throughout.
+  // compact rebuilds position from depth, stores octahedral normals in RG16,
+  // metallic / roughness / AO in RGBA8, sRGB diffuse and RG16F velocity.
+  // both store the entity as R32UI.
+  enum class Layout { full, compact };
+  enum class Channel { diffuse, position, normal, pbr, velocity, entity_id };
+
+  static GLFramebuffer create_gbuffer(glm::vec2 resolution, Layout layout);
+  // deletes the attachment textures as well as the framebuffer
+  static void release_gbuffer(GLFramebuffer &gbuffer);
+  // binds the gbuffer and clears it, entity ids to entt::null
+  static void clear_gbuffer(GLFramebuffer &gbuffer, Layout layout);
+  // -1 for the compact position channel, which has no attachment
+  static i32 get_attachment_index(Layout layout, Channel channel);
+  // the compact position channel is the depth texture for shaders to
+  // rebuild from
+  static gl_handle get_texture(GLFramebuffer &gbuffer, Layout layout,
+                               Channel channel);
+  // every shader writing or sampling the gbuffer is built with these
+  static std::vector<GLShader::Define> get_defines(Layout layout);
+
+  // per frame and per draw constants are read from GLConstantRing, draws
+  // are the sorted packets of the matching DrawPass. call between
+  // GLTextureStreamer::begin_feedback / end_feedback. with queries each
+  // packet is drawn conditionally on its proxy, see GLOcclusionQueries
+  static void dispatch_gbuffer_with_id(GLFramebuffer &gbuffer,
                                        GLFramebuffer &previous_position_buffer,
                                        GLShader &gbuffer_shader,
-                                       AssetManager &am, Camera &cam,
-                                       std::vector<Scene *> &scenes,
-                                       glm::ivec2 win_res);
+                                       GLMaterialTable &material_table,
+                                       DrawRange draws,
+                                       GLOcclusionQueries *queries = nullptr);
+
+  // GPU driven version of dispatch_gbuffer_with_id, gbuffer_shader is the
+  // GPU_DRIVEN variant. draws are culled by cull_shader against planes and
+  // occluders. the first phase uploads draws, the second draws what the
+  // first phase's depth revealed and ignores draws
+  static void dispatch_gbuffer_indirect(
+      GLFramebuffer &gbuffer, GLFramebuffer &previous_position_buffer,
+      GLShader &gbuffer_shader, GLShader &cull_shader,
+      GLMaterialTable &material_table, GLIndirectDraws &indirect_draws,
+      DrawRange draws, const std::array<glm::vec4, 6> &planes,
+      GLIndirectDraws::CullPhase phase = GLIndirectDraws::CullPhase::first,
+      const HiZ::Pyramid *occluders = nullptr);
 
   static void dispatch_gbuffer_textureless_with_id(
-      u32 frame_index, GLFramebuffer &gbuffer,
-      GLFramebuffer &previous_position_buffer,
-      GLShader &gbuffer_textureless_shader, AssetManager &am, Camera &cam,
-      std::vector<Scene *> &scenes, glm::ivec2 win_res);
+      GLFramebuffer &gbuffer, GLFramebuffer &previous_position_buffer,
+      GLShader &gbuffer_textureless_shader, AssetManager &am,
+      DrawRange draws, GLOcclusionQueries *queries = nullptr);
 };
 } // namespace tech
 } // namespace open_gl
@@ -0,0 +1,52 @@
+#pragma once
+#include "gem/culling.h"
+#include "gem/gl/gl_shader.h"
+
+namespace gem {
+namespace open_gl {
+namespace tech {
+// Max depth pyramid for occlusion culling. Level 0 is half the depth
+// resolution (rounded up, so every depth texel is covered), each level halves
+// the previous one. hiz_build.shader writes every level in one dispatch: a
+// workgroup reduces a 64x64 depth tile to its first 6 levels and the last
+// workgroup to finish reduces the rest.
+class HiZ {
+public:
+  // one image unit per level
+  static constexpr u32 s_max_levels = 8;
+  static constexpr u32 s_counter_binding = 12;
+  // level copied back for culling CPU listed draws
+  static constexpr i32 s_readback_max_width = 160;
+
+  struct Pyramid {
+    gl_handle m_texture = INVALID_GL_HANDLE;
+    glm::ivec2 m_depth_resolution{0};
+    glm::ivec2 m_size{0};
+    u32 m_levels = 0;
+    // camera of the depth the pyramid was last built from
+    glm::mat4 m_view_proj{1.0f};
+    bool m_valid = false;
+    // workgroups done, reset by the last one
+    gl_handle m_counter = INVALID_GL_HANDLE;
+
+    u32 m_readback_level = 0;
+    gl_handle m_readback_buffer = INVALID_GL_HANDLE;
+    GLsync m_readback_fence = nullptr;
+    glm::mat4 m_readback_view_proj{1.0f};
+  };
+
+  static Pyramid create_pyramid(glm::ivec2 depth_resolution);
+  static void release_pyramid(Pyramid &pyramid);
+
+  static void dispatch_build(GLShader &build_shader, Pyramid &pyramid,
+                             gl_handle depth_texture,
+                             const glm::mat4 &view_proj);
+
+  // queues a copy of the readback level if none is in flight
+  static void request_readback(Pyramid &pyramid);
+  // true when a copy has landed in level since the last call
+  static bool poll_readback(Pyramid &pyramid, DepthPyramidLevel &level);
+};
+} // namespace tech
+} // namespace open_gl
+} // namespace gem
@@ -1,11 +1,11 @@
 #pragma once
 #include "gem/gl/gl_shader.h"
+#include "gem/gl/tech/gbuffer.h"
 #include "gem/lights.h"
 #include <vector>
 
 namespace gem {
 class GLFramebuffer;
-class Camera;
 
 namespace open_gl {
 namespace tech {
@@ -15,7 +15,8 @@ public:
   dispatch_light_pass(GLShader &lighting_shader,
                                   GLFramebuffer &lighting_buffer,
                                   GLFramebuffer &gbuffer,
-                                  GLFramebuffer &dir_light_shadow_buffer, Camera &cam,
+                                  GBuffer::Layout gbuffer_layout,
+                                  GLFramebuffer &dir_light_shadow_buffer,
                       std::vector<PointLight> &point_lights,
                                   DirectionalLight &sun);
 };
@@ -1,19 +1,22 @@
 #pragma once
+#include "gem/gl/gl_draw_list.h"
 #include "gem/gl/gl_shader.h"
 #include "gem/lights.h"
 
 namespace gem {
 
 class GLFramebuffer;
-class Scene;
 namespace open_gl {
 namespace tech {
 class Shadow {
 public:
+  // shadow map projection for the sun, fixed ortho volume around the origin
+  static glm::mat4 get_light_space_matrix(const DirectionalLight &sun);
+
   static void dispatch_shadow_pass(GLFramebuffer &shadow_fb,
                                    GLShader &shadow_shader,
                                    DirectionalLight &sun,
-                                   std::vector<Scene *> &scenes,
+                                   DrawRange draws,
                                    glm::ivec2 window_res);
 };
 } // namespace tech
@@ -1,5 +1,6 @@
 #pragma once
 #include "gem/gl/gl_shader.h"
+#include "gem/gl/tech/gbuffer.h"
 namespace gem {
 
 class Camera;
@@ -11,6 +12,7 @@ public:
   static void dispatch_ssr_pass(GLShader &ssr, Camera &cam,
                                 GLFramebuffer &ssr_buffer,
                                 GLFramebuffer &gbuffer,
+                                GBuffer::Layout gbuffer_layout,
                                 GLFramebuffer &lighting_buffer,
                                 glm::vec2 screen_dim);
 };
@@ -8,11 +8,15 @@ namespace open_gl {
 namespace tech {
 class TemporalAntiAliasing {
 public:
+  // the scales are the fraction of the pass / history buffer that was
+  // rendered to (from the origin), for passes at a dynamic resolution. the
+  // resolve is always full size
   static void dispatch_taa_pass(GLShader &taa, GLFramebuffer &pass_buffer,
                                 GLFramebuffer pass_resolve_buffer,
                                 GLFramebuffer &pass_history_buffer,
                                 gl_handle &velocity_buffer_attachment,
-                                glm::ivec2 window_res);
+                                float pass_scale = 1.0f,
+                                float history_scale = 1.0f);
 };
 } // namespace tech
 } // namespace open_gl
@@ -1,5 +1,6 @@
 #pragma once
 #include "gem/alias.h"
+#include "gem/hash_string.h"
 #include "glm.hpp"
 #include <string>
 
@@ -18,10 +19,10 @@ public:
                                      float aThreshold, float aKSigma,
                                      glm::ivec2 window_res);
   static void dispatch_present_image(GLShader &present_shader,
-                                     const std::string &uniform_name,
+                                     HashString uniform_name,
                                      const int texture_slot, gl_handle texture);
   static void blit_to_fb(GLFramebuffer &fb, GLShader &present_shader,
-                         const std::string &uniform_name,
+                         HashString uniform_name,
                          const int texture_slot, gl_handle texture);
 };
 } // namespace tech
@@ -1,15 +1,18 @@
 #pragma once
 #include "gem/gl/gl_framebuffer.h"
+#include "gem/gl/tech/gbuffer.h"
 #include "gem/shape.h"
 #include "gem/voxelisation.h"
 
 namespace gem {
 
-class Camera;
 namespace open_gl {
 namespace tech {
 class VXGI {
 public:
+  // grid bounds / resolution shared by the voxel passes, once per frame
+  static void push_voxel_constants(Voxel::Grid &voxel_data);
+
   static void dispatch_voxelisation_gbuffer_pass(GLShader &gbuffer_shader,
                                                  Voxel::Grid &grid_data,
                                                  GLFramebuffer gbuffer,
@@ -19,6 +22,7 @@ public:
   static void dispatch_gbuffer_voxelization(GLShader &voxelization,
                                             Voxel::Grid &voxel_data,
                                             GLFramebuffer &gbuffer,
+                                            GBuffer::Layout gbuffer_layout,
                                             GLFramebuffer &lightpass_buffer,
                                             glm::ivec2 window_res);
 
@@ -37,8 +41,7 @@ public:
   static void dispatch_cone_tracing_pass(
       GLShader &voxel_cone_tracing, Voxel::Grid &voxel_data,
       GLFramebuffer &buffer_conetracing, GLFramebuffer &gbuffer,
-      glm::ivec2 window_res, AABB &bounding_volume, glm::vec3 _3d_tex_res,
-      Camera &cam, float max_trace_distance, float resolution_scale,
+      GBuffer::Layout gbuffer_layout, glm::ivec2 window_res, float max_trace_distance, float resolution_scale,
       float diffuse_spec_mix);
 };
 } // namespace tech
@@ -5,7 +5,10 @@
 #include "json.hpp"
 #include "spdlog/spdlog.h"
 
+// a map lookup and write per runtime string hash, debug builds only
+#ifdef __DEBUG__
 #define TRACK_HASH_STRING_ORIGINALS
+#endif
 // #define CHECK_FOR_HASH_STRING_COLLISIONS
 
 #ifdef TRACK_HASH_STRING_ORIGINALS
@@ -26,9 +29,15 @@ public:
     return ctti::type_id<T>().hash();
   }
 
+  // same FNV-1a 64 as ctti::id_from_name, so runtime hashes match compile
+  // time ones, but iterative: ctti recurses once per character, which
+  // overflows the stack on long strings such as shader sources
   static u64 get_string_hash(const std::string &str) {
-
-    return ctti::id_from_name(str).hash();
+    u64 hash = ctti::detail::fnv_basis;
+    for (const char c : str) {
+      hash = (hash ^ static_cast<u64>(c)) * ctti::detail::fnv_prime;
+    }
+    return hash;
   }
 };
 
@@ -55,9 +64,15 @@ struct HashString {
 #endif
   }
 
-  HashString(u64 value) : m_value(value) {}
+  // literals are hashed at compile time, their originals are not tracked
+  template <std::size_t N>
+  constexpr HashString(const char (&input)[N])
+      : m_value(ctti::id_from_name(input).hash()) {}
+
+  constexpr HashString(u64 value) : m_value(value) {}
 
-  template <typename T> HashString() : m_value(get_type_hash<T>()) {}
+  template <typename T>
+  HashString() : m_value(HashUtils::get_type_hash<T>()) {}
 
   u64 m_value;
 
@@ -77,6 +92,6 @@ using hash_string_ge = HashString;
 
 template <> struct std::hash<gem::HashString> {
   std::size_t operator()(const gem::HashString &h) const {
-    return std::hash<u64>()(h.m_value) ^ std::hash<u64>()(h.m_value);
+    return std::hash<u64>()(h.m_value);
   }
 };
\ No newline at end of file
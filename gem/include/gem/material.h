@@ -4,30 +4,123 @@
 #include "gem/gl/gl_shader.h"
 #include "gem/model.h"
 #include "gem/texture.h"
-#include <any>
-#include <map>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 #define ENABLE_MATERIAL_UNIFORM_CHECKS
 namespace gem {
 
 class Scene;
 class AssetManager;
 
+class MaterialInstance;
+
+// Reflection shared by every material using a shader, built once per
+// program and cached on the shader handle.
+class MaterialTemplate {
+public:
+  // non sampler parameters declared inside this block are packed into one
+  // buffer and uploaded with a single copy per bind
+  static constexpr u32 s_constants_binding = 4;
+
+  struct Parameter {
+    u64 m_name;
+    GLShader::uniform_type m_type;
+    // -1 for members of the MaterialConstants block
+    i32 m_location;
+    // byte offset into MaterialInstance::m_parameter_data
+    u32 m_offset;
+  };
+
+  struct Sampler {
+    std::string m_name;
+    GLShader::uniform_type m_type;
+    // -1 when the program doesn't declare it, the entry is still visible to
+    // GLMaterialTable
+    i32 m_location;
+  };
+
+  MaterialTemplate(AssetHandle shader_handle, GLShader &program);
+
+  // reflects on first use, or again once the program has been relinked
+  static std::shared_ptr<MaterialTemplate> get(AssetHandle shader_handle,
+                                               GLShader &program);
+  static void clear();
+
+  i32 find_parameter(HashString name) const;
+  i32 find_sampler(const std::string &name) const;
+  // adds a slot for samplers only read through the material table
+  i32 add_sampler(const std::string &name);
+
+  // returns an existing instance with identical contents if there is one
+  std::shared_ptr<MaterialInstance>
+  intern(std::shared_ptr<MaterialInstance> instance);
+
+  std::shared_ptr<MaterialInstance> get_default_instance();
+
+  GLShader &m_prog;
+  const AssetHandle m_shader_handle;
+  // program the layout was reflected from
+  const gl_handle m_program_id;
+
+  std::vector<Parameter> m_parameters;
+  std::vector<Sampler> m_samplers;
+  u32 m_constants_size = 0;
+  u32 m_data_size = 0;
+
+  inline static std::unordered_map<u64, std::shared_ptr<MaterialTemplate>>
+      s_templates;
+  inline static u32 s_reflection_count = 0;
+
+protected:
+  std::unordered_multimap<u64, std::weak_ptr<MaterialInstance>> p_instances;
+  std::shared_ptr<MaterialInstance> p_default_instance;
+};
+
+// Parameter values and textures of a material. Instances are immutable once
+// interned so entities with the same contents share one.
+class MaterialInstance {
+public:
+  struct Sampler {
+    // texture unit relative to GL_TEXTURE0
+    u32 m_unit = 0;
+    GLenum m_target = GL_TEXTURE_2D;
+    TextureEntry m_entry;
+  };
+
+  // MaterialConstants image (m_constants_size bytes) followed by the values
+  // of parameters set through glUniform
+  std::vector<u8> m_parameter_data;
+  // bit per template parameter, parameters past 64 are always uploaded
+  u64 m_set_mask = 0;
+  // indexed like MaterialTemplate::m_samplers
+  std::vector<Sampler> m_samplers;
+
+  // cached index into GLMaterialTable, -1 until first drawn
+  i32 m_texture_table_index = -1;
+
+  u64 get_hash() const;
+  bool has_same_contents(const MaterialInstance &other) const;
+};
+
 class Material {
 public:
   Material(AssetHandle shader_handle, GLShader &shader_program);
 
-  std::map<std::string, GLShader::uniform_type> m_uniforms;
-  std::map<std::string, std::any> m_uniform_values;
-
   template <typename _Ty>
-  bool set_uniform_value(const std::string &name, const _Ty &val) {
+  bool set_uniform_value(HashString name, const _Ty &val) {
+    const i32 index = m_template->find_parameter(name);
+    if (index < 0) {
+      return false;
+    }
 #ifdef ENABLE_MATERIAL_UNIFORM_CHECKS
-    if (m_uniforms.find(name) == m_uniforms.end()) {
+    if (m_template->m_parameters[index].m_type != get_uniform_type<_Ty>()) {
       return false;
     }
 #endif
-    m_uniform_values[name] = val;
+    write_parameter(static_cast<u32>(index), &val);
     return true;
   }
 
@@ -35,10 +128,40 @@ public:
                    TextureEntry &tex_entry,
                    GLenum texture_target = GL_TEXTURE_2D);
 
+  const TextureEntry *find_texture(const std::string &sampler_name) const;
+
   void bind_material_uniforms(AssetManager &am);
 
   GLShader &m_prog;
-  const AssetHandle m_shader_handle;
+  std::shared_ptr<MaterialTemplate> m_template;
+  std::shared_ptr<MaterialInstance> m_instance;
+
+protected:
+  void write_parameter(u32 index, const void *value);
+  // copies the instance so it can be modified without touching shared ones
+  MaterialInstance &begin_edit();
+  // moves the instance onto a relinked program's layout, by name
+  void refresh_template();
+
+  template <typename _Ty> static constexpr GLShader::uniform_type get_uniform_type() {
+    if constexpr (std::is_same_v<_Ty, int>) {
+      return GLShader::uniform_type::_int;
+    } else if constexpr (std::is_same_v<_Ty, float>) {
+      return GLShader::uniform_type::_float;
+    } else if constexpr (std::is_same_v<_Ty, glm::vec2>) {
+      return GLShader::uniform_type::vec2;
+    } else if constexpr (std::is_same_v<_Ty, glm::vec3>) {
+      return GLShader::uniform_type::vec3;
+    } else if constexpr (std::is_same_v<_Ty, glm::vec4>) {
+      return GLShader::uniform_type::vec4;
+    } else if constexpr (std::is_same_v<_Ty, glm::mat3>) {
+      return GLShader::uniform_type::mat3;
+    } else if constexpr (std::is_same_v<_Ty, glm::mat4>) {
+      return GLShader::uniform_type::mat4;
+    } else {
+      return GLShader::uniform_type::UNKNOWN;
+    }
+  }
 };
 
 class MaterialSystem : public ECSSystem {
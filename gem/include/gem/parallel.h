@@ -0,0 +1,30 @@
+#pragma once
+#include "gem/alias.h"
+#include <functional>
+
+namespace gem {
+
+// Fork / join over contiguous index ranges for per frame CPU work (draw list
+// recording, culling). Worker threads are started on first use and sleep
+// between calls, the calling thread runs the first range itself. Range
+// callbacks must not touch GL or call back into Parallel.
+class Parallel {
+public:
+  // first index, one past the last index, range index
+  using RangeFn = std::function<void(u32, u32, u32)>;
+
+  // workers plus the calling thread
+  static u32 get_thread_count();
+
+  // splits [0, count) into at most get_thread_count() ranges of at least
+  // min_range indices and blocks until every range has run. range bounds
+  // other than count are multiples of alignment, e.g. so SIMD loads near the
+  // end of a range never touch the next one's elements. returns the number
+  // of ranges, range indices are below it
+  static u32 for_ranges(u32 count, u32 min_range, const RangeFn &fn,
+                        u32 alignment = 1);
+
+  // joins the workers, the next call starts them again
+  static void shutdown();
+};
+} // namespace gem
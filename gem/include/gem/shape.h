@@ -10,6 +10,9 @@ public:
   inline static VAO s_screen_quad;
   inline static VAO s_cube_pos_only;
 
+  // shared buffers backing all of the mesh primitives below
+  inline static VAO s_primitives_vao;
+
   inline static VAO s_cube_vao;
   inline static Mesh s_cube_mesh;
 
@@ -0,0 +1,320 @@
+#pragma once
+#include "gem/alias.h"
+#include <array>
+
+namespace gem {
+
+// Compile time generators for the built in primitive meshes.
+// Every shape is emitted as interleaved position (3), normal (3) and uv (2)
+// floats plus a u32 index list, matching the layout the gbuffer and shadow
+// shaders expect. Tessellation is a template parameter so the vertex / index
+// counts are known at compile time and the data can live in constexpr storage.
+class ShapeGen {
+public:
+  static constexpr u32 s_vertex_stride = 8;
+  static constexpr double s_pi = 3.14159265358979323846;
+
+  template <u32 _VertexCount, u32 _IndexCount> struct IndexedShape {
+    static constexpr u32 vertex_count = _VertexCount;
+    static constexpr u32 index_count = _IndexCount;
+
+    std::array<float, _VertexCount * s_vertex_stride> m_vertices{};
+    std::array<u32, _IndexCount> m_indices{};
+    std::array<float, 3> m_min{};
+    std::array<float, 3> m_max{};
+
+    constexpr void set_vertex(u32 index, double px, double py, double pz,
+                              double nx, double ny, double nz, double u,
+                              double v) {
+      const u32 base = index * s_vertex_stride;
+      m_vertices[base + 0] = static_cast<float>(px);
+      m_vertices[base + 1] = static_cast<float>(py);
+      m_vertices[base + 2] = static_cast<float>(pz);
+      m_vertices[base + 3] = static_cast<float>(nx);
+      m_vertices[base + 4] = static_cast<float>(ny);
+      m_vertices[base + 5] = static_cast<float>(nz);
+      m_vertices[base + 6] = static_cast<float>(u);
+      m_vertices[base + 7] = static_cast<float>(v);
+    }
+
+    constexpr void set_triangle(u32 index, u32 a, u32 b, u32 c) {
+      m_indices[index * 3 + 0] = a;
+      m_indices[index * 3 + 1] = b;
+      m_indices[index * 3 + 2] = c;
+    }
+
+    constexpr void set_bounds(double min_x, double min_y, double min_z,
+                              double max_x, double max_y, double max_z) {
+      m_min = {static_cast<float>(min_x), static_cast<float>(min_y),
+               static_cast<float>(min_z)};
+      m_max = {static_cast<float>(max_x), static_cast<float>(max_y),
+               static_cast<float>(max_z)};
+    }
+  };
+
+  // std::sin / std::cos / std::sqrt are not constexpr until C++26
+  static constexpr double cx_sin(double x) {
+    // reduce to [-pi, pi]
+    const double two_pi = s_pi * 2.0;
+    long long k = static_cast<long long>(x / two_pi);
+    x -= static_cast<double>(k) * two_pi;
+    if (x > s_pi) {
+      x -= two_pi;
+    }
+    if (x < -s_pi) {
+      x += two_pi;
+    }
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 14; i++) {
+      term *= -x * x / static_cast<double>((2 * i) * (2 * i + 1));
+      sum += term;
+    }
+    return sum;
+  }
+
+  static constexpr double cx_cos(double x) { return cx_sin(x + s_pi * 0.5); }
+
+  static constexpr double cx_sqrt(double x) {
+    if (x <= 0.0) {
+      return 0.0;
+    }
+    double guess = x > 1.0 ? x : 1.0;
+    for (int i = 0; i < 64; i++) {
+      guess = 0.5 * (guess + x / guess);
+    }
+    return guess;
+  }
+
+  // Unit cube spanning [-1, 1] with hard edged normals (4 verts per face)
+  struct Cube {
+    static constexpr u32 vertex_count = 24;
+    static constexpr u32 index_count = 36;
+    using shape_type = IndexedShape<vertex_count, index_count>;
+
+    static constexpr shape_type generate() {
+      shape_type shape{};
+      // normal, then the two in-plane axes ordered so (u x v) == normal
+      constexpr double faces[6][9] = {
+          {1, 0, 0, 0, 0, -1, 0, 1, 0},  {-1, 0, 0, 0, 0, 1, 0, 1, 0},
+          {0, 1, 0, 1, 0, 0, 0, 0, -1},  {0, -1, 0, 1, 0, 0, 0, 0, 1},
+          {0, 0, 1, 1, 0, 0, 0, 1, 0},   {0, 0, -1, -1, 0, 0, 0, 1, 0},
+      };
+      constexpr double corners[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+
+      for (u32 f = 0; f < 6; f++) {
+        const double *n = &faces[f][0];
+        const double *u = &faces[f][3];
+        const double *v = &faces[f][6];
+        for (u32 c = 0; c < 4; c++) {
+          const double cu = corners[c][0];
+          const double cv = corners[c][1];
+          shape.set_vertex(f * 4 + c, n[0] + u[0] * cu + v[0] * cv,
+                           n[1] + u[1] * cu + v[1] * cv,
+                           n[2] + u[2] * cu + v[2] * cv, n[0], n[1], n[2],
+                           (cu + 1.0) * 0.5, (cv + 1.0) * 0.5);
+        }
+        shape.set_triangle(f * 2 + 0, f * 4 + 0, f * 4 + 1, f * 4 + 2);
+        shape.set_triangle(f * 2 + 1, f * 4 + 2, f * 4 + 3, f * 4 + 0);
+      }
+      shape.set_bounds(-1, -1, -1, 1, 1, 1);
+      return shape;
+    }
+  };
+
+  // Unit radius UV sphere, poles on the Y axis
+  template <u32 _Segments, u32 _Rings> struct UVSphere {
+    static_assert(_Segments >= 3 && _Rings >= 2,
+                  "UVSphere requires at least 3 segments and 2 rings");
+    static constexpr u32 vertex_count = (_Segments + 1) * (_Rings + 1);
+    static constexpr u32 index_count = _Segments * (_Rings - 1) * 6;
+    using shape_type = IndexedShape<vertex_count, index_count>;
+
+    static constexpr shape_type generate() {
+      shape_type shape{};
+      for (u32 r = 0; r <= _Rings; r++) {
+        const double v = static_cast<double>(r) / _Rings;
+        const double phi = v * s_pi;
+        const double sp = cx_sin(phi);
+        const double cp = cx_cos(phi);
+        for (u32 s = 0; s <= _Segments; s++) {
+          const double u = static_cast<double>(s) / _Segments;
+          const double theta = u * s_pi * 2.0;
+          const double x = sp * cx_cos(theta);
+          const double z = -sp * cx_sin(theta);
+          shape.set_vertex(r * (_Segments + 1) + s, x, cp, z, x, cp, z, u,
+                           1.0 - v);
+        }
+      }
+
+      u32 tri = 0;
+      for (u32 r = 0; r < _Rings; r++) {
+        for (u32 s = 0; s < _Segments; s++) {
+          const u32 a = r * (_Segments + 1) + s;
+          const u32 b = a + _Segments + 1;
+          if (r != 0) {
+            shape.set_triangle(tri++, a, b, a + 1);
+          }
+          if (r != _Rings - 1) {
+            shape.set_triangle(tri++, a + 1, b, b + 1);
+          }
+        }
+      }
+      shape.set_bounds(-1, -1, -1, 1, 1, 1);
+      return shape;
+    }
+  };
+
+  // Unit radius cylinder spanning y = [-1, 1] with capped ends
+  template <u32 _Segments> struct Cylinder {
+    static_assert(_Segments >= 3, "Cylinder requires at least 3 segments");
+    static constexpr u32 side_vertex_count = (_Segments + 1) * 2;
+    static constexpr u32 cap_vertex_count = _Segments + 2;
+    static constexpr u32 vertex_count =
+        side_vertex_count + cap_vertex_count * 2;
+    static constexpr u32 index_count = _Segments * 6 + _Segments * 3 * 2;
+    using shape_type = IndexedShape<vertex_count, index_count>;
+
+    static constexpr shape_type generate() {
+      shape_type shape{};
+      for (u32 s = 0; s <= _Segments; s++) {
+        const double u = static_cast<double>(s) / _Segments;
+        const double theta = u * s_pi * 2.0;
+        const double x = cx_cos(theta);
+        const double z = -cx_sin(theta);
+        shape.set_vertex(s * 2 + 0, x, -1.0, z, x, 0.0, z, u, 0.0);
+        shape.set_vertex(s * 2 + 1, x, 1.0, z, x, 0.0, z, u, 1.0);
+      }
+
+      u32 tri = 0;
+      for (u32 s = 0; s < _Segments; s++) {
+        const u32 a = s * 2;
+        shape.set_triangle(tri++, a, a + 2, a + 1);
+        shape.set_triangle(tri++, a + 1, a + 2, a + 3);
+      }
+
+      for (u32 cap = 0; cap < 2; cap++) {
+        const double y = cap == 0 ? 1.0 : -1.0;
+        const u32 centre = side_vertex_count + cap * cap_vertex_count;
+        shape.set_vertex(centre, 0.0, y, 0.0, 0.0, y, 0.0, 0.5, 0.5);
+        for (u32 s = 0; s <= _Segments; s++) {
+          const double theta = static_cast<double>(s) / _Segments * s_pi * 2.0;
+          const double x = cx_cos(theta);
+          const double z = -cx_sin(theta);
+          shape.set_vertex(centre + 1 + s, x, y, z, 0.0, y, 0.0,
+                           x * 0.5 + 0.5, z * 0.5 + 0.5);
+        }
+        for (u32 s = 0; s < _Segments; s++) {
+          if (cap == 0) {
+            shape.set_triangle(tri++, centre, centre + 1 + s, centre + 2 + s);
+          } else {
+            shape.set_triangle(tri++, centre, centre + 2 + s, centre + 1 + s);
+          }
+        }
+      }
+      shape.set_bounds(-1, -1, -1, 1, 1, 1);
+      return shape;
+    }
+  };
+
+  // Unit radius cone with its base at y = -1 and apex at y = 1
+  template <u32 _Segments> struct Cone {
+    static_assert(_Segments >= 3, "Cone requires at least 3 segments");
+    // one apex vertex per segment so each side face gets a sensible normal
+    static constexpr u32 side_vertex_count = _Segments + (_Segments + 1);
+    static constexpr u32 vertex_count = side_vertex_count + _Segments + 2;
+    static constexpr u32 index_count = _Segments * 3 * 2;
+    using shape_type = IndexedShape<vertex_count, index_count>;
+
+    static constexpr shape_type generate() {
+      shape_type shape{};
+      // slope normal for radius 1, height 2
+      const double inv_len = 1.0 / cx_sqrt(5.0);
+      const double ny = 1.0 * inv_len;
+      const double nr = 2.0 * inv_len;
+
+      for (u32 s = 0; s <= _Segments; s++) {
+        const double u = static_cast<double>(s) / _Segments;
+        const double theta = u * s_pi * 2.0;
+        const double x = cx_cos(theta);
+        const double z = -cx_sin(theta);
+        shape.set_vertex(_Segments + s, x, -1.0, z, x * nr, ny, z * nr, u,
+                         0.0);
+      }
+      for (u32 s = 0; s < _Segments; s++) {
+        const double u = (static_cast<double>(s) + 0.5) / _Segments;
+        const double theta = u * s_pi * 2.0;
+        const double x = cx_cos(theta);
+        const double z = -cx_sin(theta);
+        shape.set_vertex(s, 0.0, 1.0, 0.0, x * nr, ny, z * nr, u, 1.0);
+      }
+
+      u32 tri = 0;
+      for (u32 s = 0; s < _Segments; s++) {
+        shape.set_triangle(tri++, _Segments + s, _Segments + s + 1, s);
+      }
+
+      const u32 centre = side_vertex_count;
+      shape.set_vertex(centre, 0.0, -1.0, 0.0, 0.0, -1.0, 0.0, 0.5, 0.5);
+      for (u32 s = 0; s <= _Segments; s++) {
+        const double theta = static_cast<double>(s) / _Segments * s_pi * 2.0;
+        const double x = cx_cos(theta);
+        const double z = -cx_sin(theta);
+        shape.set_vertex(centre + 1 + s, x, -1.0, z, 0.0, -1.0, 0.0,
+                         x * 0.5 + 0.5, z * 0.5 + 0.5);
+      }
+      for (u32 s = 0; s < _Segments; s++) {
+        shape.set_triangle(tri++, centre, centre + 2 + s, centre + 1 + s);
+      }
+      shape.set_bounds(-1, -1, -1, 1, 1, 1);
+      return shape;
+    }
+  };
+
+  // Torus around the Y axis with a major radius of 1 and minor radius of 0.25
+  template <u32 _MajorSegments, u32 _MinorSegments> struct Torus {
+    static_assert(_MajorSegments >= 3 && _MinorSegments >= 3,
+                  "Torus requires at least 3 segments on each axis");
+    static constexpr double major_radius = 1.0;
+    static constexpr double minor_radius = 0.25;
+    static constexpr u32 vertex_count =
+        (_MajorSegments + 1) * (_MinorSegments + 1);
+    static constexpr u32 index_count = _MajorSegments * _MinorSegments * 6;
+    using shape_type = IndexedShape<vertex_count, index_count>;
+
+    static constexpr shape_type generate() {
+      shape_type shape{};
+      for (u32 i = 0; i <= _MajorSegments; i++) {
+        const double u = static_cast<double>(i) / _MajorSegments;
+        const double theta = u * s_pi * 2.0;
+        const double ct = cx_cos(theta);
+        const double st = -cx_sin(theta);
+        for (u32 j = 0; j <= _MinorSegments; j++) {
+          const double v = static_cast<double>(j) / _MinorSegments;
+          const double phi = v * s_pi * 2.0;
+          const double cp = cx_cos(phi);
+          const double sp = cx_sin(phi);
+          const double ring = major_radius + minor_radius * cp;
+          shape.set_vertex(i * (_MinorSegments + 1) + j, ring * ct,
+                           minor_radius * sp, ring * st, cp * ct, sp, cp * st,
+                           u, v);
+        }
+      }
+
+      u32 tri = 0;
+      for (u32 i = 0; i < _MajorSegments; i++) {
+        for (u32 j = 0; j < _MinorSegments; j++) {
+          const u32 a = i * (_MinorSegments + 1) + j;
+          const u32 b = a + _MinorSegments + 1;
+          shape.set_triangle(tri++, a, b, a + 1);
+          shape.set_triangle(tri++, a + 1, b, b + 1);
+        }
+      }
+      const double extent = major_radius + minor_radius;
+      shape.set_bounds(-extent, -minor_radius, -extent, extent, minor_radius,
+                       extent);
+      return shape;
+    }
+  };
+};
+} // namespace gem
@@ -18,19 +18,22 @@ enum class TextureMapType {
 
 };
 
+struct TextureMipChain;
+
 class Texture {
 public:
   enum class Mode { stb, gli, memory };
 
   Texture();
-  Texture(const std::string &path);
+  Texture(const std::string &path,
+          TextureMapType map_type = TextureMapType::diffuse);
   Texture(const std::string &path, std::vector<unsigned char> data);
   ~Texture();
 
-  void bind_sampler(GLenum texture_slot, GLenum texture_target = GL_TEXTURE_2D);
+  // the target is the texture object's own, glBindTextureUnit
+  void bind_sampler(GLenum texture_slot);
 
-  static void bind_sampler_handle(gl_handle handle, GLenum texture_slot,
-                                  GLenum texture_target = GL_TEXTURE_2D);
+  static void bind_sampler_handle(gl_handle handle, GLenum texture_slot);
 
   static void bind_image_handle(gl_handle handle, uint32_t binding,
                                 uint32_t mip_level, GLenum format);
@@ -43,8 +46,16 @@ public:
   gl_handle m_handle = INVALID_GL_HANDLE;
   Mode m_mode = Mode::memory;
 
+  // mip streaming state, levels index the cpu mip chain (0 = full res)
+  i32 m_stream_resident_level = 0;
+  i32 m_stream_requested_level = 0;
+  u64 m_stream_last_seen_frame = 0;
+  // bindless handles freeze texture parameters, GLMaterialTable clamps the
+  // sampled lod to the resident levels instead
+  bool m_stream_lod_frozen = false;
+
   union {
-    unsigned char *stb_data;
+    TextureMipChain *mip_chain;
     gli::texture *gli_data;
   } m_cpu_data;
 
@@ -61,17 +72,38 @@ public:
                                          GLenum filter = GL_LINEAR,
                                          GLenum wrap_mode = GL_REPEAT);
 
-  void load_texture_stbi(std::vector<unsigned char> &data);
+  void load_texture_stbi(std::vector<unsigned char> &data,
+                         TextureMapType map_type = TextureMapType::diffuse);
   void load_texture_gli(std::vector<unsigned char> &data);
 
   void submit_to_gpu();
 
+  // streamed textures keep their cpu mip chain to upload levels on demand.
+  // storage always spans the full chain so the handle never changes,
+  // GL_TEXTURE_BASE_LEVEL / GL_TEXTURE_MIN_LOD hide the absent levels
+  bool is_streamed() const;
+  u64 get_mip_level_size(i32 level) const;
+  void upload_mip_level(i32 level);
+  void evict_mip_level(i32 level);
+  // finest level holding valid data
+  i32 get_resident_level() const;
+  // call before creating a bindless handle, opens the lod range up to level 0
+  // and leaves clamping it to the sampler
+  void freeze_stream_lod();
+
   void release();
 
+  // block compress stb textures on the loader thread (BC1/BC3/BC5 by map type)
+  inline static bool s_block_compress = true;
+
   inline static Texture *white;
   inline static Texture *black;
 
   GEM_IMPL_ALLOC(Texture);
+
+protected:
+  void upload_stream_level(i32 level);
+  void apply_stream_lod();
 };
 
 struct TextureEntry {
@@ -0,0 +1,61 @@
+#pragma once
+#include "GL/glew.h"
+#include "gem/alias.h"
+#include "gem/dbg_memory.h"
+#include "gem/texture.h"
+#include <vector>
+
+namespace gem {
+
+enum class TextureBlockFormat { none, bc1, bc3, bc5 };
+
+struct TextureMip {
+  i32 m_width;
+  i32 m_height;
+  std::vector<u8> m_data;
+
+  GEM_IMPL_ALLOC(TextureMip)
+};
+
+// CPU side mip chain produced on the loader threads, level 0 is full res
+struct TextureMipChain {
+  TextureBlockFormat m_block_format = TextureBlockFormat::none;
+  std::vector<TextureMip> m_levels;
+
+  GLenum get_gl_internal_format() const;
+
+  GEM_IMPL_ALLOC(TextureMipChain)
+};
+
+class TextureCompression {
+public:
+  // needs the GL context, call before any texture loads. without
+  // GL_EXT_texture_compression_s3tc (e.g. llvmpipe) BC1 / BC3 textures load
+  // uncompressed, BC5 is core RGTC
+  static void init_gl_support();
+
+  // rgba8 in, returns every level down to 1x1 (level 0 is a copy of the input)
+  static std::vector<TextureMip> generate_mips(const u8 *rgba, i32 width,
+                                               i32 height,
+                                               bool renormalize = false);
+
+  // 2x2 box filter of a single rgba8 level
+  static TextureMip downsample(const TextureMip &src, bool renormalize);
+
+  static TextureBlockFormat get_block_format(TextureMapType map_type,
+                                             bool has_alpha);
+
+  static std::vector<u8> encode(const TextureMip &level,
+                                TextureBlockFormat format);
+
+  static u32 get_block_size(TextureBlockFormat format);
+
+  // encode a single 4x4 rgba8 block (64 bytes in)
+  static void encode_bc1_block(const u8 *block, u8 *out);
+  static void encode_bc3_block(const u8 *block, u8 *out);
+  static void encode_bc4_block(const u8 *block, u32 channel, u8 *out);
+  static void encode_bc5_block(const u8 *block, u8 *out);
+
+  inline static bool s_s3tc_supported = true;
+};
+} // namespace gem
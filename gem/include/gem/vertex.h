@@ -12,6 +12,11 @@ struct VAO {
   gl_handle m_ibo = INVALID_GL_HANDLE;
   uint32_t m_index_count;
   std::vector<gl_handle> m_vbos;
+  // first index (or vertex when non indexed) to draw from, allows several
+  // meshes to share one set of buffers
+  uint32_t m_index_offset = 0;
+  // false for views into another VAO's buffers, release() leaves them be
+  bool m_owns_buffers = true;
   void use();
   void draw();
   void release();
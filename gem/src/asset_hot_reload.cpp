@@ -35,13 +35,14 @@ void GemFileWatchListener::handleFileAction(efsw::WatchID watchid,
     if (Engine::assets.get_asset_load_progress(ah) ==
         AssetLoadProgress::loaded) {
       spdlog::info("GemFileListener : Reloading : {}{}", dir, filename);
-      std::string shader_source = Utils::load_string_from_path(full_path);
+      std::string shader_source = GLShader::preprocess(
+          Utils::load_string_from_path(full_path), full_path);
       auto *shader_asset =
           Engine::assets.get_asset<GLShader, AssetType::shader>(ah);
 
       Engine::debug_callbacks.add([shader_asset, shader_source]() {
         shader_asset->m_data.release();
-        shader_asset->m_data = GLShader::GLShader(shader_source);
+        shader_asset->m_data = GLShader::create_from_composite(shader_source);
       });
     }
     break;
@@ -18,12 +18,19 @@ using model_intermediate_asset =
     TAssetIntermediate<Model, std::vector<Model::MeshEntry>,
                          AssetType::model>;
 using shader_intermediate_asset =
-    TAssetIntermediate<GLShader, std::string, AssetType::shader>;
+    TAssetIntermediate<GLShader, GLShader::PendingLink, AssetType::shader>;
 
 AssetHandle AssetManager::load_asset(const std::string &path,
                                        const AssetType &assetType,
                                       AssetLoadedCallback on_asset_loaded) {
   ZoneScoped;
+  return load_asset(AssetLoadInfo{path, assetType}, on_asset_loaded);
+}
+
+AssetHandle AssetManager::load_asset(const AssetLoadInfo &info,
+                                     AssetLoadedCallback on_asset_loaded) {
+  ZoneScoped;
+  const std::string &path = info.m_path;
   if (!std::filesystem::exists(path)) {
     return AssetHandle::AssetHandle();
   }
@@ -41,8 +48,9 @@ AssetHandle AssetManager::load_asset(const std::string &path,
     }
   }
 
-  AssetHandle handle(tmp_path, assetType);
-  AssetLoadInfo load_info{tmp_path, assetType};
+  AssetHandle handle(tmp_path, info.m_type);
+  AssetLoadInfo load_info = info;
+  load_info.m_path = tmp_path;
 
   auto it = std::find(p_queued_loads.begin(), p_queued_loads.end(), load_info);
 
@@ -160,9 +168,6 @@ void AssetManager::handle_load_and_unload_callbacks() {
   std::vector<AssetHandle> clears;
 
   for (auto &[handle, asset] : p_pending_load_callbacks) {
-    if (processedCallbacks == p_callback_tasks_per_tick)
-      break;
-
     for (u16 i = 0; i < p_callback_tasks_per_tick - processedCallbacks; i++) {
       if (i >= asset.m_asset_load_sync_callbacks.size())
         break;
@@ -172,7 +177,10 @@ void AssetManager::handle_load_and_unload_callbacks() {
       processedCallbacks++;
     }
 
-    if (asset.m_asset_load_sync_callbacks.empty()) {
+    // polls are cheap so every pending asset is checked each tick
+    if (asset.m_asset_load_sync_callbacks.empty() &&
+        (asset.m_asset_load_poll == nullptr ||
+         asset.m_asset_load_poll(asset.m_loaded_asset_intermediate))) {
       clears.push_back(handle);
     }
   }
@@ -225,7 +233,7 @@ void AssetManager::handle_async_tasks() {
     AssetLoadResult asyncReturn = p_pending_load_tasks[handle].get();
     // enqueue new loads
     for (auto &newLoad : asyncReturn.m_new_assets_to_load) {
-      load_asset(newLoad.m_path, newLoad.m_type);
+      load_asset(newLoad);
     }
 
     if (asyncReturn.m_asset_load_sync_callbacks.empty() &&
@@ -299,13 +307,26 @@ void submit_texture_to_gpu(AssetIntermediate *texture_asset) {
   ta_inter->m_intermediate.clear();
 }
 
-void link_shader_program(AssetIntermediate *shader_asset) {
+void begin_shader_program(AssetIntermediate *shader_asset) {
   ZoneScoped;
   shader_intermediate_asset *shader_inter =
       static_cast<shader_intermediate_asset *>(shader_asset);
 
+  shader_inter->m_intermediate =
+      GLShader::begin_composite(shader_inter->m_intermediate.m_source);
+}
+
+bool poll_shader_program(AssetIntermediate *shader_asset) {
+  ZoneScoped;
+  shader_intermediate_asset *shader_inter =
+      static_cast<shader_intermediate_asset *>(shader_asset);
+
+  if (!GLShader::is_link_complete(shader_inter->m_intermediate)) {
+    return false;
+  }
   shader_inter->get_concrete_asset()->m_data =
-      GLShader::create_from_composite(shader_inter->m_intermediate);
+      GLShader::finish_composite(shader_inter->m_intermediate);
+  return true;
 }
 
 AssetLoadResult load_model_asset_manager(const std::string &path) {
@@ -324,7 +345,7 @@ AssetLoadResult load_model_asset_manager(const std::string &path) {
   AssetLoadResult ret{};
   for (auto &tex : associated_textures) {
     ret.m_new_assets_to_load.push_back(
-        AssetLoadInfo{tex.m_path, AssetType::texture});
+        AssetLoadInfo{tex.m_path, AssetType::texture, tex.m_map_type});
   }
   for (int i = 0; i < mesh_entries.size(); i++) {
     ret.m_asset_load_sync_callbacks.push_back(submit_meshes_to_gpu);
@@ -341,7 +362,8 @@ void unload_model_asset_manager(Asset *_asset) {
   ma->m_data.release();
 }
 
-AssetLoadResult load_texture_asset_manager(const std::string &path) {
+AssetLoadResult load_texture_asset_manager(const std::string &path,
+                                           TextureMapType map_type) {
   ZoneScoped;
   AssetLoadResult ret{};
   ret.m_new_assets_to_load = {};
@@ -353,7 +375,7 @@ AssetLoadResult load_texture_asset_manager(const std::string &path) {
   if (path.find("dds") != std::string::npos) {
     t.load_texture_gli(binary);
   } else {
-    t.load_texture_stbi(binary);
+    t.load_texture_stbi(binary, map_type);
   }
 
   TAsset<Texture, AssetType::texture> *ta =
@@ -374,12 +396,19 @@ void unload_texture_asset_manager(Asset *_asset) {
 
 AssetLoadResult load_shader_asset_manager(const std::string &path) {
   ZoneScoped;
-  std::string source = Utils::load_string_from_path(path);
+  // includes are resolved here on the loader thread, linking stays on main
+  std::string source =
+      GLShader::preprocess(Utils::load_string_from_path(path), path);
   AssetLoadResult ret{};
+  GLShader::PendingLink pending{};
+  pending.m_source = source;
   ret.m_loaded_asset_intermediate = new shader_intermediate_asset(
-      new TAsset<GLShader, AssetType::shader>(GLShader{}, path), source,
+      new TAsset<GLShader, AssetType::shader>(GLShader{}, path), pending,
       path);
-  ret.m_asset_load_sync_callbacks.push_back(link_shader_program);
+  // the sync callback only issues the compile, the asset finishes once the
+  // driver reports completion so shaders in flight compile in parallel
+  ret.m_asset_load_sync_callbacks.push_back(begin_shader_program);
+  ret.m_asset_load_poll = poll_shader_program;
   ret.m_new_assets_to_load = {};
 
   return ret;
@@ -404,7 +433,8 @@ void AssetManager::dispatch_asset_load_task(const AssetHandle &handle,
   case AssetType::texture:
     p_pending_load_tasks.emplace(
         handle, std::move(std::async(std::launch::async,
-                                     load_texture_asset_manager, info.m_path)));
+                                     load_texture_asset_manager, info.m_path,
+                                     info.m_texture_map_type)));
     break;
   case AssetType::shader:
     p_pending_load_tasks.emplace(
@@ -0,0 +1,293 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/culling.h"
+#include "gem/profile.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX__)
+#define GEM_CULLING_AVX
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define GEM_CULLING_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace gem {
+
+void FrustumCuller::clear() { p_count = 0; }
+
+void FrustumCuller::add(const AABB &local, const glm::mat4 &model) {
+  resize(p_count + 1);
+  set(p_count - 1, local, model);
+}
+
+void FrustumCuller::resize(u32 count) {
+  // a full vector of padding past the last box, so a vector load starting
+  // at any box stays in bounds
+  if (count + s_lane_count > p_bounds[0].size()) {
+    const size_t size = std::max<size_t>(count + s_lane_count,
+                                         p_bounds[0].size() * 2);
+    for (std::vector<float> &bound : p_bounds) {
+      bound.resize(size, 0.0f);
+    }
+  }
+  p_count = count;
+}
+
+void FrustumCuller::set(u32 index, const AABB &local, const glm::mat4 &model) {
+  glm::vec3 centre{}, extent{};
+  get_world_bounds(local, model, centre, extent);
+  for (u32 axis = 0; axis < 3; axis++) {
+    p_bounds[centre_x + axis][index] = centre[axis];
+    p_bounds[extent_x + axis][index] = extent[axis];
+  }
+}
+
+void FrustumCuller::get_world_bounds(const AABB &local, const glm::mat4 &model,
+                                     glm::vec3 &centre, glm::vec3 &extent) {
+  centre =
+      glm::vec3(model * glm::vec4((local.m_min + local.m_max) * 0.5f, 1.0f));
+  const glm::vec3 half = (local.m_max - local.m_min) * 0.5f;
+  for (u32 axis = 0; axis < 3; axis++) {
+    // |M| applied to the half extent bounds every rotated corner
+    extent[axis] = std::abs(model[0][axis]) * half.x +
+                   std::abs(model[1][axis]) * half.y +
+                   std::abs(model[2][axis]) * half.z;
+  }
+}
+
+glm::vec3 FrustumCuller::get_centre(u32 index) const {
+  return glm::vec3(p_bounds[centre_x][index], p_bounds[centre_y][index],
+                   p_bounds[centre_z][index]);
+}
+
+u32 FrustumCuller::cull(const std::array<glm::vec4, 6> &planes,
+                        std::vector<u8> &visible) const {
+  visible.resize(p_count);
+  return cull(planes, visible.data(), 0, p_count);
+}
+
+bool FrustumCuller::has_path(SimdPath path) {
+  switch (path) {
+  case SimdPath::scalar:
+    return true;
+  case SimdPath::sse:
+#if defined(GEM_CULLING_SSE)
+    return true;
+#else
+    return false;
+#endif
+  case SimdPath::avx:
+#if defined(GEM_CULLING_AVX)
+    return true;
+#else
+    return false;
+#endif
+  }
+  return false;
+}
+
+u32 FrustumCuller::cull(const std::array<glm::vec4, 6> &planes, u8 *visible,
+                        u32 first, u32 last) const {
+#if defined(GEM_CULLING_AVX)
+  return cull(planes, visible, first, last, SimdPath::avx);
+#elif defined(GEM_CULLING_SSE)
+  return cull(planes, visible, first, last, SimdPath::sse);
+#else
+  return cull(planes, visible, first, last, SimdPath::scalar);
+#endif
+}
+
+u32 FrustumCuller::cull(const std::array<glm::vec4, 6> &planes, u8 *visible,
+                        u32 first, u32 last, SimdPath path) const {
+  ZoneScoped;
+  const float *cx = p_bounds[centre_x].data();
+  const float *cy = p_bounds[centre_y].data();
+  const float *cz = p_bounds[centre_z].data();
+  const float *ex = p_bounds[extent_x].data();
+  const float *ey = p_bounds[extent_y].data();
+  const float *ez = p_bounds[extent_z].data();
+
+  // a box is outside a plane when its centre is further behind it than the
+  // projected radius |n| . extent, the test is sign only so plane scale
+  // doesn't matter. every path sums in the same order so they agree exactly
+  u32 visible_count = 0;
+  u32 i = first;
+  switch (path) {
+  case SimdPath::avx: {
+#if defined(GEM_CULLING_AVX)
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    for (; i < last; i += 8) {
+      const __m256 px = _mm256_loadu_ps(cx + i);
+      const __m256 py = _mm256_loadu_ps(cy + i);
+      const __m256 pz = _mm256_loadu_ps(cz + i);
+      const __m256 rx = _mm256_loadu_ps(ex + i);
+      const __m256 ry = _mm256_loadu_ps(ey + i);
+      const __m256 rz = _mm256_loadu_ps(ez + i);
+      __m256 inside = _mm256_cmp_ps(px, px, _CMP_EQ_OQ);
+      for (const glm::vec4 &plane : planes) {
+        const __m256 nx = _mm256_set1_ps(plane.x);
+        const __m256 ny = _mm256_set1_ps(plane.y);
+        const __m256 nz = _mm256_set1_ps(plane.z);
+        __m256 distance = _mm256_add_ps(_mm256_mul_ps(px, nx),
+                                        _mm256_set1_ps(plane.w));
+        distance = _mm256_add_ps(distance, _mm256_mul_ps(py, ny));
+        distance = _mm256_add_ps(distance, _mm256_mul_ps(pz, nz));
+        // |n| by clearing the sign bits
+        __m256 radius = _mm256_mul_ps(rx, _mm256_andnot_ps(sign, nx));
+        radius = _mm256_add_ps(
+            radius, _mm256_mul_ps(ry, _mm256_andnot_ps(sign, ny)));
+        radius = _mm256_add_ps(
+            radius, _mm256_mul_ps(rz, _mm256_andnot_ps(sign, nz)));
+        inside = _mm256_and_ps(
+            inside, _mm256_cmp_ps(_mm256_add_ps(distance, radius),
+                                  _mm256_setzero_ps(), _CMP_GE_OQ));
+      }
+      const u32 mask = static_cast<u32>(_mm256_movemask_ps(inside));
+      for (u32 lane = 0; lane < 8 && i + lane < last; lane++) {
+        visible[i + lane] = static_cast<u8>((mask >> lane) & 1u);
+        visible_count += visible[i + lane];
+      }
+    }
+    return visible_count;
+#else
+    break;
+#endif
+  }
+  case SimdPath::sse: {
+#if defined(GEM_CULLING_SSE)
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    for (; i < last; i += 4) {
+      const __m128 px = _mm_loadu_ps(cx + i);
+      const __m128 py = _mm_loadu_ps(cy + i);
+      const __m128 pz = _mm_loadu_ps(cz + i);
+      const __m128 rx = _mm_loadu_ps(ex + i);
+      const __m128 ry = _mm_loadu_ps(ey + i);
+      const __m128 rz = _mm_loadu_ps(ez + i);
+      __m128 inside = _mm_cmpeq_ps(px, px);
+      for (const glm::vec4 &plane : planes) {
+        const __m128 nx = _mm_set1_ps(plane.x);
+        const __m128 ny = _mm_set1_ps(plane.y);
+        const __m128 nz = _mm_set1_ps(plane.z);
+        __m128 distance =
+            _mm_add_ps(_mm_mul_ps(px, nx), _mm_set1_ps(plane.w));
+        distance = _mm_add_ps(distance, _mm_mul_ps(py, ny));
+        distance = _mm_add_ps(distance, _mm_mul_ps(pz, nz));
+        __m128 radius = _mm_mul_ps(rx, _mm_andnot_ps(sign, nx));
+        radius = _mm_add_ps(radius, _mm_mul_ps(ry, _mm_andnot_ps(sign, ny)));
+        radius = _mm_add_ps(radius, _mm_mul_ps(rz, _mm_andnot_ps(sign, nz)));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius),
+                                                 _mm_setzero_ps()));
+      }
+      const u32 mask = static_cast<u32>(_mm_movemask_ps(inside));
+      for (u32 lane = 0; lane < 4 && i + lane < last; lane++) {
+        visible[i + lane] = static_cast<u8>((mask >> lane) & 1u);
+        visible_count += visible[i + lane];
+      }
+    }
+    return visible_count;
+#else
+    break;
+#endif
+  }
+  case SimdPath::scalar:
+    break;
+  }
+
+  // paths not compiled in fall back to scalar
+  for (; i < last; i++) {
+    bool inside = true;
+    for (const glm::vec4 &plane : planes) {
+      float distance = cx[i] * plane.x + plane.w;
+      distance += cy[i] * plane.y;
+      distance += cz[i] * plane.z;
+      float radius = ex[i] * std::abs(plane.x);
+      radius += ey[i] * std::abs(plane.y);
+      radius += ez[i] * std::abs(plane.z);
+      inside &= distance + radius >= 0.0f;
+    }
+    visible[i] = inside ? Visibility::inside : Visibility::outside;
+    visible_count += visible[i];
+  }
+  return visible_count;
+}
+
+u32 FrustumCuller::occlusion_cull(const DepthPyramidLevel &pyramid,
+                                  std::vector<u8> &visible) const {
+  return occlusion_cull(pyramid, visible.data(), 0,
+                        static_cast<u32>(visible.size()));
+}
+
+u32 FrustumCuller::occlusion_cull(const DepthPyramidLevel &pyramid,
+                                  u8 *visible, u32 first, u32 last) const {
+  ZoneScoped;
+  if (!pyramid.m_valid || pyramid.m_depth.empty()) {
+    return 0;
+  }
+  // level texel = depth texel / 2^(level + 1), widened by a depth texel for
+  // the jitter the pyramid was rendered with
+  const glm::vec2 texel_scale = glm::vec2(pyramid.m_depth_resolution) /
+                                static_cast<float>(2u << pyramid.m_level);
+  const glm::vec2 jitter_margin = 1.0f / glm::vec2(pyramid.m_depth_resolution);
+  // larger footprints are left to the GPU
+  constexpr i32 max_texels = 64;
+
+  u32 occluded_count = 0;
+  for (u32 i = first; i < last; i++) {
+    if (visible[i] != Visibility::inside) {
+      continue;
+    }
+    const glm::vec3 centre = get_centre(i);
+    const glm::vec3 extent(p_bounds[extent_x][i], p_bounds[extent_y][i],
+                           p_bounds[extent_z][i]);
+
+    glm::vec3 ndc_min(1.0f), ndc_max(-1.0f);
+    bool behind = false;
+    for (u32 corner = 0; corner < 8; corner++) {
+      const glm::vec3 sign((corner & 1) ? 1.0f : -1.0f,
+                           (corner & 2) ? 1.0f : -1.0f,
+                           (corner & 4) ? 1.0f : -1.0f);
+      const glm::vec4 clip =
+          pyramid.m_view_proj * glm::vec4(centre + sign * extent, 1.0f);
+      if (clip.w <= 1e-4f) {
+        behind = true;
+        break;
+      }
+      const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+      ndc_min = glm::min(ndc_min, ndc);
+      ndc_max = glm::max(ndc_max, ndc);
+    }
+    // crossing the camera plane, can't bound the projection
+    if (behind) {
+      continue;
+    }
+
+    const glm::vec2 uv_min = glm::clamp(
+        glm::vec2(ndc_min) * 0.5f + 0.5f - jitter_margin, 0.0f, 1.0f);
+    const glm::vec2 uv_max = glm::clamp(
+        glm::vec2(ndc_max) * 0.5f + 0.5f + jitter_margin, 0.0f, 1.0f);
+    const glm::ivec2 t0 = glm::min(glm::ivec2(uv_min * texel_scale),
+                                   pyramid.m_size - 1);
+    const glm::ivec2 t1 = glm::min(glm::ivec2(uv_max * texel_scale),
+                                   pyramid.m_size - 1);
+    if ((t1.x - t0.x + 1) * (t1.y - t0.y + 1) > max_texels) {
+      continue;
+    }
+
+    float farthest = 0.0f;
+    for (i32 y = t0.y; y <= t1.y; y++) {
+      for (i32 x = t0.x; x <= t1.x; x++) {
+        farthest =
+            std::max(farthest, pyramid.m_depth[y * pyramid.m_size.x + x]);
+      }
+    }
+    const float nearest = ndc_min.z * 0.5f + 0.5f;
+    if (nearest > farthest) {
+      visible[i] = Visibility::occluded;
+      occluded_count++;
+    }
+  }
+  return occluded_count;
+}
+} // namespace gem
@@ -0,0 +1,57 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/dynamic_resolution.h"
+#include "gem/profile.h"
+#include <algorithm>
+#include <cmath>
+
+namespace gem {
+
+u32 DynamicResolution::add_pass(const std::string &name, float scale,
+                                float min_scale, float max_scale) {
+  Pass pass{};
+  pass.m_name = name;
+  pass.m_min_scale = min_scale;
+  pass.m_max_scale = max_scale;
+  pass.m_scale = std::clamp(scale, min_scale, max_scale);
+  m_passes.push_back(pass);
+  return static_cast<u32>(m_passes.size() - 1);
+}
+
+void DynamicResolution::set_gpu_time(u32 pass, float gpu_ms) {
+  m_passes[pass].m_gpu_ms = gpu_ms;
+}
+
+float DynamicResolution::get_scale(u32 pass) const {
+  return m_passes[pass].m_scale;
+}
+
+void DynamicResolution::update(float frame_gpu_ms) {
+  ZoneScoped;
+  m_last_frame_ms = frame_gpu_ms;
+  const float error = m_target_frame_ms - frame_gpu_ms;
+  if (!m_enabled || std::abs(error) < m_target_frame_ms * m_tolerance) {
+    return;
+  }
+
+  float scaled_ms = 0.0f;
+  for (const Pass &pass : m_passes) {
+    scaled_ms += pass.m_gpu_ms;
+  }
+  if (scaled_ms <= 0.0f) {
+    return;
+  }
+
+  for (Pass &pass : m_passes) {
+    if (pass.m_gpu_ms <= 0.0f) {
+      continue;
+    }
+    // a pass can't give back more than most of its own time
+    const float budget = std::max(
+        pass.m_gpu_ms + error * (pass.m_gpu_ms / scaled_ms),
+        pass.m_gpu_ms * 0.25f);
+    const float ideal = pass.m_scale * std::sqrt(budget / pass.m_gpu_ms);
+    pass.m_scale = std::clamp(pass.m_scale + (ideal - pass.m_scale) * m_rate,
+                              pass.m_min_scale, pass.m_max_scale);
+  }
+}
+} // namespace gem
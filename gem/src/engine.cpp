@@ -1,22 +1,34 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "gem/engine.h"
 #include "gem/gl/gl_backend.h"
+#include "gem/gl/gl_headless_backend.h"
 #include "gem/material.h"
 #include "gem/mesh.h"
+#include "gem/parallel.h"
 #include "gem/profile.h"
 #include "gem/transform.h"
 #include "gem/utils.h"
 
 namespace gem {
 
-void Engine::init() {
+bool Engine::init(bool headless, u32 frame_limit) {
   ZoneScoped;
   glm::ivec2 resolution = {1920, 1080};
-  GPUBackend::init_backend<GLBackend>(BackendInit{resolution, true});
+  BackendInit backend_init{resolution, !headless};
+  const bool initialised =
+      headless ? GPUBackend::init_backend<GLHeadlessBackend>(backend_init,
+                                                             frame_limit)
+               : GPUBackend::init_backend<GLBackend>(backend_init);
+  if (!initialised) {
+    spdlog::error("engine : failed to initialise the {} backend",
+                  headless ? "headless" : "windowed");
+    return false;
+  }
 
   systems.add_system<TransformSystem>();
   systems.add_system<MeshSystem>();
   systems.add_system<MaterialSystem>();
+  return true;
 }
 
 void Engine::save_project_to_disk(const std::string &filename,
@@ -40,6 +52,7 @@ void Engine::shutdown() {
   ZoneScoped;
   systems.m_systems.clear();
   systems.m_system_type_aliases.clear();
+  Parallel::shutdown();
 }
 void Engine::update() {
   assets.update();
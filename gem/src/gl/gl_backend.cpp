@@ -1,8 +1,10 @@
 #include "gem/gl/gl_backend.h"
 #include "gem/dbg_memory.h"
 #include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_shader.h"
 #include "gem/input.h"
 #include "gem/profile.h"
+#include "gem/texture_compression.h"
 #include "imgui.h"
 #include "imgui_impl_opengl3.h"
 #include "imgui_impl_sdl3.h"
@@ -15,7 +17,7 @@
 namespace gem {
 
 // todo: rework this to allow rendering backend to init
-void GLBackend::init(BackendInit &init_props) {
+bool GLBackend::init(BackendInit &init_props) {
   ZoneScoped;
 #ifdef GEM_ENABLE_MEMORY_TRACKING
   DebugMemoryTracker::s_instance = new DebugMemoryTracker();
@@ -28,7 +30,7 @@ void GLBackend::init(BackendInit &init_props) {
   // Setup SDL
   if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMEPAD | SDL_INIT_AUDIO)) {
     spdlog::error("gl_backend : failed to initialize SDL : {}",  std::string(SDL_GetError()));
-    return;
+    return false;
   }
   // Decide GL+GLSL versions
 #if defined(IMGUI_IMPL_OPENGL_ES2)
@@ -73,7 +75,7 @@ void GLBackend::init(BackendInit &init_props) {
                        init_props.window_resolution.y, window_flags);
   if (m_window == nullptr) {
     printf("Error: SDL_CreateWindow(): %s\n", SDL_GetError());
-    return;
+    return false;
   }
 
   m_sdl_gl_context = new SDL_GLContext(SDL_GL_CreateContext(m_window));
@@ -84,10 +86,30 @@ void GLBackend::init(BackendInit &init_props) {
     printf("GLEW init failed!");
     SDL_DestroyWindow(m_window);
     SDL_Quit();
-    return;
+    return false;
   }
 
   SDL_GL_SetSwapInterval(init_props.enable_vsync); // Enable vsync
+  init_gl_defaults();
+  init_imgui_context();
+
+  // Setup Platform/Renderer backends
+  ImGui_ImplSDL3_InitForOpenGL(m_window, *m_sdl_gl_context);
+  ImGui_ImplOpenGL3_Init(glsl_version);
+
+  m_now_counter = SDL_GetPerformanceCounter();
+  m_last_counter = 0;
+
+  init_built_in_assets();
+  init_imgui_file_dialog();
+  return true;
+}
+
+void GLBackend::init_gl_defaults() {
+  ZoneScoped;
+  GLShader::init_parallel_compile();
+  GLShader::init_spirv();
+  TextureCompression::init_gl_support();
 
   glEnable(GL_DEPTH_TEST);
 #ifdef __DEBUG__
@@ -97,7 +119,10 @@ void GLBackend::init(BackendInit &init_props) {
   glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr,
                         GL_TRUE);
 #endif
+}
 
+void GLBackend::init_imgui_context() {
+  ZoneScoped;
   // Setup Dear ImGui context
   IMGUI_CHECKVERSION();
   ImGui::CreateContext();
@@ -111,16 +136,6 @@ void GLBackend::init(BackendInit &init_props) {
 
   // Setup Dear ImGui style
   set_imgui_style();
-
-  // Setup Platform/Renderer backends
-  ImGui_ImplSDL3_InitForOpenGL(m_window, *m_sdl_gl_context);
-  ImGui_ImplOpenGL3_Init(glsl_version);
-
-  m_now_counter = SDL_GetPerformanceCounter();
-  m_last_counter = 0;
-
-  init_built_in_assets();
-  init_imgui_file_dialog();
 }
 
 void GLBackend::process_sdl_event() {
@@ -0,0 +1,182 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_constant_ring.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/profile.h"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <cstring>
+
+namespace gem {
+
+void GLConstantRing::init() {
+  ZoneScoped;
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &s_alignment);
+  create_ring();
+}
+
+void GLConstantRing::cleanup() {
+  ZoneScoped;
+  destroy_ring();
+  for (gl_handle buffer : s_retired_overflow_buffers) {
+    glDeleteBuffers(1, &buffer);
+  }
+  s_retired_overflow_buffers.clear();
+  if (s_overflow_buffer != INVALID_GL_HANDLE) {
+    glDeleteBuffers(1, &s_overflow_buffer);
+    s_overflow_buffer = INVALID_GL_HANDLE;
+  }
+  s_overflow_capacity = 0;
+  s_overflow_head = 0;
+}
+
+void GLConstantRing::create_ring() {
+  ZoneScoped;
+  const GLbitfield flags =
+      GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  const GLsizeiptr size =
+      static_cast<GLsizeiptr>(s_frame_region_size) * s_frames_in_flight;
+
+  glAssert(glCreateBuffers(1, &s_buffer));
+  glAssert(glNamedBufferStorage(s_buffer, size, nullptr, flags));
+  s_mapped =
+      static_cast<u8 *>(glMapNamedBufferRange(s_buffer, 0, size, flags));
+  s_fences.fill(nullptr);
+  s_region = 0;
+  s_head = 0;
+}
+
+void GLConstantRing::destroy_ring() {
+  ZoneScoped;
+  for (GLsync &fence : s_fences) {
+    if (fence) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  if (s_buffer != INVALID_GL_HANDLE) {
+    glUnmapNamedBuffer(s_buffer);
+    glDeleteBuffers(1, &s_buffer);
+    s_buffer = INVALID_GL_HANDLE;
+  }
+  s_mapped = nullptr;
+}
+
+void GLConstantRing::begin_frame() {
+  ZoneScoped;
+  s_region = (s_region + 1) % s_frames_in_flight;
+  s_head = 0;
+
+  GLsync &fence = s_fences[s_region];
+  if (fence == nullptr) {
+    return;
+  }
+  // only blocks if the gpu is more than s_frames_in_flight frames behind
+  GLenum status = glClientWaitSync(fence, 0, 0);
+  while (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+    ZoneScopedN("Wait For Constant Region");
+    if (status == GL_WAIT_FAILED) {
+      spdlog::error("constant ring : wait failed");
+      break;
+    }
+    status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+  }
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
+void GLConstantRing::end_frame() {
+  ZoneScoped;
+  GLsync &fence = s_fences[s_region];
+  if (fence) {
+    glDeleteSync(fence);
+  }
+  fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  s_bytes_last_frame = s_head + s_overflow_head;
+
+  for (gl_handle buffer : s_retired_overflow_buffers) {
+    glDeleteBuffers(1, &buffer);
+  }
+  s_retired_overflow_buffers.clear();
+  if (s_overflow_head == 0) {
+    return;
+  }
+
+  // every region may be in flight, wait them out rather than track which
+  // ones the old buffer still backs
+  u32 region_size = s_frame_region_size;
+  while (region_size < s_bytes_last_frame) {
+    region_size *= 2;
+  }
+  spdlog::warn("constant ring : {} bytes pushed in a {} byte frame region, "
+               "growing regions to {} bytes",
+               s_bytes_last_frame, s_frame_region_size, region_size);
+  glFinish();
+  destroy_ring();
+  s_frame_region_size = region_size;
+  create_ring();
+  s_overflow_head = 0;
+}
+
+u32 GLConstantRing::push(const void *data, u32 size) {
+  const u32 alignment = static_cast<u32>(s_alignment);
+  const u32 aligned_size = (size + alignment - 1) / alignment * alignment;
+  if (s_overflow_head > 0 || s_head + aligned_size > s_frame_region_size) {
+    // the rest of the region belongs to frames the gpu may still be reading
+    return push_overflow(data, size, aligned_size);
+  }
+
+  const u32 offset = s_region * s_frame_region_size + s_head;
+  std::memcpy(s_mapped + offset, data, size);
+  s_head += aligned_size;
+  return offset;
+}
+
+u32 GLConstantRing::push_overflow(const void *data, u32 size,
+                                  u32 aligned_size) {
+  ZoneScoped;
+  if (s_overflow_head + aligned_size > s_overflow_capacity) {
+    const u32 capacity =
+        std::max(s_overflow_capacity * 2,
+                 std::max(s_overflow_head + aligned_size, 64u * 1024u));
+    gl_handle buffer = INVALID_GL_HANDLE;
+    glAssert(glCreateBuffers(1, &buffer));
+    glAssert(glNamedBufferStorage(buffer, capacity, nullptr,
+                                  GL_DYNAMIC_STORAGE_BIT));
+    if (s_overflow_buffer != INVALID_GL_HANDLE) {
+      glAssert(glCopyNamedBufferSubData(s_overflow_buffer, buffer, 0, 0,
+                                        s_overflow_head));
+      s_retired_overflow_buffers.push_back(s_overflow_buffer);
+    }
+    s_overflow_buffer = buffer;
+    s_overflow_capacity = capacity;
+  }
+
+  const u32 offset = s_overflow_head;
+  glAssert(glNamedBufferSubData(s_overflow_buffer, offset, size, data));
+  s_overflow_head += aligned_size;
+  return s_frame_region_size * s_frames_in_flight + offset;
+}
+
+void GLConstantRing::bind(u32 binding, u32 offset, u32 size) {
+  const u32 ring_size = s_frame_region_size * s_frames_in_flight;
+  if (offset >= ring_size) {
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, s_overflow_buffer,
+                      offset - ring_size, size);
+    return;
+  }
+  glBindBufferRange(GL_UNIFORM_BUFFER, binding, s_buffer, offset, size);
+}
+
+glm::vec2 GLConstantRing::get_jitter(u32 frame_index, glm::vec2 resolution) {
+  static const std::array<glm::vec2, 16> s_halton = {
+      glm::vec2(0.500000f, 0.333333f), glm::vec2(0.250000f, 0.666667f),
+      glm::vec2(0.750000f, 0.111111f), glm::vec2(0.125000f, 0.444444f),
+      glm::vec2(0.625000f, 0.777778f), glm::vec2(0.375000f, 0.222222f),
+      glm::vec2(0.875000f, 0.555556f), glm::vec2(0.062500f, 0.888889f),
+      glm::vec2(0.562500f, 0.037037f), glm::vec2(0.312500f, 0.370370f),
+      glm::vec2(0.812500f, 0.703704f), glm::vec2(0.187500f, 0.148148f),
+      glm::vec2(0.687500f, 0.481481f), glm::vec2(0.437500f, 0.814815f),
+      glm::vec2(0.937500f, 0.259259f), glm::vec2(0.031250f, 0.592593f)};
+  return (s_halton[frame_index % 16] - 0.5f) / resolution;
+}
+} // namespace gem
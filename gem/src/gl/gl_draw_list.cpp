@@ -0,0 +1,272 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_draw_list.h"
+#include "gem/material.h"
+#include "gem/mesh.h"
+#include "gem/parallel.h"
+#include "gem/profile.h"
+#include "gem/scene.h"
+#include "gem/transform.h"
+#include "gem/utils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace gem {
+
+static constexpr u32 s_pass_shift = 60;
+static constexpr u32 s_shader_shift = 50;
+static constexpr u32 s_material_shift = 34;
+static constexpr u32 s_vao_shift = 18;
+
+static constexpr u64 s_shader_mask = (1u << 10) - 1;
+static constexpr u64 s_material_mask = (1u << 16) - 1;
+static constexpr u64 s_vao_mask = (1u << 16) - 1;
+static constexpr u64 s_depth_mask = (1u << 18) - 1;
+
+void GLDrawList::set_pass(DrawPass pass, bool enabled, gl_handle program,
+                          DrawView view) {
+  PassFilter &filter = p_passes[static_cast<u32>(pass)];
+  filter.m_enabled = enabled;
+  filter.m_program = program;
+  filter.m_view = view;
+}
+
+void GLDrawList::set_view(DrawView view, const glm::mat4 &view_proj) {
+  p_view_planes[static_cast<u32>(view)] =
+      Utils::get_planes_from_view_proj(view_proj);
+}
+
+void GLDrawList::set_occluders(const DepthPyramidLevel *occluders) {
+  p_occluders = occluders;
+}
+
+u32 GLDrawList::get_shader_bits(gl_handle program) {
+  auto it = p_shader_ids.find(program);
+  if (it != p_shader_ids.end()) {
+    return it->second;
+  }
+  const u32 id = static_cast<u32>(p_shader_ids.size() & s_shader_mask);
+  p_shader_ids.emplace(program, id);
+  return id;
+}
+
+u32 GLDrawList::get_material_bits(const MaterialInstance *instance) {
+  auto it = p_material_ids.find(instance);
+  if (it != p_material_ids.end()) {
+    return it->second;
+  }
+  const u32 id = static_cast<u32>(p_material_ids.size() & s_material_mask);
+  p_material_ids.emplace(instance, id);
+  return id;
+}
+
+void GLDrawList::build(std::vector<Scene *> &scenes, glm::vec3 view_position) {
+  ZoneScoped;
+  p_packets.clear();
+  p_shader_ids.clear();
+  p_material_ids.clear();
+
+  p_renderables.clear();
+  m_pass_stats.fill(PassStats{});
+
+  {
+    ZoneScopedN("Gather");
+    for (Scene *current_scene : scenes) {
+      auto renderables =
+          current_scene->m_registry.view<Transform, MeshComponent, Material>();
+      for (auto [e, trans, emesh, ematerial] : renderables.each()) {
+        p_renderables.push_back(Renderable{
+            static_cast<u32>(e), &trans, &emesh, &ematerial,
+            get_shader_bits(ematerial.m_prog.m_shader_id),
+            get_material_bits(ematerial.m_instance.get())});
+      }
+    }
+  }
+
+  const u32 count = static_cast<u32>(p_renderables.size());
+  p_culler.resize(count);
+  p_view_used.fill(false);
+  for (const PassFilter &filter : p_passes) {
+    p_view_used[static_cast<u32>(filter.m_view)] |= filter.m_enabled;
+  }
+  for (u32 view = 0; view < s_view_count; view++) {
+    if (p_view_used[view]) {
+      p_visible[view].resize(count);
+    }
+  }
+
+  const u32 max_ranges = m_multithreaded ? Parallel::get_thread_count() : 1;
+  p_range_packets.resize(std::max<size_t>(p_range_packets.size(), max_ranges));
+  p_range_stats.resize(p_range_packets.size());
+  if (m_multithreaded) {
+    // culling loads whole SIMD vectors, lane aligned ranges keep a range's
+    // loads clear of the bounds another range is writing with set()
+    m_record_ranges = Parallel::for_ranges(
+        count, s_min_record_range,
+        [&](u32 first, u32 last, u32 range) {
+          record(first, last, range, view_position);
+        },
+        FrustumCuller::s_lane_count);
+  } else {
+    record(0, count, 0, view_position);
+    m_record_ranges = 1;
+  }
+
+  {
+    ZoneScopedN("Merge");
+    size_t packet_count = 0;
+    for (u32 range = 0; range < m_record_ranges; range++) {
+      packet_count += p_range_packets[range].size();
+    }
+    p_packets.reserve(packet_count);
+    for (u32 range = 0; range < m_record_ranges; range++) {
+      const std::vector<DrawPacket> &packets = p_range_packets[range];
+      p_packets.insert(p_packets.end(), packets.begin(), packets.end());
+      for (u32 pass = 0; pass < s_pass_count; pass++) {
+        const PassStats &stats = p_range_stats[range][pass];
+        m_pass_stats[pass].m_visible += stats.m_visible;
+        m_pass_stats[pass].m_culled += stats.m_culled;
+        m_pass_stats[pass].m_occluded += stats.m_occluded;
+      }
+    }
+  }
+
+  sort();
+
+  p_ranges.fill(DrawRange{});
+  for (u32 i = 0; i < p_packets.size(); i++) {
+    const u32 pass = static_cast<u32>(p_packets[i].m_key >> s_pass_shift);
+    DrawRange &range = p_ranges[pass];
+    if (range.m_count == 0) {
+      range.m_first = p_packets.data() + i;
+    }
+    range.m_count++;
+  }
+  m_packet_count = static_cast<u32>(p_packets.size());
+}
+
+void GLDrawList::record(u32 first, u32 last, u32 range,
+                        glm::vec3 view_position) {
+  ZoneScoped;
+  std::vector<DrawPacket> &packets = p_range_packets[range];
+  PassStatsArray &pass_stats = p_range_stats[range];
+  packets.clear();
+  pass_stats.fill(PassStats{});
+
+  for (u32 i = first; i < last; i++) {
+    const Renderable &renderable = p_renderables[i];
+    p_culler.set(i, renderable.m_mesh->m_mesh.m_original_aabb,
+                 renderable.m_transform->m_model);
+  }
+
+  {
+    ZoneScopedN("Frustum Cull");
+    for (u32 view = 0; view < s_view_count; view++) {
+      if (!p_view_used[view]) {
+        continue;
+      }
+      u8 *visible = p_visible[view].data();
+      if (m_frustum_culling && view != static_cast<u32>(DrawView::unculled)) {
+        p_culler.cull(p_view_planes[view], visible, first, last);
+      } else {
+        std::fill(visible + first, visible + last,
+                  FrustumCuller::Visibility::inside);
+      }
+    }
+  }
+  const u32 camera = static_cast<u32>(DrawView::camera);
+  if (p_view_used[camera] && p_occluders != nullptr) {
+    ZoneScopedN("Occlusion Cull");
+    p_culler.occlusion_cull(*p_occluders, p_visible[camera].data(), first,
+                            last);
+  }
+
+  for (u32 i = first; i < last; i++) {
+    const Renderable &renderable = p_renderables[i];
+    const gl_handle program = renderable.m_material->m_prog.m_shader_id;
+
+    // positive floats order the same as their bit patterns
+    const float distance = glm::length(p_culler.get_centre(i) - view_position);
+    u32 distance_bits = 0;
+    std::memcpy(&distance_bits, &distance, sizeof(u32));
+    const u32 depth = distance_bits >> 14;
+    const u32 vao = renderable.m_mesh->m_mesh.m_vao.m_vao_id;
+
+    for (u32 pass = 0; pass < s_pass_count; pass++) {
+      const PassFilter &filter = p_passes[pass];
+      // INVALID_GL_HANDLE is depth only, every renderable is drawn
+      if (!filter.m_enabled || (filter.m_program != INVALID_GL_HANDLE &&
+                                filter.m_program != program)) {
+        continue;
+      }
+      const u8 visibility = p_visible[static_cast<u32>(filter.m_view)][i];
+      if (visibility == FrustumCuller::Visibility::outside) {
+        pass_stats[pass].m_culled++;
+        continue;
+      }
+      u32 range_index = pass;
+      if (visibility == FrustumCuller::Visibility::occluded) {
+        pass_stats[pass].m_occluded++;
+        range_index += s_pass_count;
+      } else {
+        pass_stats[pass].m_visible++;
+      }
+
+      const bool shaded = filter.m_program != INVALID_GL_HANDLE;
+      const u64 key =
+          make_key(range_index, shaded ? renderable.m_shader_bits : 0,
+                   shaded ? renderable.m_material_bits : 0, vao, depth);
+
+      packets.push_back(DrawPacket{key, renderable.m_entity,
+                                   renderable.m_transform, renderable.m_mesh,
+                                   renderable.m_material});
+    }
+  }
+}
+
+void GLDrawList::sort() { radix_sort(p_packets, p_scratch); }
+
+u64 GLDrawList::make_key(u32 range_index, u32 shader_bits, u32 material_bits,
+                         u32 vao, u32 depth) {
+  return static_cast<u64>(range_index) << s_pass_shift |
+         (shader_bits & s_shader_mask) << s_shader_shift |
+         (material_bits & s_material_mask) << s_material_shift |
+         (vao & s_vao_mask) << s_vao_shift | (depth & s_depth_mask);
+}
+
+void GLDrawList::radix_sort(std::vector<DrawPacket> &packets,
+                            std::vector<DrawPacket> &scratch) {
+  ZoneScoped;
+  const u32 count = static_cast<u32>(packets.size());
+  scratch.resize(count);
+
+  // lsd radix sort, a byte every renderable shares is skipped
+  for (u32 shift = 0; shift < 64; shift += 8) {
+    std::array<u32, 256> offsets{};
+    for (const DrawPacket &packet : packets) {
+      offsets[(packet.m_key >> shift) & 0xFF]++;
+    }
+    if (count == 0 || offsets[(packets[0].m_key >> shift) & 0xFF] == count) {
+      continue;
+    }
+
+    u32 sum = 0;
+    for (u32 &offset : offsets) {
+      const u32 bucket = offset;
+      offset = sum;
+      sum += bucket;
+    }
+    for (const DrawPacket &packet : packets) {
+      scratch[offsets[(packet.m_key >> shift) & 0xFF]++] = packet;
+    }
+    packets.swap(scratch);
+  }
+}
+
+DrawRange GLDrawList::get_packets(DrawPass pass) {
+  return p_ranges[static_cast<u32>(pass)];
+}
+
+DrawRange GLDrawList::get_occluded_packets(DrawPass pass) {
+  return p_ranges[static_cast<u32>(pass) + s_pass_count];
+}
+} // namespace gem
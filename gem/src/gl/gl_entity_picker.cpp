@@ -0,0 +1,86 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_entity_picker.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/profile.h"
+
+namespace gem {
+
+void GLEntityPicker::init() {
+  ZoneScoped;
+  glAssert(glCreateBuffers(1, &p_buffer));
+  glAssert(glNamedBufferStorage(p_buffer, sizeof(u32) * s_ring_size, nullptr,
+                                GL_CLIENT_STORAGE_BIT));
+}
+
+void GLEntityPicker::cleanup() {
+  ZoneScoped;
+  for (Readback &readback : p_readbacks) {
+    if (readback.m_fence != nullptr) {
+      glDeleteSync(readback.m_fence);
+    }
+    readback = Readback{};
+  }
+  glDeleteBuffers(1, &p_buffer);
+  p_buffer = INVALID_GL_HANDLE;
+  p_queued.clear();
+  p_read = 0;
+  m_in_flight = 0;
+}
+
+void GLEntityPicker::request(glm::ivec2 pixel, Callback callback) {
+  p_queued.push_back(Request{pixel, std::move(callback)});
+}
+
+void GLEntityPicker::dispatch_readbacks(gl_handle entity_texture,
+                                        glm::ivec2 resolution) {
+  ZoneScoped;
+  if (p_queued.empty() || m_in_flight == s_ring_size) {
+    return;
+  }
+  GEM_GPU_MARKER("Entity Pick Readback");
+  glAssert(glBindBuffer(GL_PIXEL_PACK_BUFFER, p_buffer));
+  u32 dispatched = 0;
+  for (; dispatched < p_queued.size() && m_in_flight < s_ring_size;
+       dispatched++) {
+    Request &request = p_queued[dispatched];
+    const u32 slot = (p_read + m_in_flight) % s_ring_size;
+    const glm::ivec2 pixel =
+        glm::clamp(request.m_pixel, glm::ivec2(0), resolution - 1);
+    // offset into the bound pack buffer
+    glAssert(glGetTextureSubImage(
+        entity_texture, 0, pixel.x, pixel.y, 0, 1, 1, 1, GL_RED_INTEGER,
+        GL_UNSIGNED_INT, sizeof(u32),
+        reinterpret_cast<void *>(static_cast<uintptr_t>(slot * sizeof(u32)))));
+    Readback &readback = p_readbacks[slot];
+    readback.m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    readback.m_callback = std::move(request.m_callback);
+    m_in_flight++;
+  }
+  glAssert(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+  p_queued.erase(p_queued.begin(), p_queued.begin() + dispatched);
+}
+
+void GLEntityPicker::poll() {
+  ZoneScoped;
+  while (m_in_flight > 0) {
+    Readback &readback = p_readbacks[p_read];
+    const GLenum status = glClientWaitSync(readback.m_fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+      return;
+    }
+    glDeleteSync(readback.m_fence);
+    readback.m_fence = nullptr;
+
+    u32 id = 0;
+    glAssert(glGetNamedBufferSubData(p_buffer, p_read * sizeof(u32),
+                                     sizeof(u32), &id));
+    Callback callback = std::move(readback.m_callback);
+    readback.m_callback = nullptr;
+    p_read = (p_read + 1) % s_ring_size;
+    m_in_flight--;
+    if (callback) {
+      callback(static_cast<entt::entity>(id));
+    }
+  }
+}
+} // namespace gem
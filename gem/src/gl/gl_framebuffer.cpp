@@ -1,4 +1,5 @@
 #include "gem/gl/gl_framebuffer.h"
+#include "gem/gl/gl_state.h"
 #include "gem/profile.h"
 #include <iostream>
 
@@ -11,11 +12,12 @@ GLFramebuffer::GLFramebuffer() {
 
 void GLFramebuffer::unbind() {
   ZoneScoped;
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  GLState::bind_framebuffer(0);
 }
 
 void GLFramebuffer::cleanup() {
   ZoneScoped;
+  GLState::invalidate();
   glDeleteFramebuffers(1, &m_handle);
 }
 
@@ -33,6 +35,7 @@ void GLFramebuffer::add_colour_attachment(GLenum attachment_index,
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
   glBindTexture(GL_TEXTURE_2D, 0);
+  GLState::invalidate_texture_unit(0);
 
   glFramebufferTexture2D(GL_FRAMEBUFFER, attachment_index, GL_TEXTURE_2D,
                          textureColorbuffer, 0);
@@ -65,6 +68,7 @@ void GLFramebuffer::add_depth_attachment_sampler_friendly(uint32_t width,
   gl_handle depthMap;
   glGenTextures(1, &depthMap);
   glBindTexture(GL_TEXTURE_2D, depthMap);
+  GLState::invalidate_texture_unit(0);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, width, height, 0,
                GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -126,11 +130,39 @@ GLFramebuffer GLFramebuffer::create(glm::vec2 resolution,
   return fb;
 }
 
+void GLFramebuffer::replace_colour_attachment(u32 index, gl_handle texture) {
+  ZoneScoped;
+  glNamedFramebufferTexture(m_handle, GL_COLOR_ATTACHMENT0 + index, texture,
+                            0);
+  m_colour_attachments[index] = texture;
+}
+
 void GLFramebuffer::bind() {
   ZoneScoped;
   if (m_handle == INVALID_GL_HANDLE) {
     glGenFramebuffers(1, &m_handle);
   }
-  glBindFramebuffer(GL_FRAMEBUFFER, m_handle);
+  GLState::bind_framebuffer(m_handle);
+}
+
+GLHistoryFramebuffer GLHistoryFramebuffer::create(
+    glm::vec2 resolution,
+    std::vector<GLFramebuffer::attachment_info> colour_attachments,
+    bool add_depth) {
+  ZoneScoped;
+  GLHistoryFramebuffer history{};
+  for (GLFramebuffer &fb : history.m_framebuffers) {
+    fb = GLFramebuffer::create(resolution, colour_attachments, add_depth);
+  }
+  return history;
+}
+
+void GLHistoryFramebuffer::swap() { m_current ^= 1u; }
+
+void GLHistoryFramebuffer::cleanup() {
+  ZoneScoped;
+  for (GLFramebuffer &fb : m_framebuffers) {
+    fb.cleanup();
+  }
 }
 } // namespace gem
\ No newline at end of file
@@ -0,0 +1,182 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_gpu_profiler.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/profile.h"
+#include <algorithm>
+
+namespace gem {
+
+void GLGpuProfiler::begin_pass(const char *name) {
+  if (!s_frame_open) {
+    s_frame_open = true;
+    resolve_finished();
+    Frame &frame = s_frames[s_write];
+    s_recording = s_enabled && !frame.m_pending;
+    if (s_enabled && frame.m_pending) {
+      s_skipped_frames++;
+    }
+    if (s_recording) {
+      frame.m_count = 0;
+    }
+  }
+  if (!s_recording) {
+    return;
+  }
+  Frame &frame = s_frames[s_write];
+  if (frame.m_passes.size() <= frame.m_count) {
+    frame.m_passes.emplace_back();
+  }
+  frame.m_passes[frame.m_count] = get_pass(name);
+  timestamp(frame);
+}
+
+void GLGpuProfiler::end_frame() {
+  ZoneScoped;
+  Frame &frame = s_frames[s_write];
+  if (s_recording && frame.m_count > 0) {
+    timestamp(frame);
+    frame.m_pending = true;
+    s_write = (s_write + 1) % s_frames_in_flight;
+  }
+  s_frame_open = false;
+  s_recording = false;
+  resolve_finished();
+}
+
+void GLGpuProfiler::cleanup() {
+  ZoneScoped;
+  for (Frame &frame : s_frames) {
+    if (!frame.m_queries.empty()) {
+      glDeleteQueries(static_cast<GLsizei>(frame.m_queries.size()),
+                      frame.m_queries.data());
+    }
+    frame = Frame{};
+  }
+  s_read = 0;
+  s_write = 0;
+  s_frame_open = false;
+  s_recording = false;
+}
+
+bool GLGpuProfiler::was_measured(const PassTiming &pass) {
+  return s_resolved_frames > 0 && pass.m_last_frame == s_resolved_frames;
+}
+
+const GLGpuProfiler::PassTiming *GLGpuProfiler::find_pass(const char *name) {
+  for (const PassTiming &pass : s_passes) {
+    if (pass.m_name == name) {
+      return &pass;
+    }
+  }
+  return nullptr;
+}
+
+nlohmann::json GLGpuProfiler::to_json() {
+  ZoneScoped;
+  nlohmann::json passes = nlohmann::json::array();
+  for (const PassTiming &pass : s_passes) {
+    if (!was_measured(pass)) {
+      continue;
+    }
+    passes.push_back({{"name", pass.m_name},
+                      {"last_ms", pass.m_last_ms},
+                      {"smoothed_ms", pass.m_smoothed_ms},
+                      {"max_ms", pass.m_max_ms}});
+  }
+  return {{"frame_ms", s_frame_ms},
+          {"smoothed_frame_ms", s_smoothed_frame_ms},
+          {"frames", s_resolved_frames},
+          {"skipped_frames", s_skipped_frames},
+          {"passes", passes}};
+}
+
+void GLGpuProfiler::timestamp(Frame &frame) {
+  if (frame.m_queries.size() <= frame.m_count) {
+    gl_handle query = INVALID_GL_HANDLE;
+    glAssert(glCreateQueries(GL_TIMESTAMP, 1, &query));
+    frame.m_queries.push_back(query);
+  }
+  glAssert(glQueryCounter(frame.m_queries[frame.m_count], GL_TIMESTAMP));
+  frame.m_count++;
+}
+
+bool GLGpuProfiler::resolve(Frame &frame) {
+  ZoneScoped;
+  // timestamps complete in order, the last one landing means they all have
+  GLint available = GL_FALSE;
+  glGetQueryObjectiv(frame.m_queries[frame.m_count - 1],
+                     GL_QUERY_RESULT_AVAILABLE, &available);
+  if (available == GL_FALSE) {
+    return false;
+  }
+  frame.m_pending = false;
+
+  const u64 frame_id = s_resolved_frames + 1;
+  GLuint64 first = 0, previous = 0;
+  for (u32 i = 0; i < frame.m_count; i++) {
+    GLuint64 time = 0;
+    glGetQueryObjectui64v(frame.m_queries[i], GL_QUERY_RESULT, &time);
+    if (i == 0) {
+      first = time;
+    } else {
+      // a pass begun twice in a frame gets the sum
+      PassTiming &pass = s_passes[frame.m_passes[i - 1]];
+      if (pass.m_last_frame != frame_id) {
+        pass.m_last_frame = frame_id;
+        pass.m_last_ms = 0.0f;
+      }
+      pass.m_last_ms += static_cast<float>(time - previous) / 1000000.0f;
+    }
+    previous = time;
+  }
+
+  const u32 entry = s_history_offset;
+  for (PassTiming &pass : s_passes) {
+    const bool measured = pass.m_last_frame == frame_id;
+    pass.m_history[entry] = measured ? pass.m_last_ms : 0.0f;
+    if (measured) {
+      pass.m_smoothed_ms =
+          pass.m_smoothed_ms == 0.0f
+              ? pass.m_last_ms
+              : pass.m_smoothed_ms +
+                    (pass.m_last_ms - pass.m_smoothed_ms) * s_smoothing;
+    }
+    pass.m_max_ms =
+        *std::max_element(pass.m_history.begin(), pass.m_history.end());
+  }
+  s_frame_ms = static_cast<float>(previous - first) / 1000000.0f;
+  s_smoothed_frame_ms =
+      s_smoothed_frame_ms == 0.0f
+          ? s_frame_ms
+          : s_smoothed_frame_ms +
+                (s_frame_ms - s_smoothed_frame_ms) * s_smoothing;
+  s_frame_history[entry] = s_frame_ms;
+  s_history_offset = (entry + 1) % s_history_size;
+  s_resolved_frames = frame_id;
+  TracyPlot("GPU Frame (ms)", s_frame_ms);
+  return true;
+}
+
+void GLGpuProfiler::resolve_finished() {
+  ZoneScoped;
+  while (s_frames[s_read].m_pending && resolve(s_frames[s_read])) {
+    s_read = (s_read + 1) % s_frames_in_flight;
+  }
+}
+
+u32 GLGpuProfiler::get_pass(const char *name) {
+  const u32 count = static_cast<u32>(s_passes.size());
+  const u32 next = s_last_pass + 1;
+  if (next < count && s_passes[next].m_name == name) {
+    return s_last_pass = next;
+  }
+  for (u32 i = 0; i < count; i++) {
+    if (s_passes[i].m_name == name) {
+      return s_last_pass = i;
+    }
+  }
+  PassTiming &pass = s_passes.emplace_back();
+  pass.m_name = name;
+  return s_last_pass = count;
+}
+} // namespace gem
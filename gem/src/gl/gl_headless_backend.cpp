@@ -0,0 +1,254 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_headless_backend.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_state.h"
+#include "gem/profile.h"
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include "spdlog/spdlog.h"
+#include <cstring>
+
+#ifdef GEM_ENABLE_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace gem {
+
+GLHeadlessBackend::GLHeadlessBackend(u32 frame_limit)
+    : m_frame_limit(frame_limit) {}
+
+bool GLHeadlessBackend::create_context() {
+  ZoneScoped;
+#ifdef GEM_ENABLE_HEADLESS_EGL
+  EGLDisplay display = EGL_NO_DISPLAY;
+  // mesa's surfaceless platform needs neither a display server nor a GPU,
+  // anything else gets the default display
+  const char *client_extensions =
+      eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  if (client_extensions != nullptr &&
+      std::strstr(client_extensions, "EGL_MESA_platform_surfaceless")) {
+    auto get_platform_display =
+        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (get_platform_display != nullptr) {
+      display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+                                     EGL_DEFAULT_DISPLAY, nullptr);
+    }
+  }
+  if (display == EGL_NO_DISPLAY) {
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  EGLint major = 0, minor = 0;
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+    spdlog::error("headless backend : failed to initialize EGL : {:#x}",
+                  eglGetError());
+    return false;
+  }
+  p_display = display;
+  if (!eglBindAPI(EGL_OPENGL_API)) {
+    spdlog::error("headless backend : EGL has no desktop GL");
+    return false;
+  }
+
+  const EGLint config_attributes[] = {EGL_SURFACE_TYPE,
+                                      EGL_PBUFFER_BIT,
+                                      EGL_RENDERABLE_TYPE,
+                                      EGL_OPENGL_BIT,
+                                      EGL_NONE};
+  EGLConfig config = nullptr;
+  EGLint config_count = 0;
+  if (!eglChooseConfig(display, config_attributes, &config, 1,
+                       &config_count) ||
+      config_count == 0) {
+    spdlog::error("headless backend : no EGL config with desktop GL");
+    return false;
+  }
+
+  // the renderer needs 4.5 for DSA
+  const EGLint context_attributes[] = {EGL_CONTEXT_MAJOR_VERSION,
+                                       4,
+                                       EGL_CONTEXT_MINOR_VERSION,
+                                       5,
+                                       EGL_CONTEXT_OPENGL_PROFILE_MASK,
+                                       EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                                       EGL_NONE};
+  EGLContext context =
+      eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes);
+  if (context == EGL_NO_CONTEXT) {
+    spdlog::error("headless backend : failed to create a GL 4.5 context : "
+                  "{:#x}",
+                  eglGetError());
+    return false;
+  }
+  p_context = context;
+  // EGL_KHR_surfaceless_context, the offscreen framebuffer is the target
+  if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+    spdlog::error("headless backend : surfaceless contexts unsupported : "
+                  "{:#x}",
+                  eglGetError());
+    return false;
+  }
+  spdlog::info("headless backend : EGL {}.{}, {}", major, minor,
+               eglQueryString(display, EGL_VENDOR));
+  return true;
+#else
+  spdlog::error("headless backend : built without EGL");
+  return false;
+#endif
+}
+
+void GLHeadlessBackend::destroy_context() {
+  ZoneScoped;
+#ifdef GEM_ENABLE_HEADLESS_EGL
+  if (p_display == nullptr) {
+    return;
+  }
+  eglMakeCurrent(p_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+  if (p_context != nullptr) {
+    eglDestroyContext(p_display, p_context);
+  }
+  eglTerminate(p_display);
+#endif
+  p_display = nullptr;
+  p_context = nullptr;
+}
+
+bool GLHeadlessBackend::init(BackendInit &init_props) {
+  ZoneScoped;
+#ifdef GEM_ENABLE_MEMORY_TRACKING
+  DebugMemoryTracker::s_instance = new DebugMemoryTracker();
+#endif
+  m_resolution = glm::ivec2(init_props.window_resolution);
+  if (!create_context()) {
+    destroy_context();
+    return false;
+  }
+
+  glewExperimental = true;
+  // entry points come from the GL library the context belongs to, glewInit
+  // then fails to find a GLX display, which a headless run never has
+  const GLenum glew_result = glewInit();
+  if (glew_result != GLEW_OK && glew_result != GLEW_ERROR_NO_GLX_DISPLAY) {
+    spdlog::error("headless backend : GLEW init failed : {}",
+                  reinterpret_cast<const char *>(
+                      glewGetErrorString(glew_result)));
+    destroy_context();
+    return false;
+  }
+  spdlog::info("headless backend : {}",
+               reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+
+  glAssert(glCreateRenderbuffers(1, &m_colour));
+  glAssert(glNamedRenderbufferStorage(m_colour, GL_RGBA8, m_resolution.x,
+                                      m_resolution.y));
+  glAssert(glCreateRenderbuffers(1, &m_depth_stencil));
+  glAssert(glNamedRenderbufferStorage(m_depth_stencil, GL_DEPTH24_STENCIL8,
+                                      m_resolution.x, m_resolution.y));
+  glAssert(glCreateFramebuffers(1, &m_framebuffer));
+  glAssert(glNamedFramebufferRenderbuffer(
+      m_framebuffer, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colour));
+  glAssert(glNamedFramebufferRenderbuffer(m_framebuffer,
+                                          GL_DEPTH_STENCIL_ATTACHMENT,
+                                          GL_RENDERBUFFER, m_depth_stencil));
+  GLState::s_default_framebuffer = m_framebuffer;
+  GLState::invalidate();
+  GLState::bind_framebuffer(0);
+
+  init_gl_defaults();
+  init_imgui_context();
+  // no platform backend, ImGui is told the display size and time directly
+  m_imgui_io->DisplaySize =
+      ImVec2(static_cast<float>(m_resolution.x),
+             static_cast<float>(m_resolution.y));
+  m_imgui_io->IniFilename = nullptr;
+  ImGui_ImplOpenGL3_Init("#version 130");
+
+  m_now_counter = SDL_GetPerformanceCounter();
+  m_last_counter = 0;
+
+  init_built_in_assets();
+  init_imgui_file_dialog();
+  return true;
+}
+
+void GLHeadlessBackend::process_sdl_event() {
+  ZoneScoped;
+  // no window, no events
+}
+
+void GLHeadlessBackend::engine_pre_frame() {
+  ZoneScoped;
+  m_last_counter = m_now_counter;
+  m_now_counter = SDL_GetPerformanceCounter();
+  p_frametime =
+      static_cast<float>((m_now_counter - m_last_counter) /
+                         static_cast<float>(SDL_GetPerformanceFrequency()));
+  if (m_frame_count > 0) {
+    p_total_frametime += p_frametime;
+  }
+
+  GLState::bind_framebuffer(0);
+  glViewport(0, 0, m_resolution.x, m_resolution.y);
+  glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+  m_imgui_io->DeltaTime = p_frametime > 0.0f ? p_frametime : 1.0f / 60.0f;
+  ImGui_ImplOpenGL3_NewFrame();
+  ImGui::NewFrame();
+}
+
+void GLHeadlessBackend::engine_post_frame() {
+  ZoneScoped;
+  {
+    GEM_GPU_MARKER("ImGui");
+    ImGui::Render();
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    // no swap to submit the frame
+    glFlush();
+  }
+
+  m_frame_count++;
+  if (m_frame_limit > 0 && m_frame_count >= m_frame_limit) {
+    m_quit = true;
+  }
+}
+
+void GLHeadlessBackend::engine_shut_down() {
+  ZoneScoped;
+  if (m_frame_count > 1) {
+    spdlog::info("headless backend : {} frames, {:.3f} ms average",
+                 m_frame_count,
+                 p_total_frametime * 1000.0f /
+                     static_cast<float>(m_frame_count - 1));
+  }
+  if (m_imgui_io != nullptr) {
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui::DestroyContext();
+    m_imgui_io = nullptr;
+  }
+  if (p_context != nullptr) {
+    glDeleteFramebuffers(1, &m_framebuffer);
+    glDeleteRenderbuffers(1, &m_colour);
+    glDeleteRenderbuffers(1, &m_depth_stencil);
+  }
+  GLState::s_default_framebuffer = 0;
+  GLState::invalidate();
+  destroy_context();
+}
+
+glm::vec2 GLHeadlessBackend::get_window_dim() {
+  ZoneScoped;
+  return glm::vec2(m_resolution);
+}
+
+void GLHeadlessBackend::read_colour(std::vector<u8> &rgba) {
+  ZoneScoped;
+  rgba.resize(static_cast<size_t>(m_resolution.x) * m_resolution.y * 4);
+  glAssert(glNamedFramebufferReadBuffer(m_framebuffer, GL_COLOR_ATTACHMENT0));
+  GLState::bind_framebuffer(0);
+  glAssert(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+  glAssert(glReadPixels(0, 0, m_resolution.x, m_resolution.y, GL_RGBA,
+                        GL_UNSIGNED_BYTE, rgba.data()));
+}
+} // namespace gem
@@ -0,0 +1,294 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_indirect_draws.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_material_table.h"
+#include "gem/gl/gl_shader.h"
+#include "gem/gl/gl_state.h"
+#include "gem/gl/gl_texture_streamer.h"
+#include "gem/material.h"
+#include "gem/mesh.h"
+#include "gem/profile.h"
+#include "gem/texture.h"
+#include "gem/transform.h"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <string>
+
+namespace gem {
+
+bool GLIndirectDraws::is_supported() {
+  return GLEW_ARB_indirect_parameters && GLEW_ARB_shader_draw_parameters;
+}
+
+void GLIndirectDraws::init() {
+  ZoneScoped;
+  spdlog::info("indirect draws : {}",
+               is_supported() ? "multi draw indirect count"
+                              : "unavailable, drawing per packet");
+  reserve(256, 16);
+}
+
+void GLIndirectDraws::cleanup() {
+  ZoneScoped;
+  if (p_stats_fence != nullptr) {
+    glDeleteSync(p_stats_fence);
+    p_stats_fence = nullptr;
+  }
+  for (gl_handle *buffer :
+       {&p_object_ssbo, &p_command_buffer, &p_count_buffer,
+        &p_cull_state_buffer, &p_stats_readback}) {
+    if (*buffer != INVALID_GL_HANDLE) {
+      glDeleteBuffers(1, buffer);
+      *buffer = INVALID_GL_HANDLE;
+    }
+  }
+  p_object_capacity = 0;
+  p_batch_capacity = 0;
+  p_objects.clear();
+  p_batches.clear();
+  p_batch_lookup.clear();
+}
+
+void GLIndirectDraws::reserve(u32 object_count, u32 batch_count) {
+  ZoneScoped;
+  if (object_count > p_object_capacity) {
+    p_object_capacity = std::max(object_count, p_object_capacity * 2);
+    for (gl_handle *buffer :
+         {&p_object_ssbo, &p_command_buffer, &p_cull_state_buffer}) {
+      if (*buffer != INVALID_GL_HANDLE) {
+        glDeleteBuffers(1, buffer);
+      }
+      glAssert(glCreateBuffers(1, buffer));
+    }
+    glAssert(glNamedBufferData(p_object_ssbo,
+                               sizeof(GPUObject) * p_object_capacity, nullptr,
+                               GL_DYNAMIC_DRAW));
+    // only written by the cull shader, at most one command per object and
+    // phase
+    glAssert(glNamedBufferData(
+        p_command_buffer,
+        sizeof(GPUCommand) * p_object_capacity *
+            static_cast<u32>(CullPhase::count),
+        nullptr, GL_DYNAMIC_COPY));
+    glAssert(glNamedBufferData(p_cull_state_buffer,
+                               sizeof(CullStats) +
+                                   sizeof(u32) * p_object_capacity,
+                               nullptr, GL_DYNAMIC_COPY));
+  }
+  if (batch_count > p_batch_capacity) {
+    p_batch_capacity = std::max(batch_count, p_batch_capacity * 2);
+    if (p_count_buffer != INVALID_GL_HANDLE) {
+      glDeleteBuffers(1, &p_count_buffer);
+    }
+    glAssert(glCreateBuffers(1, &p_count_buffer));
+    glAssert(glNamedBufferData(p_count_buffer,
+                               sizeof(u32) * p_batch_capacity *
+                                   static_cast<u32>(CullPhase::count),
+                               nullptr, GL_DYNAMIC_COPY));
+  }
+  if (p_stats_readback == INVALID_GL_HANDLE) {
+    glAssert(glCreateBuffers(1, &p_stats_readback));
+    glAssert(glNamedBufferStorage(p_stats_readback, sizeof(CullStats), nullptr,
+                                  GL_CLIENT_STORAGE_BIT));
+  }
+}
+
+void GLIndirectDraws::poll_stats() {
+  ZoneScoped;
+  if (p_stats_fence == nullptr) {
+    return;
+  }
+  const GLenum status = glClientWaitSync(p_stats_fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+    return;
+  }
+  glDeleteSync(p_stats_fence);
+  p_stats_fence = nullptr;
+
+  CullStats stats{};
+  glAssert(glGetNamedBufferSubData(p_stats_readback, 0, sizeof(CullStats),
+                                   &stats));
+  m_frustum_culled = stats.m_frustum_culled;
+  m_occluded = stats.m_occluded - stats.m_disoccluded;
+  m_disoccluded = stats.m_disoccluded;
+}
+
+void GLIndirectDraws::build(DrawRange draws, GLMaterialTable &material_table) {
+  ZoneScoped;
+  p_objects.clear();
+  p_batches.clear();
+  p_batch_lookup.clear();
+  poll_stats();
+
+  // count objects per vao first so each batch gets a contiguous command range
+  std::vector<u32> packet_batches{};
+  packet_batches.reserve(draws.m_count);
+  for (DrawPacket &packet : draws) {
+    const VAO &vao = packet.m_mesh->m_mesh.m_vao;
+    if (vao.m_ibo == INVALID_GL_HANDLE || vao.m_index_count == 0) {
+      packet_batches.push_back(UINT32_MAX);
+      continue;
+    }
+    auto it = p_batch_lookup.find(vao.m_vao_id);
+    if (it == p_batch_lookup.end()) {
+      it = p_batch_lookup
+               .emplace(vao.m_vao_id, static_cast<u32>(p_batches.size()))
+               .first;
+      p_batches.push_back(Batch{vao.m_vao_id, 0, 0});
+    }
+    p_batches[it->second].m_command_count++;
+    packet_batches.push_back(it->second);
+  }
+
+  u32 first_command = 0;
+  for (Batch &batch : p_batches) {
+    batch.m_first_command = first_command;
+    first_command += batch.m_command_count;
+  }
+
+  u32 packet_index = 0;
+  for (DrawPacket &packet : draws) {
+    const u32 batch = packet_batches[packet_index++];
+    if (batch == UINT32_MAX) {
+      continue;
+    }
+    Material &ematerial = *packet.m_material;
+    Transform &trans = *packet.m_transform;
+    const Mesh &mesh = packet.m_mesh->m_mesh;
+
+    const i32 material_index = material_table.get_material_index(ematerial);
+    const auto &material_textures = material_table.get_textures(material_index);
+    const i32 feedback_slot = GLTextureStreamer::add_feedback_draw(
+        material_textures.data(), static_cast<u32>(material_textures.size()));
+
+    glm::vec3 centre{}, extent{};
+    FrustumCuller::get_world_bounds(mesh.m_original_aabb, trans.m_model,
+                                    centre, extent);
+
+    GPUObject object{};
+    object.m_model = trans.m_model;
+    object.m_last_model = trans.m_last_model;
+    object.m_normal = trans.m_normal_matrix;
+    object.m_ids = glm::ivec4(static_cast<int>(packet.m_entity),
+                              material_index, feedback_slot, 0);
+    object.m_bounds_centre = glm::vec4(centre, 1.0f);
+    object.m_bounds_extent = glm::vec4(extent, 0.0f);
+    object.m_draw = glm::uvec4(mesh.m_vao.m_index_count,
+                               mesh.m_vao.m_index_offset, batch,
+                               p_batches[batch].m_first_command);
+    p_objects.push_back(object);
+  }
+
+  m_object_count = static_cast<u32>(p_objects.size());
+  m_batch_count = static_cast<u32>(p_batches.size());
+  reserve(m_object_count, m_batch_count);
+  if (!p_objects.empty()) {
+    glAssert(glNamedBufferSubData(p_object_ssbo, 0,
+                                  sizeof(GPUObject) * p_objects.size(),
+                                  p_objects.data()));
+  }
+}
+
+void GLIndirectDraws::dispatch_cull(
+    GLShader &cull_shader, const std::array<glm::vec4, 6> &planes,
+    CullPhase phase, const open_gl::tech::HiZ::Pyramid *occluders) {
+  ZoneScoped;
+  GEM_GPU_MARKER(phase == CullPhase::first ? "GPU Cull" : "GPU Cull Phase 2");
+  if (m_object_count == 0) {
+    return;
+  }
+  const bool occlusion = occluders != nullptr && occluders->m_valid;
+  if (phase == CullPhase::first) {
+    p_occlusion_culled = occlusion;
+    const u32 zero = 0;
+    glAssert(glClearNamedBufferData(p_count_buffer, GL_R32UI, GL_RED_INTEGER,
+                                    GL_UNSIGNED_INT, &zero));
+    glAssert(glClearNamedBufferSubData(p_cull_state_buffer, GL_R32UI, 0,
+                                       sizeof(CullStats), GL_RED_INTEGER,
+                                       GL_UNSIGNED_INT, &zero));
+  } else if (!occlusion || !p_occlusion_culled) {
+    return;
+  }
+
+  const u32 phase_index = static_cast<u32>(phase);
+  cull_shader.use();
+  cull_shader.set_uint("u_object_count", m_object_count);
+  cull_shader.set_int("u_phase", static_cast<int>(phase_index));
+  cull_shader.set_uint("u_command_offset", p_object_capacity * phase_index);
+  cull_shader.set_uint("u_count_offset", p_batch_capacity * phase_index);
+  // element names are hashed once rather than built per dispatch
+  static const std::array<HashString, 6> s_plane_names = [] {
+    std::array<HashString, 6> names{};
+    for (u32 i = 0; i < names.size(); i++) {
+      names[i] = HashString("u_planes[" + std::to_string(i) + "]");
+    }
+    return names;
+  }();
+  for (u32 i = 0; i < planes.size(); i++) {
+    cull_shader.set_vec4(s_plane_names[i], planes[i]);
+  }
+  cull_shader.set_int("u_occlusion", occlusion ? 1 : 0);
+  if (occlusion) {
+    cull_shader.set_int("u_hiz", 0);
+    cull_shader.set_mat4("u_hiz_vp", occluders->m_view_proj);
+    cull_shader.set_ivec2("u_hiz_depth_size", occluders->m_depth_resolution);
+    cull_shader.set_int("u_hiz_levels", static_cast<int>(occluders->m_levels));
+    Texture::bind_sampler_handle(occluders->m_texture, GL_TEXTURE0);
+  }
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_object_binding,
+                            p_object_ssbo));
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_command_binding,
+                            p_command_buffer));
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_count_binding,
+                            p_count_buffer));
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_cull_state_binding,
+                            p_cull_state_buffer));
+  glAssert(glDispatchCompute(
+      (m_object_count + s_cull_group_size - 1) / s_cull_group_size, 1, 1));
+  // commands and counts are consumed as indirect / parameter buffers
+  glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+  if (occlusion) {
+    Texture::bind_sampler_handle(0, GL_TEXTURE0);
+  }
+}
+
+void GLIndirectDraws::draw(CullPhase phase) {
+  ZoneScoped;
+  // nothing was held back for the second phase
+  if (m_object_count == 0 ||
+      (phase == CullPhase::second && !p_occlusion_culled)) {
+    return;
+  }
+  const u32 phase_index = static_cast<u32>(phase);
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_object_binding,
+                            p_object_ssbo));
+  glAssert(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, p_command_buffer));
+  glAssert(glBindBuffer(GL_PARAMETER_BUFFER_ARB, p_count_buffer));
+  for (u32 i = 0; i < p_batches.size(); i++) {
+    const Batch &batch = p_batches[i];
+    const u32 first_command =
+        p_object_capacity * phase_index + batch.m_first_command;
+    GLState::bind_vertex_array(batch.m_vao);
+    glAssert(glMultiDrawElementsIndirectCountARB(
+        GL_TRIANGLES, GL_UNSIGNED_INT,
+        reinterpret_cast<const void *>(
+            static_cast<uintptr_t>(sizeof(GPUCommand) * first_command)),
+        static_cast<GLintptr>(sizeof(u32) *
+                              (p_batch_capacity * phase_index + i)),
+        static_cast<GLsizei>(batch.m_command_count), sizeof(GPUCommand)));
+  }
+  glAssert(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0));
+  glAssert(glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0));
+}
+
+void GLIndirectDraws::request_stats() {
+  ZoneScoped;
+  if (m_object_count == 0 || p_stats_fence != nullptr) {
+    return;
+  }
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+  glAssert(glCopyNamedBufferSubData(p_cull_state_buffer, p_stats_readback, 0,
+                                    0, sizeof(CullStats)));
+  p_stats_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+} // namespace gem
@@ -0,0 +1,399 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_material_table.h"
+#include "gem/asset_definitions.h"
+#include "gem/asset_manager.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_shader.h"
+#include "gem/material.h"
+#include "gem/profile.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace gem {
+
+void GLMaterialTable::init() {
+  ZoneScoped;
+  m_bindless = GLEW_ARB_bindless_texture;
+  spdlog::info("material table : using {}",
+               m_bindless ? "bindless textures" : "texture arrays");
+  p_table_capacity = 0;
+  p_table_dirty = true;
+}
+
+void GLMaterialTable::cleanup() {
+  ZoneScoped;
+  // runs at shutdown, sources are either deleted or about to be along with
+  // their handles
+  for (auto &[texture, record] : p_records) {
+    release_record(record, false);
+  }
+  p_records.clear();
+  for (auto &group : p_groups) {
+    if (group.m_handle != INVALID_GL_HANDLE) {
+      glDeleteTextures(1, &group.m_handle);
+    }
+  }
+  p_groups.clear();
+  if (p_table_ssbo != INVALID_GL_HANDLE) {
+    glDeleteBuffers(1, &p_table_ssbo);
+    p_table_ssbo = INVALID_GL_HANDLE;
+  }
+  p_entries.clear();
+  p_gpu_entries.clear();
+  p_entry_lookup.clear();
+}
+
+i32 GLMaterialTable::get_material_index(Material &material) {
+  ZoneScoped;
+  MaterialInstance &instance = *material.m_instance;
+  if (instance.m_texture_table_index >= 0 &&
+      instance.m_texture_table_index < static_cast<i32>(p_entries.size())) {
+    return instance.m_texture_table_index;
+  }
+
+  Entry entry{};
+  entry.m_textures.fill(nullptr);
+  std::array<u64, s_map_count> key{};
+  for (auto &sampler : instance.m_samplers) {
+    const TextureEntry &tex_entry = sampler.m_entry;
+    const u32 slot = static_cast<u32>(tex_entry.m_map_type);
+    if (tex_entry.m_handle.m_path_hash.m_value == 0 || slot >= s_map_count) {
+      continue;
+    }
+    entry.m_handles[slot] = tex_entry.m_handle;
+    entry.m_textures[slot] = tex_entry.m_texture;
+    key[slot] = tex_entry.m_handle.m_path_hash.m_value;
+  }
+
+  // materials sharing a texture set share a table entry
+  auto it = p_entry_lookup.find(key);
+  if (it != p_entry_lookup.end()) {
+    instance.m_texture_table_index = it->second;
+    return it->second;
+  }
+
+  const i32 index = static_cast<i32>(p_entries.size());
+  p_entries.push_back(entry);
+
+  GPUEntry gpu_entry{};
+  gpu_entry.m_handles.fill(0);
+  gpu_entry.m_layers.fill(glm::ivec2(-1));
+  gpu_entry.m_lods.fill(glm::ivec2(0));
+  p_gpu_entries.push_back(gpu_entry);
+
+  p_entry_lookup.emplace(key, index);
+  instance.m_texture_table_index = index;
+  m_material_count = static_cast<u32>(p_entries.size());
+  p_table_dirty = true;
+  // make sure the new index is addressable by this frame's draws
+  upload_table();
+  return index;
+}
+
+const std::array<Texture *, GLMaterialTable::s_map_count> &
+GLMaterialTable::get_textures(i32 material_index) {
+  return p_entries[material_index].m_textures;
+}
+
+void GLMaterialTable::update(AssetManager &am) {
+  ZoneScoped;
+  for (auto &[texture, record] : p_records) {
+    record.m_referenced = false;
+  }
+
+  for (u32 i = 0; i < p_entries.size(); i++) {
+    Entry &entry = p_entries[i];
+    GPUEntry gpu_entry{};
+    gpu_entry.m_handles.fill(0);
+    gpu_entry.m_layers.fill(glm::ivec2(-1));
+    gpu_entry.m_lods.fill(glm::ivec2(0));
+
+    for (u32 slot = 0; slot < s_map_count; slot++) {
+      if (entry.m_handles[slot].m_path_hash.m_value == 0) {
+        continue;
+      }
+      // textures load asynchronously and can be unloaded, resolve every frame
+      TextureAsset *ta =
+          am.get_asset<Texture, AssetType::texture>(entry.m_handles[slot]);
+      Texture *texture = ta ? &ta->m_data : nullptr;
+      entry.m_textures[slot] = texture;
+      if (texture == nullptr || texture->m_handle == INVALID_GL_HANDLE) {
+        continue;
+      }
+
+      TextureRecord &record = p_records[texture];
+      if (record.m_source != texture->m_handle) {
+        refresh_record(texture, record);
+      } else if (record.m_lods.x != texture->get_resident_level()) {
+        sync_resident_level(texture, record);
+      }
+      record.m_asset = entry.m_handles[slot];
+      record.m_referenced = true;
+      gpu_entry.m_handles[slot] = record.m_bindless_handle;
+      gpu_entry.m_layers[slot] = glm::ivec2(record.m_array, record.m_layer);
+      gpu_entry.m_lods[slot] = record.m_lods;
+    }
+
+    if (std::memcmp(&gpu_entry, &p_gpu_entries[i], sizeof(GPUEntry)) != 0) {
+      p_gpu_entries[i] = gpu_entry;
+      p_table_dirty = true;
+    }
+  }
+
+  for (auto it = p_records.begin(); it != p_records.end();) {
+    if (!it->second.m_referenced) {
+      // the texture may have been unloaded, only trust the pointer while the
+      // asset still resolves to it
+      TextureAsset *ta = am.get_asset<Texture, AssetType::texture>(
+          it->second.m_asset);
+      const bool source_alive = ta != nullptr && &ta->m_data == it->first &&
+                                it->first->m_handle == it->second.m_source;
+      release_record(it->second, source_alive);
+      it = p_records.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  m_texture_count = static_cast<u32>(p_records.size());
+  free_empty_groups();
+
+  if (p_table_dirty) {
+    upload_table();
+  }
+}
+
+void GLMaterialTable::bind(GLShader &shader) {
+  ZoneScoped;
+  if (p_table_ssbo == INVALID_GL_HANDLE) {
+    upload_table();
+  }
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_table_binding,
+                            p_table_ssbo));
+  shader.set_int("u_bindless_materials", m_bindless ? 1 : 0);
+  if (m_bindless) {
+    return;
+  }
+
+  // element names are hashed once rather than built per bind
+  static const std::array<HashString, s_max_texture_arrays> s_array_names = [] {
+    std::array<HashString, s_max_texture_arrays> names{};
+    for (u32 i = 0; i < s_max_texture_arrays; i++) {
+      names[i] = HashString("u_material_arrays[" + std::to_string(i) + "]");
+    }
+    return names;
+  }();
+
+  for (u32 i = 0; i < s_max_texture_arrays; i++) {
+    const GLenum unit = GL_TEXTURE0 + s_first_array_unit + i;
+    shader.set_int(s_array_names[i], static_cast<int>(s_first_array_unit + i));
+    if (i < p_groups.size() && p_groups[i].m_handle != INVALID_GL_HANDLE) {
+      Texture::bind_sampler_handle(p_groups[i].m_handle, unit);
+    }
+  }
+}
+
+void GLMaterialTable::refresh_record(Texture *texture,
+                                     TextureRecord &record) {
+  ZoneScoped;
+  // the old source texture was replaced (e.g. reloaded) and deleted along
+  // with its bindless handle, only array layers need releasing
+  release_record(record, false);
+  record.m_source = texture->m_handle;
+
+  GLint width = 0;
+  GLint height = 0;
+  GLint format = 0;
+  GLint levels = 0;
+  glGetTextureLevelParameteriv(texture->m_handle, 0, GL_TEXTURE_WIDTH, &width);
+  glGetTextureLevelParameteriv(texture->m_handle, 0, GL_TEXTURE_HEIGHT,
+                               &height);
+  glGetTextureLevelParameteriv(texture->m_handle, 0,
+                               GL_TEXTURE_INTERNAL_FORMAT, &format);
+  glGetTextureParameteriv(texture->m_handle, GL_TEXTURE_IMMUTABLE_LEVELS,
+                          &levels);
+  const i32 full_levels =
+      static_cast<i32>(std::floor(std::log2(std::max(width, height)))) + 1;
+  if (levels == 0) {
+    // mutable texture with a full chain (e.g. glGenerateMipmap)
+    levels = full_levels;
+  }
+  levels = std::min<i32>(levels, full_levels);
+  record.m_lods = glm::ivec2(texture->get_resident_level(), levels - 1);
+
+  if (m_bindless) {
+    // texture parameters can't change once a handle exists
+    texture->freeze_stream_lod();
+    record.m_bindless_handle = glGetTextureHandleARB(texture->m_handle);
+    glAssert(glMakeTextureHandleResidentARB(record.m_bindless_handle));
+    return;
+  }
+
+  const i32 group_index =
+      find_or_create_group(width, height, static_cast<GLenum>(format));
+  if (group_index < 0) {
+    return;
+  }
+
+  ArrayGroup &group = p_groups[group_index];
+  i32 layer = -1;
+  if (!group.m_free_layers.empty()) {
+    layer = group.m_free_layers.back();
+    group.m_free_layers.pop_back();
+  } else {
+    if (group.m_next_layer == group.m_capacity) {
+      grow_group(group);
+    }
+    layer = group.m_next_layer++;
+  }
+
+  // levels outside m_lods keep stale data and are never sampled
+  for (i32 level = record.m_lods.x; level < levels; level++) {
+    glAssert(glCopyImageSubData(
+        texture->m_handle, GL_TEXTURE_2D, level, 0, 0, 0, group.m_handle,
+        GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, std::max(1, width >> level),
+        std::max(1, height >> level), 1));
+  }
+  record.m_array = group_index;
+  record.m_layer = layer;
+}
+
+void GLMaterialTable::sync_resident_level(Texture *texture,
+                                          TextureRecord &record) {
+  ZoneScoped;
+  const i32 resident_level = texture->get_resident_level();
+  if (record.m_array >= 0 && resident_level < record.m_lods.x) {
+    const ArrayGroup &group = p_groups[record.m_array];
+    for (i32 level = resident_level; level < record.m_lods.x; level++) {
+      glAssert(glCopyImageSubData(
+          texture->m_handle, GL_TEXTURE_2D, level, 0, 0, 0, group.m_handle,
+          GL_TEXTURE_2D_ARRAY, level, 0, 0, record.m_layer,
+          std::max(1, group.m_width >> level),
+          std::max(1, group.m_height >> level), 1));
+    }
+  }
+  // evicted levels just stop being sampled
+  record.m_lods.x = resident_level;
+}
+
+void GLMaterialTable::release_record(TextureRecord &record,
+                                     bool source_alive) {
+  if (record.m_bindless_handle != 0 && source_alive) {
+    glAssert(glMakeTextureHandleNonResidentARB(record.m_bindless_handle));
+  }
+  if (record.m_array >= 0) {
+    p_groups[record.m_array].m_free_layers.push_back(record.m_layer);
+  }
+  record.m_source = INVALID_GL_HANDLE;
+  record.m_bindless_handle = 0;
+  record.m_array = -1;
+  record.m_layer = -1;
+  record.m_lods = glm::ivec2(0);
+}
+
+i32 GLMaterialTable::find_or_create_group(i32 width, i32 height,
+                                          GLenum format) {
+  i32 free_slot = -1;
+  for (u32 i = 0; i < p_groups.size(); i++) {
+    ArrayGroup &group = p_groups[i];
+    if (group.m_handle == INVALID_GL_HANDLE) {
+      free_slot = free_slot < 0 ? static_cast<i32>(i) : free_slot;
+      continue;
+    }
+    if (group.m_width == width && group.m_height == height &&
+        group.m_format == format) {
+      return static_cast<i32>(i);
+    }
+  }
+
+  if (free_slot < 0 && p_groups.size() == s_max_texture_arrays) {
+    spdlog::error("material table : out of texture arrays for {}x{} format {}",
+                  width, height, format);
+    return -1;
+  }
+
+  ArrayGroup group{};
+  group.m_width = width;
+  group.m_height = height;
+  // the full chain so textures with any level count share the group
+  group.m_levels =
+      static_cast<i32>(std::floor(std::log2(std::max(width, height)))) + 1;
+  group.m_format = format;
+  grow_group(group);
+  if (free_slot >= 0) {
+    p_groups[free_slot] = std::move(group);
+    return free_slot;
+  }
+  p_groups.push_back(std::move(group));
+  return static_cast<i32>(p_groups.size() - 1);
+}
+
+void GLMaterialTable::grow_group(ArrayGroup &group) {
+  ZoneScoped;
+  const i32 capacity = std::max(4, group.m_capacity * 2);
+  gl_handle handle = INVALID_GL_HANDLE;
+  glAssert(glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &handle));
+  glAssert(glTextureParameteri(handle, GL_TEXTURE_WRAP_S, GL_REPEAT));
+  glAssert(glTextureParameteri(handle, GL_TEXTURE_WRAP_T, GL_REPEAT));
+  glAssert(glTextureParameteri(handle, GL_TEXTURE_MIN_FILTER,
+                               GL_LINEAR_MIPMAP_LINEAR));
+  glAssert(glTextureParameteri(handle, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+  glAssert(glTextureStorage3D(handle, group.m_levels, group.m_format,
+                              group.m_width, group.m_height, capacity));
+
+  if (group.m_handle != INVALID_GL_HANDLE) {
+    for (i32 level = 0; level < group.m_levels; level++) {
+      glAssert(glCopyImageSubData(
+          group.m_handle, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, handle,
+          GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+          std::max(1, group.m_width >> level),
+          std::max(1, group.m_height >> level), group.m_capacity));
+    }
+    glDeleteTextures(1, &group.m_handle);
+  }
+  group.m_handle = handle;
+  group.m_capacity = capacity;
+}
+
+void GLMaterialTable::free_empty_groups() {
+  ZoneScoped;
+  // slots stay in place, live records index groups by position
+  for (ArrayGroup &group : p_groups) {
+    if (group.m_handle == INVALID_GL_HANDLE ||
+        static_cast<i32>(group.m_free_layers.size()) != group.m_next_layer) {
+      continue;
+    }
+    glDeleteTextures(1, &group.m_handle);
+    group = ArrayGroup{};
+  }
+  while (!p_groups.empty() && p_groups.back().m_handle == INVALID_GL_HANDLE) {
+    p_groups.pop_back();
+  }
+}
+
+void GLMaterialTable::upload_table() {
+  ZoneScoped;
+  const u32 count = std::max<u32>(1, static_cast<u32>(p_gpu_entries.size()));
+  if (p_table_ssbo == INVALID_GL_HANDLE || count > p_table_capacity) {
+    if (p_table_ssbo != INVALID_GL_HANDLE) {
+      glDeleteBuffers(1, &p_table_ssbo);
+    }
+    p_table_capacity = std::max(count, p_table_capacity * 2);
+    glAssert(glCreateBuffers(1, &p_table_ssbo));
+    glAssert(glNamedBufferData(p_table_ssbo,
+                               sizeof(GPUEntry) * p_table_capacity, nullptr,
+                               GL_DYNAMIC_DRAW));
+    // may be mid pass, keep the binding pointing at the live buffer
+    glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_table_binding,
+                              p_table_ssbo));
+  }
+  if (!p_gpu_entries.empty()) {
+    glAssert(glNamedBufferSubData(p_table_ssbo, 0,
+                                  sizeof(GPUEntry) * p_gpu_entries.size(),
+                                  p_gpu_entries.data()));
+  }
+  p_table_dirty = false;
+}
+} // namespace gem
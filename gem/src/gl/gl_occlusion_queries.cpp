@@ -0,0 +1,86 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_occlusion_queries.h"
+#include "gem/culling.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_shader.h"
+#include "gem/gl/gl_state.h"
+#include "gem/mesh.h"
+#include "gem/profile.h"
+#include "gem/shape.h"
+#include "gem/transform.h"
+
+namespace gem {
+
+void GLOcclusionQueries::cleanup() {
+  ZoneScoped;
+  if (!p_queries.empty()) {
+    glDeleteQueries(static_cast<GLsizei>(p_queries.size()), p_queries.data());
+  }
+  p_queries.clear();
+  p_tested.clear();
+  m_query_count = 0;
+}
+
+void GLOcclusionQueries::dispatch_proxies(GLShader &proxy_shader,
+                                          DrawRange draws,
+                                          glm::vec3 view_position) {
+  ZoneScoped;
+  GEM_GPU_MARKER("Occlusion Proxies");
+  m_query_count = 0;
+  if (draws.m_count == 0) {
+    return;
+  }
+  if (p_queries.size() < draws.m_count) {
+    const size_t first = p_queries.size();
+    p_queries.resize(draws.m_count);
+    glAssert(glCreateQueries(GL_ANY_SAMPLES_PASSED_CONSERVATIVE,
+                             static_cast<GLsizei>(draws.m_count - first),
+                             p_queries.data() + first));
+  }
+  p_tested.assign(draws.m_count, 0);
+
+  proxy_shader.use();
+  GLState::bind_vertex_array(Shapes::s_cube_pos_only.m_vao_id);
+  GLState::set_enabled(GL_CULL_FACE, false);
+  glDepthMask(GL_FALSE);
+  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  glDepthFunc(GL_LEQUAL);
+
+  u32 index = 0;
+  for (DrawPacket &packet : draws) {
+    glm::vec3 centre{}, extent{};
+    FrustumCuller::get_world_bounds(packet.m_mesh->m_mesh.m_original_aabb,
+                                    packet.m_transform->m_model, centre,
+                                    extent);
+    // the near plane would clip the faces in front of the camera
+    const glm::vec3 offset = glm::abs(view_position - centre);
+    if (glm::all(glm::lessThanEqual(offset, extent + 0.1f))) {
+      index++;
+      continue;
+    }
+    proxy_shader.set_vec3("u_bounds_centre", centre);
+    proxy_shader.set_vec3("u_bounds_extent", extent);
+    glBeginQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE, p_queries[index]);
+    Shapes::s_cube_pos_only.draw();
+    glEndQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE);
+    p_tested[index++] = 1;
+    m_query_count++;
+  }
+
+  glDepthFunc(GL_LESS);
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+  glDepthMask(GL_TRUE);
+}
+
+void GLOcclusionQueries::begin_conditional(u32 index) {
+  if (p_tested[index]) {
+    glBeginConditionalRender(p_queries[index], GL_QUERY_BY_REGION_WAIT);
+  }
+}
+
+void GLOcclusionQueries::end_conditional(u32 index) {
+  if (p_tested[index]) {
+    glEndConditionalRender();
+  }
+}
+} // namespace gem
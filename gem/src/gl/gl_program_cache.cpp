@@ -0,0 +1,125 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_program_cache.h"
+#include "gem/hash_string.h"
+#include "gem/profile.h"
+#include "gem/utils.h"
+#include <cstring>
+#include <filesystem>
+
+namespace gem {
+
+const std::string &GLProgramCache::get_driver_id() {
+  static std::string s_driver_id;
+  if (s_driver_id.empty()) {
+    auto get = [](GLenum name) {
+      const GLubyte *str = glGetString(name);
+      return str ? std::string(reinterpret_cast<const char *>(str))
+                 : std::string();
+    };
+    s_driver_id = get(GL_VENDOR) + "|" + get(GL_RENDERER) + "|" +
+                  get(GL_VERSION);
+  }
+  return s_driver_id;
+}
+
+bool GLProgramCache::is_supported() {
+  static i32 s_binary_formats = -1;
+  if (s_binary_formats < 0) {
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    s_binary_formats = formats;
+  }
+  return s_enabled && s_binary_formats > 0;
+}
+
+std::string GLProgramCache::get_path(u64 key) {
+  return fmt::format("{}/{:016x}.bin", s_cache_directory, key);
+}
+
+u64 GLProgramCache::get_key(const std::string &source) {
+  ZoneScoped;
+  return HashUtils::get_string_hash(get_driver_id() + "\n" + source);
+}
+
+gl_handle GLProgramCache::load(u64 key) {
+  ZoneScoped;
+  if (!is_supported()) {
+    return INVALID_GL_HANDLE;
+  }
+
+  const std::string path = get_path(key);
+  if (!std::filesystem::exists(path)) {
+    s_misses++;
+    return INVALID_GL_HANDLE;
+  }
+
+  std::vector<u8> bytes = Utils::load_binary_from_path(path);
+  Header header{};
+  if (bytes.size() >= sizeof(Header)) {
+    std::memcpy(&header, bytes.data(), sizeof(Header));
+  }
+  if (header.m_magic != s_magic || header.m_version != s_version ||
+      header.m_key != key || bytes.size() != sizeof(Header) + header.m_size) {
+    spdlog::warn("program cache : discarding malformed entry {}", path);
+    std::filesystem::remove(path);
+    s_misses++;
+    return INVALID_GL_HANDLE;
+  }
+
+  gl_handle program = glCreateProgram();
+  glProgramBinary(program, header.m_format, bytes.data() + sizeof(Header),
+                  static_cast<GLsizei>(header.m_size));
+
+  GLint success = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    // driver rejected the binary (e.g. updated without a version change)
+    spdlog::info("program cache : stale entry {}, recompiling", path);
+    glDeleteProgram(program);
+    std::filesystem::remove(path);
+    s_misses++;
+    return INVALID_GL_HANDLE;
+  }
+
+  s_hits++;
+  return program;
+}
+
+void GLProgramCache::store(u64 key, gl_handle program) {
+  ZoneScoped;
+  if (!is_supported() || program == INVALID_GL_HANDLE) {
+    return;
+  }
+
+  GLint success = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (!success || length <= 0) {
+    return;
+  }
+
+  std::vector<u8> bytes(sizeof(Header) + length);
+  GLenum format = GL_NONE;
+  GLsizei written = 0;
+  glGetProgramBinary(program, length, &written, &format,
+                     bytes.data() + sizeof(Header));
+  if (written <= 0) {
+    return;
+  }
+
+  Header header{s_magic, s_version, key, static_cast<u32>(format),
+                static_cast<u32>(written)};
+  std::memcpy(bytes.data(), &header, sizeof(Header));
+  bytes.resize(sizeof(Header) + written);
+
+  std::error_code ec;
+  std::filesystem::create_directories(s_cache_directory, ec);
+  if (ec) {
+    spdlog::error("program cache : failed to create {} : {}",
+                  s_cache_directory, ec.message());
+    return;
+  }
+  Utils::save_binary_to_path(get_path(key), bytes);
+}
+} // namespace gem
@@ -0,0 +1,252 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_render_graph.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_gpu_profiler.h"
+#include "gem/gl/gl_state.h"
+#include "gem/profile.h"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+
+namespace gem {
+
+bool GLRenderGraph::TargetDesc::operator==(const TargetDesc &o) const {
+  if (m_resolution != o.m_resolution || m_depth != o.m_depth ||
+      m_colour_attachments.size() != o.m_colour_attachments.size()) {
+    return false;
+  }
+  for (u32 i = 0; i < m_colour_attachments.size(); i++) {
+    const auto &a = m_colour_attachments[i];
+    const auto &b = o.m_colour_attachments[i];
+    if (a.m_internal_format != b.m_internal_format ||
+        a.m_format != b.m_format || a.m_filter != b.m_filter ||
+        a.m_pixel_format != b.m_pixel_format) {
+      return false;
+    }
+  }
+  return true;
+}
+
+u64 GLRenderGraph::get_size_bytes(const TargetDesc &desc) {
+  u64 texel_bytes = desc.m_depth ? 4 : 0;
+  for (const auto &attachment : desc.m_colour_attachments) {
+    // m_format holds the sized format
+    switch (attachment.m_format) {
+    case GL_RGBA32F:
+      texel_bytes += 16;
+      break;
+    case GL_RGBA16F:
+      texel_bytes += 8;
+      break;
+    case GL_RGB16F:
+      texel_bytes += 6;
+      break;
+    default:
+      texel_bytes += 4;
+      break;
+    }
+  }
+  return texel_bytes * static_cast<u64>(desc.m_resolution.x) *
+         static_cast<u64>(desc.m_resolution.y);
+}
+
+void GLRenderGraph::release_physical(PhysicalTarget &physical) {
+  ZoneScoped;
+  GLFramebuffer &fb = physical.m_framebuffer;
+  if (!fb.m_colour_attachments.empty()) {
+    glDeleteTextures(static_cast<GLsizei>(fb.m_colour_attachments.size()),
+                     fb.m_colour_attachments.data());
+  }
+  if (physical.m_desc.m_depth) {
+    glDeleteTextures(1, &fb.m_depth_attachment);
+  }
+  fb.cleanup();
+}
+
+void GLRenderGraph::begin_frame() {
+  ZoneScoped;
+  p_targets.clear();
+  p_passes.clear();
+  p_order.clear();
+}
+
+RGTarget GLRenderGraph::import_target(const std::string &name,
+                                      GLFramebuffer &framebuffer) {
+  Target target{};
+  target.m_name = name;
+  target.m_imported = &framebuffer;
+  p_targets.push_back(target);
+  return static_cast<RGTarget>(p_targets.size() - 1);
+}
+
+RGTarget GLRenderGraph::create_target(const std::string &name,
+                                      const TargetDesc &desc) {
+  Target target{};
+  target.m_name = name;
+  target.m_desc = desc;
+  p_targets.push_back(target);
+  return static_cast<RGTarget>(p_targets.size() - 1);
+}
+
+void GLRenderGraph::add_pass(const std::string &name, std::vector<RGTarget> reads,
+                             std::vector<RGTarget> writes,
+                             ExecuteCallback execute, bool side_effects) {
+  p_passes.push_back(Pass{name, std::move(reads), std::move(writes),
+                          std::move(execute), side_effects, false});
+}
+
+void GLRenderGraph::compile() {
+  ZoneScoped;
+  // walk back from the passes with external effects, a pass is live if a
+  // later live pass reads anything it writes
+  std::vector<bool> needed(p_targets.size(), false);
+  for (i32 i = static_cast<i32>(p_passes.size()) - 1; i >= 0; i--) {
+    Pass &pass = p_passes[i];
+    pass.m_live = pass.m_side_effects;
+    for (RGTarget target : pass.m_writes) {
+      pass.m_live |= p_targets[target].m_imported != nullptr || needed[target];
+    }
+    if (!pass.m_live) {
+      continue;
+    }
+    for (RGTarget target : pass.m_reads) {
+      needed[target] = true;
+    }
+  }
+
+  p_order.clear();
+  for (u32 i = 0; i < p_passes.size(); i++) {
+    if (p_passes[i].m_live) {
+      p_order.push_back(i);
+    }
+  }
+  m_live_pass_count = static_cast<u32>(p_order.size());
+  m_culled_pass_count = static_cast<u32>(p_passes.size() - p_order.size());
+
+  std::vector<bool> written(p_targets.size(), false);
+  for (i32 order = 0; order < static_cast<i32>(p_order.size()); order++) {
+    Pass &pass = p_passes[p_order[order]];
+    for (RGTarget index : pass.m_reads) {
+      Target &target = p_targets[index];
+      if (target.m_first_use < 0) {
+        target.m_first_use = order;
+        // imported targets persist across frames, a read before this frame's
+        // write is a read of last frame's contents
+        target.m_clear = target.m_imported == nullptr && !written[index];
+      }
+      target.m_last_use = order;
+    }
+    for (RGTarget index : pass.m_writes) {
+      Target &target = p_targets[index];
+      if (target.m_first_use < 0) {
+        target.m_first_use = order;
+      }
+      target.m_last_use = order;
+      written[index] = true;
+    }
+  }
+
+  // place transient targets on pooled framebuffers in order of first use,
+  // a framebuffer is free again once its last target's lifetime has ended
+  std::vector<u32> transient{};
+  for (u32 i = 0; i < p_targets.size(); i++) {
+    if (p_targets[i].m_imported == nullptr && p_targets[i].m_first_use >= 0) {
+      transient.push_back(i);
+    }
+  }
+  std::sort(transient.begin(), transient.end(), [&](u32 a, u32 b) {
+    return p_targets[a].m_first_use < p_targets[b].m_first_use;
+  });
+
+  for (PhysicalTarget &physical : p_pool) {
+    physical.m_busy_until = -1;
+    physical.m_used = false;
+  }
+
+  m_requested_bytes = 0;
+  for (u32 index : transient) {
+    Target &target = p_targets[index];
+    m_requested_bytes += get_size_bytes(target.m_desc);
+    for (u32 i = 0; i < p_pool.size(); i++) {
+      PhysicalTarget &physical = p_pool[i];
+      if (physical.m_busy_until < target.m_first_use &&
+          physical.m_desc == target.m_desc) {
+        target.m_physical = static_cast<i32>(i);
+        break;
+      }
+    }
+    if (target.m_physical < 0) {
+      PhysicalTarget physical{};
+      physical.m_desc = target.m_desc;
+      physical.m_framebuffer =
+          GLFramebuffer::create(target.m_desc.m_resolution,
+                                target.m_desc.m_colour_attachments,
+                                target.m_desc.m_depth);
+      p_pool.push_back(physical);
+      target.m_physical = static_cast<i32>(p_pool.size() - 1);
+    }
+    PhysicalTarget &physical = p_pool[target.m_physical];
+    physical.m_busy_until = target.m_last_use;
+    physical.m_used = true;
+  }
+
+  // framebuffers no live pass needs this frame are freed straight away
+  std::vector<i32> remap(p_pool.size(), -1);
+  std::vector<PhysicalTarget> kept{};
+  for (u32 i = 0; i < p_pool.size(); i++) {
+    if (p_pool[i].m_used) {
+      remap[i] = static_cast<i32>(kept.size());
+      kept.push_back(p_pool[i]);
+    } else {
+      release_physical(p_pool[i]);
+    }
+  }
+  p_pool.swap(kept);
+  for (u32 index : transient) {
+    p_targets[index].m_physical = remap[p_targets[index].m_physical];
+  }
+
+  m_pooled_target_count = static_cast<u32>(p_pool.size());
+  m_pooled_bytes = 0;
+  for (const PhysicalTarget &physical : p_pool) {
+    m_pooled_bytes += get_size_bytes(physical.m_desc);
+  }
+}
+
+void GLRenderGraph::execute() {
+  ZoneScoped;
+  for (i32 order = 0; order < static_cast<i32>(p_order.size()); order++) {
+    Pass &pass = p_passes[p_order[order]];
+    GLState::begin_pass(pass.m_name.c_str());
+    GLGpuProfiler::begin_pass(pass.m_name.c_str());
+
+    // targets read without a live producer this frame read as cleared
+    for (RGTarget index : pass.m_reads) {
+      Target &target = p_targets[index];
+      if (target.m_clear && target.m_first_use == order) {
+        GLFramebuffer &fb = get(index);
+        fb.bind();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        fb.unbind();
+      }
+    }
+    pass.m_execute();
+  }
+}
+
+GLFramebuffer &GLRenderGraph::get(RGTarget index) {
+  Target &target = p_targets[index];
+  if (target.m_imported) {
+    return *target.m_imported;
+  }
+  return p_pool[target.m_physical].m_framebuffer;
+}
+
+void GLRenderGraph::release() {
+  ZoneScoped;
+  for (PhysicalTarget &physical : p_pool) {
+    release_physical(physical);
+  }
+  p_pool.clear();
+  begin_frame();
+}
+} // namespace gem
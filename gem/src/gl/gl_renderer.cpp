@@ -2,7 +2,11 @@
 #include "gem/gl/gl_renderer.h"
 #include "gem/asset_manager.h"
 #include "gem/backend.h"
+#include "gem/gl/gl_constant_ring.h"
 #include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_gpu_profiler.h"
+#include "gem/gl/gl_state.h"
+#include "gem/gl/gl_texture_streamer.h"
 #include "gem/gl/tech/gbuffer.h"
 #include "gem/gl/tech/lighting.h"
 #include "gem/gl/tech/shadow.h"
@@ -12,18 +16,34 @@
 #include "gem/gl/tech/vxgi.h"
 #include "gem/input.h"
 #include "gem/lights.h"
+#include "gem/material.h"
 #include "gem/profile.h"
 #include "gem/transform.h"
+#include "gem/utils.h"
 #include "im3d/im3d_math.h"
 #include "imgui.h"
 
 namespace gem {
 
+// GLGpuProfiler times graph passes by name
+static constexpr const char *s_cone_tracing_pass = "Voxel Cone Tracing Pass";
+static constexpr const char *s_ssr_pass = "SSR Pass";
+
 void GLRenderer::init(AssetManager &am, glm::ivec2 resolution) {
   ZoneScoped;
   TracyGpuContext;
   m_frame_index = 0;
   m_im3d_state = GLIm3d::load_im3d();
+  GLTextureStreamer::init();
+  GLConstantRing::init();
+  m_material_table.init();
+  m_indirect_draws.init();
+  m_gpu_driven_gbuffer &= GLIndirectDraws::is_supported();
+  m_entity_picker.init();
+  p_vxgi_scale_pass = m_dynamic_resolution.add_pass(
+      "Cone Tracing", m_vxgi_resolution_scale, 0.5f, 1.0f);
+  p_ssr_scale_pass = m_dynamic_resolution.add_pass(
+      "SSR", m_ssr_resolution_scale, 0.5f, 1.0f);
 
   am.load_asset("assets/shaders/gbuffer.shader", AssetType::shader);
   am.load_asset("assets/shaders/gbuffer_textureless.shader", AssetType::shader);
@@ -46,6 +66,9 @@ void GLRenderer::init(AssetManager &am, glm::ivec2 resolution) {
   am.load_asset("assets/shaders/voxel_reprojection.shader", AssetType::shader);
   am.load_asset("assets/shaders/voxel_blit.shader", AssetType::shader);
   am.load_asset("assets/shaders/voxel_clear.shader", AssetType::shader);
+  am.load_asset("assets/shaders/gpu_cull.shader", AssetType::shader);
+  am.load_asset("assets/shaders/hiz_build.shader", AssetType::shader);
+  am.load_asset("assets/shaders/hiz_proxy.shader", AssetType::shader);
 
   am.wait_all_assets();
   m_gbuffer_shader = am.get_asset<GLShader, AssetType::shader>(
@@ -89,28 +112,15 @@ void GLRenderer::init(AssetManager &am, glm::ivec2 resolution) {
       "assets/shaders/voxel_blit.shader");
   m_compute_voxel_clear_shader = am.get_asset<GLShader, AssetType::shader>(
       "assets/shaders/voxel_clear.shader");
+  m_compute_gpu_cull_shader = am.get_asset<GLShader, AssetType::shader>(
+      "assets/shaders/gpu_cull.shader");
+  m_compute_hiz_build_shader = am.get_asset<GLShader, AssetType::shader>(
+      "assets/shaders/hiz_build.shader");
+  m_hiz_proxy_shader = am.get_asset<GLShader, AssetType::shader>(
+      "assets/shaders/hiz_proxy.shader");
 
   m_window_resolution = resolution;
   const int shadow_resolution = 4096;
-  m_gbuffer =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                                 {GL_RGBA, GL_RGBA32F, GL_LINEAR, GL_FLOAT},
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                                 {GL_RGB, GL_RGB16F, GL_NEAREST, GL_FLOAT},
-                             },
-                             true);
-
-  m_gbuffer_downsample =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
   m_dir_light_shadow_buffer =
       GLFramebuffer::create({shadow_resolution, shadow_resolution}, {}, true);
 
@@ -121,93 +131,35 @@ void GLRenderer::init(AssetManager &am, glm::ivec2 resolution) {
                              },
                              false);
 
-  m_lightpass_buffer_resolve =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
   m_lightpass_buffer_history =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
+      GLHistoryFramebuffer::create(m_window_resolution,
+                                    {
+                                        {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                    });
 
+  // the full gbuffer's position attachment alternates between these two,
+  // the other one is last frame's positions
   m_position_buffer_history =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
+      GLHistoryFramebuffer::create(m_window_resolution,
+                                    {
+                                        {GL_RGBA, GL_RGBA32F, GL_LINEAR, GL_FLOAT},
+                                    });
+  create_gbuffer();
+  m_hiz_pyramid = open_gl::tech::HiZ::create_pyramid(m_window_resolution);
 
-  glm::vec2 gi_res = {m_window_resolution.x * m_vxgi_resolution_scale,
-                      m_window_resolution.y * m_vxgi_resolution_scale};
-  m_conetracing_buffer =
-      GLFramebuffer::create(gi_res,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_conetracing_buffer_denoise =
-      GLFramebuffer::create(gi_res,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_conetracing_buffer_resolve =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_conetracing_buffer_history =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  glm::vec2 ssr_res = {m_window_resolution.x * m_ssr_resolution_scale,
-                       m_window_resolution.y * m_ssr_resolution_scale};
-  m_ssr_buffer =
-      GLFramebuffer::create(ssr_res,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_ssr_buffer_denoise =
-      GLFramebuffer::create(ssr_res,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_ssr_buffer_resolve =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
+  // holds the denoised result, which is traced at the gi resolution
+  m_conetracing_buffer_history = GLHistoryFramebuffer::create(
+      m_window_resolution *
+          m_dynamic_resolution.m_passes[p_vxgi_scale_pass].m_max_scale,
+      {
+          {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+      });
 
   m_ssr_buffer_history =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
-
-  m_final_pass =
-      GLFramebuffer::create(m_window_resolution,
-                             {
-                                 {GL_RGBA, GL_RGBA8, GL_LINEAR, GL_FLOAT},
-                             },
-                             false);
+      GLHistoryFramebuffer::create(m_window_resolution,
+                                    {
+                                        {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                    });
 
   m_voxel_data = Voxel::create_grid(s_voxel_resolution, AABB{});
   Camera cam{}; // TODO: clean this up, just need a position of 0,0,0 to init
@@ -217,6 +169,29 @@ void GLRenderer::init(AssetManager &am, glm::ivec2 resolution) {
       m_visualise_3d_tex_instances_shader->m_data, 8);
 }
 
+void GLRenderer::create_gbuffer() {
+  ZoneScoped;
+  using open_gl::tech::GBuffer;
+  if (m_gbuffer.m_handle != INVALID_GL_HANDLE) {
+    if (p_gbuffer_layout == GBuffer::Layout::full) {
+      // owned by m_position_buffer_history
+      m_gbuffer.m_colour_attachments[1] = 0;
+    }
+    GBuffer::release_gbuffer(m_gbuffer);
+  }
+
+  m_gbuffer = GBuffer::create_gbuffer(m_window_resolution, m_gbuffer_layout);
+  if (m_gbuffer_layout == GBuffer::Layout::full) {
+    glDeleteTextures(1, &m_gbuffer.m_colour_attachments[1]);
+    m_gbuffer.replace_colour_attachment(
+        1, m_position_buffer_history.current().m_colour_attachments.front());
+  }
+  // voxelization reads the gbuffer ahead of the first gbuffer pass
+  GBuffer::clear_gbuffer(m_gbuffer, m_gbuffer_layout);
+  m_gbuffer.unbind();
+  p_gbuffer_layout = m_gbuffer_layout;
+}
+
 void GLRenderer::pre_frame(Camera &cam) {
   ZoneScoped;
 
@@ -233,42 +208,51 @@ void GLRenderer::render(AssetManager &am, Camera &cam,
     SDL_Delay(30);
   }
 
-  if (p_clear_voxel_grid) {
-    open_gl::tech::VXGI::dispatch_clear_voxel(
-        m_compute_voxel_clear_shader->m_data, m_voxel_data, s_voxel_resolution);
-    p_clear_voxel_grid = false;
+  {
+    ZoneScopedN("Texture Streaming");
+    GLTextureStreamer::update();
   }
-
-  m_voxel_data.update_voxel_unit();
+  // ImGui, Im3d and resource creation bind outside the state cache
+  GLState::invalidate();
+  GLState::begin_pass("Frame Setup");
+  GLGpuProfiler::begin_pass("Frame Setup");
+  update_dynamic_resolution();
+  m_entity_picker.poll();
 
   {
-    TracyGpuZone("GBuffer Voxelization");
-    open_gl::tech::VXGI::dispatch_gbuffer_voxelization(
-        m_compute_voxelize_gbuffer_shader->m_data, m_voxel_data, m_gbuffer,
-        m_lightpass_buffer, m_window_resolution);
+    ZoneScopedN("Frame Constants");
+    GLConstantRing::begin_frame();
+    FrameConstants frame{};
+    frame.m_view = cam.m_view;
+    frame.m_proj = cam.m_proj;
+    frame.m_vp = cam.m_proj * cam.m_view;
+    frame.m_last_vp = cam.m_last_vp;
+    frame.m_inv_proj = glm::inverse(cam.m_proj);
+    frame.m_inv_vp = glm::inverse(frame.m_vp);
+    frame.m_last_inv_vp = glm::inverse(cam.m_last_vp);
+    frame.m_cam_pos = glm::vec4(cam.m_pos, 1.0f);
+    frame.m_resolution_jitter = glm::vec4(
+        m_window_resolution,
+        GLConstantRing::get_jitter(m_frame_index, m_window_resolution));
+    frame.m_frame = glm::ivec4(static_cast<int>(m_frame_index), 0, 0, 0);
+    // stays bound for the whole frame
+    GLConstantRing::push_and_bind(frame);
   }
 
-  {
-    TracyGpuZone("GBuffer Voxelization MIPS");
-    open_gl::tech::VXGI::dispatch_gen_voxel_mips(
-        m_compute_voxel_mips_shader->m_data, m_voxel_data, s_voxel_resolution);
+  if (m_gbuffer_layout != p_gbuffer_layout) {
+    create_gbuffer();
+    p_clear_voxel_grid = true;
   }
 
-  {
-    TracyGpuZone("GBuffer");
-    m_gbuffer.bind();
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    open_gl::tech::GBuffer::dispatch_gbuffer_with_id(
-        m_frame_index, m_gbuffer, m_position_buffer_history,
-        m_gbuffer_shader->m_data, am, cam, scenes, m_window_resolution);
+  if (p_clear_voxel_grid) {
+    open_gl::tech::VXGI::dispatch_clear_voxel(
+        m_compute_voxel_clear_shader->m_data, m_voxel_data, s_voxel_resolution);
+    p_clear_voxel_grid = false;
+  }
 
-    open_gl::tech::GBuffer::dispatch_gbuffer_textureless_with_id(
-        m_frame_index, m_gbuffer, m_position_buffer_history,
-        m_gbuffer_textureless_shader->m_data, am, cam, scenes,
-        m_window_resolution);
+  m_voxel_data.update_voxel_unit();
+  open_gl::tech::VXGI::push_voxel_constants(m_voxel_data);
 
-    m_frame_index++;
-  }
   // TODO: Need a way to get a single instance more efficiently
   DirectionalLight dir{};
   std::vector<PointLight> point_lights{};
@@ -279,211 +263,522 @@ void GLRenderer::render(AssetManager &am, Camera &cam,
       break;
     }
   }
+
   {
-    TracyGpuZone("Dir Light Shadow Pass");
-    open_gl::tech::Shadow::dispatch_shadow_pass(
-        m_dir_light_shadow_buffer, m_dir_light_shadow_shader->m_data, dir,
-        scenes, m_window_resolution);
+    ZoneScopedN("Build Draw List");
+    open_gl::tech::HiZ::poll_readback(m_hiz_pyramid, m_hiz_readback);
+    m_draw_list.set_occluders(m_occlusion_culling && m_hiz_readback.m_valid
+                                  ? &m_hiz_readback
+                                  : nullptr);
+    m_draw_list.set_view(DrawView::camera, cam.m_proj * cam.m_view);
+    m_draw_list.set_view(DrawView::light,
+                         open_gl::tech::Shadow::get_light_space_matrix(dir));
+    // the GPU driven path culls in gpu_cull.shader
+    m_draw_list.set_pass(DrawPass::gbuffer, true,
+                         m_gbuffer_shader->m_data.m_shader_id,
+                         m_gpu_driven_gbuffer ? DrawView::unculled
+                                              : DrawView::camera);
+    m_draw_list.set_pass(DrawPass::gbuffer_textureless, true,
+                         m_gbuffer_textureless_shader->m_data.m_shader_id);
+    m_draw_list.set_pass(DrawPass::shadow, m_lighting_shadows,
+                         INVALID_GL_HANDLE, DrawView::light);
+    m_draw_list.build(scenes, cam.m_pos);
   }
-  {
+
+  GLRenderGraph &graph = m_render_graph;
+  graph.begin_frame();
+
+  // persistent targets, read across frames or by the apps
+  const RGTarget gbuffer = graph.import_target("GBuffer", m_gbuffer);
+  const RGTarget shadow_map =
+      graph.import_target("Dir Light Shadow Map", m_dir_light_shadow_buffer);
+  const RGTarget lightpass =
+      graph.import_target("Light Pass", m_lightpass_buffer);
+  // temporal passes write current() and sample last frame's output through
+  // history(), the pair swaps at the end of the frame
+  const RGTarget lightpass_history = graph.import_target(
+      "Light Pass History", m_lightpass_buffer_history.history());
+  const RGTarget lightpass_resolve = graph.import_target(
+      "Light Pass Resolve", m_lightpass_buffer_history.current());
+  const RGTarget position_history = graph.import_target(
+      "Position History", m_position_buffer_history.history());
+  const RGTarget conetracing_history = graph.import_target(
+      "Cone Tracing History", m_conetracing_buffer_history.history());
+  const RGTarget conetracing_denoise = graph.import_target(
+      "Cone Tracing Denoise", m_conetracing_buffer_history.current());
+  const RGTarget ssr_history =
+      graph.import_target("SSR History", m_ssr_buffer_history.history());
+
+  auto colour_target = [](glm::vec2 resolution, GLenum format) {
+    return GLRenderGraph::TargetDesc{
+        glm::ivec2(resolution), {{GL_RGBA, format, GL_LINEAR, GL_FLOAT}}, false};
+  };
+  // rendered size this frame / allocated size, see m_dynamic_resolution
+  const glm::vec2 gi_res = m_window_resolution * m_vxgi_resolution_scale;
+  const glm::vec2 ssr_res = m_window_resolution * m_ssr_resolution_scale;
+  const glm::vec2 gi_max_res =
+      m_window_resolution *
+      m_dynamic_resolution.m_passes[p_vxgi_scale_pass].m_max_scale;
+  const glm::vec2 ssr_max_res =
+      m_window_resolution *
+      m_dynamic_resolution.m_passes[p_ssr_scale_pass].m_max_scale;
+
+  const RGTarget gbuffer_downsample = graph.create_target(
+      "GBuffer Downsample", colour_target(m_window_resolution, GL_RGBA16F));
+  const RGTarget conetracing = graph.create_target(
+      "Cone Tracing", colour_target(gi_max_res, GL_RGBA16F));
+  const RGTarget conetracing_resolve = graph.create_target(
+      "Cone Tracing Resolve", colour_target(m_window_resolution, GL_RGBA16F));
+  const RGTarget ssr =
+      graph.create_target("SSR", colour_target(ssr_max_res, GL_RGBA16F));
+  // transient while ssr is off, so the composite reads it as cleared
+  const RGTarget ssr_resolve =
+      m_debug_draw_ssr_pass
+          ? graph.import_target("SSR Resolve", m_ssr_buffer_history.current())
+          : graph.create_target("SSR Resolve",
+                                colour_target(m_window_resolution, GL_RGBA16F));
+  const RGTarget final_pass = graph.create_target(
+      "Final Pass", colour_target(m_window_resolution, GL_RGBA8));
+
+  const bool cone_tracing =
+      m_debug_draw_cone_tracing_pass || m_debug_draw_cone_tracing_pass_no_taa;
+
+  using open_gl::tech::GBuffer;
+  const std::vector<GLShader::Define> gbuffer_defines =
+      GBuffer::get_defines(m_gbuffer_layout);
+  gl_handle gbuffer_velocity = GBuffer::get_texture(
+      m_gbuffer, m_gbuffer_layout, GBuffer::Channel::velocity);
+
+  // reads last frame's gbuffer and lighting, writes the voxel grid
+  graph.add_pass(
+      "GBuffer Voxelization", {gbuffer, lightpass}, {},
+      [&]() {
+        TracyGpuZone("GBuffer Voxelization");
+        open_gl::tech::VXGI::dispatch_gbuffer_voxelization(
+            m_compute_voxelize_gbuffer_shader->m_data.get_variant(
+                gbuffer_defines),
+            m_voxel_data, m_gbuffer, m_gbuffer_layout, m_lightpass_buffer,
+            m_window_resolution);
+      },
+      true);
+
+  graph.add_pass(
+      "GBuffer Voxelization MIPS", {}, {},
+      [&]() {
+        TracyGpuZone("GBuffer Voxelization MIPS");
+        open_gl::tech::VXGI::dispatch_gen_voxel_mips(
+            m_compute_voxel_mips_shader->m_data, m_voxel_data,
+            s_voxel_resolution);
+      },
+      true);
+
+  graph.add_pass("GBuffer", {position_history}, {gbuffer}, [&]() {
+    TracyGpuZone("GBuffer");
+    if (m_gbuffer_layout == GBuffer::Layout::full) {
+      // voxelization has consumed last frame's positions, write the other one
+      m_gbuffer.replace_colour_attachment(
+          1, m_position_buffer_history.current().m_colour_attachments.front());
+    }
+    GBuffer::clear_gbuffer(m_gbuffer, m_gbuffer_layout);
+    m_material_table.update(am);
+
+    using open_gl::tech::HiZ;
+    using CullPhase = GLIndirectDraws::CullPhase;
+    // the pyramid was last built with the previous frame's camera, which is
+    // cam.m_last_vp
+    const HiZ::Pyramid *occluders =
+        m_occlusion_culling ? &m_hiz_pyramid : nullptr;
+    std::vector<GLShader::Define> indirect_defines = gbuffer_defines;
+    indirect_defines.push_back({"GPU_DRIVEN"});
+    GLShader &gbuffer_shader = m_gbuffer_shader->m_data.get_variant(
+        m_gpu_driven_gbuffer ? indirect_defines : gbuffer_defines);
+    GLShader &gbuffer_textureless_shader =
+        m_gbuffer_textureless_shader->m_data.get_variant(gbuffer_defines);
+
+    // feedback spans both phases, the indirect draws register their slots
+    // when the first phase uploads them
+    GLTextureStreamer::begin_feedback();
+    if (m_gpu_driven_gbuffer) {
+      open_gl::tech::GBuffer::dispatch_gbuffer_indirect(
+          m_gbuffer, graph.get(position_history), gbuffer_shader,
+          m_compute_gpu_cull_shader->m_data, m_material_table,
+          m_indirect_draws, m_draw_list.get_packets(DrawPass::gbuffer),
+          cam.m_frustum_planes.m_planes, CullPhase::first, occluders);
+    } else {
+      open_gl::tech::GBuffer::dispatch_gbuffer_with_id(
+          m_gbuffer, graph.get(position_history), gbuffer_shader,
+          m_material_table, m_draw_list.get_packets(DrawPass::gbuffer));
+    }
+
+    open_gl::tech::GBuffer::dispatch_gbuffer_textureless_with_id(
+        m_gbuffer, graph.get(position_history), gbuffer_textureless_shader,
+        am, m_draw_list.get_packets(DrawPass::gbuffer_textureless));
+
+    if (m_occlusion_culling) {
+      const glm::mat4 view_proj = cam.m_proj * cam.m_view;
+      // second phase, draws hidden last frame are tested against what the
+      // first phase drew
+      if (m_gpu_driven_gbuffer) {
+        HiZ::dispatch_build(m_compute_hiz_build_shader->m_data, m_hiz_pyramid,
+                            m_gbuffer.m_depth_attachment, view_proj);
+        open_gl::tech::GBuffer::dispatch_gbuffer_indirect(
+            m_gbuffer, graph.get(position_history), gbuffer_shader,
+            m_compute_gpu_cull_shader->m_data, m_material_table,
+            m_indirect_draws, {}, cam.m_frustum_planes.m_planes,
+            CullPhase::second, &m_hiz_pyramid);
+      } else {
+        const DrawRange occluded =
+            m_draw_list.get_occluded_packets(DrawPass::gbuffer);
+        m_gbuffer.bind();
+        m_occlusion_queries.dispatch_proxies(m_hiz_proxy_shader->m_data,
+                                             occluded, cam.m_pos);
+        open_gl::tech::GBuffer::dispatch_gbuffer_with_id(
+            m_gbuffer, graph.get(position_history), gbuffer_shader,
+            m_material_table, occluded, &m_occlusion_queries);
+      }
+
+      const DrawRange occluded_textureless =
+          m_draw_list.get_occluded_packets(DrawPass::gbuffer_textureless);
+      m_gbuffer.bind();
+      m_occlusion_queries.dispatch_proxies(m_hiz_proxy_shader->m_data,
+                                           occluded_textureless, cam.m_pos);
+      open_gl::tech::GBuffer::dispatch_gbuffer_textureless_with_id(
+          m_gbuffer, graph.get(position_history), gbuffer_textureless_shader,
+          am, occluded_textureless, &m_occlusion_queries);
+
+      // next frame's occluders
+      HiZ::dispatch_build(m_compute_hiz_build_shader->m_data, m_hiz_pyramid,
+                          m_gbuffer.m_depth_attachment, view_proj);
+      HiZ::request_readback(m_hiz_pyramid);
+    }
+    GLTextureStreamer::end_feedback();
+    if (m_gpu_driven_gbuffer) {
+      m_indirect_draws.request_stats();
+    }
+  });
+
+  if (m_lighting_shadows) {
+    graph.add_pass("Dir Light Shadow Pass", {}, {shadow_map}, [&]() {
+      TracyGpuZone("Dir Light Shadow Pass");
+      open_gl::tech::Shadow::dispatch_shadow_pass(
+          m_dir_light_shadow_buffer, m_dir_light_shadow_shader->m_data, dir,
+          m_draw_list.get_packets(DrawPass::shadow), m_window_resolution);
+    });
+  }
+
+  std::vector<RGTarget> lighting_reads{gbuffer};
+  if (m_lighting_shadows) {
+    lighting_reads.push_back(shadow_map);
+  }
+  graph.add_pass("Direct Lighting Pass", lighting_reads, {lightpass}, [&]() {
     TracyGpuZone("Direct Lighting Pass");
+    std::vector<GLShader::Define> lighting_defines = gbuffer_defines;
+    if (!m_lighting_shadows) {
+      lighting_defines.push_back({"NO_SHADOWS"});
+    } else if (m_lighting_shadow_pcf_radius != 1) {
+      lighting_defines.push_back(
+          {"SHADOW_PCF_RADIUS", std::to_string(m_lighting_shadow_pcf_radius)});
+    }
     open_gl::tech::PBRLighting::dispatch_light_pass(
-        m_lighting_shader->m_data, m_lightpass_buffer, m_gbuffer,
-        m_dir_light_shadow_buffer, cam, point_lights, dir);
-  }
+        m_lighting_shader->m_data.get_variant(lighting_defines),
+        m_lightpass_buffer, m_gbuffer, m_gbuffer_layout,
+        m_dir_light_shadow_buffer, point_lights, dir);
+  });
 
-  {
+  graph.add_pass("GBuffer Downsample", {gbuffer}, {gbuffer_downsample}, [&]() {
     TracyGpuZone("GBuffer Downsample");
-    m_gbuffer_downsample.bind();
+    GLFramebuffer &target = graph.get(gbuffer_downsample);
+    target.bind();
     open_gl::tech::Utils::dispatch_present_image(
         m_downsample_shader->m_data, "u_prev_mip", 0,
-        m_gbuffer.m_colour_attachments[2]);
-    m_gbuffer_downsample.unbind();
-  }
-
-  {
-    TracyGpuZone("Light Pass TAA");
+        GBuffer::get_texture(m_gbuffer, m_gbuffer_layout,
+                             GBuffer::Channel::normal));
+    target.unbind();
+  });
 
-    open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
-        m_taa_shader->m_data, m_lightpass_buffer, m_lightpass_buffer_resolve,
-        m_lightpass_buffer_history, m_gbuffer.m_colour_attachments[4],
-        m_window_resolution);
-  }
+  graph.add_pass("Light Pass TAA", {lightpass, lightpass_history, gbuffer},
+                 {lightpass_resolve}, [&]() {
+                   TracyGpuZone("Light Pass TAA");
+                   open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
+                       m_taa_shader->m_data, m_lightpass_buffer,
+                       graph.get(lightpass_resolve),
+                       graph.get(lightpass_history), gbuffer_velocity);
+                 });
 
-  if (m_debug_draw_cone_tracing_pass || m_debug_draw_cone_tracing_pass_no_taa) {
-    TracyGpuZone("Voxel Cone Tracing Pass");
-    open_gl::tech::VXGI::dispatch_cone_tracing_pass(
-        m_voxel_cone_tracing_shader->m_data, m_voxel_data, m_conetracing_buffer,
-        m_gbuffer, m_window_resolution, m_voxel_data.current_bounding_box,
-        s_voxel_resolution, cam, m_vxgi_cone_trace_distance,
-        m_vxgi_resolution_scale, m_vxgi_diffuse_specular_mix);
+  if (cone_tracing) {
+    graph.add_pass(s_cone_tracing_pass, {gbuffer}, {conetracing}, [&]() {
+      TracyGpuZone("Voxel Cone Tracing Pass");
+      std::vector<GLShader::Define> cone_tracing_defines = gbuffer_defines;
+      if (m_vxgi_low_quality) {
+        cone_tracing_defines.push_back({"LOW_QUALITY"});
+        cone_tracing_defines.push_back({"SPECULAR_TRACE_STEPS", "128"});
+      }
+      open_gl::tech::VXGI::dispatch_cone_tracing_pass(
+          m_voxel_cone_tracing_shader->m_data.get_variant(
+              cone_tracing_defines),
+          m_voxel_data, graph.get(conetracing), m_gbuffer, m_gbuffer_layout,
+          m_window_resolution,
+          m_vxgi_cone_trace_distance, m_vxgi_resolution_scale,
+          m_vxgi_diffuse_specular_mix);
+    });
   }
 
   if (m_debug_draw_lighting_pass) {
-    open_gl::tech::Utils::dispatch_present_image(
-        m_present_shader->m_data, "u_image_sampler", 0,
-        m_lightpass_buffer_resolve.m_colour_attachments.front());
+    graph.add_pass(
+        "Present Light Pass", {lightpass_resolve}, {},
+        [&]() {
+          open_gl::tech::Utils::dispatch_present_image(
+              m_present_shader->m_data, "u_image_sampler", 0,
+              graph.get(lightpass_resolve).m_colour_attachments.front());
+        },
+        true);
   }
 
-  m_ssr_buffer_resolve.bind();
-  glClear(GL_COLOR_BUFFER_BIT);
-  m_ssr_buffer_resolve.unbind();
-
   if (m_debug_draw_ssr_pass) {
-    TracyGpuZone("SSR Pass");
-    glViewport(0, 0, m_window_resolution.x * m_ssr_resolution_scale,
-               m_window_resolution.y * m_ssr_resolution_scale);
-    open_gl::tech::ScreenSpaceReflections::dispatch_ssr_pass(
-        m_ssr_shader->m_data, cam, m_ssr_buffer, m_gbuffer, m_lightpass_buffer,
-        m_window_resolution * m_ssr_resolution_scale);
-    glViewport(0, 0, m_window_resolution.x, m_window_resolution.y);
-    open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
-        m_taa_shader->m_data, m_ssr_buffer, m_ssr_buffer_resolve,
-        m_ssr_buffer_history, m_gbuffer.m_colour_attachments[4],
-        m_window_resolution);
+    graph.add_pass(s_ssr_pass, {gbuffer, lightpass}, {ssr}, [&]() {
+      TracyGpuZone("SSR Pass");
+      GLState::set_viewport(glm::ivec4(0, 0, ssr_res.x, ssr_res.y));
+      open_gl::tech::ScreenSpaceReflections::dispatch_ssr_pass(
+          m_ssr_shader->m_data.get_variant(gbuffer_defines), cam,
+          graph.get(ssr), m_gbuffer, m_gbuffer_layout,
+          m_lightpass_buffer, ssr_res);
+      GLState::set_viewport(
+          glm::ivec4(0, 0, m_window_resolution.x, m_window_resolution.y));
+    });
+
+    graph.add_pass("SSR TAA", {ssr, ssr_history, gbuffer}, {ssr_resolve},
+                   [&]() {
+                     TracyGpuZone("SSR TAA");
+                     open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
+                         m_taa_shader->m_data, graph.get(ssr),
+                         graph.get(ssr_resolve), graph.get(ssr_history),
+                         gbuffer_velocity, m_ssr_resolution_scale);
+                   });
   }
 
   if (m_debug_draw_cone_tracing_pass) {
-    {
-      TracyGpuZone("Voxel Cone Tracing TAA");
-      open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
-          m_taa_shader->m_data, m_conetracing_buffer,
-          m_conetracing_buffer_resolve, m_conetracing_buffer_history,
-          m_gbuffer.m_colour_attachments[4], m_window_resolution);
-
-      glViewport(0, 0, m_window_resolution.x * m_vxgi_resolution_scale,
-                 m_window_resolution.y * m_vxgi_resolution_scale);
-    }
-    {
-      TracyGpuZone("Voxel Cone Tracing Denoise");
-      open_gl::tech::Utils::dispatch_denoise_image(
-          m_denoise_shader->m_data, m_conetracing_buffer_resolve,
-          m_conetracing_buffer_denoise, m_denoise_sigma, m_denoise_threshold,
-          m_denoise_k_sigma, m_window_resolution);
-      Texture::bind_sampler_handle(0, GL_TEXTURE0);
-      glViewport(0, 0, m_window_resolution.x, m_window_resolution.y);
-    }
+    graph.add_pass("Voxel Cone Tracing TAA",
+                   {conetracing, conetracing_history, gbuffer},
+                   {conetracing_resolve}, [&]() {
+                     TracyGpuZone("Voxel Cone Tracing TAA");
+                     open_gl::tech::TemporalAntiAliasing::dispatch_taa_pass(
+                         m_taa_shader->m_data, graph.get(conetracing),
+                         graph.get(conetracing_resolve),
+                         graph.get(conetracing_history), gbuffer_velocity,
+                         m_vxgi_resolution_scale,
+                         p_conetracing_history_scale);
+                   });
+
+    graph.add_pass(
+        "Voxel Cone Tracing Denoise", {conetracing_resolve},
+        {conetracing_denoise}, [&]() {
+          TracyGpuZone("Voxel Cone Tracing Denoise");
+          GLState::set_viewport(glm::ivec4(0, 0, gi_res.x, gi_res.y));
+          open_gl::tech::Utils::dispatch_denoise_image(
+              m_denoise_shader->m_data, graph.get(conetracing_resolve),
+              graph.get(conetracing_denoise), m_denoise_sigma,
+              m_denoise_threshold, m_denoise_k_sigma, m_window_resolution);
+          Texture::bind_sampler_handle(0, GL_TEXTURE0);
+          GLState::set_viewport(
+              glm::ivec4(0, 0, m_window_resolution.x, m_window_resolution.y));
+        });
   }
+
   if (m_debug_draw_cone_tracing_pass_no_taa) {
-    open_gl::tech::Utils::dispatch_present_image(
-        m_present_shader->m_data, "u_image_sampler", 0,
-        m_conetracing_buffer.m_colour_attachments.front());
+    graph.add_pass(
+        "Present Cone Tracing", {conetracing}, {},
+        [&]() {
+          open_gl::tech::Utils::dispatch_present_image(
+              m_present_shader->m_data, "u_image_sampler", 0,
+              graph.get(conetracing).m_colour_attachments.front());
+        },
+        true);
   }
   if (m_debug_draw_lighting_pass_no_taa) {
-    open_gl::tech::Utils::dispatch_present_image(
-        m_present_shader->m_data, "u_image_sampler", 0,
-        m_lightpass_buffer.m_colour_attachments.front());
+    graph.add_pass(
+        "Present Light Pass No TAA", {lightpass}, {},
+        [&]() {
+          open_gl::tech::Utils::dispatch_present_image(
+              m_present_shader->m_data, "u_image_sampler", 0,
+              m_lightpass_buffer.m_colour_attachments.front());
+        },
+        true);
   }
-
   if (m_debug_draw_ssr_pass) {
-    open_gl::tech::Utils::dispatch_present_image(
-        m_present_shader->m_data, "u_image_sampler", 0,
-        m_ssr_buffer_resolve.m_colour_attachments.front());
+    graph.add_pass(
+        "Present SSR", {ssr_resolve}, {},
+        [&]() {
+          open_gl::tech::Utils::dispatch_present_image(
+              m_present_shader->m_data, "u_image_sampler", 0,
+              graph.get(ssr_resolve).m_colour_attachments.front());
+        },
+        true);
   }
-  {
-    TracyGpuZone("Blit lightpass to history");
-    open_gl::tech::Utils::blit_to_fb(
-        m_lightpass_buffer_history, m_present_shader->m_data, "u_image_sampler",
-        0, m_lightpass_buffer_resolve.m_colour_attachments[0]);
-  }
-  {
-    TracyGpuZone("Blit Gbuffer position to history");
-    open_gl::tech::Utils::blit_to_fb(
-        m_position_buffer_history, m_present_shader->m_data, "u_image_sampler",
-        0, m_gbuffer.m_colour_attachments[1]);
+
+  graph.add_pass(
+      "Voxel Grid Visualiser", {}, {},
+      [&]() {
+        glClear(GL_DEPTH_BUFFER_BIT);
+        if (m_debug_draw_3d_texture) {
+          m_voxel_visualiser.dispatch_draw(m_voxel_data, cam);
+        }
+        glClear(GL_DEPTH_BUFFER_BIT);
+      },
+      true);
+
+  if (m_debug_draw_final_pass) {
+    // cone tracing and ssr read as black when their passes are disabled
+    graph.add_pass(
+        "Composite Final Pass",
+        {lightpass_resolve, conetracing_resolve, ssr_resolve}, {final_pass},
+        [&]() {
+          TracyGpuZone("Composite Final Pass");
+          GEM_GPU_MARKER("Composite Final Pass");
+          GLFramebuffer &target = graph.get(final_pass);
+          target.bind();
+          Shapes::s_screen_quad.use();
+          m_combine_shader->m_data.use();
+          m_combine_shader->m_data.set_float("u_brightness",
+                                             m_tonemapping_brightness);
+          m_combine_shader->m_data.set_float("u_contrast",
+                                             m_tonemapping_contrast);
+          m_combine_shader->m_data.set_float("u_saturation",
+                                             m_tonemapping_saturation);
+          m_combine_shader->m_data.set_int("lighting_pass", 0);
+          Texture::bind_sampler_handle(
+              graph.get(lightpass_resolve).m_colour_attachments.front(),
+              GL_TEXTURE0);
+          m_combine_shader->m_data.set_int("cone_tracing_pass", 1);
+          Texture::bind_sampler_handle(
+              graph.get(conetracing_resolve).m_colour_attachments.front(),
+              GL_TEXTURE1);
+          m_combine_shader->m_data.set_int("ssr_pass", 2);
+          Texture::bind_sampler_handle(
+              graph.get(ssr_resolve).m_colour_attachments.front(),
+              GL_TEXTURE2);
+          glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+          Texture::bind_sampler_handle(0, GL_TEXTURE0);
+          Texture::bind_sampler_handle(0, GL_TEXTURE1);
+          target.unbind();
+        });
+
+    graph.add_pass(
+        "Present Final Pass", {final_pass}, {},
+        [&]() {
+          open_gl::tech::Utils::dispatch_present_image(
+              m_present_shader->m_data, "u_image_sampler", 0,
+              graph.get(final_pass).m_colour_attachments.front());
+        },
+        true);
   }
-  {
-    TracyGpuZone("Blit voxel cone tracing to history");
-    open_gl::tech::Utils::blit_to_fb(
-        m_conetracing_buffer_history, m_present_shader->m_data,
-        "u_image_sampler", 0,
-        m_conetracing_buffer_denoise.m_colour_attachments.front());
+
+  graph.compile();
+  graph.execute();
+  m_entity_picker.dispatch_readbacks(
+      GBuffer::get_texture(m_gbuffer, m_gbuffer_layout,
+                           GBuffer::Channel::entity_id),
+      glm::ivec2(m_window_resolution));
+
+  // a disabled pass keeps its history as it was when it last ran
+  m_lightpass_buffer_history.swap();
+  m_position_buffer_history.swap();
+  if (m_debug_draw_ssr_pass) {
+    m_ssr_buffer_history.swap();
   }
-  {
-    TracyGpuZone("Blit ssr pass to history");
-    open_gl::tech::Utils::blit_to_fb(
-        m_ssr_buffer_history, m_present_shader->m_data, "u_image_sampler", 0,
-        m_ssr_buffer_resolve.m_colour_attachments.front());
+  if (m_debug_draw_cone_tracing_pass) {
+    m_conetracing_buffer_history.swap();
+    p_conetracing_history_scale = m_vxgi_resolution_scale;
   }
 
-  glClear(GL_DEPTH_BUFFER_BIT);
-  if (m_debug_draw_3d_texture) {
-    m_voxel_visualiser.dispatch_draw(m_voxel_data, cam);
-  }
+  m_frame_index++;
   m_voxel_data.previous_bounding_box = m_voxel_data.current_bounding_box;
-  glClear(GL_DEPTH_BUFFER_BIT);
-  if (m_debug_draw_final_pass) {
-    TracyGpuZone("Composite Final Pass");
-    GEM_GPU_MARKER("Composite Final Pass");
-    m_final_pass.bind();
-    Shapes::s_screen_quad.use();
-    m_combine_shader->m_data.use();
-    m_combine_shader->m_data.set_float("u_brightness",
-                                       m_tonemapping_brightness);
-    m_combine_shader->m_data.set_float("u_contrast", m_tonemapping_contrast);
-    m_combine_shader->m_data.set_float("u_saturation",
-                                       m_tonemapping_saturation);
-    m_combine_shader->m_data.set_int("lighting_pass", 0);
-    Texture::bind_sampler_handle(
-        m_lightpass_buffer_resolve.m_colour_attachments.front(), GL_TEXTURE0);
-    m_combine_shader->m_data.set_int("cone_tracing_pass", 1);
-    Texture::bind_sampler_handle(
-        m_conetracing_buffer_resolve.m_colour_attachments.front(), GL_TEXTURE1);
-    m_combine_shader->m_data.set_int("ssr_pass", 2);
-    m_combine_shader->m_data.set_int("ssr_pass", 2);
-    Texture::bind_sampler_handle(
-        m_ssr_buffer_resolve.m_colour_attachments.front(), GL_TEXTURE2);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-    Texture::bind_sampler_handle(0, GL_TEXTURE0);
-    Texture::bind_sampler_handle(0, GL_TEXTURE1);
-    m_final_pass.unbind();
-    open_gl::tech::Utils::dispatch_present_image(
-        m_present_shader->m_data, "u_image_sampler", 0,
-        m_final_pass.m_colour_attachments.front());
-
-    m_conetracing_buffer_resolve.bind();
-    glClear(GL_COLOR_BUFFER_BIT);
-    m_conetracing_buffer.unbind();
-  }
 
   {
     TracyGpuZone("Im3D Pass");
+    GLState::begin_pass("Im3D Pass");
+    GLGpuProfiler::begin_pass("Im3D Pass");
     GLIm3d::end_frame_im3d(m_im3d_state, m_window_resolution, cam);
+    GLState::invalidate();
   }
+  GLConstantRing::end_frame();
+  GLState::end_frame();
+  GLGpuProfiler::end_frame();
   TracyGpuCollect;
 }
 
+void GLRenderer::update_dynamic_resolution() {
+  ZoneScoped;
+  if (GLGpuProfiler::s_resolved_frames != p_resolution_frame) {
+    p_resolution_frame = GLGpuProfiler::s_resolved_frames;
+    // a pass that isn't running has nothing to give back
+    const GLGpuProfiler::PassTiming *vxgi_timing =
+        GLGpuProfiler::find_pass(s_cone_tracing_pass);
+    const GLGpuProfiler::PassTiming *ssr_timing =
+        GLGpuProfiler::find_pass(s_ssr_pass);
+    m_dynamic_resolution.set_gpu_time(
+        p_vxgi_scale_pass,
+        vxgi_timing != nullptr && GLGpuProfiler::was_measured(*vxgi_timing)
+            ? vxgi_timing->m_last_ms
+            : 0.0f);
+    m_dynamic_resolution.set_gpu_time(
+        p_ssr_scale_pass,
+        ssr_timing != nullptr && GLGpuProfiler::was_measured(*ssr_timing)
+            ? ssr_timing->m_last_ms
+            : 0.0f);
+    m_dynamic_resolution.update(GLGpuProfiler::s_frame_ms);
+  }
+
+  DynamicResolution::Pass &vxgi =
+      m_dynamic_resolution.m_passes[p_vxgi_scale_pass];
+  DynamicResolution::Pass &ssr =
+      m_dynamic_resolution.m_passes[p_ssr_scale_pass];
+  if (m_dynamic_resolution.m_enabled) {
+    m_vxgi_resolution_scale = vxgi.m_scale;
+    m_ssr_resolution_scale = ssr.m_scale;
+  } else {
+    // manual scales, the controller picks up from them when re-enabled
+    vxgi.m_scale = m_vxgi_resolution_scale =
+        glm::clamp(m_vxgi_resolution_scale, vxgi.m_min_scale,
+                   vxgi.m_max_scale);
+    ssr.m_scale = m_ssr_resolution_scale = glm::clamp(
+        m_ssr_resolution_scale, ssr.m_min_scale, ssr.m_max_scale);
+  }
+}
+
 void GLRenderer::cleanup(AssetManager &am) {
   ZoneScoped;
   m_gbuffer.cleanup();
-  m_gbuffer_downsample.cleanup();
   m_dir_light_shadow_buffer.cleanup();
   m_lightpass_buffer.cleanup();
-  m_lightpass_buffer_resolve.cleanup();
   m_lightpass_buffer_history.cleanup();
   m_position_buffer_history.cleanup();
-  m_conetracing_buffer.cleanup();
-  m_conetracing_buffer_denoise.cleanup();
-  m_conetracing_buffer_resolve.cleanup();
   m_conetracing_buffer_history.cleanup();
-  m_ssr_buffer.cleanup();
-  m_ssr_buffer_denoise.cleanup();
-  m_ssr_buffer_resolve.cleanup();
   m_ssr_buffer_history.cleanup();
-  m_final_pass.cleanup();
+  m_render_graph.release();
+  GLGpuProfiler::cleanup();
+  m_material_table.cleanup();
+  m_indirect_draws.cleanup();
+  m_occlusion_queries.cleanup();
+  m_entity_picker.cleanup();
+  open_gl::tech::HiZ::release_pyramid(m_hiz_pyramid);
+  GLConstantRing::cleanup();
+  GLTextureStreamer::cleanup();
   GLIm3d::shutdown_im3d(m_im3d_state);
 }
 
-entt::entity GLRenderer::get_mouse_entity(glm::vec2 mouse_position) {
+void GLRenderer::pick_entity(glm::vec2 mouse_position,
+                             GLEntityPicker::Callback on_picked) {
   ZoneScoped;
-  auto pixels = m_gbuffer.read_pixels<glm::vec4, 1, 1>(
-      mouse_position.x, m_window_resolution.y - mouse_position.y, 5, GL_RGBA,
-      GL_FLOAT);
-  m_last_selected_entity = entt::entity(pixels[0][0] + pixels[0][1] * 256 +
-                                        pixels[0][2] * 256 * 256);
-
-  return m_last_selected_entity;
+  const glm::ivec2 pixel(mouse_position.x,
+                         m_window_resolution.y - mouse_position.y);
+  m_entity_picker.request(
+      pixel, [this, on_picked = std::move(on_picked)](entt::entity entity) {
+        m_last_selected_entity = entity;
+        if (on_picked) {
+          on_picked(entity);
+        }
+      });
 }
 
 void GLRenderer::on_imgui(AssetManager &am) {
@@ -513,6 +808,12 @@ void GLRenderer::on_imgui(AssetManager &am) {
     ImGui::Checkbox("Render Cone Tracing Pass NO TAA",
                     &m_debug_draw_cone_tracing_pass_no_taa);
     ImGui::Separator();
+    bool full_gbuffer =
+        m_gbuffer_layout == open_gl::tech::GBuffer::Layout::full;
+    if (ImGui::Checkbox("Full GBuffer Layout", &full_gbuffer)) {
+      m_gbuffer_layout = full_gbuffer ? open_gl::tech::GBuffer::Layout::full
+                                      : open_gl::tech::GBuffer::Layout::compact;
+    }
     ImGui::TreePop();
   }
   if (ImGui::TreeNode("Brightness / Contrast / Saturation")) {
@@ -530,6 +831,14 @@ void GLRenderer::on_imgui(AssetManager &am) {
     ImGui::DragFloat("Trace Distance", &m_vxgi_cone_trace_distance);
     ImGui::DragFloat("Diffuse / Spec Mix", &m_vxgi_diffuse_specular_mix, 1.0f,
                      0.0f, 1.0f);
+    ImGui::Checkbox("Low Quality Traces", &m_vxgi_low_quality);
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("Lighting Settings")) {
+    ImGui::Checkbox("Shadows", &m_lighting_shadows);
+    ImGui::SliderInt("Shadow PCF Radius", &m_lighting_shadow_pcf_radius, 0, 3);
+    ImGui::Text("Lighting Variants : %zu",
+                m_lighting_shader->m_data.m_variants.size());
     ImGui::TreePop();
   }
   if (ImGui::TreeNode("VXGI Voxel Grid Debug")) {
@@ -544,6 +853,182 @@ void GLRenderer::on_imgui(AssetManager &am) {
                       &m_voxel_data.current_bounding_box.m_max[0]);
     ImGui::TreePop();
   }
+  if (ImGui::TreeNode("Texture Streaming")) {
+    ImGui::Checkbox("Enabled", &GLTextureStreamer::s_enabled);
+    ImGui::DragInt("VRAM Budget (MB)", &GLTextureStreamer::s_vram_budget_mb, 1.0f,
+                   16, 16384);
+    ImGui::DragInt("Upload Per Frame (KB)",
+                   &GLTextureStreamer::s_upload_kb_per_frame, 16.0f, 64, 65536);
+    ImGui::Text("Resident : %.2f MB",
+                static_cast<double>(GLTextureStreamer::s_resident_bytes) /
+                    (1024.0 * 1024.0));
+    ImGui::Text("Uploads : %u Evictions : %u",
+                GLTextureStreamer::s_uploads_last_frame,
+                GLTextureStreamer::s_evictions_last_frame);
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("Material Table")) {
+    ImGui::Text("Mode : %s", m_material_table.m_bindless ? "Bindless"
+                                                         : "Texture Arrays");
+    ImGui::Text("Materials : %u Textures : %u",
+                m_material_table.m_material_count,
+                m_material_table.m_texture_count);
+    ImGui::Text("Templates : %zu Reflections : %u",
+                MaterialTemplate::s_templates.size(),
+                MaterialTemplate::s_reflection_count);
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("GPU Profiler")) {
+    ImGui::Checkbox("Enabled", &GLGpuProfiler::s_enabled);
+    ImGui::SliderFloat("Smoothing", &GLGpuProfiler::s_smoothing, 0.01f, 1.0f);
+    ImGui::Text("GPU Frame : %.3f ms (%.3f ms smoothed)",
+                GLGpuProfiler::s_frame_ms, GLGpuProfiler::s_smoothed_frame_ms);
+    ImGui::Text("Frames : %llu Skipped : %u",
+                static_cast<unsigned long long>(
+                    GLGpuProfiler::s_resolved_frames),
+                GLGpuProfiler::s_skipped_frames);
+    ImGui::PlotLines("##GPU Frame History",
+                     GLGpuProfiler::s_frame_history.data(),
+                     GLGpuProfiler::s_history_size,
+                     GLGpuProfiler::s_history_offset, "GPU Frame (ms)", 0.0f,
+                     FLT_MAX, ImVec2(0.0f, 60.0f));
+    if (ImGui::BeginTable("GPU Profiler Passes", 5,
+                          ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+      ImGui::TableSetupColumn("Pass");
+      ImGui::TableSetupColumn("Last (ms)");
+      ImGui::TableSetupColumn("Smoothed (ms)");
+      ImGui::TableSetupColumn("Max (ms)");
+      ImGui::TableSetupColumn("History");
+      ImGui::TableHeadersRow();
+      for (const GLGpuProfiler::PassTiming &pass : GLGpuProfiler::s_passes) {
+        if (!GLGpuProfiler::was_measured(pass)) {
+          continue;
+        }
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(pass.m_name.c_str());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", pass.m_last_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", pass.m_smoothed_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", pass.m_max_ms);
+        ImGui::TableNextColumn();
+        ImGui::PushID(pass.m_name.c_str());
+        ImGui::PlotLines("##History", pass.m_history.data(),
+                         GLGpuProfiler::s_history_size,
+                         GLGpuProfiler::s_history_offset, nullptr, 0.0f,
+                         FLT_MAX, ImVec2(120.0f, 0.0f));
+        ImGui::PopID();
+      }
+      ImGui::EndTable();
+    }
+    if (ImGui::Button("Save GPU Profile")) {
+      Utils::save_string_to_path("gpu_profile.json",
+                                 GLGpuProfiler::to_json().dump(2));
+    }
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("GL State")) {
+    ImGui::Checkbox("Skip Redundant Calls", &GLState::s_enabled);
+    const GLState::Counters &totals = GLState::s_last_frame_totals;
+    ImGui::Text("State Changes : %u Skipped : %u", totals.get_total(),
+                totals.m_skipped);
+    if (ImGui::BeginTable("GL State Passes", 8,
+                          ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+      ImGui::TableSetupColumn("Pass");
+      ImGui::TableSetupColumn("Program");
+      ImGui::TableSetupColumn("VAO");
+      ImGui::TableSetupColumn("FBO");
+      ImGui::TableSetupColumn("Texture");
+      ImGui::TableSetupColumn("Image");
+      ImGui::TableSetupColumn("Viewport / Enable");
+      ImGui::TableSetupColumn("Skipped");
+      ImGui::TableHeadersRow();
+      for (const auto &pass : GLState::s_last_frame_passes) {
+        const GLState::Counters &c = pass.m_counters;
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(pass.m_name.c_str());
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_program);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_vao);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_framebuffer);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_texture);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_image);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_viewport + c.m_enable);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", c.m_skipped);
+      }
+      ImGui::EndTable();
+    }
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("Draw List")) {
+    ImGui::Checkbox("Frustum Culling", &m_draw_list.m_frustum_culling);
+    ImGui::Checkbox("Occlusion Culling", &m_occlusion_culling);
+    ImGui::Checkbox("Multithreaded Recording", &m_draw_list.m_multithreaded);
+    ImGui::Text("Packets : %u Record Ranges : %u", m_draw_list.m_packet_count,
+                m_draw_list.m_record_ranges);
+    ImGui::BeginDisabled(!GLIndirectDraws::is_supported());
+    ImGui::Checkbox("GPU Driven GBuffer", &m_gpu_driven_gbuffer);
+    ImGui::EndDisabled();
+    if (m_gpu_driven_gbuffer) {
+      ImGui::Text("GPU Objects : %u Multi Draws : %u",
+                  m_indirect_draws.m_object_count,
+                  m_indirect_draws.m_batch_count);
+      ImGui::Text("GPU Culled : %u Occluded : %u Disoccluded : %u",
+                  m_indirect_draws.m_frustum_culled,
+                  m_indirect_draws.m_occluded,
+                  m_indirect_draws.m_disoccluded);
+    }
+    const char *pass_names[] = {"GBuffer", "GBuffer Textureless", "Shadow"};
+    for (u32 pass = 0; pass < GLDrawList::s_pass_count; pass++) {
+      const GLDrawList::PassStats &stats = m_draw_list.m_pass_stats[pass];
+      ImGui::Text("%s : %u visible %u culled %u occluded", pass_names[pass],
+                  stats.m_visible, stats.m_culled, stats.m_occluded);
+    }
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("Render Graph")) {
+    ImGui::Text("Live Passes : %u Culled : %u",
+                m_render_graph.m_live_pass_count,
+                m_render_graph.m_culled_pass_count);
+    ImGui::Text("Pooled Targets : %u", m_render_graph.m_pooled_target_count);
+    ImGui::Text("Transient Memory : %.2f MB (%.2f MB without aliasing)",
+                static_cast<float>(m_render_graph.m_pooled_bytes) /
+                    (1024.0f * 1024.0f),
+                static_cast<float>(m_render_graph.m_requested_bytes) /
+                    (1024.0f * 1024.0f));
+    ImGui::TreePop();
+  }
+  if (ImGui::TreeNode("Dynamic Resolution")) {
+    ImGui::Checkbox("Enabled", &m_dynamic_resolution.m_enabled);
+    ImGui::DragFloat("Target Frame (ms)",
+                     &m_dynamic_resolution.m_target_frame_ms, 0.1f, 1.0f,
+                     100.0f);
+    ImGui::Text("GPU Frame : %.2f ms", GLGpuProfiler::s_frame_ms);
+    ImGui::BeginDisabled(m_dynamic_resolution.m_enabled);
+    const DynamicResolution::Pass &vxgi =
+        m_dynamic_resolution.m_passes[p_vxgi_scale_pass];
+    const DynamicResolution::Pass &ssr =
+        m_dynamic_resolution.m_passes[p_ssr_scale_pass];
+    ImGui::SliderFloat("Cone Tracing Scale", &m_vxgi_resolution_scale,
+                       vxgi.m_min_scale, vxgi.m_max_scale);
+    ImGui::SliderFloat("SSR Scale", &m_ssr_resolution_scale, ssr.m_min_scale,
+                       ssr.m_max_scale);
+    ImGui::EndDisabled();
+    for (const DynamicResolution::Pass &pass : m_dynamic_resolution.m_passes) {
+      ImGui::Text("%s : %.2f scale %.2f ms", pass.m_name.c_str(), pass.m_scale,
+                  pass.m_gpu_ms);
+    }
+    ImGui::TreePop();
+  }
   if (ImGui::TreeNode("Denoise Settings")) {
     ImGui::DragFloat("Sigma", &m_denoise_sigma);
     ImGui::DragFloat("Threshold", &m_denoise_threshold);
@@ -1,17 +1,164 @@
 #include "gem/gl/gl_shader.h"
+#include "gem/gl/gl_program_cache.h"
+#include "gem/gl/gl_state.h"
 #include "gem/profile.h"
 #include "gem/utils.h"
 #include "gtc/type_ptr.hpp"
+#include "spdlog/spdlog.h"
+#include <algorithm>
 #include <array>
+#include <filesystem>
 #include <iostream>
 #include <sstream>
+#include <unordered_set>
 
 namespace gem {
 
+static constexpr u32 s_max_include_depth = 16;
+
+static std::string trim_whitespace(const std::string &input) {
+  const size_t start = input.find_first_not_of(" \t\r");
+  if (start == std::string::npos) {
+    return "";
+  }
+  const size_t end = input.find_last_not_of(" \t\r");
+  return input.substr(start, end - start + 1);
+}
+
+static bool is_stage_marker(const std::string &line) {
+  return line == "#vert" || line == "#frag" || line == "#geom" ||
+         line == "#compute";
+}
+
+static void preprocess_source(const std::string &source,
+                              const std::string &directory,
+                              std::unordered_set<std::string> &included,
+                              u32 depth, std::stringstream &output) {
+  if (depth > s_max_include_depth) {
+    spdlog::error("shader preprocess : include depth exceeded in {}",
+                  directory);
+    return;
+  }
+
+  std::stringstream input(source);
+  std::string line;
+  while (std::getline(input, line)) {
+    const std::string trimmed = trim_whitespace(line);
+
+    // every stage is compiled separately so needs its own copy of includes
+    if (depth == 0 && is_stage_marker(trimmed)) {
+      included.clear();
+    }
+
+    if (trimmed.rfind("#include", 0) == 0) {
+      const size_t open = trimmed.find('"');
+      const size_t close = trimmed.find('"', open + 1);
+      if (open == std::string::npos || close == std::string::npos) {
+        spdlog::error("shader preprocess : malformed include : {}", trimmed);
+        continue;
+      }
+      const std::string name = trimmed.substr(open + 1, close - open - 1);
+      std::string path = directory.empty() ? name : directory + "/" + name;
+      if (!std::filesystem::exists(path)) {
+        path = GLShader::s_include_directory + "/" + name;
+      }
+      if (!std::filesystem::exists(path)) {
+        spdlog::error("shader preprocess : could not resolve include {} from {}",
+                      name, directory);
+        continue;
+      }
+      const std::string canonical =
+          std::filesystem::weakly_canonical(path).string();
+      if (!included.insert(canonical).second) {
+        continue;
+      }
+      preprocess_source(Utils::load_string_from_path(path),
+                        Utils::get_directory_from_path(path), included,
+                        depth + 1, output);
+      continue;
+    }
+
+    if (trimmed.rfind("#pragma constant", 0) == 0) {
+      std::stringstream tokens(trimmed.substr(16));
+      std::string name;
+      tokens >> name;
+      std::string value;
+      std::getline(tokens, value);
+      value = trim_whitespace(value);
+      // variant defines are inserted after #version so take precedence
+      output << line << "\n#ifndef " << name << "\n#define " << name << " "
+             << value << "\n#endif\n";
+      continue;
+    }
+
+    output << line << "\n";
+  }
+}
+
+// matches the naming in tools/shader_compiler
+static gl_handle load_spirv_stage(const std::string &stage_source,
+                                  GLenum gl_stage) {
+  const std::string path =
+      fmt::format("{}/{:016x}.spv", GLShader::s_spirv_directory,
+                  HashUtils::get_string_hash(stage_source));
+  if (!std::filesystem::exists(path)) {
+    return INVALID_GL_HANDLE;
+  }
+
+  std::vector<u8> binary = Utils::load_binary_from_path(path);
+  gl_handle s = glCreateShader(gl_stage);
+  glShaderBinary(1, &s, GL_SHADER_BINARY_FORMAT_SPIR_V_ARB, binary.data(),
+                 static_cast<GLsizei>(binary.size()));
+  glSpecializeShaderARB(s, "main", 0, nullptr, nullptr);
+  return s;
+}
+
+static bool has_uniform_names(gl_handle program) {
+  GLint uniform_count = 0;
+  glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+  for (GLint i = 0; i < uniform_count; i++) {
+    const GLuint index = static_cast<GLuint>(i);
+    // includes the null terminator
+    GLint name_length = 0;
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_NAME_LENGTH,
+                          &name_length);
+    if (name_length <= 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void parse_permutation_keys(const std::string &source,
+                                   std::vector<std::string> &variant_keys,
+                                   std::vector<std::string> &constant_keys) {
+  std::stringstream input(source);
+  std::string line;
+  while (std::getline(input, line)) {
+    const std::string trimmed = trim_whitespace(line);
+    std::vector<std::string> *keys = nullptr;
+    if (trimmed.rfind("#pragma variant", 0) == 0) {
+      keys = &variant_keys;
+    } else if (trimmed.rfind("#pragma constant", 0) == 0) {
+      keys = &constant_keys;
+    } else {
+      continue;
+    }
+    std::stringstream tokens(trimmed);
+    std::string pragma, kind, name;
+    tokens >> pragma >> kind >> name;
+    if (!name.empty() &&
+        std::find(keys->begin(), keys->end(), name) == keys->end()) {
+      keys->push_back(name);
+    }
+  }
+}
+
 GLShader::GLShader(const std::string &comp) {
   ZoneScoped;
   auto c = compile_shader(comp, GL_COMPUTE_SHADER);
   m_shader_id = link_shader(c);
+  reflect_uniforms();
 
   glDeleteShader(c);
 }
@@ -22,6 +169,7 @@ GLShader::GLShader(const std::string &vert, const std::string &frag) {
   auto f = compile_shader(frag, GL_FRAGMENT_SHADER);
 
   m_shader_id = link_shader(v, f);
+  reflect_uniforms();
 
   glDeleteShader(v);
   glDeleteShader(f);
@@ -35,6 +183,7 @@ GLShader::GLShader(const std::string &vert, const std::string &geom,
   auto f = compile_shader(frag, GL_FRAGMENT_SHADER);
 
   m_shader_id = link_shader(v, g, f);
+  reflect_uniforms();
 
   glDeleteShader(v);
   glDeleteShader(g);
@@ -43,79 +192,190 @@ GLShader::GLShader(const std::string &vert, const std::string &geom,
 
 void GLShader::use() {
   ZoneScoped;
-  glUseProgram(m_shader_id);
+  GLState::use_program(m_shader_id);
 }
 
 void GLShader::release() {
   ZoneScoped;
+  // the name may be reused by the next program created
+  GLState::invalidate();
   glDeleteProgram(m_shader_id);
+  for (auto &[key, variant] : m_variants) {
+    variant->release();
+  }
+  m_variants.clear();
 }
 
-void GLShader::set_bool(const std::string &name, bool value) const {
+GLShader &GLShader::get_variant(const std::vector<Define> &defines) {
   ZoneScoped;
-  glUniform1i(glGetUniformLocation(m_shader_id, name.c_str()), (int)value);
+  if (defines.empty()) {
+    return *this;
+  }
+
+  std::vector<Define> sorted = defines;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Define &a, const Define &b) { return a.m_name < b.m_name; });
+  std::string prelude;
+  for (const Define &define : sorted) {
+    prelude += "#define " + define.m_name + " " + define.m_value + "\n";
+  }
+
+  const u64 key = HashUtils::get_string_hash(prelude);
+  auto it = m_variants.find(key);
+  if (it != m_variants.end()) {
+    return *it->second;
+  }
+
+  if (m_source.empty()) {
+    spdlog::warn("shader variant : shader {} has no source to compile "
+                 "variants from",
+                 m_shader_id);
+    return *this;
+  }
+
+  for (const Define &define : sorted) {
+    const bool declared =
+        std::find(m_variant_keys.begin(), m_variant_keys.end(),
+                  define.m_name) != m_variant_keys.end() ||
+        std::find(m_constant_keys.begin(), m_constant_keys.end(),
+                  define.m_name) != m_constant_keys.end();
+    if (!declared) {
+      spdlog::warn("shader variant : {} is not declared with #pragma variant "
+                   "or #pragma constant",
+                   define.m_name);
+    }
+  }
+
+  auto variant =
+      std::make_shared<GLShader>(create_from_composite(m_source, prelude));
+  m_variants.emplace(key, variant);
+  return *variant;
 }
 
-void GLShader::set_int(const std::string &name, int value) const {
+std::string GLShader::preprocess(const std::string &source,
+                                 const std::string &path) {
   ZoneScoped;
-  glUniform1i(glGetUniformLocation(m_shader_id, name.c_str()), value);
+  std::unordered_set<std::string> included{};
+  std::stringstream output{};
+  preprocess_source(source, Utils::get_directory_from_path(path), included, 0,
+                    output);
+  return output.str();
+}
+
+i32 GLShader::get_uniform_location(HashString name) const {
+  auto it = m_uniforms.find(name.m_value);
+  if (it == m_uniforms.end()) {
+    return -1;
+  }
+  return it->second.m_location;
 }
 
-void GLShader::set_uint(const std::string &name, unsigned int value) const {
+void GLShader::reflect_uniforms() {
   ZoneScoped;
-  glUniform1ui(glGetUniformLocation(m_shader_id, name.c_str()), value);
+  m_uniforms.clear();
+  GLint uniform_count = 0;
+  GLint max_name_length = 0;
+  glGetProgramiv(m_shader_id, GL_ACTIVE_UNIFORMS, &uniform_count);
+  glGetProgramiv(m_shader_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+
+  std::string name(static_cast<size_t>(std::max(max_name_length, 1)), '\0');
+  for (GLint i = 0; i < uniform_count; i++) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    glGetActiveUniform(m_shader_id, static_cast<GLuint>(i), max_name_length,
+                       &length, &size, &type, name.data());
+    std::string uname = name.substr(0, length);
+    const uniform_type utype = get_type_from_gl(type);
+
+    // block members have no location
+    const GLint location = glGetUniformLocation(m_shader_id, uname.c_str());
+    if (location < 0) {
+      continue;
+    }
+
+    // arrays of basic types report "name[0]", register "name" and each element
+    const size_t array_pos = uname.rfind("[0]");
+    if (array_pos != std::string::npos && array_pos + 3 == uname.size()) {
+      const std::string base = uname.substr(0, array_pos);
+      m_uniforms[HashString(base).m_value] = UniformInfo{location, utype};
+      for (GLint element = 0; element < size; element++) {
+        const std::string element_name =
+            base + "[" + std::to_string(element) + "]";
+        m_uniforms[HashString(element_name).m_value] = UniformInfo{
+            glGetUniformLocation(m_shader_id, element_name.c_str()), utype};
+      }
+      continue;
+    }
+    m_uniforms[HashString(uname).m_value] = UniformInfo{location, utype};
+  }
+}
+
+void GLShader::set_bool(HashString name, bool value) const {
+  ZoneScoped;
+  glUniform1i(get_uniform_location(name), (int)value);
 }
 
-void GLShader::set_float(const std::string &name, float value) const {
+void GLShader::set_int(HashString name, int value) const {
   ZoneScoped;
-  glUniform1f(glGetUniformLocation(m_shader_id, name.c_str()), value);
+  glUniform1i(get_uniform_location(name), value);
 }
 
-void GLShader::set_vec2(const std::string &name, glm::vec2 value) const {
+void GLShader::set_uint(HashString name, unsigned int value) const {
   ZoneScoped;
-  glUniform2f(glGetUniformLocation(m_shader_id, name.c_str()), value.x,
+  glUniform1ui(get_uniform_location(name), value);
+}
+
+void GLShader::set_float(HashString name, float value) const {
+  ZoneScoped;
+  glUniform1f(get_uniform_location(name), value);
+}
+
+void GLShader::set_vec2(HashString name, glm::vec2 value) const {
+  ZoneScoped;
+  glUniform2f(get_uniform_location(name), value.x,
               value.y);
 }
 
-void GLShader::set_vec3(const std::string &name, glm::vec3 value) const {
+void GLShader::set_vec3(HashString name, glm::vec3 value) const {
   ZoneScoped;
-  glUniform3f(glGetUniformLocation(m_shader_id, name.c_str()), value.x, value.y,
+  glUniform3f(get_uniform_location(name), value.x, value.y,
               value.z);
 }
 
-void GLShader::set_vec4(const std::string &name, glm::vec4 value) const {
+void GLShader::set_vec4(HashString name, glm::vec4 value) const {
   ZoneScoped;
-  glUniform4f(glGetUniformLocation(m_shader_id, name.c_str()), value.x, value.y,
+  glUniform4f(get_uniform_location(name), value.x, value.y,
               value.z, value.w);
 }
 
-void GLShader::set_ivec2(const std::string &name, glm::ivec2 value) const {
+void GLShader::set_ivec2(HashString name, glm::ivec2 value) const {
   ZoneScoped;
-  glUniform2i(glGetUniformLocation(m_shader_id, name.c_str()), value.x,
+  glUniform2i(get_uniform_location(name), value.x,
               value.y);
 }
 
-void GLShader::set_ivec3(const std::string &name, glm::ivec3 value) const {
+void GLShader::set_ivec3(HashString name, glm::ivec3 value) const {
   ZoneScoped;
-  glUniform3i(glGetUniformLocation(m_shader_id, name.c_str()), value.x, value.y,
+  glUniform3i(get_uniform_location(name), value.x, value.y,
               value.z);
 }
 
-void GLShader::set_ivec4(const std::string &name, glm::ivec4 value) const {
+void GLShader::set_ivec4(HashString name, glm::ivec4 value) const {
   ZoneScoped;
-  glUniform4i(glGetUniformLocation(m_shader_id, name.c_str()), value.x, value.y,
+  glUniform4i(get_uniform_location(name), value.x, value.y,
               value.z, value.w);
 }
 
-void GLShader::set_mat3(const std::string &name, glm::mat3 value) const {
+void GLShader::set_mat3(HashString name, glm::mat3 value) const {
   ZoneScoped;
-  glUniformMatrix3fv(glGetUniformLocation(m_shader_id, name.c_str()), 1,
+  glUniformMatrix3fv(get_uniform_location(name), 1,
                      GL_FALSE, glm::value_ptr(value));
 }
 
-void GLShader::set_mat4(const std::string &name, glm::mat4 value) const {
+void GLShader::set_mat4(HashString name, glm::mat4 value) const {
   ZoneScoped;
-  glUniformMatrix4fv(glGetUniformLocation(m_shader_id, name.c_str()), 1,
+  glUniformMatrix4fv(get_uniform_location(name), 1,
                      GL_FALSE, glm::value_ptr(value));
 }
 
@@ -144,6 +404,7 @@ int GLShader::link_shader(gl_handle comp) {
   ZoneScoped;
   auto prog_id = glCreateProgram();
   glAttachShader(prog_id, comp);
+  glProgramParameteri(prog_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
   glLinkProgram(prog_id);
 
   int success = 0;
@@ -164,6 +425,7 @@ int GLShader::link_shader(gl_handle vert, gl_handle frag) {
   auto prog_id = glCreateProgram();
   glAttachShader(prog_id, vert);
   glAttachShader(prog_id, frag);
+  glProgramParameteri(prog_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
   glLinkProgram(prog_id);
 
   int success = 0;
@@ -185,6 +447,7 @@ int GLShader::link_shader(gl_handle vert, gl_handle geom, gl_handle frag) {
   glAttachShader(prog_id, vert);
   glAttachShader(prog_id, geom);
   glAttachShader(prog_id, frag);
+  glProgramParameteri(prog_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
   glLinkProgram(prog_id);
 
   int success = 0;
@@ -201,7 +464,8 @@ int GLShader::link_shader(gl_handle vert, gl_handle geom, gl_handle frag) {
 }
 
 std::unordered_map<GLShader::stage, std::string>
-GLShader::split_composite_shader(const std::string &input) {
+GLShader::split_composite_shader(const std::string &input,
+                                 const std::string &prelude) {
   ZoneScoped;
   static std::unordered_map<std::string, GLShader::stage> s_known_stages = {
       {"#frag", GLShader::stage::fragment},
@@ -221,7 +485,7 @@ GLShader::split_composite_shader(const std::string &input) {
   while (std::getline(input_stream, line)) {
     if (line.find("#version") != std::string::npos) {
       version = line;
-      stage_stream << version << "\n";
+      stage_stream << version << "\n" << prelude;
       continue;
     }
 
@@ -232,7 +496,7 @@ GLShader::split_composite_shader(const std::string &input) {
                          std::string(stage_stream.str()));
           stage_stream.str(std::string());
           stage_stream.clear();
-          stage_stream << version << "\n";
+          stage_stream << version << "\n" << prelude;
         }
 
         stage = known;
@@ -255,29 +519,165 @@ GLShader::split_composite_shader(const std::string &input) {
   return stages;
 }
 
-GLShader GLShader::create_from_composite(const std::string &composite_shader) {
+GLShader GLShader::create_from_composite(const std::string &composite_shader,
+                                         const std::string &prelude) {
+  ZoneScoped;
+  PendingLink pending = begin_composite(composite_shader, prelude);
+  return finish_composite(pending);
+}
+
+GLShader::PendingLink
+GLShader::begin_composite(const std::string &composite_shader,
+                          const std::string &prelude, bool allow_spirv) {
+  ZoneScoped;
+  PendingLink pending{};
+  pending.m_source = composite_shader;
+  pending.m_prelude = prelude;
+  // keyed on the final source so each variant gets its own cache entry
+  pending.m_cache_key = GLProgramCache::get_key(prelude + composite_shader);
+  pending.m_program = GLProgramCache::load(pending.m_cache_key);
+  if (pending.m_program != INVALID_GL_HANDLE) {
+    pending.m_from_cache = true;
+    return pending;
+  }
+
   std::unordered_map<GLShader::stage, std::string> stages =
-      GLShader::split_composite_shader(composite_shader);
+      GLShader::split_composite_shader(composite_shader, prelude);
 
+  std::vector<std::pair<GLShader::stage, GLenum>> stage_types{};
   if (stages.find(GLShader::stage::compute) != stages.end()) {
-    return GLShader(stages[GLShader::stage::compute]);
+    stage_types = {{GLShader::stage::compute, GL_COMPUTE_SHADER}};
+  } else if (stages.find(GLShader::stage::vertex) != stages.end() &&
+             stages.find(GLShader::stage::fragment) != stages.end()) {
+    stage_types = {{GLShader::stage::vertex, GL_VERTEX_SHADER},
+                   {GLShader::stage::fragment, GL_FRAGMENT_SHADER}};
+    if (stages.find(GLShader::stage::geometry) != stages.end()) {
+      stage_types.push_back({GLShader::stage::geometry, GL_GEOMETRY_SHADER});
+    }
+  } else {
+    spdlog::error("shader : composite source has no usable stages");
+    return pending;
+  }
+
+  if (s_spirv && allow_spirv) {
+    for (auto &[stage_enum, gl_stage] : stage_types) {
+      gl_handle s = load_spirv_stage(stages[stage_enum], gl_stage);
+      if (s == INVALID_GL_HANDLE) {
+        break;
+      }
+      pending.m_stages.push_back(s);
+    }
+    // every stage or none, a program can't mix SPIR-V and GLSL stages
+    pending.m_spirv = pending.m_stages.size() == stage_types.size();
+    if (!pending.m_spirv) {
+      for (gl_handle s : pending.m_stages) {
+        glDeleteShader(s);
+      }
+      pending.m_stages.clear();
+    }
+  }
+
+  if (!pending.m_spirv) {
+    for (auto &[stage_enum, gl_stage] : stage_types) {
+      const char *src = stages[stage_enum].c_str();
+      gl_handle s = glCreateShader(gl_stage);
+      glShaderSource(s, 1, &src, NULL);
+      glCompileShader(s);
+      pending.m_stages.push_back(s);
+    }
+  }
+
+  pending.m_program = glCreateProgram();
+  for (gl_handle s : pending.m_stages) {
+    glAttachShader(pending.m_program, s);
+  }
+  glProgramParameteri(pending.m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                      GL_TRUE);
+  glLinkProgram(pending.m_program);
+  return pending;
+}
+
+bool GLShader::is_link_complete(const PendingLink &pending) {
+  ZoneScoped;
+  if (!s_parallel_compile || pending.m_from_cache ||
+      pending.m_program == INVALID_GL_HANDLE) {
+    return true;
+  }
+  GLint complete = GL_FALSE;
+  glGetProgramiv(pending.m_program, GL_COMPLETION_STATUS_KHR, &complete);
+  return complete == GL_TRUE;
+}
+
+GLShader GLShader::finish_composite(PendingLink &pending) {
+  ZoneScoped;
+  GLShader shader{};
+  if (pending.m_program == INVALID_GL_HANDLE) {
+    return shader;
+  }
+
+  for (gl_handle s : pending.m_stages) {
+    int success = 0;
+    glGetShaderiv(s, GL_COMPILE_STATUS, &success);
+    if (!success) {
+      char infoLog[512];
+      glGetShaderInfoLog(s, 512, NULL, infoLog);
+      std::cout << "ERROR::SHADER::COMPILATION_FAILED\n"
+                << infoLog << std::endl;
+    }
+    glDetachShader(pending.m_program, s);
+    glDeleteShader(s);
+  }
+  pending.m_stages.clear();
+
+  int success = 0;
+  glGetProgramiv(pending.m_program, GL_LINK_STATUS, &success);
+  if (pending.m_spirv && (!success || !has_uniform_names(pending.m_program))) {
+    // uniforms are set by name so a driver that drops SPIR-V debug names
+    // can't use the binary, fall back to the GLSL front end
+    spdlog::warn("shader : SPIR-V program unusable, compiling from GLSL");
+    glDeleteProgram(pending.m_program);
+    pending.m_program = INVALID_GL_HANDLE;
+    PendingLink glsl =
+        begin_composite(pending.m_source, pending.m_prelude, false);
+    return finish_composite(glsl);
   }
 
-  if (stages.find(GLShader::stage::vertex) != stages.end() &&
-      stages.find(GLShader::stage::fragment) != stages.end() &&
-      stages.find(GLShader::stage::geometry) == stages.end()) {
-    return GLShader(stages[GLShader::stage::vertex],
-                     stages[GLShader::stage::fragment]);
+  if (!success) {
+    char infoLog[512];
+    glGetProgramInfoLog(pending.m_program, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
+              << infoLog << std::endl;
+  } else if (!pending.m_from_cache) {
+    GLProgramCache::store(pending.m_cache_key, pending.m_program);
   }
 
-  if (stages.find(GLShader::stage::vertex) != stages.end() &&
-      stages.find(GLShader::stage::fragment) != stages.end() &&
-      stages.find(GLShader::stage::geometry) != stages.end()) {
-    return GLShader(stages[GLShader::stage::vertex],
-                     stages[GLShader::stage::geometry],
-                     stages[GLShader::stage::fragment]);
+  shader.m_shader_id = pending.m_program;
+  shader.reflect_uniforms();
+  shader.m_source = pending.m_source;
+  parse_permutation_keys(pending.m_source, shader.m_variant_keys,
+                         shader.m_constant_keys);
+  pending.m_program = INVALID_GL_HANDLE;
+  return shader;
+}
+
+void GLShader::init_parallel_compile() {
+  ZoneScoped;
+  // both extensions share the same enums
+  if (GLEW_KHR_parallel_shader_compile) {
+    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    s_parallel_compile = true;
+  } else if (GLEW_ARB_parallel_shader_compile) {
+    glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    s_parallel_compile = true;
   }
-  return {};
+  spdlog::info("shader : parallel compile {}",
+               s_parallel_compile ? "enabled" : "unavailable");
+}
+
+void GLShader::init_spirv() {
+  ZoneScoped;
+  s_spirv = GLEW_ARB_gl_spirv && std::filesystem::exists(s_spirv_directory);
+  spdlog::info("shader : SPIR-V stages {}", s_spirv ? "enabled" : "unavailable");
 }
 
 GLShader::uniform_type GLShader::get_type_from_gl(GLenum type) {
@@ -0,0 +1,166 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_state.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/profile.h"
+
+namespace gem {
+
+GLState::Counters GLState::s_last_frame_totals{};
+
+GLState::Counters &GLState::get_counters() {
+  if (s_passes.empty()) {
+    s_passes.push_back(PassCounters{"Frame", Counters{}});
+  }
+  return s_passes.back().m_counters;
+}
+
+void GLState::use_program(gl_handle program) {
+  if (s_enabled && s_program == program) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glUseProgram(program));
+  s_program = program;
+  get_counters().m_program++;
+}
+
+void GLState::bind_vertex_array(gl_handle vao) {
+  if (s_enabled && s_vao == vao) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glBindVertexArray(vao));
+  s_vao = vao;
+  get_counters().m_vao++;
+}
+
+void GLState::bind_framebuffer(gl_handle framebuffer) {
+  if (framebuffer == 0) {
+    framebuffer = s_default_framebuffer;
+  }
+  if (s_enabled && s_framebuffer == framebuffer) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+  s_framebuffer = framebuffer;
+  get_counters().m_framebuffer++;
+}
+
+void GLState::bind_texture(u32 unit, gl_handle texture) {
+  if (unit >= s_texture_units) {
+    glAssert(glBindTextureUnit(unit, texture));
+    get_counters().m_texture++;
+    return;
+  }
+  if (s_enabled && s_textures[unit] == texture) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glBindTextureUnit(unit, texture));
+  s_textures[unit] = texture;
+  get_counters().m_texture++;
+}
+
+void GLState::bind_image(u32 unit, gl_handle texture, u32 level, bool layered,
+                         u32 layer, GLenum access, GLenum format) {
+  const ImageBinding binding{texture, level, layered, layer, access, format};
+  if (unit < s_image_units && s_enabled && s_images[unit] == binding) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glBindImageTexture(unit, texture, static_cast<GLint>(level),
+                              layered ? GL_TRUE : GL_FALSE,
+                              static_cast<GLint>(layer), access, format));
+  if (unit < s_image_units) {
+    s_images[unit] = binding;
+  }
+  get_counters().m_image++;
+}
+
+void GLState::set_viewport(glm::ivec4 viewport) {
+  if (s_enabled && s_viewport == viewport) {
+    get_counters().m_skipped++;
+    return;
+  }
+  glAssert(glViewport(viewport.x, viewport.y, viewport.z, viewport.w));
+  s_viewport = viewport;
+  get_counters().m_viewport++;
+}
+
+void GLState::set_enabled(GLenum capability, bool enabled) {
+  Capability *cached = nullptr;
+  for (Capability &cap : s_capabilities) {
+    if (cap.m_capability == capability) {
+      cached = &cap;
+      break;
+    }
+  }
+  if (cached == nullptr) {
+    s_capabilities.push_back(Capability{capability, -1});
+    cached = &s_capabilities.back();
+  }
+
+  const i32 value = enabled ? 1 : 0;
+  if (s_enabled && cached->m_enabled == value) {
+    get_counters().m_skipped++;
+    return;
+  }
+  if (enabled) {
+    glAssert(glEnable(capability));
+  } else {
+    glAssert(glDisable(capability));
+  }
+  cached->m_enabled = value;
+  get_counters().m_enable++;
+}
+
+void GLState::invalidate() {
+  ZoneScoped;
+  s_program = INVALID_GL_HANDLE;
+  s_vao = INVALID_GL_HANDLE;
+  s_framebuffer = INVALID_GL_HANDLE;
+  s_textures.fill(INVALID_GL_HANDLE);
+  s_images.fill(ImageBinding{INVALID_GL_HANDLE, 0, false, 0, GL_NONE, GL_NONE});
+  s_viewport = glm::ivec4(-1);
+  for (Capability &cap : s_capabilities) {
+    cap.m_enabled = -1;
+  }
+}
+
+void GLState::invalidate_texture_unit(u32 unit) {
+  if (unit < s_texture_units) {
+    s_textures[unit] = INVALID_GL_HANDLE;
+  }
+}
+
+void GLState::begin_pass(const char *name) {
+  s_passes.push_back(PassCounters{name, Counters{}});
+}
+
+void GLState::end_frame() {
+  ZoneScoped;
+  Counters totals{};
+  for (const PassCounters &pass : s_passes) {
+    totals.m_program += pass.m_counters.m_program;
+    totals.m_vao += pass.m_counters.m_vao;
+    totals.m_framebuffer += pass.m_counters.m_framebuffer;
+    totals.m_texture += pass.m_counters.m_texture;
+    totals.m_image += pass.m_counters.m_image;
+    totals.m_viewport += pass.m_counters.m_viewport;
+    totals.m_enable += pass.m_counters.m_enable;
+    totals.m_skipped += pass.m_counters.m_skipped;
+  }
+
+  TracyPlot("GL State Changes", static_cast<int64_t>(totals.get_total()));
+  TracyPlot("GL Program Changes", static_cast<int64_t>(totals.m_program));
+  TracyPlot("GL VAO Changes", static_cast<int64_t>(totals.m_vao));
+  TracyPlot("GL Texture Changes", static_cast<int64_t>(totals.m_texture));
+  TracyPlot("GL Redundant Binds Skipped",
+            static_cast<int64_t>(totals.m_skipped));
+
+  s_last_frame_totals = totals;
+  s_last_frame_passes.swap(s_passes);
+  s_passes.clear();
+}
+} // namespace gem
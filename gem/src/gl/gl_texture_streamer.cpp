@@ -0,0 +1,290 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/gl_texture_streamer.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/profile.h"
+#include "gem/texture.h"
+#include "gem/texture_compression.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace gem {
+
+u64 get_resident_bytes(Texture *texture) {
+  u64 bytes = 0;
+  const i32 level_count =
+      static_cast<i32>(texture->m_cpu_data.mip_chain->m_levels.size());
+  for (i32 level = texture->m_stream_resident_level; level < level_count;
+       level++) {
+    bytes += texture->get_mip_level_size(level);
+  }
+  return bytes;
+}
+
+void GLTextureStreamer::init() {
+  ZoneScoped;
+  for (auto &frame : s_feedback_frames) {
+    glAssert(glCreateBuffers(1, &frame.m_ssbo));
+    glAssert(glNamedBufferStorage(frame.m_ssbo,
+                                  sizeof(u32) * s_max_feedback_slots, nullptr,
+                                  GL_DYNAMIC_STORAGE_BIT | GL_MAP_READ_BIT));
+    frame.m_fence = nullptr;
+  }
+  s_feedback_write_index = 0;
+}
+
+void GLTextureStreamer::cleanup() {
+  ZoneScoped;
+  for (auto &frame : s_feedback_frames) {
+    if (frame.m_fence) {
+      glDeleteSync(frame.m_fence);
+      frame.m_fence = nullptr;
+    }
+    if (frame.m_ssbo != 0) {
+      glDeleteBuffers(1, &frame.m_ssbo);
+      frame.m_ssbo = 0;
+    }
+    frame.m_slot_textures.clear();
+    frame.m_slot_offsets.clear();
+  }
+}
+
+i32 GLTextureStreamer::get_tail_level(const TextureMipChain &chain) {
+  const i32 level_count = static_cast<i32>(chain.m_levels.size());
+  for (i32 level = 0; level < level_count; level++) {
+    const TextureMip &mip = chain.m_levels[level];
+    if (std::max(mip.m_width, mip.m_height) <= s_tail_dimension) {
+      return level;
+    }
+  }
+  return level_count - 1;
+}
+
+void GLTextureStreamer::register_texture(Texture *texture) {
+  ZoneScoped;
+  if (s_textures.insert(texture).second) {
+    texture->m_stream_last_seen_frame = s_frame;
+    s_resident_bytes += get_resident_bytes(texture);
+  }
+}
+
+void GLTextureStreamer::unregister_texture(Texture *texture) {
+  ZoneScoped;
+  if (s_textures.erase(texture) > 0) {
+    s_resident_bytes -= get_resident_bytes(texture);
+  }
+}
+
+void GLTextureStreamer::begin_feedback() {
+  ZoneScoped;
+  FeedbackFrame &frame = s_feedback_frames[s_feedback_write_index];
+  // the oldest frame has not been read back yet, skip feedback this frame
+  s_feedback_active = s_enabled && frame.m_ssbo != 0 &&
+                      frame.m_fence == nullptr;
+  if (!s_feedback_active) {
+    return;
+  }
+
+  frame.m_slot_textures.clear();
+  frame.m_slot_offsets.clear();
+  const u32 clear_value = s_invalid_feedback;
+  glAssert(glClearNamedBufferData(frame.m_ssbo, GL_R32UI, GL_RED_INTEGER,
+                                  GL_UNSIGNED_INT, &clear_value));
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_feedback_binding,
+                            frame.m_ssbo));
+}
+
+i32 GLTextureStreamer::add_feedback_draw(Texture *const *textures,
+                                         u32 texture_count) {
+  ZoneScoped;
+  if (!s_feedback_active) {
+    return -1;
+  }
+
+  FeedbackFrame &frame = s_feedback_frames[s_feedback_write_index];
+  if (frame.m_slot_offsets.size() >= s_max_feedback_slots) {
+    return -1;
+  }
+
+  const u32 first = static_cast<u32>(frame.m_slot_textures.size());
+  for (u32 i = 0; i < texture_count; i++) {
+    Texture *texture = textures[i];
+    if (texture != nullptr && s_textures.find(texture) != s_textures.end()) {
+      frame.m_slot_textures.push_back(texture);
+    }
+  }
+
+  if (frame.m_slot_textures.size() == first) {
+    return -1;
+  }
+
+  frame.m_slot_offsets.push_back(first);
+  return static_cast<i32>(frame.m_slot_offsets.size() - 1);
+}
+
+void GLTextureStreamer::end_feedback() {
+  ZoneScoped;
+  if (!s_feedback_active) {
+    return;
+  }
+
+  FeedbackFrame &frame = s_feedback_frames[s_feedback_write_index];
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_feedback_binding, 0));
+  frame.m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  s_feedback_write_index =
+      (s_feedback_write_index + 1) % static_cast<u32>(s_feedback_frames.size());
+  s_feedback_active = false;
+}
+
+void GLTextureStreamer::read_feedback(FeedbackFrame &frame) {
+  ZoneScoped;
+  const u32 slot_count = static_cast<u32>(frame.m_slot_offsets.size());
+  s_feedback.assign(slot_count, s_invalid_feedback);
+  if (slot_count > 0) {
+    glAssert(glGetNamedBufferSubData(frame.m_ssbo, 0, sizeof(u32) * slot_count,
+                                     s_feedback.data()));
+  }
+
+  // finest level requested for each texture across every draw using it
+  std::unordered_map<Texture *, i32> &requested = s_requested;
+  requested.clear();
+  for (u32 slot = 0; slot < slot_count; slot++) {
+    if (s_feedback[slot] == s_invalid_feedback) {
+      continue;
+    }
+    // matches the encoding in gbuffer.shader
+    const float uv_lod = static_cast<float>(s_feedback[slot]) / 16.0f - 32.0f;
+
+    const u32 end = slot + 1 < slot_count
+                        ? frame.m_slot_offsets[slot + 1]
+                        : static_cast<u32>(frame.m_slot_textures.size());
+    for (u32 i = frame.m_slot_offsets[slot]; i < end; i++) {
+      Texture *texture = frame.m_slot_textures[i];
+      if (s_textures.find(texture) == s_textures.end()) {
+        continue;
+      }
+      const float size =
+          static_cast<float>(std::max(texture->m_width, texture->m_height));
+      const i32 tail =
+          get_tail_level(*texture->m_cpu_data.mip_chain);
+      const i32 level = std::clamp(
+          static_cast<i32>(std::floor(uv_lod + std::log2(size))), 0, tail);
+
+      auto it = requested.find(texture);
+      if (it == requested.end()) {
+        requested.emplace(texture, level);
+      } else {
+        it->second = std::min(it->second, level);
+      }
+    }
+  }
+
+  for (auto &[texture, level] : requested) {
+    texture->m_stream_requested_level = level;
+    texture->m_stream_last_seen_frame = s_frame;
+  }
+  frame.m_slot_textures.clear();
+  frame.m_slot_offsets.clear();
+}
+
+bool GLTextureStreamer::evict_one(bool needed_only) {
+  // prefer textures holding more than they asked for, then least recently seen
+  Texture *victim = nullptr;
+  for (Texture *texture : s_textures) {
+    const i32 tail = get_tail_level(*texture->m_cpu_data.mip_chain);
+    if (texture->m_stream_resident_level >= tail) {
+      continue;
+    }
+    const bool over_resident =
+        texture->m_stream_resident_level < texture->m_stream_requested_level;
+    if (needed_only && !over_resident) {
+      continue;
+    }
+    if (victim == nullptr ||
+        texture->m_stream_last_seen_frame < victim->m_stream_last_seen_frame) {
+      victim = texture;
+    }
+  }
+
+  if (victim == nullptr) {
+    return false;
+  }
+
+  const i32 level = victim->m_stream_resident_level;
+  s_resident_bytes -= victim->get_mip_level_size(level);
+  victim->evict_mip_level(level);
+  s_evictions_last_frame++;
+  return true;
+}
+
+void GLTextureStreamer::update() {
+  ZoneScoped;
+  s_frame++;
+  s_uploads_last_frame = 0;
+  s_evictions_last_frame = 0;
+
+  for (auto &frame : s_feedback_frames) {
+    if (frame.m_fence == nullptr) {
+      continue;
+    }
+    GLenum status = glClientWaitSync(frame.m_fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+      continue;
+    }
+    read_feedback(frame);
+    glDeleteSync(frame.m_fence);
+    frame.m_fence = nullptr;
+  }
+
+  if (!s_enabled) {
+    return;
+  }
+
+  std::vector<Texture *> wants_upload;
+  for (Texture *texture : s_textures) {
+    if (s_frame - texture->m_stream_last_seen_frame > s_unused_frames) {
+      texture->m_stream_requested_level =
+          get_tail_level(*texture->m_cpu_data.mip_chain);
+    }
+    if (texture->m_stream_requested_level < texture->m_stream_resident_level) {
+      wants_upload.push_back(texture);
+    }
+  }
+
+  const u64 budget = static_cast<u64>(s_vram_budget_mb) * 1024 * 1024;
+  while (s_resident_bytes > budget && evict_one(false)) {
+  }
+
+  // biggest deficit first, one level per texture per frame
+  std::sort(wants_upload.begin(), wants_upload.end(),
+            [](Texture *a, Texture *b) {
+              return (a->m_stream_resident_level -
+                      a->m_stream_requested_level) >
+                     (b->m_stream_resident_level -
+                      b->m_stream_requested_level);
+            });
+
+  u64 uploaded = 0;
+  const u64 upload_limit = static_cast<u64>(s_upload_kb_per_frame) * 1024;
+  for (Texture *texture : wants_upload) {
+    const i32 level = texture->m_stream_resident_level - 1;
+    const u64 size = texture->get_mip_level_size(level);
+    if (uploaded > 0 && uploaded + size > upload_limit) {
+      break;
+    }
+
+    bool fits = s_resident_bytes + size <= budget;
+    while (!fits && evict_one(true)) {
+      fits = s_resident_bytes + size <= budget;
+    }
+    if (!fits) {
+      continue;
+    }
+
+    texture->upload_mip_level(level);
+    s_resident_bytes += size;
+    uploaded += size;
+    s_uploads_last_frame++;
+  }
+}
+} // namespace gem
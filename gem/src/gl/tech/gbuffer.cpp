@@ -1,115 +1,230 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "gem/gl/tech/gbuffer.h"
-#include "gem/camera.h"
+#include "gem/gl/gl_constant_ring.h"
 #include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_indirect_draws.h"
+#include "gem/gl/gl_state.h"
+#include "gem/gl/gl_material_table.h"
+#include "gem/gl/gl_occlusion_queries.h"
+#include "gem/gl/gl_texture_streamer.h"
 #include "gem/material.h"
 #include "gem/mesh.h"
 #include "gem/profile.h"
-#include "gem/scene.h"
 #include "gem/transform.h"
 namespace gem {
 namespace open_gl {
 
+GLFramebuffer tech::GBuffer::create_gbuffer(glm::vec2 resolution,
+                                            Layout layout) {
+  ZoneScoped;
+  // attachment order must match the outputs of gbuffer.shader
+  if (layout == Layout::compact) {
+    return GLFramebuffer::create(
+        resolution,
+        {
+            {GL_RGBA, GL_SRGB8_ALPHA8, GL_LINEAR, GL_UNSIGNED_BYTE},
+            {GL_RG, GL_RG16, GL_NEAREST, GL_UNSIGNED_SHORT},
+            {GL_RGBA, GL_RGBA8, GL_LINEAR, GL_UNSIGNED_BYTE},
+            {GL_RG, GL_RG16F, GL_LINEAR, GL_FLOAT},
+            {GL_RED_INTEGER, GL_R32UI, GL_NEAREST, GL_UNSIGNED_INT},
+        },
+        true);
+  }
+  return GLFramebuffer::create(resolution,
+                               {
+                                   {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                   {GL_RGBA, GL_RGBA32F, GL_LINEAR, GL_FLOAT},
+                                   {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                   {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                   {GL_RGBA, GL_RGBA16F, GL_LINEAR, GL_FLOAT},
+                                   {GL_RED_INTEGER, GL_R32UI, GL_NEAREST,
+                                    GL_UNSIGNED_INT},
+                               },
+                               true);
+}
+
+void tech::GBuffer::release_gbuffer(GLFramebuffer &gbuffer) {
+  ZoneScoped;
+  glDeleteTextures(static_cast<GLsizei>(gbuffer.m_colour_attachments.size()),
+                   gbuffer.m_colour_attachments.data());
+  glDeleteTextures(1, &gbuffer.m_depth_attachment);
+  gbuffer.cleanup();
+  gbuffer = GLFramebuffer{};
+}
+
+void tech::GBuffer::clear_gbuffer(GLFramebuffer &gbuffer, Layout layout) {
+  ZoneScoped;
+  gbuffer.bind();
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  // glClear leaves integer targets undefined
+  const GLuint no_entity = entt::to_integral(entt::entity{entt::null});
+  glAssert(glClearNamedFramebufferuiv(
+      gbuffer.m_handle, GL_COLOR,
+      get_attachment_index(layout, Channel::entity_id), &no_entity));
+}
+
+i32 tech::GBuffer::get_attachment_index(Layout layout, Channel channel) {
+  const i32 index = static_cast<i32>(channel);
+  if (layout == Layout::full) {
+    return index;
+  }
+  // compact is the full order without position
+  const i32 position = static_cast<i32>(Channel::position);
+  if (index == position) {
+    return -1;
+  }
+  return index > position ? index - 1 : index;
+}
+
+gl_handle tech::GBuffer::get_texture(GLFramebuffer &gbuffer, Layout layout,
+                                     Channel channel) {
+  const i32 index = get_attachment_index(layout, channel);
+  if (index < 0) {
+    return gbuffer.m_depth_attachment;
+  }
+  return gbuffer.m_colour_attachments[index];
+}
+
+std::vector<GLShader::Define> tech::GBuffer::get_defines(Layout layout) {
+  if (layout == Layout::compact) {
+    return {{"GBUFFER_COMPACT"}};
+  }
+  return {};
+}
+
 void tech::GBuffer::dispatch_gbuffer_with_id(
-    u32 frame_index, GLFramebuffer &gbuffer,
-    GLFramebuffer &previous_position_buffer, GLShader &gbuffer_shader,
-    AssetManager &am, Camera &cam, std::vector<Scene *> &scenes,
-    glm::ivec2 win_res) {
+    GLFramebuffer &gbuffer, GLFramebuffer &previous_position_buffer,
+    GLShader &gbuffer_shader, GLMaterialTable &material_table,
+    DrawRange draws, GLOcclusionQueries *queries) {
   ZoneScoped;
   GEM_GPU_MARKER("GBuffer-EntityID");
-  glDisable(GL_DITHER);
+  GLState::set_enabled(GL_DITHER, false);
+  // only affects sRGB attachments, the compact diffuse target
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, true);
 
   gbuffer.bind();
-  glm::mat4 current_vp = cam.m_proj * cam.m_view;
 
+  // camera, resolution and jitter come from FrameConstants
   gbuffer_shader.use();
-  gbuffer_shader.set_vec2("u_resolution", {win_res.x, win_res.y});
-  gbuffer_shader.set_mat4("u_vp", current_vp);
-  gbuffer_shader.set_mat4("u_last_vp", cam.m_last_vp);
-  gbuffer_shader.set_int("u_frame_index", frame_index);
-  gbuffer_shader.set_int("u_diffuse_map", 0);
-  gbuffer_shader.set_int("u_normal_map", 1);
-  gbuffer_shader.set_int("u_metallic_map", 2);
-  gbuffer_shader.set_int("u_roughness_map", 3);
-  gbuffer_shader.set_int("u_ao_map", 4);
   gbuffer_shader.set_int("u_prev_position_map", 5);
 
-  Texture::bind_sampler_handle(0, GL_TEXTURE0);
-  Texture::bind_sampler_handle(0, GL_TEXTURE1);
-  Texture::bind_sampler_handle(0, GL_TEXTURE2);
-  Texture::bind_sampler_handle(0, GL_TEXTURE3);
-  Texture::bind_sampler_handle(0, GL_TEXTURE4);
-
   Texture::bind_sampler_handle(
       previous_position_buffer.m_colour_attachments.front(), GL_TEXTURE5);
+  // material textures come from the table, draws only pass an index
+  material_table.bind(gbuffer_shader);
+
+  u32 packet_index = 0;
+  for (DrawPacket &packet : draws) {
+    Material &ematerial = *packet.m_material;
+    Transform &trans = *packet.m_transform;
+
+    const i32 material_index = material_table.get_material_index(ematerial);
+    const auto &material_textures = material_table.get_textures(material_index);
+    const i32 feedback_slot = GLTextureStreamer::add_feedback_draw(
+        material_textures.data(), static_cast<u32>(material_textures.size()));
+
+    DrawConstants draw{};
+    draw.m_model = trans.m_model;
+    draw.m_last_model = trans.m_last_model;
+    draw.m_normal = trans.m_normal_matrix;
+    draw.m_ids = glm::ivec4(static_cast<int>(packet.m_entity), material_index,
+                            feedback_slot, 0);
+    GLConstantRing::push_and_bind(draw);
+    if (queries != nullptr) {
+      queries->begin_conditional(packet_index);
+    }
+    packet.m_mesh->m_mesh.m_vao.draw();
+    if (queries != nullptr) {
+      queries->end_conditional(packet_index);
+    }
+    packet_index++;
+  }
+  gbuffer.unbind();
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, false);
+  GLState::set_enabled(GL_DITHER, true);
+}
 
-  for (Scene *current_scene : scenes) {
-    auto renderables =
-        current_scene->m_registry.view<Transform, MeshComponent, Material>();
+void tech::GBuffer::dispatch_gbuffer_indirect(
+    GLFramebuffer &gbuffer, GLFramebuffer &previous_position_buffer,
+    GLShader &gbuffer_shader, GLShader &cull_shader,
+    GLMaterialTable &material_table, GLIndirectDraws &indirect_draws,
+    DrawRange draws, const std::array<glm::vec4, 6> &planes,
+    GLIndirectDraws::CullPhase phase, const HiZ::Pyramid *occluders) {
+  ZoneScoped;
+  GEM_GPU_MARKER("GBuffer-Indirect-EntityID");
+  if (phase == GLIndirectDraws::CullPhase::first) {
+    indirect_draws.build(draws, material_table);
+  }
+  indirect_draws.dispatch_cull(cull_shader, planes, phase, occluders);
 
-    for (auto [e, trans, emesh, ematerial] : renderables.each()) {
+  GLState::set_enabled(GL_DITHER, false);
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, true);
+  gbuffer.bind();
+
+  gbuffer_shader.use();
+  gbuffer_shader.set_int("u_prev_position_map", 5);
+  Texture::bind_sampler_handle(
+      previous_position_buffer.m_colour_attachments.front(), GL_TEXTURE5);
+  material_table.bind(gbuffer_shader);
 
-      if (ematerial.m_prog.m_shader_id != gbuffer_shader.m_shader_id) {
-        continue;
-      }
+  indirect_draws.draw(phase);
 
-      ematerial.bind_material_uniforms(am);
-      gbuffer_shader.set_mat4("u_model", trans.m_model);
-      gbuffer_shader.set_mat4("u_last_model", trans.m_last_model);
-      gbuffer_shader.set_mat4("u_normal", trans.m_normal_matrix);
-      int entity_index = static_cast<int>(e);
-      gbuffer_shader.set_int("u_entity_index", entity_index);
-      emesh.m_mesh.m_vao.draw();
-    }
-  }
   gbuffer.unbind();
-  glEnable(GL_DITHER);
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, false);
+  GLState::set_enabled(GL_DITHER, true);
 }
+
 void tech::GBuffer::dispatch_gbuffer_textureless_with_id(
-    u32 frame_index, GLFramebuffer &gbuffer,
-    GLFramebuffer &previous_position_buffer,
-    GLShader &gbuffer_textureless_shader, AssetManager &am, Camera &cam,
-    std::vector<Scene *> &scenes, glm::ivec2 win_res) {
+    GLFramebuffer &gbuffer, GLFramebuffer &previous_position_buffer,
+    GLShader &gbuffer_textureless_shader, AssetManager &am,
+    DrawRange draws, GLOcclusionQueries *queries) {
   ZoneScoped;
   GEM_GPU_MARKER("GBuffer-Textureless-EntityID");
-  glDisable(GL_DITHER);
+  GLState::set_enabled(GL_DITHER, false);
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, true);
 
   gbuffer.bind();
-  glm::mat4 current_vp = cam.m_proj * cam.m_view;
 
   gbuffer_textureless_shader.use();
-  gbuffer_textureless_shader.set_vec2("u_resolution", {win_res.x, win_res.y});
-  gbuffer_textureless_shader.set_mat4("u_vp", current_vp);
-  gbuffer_textureless_shader.set_mat4("u_last_vp", cam.m_last_vp);
-  gbuffer_textureless_shader.set_mat4("u_view", cam.m_view);
-  gbuffer_textureless_shader.set_int("u_frame_index", frame_index);
   gbuffer_textureless_shader.set_int("u_prev_position_map", 0);
 
   Texture::bind_sampler_handle(
       previous_position_buffer.m_colour_attachments.front(), GL_TEXTURE0);
 
-  for (Scene *current_scene : scenes) {
-    auto renderables =
-        current_scene->m_registry.view<Transform, MeshComponent, Material>();
-
-    for (auto [e, trans, emesh, ematerial] : renderables.each()) {
-      if (ematerial.m_prog.m_shader_id !=
-          gbuffer_textureless_shader.m_shader_id) {
-        continue;
-      }
-
+  // packets are sorted by material, only rebind when it changes
+  const MaterialInstance *bound_instance = nullptr;
+  u32 packet_index = 0;
+  for (DrawPacket &packet : draws) {
+    Material &ematerial = *packet.m_material;
+    Transform &trans = *packet.m_transform;
+    if (ematerial.m_instance.get() != bound_instance ||
+        ematerial.m_template->m_program_id != ematerial.m_prog.m_shader_id) {
       ematerial.bind_material_uniforms(am);
-      gbuffer_textureless_shader.set_mat4("u_model", trans.m_model);
-      gbuffer_textureless_shader.set_mat4("u_last_model", trans.m_last_model);
+      bound_instance = ematerial.m_instance.get();
+      // materials bind their own program, draw with the pass's layout
+      // variant. parameters are in the constants block so they carry over
+      gbuffer_textureless_shader.use();
+    }
 
-      int entity_index = static_cast<int>(e);
-      gbuffer_textureless_shader.set_int("u_entity_index", entity_index);
-      emesh.m_mesh.m_vao.draw();
+    DrawConstants draw{};
+    draw.m_model = trans.m_model;
+    draw.m_last_model = trans.m_last_model;
+    draw.m_normal = trans.m_normal_matrix;
+    draw.m_ids = glm::ivec4(static_cast<int>(packet.m_entity), -1, -1, 0);
+    GLConstantRing::push_and_bind(draw);
+    if (queries != nullptr) {
+      queries->begin_conditional(packet_index);
+    }
+    packet.m_mesh->m_mesh.m_vao.draw();
+    if (queries != nullptr) {
+      queries->end_conditional(packet_index);
     }
+    packet_index++;
   }
   gbuffer.unbind();
   Texture::bind_sampler_handle(0, GL_TEXTURE0);
-  glEnable(GL_DITHER);
+  GLState::set_enabled(GL_FRAMEBUFFER_SRGB, false);
+  GLState::set_enabled(GL_DITHER, true);
 }
 } // namespace open_gl
 } // namespace gem
\ No newline at end of file
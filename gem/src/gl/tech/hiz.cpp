@@ -0,0 +1,151 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/gl/tech/hiz.h"
+#include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_state.h"
+#include "gem/profile.h"
+#include "gem/texture.h"
+#include <algorithm>
+
+namespace gem {
+namespace open_gl {
+
+static glm::ivec2 get_level_size(glm::ivec2 depth_resolution, u32 level) {
+  const i32 divisor = 2 << level;
+  return glm::max((depth_resolution + divisor - 1) / divisor, glm::ivec2(1));
+}
+
+tech::HiZ::Pyramid tech::HiZ::create_pyramid(glm::ivec2 depth_resolution) {
+  ZoneScoped;
+  Pyramid pyramid{};
+  pyramid.m_depth_resolution = depth_resolution;
+  pyramid.m_size = get_level_size(depth_resolution, 0);
+  pyramid.m_levels = 1;
+  while (pyramid.m_levels < s_max_levels &&
+         glm::any(glm::greaterThan(
+             get_level_size(depth_resolution, pyramid.m_levels - 1),
+             glm::ivec2(1)))) {
+    pyramid.m_levels++;
+  }
+
+  glAssert(glCreateTextures(GL_TEXTURE_2D, 1, &pyramid.m_texture));
+  glAssert(glTextureStorage2D(pyramid.m_texture,
+                              static_cast<GLsizei>(pyramid.m_levels), GL_R32F,
+                              pyramid.m_size.x, pyramid.m_size.y));
+  glAssert(glTextureParameteri(pyramid.m_texture, GL_TEXTURE_MIN_FILTER,
+                               GL_NEAREST_MIPMAP_NEAREST));
+  glAssert(glTextureParameteri(pyramid.m_texture, GL_TEXTURE_MAG_FILTER,
+                               GL_NEAREST));
+  glAssert(glTextureParameteri(pyramid.m_texture, GL_TEXTURE_WRAP_S,
+                               GL_CLAMP_TO_EDGE));
+  glAssert(glTextureParameteri(pyramid.m_texture, GL_TEXTURE_WRAP_T,
+                               GL_CLAMP_TO_EDGE));
+
+  const u32 zero = 0;
+  glAssert(glCreateBuffers(1, &pyramid.m_counter));
+  glAssert(glNamedBufferStorage(pyramid.m_counter, sizeof(u32), &zero, 0));
+
+  // first level narrow enough to test every CPU listed draw against
+  pyramid.m_readback_level = 0;
+  while (pyramid.m_readback_level + 1 < pyramid.m_levels &&
+         get_level_size(depth_resolution, pyramid.m_readback_level).x >
+             s_readback_max_width) {
+    pyramid.m_readback_level++;
+  }
+  const glm::ivec2 readback_size =
+      get_level_size(depth_resolution, pyramid.m_readback_level);
+  glAssert(glCreateBuffers(1, &pyramid.m_readback_buffer));
+  glAssert(glNamedBufferStorage(
+      pyramid.m_readback_buffer,
+      sizeof(float) * readback_size.x * readback_size.y, nullptr,
+      GL_CLIENT_STORAGE_BIT));
+  return pyramid;
+}
+
+void tech::HiZ::release_pyramid(Pyramid &pyramid) {
+  ZoneScoped;
+  if (pyramid.m_readback_fence != nullptr) {
+    glDeleteSync(pyramid.m_readback_fence);
+  }
+  glDeleteTextures(1, &pyramid.m_texture);
+  glDeleteBuffers(1, &pyramid.m_counter);
+  glDeleteBuffers(1, &pyramid.m_readback_buffer);
+  pyramid = Pyramid{};
+}
+
+void tech::HiZ::dispatch_build(GLShader &build_shader, Pyramid &pyramid,
+                               gl_handle depth_texture,
+                               const glm::mat4 &view_proj) {
+  ZoneScoped;
+  GEM_GPU_MARKER("HiZ Build");
+  const glm::ivec2 groups = (pyramid.m_depth_resolution + 63) / 64;
+
+  build_shader.use();
+  build_shader.set_int("u_depth", 0);
+  build_shader.set_ivec2("u_depth_size", pyramid.m_depth_resolution);
+  build_shader.set_int("u_levels", static_cast<int>(pyramid.m_levels));
+  build_shader.set_uint("u_group_count",
+                        static_cast<u32>(groups.x * groups.y));
+  Texture::bind_sampler_handle(depth_texture, GL_TEXTURE0);
+  // levels past the last one are never written, keep the units valid
+  for (u32 level = 0; level < s_max_levels; level++) {
+    GLState::bind_image(level, pyramid.m_texture,
+                        std::min(level, pyramid.m_levels - 1), false, 0,
+                        GL_READ_WRITE, GL_R32F);
+  }
+  glAssert(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, s_counter_binding,
+                            pyramid.m_counter));
+  glAssert(glDispatchCompute(groups.x, groups.y, 1));
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT |
+                  GL_SHADER_IMAGE_ACCESS_BARRIER_BIT |
+                  GL_PIXEL_BUFFER_BARRIER_BIT);
+  Texture::bind_sampler_handle(0, GL_TEXTURE0);
+
+  pyramid.m_view_proj = view_proj;
+  pyramid.m_valid = true;
+}
+
+void tech::HiZ::request_readback(Pyramid &pyramid) {
+  ZoneScoped;
+  if (!pyramid.m_valid || pyramid.m_readback_fence != nullptr) {
+    return;
+  }
+  const glm::ivec2 size = get_level_size(pyramid.m_depth_resolution,
+                                         pyramid.m_readback_level);
+  glAssert(glBindBuffer(GL_PIXEL_PACK_BUFFER, pyramid.m_readback_buffer));
+  glAssert(glGetTextureImage(pyramid.m_texture,
+                             static_cast<GLint>(pyramid.m_readback_level),
+                             GL_RED, GL_FLOAT,
+                             static_cast<GLsizei>(sizeof(float) * size.x *
+                                                  size.y),
+                             nullptr));
+  glAssert(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+  pyramid.m_readback_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  pyramid.m_readback_view_proj = pyramid.m_view_proj;
+}
+
+bool tech::HiZ::poll_readback(Pyramid &pyramid, DepthPyramidLevel &level) {
+  ZoneScoped;
+  if (pyramid.m_readback_fence == nullptr) {
+    return false;
+  }
+  const GLenum status = glClientWaitSync(pyramid.m_readback_fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+    return false;
+  }
+  glDeleteSync(pyramid.m_readback_fence);
+  pyramid.m_readback_fence = nullptr;
+
+  level.m_size = get_level_size(pyramid.m_depth_resolution,
+                                pyramid.m_readback_level);
+  level.m_depth.resize(static_cast<size_t>(level.m_size.x) * level.m_size.y);
+  glAssert(glGetNamedBufferSubData(pyramid.m_readback_buffer, 0,
+                                   sizeof(float) * level.m_depth.size(),
+                                   level.m_depth.data()));
+  level.m_depth_resolution = pyramid.m_depth_resolution;
+  level.m_level = pyramid.m_readback_level;
+  level.m_view_proj = pyramid.m_readback_view_proj;
+  level.m_valid = true;
+  return true;
+}
+} // namespace open_gl
+} // namespace gem
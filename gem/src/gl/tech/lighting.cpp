@@ -1,6 +1,5 @@
-#include <sstream>
 #define GLM_ENABLE_EXPERIMENTAL
-#include "gem/camera.h"
+#include "gem/gl/gl_constant_ring.h"
 #include "gem/gl/gl_dbg.h"
 #include "gem/gl/gl_framebuffer.h"
 #include "gem/gl/tech/lighting.h"
@@ -14,9 +13,9 @@ namespace open_gl {
 
 void tech::PBRLighting::dispatch_light_pass(
     GLShader &lighting_shader, GLFramebuffer &lighting_buffer,
-    GLFramebuffer &gbuffer, GLFramebuffer &dir_light_shadow_buffer,
-    Camera &cam, std::vector<PointLight> &point_lights,
-    DirectionalLight &sun) {
+    GLFramebuffer &gbuffer, GBuffer::Layout gbuffer_layout,
+    GLFramebuffer &dir_light_shadow_buffer,
+    std::vector<PointLight> &point_lights, DirectionalLight &sun) {
   ZoneScoped;
   GEM_GPU_MARKER("Lighting Pass");
   lighting_buffer.bind();
@@ -33,38 +32,37 @@ void tech::PBRLighting::dispatch_light_pass(
       glm::quat(glm::radians(sun.direction)) * glm::vec3(0.0f, 0.0f, 1.0f);
   glm::vec3 lightPos = glm::vec3(0.0) - (dir * 100.0f);
 
-  lighting_shader.set_vec3("u_cam_pos", cam.m_pos);
-  lighting_shader.set_vec3("u_dir_light_pos", lightPos);
-
-  lighting_shader.set_vec3("u_dir_light.direction",
-                           Utils::get_forward(sun.direction));
-  lighting_shader.set_vec3("u_dir_light.colour", sun.colour);
-  lighting_shader.set_mat4("u_dir_light.light_space_matrix",
-                           sun.light_space_matrix);
-  lighting_shader.set_float("u_dir_light.intensity", sun.intensity);
-
-  int num_point_lights = std::min((int)point_lights.size(), 16);
+  LightingConstants constants{};
+  constants.m_dir_light_space_matrix = sun.light_space_matrix;
+  constants.m_dir_light_direction_intensity =
+      glm::vec4(Utils::get_forward(sun.direction), sun.intensity);
+  constants.m_dir_light_colour = glm::vec4(sun.colour, 1.0f);
+  constants.m_dir_light_pos = glm::vec4(lightPos, 1.0f);
 
+  int num_point_lights =
+      std::min((int)point_lights.size(),
+               (int)LightingConstants::s_max_point_lights);
+  constants.m_counts = glm::ivec4(num_point_lights, 0, 0, 0);
   for (int i = 0; i < num_point_lights; i++) {
-    std::stringstream pos_name;
-    pos_name << "u_point_lights[" << i << "].position";
-    std::stringstream col_name;
-    col_name << "u_point_lights[" << i << "].colour";
-    std::stringstream rad_name;
-    rad_name << "u_point_lights[" << i << "].radius";
-    std::stringstream int_name;
-    int_name << "u_point_lights[" << i << "].intensity";
-
-    lighting_shader.set_vec3(pos_name.str(), point_lights[i].position);
-    lighting_shader.set_vec3(col_name.str(), point_lights[i].colour);
-    lighting_shader.set_float(rad_name.str(), point_lights[i].radius);
-    lighting_shader.set_float(int_name.str(), point_lights[i].intensity);
+    constants.m_point_lights[i].m_position_radius =
+        glm::vec4(point_lights[i].position, point_lights[i].radius);
+    constants.m_point_lights[i].m_colour_intensity =
+        glm::vec4(point_lights[i].colour, point_lights[i].intensity);
   }
+  GLConstantRing::push_and_bind(constants);
 
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[0], GL_TEXTURE0);
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[1], GL_TEXTURE1);
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[2], GL_TEXTURE2);
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[3], GL_TEXTURE3);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::diffuse),
+      GL_TEXTURE0);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::position),
+      GL_TEXTURE1);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::normal),
+      GL_TEXTURE2);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::pbr),
+      GL_TEXTURE3);
   Texture::bind_sampler_handle(dir_light_shadow_buffer.m_depth_attachment,
                                GL_TEXTURE4);
 
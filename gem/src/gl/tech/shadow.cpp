@@ -1,11 +1,10 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "gem/gl/tech/shadow.h"
 #include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_state.h"
 #include "gem/gl/gl_framebuffer.h"
-#include "gem/material.h"
 #include "gem/mesh.h"
 #include "gem/profile.h"
-#include "gem/scene.h"
 #include "gem/transform.h"
 #include "gtc/matrix_transform.hpp"
 #include "gtc/quaternion.hpp"
@@ -13,13 +12,8 @@
 namespace gem {
 namespace open_gl {
 
-void tech::Shadow::dispatch_shadow_pass(GLFramebuffer &shadow_fb,
-                                        GLShader &shadow_shader,
-                                        DirectionalLight &sun,
-                                        std::vector<Scene *> &scenes,
-                                        glm::ivec2 window_res) {
+glm::mat4 tech::Shadow::get_light_space_matrix(const DirectionalLight &sun) {
   ZoneScoped;
-  GEM_GPU_MARKER("Shadow Map Pass");
   float near_plane = 0.01f, far_plane = 1000.0f;
   glm::mat4 lightProjection =
       glm::ortho(-150.0f, 150.0f, -150.0f, 150.0f, near_plane, far_plane);
@@ -30,31 +24,37 @@ void tech::Shadow::dispatch_shadow_pass(GLFramebuffer &shadow_fb,
   glm::vec3 lightPos = glm::vec3(0.0) - (dir * 100.0f);
   glm::mat4 lightView = glm::lookAt(lightPos, glm::vec3(0.0f, 0.0f, 0.0f),
                                     glm::vec3(0.0f, 1.0f, 0.0f));
-  glm::mat4 lightSpaceMatrix = lightProjection * lightView;
+  return lightProjection * lightView;
+}
+
+void tech::Shadow::dispatch_shadow_pass(GLFramebuffer &shadow_fb,
+                                        GLShader &shadow_shader,
+                                        DirectionalLight &sun,
+                                        DrawRange draws,
+                                        glm::ivec2 window_res) {
+  ZoneScoped;
+  GEM_GPU_MARKER("Shadow Map Pass");
+  glm::mat4 lightSpaceMatrix = get_light_space_matrix(sun);
 
   sun.light_space_matrix = lightSpaceMatrix;
 
   shadow_fb.bind();
   glClear(GL_DEPTH_BUFFER_BIT);
-  glViewport(0, 0, shadow_fb.m_width, shadow_fb.m_height);
-  glEnable(GL_CULL_FACE);
+  GLState::set_viewport(
+      glm::ivec4(0, 0, shadow_fb.m_width, shadow_fb.m_height));
+  GLState::set_enabled(GL_CULL_FACE, true);
   glCullFace(GL_FRONT);
   shadow_shader.use();
   shadow_shader.set_mat4("lightSpaceMatrix", lightSpaceMatrix);
 
-  for (Scene *current_scene : scenes) {
-    auto renderables =
-        current_scene->m_registry.view<Transform, MeshComponent, Material>();
-
-    for (auto [e, trans, emesh, ematerial] : renderables.each()) {
-      shadow_shader.set_mat4("model", trans.m_model);
-      emesh.m_mesh.draw();
-    }
+  for (DrawPacket &packet : draws) {
+    shadow_shader.set_mat4("model", packet.m_transform->m_model);
+    packet.m_mesh->m_mesh.draw();
   }
 
   shadow_fb.unbind();
-  glDisable(GL_CULL_FACE);
-  glViewport(0, 0, window_res.x, window_res.y);
+  GLState::set_enabled(GL_CULL_FACE, false);
+  GLState::set_viewport(glm::ivec4(0, 0, window_res.x, window_res.y));
 }
 } // namespace open_gl
 } // namespace gem
\ No newline at end of file
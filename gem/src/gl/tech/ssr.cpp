@@ -13,6 +13,7 @@ namespace open_gl {
 void tech::ScreenSpaceReflections::dispatch_ssr_pass(GLShader &ssr, Camera &cam,
                                   GLFramebuffer &ssr_buffer,
                                   GLFramebuffer &gbuffer,
+                                  GBuffer::Layout gbuffer_layout,
                                   GLFramebuffer &lighting_buffer,
                                   glm::vec2 screen_dim) {
   ZoneScoped;
@@ -26,19 +27,21 @@ void tech::ScreenSpaceReflections::dispatch_ssr_pass(GLShader &ssr, Camera &cam,
   ssr.use();
   ssr.set_float("u_screen_width", screen_dim.x);
   ssr.set_float("u_screen_height", screen_dim.y);
-  ssr.set_mat4("u_inv_projection", glm::inverse(cam.m_proj));
-  ssr.set_mat4("u_projection", cam.m_proj);
   ssr.set_mat4("u_rotation", cam.get_rotation_matrix());
 
   ssr.set_int("u_gnormal_buffer", 0);
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[2], GL_TEXTURE0);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::normal),
+      GL_TEXTURE0);
 
   ssr.set_int("u_gcolour_buffer", 1);
   Texture::bind_sampler_handle(lighting_buffer.m_colour_attachments.front(),
                                GL_TEXTURE1);
 
   ssr.set_int("u_gpbr_buffer", 2);
-  Texture::bind_sampler_handle(gbuffer.m_colour_attachments[3], GL_TEXTURE2);
+  Texture::bind_sampler_handle(
+      GBuffer::get_texture(gbuffer, gbuffer_layout, GBuffer::Channel::pbr),
+      GL_TEXTURE2);
 
   ssr.set_int("u_depth_buffer", 3);
   Texture::bind_sampler_handle(gbuffer.m_depth_attachment, GL_TEXTURE3);
@@ -14,13 +14,12 @@ void tech::TemporalAntiAliasing::dispatch_taa_pass(GLShader &taa, GLFramebuffer
                                   GLFramebuffer pass_resolve_buffer,
                                   GLFramebuffer &pass_history_buffer,
                                   gl_handle &velocity_buffer_attachment,
-                                  glm::ivec2 window_res) {
+                                  float pass_scale, float history_scale) {
   ZoneScoped;
   GEM_GPU_MARKER("TAA Pass");
   pass_resolve_buffer.bind();
   Shapes::s_screen_quad.use();
   taa.use();
-  taa.set_vec2("u_resolution", {window_res.x, window_res.y});
   taa.set_int("u_current_buffer", 0);
   Texture::bind_sampler_handle(pass_buffer.m_colour_attachments.front(),
                                GL_TEXTURE0);
@@ -29,6 +28,8 @@ void tech::TemporalAntiAliasing::dispatch_taa_pass(GLShader &taa, GLFramebuffer
                                GL_TEXTURE1);
   taa.set_int("u_velocity_buffer", 2);
   Texture::bind_sampler_handle(velocity_buffer_attachment, GL_TEXTURE2);
+  taa.set_float("u_current_scale", pass_scale);
+  taa.set_float("u_history_scale", history_scale);
 
   glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
   pass_resolve_buffer.unbind();
@@ -29,21 +29,21 @@ void tech::Utils::dispatch_denoise_image(GLShader &denoise_shader,
 }
 
 void tech::Utils::dispatch_present_image(GLShader &present_shader,
-                                         const std::string &uniform_name,
+                                         HashString uniform_name,
                                          const int texture_slot,
                                          gl_handle texture) {
   ZoneScoped;
   GEM_GPU_MARKER("Present Image Pass");
   present_shader.use();
   Shapes::s_screen_quad.use();
-  present_shader.set_int(uniform_name.c_str(), texture_slot);
+  present_shader.set_int(uniform_name, texture_slot);
   Texture::bind_sampler_handle(texture, GL_TEXTURE0 + texture_slot);
   glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
   Texture::bind_sampler_handle(0, GL_TEXTURE0);
 }
 
 void tech::Utils::blit_to_fb(GLFramebuffer &fb, GLShader &present_shader,
-                             const std::string &uniform_name,
+                             HashString uniform_name,
                              const int texture_slot, gl_handle texture) {
   ZoneScoped;
   GEM_GPU_MARKER("Blit Pass");
@@ -4,122 +4,398 @@
 #include "gem/asset_definitions.h"
 #include "gem/asset_manager.h"
 #include "gem/engine.h"
+#include "gem/gl/gl_constant_ring.h"
 #include "gem/profile.h"
 #include "gem/scene.h"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
 
 namespace gem {
 
+static u32 get_parameter_size(GLShader::uniform_type type) {
+  switch (type) {
+  case GLShader::uniform_type::_int:
+  case GLShader::uniform_type::_float:
+    return 4;
+  case GLShader::uniform_type::vec2:
+    return 8;
+  case GLShader::uniform_type::vec3:
+    return 12;
+  case GLShader::uniform_type::vec4:
+    return 16;
+  case GLShader::uniform_type::mat3:
+    return 36;
+  case GLShader::uniform_type::mat4:
+    return 64;
+  default:
+    return 0;
+  }
+}
+
+MaterialTemplate::MaterialTemplate(AssetHandle shader_handle,
+                                   GLShader &program)
+    : m_prog(program), m_shader_handle(shader_handle),
+      m_program_id(program.m_shader_id) {
+  ZoneScoped;
+  s_reflection_count++;
+  const gl_handle id = m_program_id;
+  const GLuint block_index = glGetUniformBlockIndex(id, "MaterialConstants");
+  if (block_index != GL_INVALID_INDEX) {
+    GLint block_size = 0;
+    glGetActiveUniformBlockiv(id, block_index, GL_UNIFORM_BLOCK_DATA_SIZE,
+                              &block_size);
+    glUniformBlockBinding(id, block_index, s_constants_binding);
+    m_constants_size = static_cast<u32>(block_size);
+  }
+  m_data_size = m_constants_size;
+
+  GLint uniform_count = 0;
+  GLint max_name_length = 0;
+  glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniform_count);
+  glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+  std::string name(static_cast<size_t>(std::max(max_name_length, 1)), '\0');
+
+  for (GLint i = 0; i < uniform_count; i++) {
+    const GLuint index = static_cast<GLuint>(i);
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    glGetActiveUniform(id, index, max_name_length, &length, &size, &type,
+                       name.data());
+    const std::string uname = name.substr(0, length);
+    const GLShader::uniform_type utype = GLShader::get_type_from_gl(type);
+
+    GLint uniform_block = -1;
+    glGetActiveUniformsiv(id, 1, &index, GL_UNIFORM_BLOCK_INDEX,
+                          &uniform_block);
+
+    // arrays are left to the passes that own them, e.g. the texture table
+    if (size > 1) {
+      continue;
+    }
+
+    if (uniform_block == static_cast<GLint>(block_index) &&
+        block_index != GL_INVALID_INDEX) {
+      GLint offset = 0;
+      glGetActiveUniformsiv(id, 1, &index, GL_UNIFORM_OFFSET, &offset);
+      m_parameters.push_back(Parameter{HashString(uname).m_value, utype, -1,
+                                       static_cast<u32>(offset)});
+      continue;
+    }
+
+    // members of other blocks are owned by the constant ring
+    if (uniform_block != -1) {
+      continue;
+    }
+
+    const i32 location = glGetUniformLocation(id, uname.c_str());
+    if (utype == GLShader::uniform_type::sampler2D ||
+        utype == GLShader::uniform_type::sampler3D) {
+      m_samplers.push_back(Sampler{uname, utype, location});
+      continue;
+    }
+
+    const u32 parameter_size = get_parameter_size(utype);
+    if (parameter_size == 0) {
+      continue;
+    }
+    m_parameters.push_back(
+        Parameter{HashString(uname).m_value, utype, location, m_data_size});
+    m_data_size += (parameter_size + 15) / 16 * 16;
+  }
+}
+
+std::shared_ptr<MaterialTemplate>
+MaterialTemplate::get(AssetHandle shader_handle, GLShader &program) {
+  ZoneScoped;
+  const u64 key = shader_handle.m_path_hash.m_value;
+  auto it = s_templates.find(key);
+  if (it != s_templates.end() &&
+      it->second->m_program_id == program.m_shader_id &&
+      &it->second->m_prog == &program) {
+    return it->second;
+  }
+
+  auto material_template =
+      std::make_shared<MaterialTemplate>(shader_handle, program);
+  s_templates[key] = material_template;
+  return material_template;
+}
+
+void MaterialTemplate::clear() {
+  ZoneScoped;
+  s_templates.clear();
+}
+
+i32 MaterialTemplate::find_parameter(HashString name) const {
+  for (u32 i = 0; i < m_parameters.size(); i++) {
+    if (m_parameters[i].m_name == name.m_value) {
+      return static_cast<i32>(i);
+    }
+  }
+  return -1;
+}
+
+i32 MaterialTemplate::find_sampler(const std::string &name) const {
+  for (u32 i = 0; i < m_samplers.size(); i++) {
+    if (m_samplers[i].m_name == name) {
+      return static_cast<i32>(i);
+    }
+  }
+  return -1;
+}
+
+i32 MaterialTemplate::add_sampler(const std::string &name) {
+  const i32 existing = find_sampler(name);
+  if (existing >= 0) {
+    return existing;
+  }
+  m_samplers.push_back(Sampler{name, GLShader::uniform_type::sampler2D, -1});
+  return static_cast<i32>(m_samplers.size() - 1);
+}
+
+std::shared_ptr<MaterialInstance>
+MaterialTemplate::intern(std::shared_ptr<MaterialInstance> instance) {
+  ZoneScoped;
+  const u64 hash = instance->get_hash();
+  auto [begin, end] = p_instances.equal_range(hash);
+  for (auto it = begin; it != end;) {
+    std::shared_ptr<MaterialInstance> existing = it->second.lock();
+    if (existing == nullptr) {
+      it = p_instances.erase(it);
+      continue;
+    }
+    if (existing->has_same_contents(*instance)) {
+      return existing;
+    }
+    ++it;
+  }
+  p_instances.emplace(hash, instance);
+  return instance;
+}
+
+std::shared_ptr<MaterialInstance> MaterialTemplate::get_default_instance() {
+  if (p_default_instance == nullptr) {
+    auto instance = std::make_shared<MaterialInstance>();
+    instance->m_parameter_data.resize(m_data_size, 0);
+    instance->m_samplers.resize(m_samplers.size());
+    p_default_instance = intern(std::move(instance));
+  }
+  return p_default_instance;
+}
+
+u64 MaterialInstance::get_hash() const {
+  u64 hash = std::hash<std::string_view>()(std::string_view(
+      reinterpret_cast<const char *>(m_parameter_data.data()),
+      m_parameter_data.size()));
+  hash ^= m_set_mask + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+  for (const Sampler &sampler : m_samplers) {
+    const u64 value = sampler.m_entry.m_handle.m_path_hash.m_value ^
+                      (static_cast<u64>(sampler.m_unit) << 32);
+    hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+bool MaterialInstance::has_same_contents(const MaterialInstance &other) const {
+  if (m_set_mask != other.m_set_mask ||
+      m_parameter_data != other.m_parameter_data ||
+      m_samplers.size() != other.m_samplers.size()) {
+    return false;
+  }
+  for (u32 i = 0; i < m_samplers.size(); i++) {
+    const Sampler &a = m_samplers[i];
+    const Sampler &b = other.m_samplers[i];
+    if (a.m_unit != b.m_unit || a.m_target != b.m_target ||
+        a.m_entry.m_map_type != b.m_entry.m_map_type ||
+        a.m_entry.m_handle.m_path_hash.m_value !=
+            b.m_entry.m_handle.m_path_hash.m_value) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Material::Material(AssetHandle shader_handle, GLShader &program)
-    : m_prog(program), m_shader_handle(shader_handle) {
+    : m_prog(program),
+      m_template(MaterialTemplate::get(shader_handle, program)) {
   ZoneScoped;
-  int uniform_count;
-  GLint size;  // size of the variable
-  GLenum type; // type of the variable (float, vec3 or mat4, etc)
+  m_instance = m_template->get_default_instance();
+}
 
-  const GLsizei bufSize = 16; // maximum name length
-  GLchar name[bufSize];       // variable name in GLSL
-  GLsizei length;             // name length
-  glGetProgramiv(m_prog.m_shader_id, GL_ACTIVE_UNIFORMS, &uniform_count);
+MaterialInstance &Material::begin_edit() {
+  auto instance = std::make_shared<MaterialInstance>(*m_instance);
+  instance->m_texture_table_index = -1;
+  // samplers added to the template after this instance was created
+  instance->m_samplers.resize(m_template->m_samplers.size());
+  m_instance = std::move(instance);
+  return *m_instance;
+}
 
-  for (int i = 0; i < uniform_count; i++) {
-    glGetActiveUniform(m_prog.m_shader_id, (GLuint)i, bufSize, &length, &size,
-                       &type, name);
-    std::string uname = std::string(name);
-    GLShader::uniform_type utype = GLShader::get_type_from_gl(type);
-    m_uniforms.emplace(uname, utype);
+void Material::write_parameter(u32 index, const void *value) {
+  const MaterialTemplate::Parameter &param = m_template->m_parameters[index];
+  MaterialInstance &instance = begin_edit();
+  u8 *dst = instance.m_parameter_data.data() + param.m_offset;
+  // std140 pads each mat3 column to a vec4, glUniformMatrix3fv takes it packed
+  if (param.m_type == GLShader::uniform_type::mat3 && param.m_location < 0) {
+    const float *src = static_cast<const float *>(value);
+    for (u32 column = 0; column < 3; column++) {
+      std::memcpy(dst + column * 16, src + column * 3, sizeof(float) * 3);
+    }
+  } else {
+    std::memcpy(dst, value, get_parameter_size(param.m_type));
   }
+  if (index < 64) {
+    instance.m_set_mask |= u64(1) << index;
+  }
+  m_instance = m_template->intern(m_instance);
 }
 
 bool Material::set_sampler(const std::string &sampler_name, GLenum texture_slot,
                            TextureEntry &tex_entry, GLenum texture_target) {
   ZoneScoped;
-#ifdef ENABLE_MATERIAL_UNIFORM_CHECKS
-  if (m_uniforms.find(sampler_name) == m_uniforms.end()) {
-    return false;
+  // samplers the program doesn't declare are still addressable through the
+  // texture table by their map type
+  const i32 index = m_template->add_sampler(sampler_name);
+  MaterialInstance &instance = begin_edit();
+  MaterialInstance::Sampler &sampler = instance.m_samplers[index];
+  sampler.m_unit = texture_slot - GL_TEXTURE0;
+  sampler.m_target = texture_target;
+  sampler.m_entry = tex_entry;
+  m_instance = m_template->intern(m_instance);
+  return true;
+}
+
+const TextureEntry *
+Material::find_texture(const std::string &sampler_name) const {
+  const i32 index = m_template->find_sampler(sampler_name);
+  if (index < 0 || index >= static_cast<i32>(m_instance->m_samplers.size())) {
+    return nullptr;
   }
-#endif
+  return &m_instance->m_samplers[index].m_entry;
+}
 
-  m_uniform_values[sampler_name] =
-      SamplerInfo{texture_slot, texture_target, tex_entry};
+void Material::refresh_template() {
+  ZoneScoped;
+  std::shared_ptr<MaterialTemplate> previous = m_template;
+  std::shared_ptr<MaterialInstance> values = m_instance;
+  m_template = MaterialTemplate::get(previous->m_shader_handle, m_prog);
+  m_instance = m_template->get_default_instance();
 
-  return true;
+  for (u32 i = 0; i < previous->m_parameters.size(); i++) {
+    const MaterialTemplate::Parameter &param = previous->m_parameters[i];
+    const i32 index = m_template->find_parameter(HashString(param.m_name));
+    if (index < 0 || (i < 64 && (values->m_set_mask & (u64(1) << i)) == 0) ||
+        m_template->m_parameters[index].m_type != param.m_type) {
+      continue;
+    }
+    const u8 *src = values->m_parameter_data.data() + param.m_offset;
+    if (param.m_type == GLShader::uniform_type::mat3 && param.m_location < 0) {
+      glm::mat3 value{};
+      for (u32 column = 0; column < 3; column++) {
+        std::memcpy(&value[column], src + column * 16, sizeof(float) * 3);
+      }
+      write_parameter(index, &value);
+    } else {
+      write_parameter(index, src);
+    }
+  }
+
+  for (u32 i = 0; i < previous->m_samplers.size(); i++) {
+    if (i >= values->m_samplers.size() ||
+        values->m_samplers[i].m_entry.m_handle.m_path_hash.m_value == 0) {
+      continue;
+    }
+    MaterialInstance::Sampler sampler = values->m_samplers[i];
+    set_sampler(previous->m_samplers[i].m_name, GL_TEXTURE0 + sampler.m_unit,
+                sampler.m_entry, sampler.m_target);
+  }
 }
 
 void Material::bind_material_uniforms(AssetManager &am) {
   ZoneScoped;
+  if (m_template->m_program_id != m_prog.m_shader_id) {
+    refresh_template();
+  }
+
   m_prog.use();
-  for (auto &[name, val] : m_uniform_values) {
-#ifdef ENABLE_MATERIAL_UNIFORM_CHECKS
-    if (m_uniforms.find(name) == m_uniforms.end()) {
+  const MaterialTemplate &layout = *m_template;
+  MaterialInstance &instance = *m_instance;
+  if (layout.m_constants_size > 0) {
+    const u32 offset = GLConstantRing::push(instance.m_parameter_data.data(),
+                                            layout.m_constants_size);
+    GLConstantRing::bind(MaterialTemplate::s_constants_binding, offset,
+                         layout.m_constants_size);
+  }
+
+  for (u32 i = 0; i < layout.m_parameters.size(); i++) {
+    const MaterialTemplate::Parameter &param = layout.m_parameters[i];
+    if (param.m_location < 0 ||
+        (i < 64 && (instance.m_set_mask & (u64(1) << i)) == 0)) {
       continue;
     }
-#endif
-    switch (m_uniforms[name]) {
-      // TODO: Image attachments for compute shaders....
-    case GLShader::uniform_type::sampler2D:
-    case GLShader::uniform_type::sampler3D: {
-      SamplerInfo info = std::any_cast<SamplerInfo>(m_uniform_values[name]);
-      if (info.tex_entry.m_texture == nullptr) {
-        TextureAsset *ta =
-            am.get_asset<Texture, AssetType::texture>(info.tex_entry.m_handle);
-        if (!ta) {
-          continue;
-        }
-        if (ta->m_data.m_handle != INVALID_GL_HANDLE) {
-          info.tex_entry.m_texture = &ta->m_data;
-        }
-        m_uniform_values[name] = info;
-      }
-      int loc = info.sampler_slot - GL_TEXTURE0;
-      m_prog.set_int(name, loc);
-      Texture::bind_sampler_handle(info.tex_entry.m_texture->m_handle,
-                                   info.sampler_slot);
-      break;
-    }
-    case GLShader::uniform_type::_int: {
-      int iv = std::any_cast<int>(m_uniform_values[name]);
-      m_prog.set_int(name, iv);
+    const void *data = instance.m_parameter_data.data() + param.m_offset;
+    const GLint *iv = static_cast<const GLint *>(data);
+    const GLfloat *fv = static_cast<const GLfloat *>(data);
+    switch (param.m_type) {
+    case GLShader::uniform_type::_int:
+      glUniform1iv(param.m_location, 1, iv);
       break;
-    }
-    case GLShader::uniform_type::_float: {
-      float fv = std::any_cast<float>(m_uniform_values[name]);
-      m_prog.set_float(name, fv);
+    case GLShader::uniform_type::_float:
+      glUniform1fv(param.m_location, 1, fv);
       break;
-    }
-    case GLShader::uniform_type::vec2: {
-      glm::vec2 v2 = std::any_cast<glm::vec2>(m_uniform_values[name]);
-      m_prog.set_vec2(name, v2);
+    case GLShader::uniform_type::vec2:
+      glUniform2fv(param.m_location, 1, fv);
       break;
-    }
-    case GLShader::uniform_type::vec3: {
-      glm::vec3 v3 = std::any_cast<glm::vec3>(m_uniform_values[name]);
-      m_prog.set_vec3(name, v3);
+    case GLShader::uniform_type::vec3:
+      glUniform3fv(param.m_location, 1, fv);
       break;
-    }
-    case GLShader::uniform_type::vec4: {
-      glm::vec4 v4 = std::any_cast<glm::vec4>(m_uniform_values[name]);
-      m_prog.set_vec4(name, v4);
+    case GLShader::uniform_type::vec4:
+      glUniform4fv(param.m_location, 1, fv);
       break;
-    }
-    case GLShader::uniform_type::mat3: {
-      glm::mat3 m3 = std::any_cast<glm::mat3>(m_uniform_values[name]);
-      m_prog.set_mat3(name, m3);
+    case GLShader::uniform_type::mat3:
+      glUniformMatrix3fv(param.m_location, 1, GL_FALSE, fv);
       break;
-    }
-    case GLShader::uniform_type::mat4: {
-      glm::mat4 m4 = std::any_cast<glm::mat4>(m_uniform_values[name]);
-      m_prog.set_mat4(name, m4);
+    case GLShader::uniform_type::mat4:
+      glUniformMatrix4fv(param.m_location, 1, GL_FALSE, fv);
       break;
-    }
     default:
       break;
     }
   }
+
+  const u32 sampler_count = static_cast<u32>(
+      std::min(layout.m_samplers.size(), instance.m_samplers.size()));
+  for (u32 i = 0; i < sampler_count; i++) {
+    // TODO: Image attachments for compute shaders....
+    MaterialInstance::Sampler &sampler = instance.m_samplers[i];
+    const i32 location = layout.m_samplers[i].m_location;
+    if (location < 0 || sampler.m_entry.m_handle.m_path_hash.m_value == 0) {
+      continue;
+    }
+    // resolving the texture pointer is a cache, it doesn't change the
+    // contents instances are deduplicated on
+    if (sampler.m_entry.m_texture == nullptr) {
+      TextureAsset *ta =
+          am.get_asset<Texture, AssetType::texture>(sampler.m_entry.m_handle);
+      if (!ta || ta->m_data.m_handle == INVALID_GL_HANDLE) {
+        continue;
+      }
+      sampler.m_entry.m_texture = &ta->m_data;
+    }
+    glUniform1i(location, static_cast<GLint>(sampler.m_unit));
+    Texture::bind_sampler_handle(sampler.m_entry.m_texture->m_handle,
+                                 GL_TEXTURE0 + sampler.m_unit);
+  }
 }
 
 void MaterialSystem::init() { ZoneScoped; }
 
-void MaterialSystem::cleanup() { ZoneScoped; }
+void MaterialSystem::cleanup() {
+  ZoneScoped;
+  MaterialTemplate::clear();
+}
 
 void MaterialSystem::update(Scene &current_scene) { ZoneScoped; }
 
@@ -132,27 +408,21 @@ nlohmann::json MaterialSystem::serialize(Scene &current_scene) {
 
   for (auto [e, mat] : sys_view.each()) {
     nlohmann::json comp_json;
-    comp_json["shader"] = mat.m_shader_handle;
+    comp_json["shader"] = mat.m_template->m_shader_handle;
     comp_json["uniforms"] = nlohmann::json();
-    for (auto [name, uniform_type] : mat.m_uniforms) {
-      if (mat.m_uniform_values.find(name) != mat.m_uniform_values.end()) {
-        nlohmann::json uniform_json{};
-        uniform_json["uniform_type"] = uniform_type;
-        switch (uniform_type) {
-        case GLShader::uniform_type::sampler2D:
-        case GLShader::uniform_type::sampler3D: {
-          SamplerInfo info =
-              std::any_cast<SamplerInfo>(mat.m_uniform_values[name]);
-          uniform_json["slot"] = info.sampler_slot;
-          uniform_json["target"] = info.texture_target;
-          uniform_json["entry"] = info.tex_entry;
-          break;
-        }
-        default:
-          break;
-        }
-        comp_json["uniforms"][name] = uniform_json;
+    const auto &samplers = mat.m_template->m_samplers;
+    for (u32 i = 0; i < mat.m_instance->m_samplers.size(); i++) {
+      const auto &sampler = mat.m_instance->m_samplers[i];
+      if (i >= samplers.size() ||
+          sampler.m_entry.m_handle.m_path_hash.m_value == 0) {
+        continue;
       }
+      nlohmann::json uniform_json{};
+      uniform_json["uniform_type"] = samplers[i].m_type;
+      uniform_json["slot"] = GL_TEXTURE0 + sampler.m_unit;
+      uniform_json["target"] = sampler.m_target;
+      uniform_json["entry"] = sampler.m_entry;
+      comp_json["uniforms"][samplers[i].m_name] = uniform_json;
     }
     sys_json[get_entity_string(e)] = comp_json;
   }
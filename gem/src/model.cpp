@@ -162,7 +162,7 @@ void get_material_texture(const std::string &directory, aiMaterial *material,
     aiGetMaterialTexture(material, ass_texture_type, 0, &result_path);
     std::string final_path = directory + std::string(result_path.C_Str());
     spdlog::info("Loading Texture at Path: {}", final_path);
-    Texture *tex = new Texture(final_path);
+    Texture *tex = new Texture(final_path, gl_texture_type);
 
     AssetHandle h(final_path, AssetType::texture);
     TextureEntry tex_entry(gl_texture_type, h, final_path, tex);
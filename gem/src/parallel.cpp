@@ -0,0 +1,151 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/parallel.h"
+#include "gem/profile.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gem {
+
+namespace {
+void get_range(u32 count, u32 range_count, u32 alignment, u32 range,
+               u32 &first, u32 &last) {
+  // split whole blocks of alignment indices, the remainder goes one block at
+  // a time to the first ranges and the last block may be partial
+  const u32 blocks = (count + alignment - 1) / alignment;
+  const u32 size = blocks / range_count;
+  const u32 remainder = blocks % range_count;
+  const u32 first_block = range * size + std::min(range, remainder);
+  const u32 last_block = first_block + size + (range < remainder ? 1 : 0);
+  first = std::min(first_block * alignment, count);
+  last = std::min(last_block * alignment, count);
+}
+
+// a generation per for_ranges call, worker w runs range w
+struct WorkerPool {
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  u64 m_generation = 0;
+  u32 m_pending = 0;
+  bool m_stop = false;
+
+  const Parallel::RangeFn *m_fn = nullptr;
+  u32 m_count = 0;
+  u32 m_range_count = 0;
+  u32 m_alignment = 1;
+
+  ~WorkerPool() { stop(); }
+
+  // seen is the generation at start, workers only run later calls
+  void run(u32 worker, u64 seen) {
+    tracy::SetThreadName("gem::Parallel");
+    for (;;) {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+      if (m_stop) {
+        return;
+      }
+      seen = m_generation;
+      if (worker >= m_range_count) {
+        continue;
+      }
+      lock.unlock();
+
+      u32 first = 0, last = 0;
+      get_range(m_count, m_range_count, m_alignment, worker, first, last);
+      {
+        ZoneScopedN("Parallel Range");
+        (*m_fn)(first, last, worker);
+      }
+
+      lock.lock();
+      if (--m_pending == 0) {
+        m_done.notify_one();
+      }
+    }
+  }
+
+  // with m_mutex held
+  void start() {
+    const u32 hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    // leave a core for the driver's own thread
+    const u32 workers = hardware > 2 ? hardware - 2 : 0;
+    for (u32 i = 0; i < workers; i++) {
+      m_threads.emplace_back(
+          [this, i, seen = m_generation]() { run(i + 1, seen); });
+    }
+  }
+
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread &thread : m_threads) {
+      thread.join();
+    }
+    m_threads.clear();
+    m_stop = false;
+  }
+};
+
+WorkerPool &get_pool() {
+  static WorkerPool s_pool{};
+  return s_pool;
+}
+} // namespace
+
+u32 Parallel::get_thread_count() {
+  WorkerPool &pool = get_pool();
+  std::lock_guard<std::mutex> lock(pool.m_mutex);
+  if (pool.m_threads.empty()) {
+    pool.start();
+  }
+  return static_cast<u32>(pool.m_threads.size()) + 1;
+}
+
+u32 Parallel::for_ranges(u32 count, u32 min_range, const RangeFn &fn,
+                         u32 alignment) {
+  ZoneScoped;
+  alignment = std::max(alignment, 1u);
+  const u32 thread_count = get_thread_count();
+  const u32 blocks = (count + alignment - 1) / alignment;
+  const u32 range_count = std::max(
+      std::min({thread_count, count / std::max(min_range, 1u), blocks}), 1u);
+  if (range_count == 1) {
+    fn(0, count, 0);
+    return 1;
+  }
+
+  WorkerPool &pool = get_pool();
+  {
+    std::lock_guard<std::mutex> lock(pool.m_mutex);
+    pool.m_fn = &fn;
+    pool.m_count = count;
+    pool.m_range_count = range_count;
+    pool.m_alignment = alignment;
+    pool.m_pending = range_count - 1;
+    pool.m_generation++;
+  }
+  pool.m_wake.notify_all();
+
+  u32 first = 0, last = 0;
+  get_range(count, range_count, alignment, 0, first, last);
+  fn(first, last, 0);
+
+  std::unique_lock<std::mutex> lock(pool.m_mutex);
+  pool.m_done.wait(lock, [&]() { return pool.m_pending == 0; });
+  pool.m_fn = nullptr;
+  return range_count;
+}
+
+void Parallel::shutdown() {
+  ZoneScoped;
+  get_pool().stop();
+}
+} // namespace gem
@@ -2,9368 +2,109 @@
 #include "gem/asset_manager.h"
 #include "gem/model.h"
 #include "gem/profile.h"
+#include "gem/shape_gen.h"
 
 namespace gem {
-void add_cube(AssetManager &am) {
-  float cube_vertex_data[288] = {
-      -1.000000, 1.000000,  -1.000000, -0.0000,   1.0000,    -0.0000,
-      0.875000,  0.500000,  1.000000,  1.000000,  1.000000,  -0.0000,
-      1.0000,    -0.0000,   0.625000,  0.750000,  1.000000,  1.000000,
-      -1.000000, -0.0000,   1.0000,    -0.0000,   0.625000,  0.500000,
-      1.000000,  1.000000,  1.000000,  -0.0000,   -0.0000,   1.0000,
-      0.625000,  0.750000,  -1.000000, -1.000000, 1.000000,  -0.0000,
-      -0.0000,   1.0000,    0.375000,  1.000000,  1.000000,  -1.000000,
-      1.000000,  -0.0000,   -0.0000,   1.0000,    0.375000,  0.750000,
-      -1.000000, 1.000000,  1.000000,  -1.0000,   -0.0000,   -0.0000,
-      0.625000,  0.000000,  -1.000000, -1.000000, -1.000000, -1.0000,
-      -0.0000,   -0.0000,   0.375000,  0.250000,  -1.000000, -1.000000,
-      1.000000,  -1.0000,   -0.0000,   -0.0000,   0.375000,  0.000000,
-      1.000000,  -1.000000, -1.000000, -0.0000,   -1.0000,   -0.0000,
-      0.375000,  0.500000,  -1.000000, -1.000000, 1.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.125000,  0.750000,  -1.000000, -1.000000,
-      -1.000000, -0.0000,   -1.0000,   -0.0000,   0.125000,  0.500000,
-      1.000000,  1.000000,  -1.000000, 1.0000,    -0.0000,   -0.0000,
-      0.625000,  0.500000,  1.000000,  -1.000000, 1.000000,  1.0000,
-      -0.0000,   -0.0000,   0.375000,  0.750000,  1.000000,  -1.000000,
-      -1.000000, 1.0000,    -0.0000,   -0.0000,   0.375000,  0.500000,
-      -1.000000, 1.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      0.625000,  0.250000,  1.000000,  -1.000000, -1.000000, -0.0000,
-      -0.0000,   -1.0000,   0.375000,  0.500000,  -1.000000, -1.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   0.375000,  0.250000,
-      -1.000000, 1.000000,  -1.000000, -0.0000,   1.0000,    -0.0000,
-      0.875000,  0.500000,  -1.000000, 1.000000,  1.000000,  -0.0000,
-      1.0000,    -0.0000,   0.875000,  0.750000,  1.000000,  1.000000,
-      1.000000,  -0.0000,   1.0000,    -0.0000,   0.625000,  0.750000,
-      1.000000,  1.000000,  1.000000,  -0.0000,   -0.0000,   1.0000,
-      0.625000,  0.750000,  -1.000000, 1.000000,  1.000000,  -0.0000,
-      -0.0000,   1.0000,    0.625000,  1.000000,  -1.000000, -1.000000,
-      1.000000,  -0.0000,   -0.0000,   1.0000,    0.375000,  1.000000,
-      -1.000000, 1.000000,  1.000000,  -1.0000,   -0.0000,   -0.0000,
-      0.625000,  0.000000,  -1.000000, 1.000000,  -1.000000, -1.0000,
-      -0.0000,   -0.0000,   0.625000,  0.250000,  -1.000000, -1.000000,
-      -1.000000, -1.0000,   -0.0000,   -0.0000,   0.375000,  0.250000,
-      1.000000,  -1.000000, -1.000000, -0.0000,   -1.0000,   -0.0000,
-      0.375000,  0.500000,  1.000000,  -1.000000, 1.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.375000,  0.750000,  -1.000000, -1.000000,
-      1.000000,  -0.0000,   -1.0000,   -0.0000,   0.125000,  0.750000,
-      1.000000,  1.000000,  -1.000000, 1.0000,    -0.0000,   -0.0000,
-      0.625000,  0.500000,  1.000000,  1.000000,  1.000000,  1.0000,
-      -0.0000,   -0.0000,   0.625000,  0.750000,  1.000000,  -1.000000,
-      1.000000,  1.0000,    -0.0000,   -0.0000,   0.375000,  0.750000,
-      -1.000000, 1.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      0.625000,  0.250000,  1.000000,  1.000000,  -1.000000, -0.0000,
-      -0.0000,   -1.0000,   0.625000,  0.500000,  1.000000,  -1.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   0.375000,  0.500000,
-  };
-  const unsigned int cube_num_verts = 36;
-
-  VAOBuilder cube_with_normals_builder;
-  cube_with_normals_builder.begin();
-  cube_with_normals_builder.m_index_count = 36;
-  cube_with_normals_builder.add_vertex_buffer(&cube_vertex_data[0], 288);
-  cube_with_normals_builder.add_vertex_attribute(0, 8 * sizeof(float), 3);
-  cube_with_normals_builder.add_vertex_attribute(1, 8 * sizeof(float), 3);
-  cube_with_normals_builder.add_vertex_attribute(2, 8 * sizeof(float), 2);
-
-  Shapes::s_cube_vao = cube_with_normals_builder.build();
-  AABB cube_bb{{0, 0, 0}, {1, 1, 1}};
-  Shapes::s_cube_mesh = Mesh{Shapes::s_cube_vao, 36, cube_bb, cube_bb, 0};
-
-  Model cube_model{};
-  cube_model.m_meshes.push_back(Shapes::s_cube_mesh);
-  cube_model.m_aabb = Shapes::s_cube_mesh.m_original_aabb;
 
-  am.provide_asset<Model, AssetType::model>("cube", cube_model);
-}
-
-void add_cylinder(AssetManager &am) {
-  float cylinder_vertex_data[2976] = {
-      0.000000,  1.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      1.000000,  1.000000,  0.195090,  -1.000000, -0.980785, 0.1951,
-      -0.0000,   -0.9808,   0.968750,  0.500000,  0.000000,  -1.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   1.000000,  0.500000,
-      0.195090,  1.000000,  -0.980785, 0.1951,    -0.0000,   -0.9808,
-      0.968750,  1.000000,  0.382683,  -1.000000, -0.923880, 0.3827,
-      -0.0000,   -0.9239,   0.937500,  0.500000,  0.195090,  -1.000000,
-      -0.980785, 0.1951,    -0.0000,   -0.9808,   0.968750,  0.500000,
-      0.382683,  1.000000,  -0.923880, 0.3827,    -0.0000,   -0.9239,
-      0.937500,  1.000000,  0.555570,  -1.000000, -0.831470, 0.5556,
-      -0.0000,   -0.8315,   0.906250,  0.500000,  0.382683,  -1.000000,
-      -0.923880, 0.3827,    -0.0000,   -0.9239,   0.937500,  0.500000,
-      0.555570,  1.000000,  -0.831470, 0.5556,    -0.0000,   -0.8315,
-      0.906250,  1.000000,  0.707107,  -1.000000, -0.707107, 0.7071,
-      -0.0000,   -0.7071,   0.875000,  0.500000,  0.555570,  -1.000000,
-      -0.831470, 0.5556,    -0.0000,   -0.8315,   0.906250,  0.500000,
-      0.707107,  1.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.875000,  1.000000,  0.831470,  -1.000000, -0.555570, 0.8315,
-      -0.0000,   -0.5556,   0.843750,  0.500000,  0.707107,  -1.000000,
-      -0.707107, 0.7071,    -0.0000,   -0.7071,   0.875000,  0.500000,
-      0.831470,  1.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.843750,  1.000000,  0.923880,  -1.000000, -0.382683, 0.9239,
-      -0.0000,   -0.3827,   0.812500,  0.500000,  0.831470,  -1.000000,
-      -0.555570, 0.8315,    -0.0000,   -0.5556,   0.843750,  0.500000,
-      0.923880,  1.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.812500,  1.000000,  0.980785,  -1.000000, -0.195090, 0.9808,
-      -0.0000,   -0.1951,   0.781250,  0.500000,  0.923880,  -1.000000,
-      -0.382683, 0.9239,    -0.0000,   -0.3827,   0.812500,  0.500000,
-      0.980785,  1.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.781250,  1.000000,  1.000000,  -1.000000, 0.000000,  1.0000,
-      -0.0000,   -0.0000,   0.750000,  0.500000,  0.980785,  -1.000000,
-      -0.195090, 0.9808,    -0.0000,   -0.1951,   0.781250,  0.500000,
-      1.000000,  1.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.750000,  1.000000,  0.980785,  -1.000000, 0.195090,  0.9808,
-      -0.0000,   0.1951,    0.718750,  0.500000,  1.000000,  -1.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.750000,  0.500000,
-      0.980785,  1.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.718750,  1.000000,  0.923880,  -1.000000, 0.382683,  0.9239,
-      -0.0000,   0.3827,    0.687500,  0.500000,  0.980785,  -1.000000,
-      0.195090,  0.9808,    -0.0000,   0.1951,    0.718750,  0.500000,
-      0.923880,  1.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.687500,  1.000000,  0.831470,  -1.000000, 0.555570,  0.8315,
-      -0.0000,   0.5556,    0.656250,  0.500000,  0.923880,  -1.000000,
-      0.382683,  0.9239,    -0.0000,   0.3827,    0.687500,  0.500000,
-      0.831470,  1.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.656250,  1.000000,  0.707107,  -1.000000, 0.707107,  0.7071,
-      -0.0000,   0.7071,    0.625000,  0.500000,  0.831470,  -1.000000,
-      0.555570,  0.8315,    -0.0000,   0.5556,    0.656250,  0.500000,
-      0.707107,  1.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.625000,  1.000000,  0.555570,  -1.000000, 0.831470,  0.5556,
-      -0.0000,   0.8315,    0.593750,  0.500000,  0.707107,  -1.000000,
-      0.707107,  0.7071,    -0.0000,   0.7071,    0.625000,  0.500000,
-      0.555570,  1.000000,  0.831470,  0.5556,    -0.0000,   0.8315,
-      0.593750,  1.000000,  0.382683,  -1.000000, 0.923880,  0.3827,
-      -0.0000,   0.9239,    0.562500,  0.500000,  0.555570,  -1.000000,
-      0.831470,  0.5556,    -0.0000,   0.8315,    0.593750,  0.500000,
-      0.382683,  1.000000,  0.923880,  0.3827,    -0.0000,   0.9239,
-      0.562500,  1.000000,  0.195090,  -1.000000, 0.980785,  0.1951,
-      -0.0000,   0.9808,    0.531250,  0.500000,  0.382683,  -1.000000,
-      0.923880,  0.3827,    -0.0000,   0.9239,    0.562500,  0.500000,
-      0.195090,  1.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.531250,  1.000000,  0.000000,  -1.000000, 1.000000,  -0.0000,
-      -0.0000,   1.0000,    0.500000,  0.500000,  0.195090,  -1.000000,
-      0.980785,  0.1951,    -0.0000,   0.9808,    0.531250,  0.500000,
-      0.000000,  1.000000,  1.000000,  -0.0000,   -0.0000,   1.0000,
-      0.500000,  1.000000,  -0.195090, -1.000000, 0.980785,  -0.1951,
-      -0.0000,   0.9808,    0.468750,  0.500000,  0.000000,  -1.000000,
-      1.000000,  -0.0000,   -0.0000,   1.0000,    0.500000,  0.500000,
-      -0.195090, 1.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.468750,  1.000000,  -0.382683, -1.000000, 0.923880,  -0.3827,
-      -0.0000,   0.9239,    0.437500,  0.500000,  -0.195090, -1.000000,
-      0.980785,  -0.1951,   -0.0000,   0.9808,    0.468750,  0.500000,
-      -0.382683, 1.000000,  0.923880,  -0.3827,   -0.0000,   0.9239,
-      0.437500,  1.000000,  -0.555570, -1.000000, 0.831470,  -0.5556,
-      -0.0000,   0.8315,    0.406250,  0.500000,  -0.382683, -1.000000,
-      0.923880,  -0.3827,   -0.0000,   0.9239,    0.437500,  0.500000,
-      -0.555570, 1.000000,  0.831470,  -0.5556,   -0.0000,   0.8315,
-      0.406250,  1.000000,  -0.707107, -1.000000, 0.707107,  -0.7071,
-      -0.0000,   0.7071,    0.375000,  0.500000,  -0.555570, -1.000000,
-      0.831470,  -0.5556,   -0.0000,   0.8315,    0.406250,  0.500000,
-      -0.707107, 1.000000,  0.707107,  -0.7071,   -0.0000,   0.7071,
-      0.375000,  1.000000,  -0.831470, -1.000000, 0.555570,  -0.8315,
-      -0.0000,   0.5556,    0.343750,  0.500000,  -0.707107, -1.000000,
-      0.707107,  -0.7071,   -0.0000,   0.7071,    0.375000,  0.500000,
-      -0.831470, 1.000000,  0.555570,  -0.8315,   -0.0000,   0.5556,
-      0.343750,  1.000000,  -0.923880, -1.000000, 0.382683,  -0.9239,
-      -0.0000,   0.3827,    0.312500,  0.500000,  -0.831470, -1.000000,
-      0.555570,  -0.8315,   -0.0000,   0.5556,    0.343750,  0.500000,
-      -0.923880, 1.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.312500,  1.000000,  -0.980785, -1.000000, 0.195090,  -0.9808,
-      -0.0000,   0.1951,    0.281250,  0.500000,  -0.923880, -1.000000,
-      0.382683,  -0.9239,   -0.0000,   0.3827,    0.312500,  0.500000,
-      -0.980785, 1.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.281250,  1.000000,  -1.000000, -1.000000, 0.000000,  -1.0000,
-      -0.0000,   -0.0000,   0.250000,  0.500000,  -0.980785, -1.000000,
-      0.195090,  -0.9808,   -0.0000,   0.1951,    0.281250,  0.500000,
-      -1.000000, 1.000000,  0.000000,  -1.0000,   -0.0000,   -0.0000,
-      0.250000,  1.000000,  -0.980785, -1.000000, -0.195090, -0.9808,
-      -0.0000,   -0.1951,   0.218750,  0.500000,  -1.000000, -1.000000,
-      0.000000,  -1.0000,   -0.0000,   -0.0000,   0.250000,  0.500000,
-      -0.980785, 1.000000,  -0.195090, -0.9808,   -0.0000,   -0.1951,
-      0.218750,  1.000000,  -0.923880, -1.000000, -0.382683, -0.9239,
-      -0.0000,   -0.3827,   0.187500,  0.500000,  -0.980785, -1.000000,
-      -0.195090, -0.9808,   -0.0000,   -0.1951,   0.218750,  0.500000,
-      -0.923880, 1.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.187500,  1.000000,  -0.831470, -1.000000, -0.555570, -0.8315,
-      -0.0000,   -0.5556,   0.156250,  0.500000,  -0.923880, -1.000000,
-      -0.382683, -0.9239,   -0.0000,   -0.3827,   0.187500,  0.500000,
-      -0.831470, 1.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.156250,  1.000000,  -0.707107, -1.000000, -0.707107, -0.7071,
-      -0.0000,   -0.7071,   0.125000,  0.500000,  -0.831470, -1.000000,
-      -0.555570, -0.8315,   -0.0000,   -0.5556,   0.156250,  0.500000,
-      -0.707107, 1.000000,  -0.707107, -0.7071,   -0.0000,   -0.7071,
-      0.125000,  1.000000,  -0.555570, -1.000000, -0.831470, -0.5556,
-      -0.0000,   -0.8315,   0.093750,  0.500000,  -0.707107, -1.000000,
-      -0.707107, -0.7071,   -0.0000,   -0.7071,   0.125000,  0.500000,
-      -0.555570, 1.000000,  -0.831470, -0.5556,   -0.0000,   -0.8315,
-      0.093750,  1.000000,  -0.382683, -1.000000, -0.923880, -0.3827,
-      -0.0000,   -0.9239,   0.062500,  0.500000,  -0.555570, -1.000000,
-      -0.831470, -0.5556,   -0.0000,   -0.8315,   0.093750,  0.500000,
-      -0.382683, 1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.028269,  0.923880,  1.000000,  0.382683,  -0.0000,
-      1.0000,    -0.0000,   0.471731,  0.158156,  0.382683,  1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.341844,  0.471731,
-      -0.382683, 1.000000,  -0.923880, -0.3827,   -0.0000,   -0.9239,
-      0.062500,  1.000000,  -0.195090, -1.000000, -0.980785, -0.1951,
-      -0.0000,   -0.9808,   0.031250,  0.500000,  -0.382683, -1.000000,
-      -0.923880, -0.3827,   -0.0000,   -0.9239,   0.062500,  0.500000,
-      -0.195090, 1.000000,  -0.980785, -0.1951,   -0.0000,   -0.9808,
-      0.031250,  1.000000,  0.000000,  -1.000000, -1.000000, -0.0000,
-      -0.0000,   -1.0000,   0.000000,  0.500000,  -0.195090, -1.000000,
-      -0.980785, -0.1951,   -0.0000,   -0.9808,   0.031250,  0.500000,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.980785, -1.000000, 0.195090,  -0.0000,
-      -1.0000,   -0.0000,   0.514612,  0.203178,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      0.000000,  1.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      1.000000,  1.000000,  0.195090,  1.000000,  -0.980785, 0.1951,
-      -0.0000,   -0.9808,   0.968750,  1.000000,  0.195090,  -1.000000,
-      -0.980785, 0.1951,    -0.0000,   -0.9808,   0.968750,  0.500000,
-      0.195090,  1.000000,  -0.980785, 0.1951,    -0.0000,   -0.9808,
-      0.968750,  1.000000,  0.382683,  1.000000,  -0.923880, 0.3827,
-      -0.0000,   -0.9239,   0.937500,  1.000000,  0.382683,  -1.000000,
-      -0.923880, 0.3827,    -0.0000,   -0.9239,   0.937500,  0.500000,
-      0.382683,  1.000000,  -0.923880, 0.3827,    -0.0000,   -0.9239,
-      0.937500,  1.000000,  0.555570,  1.000000,  -0.831470, 0.5556,
-      -0.0000,   -0.8315,   0.906250,  1.000000,  0.555570,  -1.000000,
-      -0.831470, 0.5556,    -0.0000,   -0.8315,   0.906250,  0.500000,
-      0.555570,  1.000000,  -0.831470, 0.5556,    -0.0000,   -0.8315,
-      0.906250,  1.000000,  0.707107,  1.000000,  -0.707107, 0.7071,
-      -0.0000,   -0.7071,   0.875000,  1.000000,  0.707107,  -1.000000,
-      -0.707107, 0.7071,    -0.0000,   -0.7071,   0.875000,  0.500000,
-      0.707107,  1.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.875000,  1.000000,  0.831470,  1.000000,  -0.555570, 0.8315,
-      -0.0000,   -0.5556,   0.843750,  1.000000,  0.831470,  -1.000000,
-      -0.555570, 0.8315,    -0.0000,   -0.5556,   0.843750,  0.500000,
-      0.831470,  1.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.843750,  1.000000,  0.923880,  1.000000,  -0.382683, 0.9239,
-      -0.0000,   -0.3827,   0.812500,  1.000000,  0.923880,  -1.000000,
-      -0.382683, 0.9239,    -0.0000,   -0.3827,   0.812500,  0.500000,
-      0.923880,  1.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.812500,  1.000000,  0.980785,  1.000000,  -0.195090, 0.9808,
-      -0.0000,   -0.1951,   0.781250,  1.000000,  0.980785,  -1.000000,
-      -0.195090, 0.9808,    -0.0000,   -0.1951,   0.781250,  0.500000,
-      0.980785,  1.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.781250,  1.000000,  1.000000,  1.000000,  0.000000,  1.0000,
-      -0.0000,   -0.0000,   0.750000,  1.000000,  1.000000,  -1.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.750000,  0.500000,
-      1.000000,  1.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.750000,  1.000000,  0.980785,  1.000000,  0.195090,  0.9808,
-      -0.0000,   0.1951,    0.718750,  1.000000,  0.980785,  -1.000000,
-      0.195090,  0.9808,    -0.0000,   0.1951,    0.718750,  0.500000,
-      0.980785,  1.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.718750,  1.000000,  0.923880,  1.000000,  0.382683,  0.9239,
-      -0.0000,   0.3827,    0.687500,  1.000000,  0.923880,  -1.000000,
-      0.382683,  0.9239,    -0.0000,   0.3827,    0.687500,  0.500000,
-      0.923880,  1.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.687500,  1.000000,  0.831470,  1.000000,  0.555570,  0.8315,
-      -0.0000,   0.5556,    0.656250,  1.000000,  0.831470,  -1.000000,
-      0.555570,  0.8315,    -0.0000,   0.5556,    0.656250,  0.500000,
-      0.831470,  1.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.656250,  1.000000,  0.707107,  1.000000,  0.707107,  0.7071,
-      -0.0000,   0.7071,    0.625000,  1.000000,  0.707107,  -1.000000,
-      0.707107,  0.7071,    -0.0000,   0.7071,    0.625000,  0.500000,
-      0.707107,  1.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.625000,  1.000000,  0.555570,  1.000000,  0.831470,  0.5556,
-      -0.0000,   0.8315,    0.593750,  1.000000,  0.555570,  -1.000000,
-      0.831470,  0.5556,    -0.0000,   0.8315,    0.593750,  0.500000,
-      0.555570,  1.000000,  0.831470,  0.5556,    -0.0000,   0.8315,
-      0.593750,  1.000000,  0.382683,  1.000000,  0.923880,  0.3827,
-      -0.0000,   0.9239,    0.562500,  1.000000,  0.382683,  -1.000000,
-      0.923880,  0.3827,    -0.0000,   0.9239,    0.562500,  0.500000,
-      0.382683,  1.000000,  0.923880,  0.3827,    -0.0000,   0.9239,
-      0.562500,  1.000000,  0.195090,  1.000000,  0.980785,  0.1951,
-      -0.0000,   0.9808,    0.531250,  1.000000,  0.195090,  -1.000000,
-      0.980785,  0.1951,    -0.0000,   0.9808,    0.531250,  0.500000,
-      0.195090,  1.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.531250,  1.000000,  0.000000,  1.000000,  1.000000,  -0.0000,
-      -0.0000,   1.0000,    0.500000,  1.000000,  0.000000,  -1.000000,
-      1.000000,  -0.0000,   -0.0000,   1.0000,    0.500000,  0.500000,
-      0.000000,  1.000000,  1.000000,  -0.0000,   -0.0000,   1.0000,
-      0.500000,  1.000000,  -0.195090, 1.000000,  0.980785,  -0.1951,
-      -0.0000,   0.9808,    0.468750,  1.000000,  -0.195090, -1.000000,
-      0.980785,  -0.1951,   -0.0000,   0.9808,    0.468750,  0.500000,
-      -0.195090, 1.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.468750,  1.000000,  -0.382683, 1.000000,  0.923880,  -0.3827,
-      -0.0000,   0.9239,    0.437500,  1.000000,  -0.382683, -1.000000,
-      0.923880,  -0.3827,   -0.0000,   0.9239,    0.437500,  0.500000,
-      -0.382683, 1.000000,  0.923880,  -0.3827,   -0.0000,   0.9239,
-      0.437500,  1.000000,  -0.555570, 1.000000,  0.831470,  -0.5556,
-      -0.0000,   0.8315,    0.406250,  1.000000,  -0.555570, -1.000000,
-      0.831470,  -0.5556,   -0.0000,   0.8315,    0.406250,  0.500000,
-      -0.555570, 1.000000,  0.831470,  -0.5556,   -0.0000,   0.8315,
-      0.406250,  1.000000,  -0.707107, 1.000000,  0.707107,  -0.7071,
-      -0.0000,   0.7071,    0.375000,  1.000000,  -0.707107, -1.000000,
-      0.707107,  -0.7071,   -0.0000,   0.7071,    0.375000,  0.500000,
-      -0.707107, 1.000000,  0.707107,  -0.7071,   -0.0000,   0.7071,
-      0.375000,  1.000000,  -0.831470, 1.000000,  0.555570,  -0.8315,
-      -0.0000,   0.5556,    0.343750,  1.000000,  -0.831470, -1.000000,
-      0.555570,  -0.8315,   -0.0000,   0.5556,    0.343750,  0.500000,
-      -0.831470, 1.000000,  0.555570,  -0.8315,   -0.0000,   0.5556,
-      0.343750,  1.000000,  -0.923880, 1.000000,  0.382683,  -0.9239,
-      -0.0000,   0.3827,    0.312500,  1.000000,  -0.923880, -1.000000,
-      0.382683,  -0.9239,   -0.0000,   0.3827,    0.312500,  0.500000,
-      -0.923880, 1.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.312500,  1.000000,  -0.980785, 1.000000,  0.195090,  -0.9808,
-      -0.0000,   0.1951,    0.281250,  1.000000,  -0.980785, -1.000000,
-      0.195090,  -0.9808,   -0.0000,   0.1951,    0.281250,  0.500000,
-      -0.980785, 1.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.281250,  1.000000,  -1.000000, 1.000000,  0.000000,  -1.0000,
-      -0.0000,   -0.0000,   0.250000,  1.000000,  -1.000000, -1.000000,
-      0.000000,  -1.0000,   -0.0000,   -0.0000,   0.250000,  0.500000,
-      -1.000000, 1.000000,  0.000000,  -1.0000,   -0.0000,   -0.0000,
-      0.250000,  1.000000,  -0.980785, 1.000000,  -0.195090, -0.9808,
-      -0.0000,   -0.1951,   0.218750,  1.000000,  -0.980785, -1.000000,
-      -0.195090, -0.9808,   -0.0000,   -0.1951,   0.218750,  0.500000,
-      -0.980785, 1.000000,  -0.195090, -0.9808,   -0.0000,   -0.1951,
-      0.218750,  1.000000,  -0.923880, 1.000000,  -0.382683, -0.9239,
-      -0.0000,   -0.3827,   0.187500,  1.000000,  -0.923880, -1.000000,
-      -0.382683, -0.9239,   -0.0000,   -0.3827,   0.187500,  0.500000,
-      -0.923880, 1.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.187500,  1.000000,  -0.831470, 1.000000,  -0.555570, -0.8315,
-      -0.0000,   -0.5556,   0.156250,  1.000000,  -0.831470, -1.000000,
-      -0.555570, -0.8315,   -0.0000,   -0.5556,   0.156250,  0.500000,
-      -0.831470, 1.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.156250,  1.000000,  -0.707107, 1.000000,  -0.707107, -0.7071,
-      -0.0000,   -0.7071,   0.125000,  1.000000,  -0.707107, -1.000000,
-      -0.707107, -0.7071,   -0.0000,   -0.7071,   0.125000,  0.500000,
-      -0.707107, 1.000000,  -0.707107, -0.7071,   -0.0000,   -0.7071,
-      0.125000,  1.000000,  -0.555570, 1.000000,  -0.831470, -0.5556,
-      -0.0000,   -0.8315,   0.093750,  1.000000,  -0.555570, -1.000000,
-      -0.831470, -0.5556,   -0.0000,   -0.8315,   0.093750,  0.500000,
-      -0.555570, 1.000000,  -0.831470, -0.5556,   -0.0000,   -0.8315,
-      0.093750,  1.000000,  -0.382683, 1.000000,  -0.923880, -0.3827,
-      -0.0000,   -0.9239,   0.062500,  1.000000,  -0.382683, -1.000000,
-      -0.923880, -0.3827,   -0.0000,   -0.9239,   0.062500,  0.500000,
-      0.382683,  1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.471731,  0.195090,  1.000000,  -0.980785, -0.0000,
-      1.0000,    -0.0000,   0.296822,  0.485388,  0.000000,  1.000000,
-      -1.000000, -0.0000,   1.0000,    -0.0000,   0.250000,  0.490000,
-      0.000000,  1.000000,  -1.000000, -0.0000,   1.0000,    -0.0000,
-      0.250000,  0.490000,  -0.195090, 1.000000,  -0.980785, -0.0000,
-      1.0000,    -0.0000,   0.203178,  0.485388,  -0.382683, 1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.158156,  0.471731,
-      -0.382683, 1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.471731,  -0.555570, 1.000000,  -0.831470, -0.0000,
-      1.0000,    -0.0000,   0.116663,  0.449553,  -0.707107, 1.000000,
-      -0.707107, -0.0000,   1.0000,    -0.0000,   0.080294,  0.419706,
-      -0.707107, 1.000000,  -0.707107, -0.0000,   1.0000,    -0.0000,
-      0.080294,  0.419706,  -0.831470, 1.000000,  -0.555570, -0.0000,
-      1.0000,    -0.0000,   0.050447,  0.383337,  -0.923880, 1.000000,
-      -0.382683, -0.0000,   1.0000,    -0.0000,   0.028269,  0.341844,
-      -0.923880, 1.000000,  -0.382683, -0.0000,   1.0000,    -0.0000,
-      0.028269,  0.341844,  -0.980785, 1.000000,  -0.195090, -0.0000,
-      1.0000,    -0.0000,   0.014612,  0.296822,  -1.000000, 1.000000,
-      0.000000,  -0.0000,   1.0000,    -0.0000,   0.010000,  0.250000,
-      -1.000000, 1.000000,  0.000000,  -0.0000,   1.0000,    -0.0000,
-      0.010000,  0.250000,  -0.980785, 1.000000,  0.195090,  -0.0000,
-      1.0000,    -0.0000,   0.014612,  0.203178,  -0.923880, 1.000000,
-      0.382683,  -0.0000,   1.0000,    -0.0000,   0.028269,  0.158156,
-      -0.923880, 1.000000,  0.382683,  -0.0000,   1.0000,    -0.0000,
-      0.028269,  0.158156,  -0.831470, 1.000000,  0.555570,  -0.0000,
-      1.0000,    -0.0000,   0.050447,  0.116663,  -0.707107, 1.000000,
-      0.707107,  -0.0000,   1.0000,    -0.0000,   0.080294,  0.080294,
-      -0.707107, 1.000000,  0.707107,  -0.0000,   1.0000,    -0.0000,
-      0.080294,  0.080294,  -0.555570, 1.000000,  0.831470,  -0.0000,
-      1.0000,    -0.0000,   0.116663,  0.050447,  -0.382683, 1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.158156,  0.028269,
-      -0.382683, 1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.028269,  -0.195090, 1.000000,  0.980785,  -0.0000,
-      1.0000,    -0.0000,   0.203178,  0.014612,  0.000000,  1.000000,
-      1.000000,  -0.0000,   1.0000,    -0.0000,   0.250000,  0.010000,
-      0.000000,  1.000000,  1.000000,  -0.0000,   1.0000,    -0.0000,
-      0.250000,  0.010000,  0.195090,  1.000000,  0.980785,  -0.0000,
-      1.0000,    -0.0000,   0.296822,  0.014612,  0.382683,  1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.341844,  0.028269,
-      0.382683,  1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.028269,  0.555570,  1.000000,  0.831470,  -0.0000,
-      1.0000,    -0.0000,   0.383337,  0.050447,  0.707107,  1.000000,
-      0.707107,  -0.0000,   1.0000,    -0.0000,   0.419706,  0.080294,
-      0.707107,  1.000000,  0.707107,  -0.0000,   1.0000,    -0.0000,
-      0.419706,  0.080294,  0.831470,  1.000000,  0.555570,  -0.0000,
-      1.0000,    -0.0000,   0.449553,  0.116663,  0.923880,  1.000000,
-      0.382683,  -0.0000,   1.0000,    -0.0000,   0.471731,  0.158156,
-      0.923880,  1.000000,  0.382683,  -0.0000,   1.0000,    -0.0000,
-      0.471731,  0.158156,  0.980785,  1.000000,  0.195090,  -0.0000,
-      1.0000,    -0.0000,   0.485388,  0.203178,  1.000000,  1.000000,
-      0.000000,  -0.0000,   1.0000,    -0.0000,   0.490000,  0.250000,
-      1.000000,  1.000000,  0.000000,  -0.0000,   1.0000,    -0.0000,
-      0.490000,  0.250000,  0.980785,  1.000000,  -0.195090, -0.0000,
-      1.0000,    -0.0000,   0.485388,  0.296822,  0.923880,  1.000000,
-      -0.382683, -0.0000,   1.0000,    -0.0000,   0.471731,  0.341844,
-      0.923880,  1.000000,  -0.382683, -0.0000,   1.0000,    -0.0000,
-      0.471731,  0.341844,  0.831470,  1.000000,  -0.555570, -0.0000,
-      1.0000,    -0.0000,   0.449553,  0.383337,  0.707107,  1.000000,
-      -0.707107, -0.0000,   1.0000,    -0.0000,   0.419706,  0.419706,
-      0.707107,  1.000000,  -0.707107, -0.0000,   1.0000,    -0.0000,
-      0.419706,  0.419706,  0.555570,  1.000000,  -0.831470, -0.0000,
-      1.0000,    -0.0000,   0.383337,  0.449553,  0.382683,  1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.341844,  0.471731,
-      0.382683,  1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.471731,  0.000000,  1.000000,  -1.000000, -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.490000,  -0.382683, 1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.158156,  0.471731,
-      -0.382683, 1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.471731,  -0.707107, 1.000000,  -0.707107, -0.0000,
-      1.0000,    -0.0000,   0.080294,  0.419706,  -0.923880, 1.000000,
-      -0.382683, -0.0000,   1.0000,    -0.0000,   0.028269,  0.341844,
-      -0.923880, 1.000000,  -0.382683, -0.0000,   1.0000,    -0.0000,
-      0.028269,  0.341844,  -1.000000, 1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.010000,  0.250000,  -0.923880, 1.000000,
-      0.382683,  -0.0000,   1.0000,    -0.0000,   0.028269,  0.158156,
-      -0.923880, 1.000000,  0.382683,  -0.0000,   1.0000,    -0.0000,
-      0.028269,  0.158156,  -0.707107, 1.000000,  0.707107,  -0.0000,
-      1.0000,    -0.0000,   0.080294,  0.080294,  -0.382683, 1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.158156,  0.028269,
-      -0.382683, 1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.028269,  0.000000,  1.000000,  1.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.010000,  0.382683,  1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.341844,  0.028269,
-      0.382683,  1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.028269,  0.707107,  1.000000,  0.707107,  -0.0000,
-      1.0000,    -0.0000,   0.419706,  0.080294,  0.923880,  1.000000,
-      0.382683,  -0.0000,   1.0000,    -0.0000,   0.471731,  0.158156,
-      0.923880,  1.000000,  0.382683,  -0.0000,   1.0000,    -0.0000,
-      0.471731,  0.158156,  1.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.490000,  0.250000,  0.923880,  1.000000,
-      -0.382683, -0.0000,   1.0000,    -0.0000,   0.471731,  0.341844,
-      0.923880,  1.000000,  -0.382683, -0.0000,   1.0000,    -0.0000,
-      0.471731,  0.341844,  0.707107,  1.000000,  -0.707107, -0.0000,
-      1.0000,    -0.0000,   0.419706,  0.419706,  0.382683,  1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.341844,  0.471731,
-      0.382683,  1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.471731,  -0.382683, 1.000000,  -0.923880, -0.0000,
-      1.0000,    -0.0000,   0.158156,  0.471731,  -0.923880, 1.000000,
-      -0.382683, -0.0000,   1.0000,    -0.0000,   0.028269,  0.341844,
-      -0.923880, 1.000000,  -0.382683, -0.0000,   1.0000,    -0.0000,
-      0.028269,  0.341844,  -0.923880, 1.000000,  0.382683,  -0.0000,
-      1.0000,    -0.0000,   0.028269,  0.158156,  -0.382683, 1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.158156,  0.028269,
-      -0.382683, 1.000000,  0.923880,  -0.0000,   1.0000,    -0.0000,
-      0.158156,  0.028269,  0.382683,  1.000000,  0.923880,  -0.0000,
-      1.0000,    -0.0000,   0.341844,  0.028269,  0.923880,  1.000000,
-      0.382683,  -0.0000,   1.0000,    -0.0000,   0.471731,  0.158156,
-      0.923880,  1.000000,  0.382683,  -0.0000,   1.0000,    -0.0000,
-      0.471731,  0.158156,  0.923880,  1.000000,  -0.382683, -0.0000,
-      1.0000,    -0.0000,   0.471731,  0.341844,  0.382683,  1.000000,
-      -0.923880, -0.0000,   1.0000,    -0.0000,   0.341844,  0.471731,
-      0.382683,  1.000000,  -0.923880, -0.0000,   1.0000,    -0.0000,
-      0.341844,  0.471731,  -0.923880, 1.000000,  -0.382683, -0.0000,
-      1.0000,    -0.0000,   0.028269,  0.341844,  -0.382683, 1.000000,
-      0.923880,  -0.0000,   1.0000,    -0.0000,   0.158156,  0.028269,
-      -0.382683, 1.000000,  -0.923880, -0.3827,   -0.0000,   -0.9239,
-      0.062500,  1.000000,  -0.195090, 1.000000,  -0.980785, -0.1951,
-      -0.0000,   -0.9808,   0.031250,  1.000000,  -0.195090, -1.000000,
-      -0.980785, -0.1951,   -0.0000,   -0.9808,   0.031250,  0.500000,
-      -0.195090, 1.000000,  -0.980785, -0.1951,   -0.0000,   -0.9808,
-      0.031250,  1.000000,  0.000000,  1.000000,  -1.000000, -0.0000,
-      -0.0000,   -1.0000,   0.000000,  1.000000,  0.000000,  -1.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   0.000000,  0.500000,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.000000,  -1.000000, -1.000000, -0.0000,
-      -1.0000,   -0.0000,   0.750000,  0.490000,  0.195090,  -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.796822,  0.485388,
-      0.195090,  -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.485388,  0.382683,  -1.000000, -0.923880, -0.0000,
-      -1.0000,   -0.0000,   0.841844,  0.471731,  0.555570,  -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.883337,  0.449553,
-      0.555570,  -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.449553,  0.707107,  -1.000000, -0.707107, -0.0000,
-      -1.0000,   -0.0000,   0.919706,  0.419706,  0.831470,  -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.949553,  0.383337,
-      0.831470,  -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.383337,  0.923880,  -1.000000, -0.382683, -0.0000,
-      -1.0000,   -0.0000,   0.971731,  0.341844,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  1.000000,  -1.000000, 0.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.990000,  0.250000,  0.980785,  -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.985388,  0.203178,
-      0.980785,  -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.203178,  0.923880,  -1.000000, 0.382683,  -0.0000,
-      -1.0000,   -0.0000,   0.971731,  0.158156,  0.831470,  -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.949553,  0.116663,
-      0.831470,  -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.116663,  0.707107,  -1.000000, 0.707107,  -0.0000,
-      -1.0000,   -0.0000,   0.919706,  0.080294,  0.555570,  -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.883337,  0.050447,
-      0.555570,  -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.050447,  0.382683,  -1.000000, 0.923880,  -0.0000,
-      -1.0000,   -0.0000,   0.841844,  0.028269,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  0.000000,  -1.000000, 1.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.750000,  0.010000,  -0.195090, -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.703178,  0.014612,
-      -0.195090, -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.014612,  -0.382683, -1.000000, 0.923880,  -0.0000,
-      -1.0000,   -0.0000,   0.658156,  0.028269,  -0.555570, -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.616663,  0.050447,
-      -0.555570, -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.050447,  -0.707107, -1.000000, 0.707107,  -0.0000,
-      -1.0000,   -0.0000,   0.580294,  0.080294,  -0.831470, -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.550447,  0.116663,
-      -0.831470, -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.116663,  -0.923880, -1.000000, 0.382683,  -0.0000,
-      -1.0000,   -0.0000,   0.528269,  0.158156,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -1.000000, -1.000000, 0.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.510000,  0.250000,  -0.980785, -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.514612,  0.296822,
-      -0.980785, -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.296822,  -0.923880, -1.000000, -0.382683, -0.0000,
-      -1.0000,   -0.0000,   0.528269,  0.341844,  -0.831470, -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.550447,  0.383337,
-      -0.831470, -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.383337,  -0.707107, -1.000000, -0.707107, -0.0000,
-      -1.0000,   -0.0000,   0.580294,  0.419706,  -0.555570, -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.616663,  0.449553,
-      -0.555570, -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.449553,  -0.382683, -1.000000, -0.923880, -0.0000,
-      -1.0000,   -0.0000,   0.658156,  0.471731,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.195090,  -1.000000, -0.980785, -0.0000,
-      -1.0000,   -0.0000,   0.796822,  0.485388,  0.555570,  -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.883337,  0.449553,
-      0.555570,  -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.449553,  0.831470,  -1.000000, -0.555570, -0.0000,
-      -1.0000,   -0.0000,   0.949553,  0.383337,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  0.980785,  -1.000000, 0.195090,  -0.0000,
-      -1.0000,   -0.0000,   0.985388,  0.203178,  0.831470,  -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.949553,  0.116663,
-      0.831470,  -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.116663,  0.555570,  -1.000000, 0.831470,  -0.0000,
-      -1.0000,   -0.0000,   0.883337,  0.050447,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.195090, -1.000000, 0.980785,  -0.0000,
-      -1.0000,   -0.0000,   0.703178,  0.014612,  -0.555570, -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.616663,  0.050447,
-      -0.555570, -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.050447,  -0.831470, -1.000000, 0.555570,  -0.0000,
-      -1.0000,   -0.0000,   0.550447,  0.116663,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -0.980785, -1.000000, -0.195090, -0.0000,
-      -1.0000,   -0.0000,   0.514612,  0.296822,  -0.831470, -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.550447,  0.383337,
-      -0.831470, -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.383337,  -0.555570, -1.000000, -0.831470, -0.0000,
-      -1.0000,   -0.0000,   0.616663,  0.449553,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.555570,  -1.000000, -0.831470, -0.0000,
-      -1.0000,   -0.0000,   0.883337,  0.449553,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  0.831470,  -1.000000, 0.555570,  -0.0000,
-      -1.0000,   -0.0000,   0.949553,  0.116663,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.555570, -1.000000, 0.831470,  -0.0000,
-      -1.0000,   -0.0000,   0.616663,  0.050447,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -0.831470, -1.000000, -0.555570, -0.0000,
-      -1.0000,   -0.0000,   0.550447,  0.383337,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.980785,  -1.000000, -0.195090, -0.0000,
-      -1.0000,   -0.0000,   0.985388,  0.296822,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-  };
-  const unsigned int cylinder_num_verts = 372;
-
-  VAOBuilder cylinder_builder;
-  cylinder_builder.begin();
-  cylinder_builder.m_index_count = cylinder_num_verts;
-  cylinder_builder.add_vertex_buffer(&cylinder_vertex_data[0],
-                                     cylinder_num_verts * 8);
-  cylinder_builder.add_vertex_attribute(0, 8 * sizeof(float), 3);
-  cylinder_builder.add_vertex_attribute(1, 8 * sizeof(float), 3);
-  cylinder_builder.add_vertex_attribute(2, 8 * sizeof(float), 2);
-
-  Shapes::s_cylinder_vao = cylinder_builder.build();
-  AABB cube_bb{{0, 0, 0}, {1, 1, 1}};
-  Shapes::s_cylinder_mesh =
-      Mesh{Shapes::s_cylinder_vao, 36, cube_bb, cube_bb, 0};
-
-  Model cylinder_model{};
-  cylinder_model.m_meshes.push_back(Shapes::s_cylinder_mesh);
-  cylinder_model.m_aabb = Shapes::s_cylinder_mesh.m_original_aabb;
-
-  am.provide_asset<Model, AssetType::model>("cylinder", cylinder_model);
+// Built in primitives are generated at compile time, tessellation matches the
+// meshes previously baked from obj files by tools/obj_2_c.py
+static constexpr auto s_cube_shape = ShapeGen::Cube::generate();
+static constexpr auto s_sphere_shape = ShapeGen::UVSphere<32, 16>::generate();
+static constexpr auto s_cylinder_shape = ShapeGen::Cylinder<32>::generate();
+static constexpr auto s_cone_shape = ShapeGen::Cone<32>::generate();
+static constexpr auto s_torus_shape = ShapeGen::Torus<48, 12>::generate();
+
+template <typename _Shape>
+Mesh append_shape(const _Shape &shape, std::vector<float> &vertices,
+                  std::vector<uint32_t> &indices) {
+  ZoneScoped;
+  const uint32_t base_vertex =
+      static_cast<uint32_t>(vertices.size() / ShapeGen::s_vertex_stride);
+
+  Mesh mesh{};
+  mesh.m_vao.m_index_offset = static_cast<uint32_t>(indices.size());
+  mesh.m_index_count = _Shape::index_count;
+  mesh.m_material_index = 0;
+
+  vertices.insert(vertices.end(), shape.m_vertices.begin(),
+                  shape.m_vertices.end());
+  for (uint32_t index : shape.m_indices) {
+    indices.push_back(base_vertex + index);
+  }
+
+  AABB bb{{shape.m_min[0], shape.m_min[1], shape.m_min[2]},
+          {shape.m_max[0], shape.m_max[1], shape.m_max[2]}};
+  mesh.m_original_aabb = bb;
+  mesh.m_transformed_aabb = bb;
+  return mesh;
 }
 
-void add_cone(AssetManager &am) {
-  float cone_vertex_data[1488] = {
-      0.000000,  -1.000000, -1.000000, -0.0000,   0.4472,    -0.8944,
-      0.250000,  0.490000,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.195090,  -1.000000,
-      -0.980785, 0.1745,    0.4472,    -0.8772,   0.296822,  0.485388,
-      0.195090,  -1.000000, -0.980785, 0.1745,    0.4472,    -0.8772,
-      0.296822,  0.485388,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.382683,  -1.000000,
-      -0.923880, 0.3423,    0.4472,    -0.8263,   0.341844,  0.471731,
-      0.382683,  -1.000000, -0.923880, 0.3423,    0.4472,    -0.8263,
-      0.341844,  0.471731,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.555570,  -1.000000,
-      -0.831470, 0.4969,    0.4472,    -0.7437,   0.383337,  0.449553,
-      0.555570,  -1.000000, -0.831470, 0.4969,    0.4472,    -0.7437,
-      0.383337,  0.449553,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.707107,  -1.000000,
-      -0.707107, 0.6325,    0.4472,    -0.6325,   0.419706,  0.419706,
-      0.707107,  -1.000000, -0.707107, 0.6325,    0.4472,    -0.6325,
-      0.419706,  0.419706,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.831470,  -1.000000,
-      -0.555570, 0.7437,    0.4472,    -0.4969,   0.449553,  0.383337,
-      0.831470,  -1.000000, -0.555570, 0.7437,    0.4472,    -0.4969,
-      0.449553,  0.383337,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.923880,  -1.000000,
-      -0.382683, 0.8263,    0.4472,    -0.3423,   0.471731,  0.341844,
-      0.923880,  -1.000000, -0.382683, 0.8263,    0.4472,    -0.3423,
-      0.471731,  0.341844,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.980785,  -1.000000,
-      -0.195090, 0.8772,    0.4472,    -0.1745,   0.485388,  0.296822,
-      0.980785,  -1.000000, -0.195090, 0.8772,    0.4472,    -0.1745,
-      0.485388,  0.296822,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  1.000000,  -1.000000,
-      0.000000,  0.8944,    0.4472,    -0.0000,   0.490000,  0.250000,
-      1.000000,  -1.000000, 0.000000,  0.8944,    0.4472,    -0.0000,
-      0.490000,  0.250000,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.980785,  -1.000000,
-      0.195090,  0.8772,    0.4472,    0.1745,    0.485388,  0.203178,
-      0.980785,  -1.000000, 0.195090,  0.8772,    0.4472,    0.1745,
-      0.485388,  0.203178,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.923880,  -1.000000,
-      0.382683,  0.8263,    0.4472,    0.3423,    0.471731,  0.158156,
-      0.923880,  -1.000000, 0.382683,  0.8263,    0.4472,    0.3423,
-      0.471731,  0.158156,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.831470,  -1.000000,
-      0.555570,  0.7437,    0.4472,    0.4969,    0.449553,  0.116663,
-      0.831470,  -1.000000, 0.555570,  0.7437,    0.4472,    0.4969,
-      0.449553,  0.116663,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.707107,  -1.000000,
-      0.707107,  0.6325,    0.4472,    0.6325,    0.419706,  0.080294,
-      0.707107,  -1.000000, 0.707107,  0.6325,    0.4472,    0.6325,
-      0.419706,  0.080294,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.555570,  -1.000000,
-      0.831470,  0.4969,    0.4472,    0.7437,    0.383337,  0.050447,
-      0.555570,  -1.000000, 0.831470,  0.4969,    0.4472,    0.7437,
-      0.383337,  0.050447,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.382683,  -1.000000,
-      0.923880,  0.3423,    0.4472,    0.8263,    0.341844,  0.028269,
-      0.382683,  -1.000000, 0.923880,  0.3423,    0.4472,    0.8263,
-      0.341844,  0.028269,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.195090,  -1.000000,
-      0.980785,  0.1745,    0.4472,    0.8772,    0.296822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  0.1745,    0.4472,    0.8772,
-      0.296822,  0.014612,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.000000,  -1.000000,
-      1.000000,  -0.0000,   0.4472,    0.8944,    0.250000,  0.010000,
-      0.000000,  -1.000000, 1.000000,  -0.0000,   0.4472,    0.8944,
-      0.250000,  0.010000,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.195090, -1.000000,
-      0.980785,  -0.1745,   0.4472,    0.8772,    0.203178,  0.014612,
-      -0.195090, -1.000000, 0.980785,  -0.1745,   0.4472,    0.8772,
-      0.203178,  0.014612,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.382683, -1.000000,
-      0.923880,  -0.3423,   0.4472,    0.8263,    0.158156,  0.028269,
-      -0.382683, -1.000000, 0.923880,  -0.3423,   0.4472,    0.8263,
-      0.158156,  0.028269,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.555570, -1.000000,
-      0.831470,  -0.4969,   0.4472,    0.7437,    0.116663,  0.050447,
-      -0.555570, -1.000000, 0.831470,  -0.4969,   0.4472,    0.7437,
-      0.116663,  0.050447,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.707107, -1.000000,
-      0.707107,  -0.6325,   0.4472,    0.6325,    0.080294,  0.080294,
-      -0.707107, -1.000000, 0.707107,  -0.6325,   0.4472,    0.6325,
-      0.080294,  0.080294,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.831470, -1.000000,
-      0.555570,  -0.7437,   0.4472,    0.4969,    0.050447,  0.116663,
-      -0.831470, -1.000000, 0.555570,  -0.7437,   0.4472,    0.4969,
-      0.050447,  0.116663,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.923880, -1.000000,
-      0.382683,  -0.8263,   0.4472,    0.3423,    0.028269,  0.158156,
-      -0.923880, -1.000000, 0.382683,  -0.8263,   0.4472,    0.3423,
-      0.028269,  0.158156,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.980785, -1.000000,
-      0.195090,  -0.8772,   0.4472,    0.1745,    0.014612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.8772,   0.4472,    0.1745,
-      0.014612,  0.203178,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -1.000000, -1.000000,
-      0.000000,  -0.8944,   0.4472,    -0.0000,   0.010000,  0.250000,
-      -1.000000, -1.000000, 0.000000,  -0.8944,   0.4472,    -0.0000,
-      0.010000,  0.250000,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.980785, -1.000000,
-      -0.195090, -0.8772,   0.4472,    -0.1745,   0.014612,  0.296822,
-      -0.980785, -1.000000, -0.195090, -0.8772,   0.4472,    -0.1745,
-      0.014612,  0.296822,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.923880, -1.000000,
-      -0.382683, -0.8263,   0.4472,    -0.3423,   0.028269,  0.341844,
-      -0.923880, -1.000000, -0.382683, -0.8263,   0.4472,    -0.3423,
-      0.028269,  0.341844,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.831470, -1.000000,
-      -0.555570, -0.7437,   0.4472,    -0.4969,   0.050447,  0.383337,
-      -0.831470, -1.000000, -0.555570, -0.7437,   0.4472,    -0.4969,
-      0.050447,  0.383337,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.707107, -1.000000,
-      -0.707107, -0.6325,   0.4472,    -0.6325,   0.080294,  0.419706,
-      -0.707107, -1.000000, -0.707107, -0.6325,   0.4472,    -0.6325,
-      0.080294,  0.419706,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.555570, -1.000000,
-      -0.831470, -0.4969,   0.4472,    -0.7437,   0.116663,  0.449553,
-      -0.555570, -1.000000, -0.831470, -0.4969,   0.4472,    -0.7437,
-      0.116663,  0.449553,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.382683, -1.000000,
-      -0.923880, -0.3423,   0.4472,    -0.8263,   0.158156,  0.471731,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.980785, -1.000000, 0.195090,  -0.0000,
-      -1.0000,   -0.0000,   0.514612,  0.203178,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.382683, -1.000000, -0.923880, -0.3423,   0.4472,    -0.8263,
-      0.158156,  0.471731,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  -0.195090, -1.000000,
-      -0.980785, -0.1745,   0.4472,    -0.8772,   0.203178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.1745,   0.4472,    -0.8772,
-      0.203178,  0.485388,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.250000,  0.250000,  0.000000,  -1.000000,
-      -1.000000, -0.0000,   0.4472,    -0.8944,   0.250000,  0.490000,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.000000,  -1.000000, -1.000000, -0.0000,
-      -1.0000,   -0.0000,   0.750000,  0.490000,  0.195090,  -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.796822,  0.485388,
-      0.195090,  -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.485388,  0.382683,  -1.000000, -0.923880, -0.0000,
-      -1.0000,   -0.0000,   0.841844,  0.471731,  0.555570,  -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.883337,  0.449553,
-      0.555570,  -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.449553,  0.707107,  -1.000000, -0.707107, -0.0000,
-      -1.0000,   -0.0000,   0.919706,  0.419706,  0.831470,  -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.949553,  0.383337,
-      0.831470,  -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.383337,  0.923880,  -1.000000, -0.382683, -0.0000,
-      -1.0000,   -0.0000,   0.971731,  0.341844,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  1.000000,  -1.000000, 0.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.990000,  0.250000,  0.980785,  -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.985388,  0.203178,
-      0.980785,  -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.203178,  0.923880,  -1.000000, 0.382683,  -0.0000,
-      -1.0000,   -0.0000,   0.971731,  0.158156,  0.831470,  -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.949553,  0.116663,
-      0.831470,  -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.116663,  0.707107,  -1.000000, 0.707107,  -0.0000,
-      -1.0000,   -0.0000,   0.919706,  0.080294,  0.555570,  -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.883337,  0.050447,
-      0.555570,  -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.050447,  0.382683,  -1.000000, 0.923880,  -0.0000,
-      -1.0000,   -0.0000,   0.841844,  0.028269,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  0.000000,  -1.000000, 1.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.750000,  0.010000,  -0.195090, -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.703178,  0.014612,
-      -0.195090, -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.014612,  -0.382683, -1.000000, 0.923880,  -0.0000,
-      -1.0000,   -0.0000,   0.658156,  0.028269,  -0.555570, -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.616663,  0.050447,
-      -0.555570, -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.050447,  -0.707107, -1.000000, 0.707107,  -0.0000,
-      -1.0000,   -0.0000,   0.580294,  0.080294,  -0.831470, -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.550447,  0.116663,
-      -0.831470, -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.116663,  -0.923880, -1.000000, 0.382683,  -0.0000,
-      -1.0000,   -0.0000,   0.528269,  0.158156,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -1.000000, -1.000000, 0.000000,  -0.0000,
-      -1.0000,   -0.0000,   0.510000,  0.250000,  -0.980785, -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.514612,  0.296822,
-      -0.980785, -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.296822,  -0.923880, -1.000000, -0.382683, -0.0000,
-      -1.0000,   -0.0000,   0.528269,  0.341844,  -0.831470, -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.550447,  0.383337,
-      -0.831470, -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.383337,  -0.707107, -1.000000, -0.707107, -0.0000,
-      -1.0000,   -0.0000,   0.580294,  0.419706,  -0.555570, -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.616663,  0.449553,
-      -0.555570, -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.449553,  -0.382683, -1.000000, -0.923880, -0.0000,
-      -1.0000,   -0.0000,   0.658156,  0.471731,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.195090,  -1.000000, -0.980785, -0.0000,
-      -1.0000,   -0.0000,   0.796822,  0.485388,  0.555570,  -1.000000,
-      -0.831470, -0.0000,   -1.0000,   -0.0000,   0.883337,  0.449553,
-      0.555570,  -1.000000, -0.831470, -0.0000,   -1.0000,   -0.0000,
-      0.883337,  0.449553,  0.831470,  -1.000000, -0.555570, -0.0000,
-      -1.0000,   -0.0000,   0.949553,  0.383337,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  0.980785,  -1.000000, 0.195090,  -0.0000,
-      -1.0000,   -0.0000,   0.985388,  0.203178,  0.831470,  -1.000000,
-      0.555570,  -0.0000,   -1.0000,   -0.0000,   0.949553,  0.116663,
-      0.831470,  -1.000000, 0.555570,  -0.0000,   -1.0000,   -0.0000,
-      0.949553,  0.116663,  0.555570,  -1.000000, 0.831470,  -0.0000,
-      -1.0000,   -0.0000,   0.883337,  0.050447,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.195090, -1.000000, 0.980785,  -0.0000,
-      -1.0000,   -0.0000,   0.703178,  0.014612,  -0.555570, -1.000000,
-      0.831470,  -0.0000,   -1.0000,   -0.0000,   0.616663,  0.050447,
-      -0.555570, -1.000000, 0.831470,  -0.0000,   -1.0000,   -0.0000,
-      0.616663,  0.050447,  -0.831470, -1.000000, 0.555570,  -0.0000,
-      -1.0000,   -0.0000,   0.550447,  0.116663,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -0.980785, -1.000000, -0.195090, -0.0000,
-      -1.0000,   -0.0000,   0.514612,  0.296822,  -0.831470, -1.000000,
-      -0.555570, -0.0000,   -1.0000,   -0.0000,   0.550447,  0.383337,
-      -0.831470, -1.000000, -0.555570, -0.0000,   -1.0000,   -0.0000,
-      0.550447,  0.383337,  -0.555570, -1.000000, -0.831470, -0.0000,
-      -1.0000,   -0.0000,   0.616663,  0.449553,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.555570,  -1.000000, -0.831470, -0.0000,
-      -1.0000,   -0.0000,   0.883337,  0.449553,  0.980785,  -1.000000,
-      -0.195090, -0.0000,   -1.0000,   -0.0000,   0.985388,  0.296822,
-      0.980785,  -1.000000, -0.195090, -0.0000,   -1.0000,   -0.0000,
-      0.985388,  0.296822,  0.831470,  -1.000000, 0.555570,  -0.0000,
-      -1.0000,   -0.0000,   0.949553,  0.116663,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-      0.195090,  -1.000000, 0.980785,  -0.0000,   -1.0000,   -0.0000,
-      0.796822,  0.014612,  -0.555570, -1.000000, 0.831470,  -0.0000,
-      -1.0000,   -0.0000,   0.616663,  0.050447,  -0.980785, -1.000000,
-      0.195090,  -0.0000,   -1.0000,   -0.0000,   0.514612,  0.203178,
-      -0.980785, -1.000000, 0.195090,  -0.0000,   -1.0000,   -0.0000,
-      0.514612,  0.203178,  -0.831470, -1.000000, -0.555570, -0.0000,
-      -1.0000,   -0.0000,   0.550447,  0.383337,  -0.195090, -1.000000,
-      -0.980785, -0.0000,   -1.0000,   -0.0000,   0.703178,  0.485388,
-      -0.195090, -1.000000, -0.980785, -0.0000,   -1.0000,   -0.0000,
-      0.703178,  0.485388,  0.980785,  -1.000000, -0.195090, -0.0000,
-      -1.0000,   -0.0000,   0.985388,  0.296822,  0.195090,  -1.000000,
-      0.980785,  -0.0000,   -1.0000,   -0.0000,   0.796822,  0.014612,
-  };
-  const unsigned int cone_num_verts = 186;
-
-  VAOBuilder cone_builder;
-  cone_builder.begin();
-  cone_builder.m_index_count = cone_num_verts;
-  cone_builder.add_vertex_buffer(&cone_vertex_data[0], cone_num_verts * 8);
-  cone_builder.add_vertex_attribute(0, 8 * sizeof(float), 3);
-  cone_builder.add_vertex_attribute(1, 8 * sizeof(float), 3);
-  cone_builder.add_vertex_attribute(2, 8 * sizeof(float), 2);
-
-  Shapes::s_cone_vao = cone_builder.build();
-  AABB cube_bb{{0, 0, 0}, {1, 1, 1}};
-  Shapes::s_cone_mesh = Mesh{Shapes::s_cone_vao, 36, cube_bb, cube_bb, 0};
-
-  Model cone_model{};
-  cone_model.m_meshes.push_back(Shapes::s_cone_mesh);
-  cone_model.m_aabb = Shapes::s_cone_mesh.m_original_aabb;
-
-  am.provide_asset<Model, AssetType::model>("cone", cone_model);
+// the mesh views the shared buffers, releasing its model must not free them
+void use_shared_vao(Mesh &mesh, VAO &shared) {
+  const uint32_t offset = mesh.m_vao.m_index_offset;
+  mesh.m_vao = shared;
+  mesh.m_vao.m_index_offset = offset;
+  mesh.m_vao.m_index_count = mesh.m_index_count;
+  mesh.m_vao.m_owns_buffers = false;
 }
 
-void add_torus(AssetManager &am) {
-  float torus_vertex_data[27648] = {
-      1.239306,  0.000000,  -0.163158, 0.9914,    -0.0000,   -0.1305,
-      0.520833,  0.500000,  1.216506,  0.125000,  0.000000,  0.8687,
-      0.4954,    -0.0000,   0.500000,  0.583333,  1.250000,  0.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.500000,  0.500000,
-      1.216506,  0.125000,  0.000000,  0.8687,    0.4954,    -0.0000,
-      0.500000,  0.583333,  1.115376,  0.216506,  -0.146842, 0.5037,
-      0.8614,    -0.0663,   0.520833,  0.666667,  1.125000,  0.216506,
-      0.000000,  0.5080,    0.8614,    -0.0000,   0.500000,  0.666667,
-      1.115376,  0.216506,  -0.146842, 0.5037,    0.8614,    -0.0663,
-      0.520833,  0.666667,  1.000000,  0.250000,  0.000000,  0.0108,
-      0.9999,    -0.0000,   0.500000,  0.750000,  1.125000,  0.216506,
-      0.000000,  0.5080,    0.8614,    -0.0000,   0.500000,  0.666667,
-      0.991445,  0.250000,  -0.130526, 0.0107,    0.9999,    -0.0014,
-      0.520833,  0.750000,  0.875000,  0.216506,  0.000000,  -0.4918,
-      0.8707,    -0.0000,   0.500000,  0.833333,  1.000000,  0.250000,
-      0.000000,  0.0108,    0.9999,    -0.0000,   0.500000,  0.750000,
-      0.867514,  0.216506,  -0.114210, -0.4876,   0.8707,    0.0642,
-      0.520833,  0.833333,  0.783494,  0.125000,  0.000000,  -0.8633,
-      0.5047,    -0.0000,   0.500000,  0.916667,  0.875000,  0.216506,
-      0.000000,  -0.4918,   0.8707,    -0.0000,   0.500000,  0.833333,
-      0.783494,  0.125000,  0.000000,  -0.8633,   0.5047,    -0.0000,
-      0.500000,  0.916667,  0.743584,  0.000000,  -0.097895, -0.9914,
-      -0.0000,   0.1305,    0.520833,  1.000000,  0.750000,  0.000000,
-      0.000000,  -1.0000,   -0.0000,   -0.0000,   0.500000,  1.000000,
-      0.743584,  0.000000,  -0.097895, -0.9914,   -0.0000,   0.1305,
-      0.520833,  0.000000,  0.783494,  -0.125000, 0.000000,  -0.8633,
-      -0.5047,   -0.0000,   0.500000,  0.083333,  0.750000,  0.000000,
-      0.000000,  -1.0000,   -0.0000,   -0.0000,   0.500000,  0.000000,
-      0.776791,  -0.125000, -0.102266, -0.8559,   -0.5047,   0.1127,
-      0.520833,  0.083333,  0.875000,  -0.216506, 0.000000,  -0.4918,
-      -0.8707,   -0.0000,   0.500000,  0.166667,  0.783494,  -0.125000,
-      0.000000,  -0.8633,   -0.5047,   -0.0000,   0.500000,  0.083333,
-      0.867514,  -0.216506, -0.114210, -0.4876,   -0.8707,   0.0642,
-      0.520833,  0.166667,  1.000000,  -0.250000, 0.000000,  0.0108,
-      -0.9999,   -0.0000,   0.500000,  0.250000,  0.875000,  -0.216506,
-      0.000000,  -0.4918,   -0.8707,   -0.0000,   0.500000,  0.166667,
-      0.991445,  -0.250000, -0.130526, 0.0107,    -0.9999,   -0.0014,
-      0.520833,  0.250000,  1.125000,  -0.216506, 0.000000,  0.5080,
-      -0.8614,   -0.0000,   0.500000,  0.333333,  1.000000,  -0.250000,
-      0.000000,  0.0108,    -0.9999,   -0.0000,   0.500000,  0.250000,
-      1.115376,  -0.216506, -0.146842, 0.5037,    -0.8614,   -0.0663,
-      0.520833,  0.333333,  1.216506,  -0.125000, 0.000000,  0.8687,
-      -0.4954,   -0.0000,   0.500000,  0.416667,  1.125000,  -0.216506,
-      0.000000,  0.5080,    -0.8614,   -0.0000,   0.500000,  0.333333,
-      1.206099,  -0.125000, -0.158786, 0.8612,    -0.4954,   -0.1134,
-      0.520833,  0.416667,  1.250000,  0.000000,  0.000000,  1.0000,
-      -0.0000,   -0.0000,   0.500000,  0.500000,  1.216506,  -0.125000,
-      0.000000,  0.8687,    -0.4954,   -0.0000,   0.500000,  0.416667,
-      1.207407,  0.000000,  -0.323524, 0.9659,    -0.0000,   -0.2588,
-      0.541667,  0.500000,  1.206099,  0.125000,  -0.158786, 0.8612,
-      0.4954,    -0.1134,   0.520833,  0.583333,  1.239306,  0.000000,
-      -0.163158, 0.9914,    -0.0000,   -0.1305,   0.520833,  0.500000,
-      1.175055,  0.125000,  -0.314855, 0.8391,    0.4954,    -0.2248,
-      0.541667,  0.583333,  1.115376,  0.216506,  -0.146842, 0.5037,
-      0.8614,    -0.0663,   0.520833,  0.666667,  1.206099,  0.125000,
-      -0.158786, 0.8612,    0.4954,    -0.1134,   0.520833,  0.583333,
-      1.086667,  0.216506,  -0.291171, 0.4907,    0.8614,    -0.1315,
-      0.541667,  0.666667,  0.991445,  0.250000,  -0.130526, 0.0107,
-      0.9999,    -0.0014,   0.520833,  0.750000,  1.115376,  0.216506,
-      -0.146842, 0.5037,    0.8614,    -0.0663,   0.520833,  0.666667,
-      0.965926,  0.250000,  -0.258819, 0.0104,    0.9999,    -0.0028,
-      0.541667,  0.750000,  0.867514,  0.216506,  -0.114210, -0.4876,
-      0.8707,    0.0642,    0.520833,  0.833333,  0.991445,  0.250000,
-      -0.130526, 0.0107,    0.9999,    -0.0014,   0.520833,  0.750000,
-      0.867514,  0.216506,  -0.114210, -0.4876,   0.8707,    0.0642,
-      0.520833,  0.833333,  0.756797,  0.125000,  -0.202783, -0.8339,
-      0.5047,    0.2234,    0.541667,  0.916667,  0.776791,  0.125000,
-      -0.102266, -0.8559,   0.5047,    0.1127,    0.520833,  0.916667,
-      0.756797,  0.125000,  -0.202783, -0.8339,   0.5047,    0.2234,
-      0.541667,  0.916667,  0.743584,  0.000000,  -0.097895, -0.9914,
-      -0.0000,   0.1305,    0.520833,  1.000000,  0.776791,  0.125000,
-      -0.102266, -0.8559,   0.5047,    0.1127,    0.520833,  0.916667,
-      0.724444,  0.000000,  -0.194114, -0.9659,   -0.0000,   0.2588,
-      0.541667,  0.000000,  0.776791,  -0.125000, -0.102266, -0.8559,
-      -0.5047,   0.1127,    0.520833,  0.083333,  0.743584,  0.000000,
-      -0.097895, -0.9914,   -0.0000,   0.1305,    0.520833,  0.000000,
-      0.756797,  -0.125000, -0.202783, -0.8339,   -0.5047,   0.2234,
-      0.541667,  0.083333,  0.867514,  -0.216506, -0.114210, -0.4876,
-      -0.8707,   0.0642,    0.520833,  0.166667,  0.776791,  -0.125000,
-      -0.102266, -0.8559,   -0.5047,   0.1127,    0.520833,  0.083333,
-      0.867514,  -0.216506, -0.114210, -0.4876,   -0.8707,   0.0642,
-      0.520833,  0.166667,  0.965926,  -0.250000, -0.258819, 0.0104,
-      -0.9999,   -0.0028,   0.541667,  0.250000,  0.991445,  -0.250000,
-      -0.130526, 0.0107,    -0.9999,   -0.0014,   0.520833,  0.250000,
-      0.991445,  -0.250000, -0.130526, 0.0107,    -0.9999,   -0.0014,
-      0.520833,  0.250000,  1.086667,  -0.216506, -0.291171, 0.4907,
-      -0.8614,   -0.1315,   0.541667,  0.333333,  1.115376,  -0.216506,
-      -0.146842, 0.5037,    -0.8614,   -0.0663,   0.520833,  0.333333,
-      1.115376,  -0.216506, -0.146842, 0.5037,    -0.8614,   -0.0663,
-      0.520833,  0.333333,  1.175055,  -0.125000, -0.314855, 0.8391,
-      -0.4954,   -0.2248,   0.541667,  0.416667,  1.206099,  -0.125000,
-      -0.158786, 0.8612,    -0.4954,   -0.1134,   0.520833,  0.416667,
-      1.175055,  -0.125000, -0.314855, 0.8391,    -0.4954,   -0.2248,
-      0.541667,  0.416667,  1.239306,  0.000000,  -0.163158, 0.9914,
-      -0.0000,   -0.1305,   0.520833,  0.500000,  1.206099,  -0.125000,
-      -0.158786, 0.8612,    -0.4954,   -0.1134,   0.520833,  0.416667,
-      1.207407,  0.000000,  -0.323524, 0.9659,    -0.0000,   -0.2588,
-      0.541667,  0.500000,  1.123905,  0.125000,  -0.465537, 0.8025,
-      0.4954,    -0.3324,   0.562500,  0.583333,  1.175055,  0.125000,
-      -0.314855, 0.8391,    0.4954,    -0.2248,   0.541667,  0.583333,
-      1.123905,  0.125000,  -0.465537, 0.8025,    0.4954,    -0.3324,
-      0.562500,  0.583333,  1.086667,  0.216506,  -0.291171, 0.4907,
-      0.8614,    -0.1315,   0.541667,  0.666667,  1.175055,  0.125000,
-      -0.314855, 0.8391,    0.4954,    -0.2248,   0.541667,  0.583333,
-      1.039364,  0.216506,  -0.430519, 0.4693,    0.8614,    -0.1944,
-      0.562500,  0.666667,  0.965926,  0.250000,  -0.258819, 0.0104,
-      0.9999,    -0.0028,   0.541667,  0.750000,  1.086667,  0.216506,
-      -0.291171, 0.4907,    0.8614,    -0.1315,   0.541667,  0.666667,
-      0.965926,  0.250000,  -0.258819, 0.0104,    0.9999,    -0.0028,
-      0.541667,  0.750000,  0.808395,  0.216506,  -0.334848, -0.4544,
-      0.8707,    0.1882,    0.562500,  0.833333,  0.845185,  0.216506,
-      -0.226467, -0.4751,   0.8707,    0.1273,    0.541667,  0.833333,
-      0.845185,  0.216506,  -0.226467, -0.4751,   0.8707,    0.1273,
-      0.541667,  0.833333,  0.723854,  0.125000,  -0.299830, -0.7976,
-      0.5047,    0.3304,    0.562500,  0.916667,  0.756797,  0.125000,
-      -0.202783, -0.8339,   0.5047,    0.2234,    0.541667,  0.916667,
-      0.756797,  0.125000,  -0.202783, -0.8339,   0.5047,    0.2234,
-      0.541667,  0.916667,  0.692910,  0.000000,  -0.287013, -0.9239,
-      -0.0000,   0.3827,    0.562500,  1.000000,  0.724444,  0.000000,
-      -0.194114, -0.9659,   -0.0000,   0.2588,    0.541667,  1.000000,
-      0.692910,  0.000000,  -0.287013, -0.9239,   -0.0000,   0.3827,
-      0.562500,  0.000000,  0.756797,  -0.125000, -0.202783, -0.8339,
-      -0.5047,   0.2234,    0.541667,  0.083333,  0.724444,  0.000000,
-      -0.194114, -0.9659,   -0.0000,   0.2588,    0.541667,  0.000000,
-      0.723854,  -0.125000, -0.299830, -0.7976,   -0.5047,   0.3304,
-      0.562500,  0.083333,  0.845185,  -0.216506, -0.226467, -0.4751,
-      -0.8707,   0.1273,    0.541667,  0.166667,  0.756797,  -0.125000,
-      -0.202783, -0.8339,   -0.5047,   0.2234,    0.541667,  0.083333,
-      0.845185,  -0.216506, -0.226467, -0.4751,   -0.8707,   0.1273,
-      0.541667,  0.166667,  0.923880,  -0.250000, -0.382683, 0.0100,
-      -0.9999,   -0.0041,   0.562500,  0.250000,  0.965926,  -0.250000,
-      -0.258819, 0.0104,    -0.9999,   -0.0028,   0.541667,  0.250000,
-      0.965926,  -0.250000, -0.258819, 0.0104,    -0.9999,   -0.0028,
-      0.541667,  0.250000,  1.039364,  -0.216506, -0.430519, 0.4693,
-      -0.8614,   -0.1944,   0.562500,  0.333333,  1.086667,  -0.216506,
-      -0.291171, 0.4907,    -0.8614,   -0.1315,   0.541667,  0.333333,
-      1.086667,  -0.216506, -0.291171, 0.4907,    -0.8614,   -0.1315,
-      0.541667,  0.333333,  1.123905,  -0.125000, -0.465537, 0.8025,
-      -0.4954,   -0.3324,   0.562500,  0.416667,  1.175055,  -0.125000,
-      -0.314855, 0.8391,    -0.4954,   -0.2248,   0.541667,  0.416667,
-      1.123905,  -0.125000, -0.465537, 0.8025,    -0.4954,   -0.3324,
-      0.562500,  0.416667,  1.207407,  0.000000,  -0.323524, 0.9659,
-      -0.0000,   -0.2588,   0.541667,  0.500000,  1.175055,  -0.125000,
-      -0.314855, 0.8391,    -0.4954,   -0.2248,   0.541667,  0.416667,
-      1.154849,  0.000000,  -0.478354, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  1.053525,  0.125000,  -0.608253, 0.7523,
-      0.4954,    -0.4343,   0.583333,  0.583333,  1.123905,  0.125000,
-      -0.465537, 0.8025,    0.4954,    -0.3324,   0.562500,  0.583333,
-      1.123905,  0.125000,  -0.465537, 0.8025,    0.4954,    -0.3324,
-      0.562500,  0.583333,  0.974279,  0.216506,  -0.562500, 0.4399,
-      0.8614,    -0.2540,   0.583333,  0.666667,  1.039364,  0.216506,
-      -0.430519, 0.4693,    0.8614,    -0.1944,   0.562500,  0.666667,
-      1.039364,  0.216506,  -0.430519, 0.4693,    0.8614,    -0.1944,
-      0.562500,  0.666667,  0.866025,  0.250000,  -0.500000, 0.0093,
-      0.9999,    -0.0054,   0.583333,  0.750000,  0.923880,  0.250000,
-      -0.382683, 0.0100,    0.9999,    -0.0041,   0.562500,  0.750000,
-      0.866025,  0.250000,  -0.500000, 0.0093,    0.9999,    -0.0054,
-      0.583333,  0.750000,  0.808395,  0.216506,  -0.334848, -0.4544,
-      0.8707,    0.1882,    0.562500,  0.833333,  0.923880,  0.250000,
-      -0.382683, 0.0100,    0.9999,    -0.0041,   0.562500,  0.750000,
-      0.808395,  0.216506,  -0.334848, -0.4544,   0.8707,    0.1882,
-      0.562500,  0.833333,  0.678525,  0.125000,  -0.391747, -0.7476,
-      0.5047,    0.4316,    0.583333,  0.916667,  0.723854,  0.125000,
-      -0.299830, -0.7976,   0.5047,    0.3304,    0.562500,  0.916667,
-      0.678525,  0.125000,  -0.391747, -0.7476,   0.5047,    0.4316,
-      0.583333,  0.916667,  0.692910,  0.000000,  -0.287013, -0.9239,
-      -0.0000,   0.3827,    0.562500,  1.000000,  0.723854,  0.125000,
-      -0.299830, -0.7976,   0.5047,    0.3304,    0.562500,  0.916667,
-      0.649519,  0.000000,  -0.375000, -0.8660,   -0.0000,   0.5000,
-      0.583333,  0.000000,  0.723854,  -0.125000, -0.299830, -0.7976,
-      -0.5047,   0.3304,    0.562500,  0.083333,  0.692910,  0.000000,
-      -0.287013, -0.9239,   -0.0000,   0.3827,    0.562500,  0.000000,
-      0.678525,  -0.125000, -0.391747, -0.7476,   -0.5047,   0.4316,
-      0.583333,  0.083333,  0.808395,  -0.216506, -0.334848, -0.4544,
-      -0.8707,   0.1882,    0.562500,  0.166667,  0.723854,  -0.125000,
-      -0.299830, -0.7976,   -0.5047,   0.3304,    0.562500,  0.083333,
-      0.808395,  -0.216506, -0.334848, -0.4544,   -0.8707,   0.1882,
-      0.562500,  0.166667,  0.866025,  -0.250000, -0.500000, 0.0093,
-      -0.9999,   -0.0054,   0.583333,  0.250000,  0.923880,  -0.250000,
-      -0.382683, 0.0100,    -0.9999,   -0.0041,   0.562500,  0.250000,
-      0.866025,  -0.250000, -0.500000, 0.0093,    -0.9999,   -0.0054,
-      0.583333,  0.250000,  1.039364,  -0.216506, -0.430519, 0.4693,
-      -0.8614,   -0.1944,   0.562500,  0.333333,  0.923880,  -0.250000,
-      -0.382683, 0.0100,    -0.9999,   -0.0041,   0.562500,  0.250000,
-      0.974279,  -0.216506, -0.562500, 0.4399,    -0.8614,   -0.2540,
-      0.583333,  0.333333,  1.123905,  -0.125000, -0.465537, 0.8025,
-      -0.4954,   -0.3324,   0.562500,  0.416667,  1.039364,  -0.216506,
-      -0.430519, 0.4693,    -0.8614,   -0.1944,   0.562500,  0.333333,
-      1.053525,  -0.125000, -0.608253, 0.7523,    -0.4954,   -0.4343,
-      0.583333,  0.416667,  1.154849,  0.000000,  -0.478354, 0.9239,
-      -0.0000,   -0.3827,   0.562500,  0.500000,  1.123905,  -0.125000,
-      -0.465537, 0.8025,    -0.4954,   -0.3324,   0.562500,  0.416667,
-      0.991692,  0.000000,  -0.760952, 0.7934,    -0.0000,   -0.6088,
-      0.604167,  0.500000,  1.053525,  0.125000,  -0.608253, 0.7523,
-      0.4954,    -0.4343,   0.583333,  0.583333,  1.082532,  0.000000,
-      -0.625000, 0.8660,    -0.0000,   -0.5000,   0.583333,  0.500000,
-      1.053525,  0.125000,  -0.608253, 0.7523,    0.4954,    -0.4343,
-      0.583333,  0.583333,  0.892523,  0.216506,  -0.684856, 0.4030,
-      0.8614,    -0.3093,   0.604167,  0.666667,  0.974279,  0.216506,
-      -0.562500, 0.4399,    0.8614,    -0.2540,   0.583333,  0.666667,
-      0.892523,  0.216506,  -0.684856, 0.4030,    0.8614,    -0.3093,
-      0.604167,  0.666667,  0.866025,  0.250000,  -0.500000, 0.0093,
-      0.9999,    -0.0054,   0.583333,  0.750000,  0.974279,  0.216506,
-      -0.562500, 0.4399,    0.8614,    -0.2540,   0.583333,  0.666667,
-      0.793353,  0.250000,  -0.608761, 0.0086,    0.9999,    -0.0066,
-      0.604167,  0.750000,  0.757772,  0.216506,  -0.437500, -0.4259,
-      0.8707,    0.2459,    0.583333,  0.833333,  0.866025,  0.250000,
-      -0.500000, 0.0093,    0.9999,    -0.0054,   0.583333,  0.750000,
-      0.757772,  0.216506,  -0.437500, -0.4259,   0.8707,    0.2459,
-      0.583333,  0.833333,  0.621587,  0.125000,  -0.476961, -0.6849,
-      0.5047,    0.5255,    0.604167,  0.916667,  0.678525,  0.125000,
-      -0.391747, -0.7476,   0.5047,    0.4316,    0.583333,  0.916667,
-      0.621587,  0.125000,  -0.476961, -0.6849,   0.5047,    0.5255,
-      0.604167,  0.916667,  0.649519,  0.000000,  -0.375000, -0.8660,
-      -0.0000,   0.5000,    0.583333,  1.000000,  0.678525,  0.125000,
-      -0.391747, -0.7476,   0.5047,    0.4316,    0.583333,  0.916667,
-      0.595015,  0.000000,  -0.456571, -0.7934,   -0.0000,   0.6088,
-      0.604167,  0.000000,  0.678525,  -0.125000, -0.391747, -0.7476,
-      -0.5047,   0.4316,    0.583333,  0.083333,  0.649519,  0.000000,
-      -0.375000, -0.8660,   -0.0000,   0.5000,    0.583333,  0.000000,
-      0.621587,  -0.125000, -0.476961, -0.6849,   -0.5047,   0.5255,
-      0.604167,  0.083333,  0.757772,  -0.216506, -0.437500, -0.4259,
-      -0.8707,   0.2459,    0.583333,  0.166667,  0.678525,  -0.125000,
-      -0.391747, -0.7476,   -0.5047,   0.4316,    0.583333,  0.083333,
-      0.694184,  -0.216506, -0.532666, -0.3902,   -0.8707,   0.2994,
-      0.604167,  0.166667,  0.866025,  -0.250000, -0.500000, 0.0093,
-      -0.9999,   -0.0054,   0.583333,  0.250000,  0.757772,  -0.216506,
-      -0.437500, -0.4259,   -0.8707,   0.2459,    0.583333,  0.166667,
-      0.793353,  -0.250000, -0.608761, 0.0086,    -0.9999,   -0.0066,
-      0.604167,  0.250000,  0.974279,  -0.216506, -0.562500, 0.4399,
-      -0.8614,   -0.2540,   0.583333,  0.333333,  0.866025,  -0.250000,
-      -0.500000, 0.0093,    -0.9999,   -0.0054,   0.583333,  0.250000,
-      0.892523,  -0.216506, -0.684856, 0.4030,    -0.8614,   -0.3093,
-      0.604167,  0.333333,  1.053525,  -0.125000, -0.608253, 0.7523,
-      -0.4954,   -0.4343,   0.583333,  0.416667,  0.974279,  -0.216506,
-      -0.562500, 0.4399,    -0.8614,   -0.2540,   0.583333,  0.333333,
-      1.053525,  -0.125000, -0.608253, 0.7523,    -0.4954,   -0.4343,
-      0.583333,  0.416667,  0.991692,  0.000000,  -0.760952, 0.7934,
-      -0.0000,   -0.6088,   0.604167,  0.500000,  1.082532,  0.000000,
-      -0.625000, 0.8660,    -0.0000,   -0.5000,   0.583333,  0.500000,
-      0.883883,  0.000000,  -0.883884, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.965119,  0.125000,  -0.740562, 0.6892,
-      0.4954,    -0.5288,   0.604167,  0.583333,  0.991692,  0.000000,
-      -0.760952, 0.7934,    -0.0000,   -0.6088,   0.604167,  0.500000,
-      0.860200,  0.125000,  -0.860200, 0.6142,    0.4954,    -0.6142,
-      0.625000,  0.583333,  0.892523,  0.216506,  -0.684856, 0.4030,
-      0.8614,    -0.3093,   0.604167,  0.666667,  0.965119,  0.125000,
-      -0.740562, 0.6892,    0.4954,    -0.5288,   0.604167,  0.583333,
-      0.795495,  0.216506,  -0.795495, 0.3592,    0.8614,    -0.3592,
-      0.625000,  0.666667,  0.793353,  0.250000,  -0.608761, 0.0086,
-      0.9999,    -0.0066,   0.604167,  0.750000,  0.892523,  0.216506,
-      -0.684856, 0.4030,    0.8614,    -0.3093,   0.604167,  0.666667,
-      0.707107,  0.250000,  -0.707107, 0.0076,    0.9999,    -0.0076,
-      0.625000,  0.750000,  0.694184,  0.216506,  -0.532666, -0.3902,
-      0.8707,    0.2994,    0.604167,  0.833333,  0.793353,  0.250000,
-      -0.608761, 0.0086,    0.9999,    -0.0066,   0.604167,  0.750000,
-      0.618718,  0.216506,  -0.618719, -0.3478,   0.8707,    0.3478,
-      0.625000,  0.833333,  0.621587,  0.125000,  -0.476961, -0.6849,
-      0.5047,    0.5255,    0.604167,  0.916667,  0.694184,  0.216506,
-      -0.532666, -0.3902,   0.8707,    0.2994,    0.604167,  0.833333,
-      0.554014,  0.125000,  -0.554014, -0.6104,   0.5047,    0.6104,
-      0.625000,  0.916667,  0.595015,  0.000000,  -0.456571, -0.7934,
-      -0.0000,   0.6088,    0.604167,  1.000000,  0.621587,  0.125000,
-      -0.476961, -0.6849,   0.5047,    0.5255,    0.604167,  0.916667,
-      0.595015,  0.000000,  -0.456571, -0.7934,   -0.0000,   0.6088,
-      0.604167,  0.000000,  0.554014,  -0.125000, -0.554014, -0.6104,
-      -0.5047,   0.6104,    0.625000,  0.083333,  0.621587,  -0.125000,
-      -0.476961, -0.6849,   -0.5047,   0.5255,    0.604167,  0.083333,
-      0.554014,  -0.125000, -0.554014, -0.6104,   -0.5047,   0.6104,
-      0.625000,  0.083333,  0.694184,  -0.216506, -0.532666, -0.3902,
-      -0.8707,   0.2994,    0.604167,  0.166667,  0.621587,  -0.125000,
-      -0.476961, -0.6849,   -0.5047,   0.5255,    0.604167,  0.083333,
-      0.618718,  -0.216506, -0.618719, -0.3478,   -0.8707,   0.3478,
-      0.625000,  0.166667,  0.793353,  -0.250000, -0.608761, 0.0086,
-      -0.9999,   -0.0066,   0.604167,  0.250000,  0.694184,  -0.216506,
-      -0.532666, -0.3902,   -0.8707,   0.2994,    0.604167,  0.166667,
-      0.707107,  -0.250000, -0.707107, 0.0076,    -0.9999,   -0.0076,
-      0.625000,  0.250000,  0.892523,  -0.216506, -0.684856, 0.4030,
-      -0.8614,   -0.3093,   0.604167,  0.333333,  0.793353,  -0.250000,
-      -0.608761, 0.0086,    -0.9999,   -0.0066,   0.604167,  0.250000,
-      0.892523,  -0.216506, -0.684856, 0.4030,    -0.8614,   -0.3093,
-      0.604167,  0.333333,  0.860200,  -0.125000, -0.860200, 0.6142,
-      -0.4954,   -0.6142,   0.625000,  0.416667,  0.965119,  -0.125000,
-      -0.740562, 0.6892,    -0.4954,   -0.5288,   0.604167,  0.416667,
-      0.860200,  -0.125000, -0.860200, 0.6142,    -0.4954,   -0.6142,
-      0.625000,  0.416667,  0.991692,  0.000000,  -0.760952, 0.7934,
-      -0.0000,   -0.6088,   0.604167,  0.500000,  0.965119,  -0.125000,
-      -0.740562, 0.6892,    -0.4954,   -0.5288,   0.604167,  0.416667,
-      0.760952,  0.000000,  -0.991691, 0.6088,    -0.0000,   -0.7934,
-      0.645833,  0.500000,  0.860200,  0.125000,  -0.860200, 0.6142,
-      0.4954,    -0.6142,   0.625000,  0.583333,  0.883883,  0.000000,
-      -0.883884, 0.7071,    -0.0000,   -0.7071,   0.625000,  0.500000,
-      0.860200,  0.125000,  -0.860200, 0.6142,    0.4954,    -0.6142,
-      0.625000,  0.583333,  0.684857,  0.216506,  -0.892522, 0.3092,
-      0.8614,    -0.4030,   0.645833,  0.666667,  0.795495,  0.216506,
-      -0.795495, 0.3592,    0.8614,    -0.3592,   0.625000,  0.666667,
-      0.684857,  0.216506,  -0.892522, 0.3092,    0.8614,    -0.4030,
-      0.645833,  0.666667,  0.707107,  0.250000,  -0.707107, 0.0076,
-      0.9999,    -0.0076,   0.625000,  0.750000,  0.795495,  0.216506,
-      -0.795495, 0.3592,    0.8614,    -0.3592,   0.625000,  0.666667,
-      0.608762,  0.250000,  -0.793353, 0.0066,    0.9999,    -0.0085,
-      0.645833,  0.750000,  0.618718,  0.216506,  -0.618719, -0.3478,
-      0.8707,    0.3478,    0.625000,  0.833333,  0.707107,  0.250000,
-      -0.707107, 0.0076,    0.9999,    -0.0076,   0.625000,  0.750000,
-      0.618718,  0.216506,  -0.618719, -0.3478,   0.8707,    0.3478,
-      0.625000,  0.833333,  0.476961,  0.125000,  -0.621587, -0.5255,
-      0.5047,    0.6849,    0.645833,  0.916667,  0.554014,  0.125000,
-      -0.554014, -0.6104,   0.5047,    0.6104,    0.625000,  0.916667,
-      0.476961,  0.125000,  -0.621587, -0.5255,   0.5047,    0.6849,
-      0.645833,  0.916667,  0.530330,  0.000000,  -0.530330, -0.7071,
-      -0.0000,   0.7071,    0.625000,  1.000000,  0.554014,  0.125000,
-      -0.554014, -0.6104,   0.5047,    0.6104,    0.625000,  0.916667,
-      0.456571,  0.000000,  -0.595015, -0.6088,   -0.0000,   0.7934,
-      0.645833,  0.000000,  0.554014,  -0.125000, -0.554014, -0.6104,
-      -0.5047,   0.6104,    0.625000,  0.083333,  0.530330,  0.000000,
-      -0.530330, -0.7071,   -0.0000,   0.7071,    0.625000,  0.000000,
-      0.476961,  -0.125000, -0.621587, -0.5255,   -0.5047,   0.6849,
-      0.645833,  0.083333,  0.618718,  -0.216506, -0.618719, -0.3478,
-      -0.8707,   0.3478,    0.625000,  0.166667,  0.554014,  -0.125000,
-      -0.554014, -0.6104,   -0.5047,   0.6104,    0.625000,  0.083333,
-      0.618718,  -0.216506, -0.618719, -0.3478,   -0.8707,   0.3478,
-      0.625000,  0.166667,  0.608762,  -0.250000, -0.793353, 0.0066,
-      -0.9999,   -0.0085,   0.645833,  0.250000,  0.707107,  -0.250000,
-      -0.707107, 0.0076,    -0.9999,   -0.0076,   0.625000,  0.250000,
-      0.707107,  -0.250000, -0.707107, 0.0076,    -0.9999,   -0.0076,
-      0.625000,  0.250000,  0.684857,  -0.216506, -0.892522, 0.3092,
-      -0.8614,   -0.4030,   0.645833,  0.333333,  0.795495,  -0.216506,
-      -0.795495, 0.3592,    -0.8614,   -0.3592,   0.625000,  0.333333,
-      0.684857,  -0.216506, -0.892522, 0.3092,    -0.8614,   -0.4030,
-      0.645833,  0.333333,  0.860200,  -0.125000, -0.860200, 0.6142,
-      -0.4954,   -0.6142,   0.625000,  0.416667,  0.795495,  -0.216506,
-      -0.795495, 0.3592,    -0.8614,   -0.3592,   0.625000,  0.333333,
-      0.740562,  -0.125000, -0.965119, 0.5288,    -0.4954,   -0.6892,
-      0.645833,  0.416667,  0.883883,  0.000000,  -0.883884, 0.7071,
-      -0.0000,   -0.7071,   0.625000,  0.500000,  0.860200,  -0.125000,
-      -0.860200, 0.6142,    -0.4954,   -0.6142,   0.625000,  0.416667,
-      0.625000,  0.000000,  -1.082532, 0.5000,    -0.0000,   -0.8660,
-      0.666667,  0.500000,  0.740562,  0.125000,  -0.965119, 0.5288,
-      0.4954,    -0.6892,   0.645833,  0.583333,  0.760952,  0.000000,
-      -0.991691, 0.6088,    -0.0000,   -0.7934,   0.645833,  0.500000,
-      0.740562,  0.125000,  -0.965119, 0.5288,    0.4954,    -0.6892,
-      0.645833,  0.583333,  0.562500,  0.216506,  -0.974279, 0.2540,
-      0.8614,    -0.4399,   0.666667,  0.666667,  0.684857,  0.216506,
-      -0.892522, 0.3092,    0.8614,    -0.4030,   0.645833,  0.666667,
-      0.684857,  0.216506,  -0.892522, 0.3092,    0.8614,    -0.4030,
-      0.645833,  0.666667,  0.500000,  0.250000,  -0.866025, 0.0054,
-      0.9999,    -0.0093,   0.666667,  0.750000,  0.608762,  0.250000,
-      -0.793353, 0.0066,    0.9999,    -0.0085,   0.645833,  0.750000,
-      0.500000,  0.250000,  -0.866025, 0.0054,    0.9999,    -0.0093,
-      0.666667,  0.750000,  0.532666,  0.216506,  -0.694184, -0.2994,
-      0.8707,    0.3902,    0.645833,  0.833333,  0.608762,  0.250000,
-      -0.793353, 0.0066,    0.9999,    -0.0085,   0.645833,  0.750000,
-      0.532666,  0.216506,  -0.694184, -0.2994,   0.8707,    0.3902,
-      0.645833,  0.833333,  0.391747,  0.125000,  -0.678525, -0.4316,
-      0.5047,    0.7476,    0.666667,  0.916667,  0.476961,  0.125000,
-      -0.621587, -0.5255,   0.5047,    0.6849,    0.645833,  0.916667,
-      0.391747,  0.125000,  -0.678525, -0.4316,   0.5047,    0.7476,
-      0.666667,  0.916667,  0.456571,  0.000000,  -0.595015, -0.6088,
-      -0.0000,   0.7934,    0.645833,  1.000000,  0.476961,  0.125000,
-      -0.621587, -0.5255,   0.5047,    0.6849,    0.645833,  0.916667,
-      0.375000,  0.000000,  -0.649519, -0.5000,   -0.0000,   0.8660,
-      0.666667,  0.000000,  0.476961,  -0.125000, -0.621587, -0.5255,
-      -0.5047,   0.6849,    0.645833,  0.083333,  0.456571,  0.000000,
-      -0.595015, -0.6088,   -0.0000,   0.7934,    0.645833,  0.000000,
-      0.391747,  -0.125000, -0.678525, -0.4316,   -0.5047,   0.7476,
-      0.666667,  0.083333,  0.532666,  -0.216506, -0.694184, -0.2994,
-      -0.8707,   0.3902,    0.645833,  0.166667,  0.476961,  -0.125000,
-      -0.621587, -0.5255,   -0.5047,   0.6849,    0.645833,  0.083333,
-      0.437500,  -0.216506, -0.757772, -0.2459,   -0.8707,   0.4259,
-      0.666667,  0.166667,  0.608762,  -0.250000, -0.793353, 0.0066,
-      -0.9999,   -0.0085,   0.645833,  0.250000,  0.532666,  -0.216506,
-      -0.694184, -0.2994,   -0.8707,   0.3902,    0.645833,  0.166667,
-      0.500000,  -0.250000, -0.866025, 0.0054,    -0.9999,   -0.0093,
-      0.666667,  0.250000,  0.684857,  -0.216506, -0.892522, 0.3092,
-      -0.8614,   -0.4030,   0.645833,  0.333333,  0.608762,  -0.250000,
-      -0.793353, 0.0066,    -0.9999,   -0.0085,   0.645833,  0.250000,
-      0.562500,  -0.216506, -0.974279, 0.2540,    -0.8614,   -0.4399,
-      0.666667,  0.333333,  0.740562,  -0.125000, -0.965119, 0.5288,
-      -0.4954,   -0.6892,   0.645833,  0.416667,  0.684857,  -0.216506,
-      -0.892522, 0.3092,    -0.8614,   -0.4030,   0.645833,  0.333333,
-      0.608253,  -0.125000, -1.053525, 0.4343,    -0.4954,   -0.7523,
-      0.666667,  0.416667,  0.760952,  0.000000,  -0.991691, 0.6088,
-      -0.0000,   -0.7934,   0.645833,  0.500000,  0.740562,  -0.125000,
-      -0.965119, 0.5288,    -0.4954,   -0.6892,   0.645833,  0.416667,
-      0.625000,  0.000000,  -1.082532, 0.5000,    -0.0000,   -0.8660,
-      0.666667,  0.500000,  0.465537,  0.125000,  -1.123905, 0.3324,
-      0.4954,    -0.8025,   0.687500,  0.583333,  0.608253,  0.125000,
-      -1.053525, 0.4343,    0.4954,    -0.7523,   0.666667,  0.583333,
-      0.465537,  0.125000,  -1.123905, 0.3324,    0.4954,    -0.8025,
-      0.687500,  0.583333,  0.562500,  0.216506,  -0.974279, 0.2540,
-      0.8614,    -0.4399,   0.666667,  0.666667,  0.608253,  0.125000,
-      -1.053525, 0.4343,    0.4954,    -0.7523,   0.666667,  0.583333,
-      0.430519,  0.216506,  -1.039364, 0.1944,    0.8614,    -0.4693,
-      0.687500,  0.666667,  0.500000,  0.250000,  -0.866025, 0.0054,
-      0.9999,    -0.0093,   0.666667,  0.750000,  0.562500,  0.216506,
-      -0.974279, 0.2540,    0.8614,    -0.4399,   0.666667,  0.666667,
-      0.382684,  0.250000,  -0.923879, 0.0041,    0.9999,    -0.0100,
-      0.687500,  0.750000,  0.437500,  0.216506,  -0.757772, -0.2459,
-      0.8707,    0.4259,    0.666667,  0.833333,  0.500000,  0.250000,
-      -0.866025, 0.0054,    0.9999,    -0.0093,   0.666667,  0.750000,
-      0.334848,  0.216506,  -0.808394, -0.1882,   0.8707,    0.4544,
-      0.687500,  0.833333,  0.391747,  0.125000,  -0.678525, -0.4316,
-      0.5047,    0.7476,    0.666667,  0.916667,  0.437500,  0.216506,
-      -0.757772, -0.2459,   0.8707,    0.4259,    0.666667,  0.833333,
-      0.299830,  0.125000,  -0.723854, -0.3304,   0.5047,    0.7976,
-      0.687500,  0.916667,  0.375000,  0.000000,  -0.649519, -0.5000,
-      -0.0000,   0.8660,    0.666667,  1.000000,  0.391747,  0.125000,
-      -0.678525, -0.4316,   0.5047,    0.7476,    0.666667,  0.916667,
-      0.287013,  0.000000,  -0.692910, -0.3827,   -0.0000,   0.9239,
-      0.687500,  0.000000,  0.391747,  -0.125000, -0.678525, -0.4316,
-      -0.5047,   0.7476,    0.666667,  0.083333,  0.375000,  0.000000,
-      -0.649519, -0.5000,   -0.0000,   0.8660,    0.666667,  0.000000,
-      0.299830,  -0.125000, -0.723854, -0.3304,   -0.5047,   0.7976,
-      0.687500,  0.083333,  0.437500,  -0.216506, -0.757772, -0.2459,
-      -0.8707,   0.4259,    0.666667,  0.166667,  0.391747,  -0.125000,
-      -0.678525, -0.4316,   -0.5047,   0.7476,    0.666667,  0.083333,
-      0.437500,  -0.216506, -0.757772, -0.2459,   -0.8707,   0.4259,
-      0.666667,  0.166667,  0.382684,  -0.250000, -0.923879, 0.0041,
-      -0.9999,   -0.0100,   0.687500,  0.250000,  0.500000,  -0.250000,
-      -0.866025, 0.0054,    -0.9999,   -0.0093,   0.666667,  0.250000,
-      0.500000,  -0.250000, -0.866025, 0.0054,    -0.9999,   -0.0093,
-      0.666667,  0.250000,  0.430519,  -0.216506, -1.039364, 0.1944,
-      -0.8614,   -0.4693,   0.687500,  0.333333,  0.562500,  -0.216506,
-      -0.974279, 0.2540,    -0.8614,   -0.4399,   0.666667,  0.333333,
-      0.430519,  -0.216506, -1.039364, 0.1944,    -0.8614,   -0.4693,
-      0.687500,  0.333333,  0.608253,  -0.125000, -1.053525, 0.4343,
-      -0.4954,   -0.7523,   0.666667,  0.416667,  0.562500,  -0.216506,
-      -0.974279, 0.2540,    -0.8614,   -0.4399,   0.666667,  0.333333,
-      0.465537,  -0.125000, -1.123905, 0.3324,    -0.4954,   -0.8025,
-      0.687500,  0.416667,  0.625000,  0.000000,  -1.082532, 0.5000,
-      -0.0000,   -0.8660,   0.666667,  0.500000,  0.608253,  -0.125000,
-      -1.053525, 0.4343,    -0.4954,   -0.7523,   0.666667,  0.416667,
-      0.323524,  0.000000,  -1.207407, 0.2588,    -0.0000,   -0.9659,
-      0.708333,  0.500000,  0.465537,  0.125000,  -1.123905, 0.3324,
-      0.4954,    -0.8025,   0.687500,  0.583333,  0.478355,  0.000000,
-      -1.154849, 0.3827,    -0.0000,   -0.9239,   0.687500,  0.500000,
-      0.314855,  0.125000,  -1.175055, 0.2248,    0.4954,    -0.8391,
-      0.708333,  0.583333,  0.430519,  0.216506,  -1.039364, 0.1944,
-      0.8614,    -0.4693,   0.687500,  0.666667,  0.465537,  0.125000,
-      -1.123905, 0.3324,    0.4954,    -0.8025,   0.687500,  0.583333,
-      0.291171,  0.216506,  -1.086667, 0.1315,    0.8614,    -0.4907,
-      0.708333,  0.666667,  0.382684,  0.250000,  -0.923879, 0.0041,
-      0.9999,    -0.0100,   0.687500,  0.750000,  0.430519,  0.216506,
-      -1.039364, 0.1944,    0.8614,    -0.4693,   0.687500,  0.666667,
-      0.258819,  0.250000,  -0.965926, 0.0028,    0.9999,    -0.0104,
-      0.708333,  0.750000,  0.334848,  0.216506,  -0.808394, -0.1882,
-      0.8707,    0.4544,    0.687500,  0.833333,  0.382684,  0.250000,
-      -0.923879, 0.0041,    0.9999,    -0.0100,   0.687500,  0.750000,
-      0.334848,  0.216506,  -0.808394, -0.1882,   0.8707,    0.4544,
-      0.687500,  0.833333,  0.202783,  0.125000,  -0.756797, -0.2234,
-      0.5047,    0.8339,    0.708333,  0.916667,  0.299830,  0.125000,
-      -0.723854, -0.3304,   0.5047,    0.7976,    0.687500,  0.916667,
-      0.202783,  0.125000,  -0.756797, -0.2234,   0.5047,    0.8339,
-      0.708333,  0.916667,  0.287013,  0.000000,  -0.692910, -0.3827,
-      -0.0000,   0.9239,    0.687500,  1.000000,  0.299830,  0.125000,
-      -0.723854, -0.3304,   0.5047,    0.7976,    0.687500,  0.916667,
-      0.194114,  0.000000,  -0.724444, -0.2588,   -0.0000,   0.9659,
-      0.708333,  0.000000,  0.299830,  -0.125000, -0.723854, -0.3304,
-      -0.5047,   0.7976,    0.687500,  0.083333,  0.287013,  0.000000,
-      -0.692910, -0.3827,   -0.0000,   0.9239,    0.687500,  0.000000,
-      0.202783,  -0.125000, -0.756797, -0.2234,   -0.5047,   0.8339,
-      0.708333,  0.083333,  0.334848,  -0.216506, -0.808394, -0.1882,
-      -0.8707,   0.4544,    0.687500,  0.166667,  0.299830,  -0.125000,
-      -0.723854, -0.3304,   -0.5047,   0.7976,    0.687500,  0.083333,
-      0.226467,  -0.216506, -0.845185, -0.1273,   -0.8707,   0.4751,
-      0.708333,  0.166667,  0.382684,  -0.250000, -0.923879, 0.0041,
-      -0.9999,   -0.0100,   0.687500,  0.250000,  0.334848,  -0.216506,
-      -0.808394, -0.1882,   -0.8707,   0.4544,    0.687500,  0.166667,
-      0.258819,  -0.250000, -0.965926, 0.0028,    -0.9999,   -0.0104,
-      0.708333,  0.250000,  0.430519,  -0.216506, -1.039364, 0.1944,
-      -0.8614,   -0.4693,   0.687500,  0.333333,  0.382684,  -0.250000,
-      -0.923879, 0.0041,    -0.9999,   -0.0100,   0.687500,  0.250000,
-      0.291171,  -0.216506, -1.086667, 0.1315,    -0.8614,   -0.4907,
-      0.708333,  0.333333,  0.465537,  -0.125000, -1.123905, 0.3324,
-      -0.4954,   -0.8025,   0.687500,  0.416667,  0.430519,  -0.216506,
-      -1.039364, 0.1944,    -0.8614,   -0.4693,   0.687500,  0.333333,
-      0.314855,  -0.125000, -1.175055, 0.2248,    -0.4954,   -0.8391,
-      0.708333,  0.416667,  0.478355,  0.000000,  -1.154849, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.465537,  -0.125000,
-      -1.123905, 0.3324,    -0.4954,   -0.8025,   0.687500,  0.416667,
-      0.163158,  0.000000,  -1.239306, 0.1305,    -0.0000,   -0.9914,
-      0.729167,  0.500000,  0.314855,  0.125000,  -1.175055, 0.2248,
-      0.4954,    -0.8391,   0.708333,  0.583333,  0.323524,  0.000000,
-      -1.207407, 0.2588,    -0.0000,   -0.9659,   0.708333,  0.500000,
-      0.158786,  0.125000,  -1.206099, 0.1134,    0.4954,    -0.8612,
-      0.729167,  0.583333,  0.291171,  0.216506,  -1.086667, 0.1315,
-      0.8614,    -0.4907,   0.708333,  0.666667,  0.314855,  0.125000,
-      -1.175055, 0.2248,    0.4954,    -0.8391,   0.708333,  0.583333,
-      0.291171,  0.216506,  -1.086667, 0.1315,    0.8614,    -0.4907,
-      0.708333,  0.666667,  0.130526,  0.250000,  -0.991445, 0.0014,
-      0.9999,    -0.0107,   0.729167,  0.750000,  0.258819,  0.250000,
-      -0.965926, 0.0028,    0.9999,    -0.0104,   0.708333,  0.750000,
-      0.130526,  0.250000,  -0.991445, 0.0014,    0.9999,    -0.0107,
-      0.729167,  0.750000,  0.226467,  0.216506,  -0.845185, -0.1273,
-      0.8707,    0.4751,    0.708333,  0.833333,  0.258819,  0.250000,
-      -0.965926, 0.0028,    0.9999,    -0.0104,   0.708333,  0.750000,
-      0.114210,  0.216506,  -0.867514, -0.0642,   0.8707,    0.4876,
-      0.729167,  0.833333,  0.202783,  0.125000,  -0.756797, -0.2234,
-      0.5047,    0.8339,    0.708333,  0.916667,  0.226467,  0.216506,
-      -0.845185, -0.1273,   0.8707,    0.4751,    0.708333,  0.833333,
-      0.102266,  0.125000,  -0.776791, -0.1127,   0.5047,    0.8559,
-      0.729167,  0.916667,  0.194114,  0.000000,  -0.724444, -0.2588,
-      -0.0000,   0.9659,    0.708333,  1.000000,  0.202783,  0.125000,
-      -0.756797, -0.2234,   0.5047,    0.8339,    0.708333,  0.916667,
-      0.194114,  0.000000,  -0.724444, -0.2588,   -0.0000,   0.9659,
-      0.708333,  0.000000,  0.102266,  -0.125000, -0.776791, -0.1127,
-      -0.5047,   0.8559,    0.729167,  0.083333,  0.202783,  -0.125000,
-      -0.756797, -0.2234,   -0.5047,   0.8339,    0.708333,  0.083333,
-      0.102266,  -0.125000, -0.776791, -0.1127,   -0.5047,   0.8559,
-      0.729167,  0.083333,  0.226467,  -0.216506, -0.845185, -0.1273,
-      -0.8707,   0.4751,    0.708333,  0.166667,  0.202783,  -0.125000,
-      -0.756797, -0.2234,   -0.5047,   0.8339,    0.708333,  0.083333,
-      0.226467,  -0.216506, -0.845185, -0.1273,   -0.8707,   0.4751,
-      0.708333,  0.166667,  0.130526,  -0.250000, -0.991445, 0.0014,
-      -0.9999,   -0.0107,   0.729167,  0.250000,  0.258819,  -0.250000,
-      -0.965926, 0.0028,    -0.9999,   -0.0104,   0.708333,  0.250000,
-      0.130526,  -0.250000, -0.991445, 0.0014,    -0.9999,   -0.0107,
-      0.729167,  0.250000,  0.291171,  -0.216506, -1.086667, 0.1315,
-      -0.8614,   -0.4907,   0.708333,  0.333333,  0.258819,  -0.250000,
-      -0.965926, 0.0028,    -0.9999,   -0.0104,   0.708333,  0.250000,
-      0.146842,  -0.216506, -1.115376, 0.0663,    -0.8614,   -0.5037,
-      0.729167,  0.333333,  0.314855,  -0.125000, -1.175055, 0.2248,
-      -0.4954,   -0.8391,   0.708333,  0.416667,  0.291171,  -0.216506,
-      -1.086667, 0.1315,    -0.8614,   -0.4907,   0.708333,  0.333333,
-      0.158786,  -0.125000, -1.206099, 0.1134,    -0.4954,   -0.8612,
-      0.729167,  0.416667,  0.323524,  0.000000,  -1.207407, 0.2588,
-      -0.0000,   -0.9659,   0.708333,  0.500000,  0.314855,  -0.125000,
-      -1.175055, 0.2248,    -0.4954,   -0.8391,   0.708333,  0.416667,
-      0.000000,  0.000000,  -1.250000, -0.0000,   -0.0000,   -1.0000,
-      0.750000,  0.500000,  0.158786,  0.125000,  -1.206099, 0.1134,
-      0.4954,    -0.8612,   0.729167,  0.583333,  0.163158,  0.000000,
-      -1.239306, 0.1305,    -0.0000,   -0.9914,   0.729167,  0.500000,
-      0.000000,  0.125000,  -1.216506, -0.0000,   0.4954,    -0.8687,
-      0.750000,  0.583333,  0.146842,  0.216506,  -1.115376, 0.0663,
-      0.8614,    -0.5037,   0.729167,  0.666667,  0.158786,  0.125000,
-      -1.206099, 0.1134,    0.4954,    -0.8612,   0.729167,  0.583333,
-      0.000000,  0.216506,  -1.125000, -0.0000,   0.8614,    -0.5080,
-      0.750000,  0.666667,  0.130526,  0.250000,  -0.991445, 0.0014,
-      0.9999,    -0.0107,   0.729167,  0.750000,  0.146842,  0.216506,
-      -1.115376, 0.0663,    0.8614,    -0.5037,   0.729167,  0.666667,
-      0.130526,  0.250000,  -0.991445, 0.0014,    0.9999,    -0.0107,
-      0.729167,  0.750000,  0.000000,  0.216506,  -0.875000, -0.0000,
-      0.8707,    0.4918,    0.750000,  0.833333,  0.114210,  0.216506,
-      -0.867514, -0.0642,   0.8707,    0.4876,    0.729167,  0.833333,
-      0.114210,  0.216506,  -0.867514, -0.0642,   0.8707,    0.4876,
-      0.729167,  0.833333,  0.000000,  0.125000,  -0.783494, -0.0000,
-      0.5047,    0.8633,    0.750000,  0.916667,  0.102266,  0.125000,
-      -0.776791, -0.1127,   0.5047,    0.8559,    0.729167,  0.916667,
-      0.000000,  0.125000,  -0.783494, -0.0000,   0.5047,    0.8633,
-      0.750000,  0.916667,  0.097895,  0.000000,  -0.743584, -0.1305,
-      -0.0000,   0.9914,    0.729167,  1.000000,  0.102266,  0.125000,
-      -0.776791, -0.1127,   0.5047,    0.8559,    0.729167,  0.916667,
-      0.000000,  0.000000,  -0.750000, -0.0000,   -0.0000,   1.0000,
-      0.750000,  0.000000,  0.102266,  -0.125000, -0.776791, -0.1127,
-      -0.5047,   0.8559,    0.729167,  0.083333,  0.097895,  0.000000,
-      -0.743584, -0.1305,   -0.0000,   0.9914,    0.729167,  0.000000,
-      0.000000,  -0.125000, -0.783494, -0.0000,   -0.5047,   0.8633,
-      0.750000,  0.083333,  0.114210,  -0.216506, -0.867514, -0.0642,
-      -0.8707,   0.4876,    0.729167,  0.166667,  0.102266,  -0.125000,
-      -0.776791, -0.1127,   -0.5047,   0.8559,    0.729167,  0.083333,
-      0.000000,  -0.216506, -0.875000, -0.0000,   -0.8707,   0.4918,
-      0.750000,  0.166667,  0.130526,  -0.250000, -0.991445, 0.0014,
-      -0.9999,   -0.0107,   0.729167,  0.250000,  0.114210,  -0.216506,
-      -0.867514, -0.0642,   -0.8707,   0.4876,    0.729167,  0.166667,
-      0.000000,  -0.250000, -1.000000, -0.0000,   -0.9999,   -0.0108,
-      0.750000,  0.250000,  0.146842,  -0.216506, -1.115376, 0.0663,
-      -0.8614,   -0.5037,   0.729167,  0.333333,  0.130526,  -0.250000,
-      -0.991445, 0.0014,    -0.9999,   -0.0107,   0.729167,  0.250000,
-      0.000000,  -0.216506, -1.125000, -0.0000,   -0.8614,   -0.5080,
-      0.750000,  0.333333,  0.158786,  -0.125000, -1.206099, 0.1134,
-      -0.4954,   -0.8612,   0.729167,  0.416667,  0.146842,  -0.216506,
-      -1.115376, 0.0663,    -0.8614,   -0.5037,   0.729167,  0.333333,
-      0.158786,  -0.125000, -1.206099, 0.1134,    -0.4954,   -0.8612,
-      0.729167,  0.416667,  0.000000,  0.000000,  -1.250000, -0.0000,
-      -0.0000,   -1.0000,   0.750000,  0.500000,  0.163158,  0.000000,
-      -1.239306, 0.1305,    -0.0000,   -0.9914,   0.729167,  0.500000,
-      -0.163158, 0.000000,  -1.239306, -0.1305,   -0.0000,   -0.9914,
-      0.770833,  0.500000,  0.000000,  0.125000,  -1.216506, -0.0000,
-      0.4954,    -0.8687,   0.750000,  0.583333,  0.000000,  0.000000,
-      -1.250000, -0.0000,   -0.0000,   -1.0000,   0.750000,  0.500000,
-      -0.158786, 0.125000,  -1.206099, -0.1134,   0.4954,    -0.8612,
-      0.770833,  0.583333,  0.000000,  0.216506,  -1.125000, -0.0000,
-      0.8614,    -0.5080,   0.750000,  0.666667,  0.000000,  0.125000,
-      -1.216506, -0.0000,   0.4954,    -0.8687,   0.750000,  0.583333,
-      -0.146842, 0.216506,  -1.115375, -0.0663,   0.8614,    -0.5036,
-      0.770833,  0.666667,  0.000000,  0.250000,  -1.000000, -0.0000,
-      0.9999,    -0.0108,   0.750000,  0.750000,  0.000000,  0.216506,
-      -1.125000, -0.0000,   0.8614,    -0.5080,   0.750000,  0.666667,
-      -0.130526, 0.250000,  -0.991445, -0.0014,   0.9999,    -0.0107,
-      0.770833,  0.750000,  0.000000,  0.216506,  -0.875000, -0.0000,
-      0.8707,    0.4918,    0.750000,  0.833333,  0.000000,  0.250000,
-      -1.000000, -0.0000,   0.9999,    -0.0108,   0.750000,  0.750000,
-      -0.114211, 0.216506,  -0.867514, 0.0642,    0.8707,    0.4876,
-      0.770833,  0.833333,  0.000000,  0.125000,  -0.783494, -0.0000,
-      0.5047,    0.8633,    0.750000,  0.916667,  0.000000,  0.216506,
-      -0.875000, -0.0000,   0.8707,    0.4918,    0.750000,  0.833333,
-      -0.102267, 0.125000,  -0.776791, 0.1127,    0.5047,    0.8559,
-      0.770833,  0.916667,  0.000000,  0.000000,  -0.750000, -0.0000,
-      -0.0000,   1.0000,    0.750000,  1.000000,  0.000000,  0.125000,
-      -0.783494, -0.0000,   0.5047,    0.8633,    0.750000,  0.916667,
-      0.000000,  0.000000,  -0.750000, -0.0000,   -0.0000,   1.0000,
-      0.750000,  0.000000,  -0.102267, -0.125000, -0.776791, 0.1127,
-      -0.5047,   0.8559,    0.770833,  0.083333,  0.000000,  -0.125000,
-      -0.783494, -0.0000,   -0.5047,   0.8633,    0.750000,  0.083333,
-      -0.102267, -0.125000, -0.776791, 0.1127,    -0.5047,   0.8559,
-      0.770833,  0.083333,  0.000000,  -0.216506, -0.875000, -0.0000,
-      -0.8707,   0.4918,    0.750000,  0.166667,  0.000000,  -0.125000,
-      -0.783494, -0.0000,   -0.5047,   0.8633,    0.750000,  0.083333,
-      0.000000,  -0.216506, -0.875000, -0.0000,   -0.8707,   0.4918,
-      0.750000,  0.166667,  -0.130526, -0.250000, -0.991445, -0.0014,
-      -0.9999,   -0.0107,   0.770833,  0.250000,  0.000000,  -0.250000,
-      -1.000000, -0.0000,   -0.9999,   -0.0108,   0.750000,  0.250000,
-      0.000000,  -0.250000, -1.000000, -0.0000,   -0.9999,   -0.0108,
-      0.750000,  0.250000,  -0.146842, -0.216506, -1.115375, -0.0663,
-      -0.8614,   -0.5036,   0.770833,  0.333333,  0.000000,  -0.216506,
-      -1.125000, -0.0000,   -0.8614,   -0.5080,   0.750000,  0.333333,
-      0.000000,  -0.216506, -1.125000, -0.0000,   -0.8614,   -0.5080,
-      0.750000,  0.333333,  -0.158786, -0.125000, -1.206099, -0.1134,
-      -0.4954,   -0.8612,   0.770833,  0.416667,  0.000000,  -0.125000,
-      -1.216506, -0.0000,   -0.4954,   -0.8687,   0.750000,  0.416667,
-      0.000000,  -0.125000, -1.216506, -0.0000,   -0.4954,   -0.8687,
-      0.750000,  0.416667,  -0.163158, 0.000000,  -1.239306, -0.1305,
-      -0.0000,   -0.9914,   0.770833,  0.500000,  0.000000,  0.000000,
-      -1.250000, -0.0000,   -0.0000,   -1.0000,   0.750000,  0.500000,
-      -0.323524, 0.000000,  -1.207407, -0.2588,   -0.0000,   -0.9659,
-      0.791667,  0.500000,  -0.158786, 0.125000,  -1.206099, -0.1134,
-      0.4954,    -0.8612,   0.770833,  0.583333,  -0.163158, 0.000000,
-      -1.239306, -0.1305,   -0.0000,   -0.9914,   0.770833,  0.500000,
-      -0.158786, 0.125000,  -1.206099, -0.1134,   0.4954,    -0.8612,
-      0.770833,  0.583333,  -0.291171, 0.216506,  -1.086667, -0.1315,
-      0.8614,    -0.4907,   0.791667,  0.666667,  -0.146842, 0.216506,
-      -1.115375, -0.0663,   0.8614,    -0.5036,   0.770833,  0.666667,
-      -0.146842, 0.216506,  -1.115375, -0.0663,   0.8614,    -0.5036,
-      0.770833,  0.666667,  -0.258819, 0.250000,  -0.965926, -0.0028,
-      0.9999,    -0.0104,   0.791667,  0.750000,  -0.130526, 0.250000,
-      -0.991445, -0.0014,   0.9999,    -0.0107,   0.770833,  0.750000,
-      -0.258819, 0.250000,  -0.965926, -0.0028,   0.9999,    -0.0104,
-      0.791667,  0.750000,  -0.114211, 0.216506,  -0.867514, 0.0642,
-      0.8707,    0.4876,    0.770833,  0.833333,  -0.130526, 0.250000,
-      -0.991445, -0.0014,   0.9999,    -0.0107,   0.770833,  0.750000,
-      -0.226467, 0.216506,  -0.845185, 0.1273,    0.8707,    0.4751,
-      0.791667,  0.833333,  -0.102267, 0.125000,  -0.776791, 0.1127,
-      0.5047,    0.8559,    0.770833,  0.916667,  -0.114211, 0.216506,
-      -0.867514, 0.0642,    0.8707,    0.4876,    0.770833,  0.833333,
-      -0.202783, 0.125000,  -0.756797, 0.2234,    0.5047,    0.8339,
-      0.791667,  0.916667,  -0.097895, 0.000000,  -0.743584, 0.1305,
-      -0.0000,   0.9914,    0.770833,  1.000000,  -0.102267, 0.125000,
-      -0.776791, 0.1127,    0.5047,    0.8559,    0.770833,  0.916667,
-      -0.194114, 0.000000,  -0.724444, 0.2588,    -0.0000,   0.9659,
-      0.791667,  0.000000,  -0.102267, -0.125000, -0.776791, 0.1127,
-      -0.5047,   0.8559,    0.770833,  0.083333,  -0.097895, 0.000000,
-      -0.743584, 0.1305,    -0.0000,   0.9914,    0.770833,  0.000000,
-      -0.202783, -0.125000, -0.756797, 0.2234,    -0.5047,   0.8339,
-      0.791667,  0.083333,  -0.114211, -0.216506, -0.867514, 0.0642,
-      -0.8707,   0.4876,    0.770833,  0.166667,  -0.102267, -0.125000,
-      -0.776791, 0.1127,    -0.5047,   0.8559,    0.770833,  0.083333,
-      -0.226467, -0.216506, -0.845185, 0.1273,    -0.8707,   0.4751,
-      0.791667,  0.166667,  -0.130526, -0.250000, -0.991445, -0.0014,
-      -0.9999,   -0.0107,   0.770833,  0.250000,  -0.114211, -0.216506,
-      -0.867514, 0.0642,    -0.8707,   0.4876,    0.770833,  0.166667,
-      -0.258819, -0.250000, -0.965926, -0.0028,   -0.9999,   -0.0104,
-      0.791667,  0.250000,  -0.146842, -0.216506, -1.115375, -0.0663,
-      -0.8614,   -0.5036,   0.770833,  0.333333,  -0.130526, -0.250000,
-      -0.991445, -0.0014,   -0.9999,   -0.0107,   0.770833,  0.250000,
-      -0.291171, -0.216506, -1.086667, -0.1315,   -0.8614,   -0.4907,
-      0.791667,  0.333333,  -0.158786, -0.125000, -1.206099, -0.1134,
-      -0.4954,   -0.8612,   0.770833,  0.416667,  -0.146842, -0.216506,
-      -1.115375, -0.0663,   -0.8614,   -0.5036,   0.770833,  0.333333,
-      -0.314855, -0.125000, -1.175055, -0.2248,   -0.4954,   -0.8391,
-      0.791667,  0.416667,  -0.163158, 0.000000,  -1.239306, -0.1305,
-      -0.0000,   -0.9914,   0.770833,  0.500000,  -0.158786, -0.125000,
-      -1.206099, -0.1134,   -0.4954,   -0.8612,   0.770833,  0.416667,
-      -0.478354, 0.000000,  -1.154849, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.314855, 0.125000,  -1.175055, -0.2248,
-      0.4954,    -0.8391,   0.791667,  0.583333,  -0.323524, 0.000000,
-      -1.207407, -0.2588,   -0.0000,   -0.9659,   0.791667,  0.500000,
-      -0.465537, 0.125000,  -1.123905, -0.3324,   0.4954,    -0.8025,
-      0.812500,  0.583333,  -0.291171, 0.216506,  -1.086667, -0.1315,
-      0.8614,    -0.4907,   0.791667,  0.666667,  -0.314855, 0.125000,
-      -1.175055, -0.2248,   0.4954,    -0.8391,   0.791667,  0.583333,
-      -0.430519, 0.216506,  -1.039364, -0.1944,   0.8614,    -0.4693,
-      0.812500,  0.666667,  -0.258819, 0.250000,  -0.965926, -0.0028,
-      0.9999,    -0.0104,   0.791667,  0.750000,  -0.291171, 0.216506,
-      -1.086667, -0.1315,   0.8614,    -0.4907,   0.791667,  0.666667,
-      -0.258819, 0.250000,  -0.965926, -0.0028,   0.9999,    -0.0104,
-      0.791667,  0.750000,  -0.334848, 0.216506,  -0.808395, 0.1882,
-      0.8707,    0.4544,    0.812500,  0.833333,  -0.226467, 0.216506,
-      -0.845185, 0.1273,    0.8707,    0.4751,    0.791667,  0.833333,
-      -0.334848, 0.216506,  -0.808395, 0.1882,    0.8707,    0.4544,
-      0.812500,  0.833333,  -0.202783, 0.125000,  -0.756797, 0.2234,
-      0.5047,    0.8339,    0.791667,  0.916667,  -0.226467, 0.216506,
-      -0.845185, 0.1273,    0.8707,    0.4751,    0.791667,  0.833333,
-      -0.299830, 0.125000,  -0.723854, 0.3304,    0.5047,    0.7976,
-      0.812500,  0.916667,  -0.194114, 0.000000,  -0.724444, 0.2588,
-      -0.0000,   0.9659,    0.791667,  1.000000,  -0.202783, 0.125000,
-      -0.756797, 0.2234,    0.5047,    0.8339,    0.791667,  0.916667,
-      -0.287013, 0.000000,  -0.692910, 0.3827,    -0.0000,   0.9239,
-      0.812500,  0.000000,  -0.202783, -0.125000, -0.756797, 0.2234,
-      -0.5047,   0.8339,    0.791667,  0.083333,  -0.194114, 0.000000,
-      -0.724444, 0.2588,    -0.0000,   0.9659,    0.791667,  0.000000,
-      -0.299830, -0.125000, -0.723854, 0.3304,    -0.5047,   0.7976,
-      0.812500,  0.083333,  -0.226467, -0.216506, -0.845185, 0.1273,
-      -0.8707,   0.4751,    0.791667,  0.166667,  -0.202783, -0.125000,
-      -0.756797, 0.2234,    -0.5047,   0.8339,    0.791667,  0.083333,
-      -0.226467, -0.216506, -0.845185, 0.1273,    -0.8707,   0.4751,
-      0.791667,  0.166667,  -0.382684, -0.250000, -0.923880, -0.0041,
-      -0.9999,   -0.0100,   0.812500,  0.250000,  -0.258819, -0.250000,
-      -0.965926, -0.0028,   -0.9999,   -0.0104,   0.791667,  0.250000,
-      -0.382684, -0.250000, -0.923880, -0.0041,   -0.9999,   -0.0100,
-      0.812500,  0.250000,  -0.291171, -0.216506, -1.086667, -0.1315,
-      -0.8614,   -0.4907,   0.791667,  0.333333,  -0.258819, -0.250000,
-      -0.965926, -0.0028,   -0.9999,   -0.0104,   0.791667,  0.250000,
-      -0.291171, -0.216506, -1.086667, -0.1315,   -0.8614,   -0.4907,
-      0.791667,  0.333333,  -0.465537, -0.125000, -1.123905, -0.3324,
-      -0.4954,   -0.8025,   0.812500,  0.416667,  -0.314855, -0.125000,
-      -1.175055, -0.2248,   -0.4954,   -0.8391,   0.791667,  0.416667,
-      -0.465537, -0.125000, -1.123905, -0.3324,   -0.4954,   -0.8025,
-      0.812500,  0.416667,  -0.323524, 0.000000,  -1.207407, -0.2588,
-      -0.0000,   -0.9659,   0.791667,  0.500000,  -0.314855, -0.125000,
-      -1.175055, -0.2248,   -0.4954,   -0.8391,   0.791667,  0.416667,
-      -0.625000, 0.000000,  -1.082532, -0.5000,   -0.0000,   -0.8660,
-      0.833333,  0.500000,  -0.465537, 0.125000,  -1.123905, -0.3324,
-      0.4954,    -0.8025,   0.812500,  0.583333,  -0.478354, 0.000000,
-      -1.154849, -0.3827,   -0.0000,   -0.9239,   0.812500,  0.500000,
-      -0.465537, 0.125000,  -1.123905, -0.3324,   0.4954,    -0.8025,
-      0.812500,  0.583333,  -0.562500, 0.216506,  -0.974279, -0.2540,
-      0.8614,    -0.4399,   0.833333,  0.666667,  -0.430519, 0.216506,
-      -1.039364, -0.1944,   0.8614,    -0.4693,   0.812500,  0.666667,
-      -0.562500, 0.216506,  -0.974279, -0.2540,   0.8614,    -0.4399,
-      0.833333,  0.666667,  -0.382684, 0.250000,  -0.923880, -0.0041,
-      0.9999,    -0.0100,   0.812500,  0.750000,  -0.430519, 0.216506,
-      -1.039364, -0.1944,   0.8614,    -0.4693,   0.812500,  0.666667,
-      -0.500000, 0.250000,  -0.866026, -0.0054,   0.9999,    -0.0093,
-      0.833333,  0.750000,  -0.334848, 0.216506,  -0.808395, 0.1882,
-      0.8707,    0.4544,    0.812500,  0.833333,  -0.382684, 0.250000,
-      -0.923880, -0.0041,   0.9999,    -0.0100,   0.812500,  0.750000,
-      -0.437500, 0.216506,  -0.757772, 0.2459,    0.8707,    0.4259,
-      0.833333,  0.833333,  -0.299830, 0.125000,  -0.723854, 0.3304,
-      0.5047,    0.7976,    0.812500,  0.916667,  -0.334848, 0.216506,
-      -0.808395, 0.1882,    0.8707,    0.4544,    0.812500,  0.833333,
-      -0.391747, 0.125000,  -0.678525, 0.4316,    0.5047,    0.7476,
-      0.833333,  0.916667,  -0.287013, 0.000000,  -0.692910, 0.3827,
-      -0.0000,   0.9239,    0.812500,  1.000000,  -0.299830, 0.125000,
-      -0.723854, 0.3304,    0.5047,    0.7976,    0.812500,  0.916667,
-      -0.375000, 0.000000,  -0.649519, 0.5000,    -0.0000,   0.8660,
-      0.833333,  0.000000,  -0.299830, -0.125000, -0.723854, 0.3304,
-      -0.5047,   0.7976,    0.812500,  0.083333,  -0.287013, 0.000000,
-      -0.692910, 0.3827,    -0.0000,   0.9239,    0.812500,  0.000000,
-      -0.391747, -0.125000, -0.678525, 0.4316,    -0.5047,   0.7476,
-      0.833333,  0.083333,  -0.334848, -0.216506, -0.808395, 0.1882,
-      -0.8707,   0.4544,    0.812500,  0.166667,  -0.299830, -0.125000,
-      -0.723854, 0.3304,    -0.5047,   0.7976,    0.812500,  0.083333,
-      -0.437500, -0.216506, -0.757772, 0.2459,    -0.8707,   0.4259,
-      0.833333,  0.166667,  -0.382684, -0.250000, -0.923880, -0.0041,
-      -0.9999,   -0.0100,   0.812500,  0.250000,  -0.334848, -0.216506,
-      -0.808395, 0.1882,    -0.8707,   0.4544,    0.812500,  0.166667,
-      -0.500000, -0.250000, -0.866026, -0.0054,   -0.9999,   -0.0093,
-      0.833333,  0.250000,  -0.430519, -0.216506, -1.039364, -0.1944,
-      -0.8614,   -0.4693,   0.812500,  0.333333,  -0.382684, -0.250000,
-      -0.923880, -0.0041,   -0.9999,   -0.0100,   0.812500,  0.250000,
-      -0.562500, -0.216506, -0.974279, -0.2540,   -0.8614,   -0.4399,
-      0.833333,  0.333333,  -0.465537, -0.125000, -1.123905, -0.3324,
-      -0.4954,   -0.8025,   0.812500,  0.416667,  -0.430519, -0.216506,
-      -1.039364, -0.1944,   -0.8614,   -0.4693,   0.812500,  0.333333,
-      -0.608253, -0.125000, -1.053526, -0.4343,   -0.4954,   -0.7523,
-      0.833333,  0.416667,  -0.478354, 0.000000,  -1.154849, -0.3827,
-      -0.0000,   -0.9239,   0.812500,  0.500000,  -0.465537, -0.125000,
-      -1.123905, -0.3324,   -0.4954,   -0.8025,   0.812500,  0.416667,
-      -0.760952, 0.000000,  -0.991692, -0.6088,   -0.0000,   -0.7934,
-      0.854167,  0.500000,  -0.608253, 0.125000,  -1.053526, -0.4343,
-      0.4954,    -0.7523,   0.833333,  0.583333,  -0.625000, 0.000000,
-      -1.082532, -0.5000,   -0.0000,   -0.8660,   0.833333,  0.500000,
-      -0.740562, 0.125000,  -0.965119, -0.5288,   0.4954,    -0.6892,
-      0.854167,  0.583333,  -0.562500, 0.216506,  -0.974279, -0.2540,
-      0.8614,    -0.4399,   0.833333,  0.666667,  -0.608253, 0.125000,
-      -1.053526, -0.4343,   0.4954,    -0.7523,   0.833333,  0.583333,
-      -0.684857, 0.216506,  -0.892522, -0.3092,   0.8614,    -0.4030,
-      0.854167,  0.666667,  -0.500000, 0.250000,  -0.866026, -0.0054,
-      0.9999,    -0.0093,   0.833333,  0.750000,  -0.562500, 0.216506,
-      -0.974279, -0.2540,   0.8614,    -0.4399,   0.833333,  0.666667,
-      -0.608761, 0.250000,  -0.793353, -0.0066,   0.9999,    -0.0085,
-      0.854167,  0.750000,  -0.437500, 0.216506,  -0.757772, 0.2459,
-      0.8707,    0.4259,    0.833333,  0.833333,  -0.500000, 0.250000,
-      -0.866026, -0.0054,   0.9999,    -0.0093,   0.833333,  0.750000,
-      -0.532666, 0.216506,  -0.694184, 0.2994,    0.8707,    0.3902,
-      0.854167,  0.833333,  -0.391747, 0.125000,  -0.678525, 0.4316,
-      0.5047,    0.7476,    0.833333,  0.916667,  -0.437500, 0.216506,
-      -0.757772, 0.2459,    0.8707,    0.4259,    0.833333,  0.833333,
-      -0.391747, 0.125000,  -0.678525, 0.4316,    0.5047,    0.7476,
-      0.833333,  0.916667,  -0.456571, 0.000000,  -0.595015, 0.6088,
-      -0.0000,   0.7934,    0.854167,  1.000000,  -0.375000, 0.000000,
-      -0.649519, 0.5000,    -0.0000,   0.8660,    0.833333,  1.000000,
-      -0.456571, 0.000000,  -0.595015, 0.6088,    -0.0000,   0.7934,
-      0.854167,  0.000000,  -0.391747, -0.125000, -0.678525, 0.4316,
-      -0.5047,   0.7476,    0.833333,  0.083333,  -0.375000, 0.000000,
-      -0.649519, 0.5000,    -0.0000,   0.8660,    0.833333,  0.000000,
-      -0.391747, -0.125000, -0.678525, 0.4316,    -0.5047,   0.7476,
-      0.833333,  0.083333,  -0.532666, -0.216506, -0.694184, 0.2994,
-      -0.8707,   0.3902,    0.854167,  0.166667,  -0.437500, -0.216506,
-      -0.757772, 0.2459,    -0.8707,   0.4259,    0.833333,  0.166667,
-      -0.437500, -0.216506, -0.757772, 0.2459,    -0.8707,   0.4259,
-      0.833333,  0.166667,  -0.608761, -0.250000, -0.793353, -0.0066,
-      -0.9999,   -0.0085,   0.854167,  0.250000,  -0.500000, -0.250000,
-      -0.866026, -0.0054,   -0.9999,   -0.0093,   0.833333,  0.250000,
-      -0.500000, -0.250000, -0.866026, -0.0054,   -0.9999,   -0.0093,
-      0.833333,  0.250000,  -0.684857, -0.216506, -0.892522, -0.3092,
-      -0.8614,   -0.4030,   0.854167,  0.333333,  -0.562500, -0.216506,
-      -0.974279, -0.2540,   -0.8614,   -0.4399,   0.833333,  0.333333,
-      -0.562500, -0.216506, -0.974279, -0.2540,   -0.8614,   -0.4399,
-      0.833333,  0.333333,  -0.740562, -0.125000, -0.965119, -0.5288,
-      -0.4954,   -0.6892,   0.854167,  0.416667,  -0.608253, -0.125000,
-      -1.053526, -0.4343,   -0.4954,   -0.7523,   0.833333,  0.416667,
-      -0.740562, -0.125000, -0.965119, -0.5288,   -0.4954,   -0.6892,
-      0.854167,  0.416667,  -0.625000, 0.000000,  -1.082532, -0.5000,
-      -0.0000,   -0.8660,   0.833333,  0.500000,  -0.608253, -0.125000,
-      -1.053526, -0.4343,   -0.4954,   -0.7523,   0.833333,  0.416667,
-      -0.883884, 0.000000,  -0.883883, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.740562, 0.125000,  -0.965119, -0.5288,
-      0.4954,    -0.6892,   0.854167,  0.583333,  -0.760952, 0.000000,
-      -0.991692, -0.6088,   -0.0000,   -0.7934,   0.854167,  0.500000,
-      -0.860200, 0.125000,  -0.860200, -0.6142,   0.4954,    -0.6142,
-      0.875000,  0.583333,  -0.684857, 0.216506,  -0.892522, -0.3092,
-      0.8614,    -0.4030,   0.854167,  0.666667,  -0.740562, 0.125000,
-      -0.965119, -0.5288,   0.4954,    -0.6892,   0.854167,  0.583333,
-      -0.684857, 0.216506,  -0.892522, -0.3092,   0.8614,    -0.4030,
-      0.854167,  0.666667,  -0.707107, 0.250000,  -0.707107, -0.0076,
-      0.9999,    -0.0076,   0.875000,  0.750000,  -0.608761, 0.250000,
-      -0.793353, -0.0066,   0.9999,    -0.0085,   0.854167,  0.750000,
-      -0.707107, 0.250000,  -0.707107, -0.0076,   0.9999,    -0.0076,
-      0.875000,  0.750000,  -0.532666, 0.216506,  -0.694184, 0.2994,
-      0.8707,    0.3902,    0.854167,  0.833333,  -0.608761, 0.250000,
-      -0.793353, -0.0066,   0.9999,    -0.0085,   0.854167,  0.750000,
-      -0.618719, 0.216506,  -0.618718, 0.3478,    0.8707,    0.3478,
-      0.875000,  0.833333,  -0.476961, 0.125000,  -0.621587, 0.5255,
-      0.5047,    0.6849,    0.854167,  0.916667,  -0.532666, 0.216506,
-      -0.694184, 0.2994,    0.8707,    0.3902,    0.854167,  0.833333,
-      -0.554014, 0.125000,  -0.554013, 0.6104,    0.5047,    0.6104,
-      0.875000,  0.916667,  -0.456571, 0.000000,  -0.595015, 0.6088,
-      -0.0000,   0.7934,    0.854167,  1.000000,  -0.476961, 0.125000,
-      -0.621587, 0.5255,    0.5047,    0.6849,    0.854167,  0.916667,
-      -0.530330, 0.000000,  -0.530330, 0.7071,    -0.0000,   0.7071,
-      0.875000,  0.000000,  -0.476961, -0.125000, -0.621587, 0.5255,
-      -0.5047,   0.6849,    0.854167,  0.083333,  -0.456571, 0.000000,
-      -0.595015, 0.6088,    -0.0000,   0.7934,    0.854167,  0.000000,
-      -0.476961, -0.125000, -0.621587, 0.5255,    -0.5047,   0.6849,
-      0.854167,  0.083333,  -0.618719, -0.216506, -0.618718, 0.3478,
-      -0.8707,   0.3478,    0.875000,  0.166667,  -0.532666, -0.216506,
-      -0.694184, 0.2994,    -0.8707,   0.3902,    0.854167,  0.166667,
-      -0.618719, -0.216506, -0.618718, 0.3478,    -0.8707,   0.3478,
-      0.875000,  0.166667,  -0.608761, -0.250000, -0.793353, -0.0066,
-      -0.9999,   -0.0085,   0.854167,  0.250000,  -0.532666, -0.216506,
-      -0.694184, 0.2994,    -0.8707,   0.3902,    0.854167,  0.166667,
-      -0.707107, -0.250000, -0.707107, -0.0076,   -0.9999,   -0.0076,
-      0.875000,  0.250000,  -0.684857, -0.216506, -0.892522, -0.3092,
-      -0.8614,   -0.4030,   0.854167,  0.333333,  -0.608761, -0.250000,
-      -0.793353, -0.0066,   -0.9999,   -0.0085,   0.854167,  0.250000,
-      -0.795495, -0.216506, -0.795495, -0.3592,   -0.8614,   -0.3592,
-      0.875000,  0.333333,  -0.740562, -0.125000, -0.965119, -0.5288,
-      -0.4954,   -0.6892,   0.854167,  0.416667,  -0.684857, -0.216506,
-      -0.892522, -0.3092,   -0.8614,   -0.4030,   0.854167,  0.333333,
-      -0.860200, -0.125000, -0.860200, -0.6142,   -0.4954,   -0.6142,
-      0.875000,  0.416667,  -0.760952, 0.000000,  -0.991692, -0.6088,
-      -0.0000,   -0.7934,   0.854167,  0.500000,  -0.740562, -0.125000,
-      -0.965119, -0.5288,   -0.4954,   -0.6892,   0.854167,  0.416667,
-      -0.991692, 0.000000,  -0.760952, -0.7934,   -0.0000,   -0.6088,
-      0.895833,  0.500000,  -0.860200, 0.125000,  -0.860200, -0.6142,
-      0.4954,    -0.6142,   0.875000,  0.583333,  -0.883884, 0.000000,
-      -0.883883, -0.7071,   -0.0000,   -0.7071,   0.875000,  0.500000,
-      -0.965119, 0.125000,  -0.740562, -0.6892,   0.4954,    -0.5288,
-      0.895833,  0.583333,  -0.795495, 0.216506,  -0.795495, -0.3592,
-      0.8614,    -0.3592,   0.875000,  0.666667,  -0.860200, 0.125000,
-      -0.860200, -0.6142,   0.4954,    -0.6142,   0.875000,  0.583333,
-      -0.892522, 0.216506,  -0.684857, -0.4030,   0.8614,    -0.3092,
-      0.895833,  0.666667,  -0.707107, 0.250000,  -0.707107, -0.0076,
-      0.9999,    -0.0076,   0.875000,  0.750000,  -0.795495, 0.216506,
-      -0.795495, -0.3592,   0.8614,    -0.3592,   0.875000,  0.666667,
-      -0.707107, 0.250000,  -0.707107, -0.0076,   0.9999,    -0.0076,
-      0.875000,  0.750000,  -0.694184, 0.216506,  -0.532666, 0.3902,
-      0.8707,    0.2994,    0.895833,  0.833333,  -0.618719, 0.216506,
-      -0.618718, 0.3478,    0.8707,    0.3478,    0.875000,  0.833333,
-      -0.694184, 0.216506,  -0.532666, 0.3902,    0.8707,    0.2994,
-      0.895833,  0.833333,  -0.554014, 0.125000,  -0.554013, 0.6104,
-      0.5047,    0.6104,    0.875000,  0.916667,  -0.618719, 0.216506,
-      -0.618718, 0.3478,    0.8707,    0.3478,    0.875000,  0.833333,
-      -0.621587, 0.125000,  -0.476961, 0.6849,    0.5047,    0.5255,
-      0.895833,  0.916667,  -0.530330, 0.000000,  -0.530330, 0.7071,
-      -0.0000,   0.7071,    0.875000,  1.000000,  -0.554014, 0.125000,
-      -0.554013, 0.6104,    0.5047,    0.6104,    0.875000,  0.916667,
-      -0.595015, 0.000000,  -0.456571, 0.7934,    -0.0000,   0.6088,
-      0.895833,  0.000000,  -0.554014, -0.125000, -0.554013, 0.6104,
-      -0.5047,   0.6104,    0.875000,  0.083333,  -0.530330, 0.000000,
-      -0.530330, 0.7071,    -0.0000,   0.7071,    0.875000,  0.000000,
-      -0.554014, -0.125000, -0.554013, 0.6104,    -0.5047,   0.6104,
-      0.875000,  0.083333,  -0.694184, -0.216506, -0.532666, 0.3902,
-      -0.8707,   0.2994,    0.895833,  0.166667,  -0.618719, -0.216506,
-      -0.618718, 0.3478,    -0.8707,   0.3478,    0.875000,  0.166667,
-      -0.694184, -0.216506, -0.532666, 0.3902,    -0.8707,   0.2994,
-      0.895833,  0.166667,  -0.707107, -0.250000, -0.707107, -0.0076,
-      -0.9999,   -0.0076,   0.875000,  0.250000,  -0.618719, -0.216506,
-      -0.618718, 0.3478,    -0.8707,   0.3478,    0.875000,  0.166667,
-      -0.793353, -0.250000, -0.608761, -0.0086,   -0.9999,   -0.0066,
-      0.895833,  0.250000,  -0.795495, -0.216506, -0.795495, -0.3592,
-      -0.8614,   -0.3592,   0.875000,  0.333333,  -0.707107, -0.250000,
-      -0.707107, -0.0076,   -0.9999,   -0.0076,   0.875000,  0.250000,
-      -0.795495, -0.216506, -0.795495, -0.3592,   -0.8614,   -0.3592,
-      0.875000,  0.333333,  -0.965119, -0.125000, -0.740562, -0.6892,
-      -0.4954,   -0.5288,   0.895833,  0.416667,  -0.860200, -0.125000,
-      -0.860200, -0.6142,   -0.4954,   -0.6142,   0.875000,  0.416667,
-      -0.965119, -0.125000, -0.740562, -0.6892,   -0.4954,   -0.5288,
-      0.895833,  0.416667,  -0.883884, 0.000000,  -0.883883, -0.7071,
-      -0.0000,   -0.7071,   0.875000,  0.500000,  -0.860200, -0.125000,
-      -0.860200, -0.6142,   -0.4954,   -0.6142,   0.875000,  0.416667,
-      -0.991692, 0.000000,  -0.760952, -0.7934,   -0.0000,   -0.6088,
-      0.895833,  0.500000,  -1.053525, 0.125000,  -0.608253, -0.7523,
-      0.4954,    -0.4343,   0.916667,  0.583333,  -0.965119, 0.125000,
-      -0.740562, -0.6892,   0.4954,    -0.5288,   0.895833,  0.583333,
-      -1.053525, 0.125000,  -0.608253, -0.7523,   0.4954,    -0.4343,
-      0.916667,  0.583333,  -0.892522, 0.216506,  -0.684857, -0.4030,
-      0.8614,    -0.3092,   0.895833,  0.666667,  -0.965119, 0.125000,
-      -0.740562, -0.6892,   0.4954,    -0.5288,   0.895833,  0.583333,
-      -0.892522, 0.216506,  -0.684857, -0.4030,   0.8614,    -0.3092,
-      0.895833,  0.666667,  -0.866025, 0.250000,  -0.500000, -0.0093,
-      0.9999,    -0.0054,   0.916667,  0.750000,  -0.793353, 0.250000,
-      -0.608761, -0.0085,   0.9999,    -0.0066,   0.895833,  0.750000,
-      -0.866025, 0.250000,  -0.500000, -0.0093,   0.9999,    -0.0054,
-      0.916667,  0.750000,  -0.694184, 0.216506,  -0.532666, 0.3902,
-      0.8707,    0.2994,    0.895833,  0.833333,  -0.793353, 0.250000,
-      -0.608761, -0.0085,   0.9999,    -0.0066,   0.895833,  0.750000,
-      -0.757772, 0.216506,  -0.437500, 0.4259,    0.8707,    0.2459,
-      0.916667,  0.833333,  -0.621587, 0.125000,  -0.476961, 0.6849,
-      0.5047,    0.5255,    0.895833,  0.916667,  -0.694184, 0.216506,
-      -0.532666, 0.3902,    0.8707,    0.2994,    0.895833,  0.833333,
-      -0.678525, 0.125000,  -0.391747, 0.7476,    0.5047,    0.4316,
-      0.916667,  0.916667,  -0.595015, 0.000000,  -0.456571, 0.7934,
-      -0.0000,   0.6088,    0.895833,  1.000000,  -0.621587, 0.125000,
-      -0.476961, 0.6849,    0.5047,    0.5255,    0.895833,  0.916667,
-      -0.649519, 0.000000,  -0.375000, 0.8660,    -0.0000,   0.5000,
-      0.916667,  0.000000,  -0.621587, -0.125000, -0.476961, 0.6849,
-      -0.5047,   0.5255,    0.895833,  0.083333,  -0.595015, 0.000000,
-      -0.456571, 0.7934,    -0.0000,   0.6088,    0.895833,  0.000000,
-      -0.678525, -0.125000, -0.391747, 0.7476,    -0.5047,   0.4316,
-      0.916667,  0.083333,  -0.694184, -0.216506, -0.532666, 0.3902,
-      -0.8707,   0.2994,    0.895833,  0.166667,  -0.621587, -0.125000,
-      -0.476961, 0.6849,    -0.5047,   0.5255,    0.895833,  0.083333,
-      -0.694184, -0.216506, -0.532666, 0.3902,    -0.8707,   0.2994,
-      0.895833,  0.166667,  -0.866025, -0.250000, -0.500000, -0.0093,
-      -0.9999,   -0.0054,   0.916667,  0.250000,  -0.793353, -0.250000,
-      -0.608761, -0.0086,   -0.9999,   -0.0066,   0.895833,  0.250000,
-      -0.866025, -0.250000, -0.500000, -0.0093,   -0.9999,   -0.0054,
-      0.916667,  0.250000,  -0.892522, -0.216506, -0.684857, -0.4030,
-      -0.8614,   -0.3092,   0.895833,  0.333333,  -0.793353, -0.250000,
-      -0.608761, -0.0086,   -0.9999,   -0.0066,   0.895833,  0.250000,
-      -0.974278, -0.216506, -0.562500, -0.4399,   -0.8614,   -0.2540,
-      0.916667,  0.333333,  -0.965119, -0.125000, -0.740562, -0.6892,
-      -0.4954,   -0.5288,   0.895833,  0.416667,  -0.892522, -0.216506,
-      -0.684857, -0.4030,   -0.8614,   -0.3092,   0.895833,  0.333333,
-      -1.053525, -0.125000, -0.608253, -0.7523,   -0.4954,   -0.4343,
-      0.916667,  0.416667,  -0.991692, 0.000000,  -0.760952, -0.7934,
-      -0.0000,   -0.6088,   0.895833,  0.500000,  -0.965119, -0.125000,
-      -0.740562, -0.6892,   -0.4954,   -0.5288,   0.895833,  0.416667,
-      -1.154849, 0.000000,  -0.478354, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -1.053525, 0.125000,  -0.608253, -0.7523,
-      0.4954,    -0.4343,   0.916667,  0.583333,  -1.082532, 0.000000,
-      -0.625000, -0.8660,   -0.0000,   -0.5000,   0.916667,  0.500000,
-      -1.123905, 0.125000,  -0.465537, -0.8025,   0.4954,    -0.3324,
-      0.937500,  0.583333,  -0.974278, 0.216506,  -0.562500, -0.4399,
-      0.8614,    -0.2540,   0.916667,  0.666667,  -1.053525, 0.125000,
-      -0.608253, -0.7523,   0.4954,    -0.4343,   0.916667,  0.583333,
-      -1.039364, 0.216506,  -0.430519, -0.4693,   0.8614,    -0.1944,
-      0.937500,  0.666667,  -0.866025, 0.250000,  -0.500000, -0.0093,
-      0.9999,    -0.0054,   0.916667,  0.750000,  -0.974278, 0.216506,
-      -0.562500, -0.4399,   0.8614,    -0.2540,   0.916667,  0.666667,
-      -0.866025, 0.250000,  -0.500000, -0.0093,   0.9999,    -0.0054,
-      0.916667,  0.750000,  -0.808395, 0.216506,  -0.334848, 0.4544,
-      0.8707,    0.1882,    0.937500,  0.833333,  -0.757772, 0.216506,
-      -0.437500, 0.4259,    0.8707,    0.2459,    0.916667,  0.833333,
-      -0.808395, 0.216506,  -0.334848, 0.4544,    0.8707,    0.1882,
-      0.937500,  0.833333,  -0.678525, 0.125000,  -0.391747, 0.7476,
-      0.5047,    0.4316,    0.916667,  0.916667,  -0.757772, 0.216506,
-      -0.437500, 0.4259,    0.8707,    0.2459,    0.916667,  0.833333,
-      -0.723854, 0.125000,  -0.299830, 0.7976,    0.5047,    0.3304,
-      0.937500,  0.916667,  -0.649519, 0.000000,  -0.375000, 0.8660,
-      -0.0000,   0.5000,    0.916667,  1.000000,  -0.678525, 0.125000,
-      -0.391747, 0.7476,    0.5047,    0.4316,    0.916667,  0.916667,
-      -0.649519, 0.000000,  -0.375000, 0.8660,    -0.0000,   0.5000,
-      0.916667,  0.000000,  -0.723854, -0.125000, -0.299830, 0.7976,
-      -0.5047,   0.3304,    0.937500,  0.083333,  -0.678525, -0.125000,
-      -0.391747, 0.7476,    -0.5047,   0.4316,    0.916667,  0.083333,
-      -0.723854, -0.125000, -0.299830, 0.7976,    -0.5047,   0.3304,
-      0.937500,  0.083333,  -0.757772, -0.216506, -0.437500, 0.4259,
-      -0.8707,   0.2459,    0.916667,  0.166667,  -0.678525, -0.125000,
-      -0.391747, 0.7476,    -0.5047,   0.4316,    0.916667,  0.083333,
-      -0.808395, -0.216506, -0.334848, 0.4544,    -0.8707,   0.1882,
-      0.937500,  0.166667,  -0.866025, -0.250000, -0.500000, -0.0093,
-      -0.9999,   -0.0054,   0.916667,  0.250000,  -0.757772, -0.216506,
-      -0.437500, 0.4259,    -0.8707,   0.2459,    0.916667,  0.166667,
-      -0.923880, -0.250000, -0.382683, -0.0100,   -0.9999,   -0.0041,
-      0.937500,  0.250000,  -0.974278, -0.216506, -0.562500, -0.4399,
-      -0.8614,   -0.2540,   0.916667,  0.333333,  -0.866025, -0.250000,
-      -0.500000, -0.0093,   -0.9999,   -0.0054,   0.916667,  0.250000,
-      -0.974278, -0.216506, -0.562500, -0.4399,   -0.8614,   -0.2540,
-      0.916667,  0.333333,  -1.123905, -0.125000, -0.465537, -0.8025,
-      -0.4954,   -0.3324,   0.937500,  0.416667,  -1.053525, -0.125000,
-      -0.608253, -0.7523,   -0.4954,   -0.4343,   0.916667,  0.416667,
-      -1.123905, -0.125000, -0.465537, -0.8025,   -0.4954,   -0.3324,
-      0.937500,  0.416667,  -1.082532, 0.000000,  -0.625000, -0.8660,
-      -0.0000,   -0.5000,   0.916667,  0.500000,  -1.053525, -0.125000,
-      -0.608253, -0.7523,   -0.4954,   -0.4343,   0.916667,  0.416667,
-      -1.154849, 0.000000,  -0.478354, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -1.175055, 0.125000,  -0.314855, -0.8391,
-      0.4954,    -0.2248,   0.958333,  0.583333,  -1.123905, 0.125000,
-      -0.465537, -0.8025,   0.4954,    -0.3324,   0.937500,  0.583333,
-      -1.175055, 0.125000,  -0.314855, -0.8391,   0.4954,    -0.2248,
-      0.958333,  0.583333,  -1.039364, 0.216506,  -0.430519, -0.4693,
-      0.8614,    -0.1944,   0.937500,  0.666667,  -1.123905, 0.125000,
-      -0.465537, -0.8025,   0.4954,    -0.3324,   0.937500,  0.583333,
-      -1.086667, 0.216506,  -0.291171, -0.4907,   0.8614,    -0.1315,
-      0.958333,  0.666667,  -0.923880, 0.250000,  -0.382683, -0.0100,
-      0.9999,    -0.0041,   0.937500,  0.750000,  -1.039364, 0.216506,
-      -0.430519, -0.4693,   0.8614,    -0.1944,   0.937500,  0.666667,
-      -0.923880, 0.250000,  -0.382683, -0.0100,   0.9999,    -0.0041,
-      0.937500,  0.750000,  -0.845185, 0.216506,  -0.226467, 0.4751,
-      0.8707,    0.1273,    0.958333,  0.833333,  -0.808395, 0.216506,
-      -0.334848, 0.4544,    0.8707,    0.1882,    0.937500,  0.833333,
-      -0.845185, 0.216506,  -0.226467, 0.4751,    0.8707,    0.1273,
-      0.958333,  0.833333,  -0.723854, 0.125000,  -0.299830, 0.7976,
-      0.5047,    0.3304,    0.937500,  0.916667,  -0.808395, 0.216506,
-      -0.334848, 0.4544,    0.8707,    0.1882,    0.937500,  0.833333,
-      -0.756797, 0.125000,  -0.202783, 0.8339,    0.5047,    0.2234,
-      0.958333,  0.916667,  -0.692910, 0.000000,  -0.287013, 0.9239,
-      -0.0000,   0.3827,    0.937500,  1.000000,  -0.723854, 0.125000,
-      -0.299830, 0.7976,    0.5047,    0.3304,    0.937500,  0.916667,
-      -0.724444, 0.000000,  -0.194114, 0.9659,    -0.0000,   0.2588,
-      0.958333,  0.000000,  -0.723854, -0.125000, -0.299830, 0.7976,
-      -0.5047,   0.3304,    0.937500,  0.083333,  -0.692910, 0.000000,
-      -0.287013, 0.9239,    -0.0000,   0.3827,    0.937500,  0.000000,
-      -0.756797, -0.125000, -0.202783, 0.8339,    -0.5047,   0.2234,
-      0.958333,  0.083333,  -0.808395, -0.216506, -0.334848, 0.4544,
-      -0.8707,   0.1882,    0.937500,  0.166667,  -0.723854, -0.125000,
-      -0.299830, 0.7976,    -0.5047,   0.3304,    0.937500,  0.083333,
-      -0.845185, -0.216506, -0.226467, 0.4751,    -0.8707,   0.1273,
-      0.958333,  0.166667,  -0.923880, -0.250000, -0.382683, -0.0100,
-      -0.9999,   -0.0041,   0.937500,  0.250000,  -0.808395, -0.216506,
-      -0.334848, 0.4544,    -0.8707,   0.1882,    0.937500,  0.166667,
-      -0.923880, -0.250000, -0.382683, -0.0100,   -0.9999,   -0.0041,
-      0.937500,  0.250000,  -1.086667, -0.216506, -0.291171, -0.4907,
-      -0.8614,   -0.1315,   0.958333,  0.333333,  -1.039364, -0.216506,
-      -0.430519, -0.4693,   -0.8614,   -0.1944,   0.937500,  0.333333,
-      -1.086667, -0.216506, -0.291171, -0.4907,   -0.8614,   -0.1315,
-      0.958333,  0.333333,  -1.123905, -0.125000, -0.465537, -0.8025,
-      -0.4954,   -0.3324,   0.937500,  0.416667,  -1.039364, -0.216506,
-      -0.430519, -0.4693,   -0.8614,   -0.1944,   0.937500,  0.333333,
-      -1.175055, -0.125000, -0.314855, -0.8391,   -0.4954,   -0.2248,
-      0.958333,  0.416667,  -1.154849, 0.000000,  -0.478354, -0.9239,
-      -0.0000,   -0.3827,   0.937500,  0.500000,  -1.123905, -0.125000,
-      -0.465537, -0.8025,   -0.4954,   -0.3324,   0.937500,  0.416667,
-      -1.239306, 0.000000,  -0.163158, -0.9914,   -0.0000,   -0.1305,
-      0.979167,  0.500000,  -1.175055, 0.125000,  -0.314855, -0.8391,
-      0.4954,    -0.2248,   0.958333,  0.583333,  -1.207407, 0.000000,
-      -0.323524, -0.9659,   -0.0000,   -0.2588,   0.958333,  0.500000,
-      -1.206099, 0.125000,  -0.158786, -0.8612,   0.4954,    -0.1134,
-      0.979167,  0.583333,  -1.086667, 0.216506,  -0.291171, -0.4907,
-      0.8614,    -0.1315,   0.958333,  0.666667,  -1.175055, 0.125000,
-      -0.314855, -0.8391,   0.4954,    -0.2248,   0.958333,  0.583333,
-      -1.115375, 0.216506,  -0.146842, -0.5037,   0.8614,    -0.0663,
-      0.979167,  0.666667,  -0.965926, 0.250000,  -0.258819, -0.0104,
-      0.9999,    -0.0028,   0.958333,  0.750000,  -1.086667, 0.216506,
-      -0.291171, -0.4907,   0.8614,    -0.1315,   0.958333,  0.666667,
-      -0.991445, 0.250000,  -0.130526, -0.0107,   0.9999,    -0.0014,
-      0.979167,  0.750000,  -0.845185, 0.216506,  -0.226467, 0.4751,
-      0.8707,    0.1273,    0.958333,  0.833333,  -0.965926, 0.250000,
-      -0.258819, -0.0104,   0.9999,    -0.0028,   0.958333,  0.750000,
-      -0.867514, 0.216506,  -0.114211, 0.4876,    0.8707,    0.0642,
-      0.979167,  0.833333,  -0.756797, 0.125000,  -0.202783, 0.8339,
-      0.5047,    0.2234,    0.958333,  0.916667,  -0.845185, 0.216506,
-      -0.226467, 0.4751,    0.8707,    0.1273,    0.958333,  0.833333,
-      -0.776791, 0.125000,  -0.102267, 0.8559,    0.5047,    0.1127,
-      0.979167,  0.916667,  -0.724444, 0.000000,  -0.194114, 0.9659,
-      -0.0000,   0.2588,    0.958333,  1.000000,  -0.756797, 0.125000,
-      -0.202783, 0.8339,    0.5047,    0.2234,    0.958333,  0.916667,
-      -0.743584, 0.000000,  -0.097895, 0.9914,    -0.0000,   0.1305,
-      0.979167,  0.000000,  -0.756797, -0.125000, -0.202783, 0.8339,
-      -0.5047,   0.2234,    0.958333,  0.083333,  -0.724444, 0.000000,
-      -0.194114, 0.9659,    -0.0000,   0.2588,    0.958333,  0.000000,
-      -0.756797, -0.125000, -0.202783, 0.8339,    -0.5047,   0.2234,
-      0.958333,  0.083333,  -0.867514, -0.216506, -0.114211, 0.4876,
-      -0.8707,   0.0642,    0.979167,  0.166667,  -0.845185, -0.216506,
-      -0.226467, 0.4751,    -0.8707,   0.1273,    0.958333,  0.166667,
-      -0.845185, -0.216506, -0.226467, 0.4751,    -0.8707,   0.1273,
-      0.958333,  0.166667,  -0.991445, -0.250000, -0.130526, -0.0107,
-      -0.9999,   -0.0014,   0.979167,  0.250000,  -0.965926, -0.250000,
-      -0.258819, -0.0104,   -0.9999,   -0.0028,   0.958333,  0.250000,
-      -0.965926, -0.250000, -0.258819, -0.0104,   -0.9999,   -0.0028,
-      0.958333,  0.250000,  -1.115375, -0.216506, -0.146842, -0.5036,
-      -0.8614,   -0.0663,   0.979167,  0.333333,  -1.086667, -0.216506,
-      -0.291171, -0.4907,   -0.8614,   -0.1315,   0.958333,  0.333333,
-      -1.086667, -0.216506, -0.291171, -0.4907,   -0.8614,   -0.1315,
-      0.958333,  0.333333,  -1.206099, -0.125000, -0.158786, -0.8612,
-      -0.4954,   -0.1134,   0.979167,  0.416667,  -1.175055, -0.125000,
-      -0.314855, -0.8391,   -0.4954,   -0.2248,   0.958333,  0.416667,
-      -1.175055, -0.125000, -0.314855, -0.8391,   -0.4954,   -0.2248,
-      0.958333,  0.416667,  -1.239306, 0.000000,  -0.163158, -0.9914,
-      -0.0000,   -0.1305,   0.979167,  0.500000,  -1.207407, 0.000000,
-      -0.323524, -0.9659,   -0.0000,   -0.2588,   0.958333,  0.500000,
-      -1.239306, 0.000000,  -0.163158, -0.9914,   -0.0000,   -0.1305,
-      0.979167,  0.500000,  -1.216506, 0.125000,  -0.000000, -0.8687,
-      0.4954,    -0.0000,   1.000000,  0.583333,  -1.206099, 0.125000,
-      -0.158786, -0.8612,   0.4954,    -0.1134,   0.979167,  0.583333,
-      -1.216506, 0.125000,  -0.000000, -0.8687,   0.4954,    -0.0000,
-      1.000000,  0.583333,  -1.115375, 0.216506,  -0.146842, -0.5037,
-      0.8614,    -0.0663,   0.979167,  0.666667,  -1.206099, 0.125000,
-      -0.158786, -0.8612,   0.4954,    -0.1134,   0.979167,  0.583333,
-      -1.125000, 0.216506,  -0.000000, -0.5080,   0.8614,    -0.0000,
-      1.000000,  0.666667,  -0.991445, 0.250000,  -0.130526, -0.0107,
-      0.9999,    -0.0014,   0.979167,  0.750000,  -1.115375, 0.216506,
-      -0.146842, -0.5037,   0.8614,    -0.0663,   0.979167,  0.666667,
-      -1.000000, 0.250000,  -0.000000, -0.0108,   0.9999,    -0.0000,
-      1.000000,  0.750000,  -0.867514, 0.216506,  -0.114211, 0.4876,
-      0.8707,    0.0642,    0.979167,  0.833333,  -0.991445, 0.250000,
-      -0.130526, -0.0107,   0.9999,    -0.0014,   0.979167,  0.750000,
-      -0.875000, 0.216506,  -0.000000, 0.4918,    0.8707,    -0.0000,
-      1.000000,  0.833333,  -0.776791, 0.125000,  -0.102267, 0.8559,
-      0.5047,    0.1127,    0.979167,  0.916667,  -0.867514, 0.216506,
-      -0.114211, 0.4876,    0.8707,    0.0642,    0.979167,  0.833333,
-      -0.783494, 0.125000,  -0.000000, 0.8633,    0.5047,    -0.0000,
-      1.000000,  0.916667,  -0.743584, 0.000000,  -0.097895, 0.9914,
-      -0.0000,   0.1305,    0.979167,  1.000000,  -0.776791, 0.125000,
-      -0.102267, 0.8559,    0.5047,    0.1127,    0.979167,  0.916667,
-      -0.750000, 0.000000,  -0.000000, 1.0000,    -0.0000,   -0.0000,
-      1.000000,  0.000000,  -0.776791, -0.125000, -0.102267, 0.8559,
-      -0.5047,   0.1127,    0.979167,  0.083333,  -0.743584, 0.000000,
-      -0.097895, 0.9914,    -0.0000,   0.1305,    0.979167,  0.000000,
-      -0.776791, -0.125000, -0.102267, 0.8559,    -0.5047,   0.1127,
-      0.979167,  0.083333,  -0.875000, -0.216506, -0.000000, 0.4918,
-      -0.8707,   -0.0000,   1.000000,  0.166667,  -0.867514, -0.216506,
-      -0.114211, 0.4876,    -0.8707,   0.0642,    0.979167,  0.166667,
-      -0.875000, -0.216506, -0.000000, 0.4918,    -0.8707,   -0.0000,
-      1.000000,  0.166667,  -0.991445, -0.250000, -0.130526, -0.0107,
-      -0.9999,   -0.0014,   0.979167,  0.250000,  -0.867514, -0.216506,
-      -0.114211, 0.4876,    -0.8707,   0.0642,    0.979167,  0.166667,
-      -1.000000, -0.250000, -0.000000, -0.0108,   -0.9999,   -0.0000,
-      1.000000,  0.250000,  -1.115375, -0.216506, -0.146842, -0.5036,
-      -0.8614,   -0.0663,   0.979167,  0.333333,  -0.991445, -0.250000,
-      -0.130526, -0.0107,   -0.9999,   -0.0014,   0.979167,  0.250000,
-      -1.125000, -0.216506, -0.000000, -0.5080,   -0.8614,   -0.0000,
-      1.000000,  0.333333,  -1.206099, -0.125000, -0.158786, -0.8612,
-      -0.4954,   -0.1134,   0.979167,  0.416667,  -1.115375, -0.216506,
-      -0.146842, -0.5036,   -0.8614,   -0.0663,   0.979167,  0.333333,
-      -1.216506, -0.125000, -0.000000, -0.8687,   -0.4954,   -0.0000,
-      1.000000,  0.416667,  -1.239306, 0.000000,  -0.163158, -0.9914,
-      -0.0000,   -0.1305,   0.979167,  0.500000,  -1.206099, -0.125000,
-      -0.158786, -0.8612,   -0.4954,   -0.1134,   0.979167,  0.416667,
-      -1.239306, 0.000000,  0.163158,  -0.9914,   -0.0000,   0.1305,
-      0.020833,  0.500000,  -1.216506, 0.125000,  -0.000000, -0.8687,
-      0.4954,    -0.0000,   0.000000,  0.583333,  -1.250000, 0.000000,
-      -0.000000, -1.0000,   -0.0000,   -0.0000,   0.000000,  0.500000,
-      -1.206099, 0.125000,  0.158786,  -0.8612,   0.4954,    0.1134,
-      0.020833,  0.583333,  -1.125000, 0.216506,  -0.000000, -0.5080,
-      0.8614,    -0.0000,   0.000000,  0.666667,  -1.216506, 0.125000,
-      -0.000000, -0.8687,   0.4954,    -0.0000,   0.000000,  0.583333,
-      -1.115375, 0.216506,  0.146842,  -0.5036,   0.8614,    0.0663,
-      0.020833,  0.666667,  -1.000000, 0.250000,  -0.000000, -0.0108,
-      0.9999,    -0.0000,   0.000000,  0.750000,  -1.125000, 0.216506,
-      -0.000000, -0.5080,   0.8614,    -0.0000,   0.000000,  0.666667,
-      -0.991445, 0.250000,  0.130526,  -0.0107,   0.9999,    0.0014,
-      0.020833,  0.750000,  -0.875000, 0.216506,  -0.000000, 0.4918,
-      0.8707,    -0.0000,   0.000000,  0.833333,  -1.000000, 0.250000,
-      -0.000000, -0.0108,   0.9999,    -0.0000,   0.000000,  0.750000,
-      -0.867514, 0.216506,  0.114211,  0.4876,    0.8707,    -0.0642,
-      0.020833,  0.833333,  -0.783494, 0.125000,  -0.000000, 0.8633,
-      0.5047,    -0.0000,   0.000000,  0.916667,  -0.875000, 0.216506,
-      -0.000000, 0.4918,    0.8707,    -0.0000,   0.000000,  0.833333,
-      -0.776791, 0.125000,  0.102267,  0.8559,    0.5047,    -0.1127,
-      0.020833,  0.916667,  -0.750000, 0.000000,  -0.000000, 1.0000,
-      -0.0000,   -0.0000,   0.000000,  1.000000,  -0.783494, 0.125000,
-      -0.000000, 0.8633,    0.5047,    -0.0000,   0.000000,  0.916667,
-      -0.750000, 0.000000,  -0.000000, 1.0000,    -0.0000,   -0.0000,
-      0.000000,  0.000000,  -0.776791, -0.125000, 0.102267,  0.8559,
-      -0.5047,   -0.1127,   0.020833,  0.083333,  -0.783494, -0.125000,
-      -0.000000, 0.8633,    -0.5047,   -0.0000,   0.000000,  0.083333,
-      -0.776791, -0.125000, 0.102267,  0.8559,    -0.5047,   -0.1127,
-      0.020833,  0.083333,  -0.875000, -0.216506, -0.000000, 0.4918,
-      -0.8707,   -0.0000,   0.000000,  0.166667,  -0.783494, -0.125000,
-      -0.000000, 0.8633,    -0.5047,   -0.0000,   0.000000,  0.083333,
-      -0.875000, -0.216506, -0.000000, 0.4918,    -0.8707,   -0.0000,
-      0.000000,  0.166667,  -0.991445, -0.250000, 0.130526,  -0.0107,
-      -0.9999,   0.0014,    0.020833,  0.250000,  -1.000000, -0.250000,
-      -0.000000, -0.0108,   -0.9999,   -0.0000,   0.000000,  0.250000,
-      -1.000000, -0.250000, -0.000000, -0.0108,   -0.9999,   -0.0000,
-      0.000000,  0.250000,  -1.115375, -0.216506, 0.146842,  -0.5036,
-      -0.8614,   0.0663,    0.020833,  0.333333,  -1.125000, -0.216506,
-      -0.000000, -0.5080,   -0.8614,   -0.0000,   0.000000,  0.333333,
-      -1.125000, -0.216506, -0.000000, -0.5080,   -0.8614,   -0.0000,
-      0.000000,  0.333333,  -1.206099, -0.125000, 0.158786,  -0.8612,
-      -0.4954,   0.1134,    0.020833,  0.416667,  -1.216506, -0.125000,
-      -0.000000, -0.8687,   -0.4954,   -0.0000,   0.000000,  0.416667,
-      -1.216506, -0.125000, -0.000000, -0.8687,   -0.4954,   -0.0000,
-      0.000000,  0.416667,  -1.239306, 0.000000,  0.163158,  -0.9914,
-      -0.0000,   0.1305,    0.020833,  0.500000,  -1.250000, 0.000000,
-      -0.000000, -1.0000,   -0.0000,   -0.0000,   0.000000,  0.500000,
-      -1.239306, 0.000000,  0.163158,  -0.9914,   -0.0000,   0.1305,
-      0.020833,  0.500000,  -1.175055, 0.125000,  0.314855,  -0.8391,
-      0.4954,    0.2248,    0.041667,  0.583333,  -1.206099, 0.125000,
-      0.158786,  -0.8612,   0.4954,    0.1134,    0.020833,  0.583333,
-      -1.206099, 0.125000,  0.158786,  -0.8612,   0.4954,    0.1134,
-      0.020833,  0.583333,  -1.086667, 0.216506,  0.291171,  -0.4907,
-      0.8614,    0.1315,    0.041667,  0.666667,  -1.115375, 0.216506,
-      0.146842,  -0.5036,   0.8614,    0.0663,    0.020833,  0.666667,
-      -1.115375, 0.216506,  0.146842,  -0.5036,   0.8614,    0.0663,
-      0.020833,  0.666667,  -0.965926, 0.250000,  0.258819,  -0.0104,
-      0.9999,    0.0028,    0.041667,  0.750000,  -0.991445, 0.250000,
-      0.130526,  -0.0107,   0.9999,    0.0014,    0.020833,  0.750000,
-      -0.991445, 0.250000,  0.130526,  -0.0107,   0.9999,    0.0014,
-      0.020833,  0.750000,  -0.845185, 0.216506,  0.226467,  0.4751,
-      0.8707,    -0.1273,   0.041667,  0.833333,  -0.867514, 0.216506,
-      0.114211,  0.4876,    0.8707,    -0.0642,   0.020833,  0.833333,
-      -0.867514, 0.216506,  0.114211,  0.4876,    0.8707,    -0.0642,
-      0.020833,  0.833333,  -0.756797, 0.125000,  0.202783,  0.8339,
-      0.5047,    -0.2234,   0.041667,  0.916667,  -0.776791, 0.125000,
-      0.102267,  0.8559,    0.5047,    -0.1127,   0.020833,  0.916667,
-      -0.756797, 0.125000,  0.202783,  0.8339,    0.5047,    -0.2234,
-      0.041667,  0.916667,  -0.743584, 0.000000,  0.097895,  0.9914,
-      -0.0000,   -0.1305,   0.020833,  1.000000,  -0.776791, 0.125000,
-      0.102267,  0.8559,    0.5047,    -0.1127,   0.020833,  0.916667,
-      -0.724444, 0.000000,  0.194114,  0.9659,    -0.0000,   -0.2588,
-      0.041667,  0.000000,  -0.776791, -0.125000, 0.102267,  0.8559,
-      -0.5047,   -0.1127,   0.020833,  0.083333,  -0.743584, 0.000000,
-      0.097895,  0.9914,    -0.0000,   -0.1305,   0.020833,  0.000000,
-      -0.756797, -0.125000, 0.202783,  0.8339,    -0.5047,   -0.2234,
-      0.041667,  0.083333,  -0.867514, -0.216506, 0.114211,  0.4876,
-      -0.8707,   -0.0642,   0.020833,  0.166667,  -0.776791, -0.125000,
-      0.102267,  0.8559,    -0.5047,   -0.1127,   0.020833,  0.083333,
-      -0.845185, -0.216506, 0.226467,  0.4751,    -0.8707,   -0.1273,
-      0.041667,  0.166667,  -0.991445, -0.250000, 0.130526,  -0.0107,
-      -0.9999,   0.0014,    0.020833,  0.250000,  -0.867514, -0.216506,
-      0.114211,  0.4876,    -0.8707,   -0.0642,   0.020833,  0.166667,
-      -0.965926, -0.250000, 0.258819,  -0.0104,   -0.9999,   0.0028,
-      0.041667,  0.250000,  -1.115375, -0.216506, 0.146842,  -0.5036,
-      -0.8614,   0.0663,    0.020833,  0.333333,  -0.991445, -0.250000,
-      0.130526,  -0.0107,   -0.9999,   0.0014,    0.020833,  0.250000,
-      -1.086667, -0.216506, 0.291171,  -0.4907,   -0.8614,   0.1315,
-      0.041667,  0.333333,  -1.206099, -0.125000, 0.158786,  -0.8612,
-      -0.4954,   0.1134,    0.020833,  0.416667,  -1.115375, -0.216506,
-      0.146842,  -0.5036,   -0.8614,   0.0663,    0.020833,  0.333333,
-      -1.206099, -0.125000, 0.158786,  -0.8612,   -0.4954,   0.1134,
-      0.020833,  0.416667,  -1.207407, 0.000000,  0.323524,  -0.9659,
-      -0.0000,   0.2588,    0.041667,  0.500000,  -1.239306, 0.000000,
-      0.163158,  -0.9914,   -0.0000,   0.1305,    0.020833,  0.500000,
-      -1.154850, 0.000000,  0.478354,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -1.175055, 0.125000,  0.314855,  -0.8391,
-      0.4954,    0.2248,    0.041667,  0.583333,  -1.207407, 0.000000,
-      0.323524,  -0.9659,   -0.0000,   0.2588,    0.041667,  0.500000,
-      -1.123906, 0.125000,  0.465536,  -0.8025,   0.4954,    0.3324,
-      0.062500,  0.583333,  -1.086667, 0.216506,  0.291171,  -0.4907,
-      0.8614,    0.1315,    0.041667,  0.666667,  -1.175055, 0.125000,
-      0.314855,  -0.8391,   0.4954,    0.2248,    0.041667,  0.583333,
-      -1.086667, 0.216506,  0.291171,  -0.4907,   0.8614,    0.1315,
-      0.041667,  0.666667,  -0.923880, 0.250000,  0.382683,  -0.0100,
-      0.9999,    0.0041,    0.062500,  0.750000,  -0.965926, 0.250000,
-      0.258819,  -0.0104,   0.9999,    0.0028,    0.041667,  0.750000,
-      -0.923880, 0.250000,  0.382683,  -0.0100,   0.9999,    0.0041,
-      0.062500,  0.750000,  -0.845185, 0.216506,  0.226467,  0.4751,
-      0.8707,    -0.1273,   0.041667,  0.833333,  -0.965926, 0.250000,
-      0.258819,  -0.0104,   0.9999,    0.0028,    0.041667,  0.750000,
-      -0.808395, 0.216506,  0.334848,  0.4544,    0.8707,    -0.1882,
-      0.062500,  0.833333,  -0.756797, 0.125000,  0.202783,  0.8339,
-      0.5047,    -0.2234,   0.041667,  0.916667,  -0.845185, 0.216506,
-      0.226467,  0.4751,    0.8707,    -0.1273,   0.041667,  0.833333,
-      -0.723854, 0.125000,  0.299830,  0.7976,    0.5047,    -0.3304,
-      0.062500,  0.916667,  -0.724444, 0.000000,  0.194114,  0.9659,
-      -0.0000,   -0.2588,   0.041667,  1.000000,  -0.756797, 0.125000,
-      0.202783,  0.8339,    0.5047,    -0.2234,   0.041667,  0.916667,
-      -0.692910, 0.000000,  0.287012,  0.9239,    -0.0000,   -0.3827,
-      0.062500,  0.000000,  -0.756797, -0.125000, 0.202783,  0.8339,
-      -0.5047,   -0.2234,   0.041667,  0.083333,  -0.724444, 0.000000,
-      0.194114,  0.9659,    -0.0000,   -0.2588,   0.041667,  0.000000,
-      -0.756797, -0.125000, 0.202783,  0.8339,    -0.5047,   -0.2234,
-      0.041667,  0.083333,  -0.808395, -0.216506, 0.334848,  0.4544,
-      -0.8707,   -0.1882,   0.062500,  0.166667,  -0.845185, -0.216506,
-      0.226467,  0.4751,    -0.8707,   -0.1273,   0.041667,  0.166667,
-      -0.808395, -0.216506, 0.334848,  0.4544,    -0.8707,   -0.1882,
-      0.062500,  0.166667,  -0.965926, -0.250000, 0.258819,  -0.0104,
-      -0.9999,   0.0028,    0.041667,  0.250000,  -0.845185, -0.216506,
-      0.226467,  0.4751,    -0.8707,   -0.1273,   0.041667,  0.166667,
-      -0.923880, -0.250000, 0.382683,  -0.0100,   -0.9999,   0.0041,
-      0.062500,  0.250000,  -1.086667, -0.216506, 0.291171,  -0.4907,
-      -0.8614,   0.1315,    0.041667,  0.333333,  -0.965926, -0.250000,
-      0.258819,  -0.0104,   -0.9999,   0.0028,    0.041667,  0.250000,
-      -1.086667, -0.216506, 0.291171,  -0.4907,   -0.8614,   0.1315,
-      0.041667,  0.333333,  -1.123906, -0.125000, 0.465536,  -0.8025,
-      -0.4954,   0.3324,    0.062500,  0.416667,  -1.175055, -0.125000,
-      0.314855,  -0.8391,   -0.4954,   0.2248,    0.041667,  0.416667,
-      -1.175055, -0.125000, 0.314855,  -0.8391,   -0.4954,   0.2248,
-      0.041667,  0.416667,  -1.154850, 0.000000,  0.478354,  -0.9239,
-      -0.0000,   0.3827,    0.062500,  0.500000,  -1.207407, 0.000000,
-      0.323524,  -0.9659,   -0.0000,   0.2588,    0.041667,  0.500000,
-      -1.082532, 0.000000,  0.625000,  -0.8660,   -0.0000,   0.5000,
-      0.083333,  0.500000,  -1.123906, 0.125000,  0.465536,  -0.8025,
-      0.4954,    0.3324,    0.062500,  0.583333,  -1.154850, 0.000000,
-      0.478354,  -0.9239,   -0.0000,   0.3827,    0.062500,  0.500000,
-      -1.053526, 0.125000,  0.608253,  -0.7523,   0.4954,    0.4343,
-      0.083333,  0.583333,  -1.039365, 0.216506,  0.430518,  -0.4693,
-      0.8614,    0.1944,    0.062500,  0.666667,  -1.123906, 0.125000,
-      0.465536,  -0.8025,   0.4954,    0.3324,    0.062500,  0.583333,
-      -0.974279, 0.216506,  0.562500,  -0.4399,   0.8614,    0.2540,
-      0.083333,  0.666667,  -0.923880, 0.250000,  0.382683,  -0.0100,
-      0.9999,    0.0041,    0.062500,  0.750000,  -1.039365, 0.216506,
-      0.430518,  -0.4693,   0.8614,    0.1944,    0.062500,  0.666667,
-      -0.866026, 0.250000,  0.500000,  -0.0093,   0.9999,    0.0054,
-      0.083333,  0.750000,  -0.808395, 0.216506,  0.334848,  0.4544,
-      0.8707,    -0.1882,   0.062500,  0.833333,  -0.923880, 0.250000,
-      0.382683,  -0.0100,   0.9999,    0.0041,    0.062500,  0.750000,
-      -0.757772, 0.216506,  0.437500,  0.4259,    0.8707,    -0.2459,
-      0.083333,  0.833333,  -0.723854, 0.125000,  0.299830,  0.7976,
-      0.5047,    -0.3304,   0.062500,  0.916667,  -0.808395, 0.216506,
-      0.334848,  0.4544,    0.8707,    -0.1882,   0.062500,  0.833333,
-      -0.723854, 0.125000,  0.299830,  0.7976,    0.5047,    -0.3304,
-      0.062500,  0.916667,  -0.649519, 0.000000,  0.375000,  0.8660,
-      -0.0000,   -0.5000,   0.083333,  1.000000,  -0.692910, 0.000000,
-      0.287012,  0.9239,    -0.0000,   -0.3827,   0.062500,  1.000000,
-      -0.649519, 0.000000,  0.375000,  0.8660,    -0.0000,   -0.5000,
-      0.083333,  0.000000,  -0.723854, -0.125000, 0.299830,  0.7976,
-      -0.5047,   -0.3304,   0.062500,  0.083333,  -0.692910, 0.000000,
-      0.287012,  0.9239,    -0.0000,   -0.3827,   0.062500,  0.000000,
-      -0.678525, -0.125000, 0.391747,  0.7476,    -0.5047,   -0.4316,
-      0.083333,  0.083333,  -0.808395, -0.216506, 0.334848,  0.4544,
-      -0.8707,   -0.1882,   0.062500,  0.166667,  -0.723854, -0.125000,
-      0.299830,  0.7976,    -0.5047,   -0.3304,   0.062500,  0.083333,
-      -0.757772, -0.216506, 0.437500,  0.4259,    -0.8707,   -0.2459,
-      0.083333,  0.166667,  -0.923880, -0.250000, 0.382683,  -0.0100,
-      -0.9999,   0.0041,    0.062500,  0.250000,  -0.808395, -0.216506,
-      0.334848,  0.4544,    -0.8707,   -0.1882,   0.062500,  0.166667,
-      -0.923880, -0.250000, 0.382683,  -0.0100,   -0.9999,   0.0041,
-      0.062500,  0.250000,  -0.974279, -0.216506, 0.562500,  -0.4399,
-      -0.8614,   0.2540,    0.083333,  0.333333,  -1.039365, -0.216506,
-      0.430518,  -0.4693,   -0.8614,   0.1944,    0.062500,  0.333333,
-      -1.039365, -0.216506, 0.430518,  -0.4693,   -0.8614,   0.1944,
-      0.062500,  0.333333,  -1.053526, -0.125000, 0.608253,  -0.7523,
-      -0.4954,   0.4343,    0.083333,  0.416667,  -1.123906, -0.125000,
-      0.465536,  -0.8025,   -0.4954,   0.3324,    0.062500,  0.416667,
-      -1.053526, -0.125000, 0.608253,  -0.7523,   -0.4954,   0.4343,
-      0.083333,  0.416667,  -1.154850, 0.000000,  0.478354,  -0.9239,
-      -0.0000,   0.3827,    0.062500,  0.500000,  -1.123906, -0.125000,
-      0.465536,  -0.8025,   -0.4954,   0.3324,    0.062500,  0.416667,
-      -0.991692, 0.000000,  0.760952,  -0.7934,   -0.0000,   0.6088,
-      0.104167,  0.500000,  -1.053526, 0.125000,  0.608253,  -0.7523,
-      0.4954,    0.4343,    0.083333,  0.583333,  -1.082532, 0.000000,
-      0.625000,  -0.8660,   -0.0000,   0.5000,    0.083333,  0.500000,
-      -0.965119, 0.125000,  0.740562,  -0.6892,   0.4954,    0.5288,
-      0.104167,  0.583333,  -0.974279, 0.216506,  0.562500,  -0.4399,
-      0.8614,    0.2540,    0.083333,  0.666667,  -1.053526, 0.125000,
-      0.608253,  -0.7523,   0.4954,    0.4343,    0.083333,  0.583333,
-      -0.892522, 0.216506,  0.684857,  -0.4030,   0.8614,    0.3092,
-      0.104167,  0.666667,  -0.866026, 0.250000,  0.500000,  -0.0093,
-      0.9999,    0.0054,    0.083333,  0.750000,  -0.974279, 0.216506,
-      0.562500,  -0.4399,   0.8614,    0.2540,    0.083333,  0.666667,
-      -0.866026, 0.250000,  0.500000,  -0.0093,   0.9999,    0.0054,
-      0.083333,  0.750000,  -0.694184, 0.216506,  0.532666,  0.3902,
-      0.8707,    -0.2994,   0.104167,  0.833333,  -0.757772, 0.216506,
-      0.437500,  0.4259,    0.8707,    -0.2459,   0.083333,  0.833333,
-      -0.694184, 0.216506,  0.532666,  0.3902,    0.8707,    -0.2994,
-      0.104167,  0.833333,  -0.678525, 0.125000,  0.391747,  0.7476,
-      0.5047,    -0.4316,   0.083333,  0.916667,  -0.757772, 0.216506,
-      0.437500,  0.4259,    0.8707,    -0.2459,   0.083333,  0.833333,
-      -0.621587, 0.125000,  0.476961,  0.6849,    0.5047,    -0.5255,
-      0.104167,  0.916667,  -0.649519, 0.000000,  0.375000,  0.8660,
-      -0.0000,   -0.5000,   0.083333,  1.000000,  -0.678525, 0.125000,
-      0.391747,  0.7476,    0.5047,    -0.4316,   0.083333,  0.916667,
-      -0.595015, 0.000000,  0.456571,  0.7934,    -0.0000,   -0.6088,
-      0.104167,  0.000000,  -0.678525, -0.125000, 0.391747,  0.7476,
-      -0.5047,   -0.4316,   0.083333,  0.083333,  -0.649519, 0.000000,
-      0.375000,  0.8660,    -0.0000,   -0.5000,   0.083333,  0.000000,
-      -0.678525, -0.125000, 0.391747,  0.7476,    -0.5047,   -0.4316,
-      0.083333,  0.083333,  -0.694184, -0.216506, 0.532666,  0.3902,
-      -0.8707,   -0.2994,   0.104167,  0.166667,  -0.757772, -0.216506,
-      0.437500,  0.4259,    -0.8707,   -0.2459,   0.083333,  0.166667,
-      -0.694184, -0.216506, 0.532666,  0.3902,    -0.8707,   -0.2994,
-      0.104167,  0.166667,  -0.866026, -0.250000, 0.500000,  -0.0093,
-      -0.9999,   0.0054,    0.083333,  0.250000,  -0.757772, -0.216506,
-      0.437500,  0.4259,    -0.8707,   -0.2459,   0.083333,  0.166667,
-      -0.793353, -0.250000, 0.608761,  -0.0086,   -0.9999,   0.0066,
-      0.104167,  0.250000,  -0.974279, -0.216506, 0.562500,  -0.4399,
-      -0.8614,   0.2540,    0.083333,  0.333333,  -0.866026, -0.250000,
-      0.500000,  -0.0093,   -0.9999,   0.0054,    0.083333,  0.250000,
-      -0.974279, -0.216506, 0.562500,  -0.4399,   -0.8614,   0.2540,
-      0.083333,  0.333333,  -0.965119, -0.125000, 0.740562,  -0.6892,
-      -0.4954,   0.5288,    0.104167,  0.416667,  -1.053526, -0.125000,
-      0.608253,  -0.7523,   -0.4954,   0.4343,    0.083333,  0.416667,
-      -0.965119, -0.125000, 0.740562,  -0.6892,   -0.4954,   0.5288,
-      0.104167,  0.416667,  -1.082532, 0.000000,  0.625000,  -0.8660,
-      -0.0000,   0.5000,    0.083333,  0.500000,  -1.053526, -0.125000,
-      0.608253,  -0.7523,   -0.4954,   0.4343,    0.083333,  0.416667,
-      -0.883884, 0.000000,  0.883883,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.965119, 0.125000,  0.740562,  -0.6892,
-      0.4954,    0.5288,    0.104167,  0.583333,  -0.991692, 0.000000,
-      0.760952,  -0.7934,   -0.0000,   0.6088,    0.104167,  0.500000,
-      -0.965119, 0.125000,  0.740562,  -0.6892,   0.4954,    0.5288,
-      0.104167,  0.583333,  -0.795495, 0.216506,  0.795495,  -0.3592,
-      0.8614,    0.3592,    0.125000,  0.666667,  -0.892522, 0.216506,
-      0.684857,  -0.4030,   0.8614,    0.3092,    0.104167,  0.666667,
-      -0.795495, 0.216506,  0.795495,  -0.3592,   0.8614,    0.3592,
-      0.125000,  0.666667,  -0.793353, 0.250000,  0.608761,  -0.0086,
-      0.9999,    0.0066,    0.104167,  0.750000,  -0.892522, 0.216506,
-      0.684857,  -0.4030,   0.8614,    0.3092,    0.104167,  0.666667,
-      -0.707107, 0.250000,  0.707107,  -0.0076,   0.9999,    0.0076,
-      0.125000,  0.750000,  -0.694184, 0.216506,  0.532666,  0.3902,
-      0.8707,    -0.2994,   0.104167,  0.833333,  -0.793353, 0.250000,
-      0.608761,  -0.0086,   0.9999,    0.0066,    0.104167,  0.750000,
-      -0.618719, 0.216506,  0.618718,  0.3478,    0.8707,    -0.3478,
-      0.125000,  0.833333,  -0.621587, 0.125000,  0.476961,  0.6849,
-      0.5047,    -0.5255,   0.104167,  0.916667,  -0.694184, 0.216506,
-      0.532666,  0.3902,    0.8707,    -0.2994,   0.104167,  0.833333,
-      -0.554014, 0.125000,  0.554013,  0.6104,    0.5047,    -0.6104,
-      0.125000,  0.916667,  -0.595015, 0.000000,  0.456571,  0.7934,
-      -0.0000,   -0.6088,   0.104167,  1.000000,  -0.621587, 0.125000,
-      0.476961,  0.6849,    0.5047,    -0.5255,   0.104167,  0.916667,
-      -0.530330, 0.000000,  0.530330,  0.7071,    -0.0000,   -0.7071,
-      0.125000,  0.000000,  -0.621587, -0.125000, 0.476961,  0.6849,
-      -0.5047,   -0.5255,   0.104167,  0.083333,  -0.595015, 0.000000,
-      0.456571,  0.7934,    -0.0000,   -0.6088,   0.104167,  0.000000,
-      -0.554014, -0.125000, 0.554013,  0.6104,    -0.5047,   -0.6104,
-      0.125000,  0.083333,  -0.694184, -0.216506, 0.532666,  0.3902,
-      -0.8707,   -0.2994,   0.104167,  0.166667,  -0.621587, -0.125000,
-      0.476961,  0.6849,    -0.5047,   -0.5255,   0.104167,  0.083333,
-      -0.694184, -0.216506, 0.532666,  0.3902,    -0.8707,   -0.2994,
-      0.104167,  0.166667,  -0.707107, -0.250000, 0.707107,  -0.0076,
-      -0.9999,   0.0076,    0.125000,  0.250000,  -0.793353, -0.250000,
-      0.608761,  -0.0086,   -0.9999,   0.0066,    0.104167,  0.250000,
-      -0.707107, -0.250000, 0.707107,  -0.0076,   -0.9999,   0.0076,
-      0.125000,  0.250000,  -0.892522, -0.216506, 0.684857,  -0.4030,
-      -0.8614,   0.3092,    0.104167,  0.333333,  -0.793353, -0.250000,
-      0.608761,  -0.0086,   -0.9999,   0.0066,    0.104167,  0.250000,
-      -0.795495, -0.216506, 0.795495,  -0.3592,   -0.8614,   0.3592,
-      0.125000,  0.333333,  -0.965119, -0.125000, 0.740562,  -0.6892,
-      -0.4954,   0.5288,    0.104167,  0.416667,  -0.892522, -0.216506,
-      0.684857,  -0.4030,   -0.8614,   0.3092,    0.104167,  0.333333,
-      -0.860200, -0.125000, 0.860200,  -0.6142,   -0.4954,   0.6142,
-      0.125000,  0.416667,  -0.991692, 0.000000,  0.760952,  -0.7934,
-      -0.0000,   0.6088,    0.104167,  0.500000,  -0.965119, -0.125000,
-      0.740562,  -0.6892,   -0.4954,   0.5288,    0.104167,  0.416667,
-      -0.883884, 0.000000,  0.883883,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.740563, 0.125000,  0.965119,  -0.5288,
-      0.4954,    0.6892,    0.145833,  0.583333,  -0.860200, 0.125000,
-      0.860200,  -0.6142,   0.4954,    0.6142,    0.125000,  0.583333,
-      -0.860200, 0.125000,  0.860200,  -0.6142,   0.4954,    0.6142,
-      0.125000,  0.583333,  -0.684857, 0.216506,  0.892522,  -0.3093,
-      0.8614,    0.4030,    0.145833,  0.666667,  -0.795495, 0.216506,
-      0.795495,  -0.3592,   0.8614,    0.3592,    0.125000,  0.666667,
-      -0.684857, 0.216506,  0.892522,  -0.3093,   0.8614,    0.4030,
-      0.145833,  0.666667,  -0.707107, 0.250000,  0.707107,  -0.0076,
-      0.9999,    0.0076,    0.125000,  0.750000,  -0.795495, 0.216506,
-      0.795495,  -0.3592,   0.8614,    0.3592,    0.125000,  0.666667,
-      -0.707107, 0.250000,  0.707107,  -0.0076,   0.9999,    0.0076,
-      0.125000,  0.750000,  -0.532667, 0.216506,  0.694184,  0.2994,
-      0.8707,    -0.3902,   0.145833,  0.833333,  -0.618719, 0.216506,
-      0.618718,  0.3478,    0.8707,    -0.3478,   0.125000,  0.833333,
-      -0.532667, 0.216506,  0.694184,  0.2994,    0.8707,    -0.3902,
-      0.145833,  0.833333,  -0.554014, 0.125000,  0.554013,  0.6104,
-      0.5047,    -0.6104,   0.125000,  0.916667,  -0.618719, 0.216506,
-      0.618718,  0.3478,    0.8707,    -0.3478,   0.125000,  0.833333,
-      -0.476961, 0.125000,  0.621587,  0.5255,    0.5047,    -0.6849,
-      0.145833,  0.916667,  -0.530330, 0.000000,  0.530330,  0.7071,
-      -0.0000,   -0.7071,   0.125000,  1.000000,  -0.554014, 0.125000,
-      0.554013,  0.6104,    0.5047,    -0.6104,   0.125000,  0.916667,
-      -0.456571, 0.000000,  0.595015,  0.6088,    -0.0000,   -0.7934,
-      0.145833,  0.000000,  -0.554014, -0.125000, 0.554013,  0.6104,
-      -0.5047,   -0.6104,   0.125000,  0.083333,  -0.530330, 0.000000,
-      0.530330,  0.7071,    -0.0000,   -0.7071,   0.125000,  0.000000,
-      -0.476961, -0.125000, 0.621587,  0.5255,    -0.5047,   -0.6849,
-      0.145833,  0.083333,  -0.618719, -0.216506, 0.618718,  0.3478,
-      -0.8707,   -0.3478,   0.125000,  0.166667,  -0.554014, -0.125000,
-      0.554013,  0.6104,    -0.5047,   -0.6104,   0.125000,  0.083333,
-      -0.532667, -0.216506, 0.694184,  0.2994,    -0.8707,   -0.3902,
-      0.145833,  0.166667,  -0.707107, -0.250000, 0.707107,  -0.0076,
-      -0.9999,   0.0076,    0.125000,  0.250000,  -0.618719, -0.216506,
-      0.618718,  0.3478,    -0.8707,   -0.3478,   0.125000,  0.166667,
-      -0.608762, -0.250000, 0.793353,  -0.0066,   -0.9999,   0.0086,
-      0.145833,  0.250000,  -0.795495, -0.216506, 0.795495,  -0.3592,
-      -0.8614,   0.3592,    0.125000,  0.333333,  -0.707107, -0.250000,
-      0.707107,  -0.0076,   -0.9999,   0.0076,    0.125000,  0.250000,
-      -0.684857, -0.216506, 0.892522,  -0.3093,   -0.8614,   0.4030,
-      0.145833,  0.333333,  -0.860200, -0.125000, 0.860200,  -0.6142,
-      -0.4954,   0.6142,    0.125000,  0.416667,  -0.795495, -0.216506,
-      0.795495,  -0.3592,   -0.8614,   0.3592,    0.125000,  0.333333,
-      -0.740563, -0.125000, 0.965119,  -0.5288,   -0.4954,   0.6892,
-      0.145833,  0.416667,  -0.883884, 0.000000,  0.883883,  -0.7071,
-      -0.0000,   0.7071,    0.125000,  0.500000,  -0.860200, -0.125000,
-      0.860200,  -0.6142,   -0.4954,   0.6142,    0.125000,  0.416667,
-      -0.760952, 0.000000,  0.991691,  -0.6088,   -0.0000,   0.7934,
-      0.145833,  0.500000,  -0.608253, 0.125000,  1.053526,  -0.4343,
-      0.4954,    0.7523,    0.166667,  0.583333,  -0.740563, 0.125000,
-      0.965119,  -0.5288,   0.4954,    0.6892,    0.145833,  0.583333,
-      -0.608253, 0.125000,  1.053526,  -0.4343,   0.4954,    0.7523,
-      0.166667,  0.583333,  -0.684857, 0.216506,  0.892522,  -0.3093,
-      0.8614,    0.4030,    0.145833,  0.666667,  -0.740563, 0.125000,
-      0.965119,  -0.5288,   0.4954,    0.6892,    0.145833,  0.583333,
-      -0.562500, 0.216506,  0.974279,  -0.2540,   0.8614,    0.4399,
-      0.166667,  0.666667,  -0.608762, 0.250000,  0.793353,  -0.0066,
-      0.9999,    0.0086,    0.145833,  0.750000,  -0.684857, 0.216506,
-      0.892522,  -0.3093,   0.8614,    0.4030,    0.145833,  0.666667,
-      -0.500000, 0.250000,  0.866026,  -0.0054,   0.9999,    0.0093,
-      0.166667,  0.750000,  -0.532667, 0.216506,  0.694184,  0.2994,
-      0.8707,    -0.3902,   0.145833,  0.833333,  -0.608762, 0.250000,
-      0.793353,  -0.0066,   0.9999,    0.0086,    0.145833,  0.750000,
-      -0.532667, 0.216506,  0.694184,  0.2994,    0.8707,    -0.3902,
-      0.145833,  0.833333,  -0.391747, 0.125000,  0.678525,  0.4316,
-      0.5047,    -0.7476,   0.166667,  0.916667,  -0.476961, 0.125000,
-      0.621587,  0.5255,    0.5047,    -0.6849,   0.145833,  0.916667,
-      -0.391747, 0.125000,  0.678525,  0.4316,    0.5047,    -0.7476,
-      0.166667,  0.916667,  -0.456571, 0.000000,  0.595015,  0.6088,
-      -0.0000,   -0.7934,   0.145833,  1.000000,  -0.476961, 0.125000,
-      0.621587,  0.5255,    0.5047,    -0.6849,   0.145833,  0.916667,
-      -0.375000, 0.000000,  0.649519,  0.5000,    -0.0000,   -0.8660,
-      0.166667,  0.000000,  -0.476961, -0.125000, 0.621587,  0.5255,
-      -0.5047,   -0.6849,   0.145833,  0.083333,  -0.456571, 0.000000,
-      0.595015,  0.6088,    -0.0000,   -0.7934,   0.145833,  0.000000,
-      -0.391747, -0.125000, 0.678525,  0.4316,    -0.5047,   -0.7476,
-      0.166667,  0.083333,  -0.532667, -0.216506, 0.694184,  0.2994,
-      -0.8707,   -0.3902,   0.145833,  0.166667,  -0.476961, -0.125000,
-      0.621587,  0.5255,    -0.5047,   -0.6849,   0.145833,  0.083333,
-      -0.437500, -0.216506, 0.757772,  0.2459,    -0.8707,   -0.4259,
-      0.166667,  0.166667,  -0.608762, -0.250000, 0.793353,  -0.0066,
-      -0.9999,   0.0086,    0.145833,  0.250000,  -0.532667, -0.216506,
-      0.694184,  0.2994,    -0.8707,   -0.3902,   0.145833,  0.166667,
-      -0.608762, -0.250000, 0.793353,  -0.0066,   -0.9999,   0.0086,
-      0.145833,  0.250000,  -0.562500, -0.216506, 0.974279,  -0.2540,
-      -0.8614,   0.4399,    0.166667,  0.333333,  -0.684857, -0.216506,
-      0.892522,  -0.3093,   -0.8614,   0.4030,    0.145833,  0.333333,
-      -0.684857, -0.216506, 0.892522,  -0.3093,   -0.8614,   0.4030,
-      0.145833,  0.333333,  -0.608253, -0.125000, 1.053526,  -0.4343,
-      -0.4954,   0.7523,    0.166667,  0.416667,  -0.740563, -0.125000,
-      0.965119,  -0.5288,   -0.4954,   0.6892,    0.145833,  0.416667,
-      -0.608253, -0.125000, 1.053526,  -0.4343,   -0.4954,   0.7523,
-      0.166667,  0.416667,  -0.760952, 0.000000,  0.991691,  -0.6088,
-      -0.0000,   0.7934,    0.145833,  0.500000,  -0.740563, -0.125000,
-      0.965119,  -0.5288,   -0.4954,   0.6892,    0.145833,  0.416667,
-      -0.478354, 0.000000,  1.154849,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.608253, 0.125000,  1.053526,  -0.4343,
-      0.4954,    0.7523,    0.166667,  0.583333,  -0.625000, 0.000000,
-      1.082532,  -0.5000,   -0.0000,   0.8660,    0.166667,  0.500000,
-      -0.465537, 0.125000,  1.123905,  -0.3324,   0.4954,    0.8025,
-      0.187500,  0.583333,  -0.562500, 0.216506,  0.974279,  -0.2540,
-      0.8614,    0.4399,    0.166667,  0.666667,  -0.608253, 0.125000,
-      1.053526,  -0.4343,   0.4954,    0.7523,    0.166667,  0.583333,
-      -0.430519, 0.216506,  1.039364,  -0.1944,   0.8614,    0.4693,
-      0.187500,  0.666667,  -0.500000, 0.250000,  0.866026,  -0.0054,
-      0.9999,    0.0093,    0.166667,  0.750000,  -0.562500, 0.216506,
-      0.974279,  -0.2540,   0.8614,    0.4399,    0.166667,  0.666667,
-      -0.382684, 0.250000,  0.923880,  -0.0041,   0.9999,    0.0100,
-      0.187500,  0.750000,  -0.437500, 0.216506,  0.757772,  0.2459,
-      0.8707,    -0.4259,   0.166667,  0.833333,  -0.500000, 0.250000,
-      0.866026,  -0.0054,   0.9999,    0.0093,    0.166667,  0.750000,
-      -0.334848, 0.216506,  0.808395,  0.1882,    0.8707,    -0.4544,
-      0.187500,  0.833333,  -0.391747, 0.125000,  0.678525,  0.4316,
-      0.5047,    -0.7476,   0.166667,  0.916667,  -0.437500, 0.216506,
-      0.757772,  0.2459,    0.8707,    -0.4259,   0.166667,  0.833333,
-      -0.299830, 0.125000,  0.723854,  0.3304,    0.5047,    -0.7976,
-      0.187500,  0.916667,  -0.375000, 0.000000,  0.649519,  0.5000,
-      -0.0000,   -0.8660,   0.166667,  1.000000,  -0.391747, 0.125000,
-      0.678525,  0.4316,    0.5047,    -0.7476,   0.166667,  0.916667,
-      -0.287013, 0.000000,  0.692910,  0.3827,    -0.0000,   -0.9239,
-      0.187500,  0.000000,  -0.391747, -0.125000, 0.678525,  0.4316,
-      -0.5047,   -0.7476,   0.166667,  0.083333,  -0.375000, 0.000000,
-      0.649519,  0.5000,    -0.0000,   -0.8660,   0.166667,  0.000000,
-      -0.299830, -0.125000, 0.723854,  0.3304,    -0.5047,   -0.7976,
-      0.187500,  0.083333,  -0.437500, -0.216506, 0.757772,  0.2459,
-      -0.8707,   -0.4259,   0.166667,  0.166667,  -0.391747, -0.125000,
-      0.678525,  0.4316,    -0.5047,   -0.7476,   0.166667,  0.083333,
-      -0.437500, -0.216506, 0.757772,  0.2459,    -0.8707,   -0.4259,
-      0.166667,  0.166667,  -0.382684, -0.250000, 0.923880,  -0.0041,
-      -0.9999,   0.0100,    0.187500,  0.250000,  -0.500000, -0.250000,
-      0.866026,  -0.0054,   -0.9999,   0.0093,    0.166667,  0.250000,
-      -0.382684, -0.250000, 0.923880,  -0.0041,   -0.9999,   0.0100,
-      0.187500,  0.250000,  -0.562500, -0.216506, 0.974279,  -0.2540,
-      -0.8614,   0.4399,    0.166667,  0.333333,  -0.500000, -0.250000,
-      0.866026,  -0.0054,   -0.9999,   0.0093,    0.166667,  0.250000,
-      -0.562500, -0.216506, 0.974279,  -0.2540,   -0.8614,   0.4399,
-      0.166667,  0.333333,  -0.465537, -0.125000, 1.123905,  -0.3324,
-      -0.4954,   0.8025,    0.187500,  0.416667,  -0.608253, -0.125000,
-      1.053526,  -0.4343,   -0.4954,   0.7523,    0.166667,  0.416667,
-      -0.465537, -0.125000, 1.123905,  -0.3324,   -0.4954,   0.8025,
-      0.187500,  0.416667,  -0.625000, 0.000000,  1.082532,  -0.5000,
-      -0.0000,   0.8660,    0.166667,  0.500000,  -0.608253, -0.125000,
-      1.053526,  -0.4343,   -0.4954,   0.7523,    0.166667,  0.416667,
-      -0.323524, 0.000000,  1.207407,  -0.2588,   -0.0000,   0.9659,
-      0.208333,  0.500000,  -0.465537, 0.125000,  1.123905,  -0.3324,
-      0.4954,    0.8025,    0.187500,  0.583333,  -0.478354, 0.000000,
-      1.154849,  -0.3827,   -0.0000,   0.9239,    0.187500,  0.500000,
-      -0.314855, 0.125000,  1.175055,  -0.2248,   0.4954,    0.8391,
-      0.208333,  0.583333,  -0.430519, 0.216506,  1.039364,  -0.1944,
-      0.8614,    0.4693,    0.187500,  0.666667,  -0.465537, 0.125000,
-      1.123905,  -0.3324,   0.4954,    0.8025,    0.187500,  0.583333,
-      -0.291172, 0.216506,  1.086666,  -0.1315,   0.8614,    0.4907,
-      0.208333,  0.666667,  -0.382684, 0.250000,  0.923880,  -0.0041,
-      0.9999,    0.0100,    0.187500,  0.750000,  -0.430519, 0.216506,
-      1.039364,  -0.1944,   0.8614,    0.4693,    0.187500,  0.666667,
-      -0.258819, 0.250000,  0.965926,  -0.0028,   0.9999,    0.0104,
-      0.208333,  0.750000,  -0.334848, 0.216506,  0.808395,  0.1882,
-      0.8707,    -0.4544,   0.187500,  0.833333,  -0.382684, 0.250000,
-      0.923880,  -0.0041,   0.9999,    0.0100,    0.187500,  0.750000,
-      -0.334848, 0.216506,  0.808395,  0.1882,    0.8707,    -0.4544,
-      0.187500,  0.833333,  -0.202783, 0.125000,  0.756797,  0.2234,
-      0.5047,    -0.8339,   0.208333,  0.916667,  -0.299830, 0.125000,
-      0.723854,  0.3304,    0.5047,    -0.7976,   0.187500,  0.916667,
-      -0.202783, 0.125000,  0.756797,  0.2234,    0.5047,    -0.8339,
-      0.208333,  0.916667,  -0.287013, 0.000000,  0.692910,  0.3827,
-      -0.0000,   -0.9239,   0.187500,  1.000000,  -0.299830, 0.125000,
-      0.723854,  0.3304,    0.5047,    -0.7976,   0.187500,  0.916667,
-      -0.194115, 0.000000,  0.724444,  0.2588,    -0.0000,   -0.9659,
-      0.208333,  0.000000,  -0.299830, -0.125000, 0.723854,  0.3304,
-      -0.5047,   -0.7976,   0.187500,  0.083333,  -0.287013, 0.000000,
-      0.692910,  0.3827,    -0.0000,   -0.9239,   0.187500,  0.000000,
-      -0.202783, -0.125000, 0.756797,  0.2234,    -0.5047,   -0.8339,
-      0.208333,  0.083333,  -0.334848, -0.216506, 0.808395,  0.1882,
-      -0.8707,   -0.4544,   0.187500,  0.166667,  -0.299830, -0.125000,
-      0.723854,  0.3304,    -0.5047,   -0.7976,   0.187500,  0.083333,
-      -0.226467, -0.216506, 0.845185,  0.1273,    -0.8707,   -0.4751,
-      0.208333,  0.166667,  -0.382684, -0.250000, 0.923880,  -0.0041,
-      -0.9999,   0.0100,    0.187500,  0.250000,  -0.334848, -0.216506,
-      0.808395,  0.1882,    -0.8707,   -0.4544,   0.187500,  0.166667,
-      -0.258819, -0.250000, 0.965926,  -0.0028,   -0.9999,   0.0104,
-      0.208333,  0.250000,  -0.430519, -0.216506, 1.039364,  -0.1944,
-      -0.8614,   0.4693,    0.187500,  0.333333,  -0.382684, -0.250000,
-      0.923880,  -0.0041,   -0.9999,   0.0100,    0.187500,  0.250000,
-      -0.430519, -0.216506, 1.039364,  -0.1944,   -0.8614,   0.4693,
-      0.187500,  0.333333,  -0.314855, -0.125000, 1.175055,  -0.2248,
-      -0.4954,   0.8391,    0.208333,  0.416667,  -0.465537, -0.125000,
-      1.123905,  -0.3324,   -0.4954,   0.8025,    0.187500,  0.416667,
-      -0.314855, -0.125000, 1.175055,  -0.2248,   -0.4954,   0.8391,
-      0.208333,  0.416667,  -0.478354, 0.000000,  1.154849,  -0.3827,
-      -0.0000,   0.9239,    0.187500,  0.500000,  -0.465537, -0.125000,
-      1.123905,  -0.3324,   -0.4954,   0.8025,    0.187500,  0.416667,
-      -0.163158, 0.000000,  1.239306,  -0.1305,   -0.0000,   0.9914,
-      0.229167,  0.500000,  -0.314855, 0.125000,  1.175055,  -0.2248,
-      0.4954,    0.8391,    0.208333,  0.583333,  -0.323524, 0.000000,
-      1.207407,  -0.2588,   -0.0000,   0.9659,    0.208333,  0.500000,
-      -0.314855, 0.125000,  1.175055,  -0.2248,   0.4954,    0.8391,
-      0.208333,  0.583333,  -0.146843, 0.216506,  1.115375,  -0.0663,
-      0.8614,    0.5037,    0.229167,  0.666667,  -0.291172, 0.216506,
-      1.086666,  -0.1315,   0.8614,    0.4907,    0.208333,  0.666667,
-      -0.146843, 0.216506,  1.115375,  -0.0663,   0.8614,    0.5037,
-      0.229167,  0.666667,  -0.258819, 0.250000,  0.965926,  -0.0028,
-      0.9999,    0.0104,    0.208333,  0.750000,  -0.291172, 0.216506,
-      1.086666,  -0.1315,   0.8614,    0.4907,    0.208333,  0.666667,
-      -0.130527, 0.250000,  0.991445,  -0.0014,   0.9999,    0.0107,
-      0.229167,  0.750000,  -0.226467, 0.216506,  0.845185,  0.1273,
-      0.8707,    -0.4751,   0.208333,  0.833333,  -0.258819, 0.250000,
-      0.965926,  -0.0028,   0.9999,    0.0104,    0.208333,  0.750000,
-      -0.226467, 0.216506,  0.845185,  0.1273,    0.8707,    -0.4751,
-      0.208333,  0.833333,  -0.102267, 0.125000,  0.776791,  0.1127,
-      0.5047,    -0.8559,   0.229167,  0.916667,  -0.202783, 0.125000,
-      0.756797,  0.2234,    0.5047,    -0.8339,   0.208333,  0.916667,
-      -0.102267, 0.125000,  0.776791,  0.1127,    0.5047,    -0.8559,
-      0.229167,  0.916667,  -0.194115, 0.000000,  0.724444,  0.2588,
-      -0.0000,   -0.9659,   0.208333,  1.000000,  -0.202783, 0.125000,
-      0.756797,  0.2234,    0.5047,    -0.8339,   0.208333,  0.916667,
-      -0.097895, 0.000000,  0.743584,  0.1305,    -0.0000,   -0.9914,
-      0.229167,  0.000000,  -0.202783, -0.125000, 0.756797,  0.2234,
-      -0.5047,   -0.8339,   0.208333,  0.083333,  -0.194115, 0.000000,
-      0.724444,  0.2588,    -0.0000,   -0.9659,   0.208333,  0.000000,
-      -0.102267, -0.125000, 0.776791,  0.1127,    -0.5047,   -0.8559,
-      0.229167,  0.083333,  -0.226467, -0.216506, 0.845185,  0.1273,
-      -0.8707,   -0.4751,   0.208333,  0.166667,  -0.202783, -0.125000,
-      0.756797,  0.2234,    -0.5047,   -0.8339,   0.208333,  0.083333,
-      -0.226467, -0.216506, 0.845185,  0.1273,    -0.8707,   -0.4751,
-      0.208333,  0.166667,  -0.130527, -0.250000, 0.991445,  -0.0014,
-      -0.9999,   0.0107,    0.229167,  0.250000,  -0.258819, -0.250000,
-      0.965926,  -0.0028,   -0.9999,   0.0104,    0.208333,  0.250000,
-      -0.130527, -0.250000, 0.991445,  -0.0014,   -0.9999,   0.0107,
-      0.229167,  0.250000,  -0.291172, -0.216506, 1.086666,  -0.1315,
-      -0.8614,   0.4907,    0.208333,  0.333333,  -0.258819, -0.250000,
-      0.965926,  -0.0028,   -0.9999,   0.0104,    0.208333,  0.250000,
-      -0.146843, -0.216506, 1.115375,  -0.0663,   -0.8614,   0.5037,
-      0.229167,  0.333333,  -0.314855, -0.125000, 1.175055,  -0.2248,
-      -0.4954,   0.8391,    0.208333,  0.416667,  -0.291172, -0.216506,
-      1.086666,  -0.1315,   -0.8614,   0.4907,    0.208333,  0.333333,
-      -0.158787, -0.125000, 1.206099,  -0.1134,   -0.4954,   0.8612,
-      0.229167,  0.416667,  -0.323524, 0.000000,  1.207407,  -0.2588,
-      -0.0000,   0.9659,    0.208333,  0.500000,  -0.314855, -0.125000,
-      1.175055,  -0.2248,   -0.4954,   0.8391,    0.208333,  0.416667,
-      0.000000,  0.000000,  1.250000,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  -0.158787, 0.125000,  1.206099,  -0.1134,
-      0.4954,    0.8612,    0.229167,  0.583333,  -0.163158, 0.000000,
-      1.239306,  -0.1305,   -0.0000,   0.9914,    0.229167,  0.500000,
-      0.000000,  0.125000,  1.216506,  -0.0000,   0.4954,    0.8687,
-      0.250000,  0.583333,  -0.146843, 0.216506,  1.115375,  -0.0663,
-      0.8614,    0.5037,    0.229167,  0.666667,  -0.158787, 0.125000,
-      1.206099,  -0.1134,   0.4954,    0.8612,    0.229167,  0.583333,
-      -0.146843, 0.216506,  1.115375,  -0.0663,   0.8614,    0.5037,
-      0.229167,  0.666667,  0.000000,  0.250000,  1.000000,  -0.0000,
-      0.9999,    0.0108,    0.250000,  0.750000,  -0.130527, 0.250000,
-      0.991445,  -0.0014,   0.9999,    0.0107,    0.229167,  0.750000,
-      -0.130527, 0.250000,  0.991445,  -0.0014,   0.9999,    0.0107,
-      0.229167,  0.750000,  0.000000,  0.216506,  0.875000,  -0.0000,
-      0.8707,    -0.4918,   0.250000,  0.833333,  -0.114211, 0.216506,
-      0.867514,  0.0642,    0.8707,    -0.4876,   0.229167,  0.833333,
-      0.000000,  0.216506,  0.875000,  -0.0000,   0.8707,    -0.4918,
-      0.250000,  0.833333,  -0.102267, 0.125000,  0.776791,  0.1127,
-      0.5047,    -0.8559,   0.229167,  0.916667,  -0.114211, 0.216506,
-      0.867514,  0.0642,    0.8707,    -0.4876,   0.229167,  0.833333,
-      -0.102267, 0.125000,  0.776791,  0.1127,    0.5047,    -0.8559,
-      0.229167,  0.916667,  0.000000,  0.000000,  0.750000,  -0.0000,
-      -0.0000,   -1.0000,   0.250000,  1.000000,  -0.097895, 0.000000,
-      0.743584,  0.1305,    -0.0000,   -0.9914,   0.229167,  1.000000,
-      0.000000,  0.000000,  0.750000,  -0.0000,   -0.0000,   -1.0000,
-      0.250000,  0.000000,  -0.102267, -0.125000, 0.776791,  0.1127,
-      -0.5047,   -0.8559,   0.229167,  0.083333,  -0.097895, 0.000000,
-      0.743584,  0.1305,    -0.0000,   -0.9914,   0.229167,  0.000000,
-      0.000000,  -0.125000, 0.783494,  -0.0000,   -0.5047,   -0.8633,
-      0.250000,  0.083333,  -0.114211, -0.216506, 0.867514,  0.0642,
-      -0.8707,   -0.4876,   0.229167,  0.166667,  -0.102267, -0.125000,
-      0.776791,  0.1127,    -0.5047,   -0.8559,   0.229167,  0.083333,
-      0.000000,  -0.216506, 0.875000,  -0.0000,   -0.8707,   -0.4918,
-      0.250000,  0.166667,  -0.130527, -0.250000, 0.991445,  -0.0014,
-      -0.9999,   0.0107,    0.229167,  0.250000,  -0.114211, -0.216506,
-      0.867514,  0.0642,    -0.8707,   -0.4876,   0.229167,  0.166667,
-      0.000000,  -0.250000, 1.000000,  -0.0000,   -0.9999,   0.0108,
-      0.250000,  0.250000,  -0.146843, -0.216506, 1.115375,  -0.0663,
-      -0.8614,   0.5037,    0.229167,  0.333333,  -0.130527, -0.250000,
-      0.991445,  -0.0014,   -0.9999,   0.0107,    0.229167,  0.250000,
-      0.000000,  -0.216506, 1.125000,  -0.0000,   -0.8614,   0.5080,
-      0.250000,  0.333333,  -0.158787, -0.125000, 1.206099,  -0.1134,
-      -0.4954,   0.8612,    0.229167,  0.416667,  -0.146843, -0.216506,
-      1.115375,  -0.0663,   -0.8614,   0.5037,    0.229167,  0.333333,
-      0.000000,  -0.125000, 1.216506,  -0.0000,   -0.4954,   0.8687,
-      0.250000,  0.416667,  -0.163158, 0.000000,  1.239306,  -0.1305,
-      -0.0000,   0.9914,    0.229167,  0.500000,  -0.158787, -0.125000,
-      1.206099,  -0.1134,   -0.4954,   0.8612,    0.229167,  0.416667,
-      0.000000,  0.000000,  1.250000,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  0.158786,  0.125000,  1.206099,  0.1134,
-      0.4954,    0.8612,    0.270833,  0.583333,  0.000000,  0.125000,
-      1.216506,  -0.0000,   0.4954,    0.8687,    0.250000,  0.583333,
-      0.158786,  0.125000,  1.206099,  0.1134,    0.4954,    0.8612,
-      0.270833,  0.583333,  0.000000,  0.216506,  1.125000,  -0.0000,
-      0.8614,    0.5080,    0.250000,  0.666667,  0.000000,  0.125000,
-      1.216506,  -0.0000,   0.4954,    0.8687,    0.250000,  0.583333,
-      0.146842,  0.216506,  1.115376,  0.0663,    0.8614,    0.5037,
-      0.270833,  0.666667,  0.000000,  0.250000,  1.000000,  -0.0000,
-      0.9999,    0.0108,    0.250000,  0.750000,  0.000000,  0.216506,
-      1.125000,  -0.0000,   0.8614,    0.5080,    0.250000,  0.666667,
-      0.130526,  0.250000,  0.991445,  0.0014,    0.9999,    0.0107,
-      0.270833,  0.750000,  0.000000,  0.216506,  0.875000,  -0.0000,
-      0.8707,    -0.4918,   0.250000,  0.833333,  0.000000,  0.250000,
-      1.000000,  -0.0000,   0.9999,    0.0108,    0.250000,  0.750000,
-      0.114210,  0.216506,  0.867514,  -0.0642,   0.8707,    -0.4876,
-      0.270833,  0.833333,  0.000000,  0.125000,  0.783494,  -0.0000,
-      0.5047,    -0.8633,   0.250000,  0.916667,  0.000000,  0.216506,
-      0.875000,  -0.0000,   0.8707,    -0.4918,   0.250000,  0.833333,
-      0.102266,  0.125000,  0.776791,  -0.1127,   0.5047,    -0.8559,
-      0.270833,  0.916667,  0.000000,  0.000000,  0.750000,  -0.0000,
-      -0.0000,   -1.0000,   0.250000,  1.000000,  0.000000,  0.125000,
-      0.783494,  -0.0000,   0.5047,    -0.8633,   0.250000,  0.916667,
-      0.097895,  0.000000,  0.743584,  -0.1305,   -0.0000,   -0.9914,
-      0.270833,  0.000000,  0.000000,  -0.125000, 0.783494,  -0.0000,
-      -0.5047,   -0.8633,   0.250000,  0.083333,  0.000000,  0.000000,
-      0.750000,  -0.0000,   -0.0000,   -1.0000,   0.250000,  0.000000,
-      0.000000,  -0.125000, 0.783494,  -0.0000,   -0.5047,   -0.8633,
-      0.250000,  0.083333,  0.114210,  -0.216506, 0.867514,  -0.0642,
-      -0.8707,   -0.4876,   0.270833,  0.166667,  0.000000,  -0.216506,
-      0.875000,  -0.0000,   -0.8707,   -0.4918,   0.250000,  0.166667,
-      0.000000,  -0.216506, 0.875000,  -0.0000,   -0.8707,   -0.4918,
-      0.250000,  0.166667,  0.130526,  -0.250000, 0.991445,  0.0014,
-      -0.9999,   0.0107,    0.270833,  0.250000,  0.000000,  -0.250000,
-      1.000000,  -0.0000,   -0.9999,   0.0108,    0.250000,  0.250000,
-      0.130526,  -0.250000, 0.991445,  0.0014,    -0.9999,   0.0107,
-      0.270833,  0.250000,  0.000000,  -0.216506, 1.125000,  -0.0000,
-      -0.8614,   0.5080,    0.250000,  0.333333,  0.000000,  -0.250000,
-      1.000000,  -0.0000,   -0.9999,   0.0108,    0.250000,  0.250000,
-      0.146842,  -0.216506, 1.115376,  0.0663,    -0.8614,   0.5037,
-      0.270833,  0.333333,  0.000000,  -0.125000, 1.216506,  -0.0000,
-      -0.4954,   0.8687,    0.250000,  0.416667,  0.000000,  -0.216506,
-      1.125000,  -0.0000,   -0.8614,   0.5080,    0.250000,  0.333333,
-      0.158786,  -0.125000, 1.206099,  0.1134,    -0.4954,   0.8612,
-      0.270833,  0.416667,  0.000000,  0.000000,  1.250000,  -0.0000,
-      -0.0000,   1.0000,    0.250000,  0.500000,  0.000000,  -0.125000,
-      1.216506,  -0.0000,   -0.4954,   0.8687,    0.250000,  0.416667,
-      0.323523,  0.000000,  1.207407,  0.2588,    -0.0000,   0.9659,
-      0.291667,  0.500000,  0.158786,  0.125000,  1.206099,  0.1134,
-      0.4954,    0.8612,    0.270833,  0.583333,  0.163158,  0.000000,
-      1.239306,  0.1305,    -0.0000,   0.9914,    0.270833,  0.500000,
-      0.314854,  0.125000,  1.175055,  0.2248,    0.4954,    0.8391,
-      0.291667,  0.583333,  0.146842,  0.216506,  1.115376,  0.0663,
-      0.8614,    0.5037,    0.270833,  0.666667,  0.158786,  0.125000,
-      1.206099,  0.1134,    0.4954,    0.8612,    0.270833,  0.583333,
-      0.291171,  0.216506,  1.086667,  0.1315,    0.8614,    0.4907,
-      0.291667,  0.666667,  0.130526,  0.250000,  0.991445,  0.0014,
-      0.9999,    0.0107,    0.270833,  0.750000,  0.146842,  0.216506,
-      1.115376,  0.0663,    0.8614,    0.5037,    0.270833,  0.666667,
-      0.258819,  0.250000,  0.965926,  0.0028,    0.9999,    0.0104,
-      0.291667,  0.750000,  0.114210,  0.216506,  0.867514,  -0.0642,
-      0.8707,    -0.4876,   0.270833,  0.833333,  0.130526,  0.250000,
-      0.991445,  0.0014,    0.9999,    0.0107,    0.270833,  0.750000,
-      0.226466,  0.216506,  0.845185,  -0.1273,   0.8707,    -0.4751,
-      0.291667,  0.833333,  0.102266,  0.125000,  0.776791,  -0.1127,
-      0.5047,    -0.8559,   0.270833,  0.916667,  0.114210,  0.216506,
-      0.867514,  -0.0642,   0.8707,    -0.4876,   0.270833,  0.833333,
-      0.102266,  0.125000,  0.776791,  -0.1127,   0.5047,    -0.8559,
-      0.270833,  0.916667,  0.194114,  0.000000,  0.724444,  -0.2588,
-      -0.0000,   -0.9659,   0.291667,  1.000000,  0.097895,  0.000000,
-      0.743584,  -0.1305,   -0.0000,   -0.9914,   0.270833,  1.000000,
-      0.194114,  0.000000,  0.724444,  -0.2588,   -0.0000,   -0.9659,
-      0.291667,  0.000000,  0.102266,  -0.125000, 0.776791,  -0.1127,
-      -0.5047,   -0.8559,   0.270833,  0.083333,  0.097895,  0.000000,
-      0.743584,  -0.1305,   -0.0000,   -0.9914,   0.270833,  0.000000,
-      0.202783,  -0.125000, 0.756797,  -0.2234,   -0.5047,   -0.8339,
-      0.291667,  0.083333,  0.114210,  -0.216506, 0.867514,  -0.0642,
-      -0.8707,   -0.4876,   0.270833,  0.166667,  0.102266,  -0.125000,
-      0.776791,  -0.1127,   -0.5047,   -0.8559,   0.270833,  0.083333,
-      0.114210,  -0.216506, 0.867514,  -0.0642,   -0.8707,   -0.4876,
-      0.270833,  0.166667,  0.258819,  -0.250000, 0.965926,  0.0028,
-      -0.9999,   0.0104,    0.291667,  0.250000,  0.130526,  -0.250000,
-      0.991445,  0.0014,    -0.9999,   0.0107,    0.270833,  0.250000,
-      0.130526,  -0.250000, 0.991445,  0.0014,    -0.9999,   0.0107,
-      0.270833,  0.250000,  0.291171,  -0.216506, 1.086667,  0.1315,
-      -0.8614,   0.4907,    0.291667,  0.333333,  0.146842,  -0.216506,
-      1.115376,  0.0663,    -0.8614,   0.5037,    0.270833,  0.333333,
-      0.291171,  -0.216506, 1.086667,  0.1315,    -0.8614,   0.4907,
-      0.291667,  0.333333,  0.158786,  -0.125000, 1.206099,  0.1134,
-      -0.4954,   0.8612,    0.270833,  0.416667,  0.146842,  -0.216506,
-      1.115376,  0.0663,    -0.8614,   0.5037,    0.270833,  0.333333,
-      0.314854,  -0.125000, 1.175055,  0.2248,    -0.4954,   0.8391,
-      0.291667,  0.416667,  0.163158,  0.000000,  1.239306,  0.1305,
-      -0.0000,   0.9914,    0.270833,  0.500000,  0.158786,  -0.125000,
-      1.206099,  0.1134,    -0.4954,   0.8612,    0.270833,  0.416667,
-      0.478355,  0.000000,  1.154849,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.314854,  0.125000,  1.175055,  0.2248,
-      0.4954,    0.8391,    0.291667,  0.583333,  0.323523,  0.000000,
-      1.207407,  0.2588,    -0.0000,   0.9659,    0.291667,  0.500000,
-      0.465537,  0.125000,  1.123905,  0.3324,    0.4954,    0.8025,
-      0.312500,  0.583333,  0.291171,  0.216506,  1.086667,  0.1315,
-      0.8614,    0.4907,    0.291667,  0.666667,  0.314854,  0.125000,
-      1.175055,  0.2248,    0.4954,    0.8391,    0.291667,  0.583333,
-      0.430519,  0.216506,  1.039364,  0.1944,    0.8614,    0.4693,
-      0.312500,  0.666667,  0.258819,  0.250000,  0.965926,  0.0028,
-      0.9999,    0.0104,    0.291667,  0.750000,  0.291171,  0.216506,
-      1.086667,  0.1315,    0.8614,    0.4907,    0.291667,  0.666667,
-      0.382684,  0.250000,  0.923879,  0.0041,    0.9999,    0.0100,
-      0.312500,  0.750000,  0.226466,  0.216506,  0.845185,  -0.1273,
-      0.8707,    -0.4751,   0.291667,  0.833333,  0.258819,  0.250000,
-      0.965926,  0.0028,    0.9999,    0.0104,    0.291667,  0.750000,
-      0.334848,  0.216506,  0.808394,  -0.1882,   0.8707,    -0.4544,
-      0.312500,  0.833333,  0.202783,  0.125000,  0.756797,  -0.2234,
-      0.5047,    -0.8339,   0.291667,  0.916667,  0.226466,  0.216506,
-      0.845185,  -0.1273,   0.8707,    -0.4751,   0.291667,  0.833333,
-      0.299830,  0.125000,  0.723854,  -0.3304,   0.5047,    -0.7976,
-      0.312500,  0.916667,  0.194114,  0.000000,  0.724444,  -0.2588,
-      -0.0000,   -0.9659,   0.291667,  1.000000,  0.202783,  0.125000,
-      0.756797,  -0.2234,   0.5047,    -0.8339,   0.291667,  0.916667,
-      0.287013,  0.000000,  0.692910,  -0.3827,   -0.0000,   -0.9239,
-      0.312500,  0.000000,  0.202783,  -0.125000, 0.756797,  -0.2234,
-      -0.5047,   -0.8339,   0.291667,  0.083333,  0.194114,  0.000000,
-      0.724444,  -0.2588,   -0.0000,   -0.9659,   0.291667,  0.000000,
-      0.299830,  -0.125000, 0.723854,  -0.3304,   -0.5047,   -0.7976,
-      0.312500,  0.083333,  0.226466,  -0.216506, 0.845185,  -0.1273,
-      -0.8707,   -0.4751,   0.291667,  0.166667,  0.202783,  -0.125000,
-      0.756797,  -0.2234,   -0.5047,   -0.8339,   0.291667,  0.083333,
-      0.334848,  -0.216506, 0.808394,  -0.1882,   -0.8707,   -0.4544,
-      0.312500,  0.166667,  0.258819,  -0.250000, 0.965926,  0.0028,
-      -0.9999,   0.0104,    0.291667,  0.250000,  0.226466,  -0.216506,
-      0.845185,  -0.1273,   -0.8707,   -0.4751,   0.291667,  0.166667,
-      0.258819,  -0.250000, 0.965926,  0.0028,    -0.9999,   0.0104,
-      0.291667,  0.250000,  0.430519,  -0.216506, 1.039364,  0.1944,
-      -0.8614,   0.4693,    0.312500,  0.333333,  0.291171,  -0.216506,
-      1.086667,  0.1315,    -0.8614,   0.4907,    0.291667,  0.333333,
-      0.291171,  -0.216506, 1.086667,  0.1315,    -0.8614,   0.4907,
-      0.291667,  0.333333,  0.465537,  -0.125000, 1.123905,  0.3324,
-      -0.4954,   0.8025,    0.312500,  0.416667,  0.314854,  -0.125000,
-      1.175055,  0.2248,    -0.4954,   0.8391,    0.291667,  0.416667,
-      0.465537,  -0.125000, 1.123905,  0.3324,    -0.4954,   0.8025,
-      0.312500,  0.416667,  0.323523,  0.000000,  1.207407,  0.2588,
-      -0.0000,   0.9659,    0.291667,  0.500000,  0.314854,  -0.125000,
-      1.175055,  0.2248,    -0.4954,   0.8391,    0.291667,  0.416667,
-      0.625000,  0.000000,  1.082532,  0.5000,    -0.0000,   0.8660,
-      0.333333,  0.500000,  0.465537,  0.125000,  1.123905,  0.3324,
-      0.4954,    0.8025,    0.312500,  0.583333,  0.478355,  0.000000,
-      1.154849,  0.3827,    -0.0000,   0.9239,    0.312500,  0.500000,
-      0.608253,  0.125000,  1.053525,  0.4343,    0.4954,    0.7523,
-      0.333333,  0.583333,  0.430519,  0.216506,  1.039364,  0.1944,
-      0.8614,    0.4693,    0.312500,  0.666667,  0.465537,  0.125000,
-      1.123905,  0.3324,    0.4954,    0.8025,    0.312500,  0.583333,
-      0.430519,  0.216506,  1.039364,  0.1944,    0.8614,    0.4693,
-      0.312500,  0.666667,  0.500000,  0.250000,  0.866025,  0.0054,
-      0.9999,    0.0093,    0.333333,  0.750000,  0.382684,  0.250000,
-      0.923879,  0.0041,    0.9999,    0.0100,    0.312500,  0.750000,
-      0.382684,  0.250000,  0.923879,  0.0041,    0.9999,    0.0100,
-      0.312500,  0.750000,  0.437500,  0.216506,  0.757772,  -0.2459,
-      0.8707,    -0.4259,   0.333333,  0.833333,  0.334848,  0.216506,
-      0.808394,  -0.1882,   0.8707,    -0.4544,   0.312500,  0.833333,
-      0.437500,  0.216506,  0.757772,  -0.2459,   0.8707,    -0.4259,
-      0.333333,  0.833333,  0.299830,  0.125000,  0.723854,  -0.3304,
-      0.5047,    -0.7976,   0.312500,  0.916667,  0.334848,  0.216506,
-      0.808394,  -0.1882,   0.8707,    -0.4544,   0.312500,  0.833333,
-      0.391747,  0.125000,  0.678525,  -0.4316,   0.5047,    -0.7476,
-      0.333333,  0.916667,  0.287013,  0.000000,  0.692910,  -0.3827,
-      -0.0000,   -0.9239,   0.312500,  1.000000,  0.299830,  0.125000,
-      0.723854,  -0.3304,   0.5047,    -0.7976,   0.312500,  0.916667,
-      0.375000,  0.000000,  0.649519,  -0.5000,   -0.0000,   -0.8660,
-      0.333333,  0.000000,  0.299830,  -0.125000, 0.723854,  -0.3304,
-      -0.5047,   -0.7976,   0.312500,  0.083333,  0.287013,  0.000000,
-      0.692910,  -0.3827,   -0.0000,   -0.9239,   0.312500,  0.000000,
-      0.391747,  -0.125000, 0.678525,  -0.4316,   -0.5047,   -0.7476,
-      0.333333,  0.083333,  0.334848,  -0.216506, 0.808394,  -0.1882,
-      -0.8707,   -0.4544,   0.312500,  0.166667,  0.299830,  -0.125000,
-      0.723854,  -0.3304,   -0.5047,   -0.7976,   0.312500,  0.083333,
-      0.437500,  -0.216506, 0.757772,  -0.2459,   -0.8707,   -0.4259,
-      0.333333,  0.166667,  0.382684,  -0.250000, 0.923879,  0.0041,
-      -0.9999,   0.0100,    0.312500,  0.250000,  0.334848,  -0.216506,
-      0.808394,  -0.1882,   -0.8707,   -0.4544,   0.312500,  0.166667,
-      0.500000,  -0.250000, 0.866025,  0.0054,    -0.9999,   0.0093,
-      0.333333,  0.250000,  0.430519,  -0.216506, 1.039364,  0.1944,
-      -0.8614,   0.4693,    0.312500,  0.333333,  0.382684,  -0.250000,
-      0.923879,  0.0041,    -0.9999,   0.0100,    0.312500,  0.250000,
-      0.562500,  -0.216506, 0.974279,  0.2540,    -0.8614,   0.4399,
-      0.333333,  0.333333,  0.465537,  -0.125000, 1.123905,  0.3324,
-      -0.4954,   0.8025,    0.312500,  0.416667,  0.430519,  -0.216506,
-      1.039364,  0.1944,    -0.8614,   0.4693,    0.312500,  0.333333,
-      0.465537,  -0.125000, 1.123905,  0.3324,    -0.4954,   0.8025,
-      0.312500,  0.416667,  0.625000,  0.000000,  1.082532,  0.5000,
-      -0.0000,   0.8660,    0.333333,  0.500000,  0.478355,  0.000000,
-      1.154849,  0.3827,    -0.0000,   0.9239,    0.312500,  0.500000,
-      0.625000,  0.000000,  1.082532,  0.5000,    -0.0000,   0.8660,
-      0.333333,  0.500000,  0.740562,  0.125000,  0.965120,  0.5288,
-      0.4954,    0.6892,    0.354167,  0.583333,  0.608253,  0.125000,
-      1.053525,  0.4343,    0.4954,    0.7523,    0.333333,  0.583333,
-      0.740562,  0.125000,  0.965120,  0.5288,    0.4954,    0.6892,
-      0.354167,  0.583333,  0.562500,  0.216506,  0.974279,  0.2540,
-      0.8614,    0.4399,    0.333333,  0.666667,  0.608253,  0.125000,
-      1.053525,  0.4343,    0.4954,    0.7523,    0.333333,  0.583333,
-      0.684856,  0.216506,  0.892523,  0.3092,    0.8614,    0.4030,
-      0.354167,  0.666667,  0.500000,  0.250000,  0.866025,  0.0054,
-      0.9999,    0.0093,    0.333333,  0.750000,  0.562500,  0.216506,
-      0.974279,  0.2540,    0.8614,    0.4399,    0.333333,  0.666667,
-      0.608761,  0.250000,  0.793353,  0.0066,    0.9999,    0.0085,
-      0.354167,  0.750000,  0.437500,  0.216506,  0.757772,  -0.2459,
-      0.8707,    -0.4259,   0.333333,  0.833333,  0.500000,  0.250000,
-      0.866025,  0.0054,    0.9999,    0.0093,    0.333333,  0.750000,
-      0.532666,  0.216506,  0.694184,  -0.2994,   0.8707,    -0.3902,
-      0.354167,  0.833333,  0.391747,  0.125000,  0.678525,  -0.4316,
-      0.5047,    -0.7476,   0.333333,  0.916667,  0.437500,  0.216506,
-      0.757772,  -0.2459,   0.8707,    -0.4259,   0.333333,  0.833333,
-      0.476961,  0.125000,  0.621587,  -0.5255,   0.5047,    -0.6849,
-      0.354167,  0.916667,  0.375000,  0.000000,  0.649519,  -0.5000,
-      -0.0000,   -0.8660,   0.333333,  1.000000,  0.391747,  0.125000,
-      0.678525,  -0.4316,   0.5047,    -0.7476,   0.333333,  0.916667,
-      0.456571,  0.000000,  0.595015,  -0.6088,   -0.0000,   -0.7934,
-      0.354167,  0.000000,  0.391747,  -0.125000, 0.678525,  -0.4316,
-      -0.5047,   -0.7476,   0.333333,  0.083333,  0.375000,  0.000000,
-      0.649519,  -0.5000,   -0.0000,   -0.8660,   0.333333,  0.000000,
-      0.476961,  -0.125000, 0.621587,  -0.5255,   -0.5047,   -0.6849,
-      0.354167,  0.083333,  0.437500,  -0.216506, 0.757772,  -0.2459,
-      -0.8707,   -0.4259,   0.333333,  0.166667,  0.391747,  -0.125000,
-      0.678525,  -0.4316,   -0.5047,   -0.7476,   0.333333,  0.083333,
-      0.532666,  -0.216506, 0.694184,  -0.2994,   -0.8707,   -0.3902,
-      0.354167,  0.166667,  0.500000,  -0.250000, 0.866025,  0.0054,
-      -0.9999,   0.0093,    0.333333,  0.250000,  0.437500,  -0.216506,
-      0.757772,  -0.2459,   -0.8707,   -0.4259,   0.333333,  0.166667,
-      0.608761,  -0.250000, 0.793353,  0.0066,    -0.9999,   0.0086,
-      0.354167,  0.250000,  0.562500,  -0.216506, 0.974279,  0.2540,
-      -0.8614,   0.4399,    0.333333,  0.333333,  0.500000,  -0.250000,
-      0.866025,  0.0054,    -0.9999,   0.0093,    0.333333,  0.250000,
-      0.562500,  -0.216506, 0.974279,  0.2540,    -0.8614,   0.4399,
-      0.333333,  0.333333,  0.740562,  -0.125000, 0.965120,  0.5288,
-      -0.4954,   0.6892,    0.354167,  0.416667,  0.608253,  -0.125000,
-      1.053525,  0.4343,    -0.4954,   0.7523,    0.333333,  0.416667,
-      0.740562,  -0.125000, 0.965120,  0.5288,    -0.4954,   0.6892,
-      0.354167,  0.416667,  0.625000,  0.000000,  1.082532,  0.5000,
-      -0.0000,   0.8660,    0.333333,  0.500000,  0.608253,  -0.125000,
-      1.053525,  0.4343,    -0.4954,   0.7523,    0.333333,  0.416667,
-      0.760952,  0.000000,  0.991692,  0.6088,    -0.0000,   0.7934,
-      0.354167,  0.500000,  0.860199,  0.125000,  0.860200,  0.6142,
-      0.4954,    0.6142,    0.375000,  0.583333,  0.740562,  0.125000,
-      0.965120,  0.5288,    0.4954,    0.6892,    0.354167,  0.583333,
-      0.860199,  0.125000,  0.860200,  0.6142,    0.4954,    0.6142,
-      0.375000,  0.583333,  0.684856,  0.216506,  0.892523,  0.3092,
-      0.8614,    0.4030,    0.354167,  0.666667,  0.740562,  0.125000,
-      0.965120,  0.5288,    0.4954,    0.6892,    0.354167,  0.583333,
-      0.684856,  0.216506,  0.892523,  0.3092,    0.8614,    0.4030,
-      0.354167,  0.666667,  0.707106,  0.250000,  0.707107,  0.0076,
-      0.9999,    0.0076,    0.375000,  0.750000,  0.608761,  0.250000,
-      0.793353,  0.0066,    0.9999,    0.0085,    0.354167,  0.750000,
-      0.608761,  0.250000,  0.793353,  0.0066,    0.9999,    0.0085,
-      0.354167,  0.750000,  0.618718,  0.216506,  0.618719,  -0.3478,
-      0.8707,    -0.3478,   0.375000,  0.833333,  0.532666,  0.216506,
-      0.694184,  -0.2994,   0.8707,    -0.3902,   0.354167,  0.833333,
-      0.532666,  0.216506,  0.694184,  -0.2994,   0.8707,    -0.3902,
-      0.354167,  0.833333,  0.554013,  0.125000,  0.554014,  -0.6104,
-      0.5047,    -0.6104,   0.375000,  0.916667,  0.476961,  0.125000,
-      0.621587,  -0.5255,   0.5047,    -0.6849,   0.354167,  0.916667,
-      0.554013,  0.125000,  0.554014,  -0.6104,   0.5047,    -0.6104,
-      0.375000,  0.916667,  0.456571,  0.000000,  0.595015,  -0.6088,
-      -0.0000,   -0.7934,   0.354167,  1.000000,  0.476961,  0.125000,
-      0.621587,  -0.5255,   0.5047,    -0.6849,   0.354167,  0.916667,
-      0.530330,  0.000000,  0.530330,  -0.7071,   -0.0000,   -0.7071,
-      0.375000,  0.000000,  0.476961,  -0.125000, 0.621587,  -0.5255,
-      -0.5047,   -0.6849,   0.354167,  0.083333,  0.456571,  0.000000,
-      0.595015,  -0.6088,   -0.0000,   -0.7934,   0.354167,  0.000000,
-      0.554013,  -0.125000, 0.554014,  -0.6104,   -0.5047,   -0.6104,
-      0.375000,  0.083333,  0.532666,  -0.216506, 0.694184,  -0.2994,
-      -0.8707,   -0.3902,   0.354167,  0.166667,  0.476961,  -0.125000,
-      0.621587,  -0.5255,   -0.5047,   -0.6849,   0.354167,  0.083333,
-      0.618718,  -0.216506, 0.618719,  -0.3478,   -0.8707,   -0.3478,
-      0.375000,  0.166667,  0.608761,  -0.250000, 0.793353,  0.0066,
-      -0.9999,   0.0086,    0.354167,  0.250000,  0.532666,  -0.216506,
-      0.694184,  -0.2994,   -0.8707,   -0.3902,   0.354167,  0.166667,
-      0.707106,  -0.250000, 0.707107,  0.0076,    -0.9999,   0.0076,
-      0.375000,  0.250000,  0.684856,  -0.216506, 0.892523,  0.3092,
-      -0.8614,   0.4030,    0.354167,  0.333333,  0.608761,  -0.250000,
-      0.793353,  0.0066,    -0.9999,   0.0086,    0.354167,  0.250000,
-      0.684856,  -0.216506, 0.892523,  0.3092,    -0.8614,   0.4030,
-      0.354167,  0.333333,  0.860199,  -0.125000, 0.860200,  0.6142,
-      -0.4954,   0.6142,    0.375000,  0.416667,  0.740562,  -0.125000,
-      0.965120,  0.5288,    -0.4954,   0.6892,    0.354167,  0.416667,
-      0.860199,  -0.125000, 0.860200,  0.6142,    -0.4954,   0.6142,
-      0.375000,  0.416667,  0.760952,  0.000000,  0.991692,  0.6088,
-      -0.0000,   0.7934,    0.354167,  0.500000,  0.740562,  -0.125000,
-      0.965120,  0.5288,    -0.4954,   0.6892,    0.354167,  0.416667,
-      0.883883,  0.000000,  0.883884,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.965119,  0.125000,  0.740562,  0.6892,
-      0.4954,    0.5288,    0.395833,  0.583333,  0.860199,  0.125000,
-      0.860200,  0.6142,    0.4954,    0.6142,    0.375000,  0.583333,
-      0.965119,  0.125000,  0.740562,  0.6892,    0.4954,    0.5288,
-      0.395833,  0.583333,  0.795495,  0.216506,  0.795496,  0.3592,
-      0.8614,    0.3592,    0.375000,  0.666667,  0.860199,  0.125000,
-      0.860200,  0.6142,    0.4954,    0.6142,    0.375000,  0.583333,
-      0.795495,  0.216506,  0.795496,  0.3592,    0.8614,    0.3592,
-      0.375000,  0.666667,  0.793353,  0.250000,  0.608761,  0.0086,
-      0.9999,    0.0066,    0.395833,  0.750000,  0.707106,  0.250000,
-      0.707107,  0.0076,    0.9999,    0.0076,    0.375000,  0.750000,
-      0.793353,  0.250000,  0.608761,  0.0086,    0.9999,    0.0066,
-      0.395833,  0.750000,  0.618718,  0.216506,  0.618719,  -0.3478,
-      0.8707,    -0.3478,   0.375000,  0.833333,  0.707106,  0.250000,
-      0.707107,  0.0076,    0.9999,    0.0076,    0.375000,  0.750000,
-      0.694184,  0.216506,  0.532666,  -0.3902,   0.8707,    -0.2994,
-      0.395833,  0.833333,  0.554013,  0.125000,  0.554014,  -0.6104,
-      0.5047,    -0.6104,   0.375000,  0.916667,  0.618718,  0.216506,
-      0.618719,  -0.3478,   0.8707,    -0.3478,   0.375000,  0.833333,
-      0.621587,  0.125000,  0.476961,  -0.6849,   0.5047,    -0.5255,
-      0.395833,  0.916667,  0.530330,  0.000000,  0.530330,  -0.7071,
-      -0.0000,   -0.7071,   0.375000,  1.000000,  0.554013,  0.125000,
-      0.554014,  -0.6104,   0.5047,    -0.6104,   0.375000,  0.916667,
-      0.595015,  0.000000,  0.456571,  -0.7934,   -0.0000,   -0.6088,
-      0.395833,  0.000000,  0.554013,  -0.125000, 0.554014,  -0.6104,
-      -0.5047,   -0.6104,   0.375000,  0.083333,  0.530330,  0.000000,
-      0.530330,  -0.7071,   -0.0000,   -0.7071,   0.375000,  0.000000,
-      0.554013,  -0.125000, 0.554014,  -0.6104,   -0.5047,   -0.6104,
-      0.375000,  0.083333,  0.694184,  -0.216506, 0.532666,  -0.3902,
-      -0.8707,   -0.2994,   0.395833,  0.166667,  0.618718,  -0.216506,
-      0.618719,  -0.3478,   -0.8707,   -0.3478,   0.375000,  0.166667,
-      0.618718,  -0.216506, 0.618719,  -0.3478,   -0.8707,   -0.3478,
-      0.375000,  0.166667,  0.793353,  -0.250000, 0.608761,  0.0085,
-      -0.9999,   0.0066,    0.395833,  0.250000,  0.707106,  -0.250000,
-      0.707107,  0.0076,    -0.9999,   0.0076,    0.375000,  0.250000,
-      0.793353,  -0.250000, 0.608761,  0.0085,    -0.9999,   0.0066,
-      0.395833,  0.250000,  0.795495,  -0.216506, 0.795496,  0.3592,
-      -0.8614,   0.3592,    0.375000,  0.333333,  0.707106,  -0.250000,
-      0.707107,  0.0076,    -0.9999,   0.0076,    0.375000,  0.250000,
-      0.892523,  -0.216506, 0.684856,  0.4030,    -0.8614,   0.3093,
-      0.395833,  0.333333,  0.860199,  -0.125000, 0.860200,  0.6142,
-      -0.4954,   0.6142,    0.375000,  0.416667,  0.795495,  -0.216506,
-      0.795496,  0.3592,    -0.8614,   0.3592,    0.375000,  0.333333,
-      0.965119,  -0.125000, 0.740562,  0.6892,    -0.4954,   0.5288,
-      0.395833,  0.416667,  0.883883,  0.000000,  0.883884,  0.7071,
-      -0.0000,   0.7071,    0.375000,  0.500000,  0.860199,  -0.125000,
-      0.860200,  0.6142,    -0.4954,   0.6142,    0.375000,  0.416667,
-      1.082532,  0.000000,  0.625000,  0.8660,    -0.0000,   0.5000,
-      0.416667,  0.500000,  0.965119,  0.125000,  0.740562,  0.6892,
-      0.4954,    0.5288,    0.395833,  0.583333,  0.991692,  0.000000,
-      0.760952,  0.7934,    -0.0000,   0.6088,    0.395833,  0.500000,
-      1.053525,  0.125000,  0.608253,  0.7523,    0.4954,    0.4343,
-      0.416667,  0.583333,  0.892523,  0.216506,  0.684856,  0.4030,
-      0.8614,    0.3092,    0.395833,  0.666667,  0.965119,  0.125000,
-      0.740562,  0.6892,    0.4954,    0.5288,    0.395833,  0.583333,
-      0.974279,  0.216506,  0.562500,  0.4399,    0.8614,    0.2540,
-      0.416667,  0.666667,  0.793353,  0.250000,  0.608761,  0.0086,
-      0.9999,    0.0066,    0.395833,  0.750000,  0.892523,  0.216506,
-      0.684856,  0.4030,    0.8614,    0.3092,    0.395833,  0.666667,
-      0.866025,  0.250000,  0.500000,  0.0093,    0.9999,    0.0054,
-      0.416667,  0.750000,  0.694184,  0.216506,  0.532666,  -0.3902,
-      0.8707,    -0.2994,   0.395833,  0.833333,  0.793353,  0.250000,
-      0.608761,  0.0086,    0.9999,    0.0066,    0.395833,  0.750000,
-      0.757772,  0.216506,  0.437500,  -0.4259,   0.8707,    -0.2459,
-      0.416667,  0.833333,  0.621587,  0.125000,  0.476961,  -0.6849,
-      0.5047,    -0.5255,   0.395833,  0.916667,  0.694184,  0.216506,
-      0.532666,  -0.3902,   0.8707,    -0.2994,   0.395833,  0.833333,
-      0.678525,  0.125000,  0.391747,  -0.7476,   0.5047,    -0.4316,
-      0.416667,  0.916667,  0.595015,  0.000000,  0.456571,  -0.7934,
-      -0.0000,   -0.6088,   0.395833,  1.000000,  0.621587,  0.125000,
-      0.476961,  -0.6849,   0.5047,    -0.5255,   0.395833,  0.916667,
-      0.649519,  0.000000,  0.375000,  -0.8660,   -0.0000,   -0.5000,
-      0.416667,  0.000000,  0.621587,  -0.125000, 0.476961,  -0.6849,
-      -0.5047,   -0.5255,   0.395833,  0.083333,  0.595015,  0.000000,
-      0.456571,  -0.7934,   -0.0000,   -0.6088,   0.395833,  0.000000,
-      0.621587,  -0.125000, 0.476961,  -0.6849,   -0.5047,   -0.5255,
-      0.395833,  0.083333,  0.757772,  -0.216506, 0.437500,  -0.4259,
-      -0.8707,   -0.2459,   0.416667,  0.166667,  0.694184,  -0.216506,
-      0.532666,  -0.3902,   -0.8707,   -0.2994,   0.395833,  0.166667,
-      0.757772,  -0.216506, 0.437500,  -0.4259,   -0.8707,   -0.2459,
-      0.416667,  0.166667,  0.793353,  -0.250000, 0.608761,  0.0085,
-      -0.9999,   0.0066,    0.395833,  0.250000,  0.694184,  -0.216506,
-      0.532666,  -0.3902,   -0.8707,   -0.2994,   0.395833,  0.166667,
-      0.866025,  -0.250000, 0.500000,  0.0093,    -0.9999,   0.0054,
-      0.416667,  0.250000,  0.892523,  -0.216506, 0.684856,  0.4030,
-      -0.8614,   0.3093,    0.395833,  0.333333,  0.793353,  -0.250000,
-      0.608761,  0.0085,    -0.9999,   0.0066,    0.395833,  0.250000,
-      0.892523,  -0.216506, 0.684856,  0.4030,    -0.8614,   0.3093,
-      0.395833,  0.333333,  1.053525,  -0.125000, 0.608253,  0.7523,
-      -0.4954,   0.4343,    0.416667,  0.416667,  0.965119,  -0.125000,
-      0.740562,  0.6892,    -0.4954,   0.5288,    0.395833,  0.416667,
-      1.053525,  -0.125000, 0.608253,  0.7523,    -0.4954,   0.4343,
-      0.416667,  0.416667,  0.991692,  0.000000,  0.760952,  0.7934,
-      -0.0000,   0.6088,    0.395833,  0.500000,  0.965119,  -0.125000,
-      0.740562,  0.6892,    -0.4954,   0.5288,    0.395833,  0.416667,
-      1.154849,  0.000000,  0.478355,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  1.053525,  0.125000,  0.608253,  0.7523,
-      0.4954,    0.4343,    0.416667,  0.583333,  1.082532,  0.000000,
-      0.625000,  0.8660,    -0.0000,   0.5000,    0.416667,  0.500000,
-      1.123905,  0.125000,  0.465537,  0.8025,    0.4954,    0.3324,
-      0.437500,  0.583333,  0.974279,  0.216506,  0.562500,  0.4399,
-      0.8614,    0.2540,    0.416667,  0.666667,  1.053525,  0.125000,
-      0.608253,  0.7523,    0.4954,    0.4343,    0.416667,  0.583333,
-      0.974279,  0.216506,  0.562500,  0.4399,    0.8614,    0.2540,
-      0.416667,  0.666667,  0.923879,  0.250000,  0.382684,  0.0100,
-      0.9999,    0.0041,    0.437500,  0.750000,  0.866025,  0.250000,
-      0.500000,  0.0093,    0.9999,    0.0054,    0.416667,  0.750000,
-      0.923879,  0.250000,  0.382684,  0.0100,    0.9999,    0.0041,
-      0.437500,  0.750000,  0.757772,  0.216506,  0.437500,  -0.4259,
-      0.8707,    -0.2459,   0.416667,  0.833333,  0.866025,  0.250000,
-      0.500000,  0.0093,    0.9999,    0.0054,    0.416667,  0.750000,
-      0.808394,  0.216506,  0.334848,  -0.4544,   0.8707,    -0.1882,
-      0.437500,  0.833333,  0.678525,  0.125000,  0.391747,  -0.7476,
-      0.5047,    -0.4316,   0.416667,  0.916667,  0.757772,  0.216506,
-      0.437500,  -0.4259,   0.8707,    -0.2459,   0.416667,  0.833333,
-      0.723854,  0.125000,  0.299830,  -0.7976,   0.5047,    -0.3304,
-      0.437500,  0.916667,  0.649519,  0.000000,  0.375000,  -0.8660,
-      -0.0000,   -0.5000,   0.416667,  1.000000,  0.678525,  0.125000,
-      0.391747,  -0.7476,   0.5047,    -0.4316,   0.416667,  0.916667,
-      0.692910,  0.000000,  0.287013,  -0.9239,   -0.0000,   -0.3827,
-      0.437500,  0.000000,  0.678525,  -0.125000, 0.391747,  -0.7476,
-      -0.5047,   -0.4316,   0.416667,  0.083333,  0.649519,  0.000000,
-      0.375000,  -0.8660,   -0.0000,   -0.5000,   0.416667,  0.000000,
-      0.723854,  -0.125000, 0.299830,  -0.7976,   -0.5047,   -0.3304,
-      0.437500,  0.083333,  0.757772,  -0.216506, 0.437500,  -0.4259,
-      -0.8707,   -0.2459,   0.416667,  0.166667,  0.678525,  -0.125000,
-      0.391747,  -0.7476,   -0.5047,   -0.4316,   0.416667,  0.083333,
-      0.808394,  -0.216506, 0.334848,  -0.4544,   -0.8707,   -0.1882,
-      0.437500,  0.166667,  0.866025,  -0.250000, 0.500000,  0.0093,
-      -0.9999,   0.0054,    0.416667,  0.250000,  0.757772,  -0.216506,
-      0.437500,  -0.4259,   -0.8707,   -0.2459,   0.416667,  0.166667,
-      0.923879,  -0.250000, 0.382684,  0.0100,    -0.9999,   0.0041,
-      0.437500,  0.250000,  0.974279,  -0.216506, 0.562500,  0.4399,
-      -0.8614,   0.2540,    0.416667,  0.333333,  0.866025,  -0.250000,
-      0.500000,  0.0093,    -0.9999,   0.0054,    0.416667,  0.250000,
-      1.039364,  -0.216506, 0.430519,  0.4693,    -0.8614,   0.1944,
-      0.437500,  0.333333,  1.053525,  -0.125000, 0.608253,  0.7523,
-      -0.4954,   0.4343,    0.416667,  0.416667,  0.974279,  -0.216506,
-      0.562500,  0.4399,    -0.8614,   0.2540,    0.416667,  0.333333,
-      1.123905,  -0.125000, 0.465537,  0.8025,    -0.4954,   0.3324,
-      0.437500,  0.416667,  1.082532,  0.000000,  0.625000,  0.8660,
-      -0.0000,   0.5000,    0.416667,  0.500000,  1.053525,  -0.125000,
-      0.608253,  0.7523,    -0.4954,   0.4343,    0.416667,  0.416667,
-      1.207407,  0.000000,  0.323523,  0.9659,    -0.0000,   0.2588,
-      0.458333,  0.500000,  1.123905,  0.125000,  0.465537,  0.8025,
-      0.4954,    0.3324,    0.437500,  0.583333,  1.154849,  0.000000,
-      0.478355,  0.9239,    -0.0000,   0.3827,    0.437500,  0.500000,
-      1.175055,  0.125000,  0.314855,  0.8391,    0.4954,    0.2248,
-      0.458333,  0.583333,  1.039364,  0.216506,  0.430519,  0.4693,
-      0.8614,    0.1944,    0.437500,  0.666667,  1.123905,  0.125000,
-      0.465537,  0.8025,    0.4954,    0.3324,    0.437500,  0.583333,
-      1.086667,  0.216506,  0.291171,  0.4907,    0.8614,    0.1315,
-      0.458333,  0.666667,  0.923879,  0.250000,  0.382684,  0.0100,
-      0.9999,    0.0041,    0.437500,  0.750000,  1.039364,  0.216506,
-      0.430519,  0.4693,    0.8614,    0.1944,    0.437500,  0.666667,
-      0.965926,  0.250000,  0.258819,  0.0104,    0.9999,    0.0028,
-      0.458333,  0.750000,  0.808394,  0.216506,  0.334848,  -0.4544,
-      0.8707,    -0.1882,   0.437500,  0.833333,  0.923879,  0.250000,
-      0.382684,  0.0100,    0.9999,    0.0041,    0.437500,  0.750000,
-      0.845185,  0.216506,  0.226466,  -0.4751,   0.8707,    -0.1273,
-      0.458333,  0.833333,  0.723854,  0.125000,  0.299830,  -0.7976,
-      0.5047,    -0.3304,   0.437500,  0.916667,  0.808394,  0.216506,
-      0.334848,  -0.4544,   0.8707,    -0.1882,   0.437500,  0.833333,
-      0.756797,  0.125000,  0.202783,  -0.8339,   0.5047,    -0.2234,
-      0.458333,  0.916667,  0.692910,  0.000000,  0.287013,  -0.9239,
-      -0.0000,   -0.3827,   0.437500,  1.000000,  0.723854,  0.125000,
-      0.299830,  -0.7976,   0.5047,    -0.3304,   0.437500,  0.916667,
-      0.724444,  0.000000,  0.194114,  -0.9659,   -0.0000,   -0.2588,
-      0.458333,  0.000000,  0.723854,  -0.125000, 0.299830,  -0.7976,
-      -0.5047,   -0.3304,   0.437500,  0.083333,  0.692910,  0.000000,
-      0.287013,  -0.9239,   -0.0000,   -0.3827,   0.437500,  0.000000,
-      0.723854,  -0.125000, 0.299830,  -0.7976,   -0.5047,   -0.3304,
-      0.437500,  0.083333,  0.845185,  -0.216506, 0.226466,  -0.4751,
-      -0.8707,   -0.1273,   0.458333,  0.166667,  0.808394,  -0.216506,
-      0.334848,  -0.4544,   -0.8707,   -0.1882,   0.437500,  0.166667,
-      0.845185,  -0.216506, 0.226466,  -0.4751,   -0.8707,   -0.1273,
-      0.458333,  0.166667,  0.923879,  -0.250000, 0.382684,  0.0100,
-      -0.9999,   0.0041,    0.437500,  0.250000,  0.808394,  -0.216506,
-      0.334848,  -0.4544,   -0.8707,   -0.1882,   0.437500,  0.166667,
-      0.965926,  -0.250000, 0.258819,  0.0104,    -0.9999,   0.0028,
-      0.458333,  0.250000,  1.039364,  -0.216506, 0.430519,  0.4693,
-      -0.8614,   0.1944,    0.437500,  0.333333,  0.923879,  -0.250000,
-      0.382684,  0.0100,    -0.9999,   0.0041,    0.437500,  0.250000,
-      1.086667,  -0.216506, 0.291171,  0.4907,    -0.8614,   0.1315,
-      0.458333,  0.333333,  1.123905,  -0.125000, 0.465537,  0.8025,
-      -0.4954,   0.3324,    0.437500,  0.416667,  1.039364,  -0.216506,
-      0.430519,  0.4693,    -0.8614,   0.1944,    0.437500,  0.333333,
-      1.175055,  -0.125000, 0.314855,  0.8391,    -0.4954,   0.2248,
-      0.458333,  0.416667,  1.154849,  0.000000,  0.478355,  0.9239,
-      -0.0000,   0.3827,    0.437500,  0.500000,  1.123905,  -0.125000,
-      0.465537,  0.8025,    -0.4954,   0.3324,    0.437500,  0.416667,
-      1.207407,  0.000000,  0.323523,  0.9659,    -0.0000,   0.2588,
-      0.458333,  0.500000,  1.206099,  0.125000,  0.158786,  0.8612,
-      0.4954,    0.1134,    0.479167,  0.583333,  1.175055,  0.125000,
-      0.314855,  0.8391,    0.4954,    0.2248,    0.458333,  0.583333,
-      1.175055,  0.125000,  0.314855,  0.8391,    0.4954,    0.2248,
-      0.458333,  0.583333,  1.115376,  0.216506,  0.146842,  0.5037,
-      0.8614,    0.0663,    0.479167,  0.666667,  1.086667,  0.216506,
-      0.291171,  0.4907,    0.8614,    0.1315,    0.458333,  0.666667,
-      1.086667,  0.216506,  0.291171,  0.4907,    0.8614,    0.1315,
-      0.458333,  0.666667,  0.991445,  0.250000,  0.130526,  0.0107,
-      0.9999,    0.0014,    0.479167,  0.750000,  0.965926,  0.250000,
-      0.258819,  0.0104,    0.9999,    0.0028,    0.458333,  0.750000,
-      0.991445,  0.250000,  0.130526,  0.0107,    0.9999,    0.0014,
-      0.479167,  0.750000,  0.845185,  0.216506,  0.226466,  -0.4751,
-      0.8707,    -0.1273,   0.458333,  0.833333,  0.965926,  0.250000,
-      0.258819,  0.0104,    0.9999,    0.0028,    0.458333,  0.750000,
-      0.867514,  0.216506,  0.114210,  -0.4876,   0.8707,    -0.0642,
-      0.479167,  0.833333,  0.756797,  0.125000,  0.202783,  -0.8339,
-      0.5047,    -0.2234,   0.458333,  0.916667,  0.845185,  0.216506,
-      0.226466,  -0.4751,   0.8707,    -0.1273,   0.458333,  0.833333,
-      0.756797,  0.125000,  0.202783,  -0.8339,   0.5047,    -0.2234,
-      0.458333,  0.916667,  0.743584,  0.000000,  0.097895,  -0.9914,
-      -0.0000,   -0.1305,   0.479167,  1.000000,  0.724444,  0.000000,
-      0.194114,  -0.9659,   -0.0000,   -0.2588,   0.458333,  1.000000,
-      0.743584,  0.000000,  0.097895,  -0.9914,   -0.0000,   -0.1305,
-      0.479167,  0.000000,  0.756797,  -0.125000, 0.202783,  -0.8339,
-      -0.5047,   -0.2234,   0.458333,  0.083333,  0.724444,  0.000000,
-      0.194114,  -0.9659,   -0.0000,   -0.2588,   0.458333,  0.000000,
-      0.776791,  -0.125000, 0.102266,  -0.8559,   -0.5047,   -0.1127,
-      0.479167,  0.083333,  0.845185,  -0.216506, 0.226466,  -0.4751,
-      -0.8707,   -0.1273,   0.458333,  0.166667,  0.756797,  -0.125000,
-      0.202783,  -0.8339,   -0.5047,   -0.2234,   0.458333,  0.083333,
-      0.845185,  -0.216506, 0.226466,  -0.4751,   -0.8707,   -0.1273,
-      0.458333,  0.166667,  0.991445,  -0.250000, 0.130526,  0.0107,
-      -0.9999,   0.0014,    0.479167,  0.250000,  0.965926,  -0.250000,
-      0.258819,  0.0104,    -0.9999,   0.0028,    0.458333,  0.250000,
-      0.991445,  -0.250000, 0.130526,  0.0107,    -0.9999,   0.0014,
-      0.479167,  0.250000,  1.086667,  -0.216506, 0.291171,  0.4907,
-      -0.8614,   0.1315,    0.458333,  0.333333,  0.965926,  -0.250000,
-      0.258819,  0.0104,    -0.9999,   0.0028,    0.458333,  0.250000,
-      1.115376,  -0.216506, 0.146842,  0.5037,    -0.8614,   0.0663,
-      0.479167,  0.333333,  1.175055,  -0.125000, 0.314855,  0.8391,
-      -0.4954,   0.2248,    0.458333,  0.416667,  1.086667,  -0.216506,
-      0.291171,  0.4907,    -0.8614,   0.1315,    0.458333,  0.333333,
-      1.206099,  -0.125000, 0.158786,  0.8612,    -0.4954,   0.1134,
-      0.479167,  0.416667,  1.207407,  0.000000,  0.323523,  0.9659,
-      -0.0000,   0.2588,    0.458333,  0.500000,  1.175055,  -0.125000,
-      0.314855,  0.8391,    -0.4954,   0.2248,    0.458333,  0.416667,
-      1.250000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  1.206099,  0.125000,  0.158786,  0.8612,
-      0.4954,    0.1134,    0.479167,  0.583333,  1.239306,  0.000000,
-      0.163158,  0.9914,    -0.0000,   0.1305,    0.479167,  0.500000,
-      1.216506,  0.125000,  0.000000,  0.8687,    0.4954,    -0.0000,
-      0.500000,  0.583333,  1.115376,  0.216506,  0.146842,  0.5037,
-      0.8614,    0.0663,    0.479167,  0.666667,  1.206099,  0.125000,
-      0.158786,  0.8612,    0.4954,    0.1134,    0.479167,  0.583333,
-      1.125000,  0.216506,  0.000000,  0.5080,    0.8614,    -0.0000,
-      0.500000,  0.666667,  0.991445,  0.250000,  0.130526,  0.0107,
-      0.9999,    0.0014,    0.479167,  0.750000,  1.115376,  0.216506,
-      0.146842,  0.5037,    0.8614,    0.0663,    0.479167,  0.666667,
-      1.000000,  0.250000,  0.000000,  0.0108,    0.9999,    -0.0000,
-      0.500000,  0.750000,  0.867514,  0.216506,  0.114210,  -0.4876,
-      0.8707,    -0.0642,   0.479167,  0.833333,  0.991445,  0.250000,
-      0.130526,  0.0107,    0.9999,    0.0014,    0.479167,  0.750000,
-      0.875000,  0.216506,  0.000000,  -0.4918,   0.8707,    -0.0000,
-      0.500000,  0.833333,  0.776791,  0.125000,  0.102266,  -0.8559,
-      0.5047,    -0.1127,   0.479167,  0.916667,  0.867514,  0.216506,
-      0.114210,  -0.4876,   0.8707,    -0.0642,   0.479167,  0.833333,
-      0.783494,  0.125000,  0.000000,  -0.8633,   0.5047,    -0.0000,
-      0.500000,  0.916667,  0.743584,  0.000000,  0.097895,  -0.9914,
-      -0.0000,   -0.1305,   0.479167,  1.000000,  0.776791,  0.125000,
-      0.102266,  -0.8559,   0.5047,    -0.1127,   0.479167,  0.916667,
-      0.743584,  0.000000,  0.097895,  -0.9914,   -0.0000,   -0.1305,
-      0.479167,  0.000000,  0.783494,  -0.125000, 0.000000,  -0.8633,
-      -0.5047,   -0.0000,   0.500000,  0.083333,  0.776791,  -0.125000,
-      0.102266,  -0.8559,   -0.5047,   -0.1127,   0.479167,  0.083333,
-      0.783494,  -0.125000, 0.000000,  -0.8633,   -0.5047,   -0.0000,
-      0.500000,  0.083333,  0.867514,  -0.216506, 0.114210,  -0.4876,
-      -0.8707,   -0.0642,   0.479167,  0.166667,  0.776791,  -0.125000,
-      0.102266,  -0.8559,   -0.5047,   -0.1127,   0.479167,  0.083333,
-      0.875000,  -0.216506, 0.000000,  -0.4918,   -0.8707,   -0.0000,
-      0.500000,  0.166667,  0.991445,  -0.250000, 0.130526,  0.0107,
-      -0.9999,   0.0014,    0.479167,  0.250000,  0.867514,  -0.216506,
-      0.114210,  -0.4876,   -0.8707,   -0.0642,   0.479167,  0.166667,
-      1.000000,  -0.250000, 0.000000,  0.0108,    -0.9999,   -0.0000,
-      0.500000,  0.250000,  1.115376,  -0.216506, 0.146842,  0.5037,
-      -0.8614,   0.0663,    0.479167,  0.333333,  0.991445,  -0.250000,
-      0.130526,  0.0107,    -0.9999,   0.0014,    0.479167,  0.250000,
-      1.115376,  -0.216506, 0.146842,  0.5037,    -0.8614,   0.0663,
-      0.479167,  0.333333,  1.216506,  -0.125000, 0.000000,  0.8687,
-      -0.4954,   -0.0000,   0.500000,  0.416667,  1.206099,  -0.125000,
-      0.158786,  0.8612,    -0.4954,   0.1134,    0.479167,  0.416667,
-      1.206099,  -0.125000, 0.158786,  0.8612,    -0.4954,   0.1134,
-      0.479167,  0.416667,  1.250000,  0.000000,  0.000000,  1.0000,
-      -0.0000,   -0.0000,   0.500000,  0.500000,  1.239306,  0.000000,
-      0.163158,  0.9914,    -0.0000,   0.1305,    0.479167,  0.500000,
-      1.239306,  0.000000,  -0.163158, 0.9914,    -0.0000,   -0.1305,
-      0.520833,  0.500000,  1.206099,  0.125000,  -0.158786, 0.8612,
-      0.4954,    -0.1134,   0.520833,  0.583333,  1.216506,  0.125000,
-      0.000000,  0.8687,    0.4954,    -0.0000,   0.500000,  0.583333,
-      1.216506,  0.125000,  0.000000,  0.8687,    0.4954,    -0.0000,
-      0.500000,  0.583333,  1.206099,  0.125000,  -0.158786, 0.8612,
-      0.4954,    -0.1134,   0.520833,  0.583333,  1.115376,  0.216506,
-      -0.146842, 0.5037,    0.8614,    -0.0663,   0.520833,  0.666667,
-      1.115376,  0.216506,  -0.146842, 0.5037,    0.8614,    -0.0663,
-      0.520833,  0.666667,  0.991445,  0.250000,  -0.130526, 0.0107,
-      0.9999,    -0.0014,   0.520833,  0.750000,  1.000000,  0.250000,
-      0.000000,  0.0108,    0.9999,    -0.0000,   0.500000,  0.750000,
-      0.991445,  0.250000,  -0.130526, 0.0107,    0.9999,    -0.0014,
-      0.520833,  0.750000,  0.867514,  0.216506,  -0.114210, -0.4876,
-      0.8707,    0.0642,    0.520833,  0.833333,  0.875000,  0.216506,
-      0.000000,  -0.4918,   0.8707,    -0.0000,   0.500000,  0.833333,
-      0.867514,  0.216506,  -0.114210, -0.4876,   0.8707,    0.0642,
-      0.520833,  0.833333,  0.776791,  0.125000,  -0.102266, -0.8559,
-      0.5047,    0.1127,    0.520833,  0.916667,  0.783494,  0.125000,
-      0.000000,  -0.8633,   0.5047,    -0.0000,   0.500000,  0.916667,
-      0.783494,  0.125000,  0.000000,  -0.8633,   0.5047,    -0.0000,
-      0.500000,  0.916667,  0.776791,  0.125000,  -0.102266, -0.8559,
-      0.5047,    0.1127,    0.520833,  0.916667,  0.743584,  0.000000,
-      -0.097895, -0.9914,   -0.0000,   0.1305,    0.520833,  1.000000,
-      0.743584,  0.000000,  -0.097895, -0.9914,   -0.0000,   0.1305,
-      0.520833,  0.000000,  0.776791,  -0.125000, -0.102266, -0.8559,
-      -0.5047,   0.1127,    0.520833,  0.083333,  0.783494,  -0.125000,
-      0.000000,  -0.8633,   -0.5047,   -0.0000,   0.500000,  0.083333,
-      0.776791,  -0.125000, -0.102266, -0.8559,   -0.5047,   0.1127,
-      0.520833,  0.083333,  0.867514,  -0.216506, -0.114210, -0.4876,
-      -0.8707,   0.0642,    0.520833,  0.166667,  0.875000,  -0.216506,
-      0.000000,  -0.4918,   -0.8707,   -0.0000,   0.500000,  0.166667,
-      0.867514,  -0.216506, -0.114210, -0.4876,   -0.8707,   0.0642,
-      0.520833,  0.166667,  0.991445,  -0.250000, -0.130526, 0.0107,
-      -0.9999,   -0.0014,   0.520833,  0.250000,  1.000000,  -0.250000,
-      0.000000,  0.0108,    -0.9999,   -0.0000,   0.500000,  0.250000,
-      0.991445,  -0.250000, -0.130526, 0.0107,    -0.9999,   -0.0014,
-      0.520833,  0.250000,  1.115376,  -0.216506, -0.146842, 0.5037,
-      -0.8614,   -0.0663,   0.520833,  0.333333,  1.125000,  -0.216506,
-      0.000000,  0.5080,    -0.8614,   -0.0000,   0.500000,  0.333333,
-      1.115376,  -0.216506, -0.146842, 0.5037,    -0.8614,   -0.0663,
-      0.520833,  0.333333,  1.206099,  -0.125000, -0.158786, 0.8612,
-      -0.4954,   -0.1134,   0.520833,  0.416667,  1.216506,  -0.125000,
-      0.000000,  0.8687,    -0.4954,   -0.0000,   0.500000,  0.416667,
-      1.206099,  -0.125000, -0.158786, 0.8612,    -0.4954,   -0.1134,
-      0.520833,  0.416667,  1.239306,  0.000000,  -0.163158, 0.9914,
-      -0.0000,   -0.1305,   0.520833,  0.500000,  1.250000,  0.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.500000,  0.500000,
-      1.207407,  0.000000,  -0.323524, 0.9659,    -0.0000,   -0.2588,
-      0.541667,  0.500000,  1.175055,  0.125000,  -0.314855, 0.8391,
-      0.4954,    -0.2248,   0.541667,  0.583333,  1.206099,  0.125000,
-      -0.158786, 0.8612,    0.4954,    -0.1134,   0.520833,  0.583333,
-      1.175055,  0.125000,  -0.314855, 0.8391,    0.4954,    -0.2248,
-      0.541667,  0.583333,  1.086667,  0.216506,  -0.291171, 0.4907,
-      0.8614,    -0.1315,   0.541667,  0.666667,  1.115376,  0.216506,
-      -0.146842, 0.5037,    0.8614,    -0.0663,   0.520833,  0.666667,
-      1.086667,  0.216506,  -0.291171, 0.4907,    0.8614,    -0.1315,
-      0.541667,  0.666667,  0.965926,  0.250000,  -0.258819, 0.0104,
-      0.9999,    -0.0028,   0.541667,  0.750000,  0.991445,  0.250000,
-      -0.130526, 0.0107,    0.9999,    -0.0014,   0.520833,  0.750000,
-      0.965926,  0.250000,  -0.258819, 0.0104,    0.9999,    -0.0028,
-      0.541667,  0.750000,  0.845185,  0.216506,  -0.226467, -0.4751,
-      0.8707,    0.1273,    0.541667,  0.833333,  0.867514,  0.216506,
-      -0.114210, -0.4876,   0.8707,    0.0642,    0.520833,  0.833333,
-      0.867514,  0.216506,  -0.114210, -0.4876,   0.8707,    0.0642,
-      0.520833,  0.833333,  0.845185,  0.216506,  -0.226467, -0.4751,
-      0.8707,    0.1273,    0.541667,  0.833333,  0.756797,  0.125000,
-      -0.202783, -0.8339,   0.5047,    0.2234,    0.541667,  0.916667,
-      0.756797,  0.125000,  -0.202783, -0.8339,   0.5047,    0.2234,
-      0.541667,  0.916667,  0.724444,  0.000000,  -0.194114, -0.9659,
-      -0.0000,   0.2588,    0.541667,  1.000000,  0.743584,  0.000000,
-      -0.097895, -0.9914,   -0.0000,   0.1305,    0.520833,  1.000000,
-      0.724444,  0.000000,  -0.194114, -0.9659,   -0.0000,   0.2588,
-      0.541667,  0.000000,  0.756797,  -0.125000, -0.202783, -0.8339,
-      -0.5047,   0.2234,    0.541667,  0.083333,  0.776791,  -0.125000,
-      -0.102266, -0.8559,   -0.5047,   0.1127,    0.520833,  0.083333,
-      0.756797,  -0.125000, -0.202783, -0.8339,   -0.5047,   0.2234,
-      0.541667,  0.083333,  0.845185,  -0.216506, -0.226467, -0.4751,
-      -0.8707,   0.1273,    0.541667,  0.166667,  0.867514,  -0.216506,
-      -0.114210, -0.4876,   -0.8707,   0.0642,    0.520833,  0.166667,
-      0.867514,  -0.216506, -0.114210, -0.4876,   -0.8707,   0.0642,
-      0.520833,  0.166667,  0.845185,  -0.216506, -0.226467, -0.4751,
-      -0.8707,   0.1273,    0.541667,  0.166667,  0.965926,  -0.250000,
-      -0.258819, 0.0104,    -0.9999,   -0.0028,   0.541667,  0.250000,
-      0.991445,  -0.250000, -0.130526, 0.0107,    -0.9999,   -0.0014,
-      0.520833,  0.250000,  0.965926,  -0.250000, -0.258819, 0.0104,
-      -0.9999,   -0.0028,   0.541667,  0.250000,  1.086667,  -0.216506,
-      -0.291171, 0.4907,    -0.8614,   -0.1315,   0.541667,  0.333333,
-      1.115376,  -0.216506, -0.146842, 0.5037,    -0.8614,   -0.0663,
-      0.520833,  0.333333,  1.086667,  -0.216506, -0.291171, 0.4907,
-      -0.8614,   -0.1315,   0.541667,  0.333333,  1.175055,  -0.125000,
-      -0.314855, 0.8391,    -0.4954,   -0.2248,   0.541667,  0.416667,
-      1.175055,  -0.125000, -0.314855, 0.8391,    -0.4954,   -0.2248,
-      0.541667,  0.416667,  1.207407,  0.000000,  -0.323524, 0.9659,
-      -0.0000,   -0.2588,   0.541667,  0.500000,  1.239306,  0.000000,
-      -0.163158, 0.9914,    -0.0000,   -0.1305,   0.520833,  0.500000,
-      1.207407,  0.000000,  -0.323524, 0.9659,    -0.0000,   -0.2588,
-      0.541667,  0.500000,  1.154849,  0.000000,  -0.478354, 0.9239,
-      -0.0000,   -0.3827,   0.562500,  0.500000,  1.123905,  0.125000,
-      -0.465537, 0.8025,    0.4954,    -0.3324,   0.562500,  0.583333,
-      1.123905,  0.125000,  -0.465537, 0.8025,    0.4954,    -0.3324,
-      0.562500,  0.583333,  1.039364,  0.216506,  -0.430519, 0.4693,
-      0.8614,    -0.1944,   0.562500,  0.666667,  1.086667,  0.216506,
-      -0.291171, 0.4907,    0.8614,    -0.1315,   0.541667,  0.666667,
-      1.039364,  0.216506,  -0.430519, 0.4693,    0.8614,    -0.1944,
-      0.562500,  0.666667,  0.923880,  0.250000,  -0.382683, 0.0100,
-      0.9999,    -0.0041,   0.562500,  0.750000,  0.965926,  0.250000,
-      -0.258819, 0.0104,    0.9999,    -0.0028,   0.541667,  0.750000,
-      0.965926,  0.250000,  -0.258819, 0.0104,    0.9999,    -0.0028,
-      0.541667,  0.750000,  0.923880,  0.250000,  -0.382683, 0.0100,
-      0.9999,    -0.0041,   0.562500,  0.750000,  0.808395,  0.216506,
-      -0.334848, -0.4544,   0.8707,    0.1882,    0.562500,  0.833333,
-      0.845185,  0.216506,  -0.226467, -0.4751,   0.8707,    0.1273,
-      0.541667,  0.833333,  0.808395,  0.216506,  -0.334848, -0.4544,
-      0.8707,    0.1882,    0.562500,  0.833333,  0.723854,  0.125000,
-      -0.299830, -0.7976,   0.5047,    0.3304,    0.562500,  0.916667,
-      0.756797,  0.125000,  -0.202783, -0.8339,   0.5047,    0.2234,
-      0.541667,  0.916667,  0.723854,  0.125000,  -0.299830, -0.7976,
-      0.5047,    0.3304,    0.562500,  0.916667,  0.692910,  0.000000,
-      -0.287013, -0.9239,   -0.0000,   0.3827,    0.562500,  1.000000,
-      0.692910,  0.000000,  -0.287013, -0.9239,   -0.0000,   0.3827,
-      0.562500,  0.000000,  0.723854,  -0.125000, -0.299830, -0.7976,
-      -0.5047,   0.3304,    0.562500,  0.083333,  0.756797,  -0.125000,
-      -0.202783, -0.8339,   -0.5047,   0.2234,    0.541667,  0.083333,
-      0.723854,  -0.125000, -0.299830, -0.7976,   -0.5047,   0.3304,
-      0.562500,  0.083333,  0.808395,  -0.216506, -0.334848, -0.4544,
-      -0.8707,   0.1882,    0.562500,  0.166667,  0.845185,  -0.216506,
-      -0.226467, -0.4751,   -0.8707,   0.1273,    0.541667,  0.166667,
-      0.845185,  -0.216506, -0.226467, -0.4751,   -0.8707,   0.1273,
-      0.541667,  0.166667,  0.808395,  -0.216506, -0.334848, -0.4544,
-      -0.8707,   0.1882,    0.562500,  0.166667,  0.923880,  -0.250000,
-      -0.382683, 0.0100,    -0.9999,   -0.0041,   0.562500,  0.250000,
-      0.965926,  -0.250000, -0.258819, 0.0104,    -0.9999,   -0.0028,
-      0.541667,  0.250000,  0.923880,  -0.250000, -0.382683, 0.0100,
-      -0.9999,   -0.0041,   0.562500,  0.250000,  1.039364,  -0.216506,
-      -0.430519, 0.4693,    -0.8614,   -0.1944,   0.562500,  0.333333,
-      1.086667,  -0.216506, -0.291171, 0.4907,    -0.8614,   -0.1315,
-      0.541667,  0.333333,  1.039364,  -0.216506, -0.430519, 0.4693,
-      -0.8614,   -0.1944,   0.562500,  0.333333,  1.123905,  -0.125000,
-      -0.465537, 0.8025,    -0.4954,   -0.3324,   0.562500,  0.416667,
-      1.123905,  -0.125000, -0.465537, 0.8025,    -0.4954,   -0.3324,
-      0.562500,  0.416667,  1.154849,  0.000000,  -0.478354, 0.9239,
-      -0.0000,   -0.3827,   0.562500,  0.500000,  1.207407,  0.000000,
-      -0.323524, 0.9659,    -0.0000,   -0.2588,   0.541667,  0.500000,
-      1.154849,  0.000000,  -0.478354, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  1.082532,  0.000000,  -0.625000, 0.8660,
-      -0.0000,   -0.5000,   0.583333,  0.500000,  1.053525,  0.125000,
-      -0.608253, 0.7523,    0.4954,    -0.4343,   0.583333,  0.583333,
-      1.123905,  0.125000,  -0.465537, 0.8025,    0.4954,    -0.3324,
-      0.562500,  0.583333,  1.053525,  0.125000,  -0.608253, 0.7523,
-      0.4954,    -0.4343,   0.583333,  0.583333,  0.974279,  0.216506,
-      -0.562500, 0.4399,    0.8614,    -0.2540,   0.583333,  0.666667,
-      1.039364,  0.216506,  -0.430519, 0.4693,    0.8614,    -0.1944,
-      0.562500,  0.666667,  0.974279,  0.216506,  -0.562500, 0.4399,
-      0.8614,    -0.2540,   0.583333,  0.666667,  0.866025,  0.250000,
-      -0.500000, 0.0093,    0.9999,    -0.0054,   0.583333,  0.750000,
-      0.866025,  0.250000,  -0.500000, 0.0093,    0.9999,    -0.0054,
-      0.583333,  0.750000,  0.757772,  0.216506,  -0.437500, -0.4259,
-      0.8707,    0.2459,    0.583333,  0.833333,  0.808395,  0.216506,
-      -0.334848, -0.4544,   0.8707,    0.1882,    0.562500,  0.833333,
-      0.808395,  0.216506,  -0.334848, -0.4544,   0.8707,    0.1882,
-      0.562500,  0.833333,  0.757772,  0.216506,  -0.437500, -0.4259,
-      0.8707,    0.2459,    0.583333,  0.833333,  0.678525,  0.125000,
-      -0.391747, -0.7476,   0.5047,    0.4316,    0.583333,  0.916667,
-      0.678525,  0.125000,  -0.391747, -0.7476,   0.5047,    0.4316,
-      0.583333,  0.916667,  0.649519,  0.000000,  -0.375000, -0.8660,
-      -0.0000,   0.5000,    0.583333,  1.000000,  0.692910,  0.000000,
-      -0.287013, -0.9239,   -0.0000,   0.3827,    0.562500,  1.000000,
-      0.649519,  0.000000,  -0.375000, -0.8660,   -0.0000,   0.5000,
-      0.583333,  0.000000,  0.678525,  -0.125000, -0.391747, -0.7476,
-      -0.5047,   0.4316,    0.583333,  0.083333,  0.723854,  -0.125000,
-      -0.299830, -0.7976,   -0.5047,   0.3304,    0.562500,  0.083333,
-      0.678525,  -0.125000, -0.391747, -0.7476,   -0.5047,   0.4316,
-      0.583333,  0.083333,  0.757772,  -0.216506, -0.437500, -0.4259,
-      -0.8707,   0.2459,    0.583333,  0.166667,  0.808395,  -0.216506,
-      -0.334848, -0.4544,   -0.8707,   0.1882,    0.562500,  0.166667,
-      0.808395,  -0.216506, -0.334848, -0.4544,   -0.8707,   0.1882,
-      0.562500,  0.166667,  0.757772,  -0.216506, -0.437500, -0.4259,
-      -0.8707,   0.2459,    0.583333,  0.166667,  0.866025,  -0.250000,
-      -0.500000, 0.0093,    -0.9999,   -0.0054,   0.583333,  0.250000,
-      0.866025,  -0.250000, -0.500000, 0.0093,    -0.9999,   -0.0054,
-      0.583333,  0.250000,  0.974279,  -0.216506, -0.562500, 0.4399,
-      -0.8614,   -0.2540,   0.583333,  0.333333,  1.039364,  -0.216506,
-      -0.430519, 0.4693,    -0.8614,   -0.1944,   0.562500,  0.333333,
-      0.974279,  -0.216506, -0.562500, 0.4399,    -0.8614,   -0.2540,
-      0.583333,  0.333333,  1.053525,  -0.125000, -0.608253, 0.7523,
-      -0.4954,   -0.4343,   0.583333,  0.416667,  1.123905,  -0.125000,
-      -0.465537, 0.8025,    -0.4954,   -0.3324,   0.562500,  0.416667,
-      1.053525,  -0.125000, -0.608253, 0.7523,    -0.4954,   -0.4343,
-      0.583333,  0.416667,  1.082532,  0.000000,  -0.625000, 0.8660,
-      -0.0000,   -0.5000,   0.583333,  0.500000,  1.154849,  0.000000,
-      -0.478354, 0.9239,    -0.0000,   -0.3827,   0.562500,  0.500000,
-      0.991692,  0.000000,  -0.760952, 0.7934,    -0.0000,   -0.6088,
-      0.604167,  0.500000,  0.965119,  0.125000,  -0.740562, 0.6892,
-      0.4954,    -0.5288,   0.604167,  0.583333,  1.053525,  0.125000,
-      -0.608253, 0.7523,    0.4954,    -0.4343,   0.583333,  0.583333,
-      1.053525,  0.125000,  -0.608253, 0.7523,    0.4954,    -0.4343,
-      0.583333,  0.583333,  0.965119,  0.125000,  -0.740562, 0.6892,
-      0.4954,    -0.5288,   0.604167,  0.583333,  0.892523,  0.216506,
-      -0.684856, 0.4030,    0.8614,    -0.3093,   0.604167,  0.666667,
-      0.892523,  0.216506,  -0.684856, 0.4030,    0.8614,    -0.3093,
-      0.604167,  0.666667,  0.793353,  0.250000,  -0.608761, 0.0086,
-      0.9999,    -0.0066,   0.604167,  0.750000,  0.866025,  0.250000,
-      -0.500000, 0.0093,    0.9999,    -0.0054,   0.583333,  0.750000,
-      0.793353,  0.250000,  -0.608761, 0.0086,    0.9999,    -0.0066,
-      0.604167,  0.750000,  0.694184,  0.216506,  -0.532666, -0.3902,
-      0.8707,    0.2994,    0.604167,  0.833333,  0.757772,  0.216506,
-      -0.437500, -0.4259,   0.8707,    0.2459,    0.583333,  0.833333,
-      0.757772,  0.216506,  -0.437500, -0.4259,   0.8707,    0.2459,
-      0.583333,  0.833333,  0.694184,  0.216506,  -0.532666, -0.3902,
-      0.8707,    0.2994,    0.604167,  0.833333,  0.621587,  0.125000,
-      -0.476961, -0.6849,   0.5047,    0.5255,    0.604167,  0.916667,
-      0.621587,  0.125000,  -0.476961, -0.6849,   0.5047,    0.5255,
-      0.604167,  0.916667,  0.595015,  0.000000,  -0.456571, -0.7934,
-      -0.0000,   0.6088,    0.604167,  1.000000,  0.649519,  0.000000,
-      -0.375000, -0.8660,   -0.0000,   0.5000,    0.583333,  1.000000,
-      0.595015,  0.000000,  -0.456571, -0.7934,   -0.0000,   0.6088,
-      0.604167,  0.000000,  0.621587,  -0.125000, -0.476961, -0.6849,
-      -0.5047,   0.5255,    0.604167,  0.083333,  0.678525,  -0.125000,
-      -0.391747, -0.7476,   -0.5047,   0.4316,    0.583333,  0.083333,
-      0.621587,  -0.125000, -0.476961, -0.6849,   -0.5047,   0.5255,
-      0.604167,  0.083333,  0.694184,  -0.216506, -0.532666, -0.3902,
-      -0.8707,   0.2994,    0.604167,  0.166667,  0.757772,  -0.216506,
-      -0.437500, -0.4259,   -0.8707,   0.2459,    0.583333,  0.166667,
-      0.694184,  -0.216506, -0.532666, -0.3902,   -0.8707,   0.2994,
-      0.604167,  0.166667,  0.793353,  -0.250000, -0.608761, 0.0086,
-      -0.9999,   -0.0066,   0.604167,  0.250000,  0.866025,  -0.250000,
-      -0.500000, 0.0093,    -0.9999,   -0.0054,   0.583333,  0.250000,
-      0.793353,  -0.250000, -0.608761, 0.0086,    -0.9999,   -0.0066,
-      0.604167,  0.250000,  0.892523,  -0.216506, -0.684856, 0.4030,
-      -0.8614,   -0.3093,   0.604167,  0.333333,  0.974279,  -0.216506,
-      -0.562500, 0.4399,    -0.8614,   -0.2540,   0.583333,  0.333333,
-      0.892523,  -0.216506, -0.684856, 0.4030,    -0.8614,   -0.3093,
-      0.604167,  0.333333,  0.965119,  -0.125000, -0.740562, 0.6892,
-      -0.4954,   -0.5288,   0.604167,  0.416667,  1.053525,  -0.125000,
-      -0.608253, 0.7523,    -0.4954,   -0.4343,   0.583333,  0.416667,
-      1.053525,  -0.125000, -0.608253, 0.7523,    -0.4954,   -0.4343,
-      0.583333,  0.416667,  0.965119,  -0.125000, -0.740562, 0.6892,
-      -0.4954,   -0.5288,   0.604167,  0.416667,  0.991692,  0.000000,
-      -0.760952, 0.7934,    -0.0000,   -0.6088,   0.604167,  0.500000,
-      0.883883,  0.000000,  -0.883884, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.860200,  0.125000,  -0.860200, 0.6142,
-      0.4954,    -0.6142,   0.625000,  0.583333,  0.965119,  0.125000,
-      -0.740562, 0.6892,    0.4954,    -0.5288,   0.604167,  0.583333,
-      0.860200,  0.125000,  -0.860200, 0.6142,    0.4954,    -0.6142,
-      0.625000,  0.583333,  0.795495,  0.216506,  -0.795495, 0.3592,
-      0.8614,    -0.3592,   0.625000,  0.666667,  0.892523,  0.216506,
-      -0.684856, 0.4030,    0.8614,    -0.3093,   0.604167,  0.666667,
-      0.795495,  0.216506,  -0.795495, 0.3592,    0.8614,    -0.3592,
-      0.625000,  0.666667,  0.707107,  0.250000,  -0.707107, 0.0076,
-      0.9999,    -0.0076,   0.625000,  0.750000,  0.793353,  0.250000,
-      -0.608761, 0.0086,    0.9999,    -0.0066,   0.604167,  0.750000,
-      0.707107,  0.250000,  -0.707107, 0.0076,    0.9999,    -0.0076,
-      0.625000,  0.750000,  0.618718,  0.216506,  -0.618719, -0.3478,
-      0.8707,    0.3478,    0.625000,  0.833333,  0.694184,  0.216506,
-      -0.532666, -0.3902,   0.8707,    0.2994,    0.604167,  0.833333,
-      0.618718,  0.216506,  -0.618719, -0.3478,   0.8707,    0.3478,
-      0.625000,  0.833333,  0.554014,  0.125000,  -0.554014, -0.6104,
-      0.5047,    0.6104,    0.625000,  0.916667,  0.621587,  0.125000,
-      -0.476961, -0.6849,   0.5047,    0.5255,    0.604167,  0.916667,
-      0.554014,  0.125000,  -0.554014, -0.6104,   0.5047,    0.6104,
-      0.625000,  0.916667,  0.530330,  0.000000,  -0.530330, -0.7071,
-      -0.0000,   0.7071,    0.625000,  1.000000,  0.595015,  0.000000,
-      -0.456571, -0.7934,   -0.0000,   0.6088,    0.604167,  1.000000,
-      0.595015,  0.000000,  -0.456571, -0.7934,   -0.0000,   0.6088,
-      0.604167,  0.000000,  0.530330,  0.000000,  -0.530330, -0.7071,
-      -0.0000,   0.7071,    0.625000,  0.000000,  0.554014,  -0.125000,
-      -0.554014, -0.6104,   -0.5047,   0.6104,    0.625000,  0.083333,
-      0.554014,  -0.125000, -0.554014, -0.6104,   -0.5047,   0.6104,
-      0.625000,  0.083333,  0.618718,  -0.216506, -0.618719, -0.3478,
-      -0.8707,   0.3478,    0.625000,  0.166667,  0.694184,  -0.216506,
-      -0.532666, -0.3902,   -0.8707,   0.2994,    0.604167,  0.166667,
-      0.618718,  -0.216506, -0.618719, -0.3478,   -0.8707,   0.3478,
-      0.625000,  0.166667,  0.707107,  -0.250000, -0.707107, 0.0076,
-      -0.9999,   -0.0076,   0.625000,  0.250000,  0.793353,  -0.250000,
-      -0.608761, 0.0086,    -0.9999,   -0.0066,   0.604167,  0.250000,
-      0.707107,  -0.250000, -0.707107, 0.0076,    -0.9999,   -0.0076,
-      0.625000,  0.250000,  0.795495,  -0.216506, -0.795495, 0.3592,
-      -0.8614,   -0.3592,   0.625000,  0.333333,  0.892523,  -0.216506,
-      -0.684856, 0.4030,    -0.8614,   -0.3093,   0.604167,  0.333333,
-      0.892523,  -0.216506, -0.684856, 0.4030,    -0.8614,   -0.3093,
-      0.604167,  0.333333,  0.795495,  -0.216506, -0.795495, 0.3592,
-      -0.8614,   -0.3592,   0.625000,  0.333333,  0.860200,  -0.125000,
-      -0.860200, 0.6142,    -0.4954,   -0.6142,   0.625000,  0.416667,
-      0.860200,  -0.125000, -0.860200, 0.6142,    -0.4954,   -0.6142,
-      0.625000,  0.416667,  0.883883,  0.000000,  -0.883884, 0.7071,
-      -0.0000,   -0.7071,   0.625000,  0.500000,  0.991692,  0.000000,
-      -0.760952, 0.7934,    -0.0000,   -0.6088,   0.604167,  0.500000,
-      0.760952,  0.000000,  -0.991691, 0.6088,    -0.0000,   -0.7934,
-      0.645833,  0.500000,  0.740562,  0.125000,  -0.965119, 0.5288,
-      0.4954,    -0.6892,   0.645833,  0.583333,  0.860200,  0.125000,
-      -0.860200, 0.6142,    0.4954,    -0.6142,   0.625000,  0.583333,
-      0.860200,  0.125000,  -0.860200, 0.6142,    0.4954,    -0.6142,
-      0.625000,  0.583333,  0.740562,  0.125000,  -0.965119, 0.5288,
-      0.4954,    -0.6892,   0.645833,  0.583333,  0.684857,  0.216506,
-      -0.892522, 0.3092,    0.8614,    -0.4030,   0.645833,  0.666667,
-      0.684857,  0.216506,  -0.892522, 0.3092,    0.8614,    -0.4030,
-      0.645833,  0.666667,  0.608762,  0.250000,  -0.793353, 0.0066,
-      0.9999,    -0.0085,   0.645833,  0.750000,  0.707107,  0.250000,
-      -0.707107, 0.0076,    0.9999,    -0.0076,   0.625000,  0.750000,
-      0.608762,  0.250000,  -0.793353, 0.0066,    0.9999,    -0.0085,
-      0.645833,  0.750000,  0.532666,  0.216506,  -0.694184, -0.2994,
-      0.8707,    0.3902,    0.645833,  0.833333,  0.618718,  0.216506,
-      -0.618719, -0.3478,   0.8707,    0.3478,    0.625000,  0.833333,
-      0.618718,  0.216506,  -0.618719, -0.3478,   0.8707,    0.3478,
-      0.625000,  0.833333,  0.532666,  0.216506,  -0.694184, -0.2994,
-      0.8707,    0.3902,    0.645833,  0.833333,  0.476961,  0.125000,
-      -0.621587, -0.5255,   0.5047,    0.6849,    0.645833,  0.916667,
-      0.476961,  0.125000,  -0.621587, -0.5255,   0.5047,    0.6849,
-      0.645833,  0.916667,  0.456571,  0.000000,  -0.595015, -0.6088,
-      -0.0000,   0.7934,    0.645833,  1.000000,  0.530330,  0.000000,
-      -0.530330, -0.7071,   -0.0000,   0.7071,    0.625000,  1.000000,
-      0.456571,  0.000000,  -0.595015, -0.6088,   -0.0000,   0.7934,
-      0.645833,  0.000000,  0.476961,  -0.125000, -0.621587, -0.5255,
-      -0.5047,   0.6849,    0.645833,  0.083333,  0.554014,  -0.125000,
-      -0.554014, -0.6104,   -0.5047,   0.6104,    0.625000,  0.083333,
-      0.476961,  -0.125000, -0.621587, -0.5255,   -0.5047,   0.6849,
-      0.645833,  0.083333,  0.532666,  -0.216506, -0.694184, -0.2994,
-      -0.8707,   0.3902,    0.645833,  0.166667,  0.618718,  -0.216506,
-      -0.618719, -0.3478,   -0.8707,   0.3478,    0.625000,  0.166667,
-      0.618718,  -0.216506, -0.618719, -0.3478,   -0.8707,   0.3478,
-      0.625000,  0.166667,  0.532666,  -0.216506, -0.694184, -0.2994,
-      -0.8707,   0.3902,    0.645833,  0.166667,  0.608762,  -0.250000,
-      -0.793353, 0.0066,    -0.9999,   -0.0085,   0.645833,  0.250000,
-      0.707107,  -0.250000, -0.707107, 0.0076,    -0.9999,   -0.0076,
-      0.625000,  0.250000,  0.608762,  -0.250000, -0.793353, 0.0066,
-      -0.9999,   -0.0085,   0.645833,  0.250000,  0.684857,  -0.216506,
-      -0.892522, 0.3092,    -0.8614,   -0.4030,   0.645833,  0.333333,
-      0.684857,  -0.216506, -0.892522, 0.3092,    -0.8614,   -0.4030,
-      0.645833,  0.333333,  0.740562,  -0.125000, -0.965119, 0.5288,
-      -0.4954,   -0.6892,   0.645833,  0.416667,  0.860200,  -0.125000,
-      -0.860200, 0.6142,    -0.4954,   -0.6142,   0.625000,  0.416667,
-      0.740562,  -0.125000, -0.965119, 0.5288,    -0.4954,   -0.6892,
-      0.645833,  0.416667,  0.760952,  0.000000,  -0.991691, 0.6088,
-      -0.0000,   -0.7934,   0.645833,  0.500000,  0.883883,  0.000000,
-      -0.883884, 0.7071,    -0.0000,   -0.7071,   0.625000,  0.500000,
-      0.625000,  0.000000,  -1.082532, 0.5000,    -0.0000,   -0.8660,
-      0.666667,  0.500000,  0.608253,  0.125000,  -1.053525, 0.4343,
-      0.4954,    -0.7523,   0.666667,  0.583333,  0.740562,  0.125000,
-      -0.965119, 0.5288,    0.4954,    -0.6892,   0.645833,  0.583333,
-      0.740562,  0.125000,  -0.965119, 0.5288,    0.4954,    -0.6892,
-      0.645833,  0.583333,  0.608253,  0.125000,  -1.053525, 0.4343,
-      0.4954,    -0.7523,   0.666667,  0.583333,  0.562500,  0.216506,
-      -0.974279, 0.2540,    0.8614,    -0.4399,   0.666667,  0.666667,
-      0.684857,  0.216506,  -0.892522, 0.3092,    0.8614,    -0.4030,
-      0.645833,  0.666667,  0.562500,  0.216506,  -0.974279, 0.2540,
-      0.8614,    -0.4399,   0.666667,  0.666667,  0.500000,  0.250000,
-      -0.866025, 0.0054,    0.9999,    -0.0093,   0.666667,  0.750000,
-      0.500000,  0.250000,  -0.866025, 0.0054,    0.9999,    -0.0093,
-      0.666667,  0.750000,  0.437500,  0.216506,  -0.757772, -0.2459,
-      0.8707,    0.4259,    0.666667,  0.833333,  0.532666,  0.216506,
-      -0.694184, -0.2994,   0.8707,    0.3902,    0.645833,  0.833333,
-      0.532666,  0.216506,  -0.694184, -0.2994,   0.8707,    0.3902,
-      0.645833,  0.833333,  0.437500,  0.216506,  -0.757772, -0.2459,
-      0.8707,    0.4259,    0.666667,  0.833333,  0.391747,  0.125000,
-      -0.678525, -0.4316,   0.5047,    0.7476,    0.666667,  0.916667,
-      0.391747,  0.125000,  -0.678525, -0.4316,   0.5047,    0.7476,
-      0.666667,  0.916667,  0.375000,  0.000000,  -0.649519, -0.5000,
-      -0.0000,   0.8660,    0.666667,  1.000000,  0.456571,  0.000000,
-      -0.595015, -0.6088,   -0.0000,   0.7934,    0.645833,  1.000000,
-      0.375000,  0.000000,  -0.649519, -0.5000,   -0.0000,   0.8660,
-      0.666667,  0.000000,  0.391747,  -0.125000, -0.678525, -0.4316,
-      -0.5047,   0.7476,    0.666667,  0.083333,  0.476961,  -0.125000,
-      -0.621587, -0.5255,   -0.5047,   0.6849,    0.645833,  0.083333,
-      0.391747,  -0.125000, -0.678525, -0.4316,   -0.5047,   0.7476,
-      0.666667,  0.083333,  0.437500,  -0.216506, -0.757772, -0.2459,
-      -0.8707,   0.4259,    0.666667,  0.166667,  0.532666,  -0.216506,
-      -0.694184, -0.2994,   -0.8707,   0.3902,    0.645833,  0.166667,
-      0.437500,  -0.216506, -0.757772, -0.2459,   -0.8707,   0.4259,
-      0.666667,  0.166667,  0.500000,  -0.250000, -0.866025, 0.0054,
-      -0.9999,   -0.0093,   0.666667,  0.250000,  0.608762,  -0.250000,
-      -0.793353, 0.0066,    -0.9999,   -0.0085,   0.645833,  0.250000,
-      0.500000,  -0.250000, -0.866025, 0.0054,    -0.9999,   -0.0093,
-      0.666667,  0.250000,  0.562500,  -0.216506, -0.974279, 0.2540,
-      -0.8614,   -0.4399,   0.666667,  0.333333,  0.684857,  -0.216506,
-      -0.892522, 0.3092,    -0.8614,   -0.4030,   0.645833,  0.333333,
-      0.562500,  -0.216506, -0.974279, 0.2540,    -0.8614,   -0.4399,
-      0.666667,  0.333333,  0.608253,  -0.125000, -1.053525, 0.4343,
-      -0.4954,   -0.7523,   0.666667,  0.416667,  0.740562,  -0.125000,
-      -0.965119, 0.5288,    -0.4954,   -0.6892,   0.645833,  0.416667,
-      0.608253,  -0.125000, -1.053525, 0.4343,    -0.4954,   -0.7523,
-      0.666667,  0.416667,  0.625000,  0.000000,  -1.082532, 0.5000,
-      -0.0000,   -0.8660,   0.666667,  0.500000,  0.760952,  0.000000,
-      -0.991691, 0.6088,    -0.0000,   -0.7934,   0.645833,  0.500000,
-      0.625000,  0.000000,  -1.082532, 0.5000,    -0.0000,   -0.8660,
-      0.666667,  0.500000,  0.478355,  0.000000,  -1.154849, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.465537,  0.125000,
-      -1.123905, 0.3324,    0.4954,    -0.8025,   0.687500,  0.583333,
-      0.465537,  0.125000,  -1.123905, 0.3324,    0.4954,    -0.8025,
-      0.687500,  0.583333,  0.430519,  0.216506,  -1.039364, 0.1944,
-      0.8614,    -0.4693,   0.687500,  0.666667,  0.562500,  0.216506,
-      -0.974279, 0.2540,    0.8614,    -0.4399,   0.666667,  0.666667,
-      0.430519,  0.216506,  -1.039364, 0.1944,    0.8614,    -0.4693,
-      0.687500,  0.666667,  0.382684,  0.250000,  -0.923879, 0.0041,
-      0.9999,    -0.0100,   0.687500,  0.750000,  0.500000,  0.250000,
-      -0.866025, 0.0054,    0.9999,    -0.0093,   0.666667,  0.750000,
-      0.382684,  0.250000,  -0.923879, 0.0041,    0.9999,    -0.0100,
-      0.687500,  0.750000,  0.334848,  0.216506,  -0.808394, -0.1882,
-      0.8707,    0.4544,    0.687500,  0.833333,  0.437500,  0.216506,
-      -0.757772, -0.2459,   0.8707,    0.4259,    0.666667,  0.833333,
-      0.334848,  0.216506,  -0.808394, -0.1882,   0.8707,    0.4544,
-      0.687500,  0.833333,  0.299830,  0.125000,  -0.723854, -0.3304,
-      0.5047,    0.7976,    0.687500,  0.916667,  0.391747,  0.125000,
-      -0.678525, -0.4316,   0.5047,    0.7476,    0.666667,  0.916667,
-      0.299830,  0.125000,  -0.723854, -0.3304,   0.5047,    0.7976,
-      0.687500,  0.916667,  0.287013,  0.000000,  -0.692910, -0.3827,
-      -0.0000,   0.9239,    0.687500,  1.000000,  0.375000,  0.000000,
-      -0.649519, -0.5000,   -0.0000,   0.8660,    0.666667,  1.000000,
-      0.287013,  0.000000,  -0.692910, -0.3827,   -0.0000,   0.9239,
-      0.687500,  0.000000,  0.299830,  -0.125000, -0.723854, -0.3304,
-      -0.5047,   0.7976,    0.687500,  0.083333,  0.391747,  -0.125000,
-      -0.678525, -0.4316,   -0.5047,   0.7476,    0.666667,  0.083333,
-      0.299830,  -0.125000, -0.723854, -0.3304,   -0.5047,   0.7976,
-      0.687500,  0.083333,  0.334848,  -0.216506, -0.808394, -0.1882,
-      -0.8707,   0.4544,    0.687500,  0.166667,  0.437500,  -0.216506,
-      -0.757772, -0.2459,   -0.8707,   0.4259,    0.666667,  0.166667,
-      0.437500,  -0.216506, -0.757772, -0.2459,   -0.8707,   0.4259,
-      0.666667,  0.166667,  0.334848,  -0.216506, -0.808394, -0.1882,
-      -0.8707,   0.4544,    0.687500,  0.166667,  0.382684,  -0.250000,
-      -0.923879, 0.0041,    -0.9999,   -0.0100,   0.687500,  0.250000,
-      0.500000,  -0.250000, -0.866025, 0.0054,    -0.9999,   -0.0093,
-      0.666667,  0.250000,  0.382684,  -0.250000, -0.923879, 0.0041,
-      -0.9999,   -0.0100,   0.687500,  0.250000,  0.430519,  -0.216506,
-      -1.039364, 0.1944,    -0.8614,   -0.4693,   0.687500,  0.333333,
-      0.430519,  -0.216506, -1.039364, 0.1944,    -0.8614,   -0.4693,
-      0.687500,  0.333333,  0.465537,  -0.125000, -1.123905, 0.3324,
-      -0.4954,   -0.8025,   0.687500,  0.416667,  0.608253,  -0.125000,
-      -1.053525, 0.4343,    -0.4954,   -0.7523,   0.666667,  0.416667,
-      0.465537,  -0.125000, -1.123905, 0.3324,    -0.4954,   -0.8025,
-      0.687500,  0.416667,  0.478355,  0.000000,  -1.154849, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.625000,  0.000000,
-      -1.082532, 0.5000,    -0.0000,   -0.8660,   0.666667,  0.500000,
-      0.323524,  0.000000,  -1.207407, 0.2588,    -0.0000,   -0.9659,
-      0.708333,  0.500000,  0.314855,  0.125000,  -1.175055, 0.2248,
-      0.4954,    -0.8391,   0.708333,  0.583333,  0.465537,  0.125000,
-      -1.123905, 0.3324,    0.4954,    -0.8025,   0.687500,  0.583333,
-      0.314855,  0.125000,  -1.175055, 0.2248,    0.4954,    -0.8391,
-      0.708333,  0.583333,  0.291171,  0.216506,  -1.086667, 0.1315,
-      0.8614,    -0.4907,   0.708333,  0.666667,  0.430519,  0.216506,
-      -1.039364, 0.1944,    0.8614,    -0.4693,   0.687500,  0.666667,
-      0.291171,  0.216506,  -1.086667, 0.1315,    0.8614,    -0.4907,
-      0.708333,  0.666667,  0.258819,  0.250000,  -0.965926, 0.0028,
-      0.9999,    -0.0104,   0.708333,  0.750000,  0.382684,  0.250000,
-      -0.923879, 0.0041,    0.9999,    -0.0100,   0.687500,  0.750000,
-      0.258819,  0.250000,  -0.965926, 0.0028,    0.9999,    -0.0104,
-      0.708333,  0.750000,  0.226467,  0.216506,  -0.845185, -0.1273,
-      0.8707,    0.4751,    0.708333,  0.833333,  0.334848,  0.216506,
-      -0.808394, -0.1882,   0.8707,    0.4544,    0.687500,  0.833333,
-      0.334848,  0.216506,  -0.808394, -0.1882,   0.8707,    0.4544,
-      0.687500,  0.833333,  0.226467,  0.216506,  -0.845185, -0.1273,
-      0.8707,    0.4751,    0.708333,  0.833333,  0.202783,  0.125000,
-      -0.756797, -0.2234,   0.5047,    0.8339,    0.708333,  0.916667,
-      0.202783,  0.125000,  -0.756797, -0.2234,   0.5047,    0.8339,
-      0.708333,  0.916667,  0.194114,  0.000000,  -0.724444, -0.2588,
-      -0.0000,   0.9659,    0.708333,  1.000000,  0.287013,  0.000000,
-      -0.692910, -0.3827,   -0.0000,   0.9239,    0.687500,  1.000000,
-      0.194114,  0.000000,  -0.724444, -0.2588,   -0.0000,   0.9659,
-      0.708333,  0.000000,  0.202783,  -0.125000, -0.756797, -0.2234,
-      -0.5047,   0.8339,    0.708333,  0.083333,  0.299830,  -0.125000,
-      -0.723854, -0.3304,   -0.5047,   0.7976,    0.687500,  0.083333,
-      0.202783,  -0.125000, -0.756797, -0.2234,   -0.5047,   0.8339,
-      0.708333,  0.083333,  0.226467,  -0.216506, -0.845185, -0.1273,
-      -0.8707,   0.4751,    0.708333,  0.166667,  0.334848,  -0.216506,
-      -0.808394, -0.1882,   -0.8707,   0.4544,    0.687500,  0.166667,
-      0.226467,  -0.216506, -0.845185, -0.1273,   -0.8707,   0.4751,
-      0.708333,  0.166667,  0.258819,  -0.250000, -0.965926, 0.0028,
-      -0.9999,   -0.0104,   0.708333,  0.250000,  0.382684,  -0.250000,
-      -0.923879, 0.0041,    -0.9999,   -0.0100,   0.687500,  0.250000,
-      0.258819,  -0.250000, -0.965926, 0.0028,    -0.9999,   -0.0104,
-      0.708333,  0.250000,  0.291171,  -0.216506, -1.086667, 0.1315,
-      -0.8614,   -0.4907,   0.708333,  0.333333,  0.430519,  -0.216506,
-      -1.039364, 0.1944,    -0.8614,   -0.4693,   0.687500,  0.333333,
-      0.291171,  -0.216506, -1.086667, 0.1315,    -0.8614,   -0.4907,
-      0.708333,  0.333333,  0.314855,  -0.125000, -1.175055, 0.2248,
-      -0.4954,   -0.8391,   0.708333,  0.416667,  0.465537,  -0.125000,
-      -1.123905, 0.3324,    -0.4954,   -0.8025,   0.687500,  0.416667,
-      0.314855,  -0.125000, -1.175055, 0.2248,    -0.4954,   -0.8391,
-      0.708333,  0.416667,  0.323524,  0.000000,  -1.207407, 0.2588,
-      -0.0000,   -0.9659,   0.708333,  0.500000,  0.478355,  0.000000,
-      -1.154849, 0.3827,    -0.0000,   -0.9239,   0.687500,  0.500000,
-      0.163158,  0.000000,  -1.239306, 0.1305,    -0.0000,   -0.9914,
-      0.729167,  0.500000,  0.158786,  0.125000,  -1.206099, 0.1134,
-      0.4954,    -0.8612,   0.729167,  0.583333,  0.314855,  0.125000,
-      -1.175055, 0.2248,    0.4954,    -0.8391,   0.708333,  0.583333,
-      0.158786,  0.125000,  -1.206099, 0.1134,    0.4954,    -0.8612,
-      0.729167,  0.583333,  0.146842,  0.216506,  -1.115376, 0.0663,
-      0.8614,    -0.5037,   0.729167,  0.666667,  0.291171,  0.216506,
-      -1.086667, 0.1315,    0.8614,    -0.4907,   0.708333,  0.666667,
-      0.291171,  0.216506,  -1.086667, 0.1315,    0.8614,    -0.4907,
-      0.708333,  0.666667,  0.146842,  0.216506,  -1.115376, 0.0663,
-      0.8614,    -0.5037,   0.729167,  0.666667,  0.130526,  0.250000,
-      -0.991445, 0.0014,    0.9999,    -0.0107,   0.729167,  0.750000,
-      0.130526,  0.250000,  -0.991445, 0.0014,    0.9999,    -0.0107,
-      0.729167,  0.750000,  0.114210,  0.216506,  -0.867514, -0.0642,
-      0.8707,    0.4876,    0.729167,  0.833333,  0.226467,  0.216506,
-      -0.845185, -0.1273,   0.8707,    0.4751,    0.708333,  0.833333,
-      0.114210,  0.216506,  -0.867514, -0.0642,   0.8707,    0.4876,
-      0.729167,  0.833333,  0.102266,  0.125000,  -0.776791, -0.1127,
-      0.5047,    0.8559,    0.729167,  0.916667,  0.202783,  0.125000,
-      -0.756797, -0.2234,   0.5047,    0.8339,    0.708333,  0.916667,
-      0.102266,  0.125000,  -0.776791, -0.1127,   0.5047,    0.8559,
-      0.729167,  0.916667,  0.097895,  0.000000,  -0.743584, -0.1305,
-      -0.0000,   0.9914,    0.729167,  1.000000,  0.194114,  0.000000,
-      -0.724444, -0.2588,   -0.0000,   0.9659,    0.708333,  1.000000,
-      0.194114,  0.000000,  -0.724444, -0.2588,   -0.0000,   0.9659,
-      0.708333,  0.000000,  0.097895,  0.000000,  -0.743584, -0.1305,
-      -0.0000,   0.9914,    0.729167,  0.000000,  0.102266,  -0.125000,
-      -0.776791, -0.1127,   -0.5047,   0.8559,    0.729167,  0.083333,
-      0.102266,  -0.125000, -0.776791, -0.1127,   -0.5047,   0.8559,
-      0.729167,  0.083333,  0.114210,  -0.216506, -0.867514, -0.0642,
-      -0.8707,   0.4876,    0.729167,  0.166667,  0.226467,  -0.216506,
-      -0.845185, -0.1273,   -0.8707,   0.4751,    0.708333,  0.166667,
-      0.226467,  -0.216506, -0.845185, -0.1273,   -0.8707,   0.4751,
-      0.708333,  0.166667,  0.114210,  -0.216506, -0.867514, -0.0642,
-      -0.8707,   0.4876,    0.729167,  0.166667,  0.130526,  -0.250000,
-      -0.991445, 0.0014,    -0.9999,   -0.0107,   0.729167,  0.250000,
-      0.130526,  -0.250000, -0.991445, 0.0014,    -0.9999,   -0.0107,
-      0.729167,  0.250000,  0.146842,  -0.216506, -1.115376, 0.0663,
-      -0.8614,   -0.5037,   0.729167,  0.333333,  0.291171,  -0.216506,
-      -1.086667, 0.1315,    -0.8614,   -0.4907,   0.708333,  0.333333,
-      0.146842,  -0.216506, -1.115376, 0.0663,    -0.8614,   -0.5037,
-      0.729167,  0.333333,  0.158786,  -0.125000, -1.206099, 0.1134,
-      -0.4954,   -0.8612,   0.729167,  0.416667,  0.314855,  -0.125000,
-      -1.175055, 0.2248,    -0.4954,   -0.8391,   0.708333,  0.416667,
-      0.158786,  -0.125000, -1.206099, 0.1134,    -0.4954,   -0.8612,
-      0.729167,  0.416667,  0.163158,  0.000000,  -1.239306, 0.1305,
-      -0.0000,   -0.9914,   0.729167,  0.500000,  0.323524,  0.000000,
-      -1.207407, 0.2588,    -0.0000,   -0.9659,   0.708333,  0.500000,
-      0.000000,  0.000000,  -1.250000, -0.0000,   -0.0000,   -1.0000,
-      0.750000,  0.500000,  0.000000,  0.125000,  -1.216506, -0.0000,
-      0.4954,    -0.8687,   0.750000,  0.583333,  0.158786,  0.125000,
-      -1.206099, 0.1134,    0.4954,    -0.8612,   0.729167,  0.583333,
-      0.000000,  0.125000,  -1.216506, -0.0000,   0.4954,    -0.8687,
-      0.750000,  0.583333,  0.000000,  0.216506,  -1.125000, -0.0000,
-      0.8614,    -0.5080,   0.750000,  0.666667,  0.146842,  0.216506,
-      -1.115376, 0.0663,    0.8614,    -0.5037,   0.729167,  0.666667,
-      0.000000,  0.216506,  -1.125000, -0.0000,   0.8614,    -0.5080,
-      0.750000,  0.666667,  0.000000,  0.250000,  -1.000000, -0.0000,
-      0.9999,    -0.0108,   0.750000,  0.750000,  0.130526,  0.250000,
-      -0.991445, 0.0014,    0.9999,    -0.0107,   0.729167,  0.750000,
-      0.130526,  0.250000,  -0.991445, 0.0014,    0.9999,    -0.0107,
-      0.729167,  0.750000,  0.000000,  0.250000,  -1.000000, -0.0000,
-      0.9999,    -0.0108,   0.750000,  0.750000,  0.000000,  0.216506,
-      -0.875000, -0.0000,   0.8707,    0.4918,    0.750000,  0.833333,
-      0.114210,  0.216506,  -0.867514, -0.0642,   0.8707,    0.4876,
-      0.729167,  0.833333,  0.000000,  0.216506,  -0.875000, -0.0000,
-      0.8707,    0.4918,    0.750000,  0.833333,  0.000000,  0.125000,
-      -0.783494, -0.0000,   0.5047,    0.8633,    0.750000,  0.916667,
-      0.000000,  0.125000,  -0.783494, -0.0000,   0.5047,    0.8633,
-      0.750000,  0.916667,  0.000000,  0.000000,  -0.750000, -0.0000,
-      -0.0000,   1.0000,    0.750000,  1.000000,  0.097895,  0.000000,
-      -0.743584, -0.1305,   -0.0000,   0.9914,    0.729167,  1.000000,
-      0.000000,  0.000000,  -0.750000, -0.0000,   -0.0000,   1.0000,
-      0.750000,  0.000000,  0.000000,  -0.125000, -0.783494, -0.0000,
-      -0.5047,   0.8633,    0.750000,  0.083333,  0.102266,  -0.125000,
-      -0.776791, -0.1127,   -0.5047,   0.8559,    0.729167,  0.083333,
-      0.000000,  -0.125000, -0.783494, -0.0000,   -0.5047,   0.8633,
-      0.750000,  0.083333,  0.000000,  -0.216506, -0.875000, -0.0000,
-      -0.8707,   0.4918,    0.750000,  0.166667,  0.114210,  -0.216506,
-      -0.867514, -0.0642,   -0.8707,   0.4876,    0.729167,  0.166667,
-      0.000000,  -0.216506, -0.875000, -0.0000,   -0.8707,   0.4918,
-      0.750000,  0.166667,  0.000000,  -0.250000, -1.000000, -0.0000,
-      -0.9999,   -0.0108,   0.750000,  0.250000,  0.130526,  -0.250000,
-      -0.991445, 0.0014,    -0.9999,   -0.0107,   0.729167,  0.250000,
-      0.000000,  -0.250000, -1.000000, -0.0000,   -0.9999,   -0.0108,
-      0.750000,  0.250000,  0.000000,  -0.216506, -1.125000, -0.0000,
-      -0.8614,   -0.5080,   0.750000,  0.333333,  0.146842,  -0.216506,
-      -1.115376, 0.0663,    -0.8614,   -0.5037,   0.729167,  0.333333,
-      0.000000,  -0.216506, -1.125000, -0.0000,   -0.8614,   -0.5080,
-      0.750000,  0.333333,  0.000000,  -0.125000, -1.216506, -0.0000,
-      -0.4954,   -0.8687,   0.750000,  0.416667,  0.158786,  -0.125000,
-      -1.206099, 0.1134,    -0.4954,   -0.8612,   0.729167,  0.416667,
-      0.158786,  -0.125000, -1.206099, 0.1134,    -0.4954,   -0.8612,
-      0.729167,  0.416667,  0.000000,  -0.125000, -1.216506, -0.0000,
-      -0.4954,   -0.8687,   0.750000,  0.416667,  0.000000,  0.000000,
-      -1.250000, -0.0000,   -0.0000,   -1.0000,   0.750000,  0.500000,
-      -0.163158, 0.000000,  -1.239306, -0.1305,   -0.0000,   -0.9914,
-      0.770833,  0.500000,  -0.158786, 0.125000,  -1.206099, -0.1134,
-      0.4954,    -0.8612,   0.770833,  0.583333,  0.000000,  0.125000,
-      -1.216506, -0.0000,   0.4954,    -0.8687,   0.750000,  0.583333,
-      -0.158786, 0.125000,  -1.206099, -0.1134,   0.4954,    -0.8612,
-      0.770833,  0.583333,  -0.146842, 0.216506,  -1.115375, -0.0663,
-      0.8614,    -0.5036,   0.770833,  0.666667,  0.000000,  0.216506,
-      -1.125000, -0.0000,   0.8614,    -0.5080,   0.750000,  0.666667,
-      -0.146842, 0.216506,  -1.115375, -0.0663,   0.8614,    -0.5036,
-      0.770833,  0.666667,  -0.130526, 0.250000,  -0.991445, -0.0014,
-      0.9999,    -0.0107,   0.770833,  0.750000,  0.000000,  0.250000,
-      -1.000000, -0.0000,   0.9999,    -0.0108,   0.750000,  0.750000,
-      -0.130526, 0.250000,  -0.991445, -0.0014,   0.9999,    -0.0107,
-      0.770833,  0.750000,  -0.114211, 0.216506,  -0.867514, 0.0642,
-      0.8707,    0.4876,    0.770833,  0.833333,  0.000000,  0.216506,
-      -0.875000, -0.0000,   0.8707,    0.4918,    0.750000,  0.833333,
-      -0.114211, 0.216506,  -0.867514, 0.0642,    0.8707,    0.4876,
-      0.770833,  0.833333,  -0.102267, 0.125000,  -0.776791, 0.1127,
-      0.5047,    0.8559,    0.770833,  0.916667,  0.000000,  0.125000,
-      -0.783494, -0.0000,   0.5047,    0.8633,    0.750000,  0.916667,
-      -0.102267, 0.125000,  -0.776791, 0.1127,    0.5047,    0.8559,
-      0.770833,  0.916667,  -0.097895, 0.000000,  -0.743584, 0.1305,
-      -0.0000,   0.9914,    0.770833,  1.000000,  0.000000,  0.000000,
-      -0.750000, -0.0000,   -0.0000,   1.0000,    0.750000,  1.000000,
-      0.000000,  0.000000,  -0.750000, -0.0000,   -0.0000,   1.0000,
-      0.750000,  0.000000,  -0.097895, 0.000000,  -0.743584, 0.1305,
-      -0.0000,   0.9914,    0.770833,  0.000000,  -0.102267, -0.125000,
-      -0.776791, 0.1127,    -0.5047,   0.8559,    0.770833,  0.083333,
-      -0.102267, -0.125000, -0.776791, 0.1127,    -0.5047,   0.8559,
-      0.770833,  0.083333,  -0.114211, -0.216506, -0.867514, 0.0642,
-      -0.8707,   0.4876,    0.770833,  0.166667,  0.000000,  -0.216506,
-      -0.875000, -0.0000,   -0.8707,   0.4918,    0.750000,  0.166667,
-      0.000000,  -0.216506, -0.875000, -0.0000,   -0.8707,   0.4918,
-      0.750000,  0.166667,  -0.114211, -0.216506, -0.867514, 0.0642,
-      -0.8707,   0.4876,    0.770833,  0.166667,  -0.130526, -0.250000,
-      -0.991445, -0.0014,   -0.9999,   -0.0107,   0.770833,  0.250000,
-      0.000000,  -0.250000, -1.000000, -0.0000,   -0.9999,   -0.0108,
-      0.750000,  0.250000,  -0.130526, -0.250000, -0.991445, -0.0014,
-      -0.9999,   -0.0107,   0.770833,  0.250000,  -0.146842, -0.216506,
-      -1.115375, -0.0663,   -0.8614,   -0.5036,   0.770833,  0.333333,
-      0.000000,  -0.216506, -1.125000, -0.0000,   -0.8614,   -0.5080,
-      0.750000,  0.333333,  -0.146842, -0.216506, -1.115375, -0.0663,
-      -0.8614,   -0.5036,   0.770833,  0.333333,  -0.158786, -0.125000,
-      -1.206099, -0.1134,   -0.4954,   -0.8612,   0.770833,  0.416667,
-      0.000000,  -0.125000, -1.216506, -0.0000,   -0.4954,   -0.8687,
-      0.750000,  0.416667,  -0.158786, -0.125000, -1.206099, -0.1134,
-      -0.4954,   -0.8612,   0.770833,  0.416667,  -0.163158, 0.000000,
-      -1.239306, -0.1305,   -0.0000,   -0.9914,   0.770833,  0.500000,
-      -0.323524, 0.000000,  -1.207407, -0.2588,   -0.0000,   -0.9659,
-      0.791667,  0.500000,  -0.314855, 0.125000,  -1.175055, -0.2248,
-      0.4954,    -0.8391,   0.791667,  0.583333,  -0.158786, 0.125000,
-      -1.206099, -0.1134,   0.4954,    -0.8612,   0.770833,  0.583333,
-      -0.158786, 0.125000,  -1.206099, -0.1134,   0.4954,    -0.8612,
-      0.770833,  0.583333,  -0.314855, 0.125000,  -1.175055, -0.2248,
-      0.4954,    -0.8391,   0.791667,  0.583333,  -0.291171, 0.216506,
-      -1.086667, -0.1315,   0.8614,    -0.4907,   0.791667,  0.666667,
-      -0.146842, 0.216506,  -1.115375, -0.0663,   0.8614,    -0.5036,
-      0.770833,  0.666667,  -0.291171, 0.216506,  -1.086667, -0.1315,
-      0.8614,    -0.4907,   0.791667,  0.666667,  -0.258819, 0.250000,
-      -0.965926, -0.0028,   0.9999,    -0.0104,   0.791667,  0.750000,
-      -0.258819, 0.250000,  -0.965926, -0.0028,   0.9999,    -0.0104,
-      0.791667,  0.750000,  -0.226467, 0.216506,  -0.845185, 0.1273,
-      0.8707,    0.4751,    0.791667,  0.833333,  -0.114211, 0.216506,
-      -0.867514, 0.0642,    0.8707,    0.4876,    0.770833,  0.833333,
-      -0.226467, 0.216506,  -0.845185, 0.1273,    0.8707,    0.4751,
-      0.791667,  0.833333,  -0.202783, 0.125000,  -0.756797, 0.2234,
-      0.5047,    0.8339,    0.791667,  0.916667,  -0.102267, 0.125000,
-      -0.776791, 0.1127,    0.5047,    0.8559,    0.770833,  0.916667,
-      -0.202783, 0.125000,  -0.756797, 0.2234,    0.5047,    0.8339,
-      0.791667,  0.916667,  -0.194114, 0.000000,  -0.724444, 0.2588,
-      -0.0000,   0.9659,    0.791667,  1.000000,  -0.097895, 0.000000,
-      -0.743584, 0.1305,    -0.0000,   0.9914,    0.770833,  1.000000,
-      -0.194114, 0.000000,  -0.724444, 0.2588,    -0.0000,   0.9659,
-      0.791667,  0.000000,  -0.202783, -0.125000, -0.756797, 0.2234,
-      -0.5047,   0.8339,    0.791667,  0.083333,  -0.102267, -0.125000,
-      -0.776791, 0.1127,    -0.5047,   0.8559,    0.770833,  0.083333,
-      -0.202783, -0.125000, -0.756797, 0.2234,    -0.5047,   0.8339,
-      0.791667,  0.083333,  -0.226467, -0.216506, -0.845185, 0.1273,
-      -0.8707,   0.4751,    0.791667,  0.166667,  -0.114211, -0.216506,
-      -0.867514, 0.0642,    -0.8707,   0.4876,    0.770833,  0.166667,
-      -0.226467, -0.216506, -0.845185, 0.1273,    -0.8707,   0.4751,
-      0.791667,  0.166667,  -0.258819, -0.250000, -0.965926, -0.0028,
-      -0.9999,   -0.0104,   0.791667,  0.250000,  -0.130526, -0.250000,
-      -0.991445, -0.0014,   -0.9999,   -0.0107,   0.770833,  0.250000,
-      -0.258819, -0.250000, -0.965926, -0.0028,   -0.9999,   -0.0104,
-      0.791667,  0.250000,  -0.291171, -0.216506, -1.086667, -0.1315,
-      -0.8614,   -0.4907,   0.791667,  0.333333,  -0.146842, -0.216506,
-      -1.115375, -0.0663,   -0.8614,   -0.5036,   0.770833,  0.333333,
-      -0.291171, -0.216506, -1.086667, -0.1315,   -0.8614,   -0.4907,
-      0.791667,  0.333333,  -0.314855, -0.125000, -1.175055, -0.2248,
-      -0.4954,   -0.8391,   0.791667,  0.416667,  -0.158786, -0.125000,
-      -1.206099, -0.1134,   -0.4954,   -0.8612,   0.770833,  0.416667,
-      -0.314855, -0.125000, -1.175055, -0.2248,   -0.4954,   -0.8391,
-      0.791667,  0.416667,  -0.323524, 0.000000,  -1.207407, -0.2588,
-      -0.0000,   -0.9659,   0.791667,  0.500000,  -0.163158, 0.000000,
-      -1.239306, -0.1305,   -0.0000,   -0.9914,   0.770833,  0.500000,
-      -0.478354, 0.000000,  -1.154849, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.465537, 0.125000,  -1.123905, -0.3324,
-      0.4954,    -0.8025,   0.812500,  0.583333,  -0.314855, 0.125000,
-      -1.175055, -0.2248,   0.4954,    -0.8391,   0.791667,  0.583333,
-      -0.465537, 0.125000,  -1.123905, -0.3324,   0.4954,    -0.8025,
-      0.812500,  0.583333,  -0.430519, 0.216506,  -1.039364, -0.1944,
-      0.8614,    -0.4693,   0.812500,  0.666667,  -0.291171, 0.216506,
-      -1.086667, -0.1315,   0.8614,    -0.4907,   0.791667,  0.666667,
-      -0.430519, 0.216506,  -1.039364, -0.1944,   0.8614,    -0.4693,
-      0.812500,  0.666667,  -0.382684, 0.250000,  -0.923880, -0.0041,
-      0.9999,    -0.0100,   0.812500,  0.750000,  -0.258819, 0.250000,
-      -0.965926, -0.0028,   0.9999,    -0.0104,   0.791667,  0.750000,
-      -0.258819, 0.250000,  -0.965926, -0.0028,   0.9999,    -0.0104,
-      0.791667,  0.750000,  -0.382684, 0.250000,  -0.923880, -0.0041,
-      0.9999,    -0.0100,   0.812500,  0.750000,  -0.334848, 0.216506,
-      -0.808395, 0.1882,    0.8707,    0.4544,    0.812500,  0.833333,
-      -0.334848, 0.216506,  -0.808395, 0.1882,    0.8707,    0.4544,
-      0.812500,  0.833333,  -0.299830, 0.125000,  -0.723854, 0.3304,
-      0.5047,    0.7976,    0.812500,  0.916667,  -0.202783, 0.125000,
-      -0.756797, 0.2234,    0.5047,    0.8339,    0.791667,  0.916667,
-      -0.299830, 0.125000,  -0.723854, 0.3304,    0.5047,    0.7976,
-      0.812500,  0.916667,  -0.287013, 0.000000,  -0.692910, 0.3827,
-      -0.0000,   0.9239,    0.812500,  1.000000,  -0.194114, 0.000000,
-      -0.724444, 0.2588,    -0.0000,   0.9659,    0.791667,  1.000000,
-      -0.287013, 0.000000,  -0.692910, 0.3827,    -0.0000,   0.9239,
-      0.812500,  0.000000,  -0.299830, -0.125000, -0.723854, 0.3304,
-      -0.5047,   0.7976,    0.812500,  0.083333,  -0.202783, -0.125000,
-      -0.756797, 0.2234,    -0.5047,   0.8339,    0.791667,  0.083333,
-      -0.299830, -0.125000, -0.723854, 0.3304,    -0.5047,   0.7976,
-      0.812500,  0.083333,  -0.334848, -0.216506, -0.808395, 0.1882,
-      -0.8707,   0.4544,    0.812500,  0.166667,  -0.226467, -0.216506,
-      -0.845185, 0.1273,    -0.8707,   0.4751,    0.791667,  0.166667,
-      -0.226467, -0.216506, -0.845185, 0.1273,    -0.8707,   0.4751,
-      0.791667,  0.166667,  -0.334848, -0.216506, -0.808395, 0.1882,
-      -0.8707,   0.4544,    0.812500,  0.166667,  -0.382684, -0.250000,
-      -0.923880, -0.0041,   -0.9999,   -0.0100,   0.812500,  0.250000,
-      -0.382684, -0.250000, -0.923880, -0.0041,   -0.9999,   -0.0100,
-      0.812500,  0.250000,  -0.430519, -0.216506, -1.039364, -0.1944,
-      -0.8614,   -0.4693,   0.812500,  0.333333,  -0.291171, -0.216506,
-      -1.086667, -0.1315,   -0.8614,   -0.4907,   0.791667,  0.333333,
-      -0.291171, -0.216506, -1.086667, -0.1315,   -0.8614,   -0.4907,
-      0.791667,  0.333333,  -0.430519, -0.216506, -1.039364, -0.1944,
-      -0.8614,   -0.4693,   0.812500,  0.333333,  -0.465537, -0.125000,
-      -1.123905, -0.3324,   -0.4954,   -0.8025,   0.812500,  0.416667,
-      -0.465537, -0.125000, -1.123905, -0.3324,   -0.4954,   -0.8025,
-      0.812500,  0.416667,  -0.478354, 0.000000,  -1.154849, -0.3827,
-      -0.0000,   -0.9239,   0.812500,  0.500000,  -0.323524, 0.000000,
-      -1.207407, -0.2588,   -0.0000,   -0.9659,   0.791667,  0.500000,
-      -0.625000, 0.000000,  -1.082532, -0.5000,   -0.0000,   -0.8660,
-      0.833333,  0.500000,  -0.608253, 0.125000,  -1.053526, -0.4343,
-      0.4954,    -0.7523,   0.833333,  0.583333,  -0.465537, 0.125000,
-      -1.123905, -0.3324,   0.4954,    -0.8025,   0.812500,  0.583333,
-      -0.465537, 0.125000,  -1.123905, -0.3324,   0.4954,    -0.8025,
-      0.812500,  0.583333,  -0.608253, 0.125000,  -1.053526, -0.4343,
-      0.4954,    -0.7523,   0.833333,  0.583333,  -0.562500, 0.216506,
-      -0.974279, -0.2540,   0.8614,    -0.4399,   0.833333,  0.666667,
-      -0.562500, 0.216506,  -0.974279, -0.2540,   0.8614,    -0.4399,
-      0.833333,  0.666667,  -0.500000, 0.250000,  -0.866026, -0.0054,
-      0.9999,    -0.0093,   0.833333,  0.750000,  -0.382684, 0.250000,
-      -0.923880, -0.0041,   0.9999,    -0.0100,   0.812500,  0.750000,
-      -0.500000, 0.250000,  -0.866026, -0.0054,   0.9999,    -0.0093,
-      0.833333,  0.750000,  -0.437500, 0.216506,  -0.757772, 0.2459,
-      0.8707,    0.4259,    0.833333,  0.833333,  -0.334848, 0.216506,
-      -0.808395, 0.1882,    0.8707,    0.4544,    0.812500,  0.833333,
-      -0.437500, 0.216506,  -0.757772, 0.2459,    0.8707,    0.4259,
-      0.833333,  0.833333,  -0.391747, 0.125000,  -0.678525, 0.4316,
-      0.5047,    0.7476,    0.833333,  0.916667,  -0.299830, 0.125000,
-      -0.723854, 0.3304,    0.5047,    0.7976,    0.812500,  0.916667,
-      -0.391747, 0.125000,  -0.678525, 0.4316,    0.5047,    0.7476,
-      0.833333,  0.916667,  -0.375000, 0.000000,  -0.649519, 0.5000,
-      -0.0000,   0.8660,    0.833333,  1.000000,  -0.287013, 0.000000,
-      -0.692910, 0.3827,    -0.0000,   0.9239,    0.812500,  1.000000,
-      -0.375000, 0.000000,  -0.649519, 0.5000,    -0.0000,   0.8660,
-      0.833333,  0.000000,  -0.391747, -0.125000, -0.678525, 0.4316,
-      -0.5047,   0.7476,    0.833333,  0.083333,  -0.299830, -0.125000,
-      -0.723854, 0.3304,    -0.5047,   0.7976,    0.812500,  0.083333,
-      -0.391747, -0.125000, -0.678525, 0.4316,    -0.5047,   0.7476,
-      0.833333,  0.083333,  -0.437500, -0.216506, -0.757772, 0.2459,
-      -0.8707,   0.4259,    0.833333,  0.166667,  -0.334848, -0.216506,
-      -0.808395, 0.1882,    -0.8707,   0.4544,    0.812500,  0.166667,
-      -0.437500, -0.216506, -0.757772, 0.2459,    -0.8707,   0.4259,
-      0.833333,  0.166667,  -0.500000, -0.250000, -0.866026, -0.0054,
-      -0.9999,   -0.0093,   0.833333,  0.250000,  -0.382684, -0.250000,
-      -0.923880, -0.0041,   -0.9999,   -0.0100,   0.812500,  0.250000,
-      -0.500000, -0.250000, -0.866026, -0.0054,   -0.9999,   -0.0093,
-      0.833333,  0.250000,  -0.562500, -0.216506, -0.974279, -0.2540,
-      -0.8614,   -0.4399,   0.833333,  0.333333,  -0.430519, -0.216506,
-      -1.039364, -0.1944,   -0.8614,   -0.4693,   0.812500,  0.333333,
-      -0.562500, -0.216506, -0.974279, -0.2540,   -0.8614,   -0.4399,
-      0.833333,  0.333333,  -0.608253, -0.125000, -1.053526, -0.4343,
-      -0.4954,   -0.7523,   0.833333,  0.416667,  -0.465537, -0.125000,
-      -1.123905, -0.3324,   -0.4954,   -0.8025,   0.812500,  0.416667,
-      -0.608253, -0.125000, -1.053526, -0.4343,   -0.4954,   -0.7523,
-      0.833333,  0.416667,  -0.625000, 0.000000,  -1.082532, -0.5000,
-      -0.0000,   -0.8660,   0.833333,  0.500000,  -0.478354, 0.000000,
-      -1.154849, -0.3827,   -0.0000,   -0.9239,   0.812500,  0.500000,
-      -0.760952, 0.000000,  -0.991692, -0.6088,   -0.0000,   -0.7934,
-      0.854167,  0.500000,  -0.740562, 0.125000,  -0.965119, -0.5288,
-      0.4954,    -0.6892,   0.854167,  0.583333,  -0.608253, 0.125000,
-      -1.053526, -0.4343,   0.4954,    -0.7523,   0.833333,  0.583333,
-      -0.740562, 0.125000,  -0.965119, -0.5288,   0.4954,    -0.6892,
-      0.854167,  0.583333,  -0.684857, 0.216506,  -0.892522, -0.3092,
-      0.8614,    -0.4030,   0.854167,  0.666667,  -0.562500, 0.216506,
-      -0.974279, -0.2540,   0.8614,    -0.4399,   0.833333,  0.666667,
-      -0.684857, 0.216506,  -0.892522, -0.3092,   0.8614,    -0.4030,
-      0.854167,  0.666667,  -0.608761, 0.250000,  -0.793353, -0.0066,
-      0.9999,    -0.0085,   0.854167,  0.750000,  -0.500000, 0.250000,
-      -0.866026, -0.0054,   0.9999,    -0.0093,   0.833333,  0.750000,
-      -0.608761, 0.250000,  -0.793353, -0.0066,   0.9999,    -0.0085,
-      0.854167,  0.750000,  -0.532666, 0.216506,  -0.694184, 0.2994,
-      0.8707,    0.3902,    0.854167,  0.833333,  -0.437500, 0.216506,
-      -0.757772, 0.2459,    0.8707,    0.4259,    0.833333,  0.833333,
-      -0.532666, 0.216506,  -0.694184, 0.2994,    0.8707,    0.3902,
-      0.854167,  0.833333,  -0.476961, 0.125000,  -0.621587, 0.5255,
-      0.5047,    0.6849,    0.854167,  0.916667,  -0.391747, 0.125000,
-      -0.678525, 0.4316,    0.5047,    0.7476,    0.833333,  0.916667,
-      -0.391747, 0.125000,  -0.678525, 0.4316,    0.5047,    0.7476,
-      0.833333,  0.916667,  -0.476961, 0.125000,  -0.621587, 0.5255,
-      0.5047,    0.6849,    0.854167,  0.916667,  -0.456571, 0.000000,
-      -0.595015, 0.6088,    -0.0000,   0.7934,    0.854167,  1.000000,
-      -0.456571, 0.000000,  -0.595015, 0.6088,    -0.0000,   0.7934,
-      0.854167,  0.000000,  -0.476961, -0.125000, -0.621587, 0.5255,
-      -0.5047,   0.6849,    0.854167,  0.083333,  -0.391747, -0.125000,
-      -0.678525, 0.4316,    -0.5047,   0.7476,    0.833333,  0.083333,
-      -0.391747, -0.125000, -0.678525, 0.4316,    -0.5047,   0.7476,
-      0.833333,  0.083333,  -0.476961, -0.125000, -0.621587, 0.5255,
-      -0.5047,   0.6849,    0.854167,  0.083333,  -0.532666, -0.216506,
-      -0.694184, 0.2994,    -0.8707,   0.3902,    0.854167,  0.166667,
-      -0.437500, -0.216506, -0.757772, 0.2459,    -0.8707,   0.4259,
-      0.833333,  0.166667,  -0.532666, -0.216506, -0.694184, 0.2994,
-      -0.8707,   0.3902,    0.854167,  0.166667,  -0.608761, -0.250000,
-      -0.793353, -0.0066,   -0.9999,   -0.0085,   0.854167,  0.250000,
-      -0.500000, -0.250000, -0.866026, -0.0054,   -0.9999,   -0.0093,
-      0.833333,  0.250000,  -0.608761, -0.250000, -0.793353, -0.0066,
-      -0.9999,   -0.0085,   0.854167,  0.250000,  -0.684857, -0.216506,
-      -0.892522, -0.3092,   -0.8614,   -0.4030,   0.854167,  0.333333,
-      -0.562500, -0.216506, -0.974279, -0.2540,   -0.8614,   -0.4399,
-      0.833333,  0.333333,  -0.684857, -0.216506, -0.892522, -0.3092,
-      -0.8614,   -0.4030,   0.854167,  0.333333,  -0.740562, -0.125000,
-      -0.965119, -0.5288,   -0.4954,   -0.6892,   0.854167,  0.416667,
-      -0.740562, -0.125000, -0.965119, -0.5288,   -0.4954,   -0.6892,
-      0.854167,  0.416667,  -0.760952, 0.000000,  -0.991692, -0.6088,
-      -0.0000,   -0.7934,   0.854167,  0.500000,  -0.625000, 0.000000,
-      -1.082532, -0.5000,   -0.0000,   -0.8660,   0.833333,  0.500000,
-      -0.883884, 0.000000,  -0.883883, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.860200, 0.125000,  -0.860200, -0.6142,
-      0.4954,    -0.6142,   0.875000,  0.583333,  -0.740562, 0.125000,
-      -0.965119, -0.5288,   0.4954,    -0.6892,   0.854167,  0.583333,
-      -0.860200, 0.125000,  -0.860200, -0.6142,   0.4954,    -0.6142,
-      0.875000,  0.583333,  -0.795495, 0.216506,  -0.795495, -0.3592,
-      0.8614,    -0.3592,   0.875000,  0.666667,  -0.684857, 0.216506,
-      -0.892522, -0.3092,   0.8614,    -0.4030,   0.854167,  0.666667,
-      -0.684857, 0.216506,  -0.892522, -0.3092,   0.8614,    -0.4030,
-      0.854167,  0.666667,  -0.795495, 0.216506,  -0.795495, -0.3592,
-      0.8614,    -0.3592,   0.875000,  0.666667,  -0.707107, 0.250000,
-      -0.707107, -0.0076,   0.9999,    -0.0076,   0.875000,  0.750000,
-      -0.707107, 0.250000,  -0.707107, -0.0076,   0.9999,    -0.0076,
-      0.875000,  0.750000,  -0.618719, 0.216506,  -0.618718, 0.3478,
-      0.8707,    0.3478,    0.875000,  0.833333,  -0.532666, 0.216506,
-      -0.694184, 0.2994,    0.8707,    0.3902,    0.854167,  0.833333,
-      -0.618719, 0.216506,  -0.618718, 0.3478,    0.8707,    0.3478,
-      0.875000,  0.833333,  -0.554014, 0.125000,  -0.554013, 0.6104,
-      0.5047,    0.6104,    0.875000,  0.916667,  -0.476961, 0.125000,
-      -0.621587, 0.5255,    0.5047,    0.6849,    0.854167,  0.916667,
-      -0.554014, 0.125000,  -0.554013, 0.6104,    0.5047,    0.6104,
-      0.875000,  0.916667,  -0.530330, 0.000000,  -0.530330, 0.7071,
-      -0.0000,   0.7071,    0.875000,  1.000000,  -0.456571, 0.000000,
-      -0.595015, 0.6088,    -0.0000,   0.7934,    0.854167,  1.000000,
-      -0.530330, 0.000000,  -0.530330, 0.7071,    -0.0000,   0.7071,
-      0.875000,  0.000000,  -0.554014, -0.125000, -0.554013, 0.6104,
-      -0.5047,   0.6104,    0.875000,  0.083333,  -0.476961, -0.125000,
-      -0.621587, 0.5255,    -0.5047,   0.6849,    0.854167,  0.083333,
-      -0.476961, -0.125000, -0.621587, 0.5255,    -0.5047,   0.6849,
-      0.854167,  0.083333,  -0.554014, -0.125000, -0.554013, 0.6104,
-      -0.5047,   0.6104,    0.875000,  0.083333,  -0.618719, -0.216506,
-      -0.618718, 0.3478,    -0.8707,   0.3478,    0.875000,  0.166667,
-      -0.618719, -0.216506, -0.618718, 0.3478,    -0.8707,   0.3478,
-      0.875000,  0.166667,  -0.707107, -0.250000, -0.707107, -0.0076,
-      -0.9999,   -0.0076,   0.875000,  0.250000,  -0.608761, -0.250000,
-      -0.793353, -0.0066,   -0.9999,   -0.0085,   0.854167,  0.250000,
-      -0.707107, -0.250000, -0.707107, -0.0076,   -0.9999,   -0.0076,
-      0.875000,  0.250000,  -0.795495, -0.216506, -0.795495, -0.3592,
-      -0.8614,   -0.3592,   0.875000,  0.333333,  -0.684857, -0.216506,
-      -0.892522, -0.3092,   -0.8614,   -0.4030,   0.854167,  0.333333,
-      -0.795495, -0.216506, -0.795495, -0.3592,   -0.8614,   -0.3592,
-      0.875000,  0.333333,  -0.860200, -0.125000, -0.860200, -0.6142,
-      -0.4954,   -0.6142,   0.875000,  0.416667,  -0.740562, -0.125000,
-      -0.965119, -0.5288,   -0.4954,   -0.6892,   0.854167,  0.416667,
-      -0.860200, -0.125000, -0.860200, -0.6142,   -0.4954,   -0.6142,
-      0.875000,  0.416667,  -0.883884, 0.000000,  -0.883883, -0.7071,
-      -0.0000,   -0.7071,   0.875000,  0.500000,  -0.760952, 0.000000,
-      -0.991692, -0.6088,   -0.0000,   -0.7934,   0.854167,  0.500000,
-      -0.991692, 0.000000,  -0.760952, -0.7934,   -0.0000,   -0.6088,
-      0.895833,  0.500000,  -0.965119, 0.125000,  -0.740562, -0.6892,
-      0.4954,    -0.5288,   0.895833,  0.583333,  -0.860200, 0.125000,
-      -0.860200, -0.6142,   0.4954,    -0.6142,   0.875000,  0.583333,
-      -0.965119, 0.125000,  -0.740562, -0.6892,   0.4954,    -0.5288,
-      0.895833,  0.583333,  -0.892522, 0.216506,  -0.684857, -0.4030,
-      0.8614,    -0.3092,   0.895833,  0.666667,  -0.795495, 0.216506,
-      -0.795495, -0.3592,   0.8614,    -0.3592,   0.875000,  0.666667,
-      -0.892522, 0.216506,  -0.684857, -0.4030,   0.8614,    -0.3092,
-      0.895833,  0.666667,  -0.793353, 0.250000,  -0.608761, -0.0085,
-      0.9999,    -0.0066,   0.895833,  0.750000,  -0.707107, 0.250000,
-      -0.707107, -0.0076,   0.9999,    -0.0076,   0.875000,  0.750000,
-      -0.707107, 0.250000,  -0.707107, -0.0076,   0.9999,    -0.0076,
-      0.875000,  0.750000,  -0.793353, 0.250000,  -0.608761, -0.0085,
-      0.9999,    -0.0066,   0.895833,  0.750000,  -0.694184, 0.216506,
-      -0.532666, 0.3902,    0.8707,    0.2994,    0.895833,  0.833333,
-      -0.694184, 0.216506,  -0.532666, 0.3902,    0.8707,    0.2994,
-      0.895833,  0.833333,  -0.621587, 0.125000,  -0.476961, 0.6849,
-      0.5047,    0.5255,    0.895833,  0.916667,  -0.554014, 0.125000,
-      -0.554013, 0.6104,    0.5047,    0.6104,    0.875000,  0.916667,
-      -0.621587, 0.125000,  -0.476961, 0.6849,    0.5047,    0.5255,
-      0.895833,  0.916667,  -0.595015, 0.000000,  -0.456571, 0.7934,
-      -0.0000,   0.6088,    0.895833,  1.000000,  -0.530330, 0.000000,
-      -0.530330, 0.7071,    -0.0000,   0.7071,    0.875000,  1.000000,
-      -0.595015, 0.000000,  -0.456571, 0.7934,    -0.0000,   0.6088,
-      0.895833,  0.000000,  -0.621587, -0.125000, -0.476961, 0.6849,
-      -0.5047,   0.5255,    0.895833,  0.083333,  -0.554014, -0.125000,
-      -0.554013, 0.6104,    -0.5047,   0.6104,    0.875000,  0.083333,
-      -0.554014, -0.125000, -0.554013, 0.6104,    -0.5047,   0.6104,
-      0.875000,  0.083333,  -0.621587, -0.125000, -0.476961, 0.6849,
-      -0.5047,   0.5255,    0.895833,  0.083333,  -0.694184, -0.216506,
-      -0.532666, 0.3902,    -0.8707,   0.2994,    0.895833,  0.166667,
-      -0.694184, -0.216506, -0.532666, 0.3902,    -0.8707,   0.2994,
-      0.895833,  0.166667,  -0.793353, -0.250000, -0.608761, -0.0086,
-      -0.9999,   -0.0066,   0.895833,  0.250000,  -0.707107, -0.250000,
-      -0.707107, -0.0076,   -0.9999,   -0.0076,   0.875000,  0.250000,
-      -0.793353, -0.250000, -0.608761, -0.0086,   -0.9999,   -0.0066,
-      0.895833,  0.250000,  -0.892522, -0.216506, -0.684857, -0.4030,
-      -0.8614,   -0.3092,   0.895833,  0.333333,  -0.795495, -0.216506,
-      -0.795495, -0.3592,   -0.8614,   -0.3592,   0.875000,  0.333333,
-      -0.795495, -0.216506, -0.795495, -0.3592,   -0.8614,   -0.3592,
-      0.875000,  0.333333,  -0.892522, -0.216506, -0.684857, -0.4030,
-      -0.8614,   -0.3092,   0.895833,  0.333333,  -0.965119, -0.125000,
-      -0.740562, -0.6892,   -0.4954,   -0.5288,   0.895833,  0.416667,
-      -0.965119, -0.125000, -0.740562, -0.6892,   -0.4954,   -0.5288,
-      0.895833,  0.416667,  -0.991692, 0.000000,  -0.760952, -0.7934,
-      -0.0000,   -0.6088,   0.895833,  0.500000,  -0.883884, 0.000000,
-      -0.883883, -0.7071,   -0.0000,   -0.7071,   0.875000,  0.500000,
-      -0.991692, 0.000000,  -0.760952, -0.7934,   -0.0000,   -0.6088,
-      0.895833,  0.500000,  -1.082532, 0.000000,  -0.625000, -0.8660,
-      -0.0000,   -0.5000,   0.916667,  0.500000,  -1.053525, 0.125000,
-      -0.608253, -0.7523,   0.4954,    -0.4343,   0.916667,  0.583333,
-      -1.053525, 0.125000,  -0.608253, -0.7523,   0.4954,    -0.4343,
-      0.916667,  0.583333,  -0.974278, 0.216506,  -0.562500, -0.4399,
-      0.8614,    -0.2540,   0.916667,  0.666667,  -0.892522, 0.216506,
-      -0.684857, -0.4030,   0.8614,    -0.3092,   0.895833,  0.666667,
-      -0.892522, 0.216506,  -0.684857, -0.4030,   0.8614,    -0.3092,
-      0.895833,  0.666667,  -0.974278, 0.216506,  -0.562500, -0.4399,
-      0.8614,    -0.2540,   0.916667,  0.666667,  -0.866025, 0.250000,
-      -0.500000, -0.0093,   0.9999,    -0.0054,   0.916667,  0.750000,
-      -0.866025, 0.250000,  -0.500000, -0.0093,   0.9999,    -0.0054,
-      0.916667,  0.750000,  -0.757772, 0.216506,  -0.437500, 0.4259,
-      0.8707,    0.2459,    0.916667,  0.833333,  -0.694184, 0.216506,
-      -0.532666, 0.3902,    0.8707,    0.2994,    0.895833,  0.833333,
-      -0.757772, 0.216506,  -0.437500, 0.4259,    0.8707,    0.2459,
-      0.916667,  0.833333,  -0.678525, 0.125000,  -0.391747, 0.7476,
-      0.5047,    0.4316,    0.916667,  0.916667,  -0.621587, 0.125000,
-      -0.476961, 0.6849,    0.5047,    0.5255,    0.895833,  0.916667,
-      -0.678525, 0.125000,  -0.391747, 0.7476,    0.5047,    0.4316,
-      0.916667,  0.916667,  -0.649519, 0.000000,  -0.375000, 0.8660,
-      -0.0000,   0.5000,    0.916667,  1.000000,  -0.595015, 0.000000,
-      -0.456571, 0.7934,    -0.0000,   0.6088,    0.895833,  1.000000,
-      -0.649519, 0.000000,  -0.375000, 0.8660,    -0.0000,   0.5000,
-      0.916667,  0.000000,  -0.678525, -0.125000, -0.391747, 0.7476,
-      -0.5047,   0.4316,    0.916667,  0.083333,  -0.621587, -0.125000,
-      -0.476961, 0.6849,    -0.5047,   0.5255,    0.895833,  0.083333,
-      -0.678525, -0.125000, -0.391747, 0.7476,    -0.5047,   0.4316,
-      0.916667,  0.083333,  -0.757772, -0.216506, -0.437500, 0.4259,
-      -0.8707,   0.2459,    0.916667,  0.166667,  -0.694184, -0.216506,
-      -0.532666, 0.3902,    -0.8707,   0.2994,    0.895833,  0.166667,
-      -0.694184, -0.216506, -0.532666, 0.3902,    -0.8707,   0.2994,
-      0.895833,  0.166667,  -0.757772, -0.216506, -0.437500, 0.4259,
-      -0.8707,   0.2459,    0.916667,  0.166667,  -0.866025, -0.250000,
-      -0.500000, -0.0093,   -0.9999,   -0.0054,   0.916667,  0.250000,
-      -0.866025, -0.250000, -0.500000, -0.0093,   -0.9999,   -0.0054,
-      0.916667,  0.250000,  -0.974278, -0.216506, -0.562500, -0.4399,
-      -0.8614,   -0.2540,   0.916667,  0.333333,  -0.892522, -0.216506,
-      -0.684857, -0.4030,   -0.8614,   -0.3092,   0.895833,  0.333333,
-      -0.974278, -0.216506, -0.562500, -0.4399,   -0.8614,   -0.2540,
-      0.916667,  0.333333,  -1.053525, -0.125000, -0.608253, -0.7523,
-      -0.4954,   -0.4343,   0.916667,  0.416667,  -0.965119, -0.125000,
-      -0.740562, -0.6892,   -0.4954,   -0.5288,   0.895833,  0.416667,
-      -1.053525, -0.125000, -0.608253, -0.7523,   -0.4954,   -0.4343,
-      0.916667,  0.416667,  -1.082532, 0.000000,  -0.625000, -0.8660,
-      -0.0000,   -0.5000,   0.916667,  0.500000,  -0.991692, 0.000000,
-      -0.760952, -0.7934,   -0.0000,   -0.6088,   0.895833,  0.500000,
-      -1.154849, 0.000000,  -0.478354, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -1.123905, 0.125000,  -0.465537, -0.8025,
-      0.4954,    -0.3324,   0.937500,  0.583333,  -1.053525, 0.125000,
-      -0.608253, -0.7523,   0.4954,    -0.4343,   0.916667,  0.583333,
-      -1.123905, 0.125000,  -0.465537, -0.8025,   0.4954,    -0.3324,
-      0.937500,  0.583333,  -1.039364, 0.216506,  -0.430519, -0.4693,
-      0.8614,    -0.1944,   0.937500,  0.666667,  -0.974278, 0.216506,
-      -0.562500, -0.4399,   0.8614,    -0.2540,   0.916667,  0.666667,
-      -1.039364, 0.216506,  -0.430519, -0.4693,   0.8614,    -0.1944,
-      0.937500,  0.666667,  -0.923880, 0.250000,  -0.382683, -0.0100,
-      0.9999,    -0.0041,   0.937500,  0.750000,  -0.866025, 0.250000,
-      -0.500000, -0.0093,   0.9999,    -0.0054,   0.916667,  0.750000,
-      -0.866025, 0.250000,  -0.500000, -0.0093,   0.9999,    -0.0054,
-      0.916667,  0.750000,  -0.923880, 0.250000,  -0.382683, -0.0100,
-      0.9999,    -0.0041,   0.937500,  0.750000,  -0.808395, 0.216506,
-      -0.334848, 0.4544,    0.8707,    0.1882,    0.937500,  0.833333,
-      -0.808395, 0.216506,  -0.334848, 0.4544,    0.8707,    0.1882,
-      0.937500,  0.833333,  -0.723854, 0.125000,  -0.299830, 0.7976,
-      0.5047,    0.3304,    0.937500,  0.916667,  -0.678525, 0.125000,
-      -0.391747, 0.7476,    0.5047,    0.4316,    0.916667,  0.916667,
-      -0.723854, 0.125000,  -0.299830, 0.7976,    0.5047,    0.3304,
-      0.937500,  0.916667,  -0.692910, 0.000000,  -0.287013, 0.9239,
-      -0.0000,   0.3827,    0.937500,  1.000000,  -0.649519, 0.000000,
-      -0.375000, 0.8660,    -0.0000,   0.5000,    0.916667,  1.000000,
-      -0.649519, 0.000000,  -0.375000, 0.8660,    -0.0000,   0.5000,
-      0.916667,  0.000000,  -0.692910, 0.000000,  -0.287013, 0.9239,
-      -0.0000,   0.3827,    0.937500,  0.000000,  -0.723854, -0.125000,
-      -0.299830, 0.7976,    -0.5047,   0.3304,    0.937500,  0.083333,
-      -0.723854, -0.125000, -0.299830, 0.7976,    -0.5047,   0.3304,
-      0.937500,  0.083333,  -0.808395, -0.216506, -0.334848, 0.4544,
-      -0.8707,   0.1882,    0.937500,  0.166667,  -0.757772, -0.216506,
-      -0.437500, 0.4259,    -0.8707,   0.2459,    0.916667,  0.166667,
-      -0.808395, -0.216506, -0.334848, 0.4544,    -0.8707,   0.1882,
-      0.937500,  0.166667,  -0.923880, -0.250000, -0.382683, -0.0100,
-      -0.9999,   -0.0041,   0.937500,  0.250000,  -0.866025, -0.250000,
-      -0.500000, -0.0093,   -0.9999,   -0.0054,   0.916667,  0.250000,
-      -0.923880, -0.250000, -0.382683, -0.0100,   -0.9999,   -0.0041,
-      0.937500,  0.250000,  -1.039364, -0.216506, -0.430519, -0.4693,
-      -0.8614,   -0.1944,   0.937500,  0.333333,  -0.974278, -0.216506,
-      -0.562500, -0.4399,   -0.8614,   -0.2540,   0.916667,  0.333333,
-      -0.974278, -0.216506, -0.562500, -0.4399,   -0.8614,   -0.2540,
-      0.916667,  0.333333,  -1.039364, -0.216506, -0.430519, -0.4693,
-      -0.8614,   -0.1944,   0.937500,  0.333333,  -1.123905, -0.125000,
-      -0.465537, -0.8025,   -0.4954,   -0.3324,   0.937500,  0.416667,
-      -1.123905, -0.125000, -0.465537, -0.8025,   -0.4954,   -0.3324,
-      0.937500,  0.416667,  -1.154849, 0.000000,  -0.478354, -0.9239,
-      -0.0000,   -0.3827,   0.937500,  0.500000,  -1.082532, 0.000000,
-      -0.625000, -0.8660,   -0.0000,   -0.5000,   0.916667,  0.500000,
-      -1.154849, 0.000000,  -0.478354, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -1.207407, 0.000000,  -0.323524, -0.9659,
-      -0.0000,   -0.2588,   0.958333,  0.500000,  -1.175055, 0.125000,
-      -0.314855, -0.8391,   0.4954,    -0.2248,   0.958333,  0.583333,
-      -1.175055, 0.125000,  -0.314855, -0.8391,   0.4954,    -0.2248,
-      0.958333,  0.583333,  -1.086667, 0.216506,  -0.291171, -0.4907,
-      0.8614,    -0.1315,   0.958333,  0.666667,  -1.039364, 0.216506,
-      -0.430519, -0.4693,   0.8614,    -0.1944,   0.937500,  0.666667,
-      -1.086667, 0.216506,  -0.291171, -0.4907,   0.8614,    -0.1315,
-      0.958333,  0.666667,  -0.965926, 0.250000,  -0.258819, -0.0104,
-      0.9999,    -0.0028,   0.958333,  0.750000,  -0.923880, 0.250000,
-      -0.382683, -0.0100,   0.9999,    -0.0041,   0.937500,  0.750000,
-      -0.923880, 0.250000,  -0.382683, -0.0100,   0.9999,    -0.0041,
-      0.937500,  0.750000,  -0.965926, 0.250000,  -0.258819, -0.0104,
-      0.9999,    -0.0028,   0.958333,  0.750000,  -0.845185, 0.216506,
-      -0.226467, 0.4751,    0.8707,    0.1273,    0.958333,  0.833333,
-      -0.845185, 0.216506,  -0.226467, 0.4751,    0.8707,    0.1273,
-      0.958333,  0.833333,  -0.756797, 0.125000,  -0.202783, 0.8339,
-      0.5047,    0.2234,    0.958333,  0.916667,  -0.723854, 0.125000,
-      -0.299830, 0.7976,    0.5047,    0.3304,    0.937500,  0.916667,
-      -0.756797, 0.125000,  -0.202783, 0.8339,    0.5047,    0.2234,
-      0.958333,  0.916667,  -0.724444, 0.000000,  -0.194114, 0.9659,
-      -0.0000,   0.2588,    0.958333,  1.000000,  -0.692910, 0.000000,
-      -0.287013, 0.9239,    -0.0000,   0.3827,    0.937500,  1.000000,
-      -0.724444, 0.000000,  -0.194114, 0.9659,    -0.0000,   0.2588,
-      0.958333,  0.000000,  -0.756797, -0.125000, -0.202783, 0.8339,
-      -0.5047,   0.2234,    0.958333,  0.083333,  -0.723854, -0.125000,
-      -0.299830, 0.7976,    -0.5047,   0.3304,    0.937500,  0.083333,
-      -0.756797, -0.125000, -0.202783, 0.8339,    -0.5047,   0.2234,
-      0.958333,  0.083333,  -0.845185, -0.216506, -0.226467, 0.4751,
-      -0.8707,   0.1273,    0.958333,  0.166667,  -0.808395, -0.216506,
-      -0.334848, 0.4544,    -0.8707,   0.1882,    0.937500,  0.166667,
-      -0.845185, -0.216506, -0.226467, 0.4751,    -0.8707,   0.1273,
-      0.958333,  0.166667,  -0.965926, -0.250000, -0.258819, -0.0104,
-      -0.9999,   -0.0028,   0.958333,  0.250000,  -0.923880, -0.250000,
-      -0.382683, -0.0100,   -0.9999,   -0.0041,   0.937500,  0.250000,
-      -0.923880, -0.250000, -0.382683, -0.0100,   -0.9999,   -0.0041,
-      0.937500,  0.250000,  -0.965926, -0.250000, -0.258819, -0.0104,
-      -0.9999,   -0.0028,   0.958333,  0.250000,  -1.086667, -0.216506,
-      -0.291171, -0.4907,   -0.8614,   -0.1315,   0.958333,  0.333333,
-      -1.086667, -0.216506, -0.291171, -0.4907,   -0.8614,   -0.1315,
-      0.958333,  0.333333,  -1.175055, -0.125000, -0.314855, -0.8391,
-      -0.4954,   -0.2248,   0.958333,  0.416667,  -1.123905, -0.125000,
-      -0.465537, -0.8025,   -0.4954,   -0.3324,   0.937500,  0.416667,
-      -1.175055, -0.125000, -0.314855, -0.8391,   -0.4954,   -0.2248,
-      0.958333,  0.416667,  -1.207407, 0.000000,  -0.323524, -0.9659,
-      -0.0000,   -0.2588,   0.958333,  0.500000,  -1.154849, 0.000000,
-      -0.478354, -0.9239,   -0.0000,   -0.3827,   0.937500,  0.500000,
-      -1.239306, 0.000000,  -0.163158, -0.9914,   -0.0000,   -0.1305,
-      0.979167,  0.500000,  -1.206099, 0.125000,  -0.158786, -0.8612,
-      0.4954,    -0.1134,   0.979167,  0.583333,  -1.175055, 0.125000,
-      -0.314855, -0.8391,   0.4954,    -0.2248,   0.958333,  0.583333,
-      -1.206099, 0.125000,  -0.158786, -0.8612,   0.4954,    -0.1134,
-      0.979167,  0.583333,  -1.115375, 0.216506,  -0.146842, -0.5037,
-      0.8614,    -0.0663,   0.979167,  0.666667,  -1.086667, 0.216506,
-      -0.291171, -0.4907,   0.8614,    -0.1315,   0.958333,  0.666667,
-      -1.115375, 0.216506,  -0.146842, -0.5037,   0.8614,    -0.0663,
-      0.979167,  0.666667,  -0.991445, 0.250000,  -0.130526, -0.0107,
-      0.9999,    -0.0014,   0.979167,  0.750000,  -0.965926, 0.250000,
-      -0.258819, -0.0104,   0.9999,    -0.0028,   0.958333,  0.750000,
-      -0.991445, 0.250000,  -0.130526, -0.0107,   0.9999,    -0.0014,
-      0.979167,  0.750000,  -0.867514, 0.216506,  -0.114211, 0.4876,
-      0.8707,    0.0642,    0.979167,  0.833333,  -0.845185, 0.216506,
-      -0.226467, 0.4751,    0.8707,    0.1273,    0.958333,  0.833333,
-      -0.867514, 0.216506,  -0.114211, 0.4876,    0.8707,    0.0642,
-      0.979167,  0.833333,  -0.776791, 0.125000,  -0.102267, 0.8559,
-      0.5047,    0.1127,    0.979167,  0.916667,  -0.756797, 0.125000,
-      -0.202783, 0.8339,    0.5047,    0.2234,    0.958333,  0.916667,
-      -0.776791, 0.125000,  -0.102267, 0.8559,    0.5047,    0.1127,
-      0.979167,  0.916667,  -0.743584, 0.000000,  -0.097895, 0.9914,
-      -0.0000,   0.1305,    0.979167,  1.000000,  -0.724444, 0.000000,
-      -0.194114, 0.9659,    -0.0000,   0.2588,    0.958333,  1.000000,
-      -0.743584, 0.000000,  -0.097895, 0.9914,    -0.0000,   0.1305,
-      0.979167,  0.000000,  -0.776791, -0.125000, -0.102267, 0.8559,
-      -0.5047,   0.1127,    0.979167,  0.083333,  -0.756797, -0.125000,
-      -0.202783, 0.8339,    -0.5047,   0.2234,    0.958333,  0.083333,
-      -0.756797, -0.125000, -0.202783, 0.8339,    -0.5047,   0.2234,
-      0.958333,  0.083333,  -0.776791, -0.125000, -0.102267, 0.8559,
-      -0.5047,   0.1127,    0.979167,  0.083333,  -0.867514, -0.216506,
-      -0.114211, 0.4876,    -0.8707,   0.0642,    0.979167,  0.166667,
-      -0.845185, -0.216506, -0.226467, 0.4751,    -0.8707,   0.1273,
-      0.958333,  0.166667,  -0.867514, -0.216506, -0.114211, 0.4876,
-      -0.8707,   0.0642,    0.979167,  0.166667,  -0.991445, -0.250000,
-      -0.130526, -0.0107,   -0.9999,   -0.0014,   0.979167,  0.250000,
-      -0.965926, -0.250000, -0.258819, -0.0104,   -0.9999,   -0.0028,
-      0.958333,  0.250000,  -0.991445, -0.250000, -0.130526, -0.0107,
-      -0.9999,   -0.0014,   0.979167,  0.250000,  -1.115375, -0.216506,
-      -0.146842, -0.5036,   -0.8614,   -0.0663,   0.979167,  0.333333,
-      -1.086667, -0.216506, -0.291171, -0.4907,   -0.8614,   -0.1315,
-      0.958333,  0.333333,  -1.115375, -0.216506, -0.146842, -0.5036,
-      -0.8614,   -0.0663,   0.979167,  0.333333,  -1.206099, -0.125000,
-      -0.158786, -0.8612,   -0.4954,   -0.1134,   0.979167,  0.416667,
-      -1.175055, -0.125000, -0.314855, -0.8391,   -0.4954,   -0.2248,
-      0.958333,  0.416667,  -1.206099, -0.125000, -0.158786, -0.8612,
-      -0.4954,   -0.1134,   0.979167,  0.416667,  -1.239306, 0.000000,
-      -0.163158, -0.9914,   -0.0000,   -0.1305,   0.979167,  0.500000,
-      -1.239306, 0.000000,  -0.163158, -0.9914,   -0.0000,   -0.1305,
-      0.979167,  0.500000,  -1.250000, 0.000000,  -0.000000, -1.0000,
-      -0.0000,   -0.0000,   1.000000,  0.500000,  -1.216506, 0.125000,
-      -0.000000, -0.8687,   0.4954,    -0.0000,   1.000000,  0.583333,
-      -1.216506, 0.125000,  -0.000000, -0.8687,   0.4954,    -0.0000,
-      1.000000,  0.583333,  -1.125000, 0.216506,  -0.000000, -0.5080,
-      0.8614,    -0.0000,   1.000000,  0.666667,  -1.115375, 0.216506,
-      -0.146842, -0.5037,   0.8614,    -0.0663,   0.979167,  0.666667,
-      -1.125000, 0.216506,  -0.000000, -0.5080,   0.8614,    -0.0000,
-      1.000000,  0.666667,  -1.000000, 0.250000,  -0.000000, -0.0108,
-      0.9999,    -0.0000,   1.000000,  0.750000,  -0.991445, 0.250000,
-      -0.130526, -0.0107,   0.9999,    -0.0014,   0.979167,  0.750000,
-      -1.000000, 0.250000,  -0.000000, -0.0108,   0.9999,    -0.0000,
-      1.000000,  0.750000,  -0.875000, 0.216506,  -0.000000, 0.4918,
-      0.8707,    -0.0000,   1.000000,  0.833333,  -0.867514, 0.216506,
-      -0.114211, 0.4876,    0.8707,    0.0642,    0.979167,  0.833333,
-      -0.875000, 0.216506,  -0.000000, 0.4918,    0.8707,    -0.0000,
-      1.000000,  0.833333,  -0.783494, 0.125000,  -0.000000, 0.8633,
-      0.5047,    -0.0000,   1.000000,  0.916667,  -0.776791, 0.125000,
-      -0.102267, 0.8559,    0.5047,    0.1127,    0.979167,  0.916667,
-      -0.783494, 0.125000,  -0.000000, 0.8633,    0.5047,    -0.0000,
-      1.000000,  0.916667,  -0.750000, 0.000000,  -0.000000, 1.0000,
-      -0.0000,   -0.0000,   1.000000,  1.000000,  -0.743584, 0.000000,
-      -0.097895, 0.9914,    -0.0000,   0.1305,    0.979167,  1.000000,
-      -0.750000, 0.000000,  -0.000000, 1.0000,    -0.0000,   -0.0000,
-      1.000000,  0.000000,  -0.783494, -0.125000, -0.000000, 0.8633,
-      -0.5047,   -0.0000,   1.000000,  0.083333,  -0.776791, -0.125000,
-      -0.102267, 0.8559,    -0.5047,   0.1127,    0.979167,  0.083333,
-      -0.776791, -0.125000, -0.102267, 0.8559,    -0.5047,   0.1127,
-      0.979167,  0.083333,  -0.783494, -0.125000, -0.000000, 0.8633,
-      -0.5047,   -0.0000,   1.000000,  0.083333,  -0.875000, -0.216506,
-      -0.000000, 0.4918,    -0.8707,   -0.0000,   1.000000,  0.166667,
-      -0.875000, -0.216506, -0.000000, 0.4918,    -0.8707,   -0.0000,
-      1.000000,  0.166667,  -1.000000, -0.250000, -0.000000, -0.0108,
-      -0.9999,   -0.0000,   1.000000,  0.250000,  -0.991445, -0.250000,
-      -0.130526, -0.0107,   -0.9999,   -0.0014,   0.979167,  0.250000,
-      -1.000000, -0.250000, -0.000000, -0.0108,   -0.9999,   -0.0000,
-      1.000000,  0.250000,  -1.125000, -0.216506, -0.000000, -0.5080,
-      -0.8614,   -0.0000,   1.000000,  0.333333,  -1.115375, -0.216506,
-      -0.146842, -0.5036,   -0.8614,   -0.0663,   0.979167,  0.333333,
-      -1.125000, -0.216506, -0.000000, -0.5080,   -0.8614,   -0.0000,
-      1.000000,  0.333333,  -1.216506, -0.125000, -0.000000, -0.8687,
-      -0.4954,   -0.0000,   1.000000,  0.416667,  -1.206099, -0.125000,
-      -0.158786, -0.8612,   -0.4954,   -0.1134,   0.979167,  0.416667,
-      -1.216506, -0.125000, -0.000000, -0.8687,   -0.4954,   -0.0000,
-      1.000000,  0.416667,  -1.250000, 0.000000,  -0.000000, -1.0000,
-      -0.0000,   -0.0000,   1.000000,  0.500000,  -1.239306, 0.000000,
-      -0.163158, -0.9914,   -0.0000,   -0.1305,   0.979167,  0.500000,
-      -1.239306, 0.000000,  0.163158,  -0.9914,   -0.0000,   0.1305,
-      0.020833,  0.500000,  -1.206099, 0.125000,  0.158786,  -0.8612,
-      0.4954,    0.1134,    0.020833,  0.583333,  -1.216506, 0.125000,
-      -0.000000, -0.8687,   0.4954,    -0.0000,   0.000000,  0.583333,
-      -1.206099, 0.125000,  0.158786,  -0.8612,   0.4954,    0.1134,
-      0.020833,  0.583333,  -1.115375, 0.216506,  0.146842,  -0.5036,
-      0.8614,    0.0663,    0.020833,  0.666667,  -1.125000, 0.216506,
-      -0.000000, -0.5080,   0.8614,    -0.0000,   0.000000,  0.666667,
-      -1.115375, 0.216506,  0.146842,  -0.5036,   0.8614,    0.0663,
-      0.020833,  0.666667,  -0.991445, 0.250000,  0.130526,  -0.0107,
-      0.9999,    0.0014,    0.020833,  0.750000,  -1.000000, 0.250000,
-      -0.000000, -0.0108,   0.9999,    -0.0000,   0.000000,  0.750000,
-      -0.991445, 0.250000,  0.130526,  -0.0107,   0.9999,    0.0014,
-      0.020833,  0.750000,  -0.867514, 0.216506,  0.114211,  0.4876,
-      0.8707,    -0.0642,   0.020833,  0.833333,  -0.875000, 0.216506,
-      -0.000000, 0.4918,    0.8707,    -0.0000,   0.000000,  0.833333,
-      -0.867514, 0.216506,  0.114211,  0.4876,    0.8707,    -0.0642,
-      0.020833,  0.833333,  -0.776791, 0.125000,  0.102267,  0.8559,
-      0.5047,    -0.1127,   0.020833,  0.916667,  -0.783494, 0.125000,
-      -0.000000, 0.8633,    0.5047,    -0.0000,   0.000000,  0.916667,
-      -0.776791, 0.125000,  0.102267,  0.8559,    0.5047,    -0.1127,
-      0.020833,  0.916667,  -0.743584, 0.000000,  0.097895,  0.9914,
-      -0.0000,   -0.1305,   0.020833,  1.000000,  -0.750000, 0.000000,
-      -0.000000, 1.0000,    -0.0000,   -0.0000,   0.000000,  1.000000,
-      -0.750000, 0.000000,  -0.000000, 1.0000,    -0.0000,   -0.0000,
-      0.000000,  0.000000,  -0.743584, 0.000000,  0.097895,  0.9914,
-      -0.0000,   -0.1305,   0.020833,  0.000000,  -0.776791, -0.125000,
-      0.102267,  0.8559,    -0.5047,   -0.1127,   0.020833,  0.083333,
-      -0.776791, -0.125000, 0.102267,  0.8559,    -0.5047,   -0.1127,
-      0.020833,  0.083333,  -0.867514, -0.216506, 0.114211,  0.4876,
-      -0.8707,   -0.0642,   0.020833,  0.166667,  -0.875000, -0.216506,
-      -0.000000, 0.4918,    -0.8707,   -0.0000,   0.000000,  0.166667,
-      -0.875000, -0.216506, -0.000000, 0.4918,    -0.8707,   -0.0000,
-      0.000000,  0.166667,  -0.867514, -0.216506, 0.114211,  0.4876,
-      -0.8707,   -0.0642,   0.020833,  0.166667,  -0.991445, -0.250000,
-      0.130526,  -0.0107,   -0.9999,   0.0014,    0.020833,  0.250000,
-      -1.000000, -0.250000, -0.000000, -0.0108,   -0.9999,   -0.0000,
-      0.000000,  0.250000,  -0.991445, -0.250000, 0.130526,  -0.0107,
-      -0.9999,   0.0014,    0.020833,  0.250000,  -1.115375, -0.216506,
-      0.146842,  -0.5036,   -0.8614,   0.0663,    0.020833,  0.333333,
-      -1.125000, -0.216506, -0.000000, -0.5080,   -0.8614,   -0.0000,
-      0.000000,  0.333333,  -1.115375, -0.216506, 0.146842,  -0.5036,
-      -0.8614,   0.0663,    0.020833,  0.333333,  -1.206099, -0.125000,
-      0.158786,  -0.8612,   -0.4954,   0.1134,    0.020833,  0.416667,
-      -1.216506, -0.125000, -0.000000, -0.8687,   -0.4954,   -0.0000,
-      0.000000,  0.416667,  -1.206099, -0.125000, 0.158786,  -0.8612,
-      -0.4954,   0.1134,    0.020833,  0.416667,  -1.239306, 0.000000,
-      0.163158,  -0.9914,   -0.0000,   0.1305,    0.020833,  0.500000,
-      -1.239306, 0.000000,  0.163158,  -0.9914,   -0.0000,   0.1305,
-      0.020833,  0.500000,  -1.207407, 0.000000,  0.323524,  -0.9659,
-      -0.0000,   0.2588,    0.041667,  0.500000,  -1.175055, 0.125000,
-      0.314855,  -0.8391,   0.4954,    0.2248,    0.041667,  0.583333,
-      -1.206099, 0.125000,  0.158786,  -0.8612,   0.4954,    0.1134,
-      0.020833,  0.583333,  -1.175055, 0.125000,  0.314855,  -0.8391,
-      0.4954,    0.2248,    0.041667,  0.583333,  -1.086667, 0.216506,
-      0.291171,  -0.4907,   0.8614,    0.1315,    0.041667,  0.666667,
-      -1.115375, 0.216506,  0.146842,  -0.5036,   0.8614,    0.0663,
-      0.020833,  0.666667,  -1.086667, 0.216506,  0.291171,  -0.4907,
-      0.8614,    0.1315,    0.041667,  0.666667,  -0.965926, 0.250000,
-      0.258819,  -0.0104,   0.9999,    0.0028,    0.041667,  0.750000,
-      -0.991445, 0.250000,  0.130526,  -0.0107,   0.9999,    0.0014,
-      0.020833,  0.750000,  -0.965926, 0.250000,  0.258819,  -0.0104,
-      0.9999,    0.0028,    0.041667,  0.750000,  -0.845185, 0.216506,
-      0.226467,  0.4751,    0.8707,    -0.1273,   0.041667,  0.833333,
-      -0.867514, 0.216506,  0.114211,  0.4876,    0.8707,    -0.0642,
-      0.020833,  0.833333,  -0.845185, 0.216506,  0.226467,  0.4751,
-      0.8707,    -0.1273,   0.041667,  0.833333,  -0.756797, 0.125000,
-      0.202783,  0.8339,    0.5047,    -0.2234,   0.041667,  0.916667,
-      -0.756797, 0.125000,  0.202783,  0.8339,    0.5047,    -0.2234,
-      0.041667,  0.916667,  -0.724444, 0.000000,  0.194114,  0.9659,
-      -0.0000,   -0.2588,   0.041667,  1.000000,  -0.743584, 0.000000,
-      0.097895,  0.9914,    -0.0000,   -0.1305,   0.020833,  1.000000,
-      -0.724444, 0.000000,  0.194114,  0.9659,    -0.0000,   -0.2588,
-      0.041667,  0.000000,  -0.756797, -0.125000, 0.202783,  0.8339,
-      -0.5047,   -0.2234,   0.041667,  0.083333,  -0.776791, -0.125000,
-      0.102267,  0.8559,    -0.5047,   -0.1127,   0.020833,  0.083333,
-      -0.756797, -0.125000, 0.202783,  0.8339,    -0.5047,   -0.2234,
-      0.041667,  0.083333,  -0.845185, -0.216506, 0.226467,  0.4751,
-      -0.8707,   -0.1273,   0.041667,  0.166667,  -0.867514, -0.216506,
-      0.114211,  0.4876,    -0.8707,   -0.0642,   0.020833,  0.166667,
-      -0.845185, -0.216506, 0.226467,  0.4751,    -0.8707,   -0.1273,
-      0.041667,  0.166667,  -0.965926, -0.250000, 0.258819,  -0.0104,
-      -0.9999,   0.0028,    0.041667,  0.250000,  -0.991445, -0.250000,
-      0.130526,  -0.0107,   -0.9999,   0.0014,    0.020833,  0.250000,
-      -0.965926, -0.250000, 0.258819,  -0.0104,   -0.9999,   0.0028,
-      0.041667,  0.250000,  -1.086667, -0.216506, 0.291171,  -0.4907,
-      -0.8614,   0.1315,    0.041667,  0.333333,  -1.115375, -0.216506,
-      0.146842,  -0.5036,   -0.8614,   0.0663,    0.020833,  0.333333,
-      -1.086667, -0.216506, 0.291171,  -0.4907,   -0.8614,   0.1315,
-      0.041667,  0.333333,  -1.175055, -0.125000, 0.314855,  -0.8391,
-      -0.4954,   0.2248,    0.041667,  0.416667,  -1.206099, -0.125000,
-      0.158786,  -0.8612,   -0.4954,   0.1134,    0.020833,  0.416667,
-      -1.206099, -0.125000, 0.158786,  -0.8612,   -0.4954,   0.1134,
-      0.020833,  0.416667,  -1.175055, -0.125000, 0.314855,  -0.8391,
-      -0.4954,   0.2248,    0.041667,  0.416667,  -1.207407, 0.000000,
-      0.323524,  -0.9659,   -0.0000,   0.2588,    0.041667,  0.500000,
-      -1.154850, 0.000000,  0.478354,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -1.123906, 0.125000,  0.465536,  -0.8025,
-      0.4954,    0.3324,    0.062500,  0.583333,  -1.175055, 0.125000,
-      0.314855,  -0.8391,   0.4954,    0.2248,    0.041667,  0.583333,
-      -1.123906, 0.125000,  0.465536,  -0.8025,   0.4954,    0.3324,
-      0.062500,  0.583333,  -1.039365, 0.216506,  0.430518,  -0.4693,
-      0.8614,    0.1944,    0.062500,  0.666667,  -1.086667, 0.216506,
-      0.291171,  -0.4907,   0.8614,    0.1315,    0.041667,  0.666667,
-      -1.086667, 0.216506,  0.291171,  -0.4907,   0.8614,    0.1315,
-      0.041667,  0.666667,  -1.039365, 0.216506,  0.430518,  -0.4693,
-      0.8614,    0.1944,    0.062500,  0.666667,  -0.923880, 0.250000,
-      0.382683,  -0.0100,   0.9999,    0.0041,    0.062500,  0.750000,
-      -0.923880, 0.250000,  0.382683,  -0.0100,   0.9999,    0.0041,
-      0.062500,  0.750000,  -0.808395, 0.216506,  0.334848,  0.4544,
-      0.8707,    -0.1882,   0.062500,  0.833333,  -0.845185, 0.216506,
-      0.226467,  0.4751,    0.8707,    -0.1273,   0.041667,  0.833333,
-      -0.808395, 0.216506,  0.334848,  0.4544,    0.8707,    -0.1882,
-      0.062500,  0.833333,  -0.723854, 0.125000,  0.299830,  0.7976,
-      0.5047,    -0.3304,   0.062500,  0.916667,  -0.756797, 0.125000,
-      0.202783,  0.8339,    0.5047,    -0.2234,   0.041667,  0.916667,
-      -0.723854, 0.125000,  0.299830,  0.7976,    0.5047,    -0.3304,
-      0.062500,  0.916667,  -0.692910, 0.000000,  0.287012,  0.9239,
-      -0.0000,   -0.3827,   0.062500,  1.000000,  -0.724444, 0.000000,
-      0.194114,  0.9659,    -0.0000,   -0.2588,   0.041667,  1.000000,
-      -0.692910, 0.000000,  0.287012,  0.9239,    -0.0000,   -0.3827,
-      0.062500,  0.000000,  -0.723854, -0.125000, 0.299830,  0.7976,
-      -0.5047,   -0.3304,   0.062500,  0.083333,  -0.756797, -0.125000,
-      0.202783,  0.8339,    -0.5047,   -0.2234,   0.041667,  0.083333,
-      -0.756797, -0.125000, 0.202783,  0.8339,    -0.5047,   -0.2234,
-      0.041667,  0.083333,  -0.723854, -0.125000, 0.299830,  0.7976,
-      -0.5047,   -0.3304,   0.062500,  0.083333,  -0.808395, -0.216506,
-      0.334848,  0.4544,    -0.8707,   -0.1882,   0.062500,  0.166667,
-      -0.808395, -0.216506, 0.334848,  0.4544,    -0.8707,   -0.1882,
-      0.062500,  0.166667,  -0.923880, -0.250000, 0.382683,  -0.0100,
-      -0.9999,   0.0041,    0.062500,  0.250000,  -0.965926, -0.250000,
-      0.258819,  -0.0104,   -0.9999,   0.0028,    0.041667,  0.250000,
-      -0.923880, -0.250000, 0.382683,  -0.0100,   -0.9999,   0.0041,
-      0.062500,  0.250000,  -1.039365, -0.216506, 0.430518,  -0.4693,
-      -0.8614,   0.1944,    0.062500,  0.333333,  -1.086667, -0.216506,
-      0.291171,  -0.4907,   -0.8614,   0.1315,    0.041667,  0.333333,
-      -1.086667, -0.216506, 0.291171,  -0.4907,   -0.8614,   0.1315,
-      0.041667,  0.333333,  -1.039365, -0.216506, 0.430518,  -0.4693,
-      -0.8614,   0.1944,    0.062500,  0.333333,  -1.123906, -0.125000,
-      0.465536,  -0.8025,   -0.4954,   0.3324,    0.062500,  0.416667,
-      -1.175055, -0.125000, 0.314855,  -0.8391,   -0.4954,   0.2248,
-      0.041667,  0.416667,  -1.123906, -0.125000, 0.465536,  -0.8025,
-      -0.4954,   0.3324,    0.062500,  0.416667,  -1.154850, 0.000000,
-      0.478354,  -0.9239,   -0.0000,   0.3827,    0.062500,  0.500000,
-      -1.082532, 0.000000,  0.625000,  -0.8660,   -0.0000,   0.5000,
-      0.083333,  0.500000,  -1.053526, 0.125000,  0.608253,  -0.7523,
-      0.4954,    0.4343,    0.083333,  0.583333,  -1.123906, 0.125000,
-      0.465536,  -0.8025,   0.4954,    0.3324,    0.062500,  0.583333,
-      -1.053526, 0.125000,  0.608253,  -0.7523,   0.4954,    0.4343,
-      0.083333,  0.583333,  -0.974279, 0.216506,  0.562500,  -0.4399,
-      0.8614,    0.2540,    0.083333,  0.666667,  -1.039365, 0.216506,
-      0.430518,  -0.4693,   0.8614,    0.1944,    0.062500,  0.666667,
-      -0.974279, 0.216506,  0.562500,  -0.4399,   0.8614,    0.2540,
-      0.083333,  0.666667,  -0.866026, 0.250000,  0.500000,  -0.0093,
-      0.9999,    0.0054,    0.083333,  0.750000,  -0.923880, 0.250000,
-      0.382683,  -0.0100,   0.9999,    0.0041,    0.062500,  0.750000,
-      -0.866026, 0.250000,  0.500000,  -0.0093,   0.9999,    0.0054,
-      0.083333,  0.750000,  -0.757772, 0.216506,  0.437500,  0.4259,
-      0.8707,    -0.2459,   0.083333,  0.833333,  -0.808395, 0.216506,
-      0.334848,  0.4544,    0.8707,    -0.1882,   0.062500,  0.833333,
-      -0.757772, 0.216506,  0.437500,  0.4259,    0.8707,    -0.2459,
-      0.083333,  0.833333,  -0.678525, 0.125000,  0.391747,  0.7476,
-      0.5047,    -0.4316,   0.083333,  0.916667,  -0.723854, 0.125000,
-      0.299830,  0.7976,    0.5047,    -0.3304,   0.062500,  0.916667,
-      -0.723854, 0.125000,  0.299830,  0.7976,    0.5047,    -0.3304,
-      0.062500,  0.916667,  -0.678525, 0.125000,  0.391747,  0.7476,
-      0.5047,    -0.4316,   0.083333,  0.916667,  -0.649519, 0.000000,
-      0.375000,  0.8660,    -0.0000,   -0.5000,   0.083333,  1.000000,
-      -0.649519, 0.000000,  0.375000,  0.8660,    -0.0000,   -0.5000,
-      0.083333,  0.000000,  -0.678525, -0.125000, 0.391747,  0.7476,
-      -0.5047,   -0.4316,   0.083333,  0.083333,  -0.723854, -0.125000,
-      0.299830,  0.7976,    -0.5047,   -0.3304,   0.062500,  0.083333,
-      -0.678525, -0.125000, 0.391747,  0.7476,    -0.5047,   -0.4316,
-      0.083333,  0.083333,  -0.757772, -0.216506, 0.437500,  0.4259,
-      -0.8707,   -0.2459,   0.083333,  0.166667,  -0.808395, -0.216506,
-      0.334848,  0.4544,    -0.8707,   -0.1882,   0.062500,  0.166667,
-      -0.757772, -0.216506, 0.437500,  0.4259,    -0.8707,   -0.2459,
-      0.083333,  0.166667,  -0.866026, -0.250000, 0.500000,  -0.0093,
-      -0.9999,   0.0054,    0.083333,  0.250000,  -0.923880, -0.250000,
-      0.382683,  -0.0100,   -0.9999,   0.0041,    0.062500,  0.250000,
-      -0.923880, -0.250000, 0.382683,  -0.0100,   -0.9999,   0.0041,
-      0.062500,  0.250000,  -0.866026, -0.250000, 0.500000,  -0.0093,
-      -0.9999,   0.0054,    0.083333,  0.250000,  -0.974279, -0.216506,
-      0.562500,  -0.4399,   -0.8614,   0.2540,    0.083333,  0.333333,
-      -1.039365, -0.216506, 0.430518,  -0.4693,   -0.8614,   0.1944,
-      0.062500,  0.333333,  -0.974279, -0.216506, 0.562500,  -0.4399,
-      -0.8614,   0.2540,    0.083333,  0.333333,  -1.053526, -0.125000,
-      0.608253,  -0.7523,   -0.4954,   0.4343,    0.083333,  0.416667,
-      -1.053526, -0.125000, 0.608253,  -0.7523,   -0.4954,   0.4343,
-      0.083333,  0.416667,  -1.082532, 0.000000,  0.625000,  -0.8660,
-      -0.0000,   0.5000,    0.083333,  0.500000,  -1.154850, 0.000000,
-      0.478354,  -0.9239,   -0.0000,   0.3827,    0.062500,  0.500000,
-      -0.991692, 0.000000,  0.760952,  -0.7934,   -0.0000,   0.6088,
-      0.104167,  0.500000,  -0.965119, 0.125000,  0.740562,  -0.6892,
-      0.4954,    0.5288,    0.104167,  0.583333,  -1.053526, 0.125000,
-      0.608253,  -0.7523,   0.4954,    0.4343,    0.083333,  0.583333,
-      -0.965119, 0.125000,  0.740562,  -0.6892,   0.4954,    0.5288,
-      0.104167,  0.583333,  -0.892522, 0.216506,  0.684857,  -0.4030,
-      0.8614,    0.3092,    0.104167,  0.666667,  -0.974279, 0.216506,
-      0.562500,  -0.4399,   0.8614,    0.2540,    0.083333,  0.666667,
-      -0.892522, 0.216506,  0.684857,  -0.4030,   0.8614,    0.3092,
-      0.104167,  0.666667,  -0.793353, 0.250000,  0.608761,  -0.0086,
-      0.9999,    0.0066,    0.104167,  0.750000,  -0.866026, 0.250000,
-      0.500000,  -0.0093,   0.9999,    0.0054,    0.083333,  0.750000,
-      -0.866026, 0.250000,  0.500000,  -0.0093,   0.9999,    0.0054,
-      0.083333,  0.750000,  -0.793353, 0.250000,  0.608761,  -0.0086,
-      0.9999,    0.0066,    0.104167,  0.750000,  -0.694184, 0.216506,
-      0.532666,  0.3902,    0.8707,    -0.2994,   0.104167,  0.833333,
-      -0.694184, 0.216506,  0.532666,  0.3902,    0.8707,    -0.2994,
-      0.104167,  0.833333,  -0.621587, 0.125000,  0.476961,  0.6849,
-      0.5047,    -0.5255,   0.104167,  0.916667,  -0.678525, 0.125000,
-      0.391747,  0.7476,    0.5047,    -0.4316,   0.083333,  0.916667,
-      -0.621587, 0.125000,  0.476961,  0.6849,    0.5047,    -0.5255,
-      0.104167,  0.916667,  -0.595015, 0.000000,  0.456571,  0.7934,
-      -0.0000,   -0.6088,   0.104167,  1.000000,  -0.649519, 0.000000,
-      0.375000,  0.8660,    -0.0000,   -0.5000,   0.083333,  1.000000,
-      -0.595015, 0.000000,  0.456571,  0.7934,    -0.0000,   -0.6088,
-      0.104167,  0.000000,  -0.621587, -0.125000, 0.476961,  0.6849,
-      -0.5047,   -0.5255,   0.104167,  0.083333,  -0.678525, -0.125000,
-      0.391747,  0.7476,    -0.5047,   -0.4316,   0.083333,  0.083333,
-      -0.678525, -0.125000, 0.391747,  0.7476,    -0.5047,   -0.4316,
-      0.083333,  0.083333,  -0.621587, -0.125000, 0.476961,  0.6849,
-      -0.5047,   -0.5255,   0.104167,  0.083333,  -0.694184, -0.216506,
-      0.532666,  0.3902,    -0.8707,   -0.2994,   0.104167,  0.166667,
-      -0.694184, -0.216506, 0.532666,  0.3902,    -0.8707,   -0.2994,
-      0.104167,  0.166667,  -0.793353, -0.250000, 0.608761,  -0.0086,
-      -0.9999,   0.0066,    0.104167,  0.250000,  -0.866026, -0.250000,
-      0.500000,  -0.0093,   -0.9999,   0.0054,    0.083333,  0.250000,
-      -0.793353, -0.250000, 0.608761,  -0.0086,   -0.9999,   0.0066,
-      0.104167,  0.250000,  -0.892522, -0.216506, 0.684857,  -0.4030,
-      -0.8614,   0.3092,    0.104167,  0.333333,  -0.974279, -0.216506,
-      0.562500,  -0.4399,   -0.8614,   0.2540,    0.083333,  0.333333,
-      -0.974279, -0.216506, 0.562500,  -0.4399,   -0.8614,   0.2540,
-      0.083333,  0.333333,  -0.892522, -0.216506, 0.684857,  -0.4030,
-      -0.8614,   0.3092,    0.104167,  0.333333,  -0.965119, -0.125000,
-      0.740562,  -0.6892,   -0.4954,   0.5288,    0.104167,  0.416667,
-      -0.965119, -0.125000, 0.740562,  -0.6892,   -0.4954,   0.5288,
-      0.104167,  0.416667,  -0.991692, 0.000000,  0.760952,  -0.7934,
-      -0.0000,   0.6088,    0.104167,  0.500000,  -1.082532, 0.000000,
-      0.625000,  -0.8660,   -0.0000,   0.5000,    0.083333,  0.500000,
-      -0.883884, 0.000000,  0.883883,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.860200, 0.125000,  0.860200,  -0.6142,
-      0.4954,    0.6142,    0.125000,  0.583333,  -0.965119, 0.125000,
-      0.740562,  -0.6892,   0.4954,    0.5288,    0.104167,  0.583333,
-      -0.965119, 0.125000,  0.740562,  -0.6892,   0.4954,    0.5288,
-      0.104167,  0.583333,  -0.860200, 0.125000,  0.860200,  -0.6142,
-      0.4954,    0.6142,    0.125000,  0.583333,  -0.795495, 0.216506,
-      0.795495,  -0.3592,   0.8614,    0.3592,    0.125000,  0.666667,
-      -0.795495, 0.216506,  0.795495,  -0.3592,   0.8614,    0.3592,
-      0.125000,  0.666667,  -0.707107, 0.250000,  0.707107,  -0.0076,
-      0.9999,    0.0076,    0.125000,  0.750000,  -0.793353, 0.250000,
-      0.608761,  -0.0086,   0.9999,    0.0066,    0.104167,  0.750000,
-      -0.707107, 0.250000,  0.707107,  -0.0076,   0.9999,    0.0076,
-      0.125000,  0.750000,  -0.618719, 0.216506,  0.618718,  0.3478,
-      0.8707,    -0.3478,   0.125000,  0.833333,  -0.694184, 0.216506,
-      0.532666,  0.3902,    0.8707,    -0.2994,   0.104167,  0.833333,
-      -0.618719, 0.216506,  0.618718,  0.3478,    0.8707,    -0.3478,
-      0.125000,  0.833333,  -0.554014, 0.125000,  0.554013,  0.6104,
-      0.5047,    -0.6104,   0.125000,  0.916667,  -0.621587, 0.125000,
-      0.476961,  0.6849,    0.5047,    -0.5255,   0.104167,  0.916667,
-      -0.554014, 0.125000,  0.554013,  0.6104,    0.5047,    -0.6104,
-      0.125000,  0.916667,  -0.530330, 0.000000,  0.530330,  0.7071,
-      -0.0000,   -0.7071,   0.125000,  1.000000,  -0.595015, 0.000000,
-      0.456571,  0.7934,    -0.0000,   -0.6088,   0.104167,  1.000000,
-      -0.530330, 0.000000,  0.530330,  0.7071,    -0.0000,   -0.7071,
-      0.125000,  0.000000,  -0.554014, -0.125000, 0.554013,  0.6104,
-      -0.5047,   -0.6104,   0.125000,  0.083333,  -0.621587, -0.125000,
-      0.476961,  0.6849,    -0.5047,   -0.5255,   0.104167,  0.083333,
-      -0.554014, -0.125000, 0.554013,  0.6104,    -0.5047,   -0.6104,
-      0.125000,  0.083333,  -0.618719, -0.216506, 0.618718,  0.3478,
-      -0.8707,   -0.3478,   0.125000,  0.166667,  -0.694184, -0.216506,
-      0.532666,  0.3902,    -0.8707,   -0.2994,   0.104167,  0.166667,
-      -0.694184, -0.216506, 0.532666,  0.3902,    -0.8707,   -0.2994,
-      0.104167,  0.166667,  -0.618719, -0.216506, 0.618718,  0.3478,
-      -0.8707,   -0.3478,   0.125000,  0.166667,  -0.707107, -0.250000,
-      0.707107,  -0.0076,   -0.9999,   0.0076,    0.125000,  0.250000,
-      -0.707107, -0.250000, 0.707107,  -0.0076,   -0.9999,   0.0076,
-      0.125000,  0.250000,  -0.795495, -0.216506, 0.795495,  -0.3592,
-      -0.8614,   0.3592,    0.125000,  0.333333,  -0.892522, -0.216506,
-      0.684857,  -0.4030,   -0.8614,   0.3092,    0.104167,  0.333333,
-      -0.795495, -0.216506, 0.795495,  -0.3592,   -0.8614,   0.3592,
-      0.125000,  0.333333,  -0.860200, -0.125000, 0.860200,  -0.6142,
-      -0.4954,   0.6142,    0.125000,  0.416667,  -0.965119, -0.125000,
-      0.740562,  -0.6892,   -0.4954,   0.5288,    0.104167,  0.416667,
-      -0.860200, -0.125000, 0.860200,  -0.6142,   -0.4954,   0.6142,
-      0.125000,  0.416667,  -0.883884, 0.000000,  0.883883,  -0.7071,
-      -0.0000,   0.7071,    0.125000,  0.500000,  -0.991692, 0.000000,
-      0.760952,  -0.7934,   -0.0000,   0.6088,    0.104167,  0.500000,
-      -0.883884, 0.000000,  0.883883,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.760952, 0.000000,  0.991691,  -0.6088,
-      -0.0000,   0.7934,    0.145833,  0.500000,  -0.740563, 0.125000,
-      0.965119,  -0.5288,   0.4954,    0.6892,    0.145833,  0.583333,
-      -0.860200, 0.125000,  0.860200,  -0.6142,   0.4954,    0.6142,
-      0.125000,  0.583333,  -0.740563, 0.125000,  0.965119,  -0.5288,
-      0.4954,    0.6892,    0.145833,  0.583333,  -0.684857, 0.216506,
-      0.892522,  -0.3093,   0.8614,    0.4030,    0.145833,  0.666667,
-      -0.684857, 0.216506,  0.892522,  -0.3093,   0.8614,    0.4030,
-      0.145833,  0.666667,  -0.608762, 0.250000,  0.793353,  -0.0066,
-      0.9999,    0.0086,    0.145833,  0.750000,  -0.707107, 0.250000,
-      0.707107,  -0.0076,   0.9999,    0.0076,    0.125000,  0.750000,
-      -0.707107, 0.250000,  0.707107,  -0.0076,   0.9999,    0.0076,
-      0.125000,  0.750000,  -0.608762, 0.250000,  0.793353,  -0.0066,
-      0.9999,    0.0086,    0.145833,  0.750000,  -0.532667, 0.216506,
-      0.694184,  0.2994,    0.8707,    -0.3902,   0.145833,  0.833333,
-      -0.532667, 0.216506,  0.694184,  0.2994,    0.8707,    -0.3902,
-      0.145833,  0.833333,  -0.476961, 0.125000,  0.621587,  0.5255,
-      0.5047,    -0.6849,   0.145833,  0.916667,  -0.554014, 0.125000,
-      0.554013,  0.6104,    0.5047,    -0.6104,   0.125000,  0.916667,
-      -0.476961, 0.125000,  0.621587,  0.5255,    0.5047,    -0.6849,
-      0.145833,  0.916667,  -0.456571, 0.000000,  0.595015,  0.6088,
-      -0.0000,   -0.7934,   0.145833,  1.000000,  -0.530330, 0.000000,
-      0.530330,  0.7071,    -0.0000,   -0.7071,   0.125000,  1.000000,
-      -0.456571, 0.000000,  0.595015,  0.6088,    -0.0000,   -0.7934,
-      0.145833,  0.000000,  -0.476961, -0.125000, 0.621587,  0.5255,
-      -0.5047,   -0.6849,   0.145833,  0.083333,  -0.554014, -0.125000,
-      0.554013,  0.6104,    -0.5047,   -0.6104,   0.125000,  0.083333,
-      -0.476961, -0.125000, 0.621587,  0.5255,    -0.5047,   -0.6849,
-      0.145833,  0.083333,  -0.532667, -0.216506, 0.694184,  0.2994,
-      -0.8707,   -0.3902,   0.145833,  0.166667,  -0.618719, -0.216506,
-      0.618718,  0.3478,    -0.8707,   -0.3478,   0.125000,  0.166667,
-      -0.532667, -0.216506, 0.694184,  0.2994,    -0.8707,   -0.3902,
-      0.145833,  0.166667,  -0.608762, -0.250000, 0.793353,  -0.0066,
-      -0.9999,   0.0086,    0.145833,  0.250000,  -0.707107, -0.250000,
-      0.707107,  -0.0076,   -0.9999,   0.0076,    0.125000,  0.250000,
-      -0.608762, -0.250000, 0.793353,  -0.0066,   -0.9999,   0.0086,
-      0.145833,  0.250000,  -0.684857, -0.216506, 0.892522,  -0.3093,
-      -0.8614,   0.4030,    0.145833,  0.333333,  -0.795495, -0.216506,
-      0.795495,  -0.3592,   -0.8614,   0.3592,    0.125000,  0.333333,
-      -0.684857, -0.216506, 0.892522,  -0.3093,   -0.8614,   0.4030,
-      0.145833,  0.333333,  -0.740563, -0.125000, 0.965119,  -0.5288,
-      -0.4954,   0.6892,    0.145833,  0.416667,  -0.860200, -0.125000,
-      0.860200,  -0.6142,   -0.4954,   0.6142,    0.125000,  0.416667,
-      -0.740563, -0.125000, 0.965119,  -0.5288,   -0.4954,   0.6892,
-      0.145833,  0.416667,  -0.760952, 0.000000,  0.991691,  -0.6088,
-      -0.0000,   0.7934,    0.145833,  0.500000,  -0.883884, 0.000000,
-      0.883883,  -0.7071,   -0.0000,   0.7071,    0.125000,  0.500000,
-      -0.760952, 0.000000,  0.991691,  -0.6088,   -0.0000,   0.7934,
-      0.145833,  0.500000,  -0.625000, 0.000000,  1.082532,  -0.5000,
-      -0.0000,   0.8660,    0.166667,  0.500000,  -0.608253, 0.125000,
-      1.053526,  -0.4343,   0.4954,    0.7523,    0.166667,  0.583333,
-      -0.608253, 0.125000,  1.053526,  -0.4343,   0.4954,    0.7523,
-      0.166667,  0.583333,  -0.562500, 0.216506,  0.974279,  -0.2540,
-      0.8614,    0.4399,    0.166667,  0.666667,  -0.684857, 0.216506,
-      0.892522,  -0.3093,   0.8614,    0.4030,    0.145833,  0.666667,
-      -0.562500, 0.216506,  0.974279,  -0.2540,   0.8614,    0.4399,
-      0.166667,  0.666667,  -0.500000, 0.250000,  0.866026,  -0.0054,
-      0.9999,    0.0093,    0.166667,  0.750000,  -0.608762, 0.250000,
-      0.793353,  -0.0066,   0.9999,    0.0086,    0.145833,  0.750000,
-      -0.500000, 0.250000,  0.866026,  -0.0054,   0.9999,    0.0093,
-      0.166667,  0.750000,  -0.437500, 0.216506,  0.757772,  0.2459,
-      0.8707,    -0.4259,   0.166667,  0.833333,  -0.532667, 0.216506,
-      0.694184,  0.2994,    0.8707,    -0.3902,   0.145833,  0.833333,
-      -0.532667, 0.216506,  0.694184,  0.2994,    0.8707,    -0.3902,
-      0.145833,  0.833333,  -0.437500, 0.216506,  0.757772,  0.2459,
-      0.8707,    -0.4259,   0.166667,  0.833333,  -0.391747, 0.125000,
-      0.678525,  0.4316,    0.5047,    -0.7476,   0.166667,  0.916667,
-      -0.391747, 0.125000,  0.678525,  0.4316,    0.5047,    -0.7476,
-      0.166667,  0.916667,  -0.375000, 0.000000,  0.649519,  0.5000,
-      -0.0000,   -0.8660,   0.166667,  1.000000,  -0.456571, 0.000000,
-      0.595015,  0.6088,    -0.0000,   -0.7934,   0.145833,  1.000000,
-      -0.375000, 0.000000,  0.649519,  0.5000,    -0.0000,   -0.8660,
-      0.166667,  0.000000,  -0.391747, -0.125000, 0.678525,  0.4316,
-      -0.5047,   -0.7476,   0.166667,  0.083333,  -0.476961, -0.125000,
-      0.621587,  0.5255,    -0.5047,   -0.6849,   0.145833,  0.083333,
-      -0.391747, -0.125000, 0.678525,  0.4316,    -0.5047,   -0.7476,
-      0.166667,  0.083333,  -0.437500, -0.216506, 0.757772,  0.2459,
-      -0.8707,   -0.4259,   0.166667,  0.166667,  -0.532667, -0.216506,
-      0.694184,  0.2994,    -0.8707,   -0.3902,   0.145833,  0.166667,
-      -0.437500, -0.216506, 0.757772,  0.2459,    -0.8707,   -0.4259,
-      0.166667,  0.166667,  -0.500000, -0.250000, 0.866026,  -0.0054,
-      -0.9999,   0.0093,    0.166667,  0.250000,  -0.608762, -0.250000,
-      0.793353,  -0.0066,   -0.9999,   0.0086,    0.145833,  0.250000,
-      -0.608762, -0.250000, 0.793353,  -0.0066,   -0.9999,   0.0086,
-      0.145833,  0.250000,  -0.500000, -0.250000, 0.866026,  -0.0054,
-      -0.9999,   0.0093,    0.166667,  0.250000,  -0.562500, -0.216506,
-      0.974279,  -0.2540,   -0.8614,   0.4399,    0.166667,  0.333333,
-      -0.684857, -0.216506, 0.892522,  -0.3093,   -0.8614,   0.4030,
-      0.145833,  0.333333,  -0.562500, -0.216506, 0.974279,  -0.2540,
-      -0.8614,   0.4399,    0.166667,  0.333333,  -0.608253, -0.125000,
-      1.053526,  -0.4343,   -0.4954,   0.7523,    0.166667,  0.416667,
-      -0.608253, -0.125000, 1.053526,  -0.4343,   -0.4954,   0.7523,
-      0.166667,  0.416667,  -0.625000, 0.000000,  1.082532,  -0.5000,
-      -0.0000,   0.8660,    0.166667,  0.500000,  -0.760952, 0.000000,
-      0.991691,  -0.6088,   -0.0000,   0.7934,    0.145833,  0.500000,
-      -0.478354, 0.000000,  1.154849,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.465537, 0.125000,  1.123905,  -0.3324,
-      0.4954,    0.8025,    0.187500,  0.583333,  -0.608253, 0.125000,
-      1.053526,  -0.4343,   0.4954,    0.7523,    0.166667,  0.583333,
-      -0.465537, 0.125000,  1.123905,  -0.3324,   0.4954,    0.8025,
-      0.187500,  0.583333,  -0.430519, 0.216506,  1.039364,  -0.1944,
-      0.8614,    0.4693,    0.187500,  0.666667,  -0.562500, 0.216506,
-      0.974279,  -0.2540,   0.8614,    0.4399,    0.166667,  0.666667,
-      -0.430519, 0.216506,  1.039364,  -0.1944,   0.8614,    0.4693,
-      0.187500,  0.666667,  -0.382684, 0.250000,  0.923880,  -0.0041,
-      0.9999,    0.0100,    0.187500,  0.750000,  -0.500000, 0.250000,
-      0.866026,  -0.0054,   0.9999,    0.0093,    0.166667,  0.750000,
-      -0.382684, 0.250000,  0.923880,  -0.0041,   0.9999,    0.0100,
-      0.187500,  0.750000,  -0.334848, 0.216506,  0.808395,  0.1882,
-      0.8707,    -0.4544,   0.187500,  0.833333,  -0.437500, 0.216506,
-      0.757772,  0.2459,    0.8707,    -0.4259,   0.166667,  0.833333,
-      -0.334848, 0.216506,  0.808395,  0.1882,    0.8707,    -0.4544,
-      0.187500,  0.833333,  -0.299830, 0.125000,  0.723854,  0.3304,
-      0.5047,    -0.7976,   0.187500,  0.916667,  -0.391747, 0.125000,
-      0.678525,  0.4316,    0.5047,    -0.7476,   0.166667,  0.916667,
-      -0.299830, 0.125000,  0.723854,  0.3304,    0.5047,    -0.7976,
-      0.187500,  0.916667,  -0.287013, 0.000000,  0.692910,  0.3827,
-      -0.0000,   -0.9239,   0.187500,  1.000000,  -0.375000, 0.000000,
-      0.649519,  0.5000,    -0.0000,   -0.8660,   0.166667,  1.000000,
-      -0.287013, 0.000000,  0.692910,  0.3827,    -0.0000,   -0.9239,
-      0.187500,  0.000000,  -0.299830, -0.125000, 0.723854,  0.3304,
-      -0.5047,   -0.7976,   0.187500,  0.083333,  -0.391747, -0.125000,
-      0.678525,  0.4316,    -0.5047,   -0.7476,   0.166667,  0.083333,
-      -0.299830, -0.125000, 0.723854,  0.3304,    -0.5047,   -0.7976,
-      0.187500,  0.083333,  -0.334848, -0.216506, 0.808395,  0.1882,
-      -0.8707,   -0.4544,   0.187500,  0.166667,  -0.437500, -0.216506,
-      0.757772,  0.2459,    -0.8707,   -0.4259,   0.166667,  0.166667,
-      -0.437500, -0.216506, 0.757772,  0.2459,    -0.8707,   -0.4259,
-      0.166667,  0.166667,  -0.334848, -0.216506, 0.808395,  0.1882,
-      -0.8707,   -0.4544,   0.187500,  0.166667,  -0.382684, -0.250000,
-      0.923880,  -0.0041,   -0.9999,   0.0100,    0.187500,  0.250000,
-      -0.382684, -0.250000, 0.923880,  -0.0041,   -0.9999,   0.0100,
-      0.187500,  0.250000,  -0.430519, -0.216506, 1.039364,  -0.1944,
-      -0.8614,   0.4693,    0.187500,  0.333333,  -0.562500, -0.216506,
-      0.974279,  -0.2540,   -0.8614,   0.4399,    0.166667,  0.333333,
-      -0.562500, -0.216506, 0.974279,  -0.2540,   -0.8614,   0.4399,
-      0.166667,  0.333333,  -0.430519, -0.216506, 1.039364,  -0.1944,
-      -0.8614,   0.4693,    0.187500,  0.333333,  -0.465537, -0.125000,
-      1.123905,  -0.3324,   -0.4954,   0.8025,    0.187500,  0.416667,
-      -0.465537, -0.125000, 1.123905,  -0.3324,   -0.4954,   0.8025,
-      0.187500,  0.416667,  -0.478354, 0.000000,  1.154849,  -0.3827,
-      -0.0000,   0.9239,    0.187500,  0.500000,  -0.625000, 0.000000,
-      1.082532,  -0.5000,   -0.0000,   0.8660,    0.166667,  0.500000,
-      -0.323524, 0.000000,  1.207407,  -0.2588,   -0.0000,   0.9659,
-      0.208333,  0.500000,  -0.314855, 0.125000,  1.175055,  -0.2248,
-      0.4954,    0.8391,    0.208333,  0.583333,  -0.465537, 0.125000,
-      1.123905,  -0.3324,   0.4954,    0.8025,    0.187500,  0.583333,
-      -0.314855, 0.125000,  1.175055,  -0.2248,   0.4954,    0.8391,
-      0.208333,  0.583333,  -0.291172, 0.216506,  1.086666,  -0.1315,
-      0.8614,    0.4907,    0.208333,  0.666667,  -0.430519, 0.216506,
-      1.039364,  -0.1944,   0.8614,    0.4693,    0.187500,  0.666667,
-      -0.291172, 0.216506,  1.086666,  -0.1315,   0.8614,    0.4907,
-      0.208333,  0.666667,  -0.258819, 0.250000,  0.965926,  -0.0028,
-      0.9999,    0.0104,    0.208333,  0.750000,  -0.382684, 0.250000,
-      0.923880,  -0.0041,   0.9999,    0.0100,    0.187500,  0.750000,
-      -0.258819, 0.250000,  0.965926,  -0.0028,   0.9999,    0.0104,
-      0.208333,  0.750000,  -0.226467, 0.216506,  0.845185,  0.1273,
-      0.8707,    -0.4751,   0.208333,  0.833333,  -0.334848, 0.216506,
-      0.808395,  0.1882,    0.8707,    -0.4544,   0.187500,  0.833333,
-      -0.334848, 0.216506,  0.808395,  0.1882,    0.8707,    -0.4544,
-      0.187500,  0.833333,  -0.226467, 0.216506,  0.845185,  0.1273,
-      0.8707,    -0.4751,   0.208333,  0.833333,  -0.202783, 0.125000,
-      0.756797,  0.2234,    0.5047,    -0.8339,   0.208333,  0.916667,
-      -0.202783, 0.125000,  0.756797,  0.2234,    0.5047,    -0.8339,
-      0.208333,  0.916667,  -0.194115, 0.000000,  0.724444,  0.2588,
-      -0.0000,   -0.9659,   0.208333,  1.000000,  -0.287013, 0.000000,
-      0.692910,  0.3827,    -0.0000,   -0.9239,   0.187500,  1.000000,
-      -0.194115, 0.000000,  0.724444,  0.2588,    -0.0000,   -0.9659,
-      0.208333,  0.000000,  -0.202783, -0.125000, 0.756797,  0.2234,
-      -0.5047,   -0.8339,   0.208333,  0.083333,  -0.299830, -0.125000,
-      0.723854,  0.3304,    -0.5047,   -0.7976,   0.187500,  0.083333,
-      -0.202783, -0.125000, 0.756797,  0.2234,    -0.5047,   -0.8339,
-      0.208333,  0.083333,  -0.226467, -0.216506, 0.845185,  0.1273,
-      -0.8707,   -0.4751,   0.208333,  0.166667,  -0.334848, -0.216506,
-      0.808395,  0.1882,    -0.8707,   -0.4544,   0.187500,  0.166667,
-      -0.226467, -0.216506, 0.845185,  0.1273,    -0.8707,   -0.4751,
-      0.208333,  0.166667,  -0.258819, -0.250000, 0.965926,  -0.0028,
-      -0.9999,   0.0104,    0.208333,  0.250000,  -0.382684, -0.250000,
-      0.923880,  -0.0041,   -0.9999,   0.0100,    0.187500,  0.250000,
-      -0.258819, -0.250000, 0.965926,  -0.0028,   -0.9999,   0.0104,
-      0.208333,  0.250000,  -0.291172, -0.216506, 1.086666,  -0.1315,
-      -0.8614,   0.4907,    0.208333,  0.333333,  -0.430519, -0.216506,
-      1.039364,  -0.1944,   -0.8614,   0.4693,    0.187500,  0.333333,
-      -0.430519, -0.216506, 1.039364,  -0.1944,   -0.8614,   0.4693,
-      0.187500,  0.333333,  -0.291172, -0.216506, 1.086666,  -0.1315,
-      -0.8614,   0.4907,    0.208333,  0.333333,  -0.314855, -0.125000,
-      1.175055,  -0.2248,   -0.4954,   0.8391,    0.208333,  0.416667,
-      -0.314855, -0.125000, 1.175055,  -0.2248,   -0.4954,   0.8391,
-      0.208333,  0.416667,  -0.323524, 0.000000,  1.207407,  -0.2588,
-      -0.0000,   0.9659,    0.208333,  0.500000,  -0.478354, 0.000000,
-      1.154849,  -0.3827,   -0.0000,   0.9239,    0.187500,  0.500000,
-      -0.163158, 0.000000,  1.239306,  -0.1305,   -0.0000,   0.9914,
-      0.229167,  0.500000,  -0.158787, 0.125000,  1.206099,  -0.1134,
-      0.4954,    0.8612,    0.229167,  0.583333,  -0.314855, 0.125000,
-      1.175055,  -0.2248,   0.4954,    0.8391,    0.208333,  0.583333,
-      -0.314855, 0.125000,  1.175055,  -0.2248,   0.4954,    0.8391,
-      0.208333,  0.583333,  -0.158787, 0.125000,  1.206099,  -0.1134,
-      0.4954,    0.8612,    0.229167,  0.583333,  -0.146843, 0.216506,
-      1.115375,  -0.0663,   0.8614,    0.5037,    0.229167,  0.666667,
-      -0.146843, 0.216506,  1.115375,  -0.0663,   0.8614,    0.5037,
-      0.229167,  0.666667,  -0.130527, 0.250000,  0.991445,  -0.0014,
-      0.9999,    0.0107,    0.229167,  0.750000,  -0.258819, 0.250000,
-      0.965926,  -0.0028,   0.9999,    0.0104,    0.208333,  0.750000,
-      -0.130527, 0.250000,  0.991445,  -0.0014,   0.9999,    0.0107,
-      0.229167,  0.750000,  -0.114211, 0.216506,  0.867514,  0.0642,
-      0.8707,    -0.4876,   0.229167,  0.833333,  -0.226467, 0.216506,
-      0.845185,  0.1273,    0.8707,    -0.4751,   0.208333,  0.833333,
-      -0.226467, 0.216506,  0.845185,  0.1273,    0.8707,    -0.4751,
-      0.208333,  0.833333,  -0.114211, 0.216506,  0.867514,  0.0642,
-      0.8707,    -0.4876,   0.229167,  0.833333,  -0.102267, 0.125000,
-      0.776791,  0.1127,    0.5047,    -0.8559,   0.229167,  0.916667,
-      -0.102267, 0.125000,  0.776791,  0.1127,    0.5047,    -0.8559,
-      0.229167,  0.916667,  -0.097895, 0.000000,  0.743584,  0.1305,
-      -0.0000,   -0.9914,   0.229167,  1.000000,  -0.194115, 0.000000,
-      0.724444,  0.2588,    -0.0000,   -0.9659,   0.208333,  1.000000,
-      -0.097895, 0.000000,  0.743584,  0.1305,    -0.0000,   -0.9914,
-      0.229167,  0.000000,  -0.102267, -0.125000, 0.776791,  0.1127,
-      -0.5047,   -0.8559,   0.229167,  0.083333,  -0.202783, -0.125000,
-      0.756797,  0.2234,    -0.5047,   -0.8339,   0.208333,  0.083333,
-      -0.102267, -0.125000, 0.776791,  0.1127,    -0.5047,   -0.8559,
-      0.229167,  0.083333,  -0.114211, -0.216506, 0.867514,  0.0642,
-      -0.8707,   -0.4876,   0.229167,  0.166667,  -0.226467, -0.216506,
-      0.845185,  0.1273,    -0.8707,   -0.4751,   0.208333,  0.166667,
-      -0.226467, -0.216506, 0.845185,  0.1273,    -0.8707,   -0.4751,
-      0.208333,  0.166667,  -0.114211, -0.216506, 0.867514,  0.0642,
-      -0.8707,   -0.4876,   0.229167,  0.166667,  -0.130527, -0.250000,
-      0.991445,  -0.0014,   -0.9999,   0.0107,    0.229167,  0.250000,
-      -0.130527, -0.250000, 0.991445,  -0.0014,   -0.9999,   0.0107,
-      0.229167,  0.250000,  -0.146843, -0.216506, 1.115375,  -0.0663,
-      -0.8614,   0.5037,    0.229167,  0.333333,  -0.291172, -0.216506,
-      1.086666,  -0.1315,   -0.8614,   0.4907,    0.208333,  0.333333,
-      -0.146843, -0.216506, 1.115375,  -0.0663,   -0.8614,   0.5037,
-      0.229167,  0.333333,  -0.158787, -0.125000, 1.206099,  -0.1134,
-      -0.4954,   0.8612,    0.229167,  0.416667,  -0.314855, -0.125000,
-      1.175055,  -0.2248,   -0.4954,   0.8391,    0.208333,  0.416667,
-      -0.158787, -0.125000, 1.206099,  -0.1134,   -0.4954,   0.8612,
-      0.229167,  0.416667,  -0.163158, 0.000000,  1.239306,  -0.1305,
-      -0.0000,   0.9914,    0.229167,  0.500000,  -0.323524, 0.000000,
-      1.207407,  -0.2588,   -0.0000,   0.9659,    0.208333,  0.500000,
-      0.000000,  0.000000,  1.250000,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  0.000000,  0.125000,  1.216506,  -0.0000,
-      0.4954,    0.8687,    0.250000,  0.583333,  -0.158787, 0.125000,
-      1.206099,  -0.1134,   0.4954,    0.8612,    0.229167,  0.583333,
-      0.000000,  0.125000,  1.216506,  -0.0000,   0.4954,    0.8687,
-      0.250000,  0.583333,  0.000000,  0.216506,  1.125000,  -0.0000,
-      0.8614,    0.5080,    0.250000,  0.666667,  -0.146843, 0.216506,
-      1.115375,  -0.0663,   0.8614,    0.5037,    0.229167,  0.666667,
-      -0.146843, 0.216506,  1.115375,  -0.0663,   0.8614,    0.5037,
-      0.229167,  0.666667,  0.000000,  0.216506,  1.125000,  -0.0000,
-      0.8614,    0.5080,    0.250000,  0.666667,  0.000000,  0.250000,
-      1.000000,  -0.0000,   0.9999,    0.0108,    0.250000,  0.750000,
-      -0.130527, 0.250000,  0.991445,  -0.0014,   0.9999,    0.0107,
-      0.229167,  0.750000,  0.000000,  0.250000,  1.000000,  -0.0000,
-      0.9999,    0.0108,    0.250000,  0.750000,  0.000000,  0.216506,
-      0.875000,  -0.0000,   0.8707,    -0.4918,   0.250000,  0.833333,
-      0.000000,  0.216506,  0.875000,  -0.0000,   0.8707,    -0.4918,
-      0.250000,  0.833333,  0.000000,  0.125000,  0.783494,  -0.0000,
-      0.5047,    -0.8633,   0.250000,  0.916667,  -0.102267, 0.125000,
-      0.776791,  0.1127,    0.5047,    -0.8559,   0.229167,  0.916667,
-      -0.102267, 0.125000,  0.776791,  0.1127,    0.5047,    -0.8559,
-      0.229167,  0.916667,  0.000000,  0.125000,  0.783494,  -0.0000,
-      0.5047,    -0.8633,   0.250000,  0.916667,  0.000000,  0.000000,
-      0.750000,  -0.0000,   -0.0000,   -1.0000,   0.250000,  1.000000,
-      0.000000,  0.000000,  0.750000,  -0.0000,   -0.0000,   -1.0000,
-      0.250000,  0.000000,  0.000000,  -0.125000, 0.783494,  -0.0000,
-      -0.5047,   -0.8633,   0.250000,  0.083333,  -0.102267, -0.125000,
-      0.776791,  0.1127,    -0.5047,   -0.8559,   0.229167,  0.083333,
-      0.000000,  -0.125000, 0.783494,  -0.0000,   -0.5047,   -0.8633,
-      0.250000,  0.083333,  0.000000,  -0.216506, 0.875000,  -0.0000,
-      -0.8707,   -0.4918,   0.250000,  0.166667,  -0.114211, -0.216506,
-      0.867514,  0.0642,    -0.8707,   -0.4876,   0.229167,  0.166667,
-      0.000000,  -0.216506, 0.875000,  -0.0000,   -0.8707,   -0.4918,
-      0.250000,  0.166667,  0.000000,  -0.250000, 1.000000,  -0.0000,
-      -0.9999,   0.0108,    0.250000,  0.250000,  -0.130527, -0.250000,
-      0.991445,  -0.0014,   -0.9999,   0.0107,    0.229167,  0.250000,
-      0.000000,  -0.250000, 1.000000,  -0.0000,   -0.9999,   0.0108,
-      0.250000,  0.250000,  0.000000,  -0.216506, 1.125000,  -0.0000,
-      -0.8614,   0.5080,    0.250000,  0.333333,  -0.146843, -0.216506,
-      1.115375,  -0.0663,   -0.8614,   0.5037,    0.229167,  0.333333,
-      0.000000,  -0.216506, 1.125000,  -0.0000,   -0.8614,   0.5080,
-      0.250000,  0.333333,  0.000000,  -0.125000, 1.216506,  -0.0000,
-      -0.4954,   0.8687,    0.250000,  0.416667,  -0.158787, -0.125000,
-      1.206099,  -0.1134,   -0.4954,   0.8612,    0.229167,  0.416667,
-      0.000000,  -0.125000, 1.216506,  -0.0000,   -0.4954,   0.8687,
-      0.250000,  0.416667,  0.000000,  0.000000,  1.250000,  -0.0000,
-      -0.0000,   1.0000,    0.250000,  0.500000,  -0.163158, 0.000000,
-      1.239306,  -0.1305,   -0.0000,   0.9914,    0.229167,  0.500000,
-      0.000000,  0.000000,  1.250000,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  0.163158,  0.000000,  1.239306,  0.1305,
-      -0.0000,   0.9914,    0.270833,  0.500000,  0.158786,  0.125000,
-      1.206099,  0.1134,    0.4954,    0.8612,    0.270833,  0.583333,
-      0.158786,  0.125000,  1.206099,  0.1134,    0.4954,    0.8612,
-      0.270833,  0.583333,  0.146842,  0.216506,  1.115376,  0.0663,
-      0.8614,    0.5037,    0.270833,  0.666667,  0.000000,  0.216506,
-      1.125000,  -0.0000,   0.8614,    0.5080,    0.250000,  0.666667,
-      0.146842,  0.216506,  1.115376,  0.0663,    0.8614,    0.5037,
-      0.270833,  0.666667,  0.130526,  0.250000,  0.991445,  0.0014,
-      0.9999,    0.0107,    0.270833,  0.750000,  0.000000,  0.250000,
-      1.000000,  -0.0000,   0.9999,    0.0108,    0.250000,  0.750000,
-      0.130526,  0.250000,  0.991445,  0.0014,    0.9999,    0.0107,
-      0.270833,  0.750000,  0.114210,  0.216506,  0.867514,  -0.0642,
-      0.8707,    -0.4876,   0.270833,  0.833333,  0.000000,  0.216506,
-      0.875000,  -0.0000,   0.8707,    -0.4918,   0.250000,  0.833333,
-      0.114210,  0.216506,  0.867514,  -0.0642,   0.8707,    -0.4876,
-      0.270833,  0.833333,  0.102266,  0.125000,  0.776791,  -0.1127,
-      0.5047,    -0.8559,   0.270833,  0.916667,  0.000000,  0.125000,
-      0.783494,  -0.0000,   0.5047,    -0.8633,   0.250000,  0.916667,
-      0.102266,  0.125000,  0.776791,  -0.1127,   0.5047,    -0.8559,
-      0.270833,  0.916667,  0.097895,  0.000000,  0.743584,  -0.1305,
-      -0.0000,   -0.9914,   0.270833,  1.000000,  0.000000,  0.000000,
-      0.750000,  -0.0000,   -0.0000,   -1.0000,   0.250000,  1.000000,
-      0.097895,  0.000000,  0.743584,  -0.1305,   -0.0000,   -0.9914,
-      0.270833,  0.000000,  0.102266,  -0.125000, 0.776791,  -0.1127,
-      -0.5047,   -0.8559,   0.270833,  0.083333,  0.000000,  -0.125000,
-      0.783494,  -0.0000,   -0.5047,   -0.8633,   0.250000,  0.083333,
-      0.000000,  -0.125000, 0.783494,  -0.0000,   -0.5047,   -0.8633,
-      0.250000,  0.083333,  0.102266,  -0.125000, 0.776791,  -0.1127,
-      -0.5047,   -0.8559,   0.270833,  0.083333,  0.114210,  -0.216506,
-      0.867514,  -0.0642,   -0.8707,   -0.4876,   0.270833,  0.166667,
-      0.000000,  -0.216506, 0.875000,  -0.0000,   -0.8707,   -0.4918,
-      0.250000,  0.166667,  0.114210,  -0.216506, 0.867514,  -0.0642,
-      -0.8707,   -0.4876,   0.270833,  0.166667,  0.130526,  -0.250000,
-      0.991445,  0.0014,    -0.9999,   0.0107,    0.270833,  0.250000,
-      0.130526,  -0.250000, 0.991445,  0.0014,    -0.9999,   0.0107,
-      0.270833,  0.250000,  0.146842,  -0.216506, 1.115376,  0.0663,
-      -0.8614,   0.5037,    0.270833,  0.333333,  0.000000,  -0.216506,
-      1.125000,  -0.0000,   -0.8614,   0.5080,    0.250000,  0.333333,
-      0.146842,  -0.216506, 1.115376,  0.0663,    -0.8614,   0.5037,
-      0.270833,  0.333333,  0.158786,  -0.125000, 1.206099,  0.1134,
-      -0.4954,   0.8612,    0.270833,  0.416667,  0.000000,  -0.125000,
-      1.216506,  -0.0000,   -0.4954,   0.8687,    0.250000,  0.416667,
-      0.158786,  -0.125000, 1.206099,  0.1134,    -0.4954,   0.8612,
-      0.270833,  0.416667,  0.163158,  0.000000,  1.239306,  0.1305,
-      -0.0000,   0.9914,    0.270833,  0.500000,  0.000000,  0.000000,
-      1.250000,  -0.0000,   -0.0000,   1.0000,    0.250000,  0.500000,
-      0.323523,  0.000000,  1.207407,  0.2588,    -0.0000,   0.9659,
-      0.291667,  0.500000,  0.314854,  0.125000,  1.175055,  0.2248,
-      0.4954,    0.8391,    0.291667,  0.583333,  0.158786,  0.125000,
-      1.206099,  0.1134,    0.4954,    0.8612,    0.270833,  0.583333,
-      0.314854,  0.125000,  1.175055,  0.2248,    0.4954,    0.8391,
-      0.291667,  0.583333,  0.291171,  0.216506,  1.086667,  0.1315,
-      0.8614,    0.4907,    0.291667,  0.666667,  0.146842,  0.216506,
-      1.115376,  0.0663,    0.8614,    0.5037,    0.270833,  0.666667,
-      0.291171,  0.216506,  1.086667,  0.1315,    0.8614,    0.4907,
-      0.291667,  0.666667,  0.258819,  0.250000,  0.965926,  0.0028,
-      0.9999,    0.0104,    0.291667,  0.750000,  0.130526,  0.250000,
-      0.991445,  0.0014,    0.9999,    0.0107,    0.270833,  0.750000,
-      0.258819,  0.250000,  0.965926,  0.0028,    0.9999,    0.0104,
-      0.291667,  0.750000,  0.226466,  0.216506,  0.845185,  -0.1273,
-      0.8707,    -0.4751,   0.291667,  0.833333,  0.114210,  0.216506,
-      0.867514,  -0.0642,   0.8707,    -0.4876,   0.270833,  0.833333,
-      0.226466,  0.216506,  0.845185,  -0.1273,   0.8707,    -0.4751,
-      0.291667,  0.833333,  0.202783,  0.125000,  0.756797,  -0.2234,
-      0.5047,    -0.8339,   0.291667,  0.916667,  0.102266,  0.125000,
-      0.776791,  -0.1127,   0.5047,    -0.8559,   0.270833,  0.916667,
-      0.102266,  0.125000,  0.776791,  -0.1127,   0.5047,    -0.8559,
-      0.270833,  0.916667,  0.202783,  0.125000,  0.756797,  -0.2234,
-      0.5047,    -0.8339,   0.291667,  0.916667,  0.194114,  0.000000,
-      0.724444,  -0.2588,   -0.0000,   -0.9659,   0.291667,  1.000000,
-      0.194114,  0.000000,  0.724444,  -0.2588,   -0.0000,   -0.9659,
-      0.291667,  0.000000,  0.202783,  -0.125000, 0.756797,  -0.2234,
-      -0.5047,   -0.8339,   0.291667,  0.083333,  0.102266,  -0.125000,
-      0.776791,  -0.1127,   -0.5047,   -0.8559,   0.270833,  0.083333,
-      0.202783,  -0.125000, 0.756797,  -0.2234,   -0.5047,   -0.8339,
-      0.291667,  0.083333,  0.226466,  -0.216506, 0.845185,  -0.1273,
-      -0.8707,   -0.4751,   0.291667,  0.166667,  0.114210,  -0.216506,
-      0.867514,  -0.0642,   -0.8707,   -0.4876,   0.270833,  0.166667,
-      0.114210,  -0.216506, 0.867514,  -0.0642,   -0.8707,   -0.4876,
-      0.270833,  0.166667,  0.226466,  -0.216506, 0.845185,  -0.1273,
-      -0.8707,   -0.4751,   0.291667,  0.166667,  0.258819,  -0.250000,
-      0.965926,  0.0028,    -0.9999,   0.0104,    0.291667,  0.250000,
-      0.130526,  -0.250000, 0.991445,  0.0014,    -0.9999,   0.0107,
-      0.270833,  0.250000,  0.258819,  -0.250000, 0.965926,  0.0028,
-      -0.9999,   0.0104,    0.291667,  0.250000,  0.291171,  -0.216506,
-      1.086667,  0.1315,    -0.8614,   0.4907,    0.291667,  0.333333,
-      0.291171,  -0.216506, 1.086667,  0.1315,    -0.8614,   0.4907,
-      0.291667,  0.333333,  0.314854,  -0.125000, 1.175055,  0.2248,
-      -0.4954,   0.8391,    0.291667,  0.416667,  0.158786,  -0.125000,
-      1.206099,  0.1134,    -0.4954,   0.8612,    0.270833,  0.416667,
-      0.314854,  -0.125000, 1.175055,  0.2248,    -0.4954,   0.8391,
-      0.291667,  0.416667,  0.323523,  0.000000,  1.207407,  0.2588,
-      -0.0000,   0.9659,    0.291667,  0.500000,  0.163158,  0.000000,
-      1.239306,  0.1305,    -0.0000,   0.9914,    0.270833,  0.500000,
-      0.478355,  0.000000,  1.154849,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.465537,  0.125000,  1.123905,  0.3324,
-      0.4954,    0.8025,    0.312500,  0.583333,  0.314854,  0.125000,
-      1.175055,  0.2248,    0.4954,    0.8391,    0.291667,  0.583333,
-      0.465537,  0.125000,  1.123905,  0.3324,    0.4954,    0.8025,
-      0.312500,  0.583333,  0.430519,  0.216506,  1.039364,  0.1944,
-      0.8614,    0.4693,    0.312500,  0.666667,  0.291171,  0.216506,
-      1.086667,  0.1315,    0.8614,    0.4907,    0.291667,  0.666667,
-      0.430519,  0.216506,  1.039364,  0.1944,    0.8614,    0.4693,
-      0.312500,  0.666667,  0.382684,  0.250000,  0.923879,  0.0041,
-      0.9999,    0.0100,    0.312500,  0.750000,  0.258819,  0.250000,
-      0.965926,  0.0028,    0.9999,    0.0104,    0.291667,  0.750000,
-      0.382684,  0.250000,  0.923879,  0.0041,    0.9999,    0.0100,
-      0.312500,  0.750000,  0.334848,  0.216506,  0.808394,  -0.1882,
-      0.8707,    -0.4544,   0.312500,  0.833333,  0.226466,  0.216506,
-      0.845185,  -0.1273,   0.8707,    -0.4751,   0.291667,  0.833333,
-      0.334848,  0.216506,  0.808394,  -0.1882,   0.8707,    -0.4544,
-      0.312500,  0.833333,  0.299830,  0.125000,  0.723854,  -0.3304,
-      0.5047,    -0.7976,   0.312500,  0.916667,  0.202783,  0.125000,
-      0.756797,  -0.2234,   0.5047,    -0.8339,   0.291667,  0.916667,
-      0.299830,  0.125000,  0.723854,  -0.3304,   0.5047,    -0.7976,
-      0.312500,  0.916667,  0.287013,  0.000000,  0.692910,  -0.3827,
-      -0.0000,   -0.9239,   0.312500,  1.000000,  0.194114,  0.000000,
-      0.724444,  -0.2588,   -0.0000,   -0.9659,   0.291667,  1.000000,
-      0.287013,  0.000000,  0.692910,  -0.3827,   -0.0000,   -0.9239,
-      0.312500,  0.000000,  0.299830,  -0.125000, 0.723854,  -0.3304,
-      -0.5047,   -0.7976,   0.312500,  0.083333,  0.202783,  -0.125000,
-      0.756797,  -0.2234,   -0.5047,   -0.8339,   0.291667,  0.083333,
-      0.299830,  -0.125000, 0.723854,  -0.3304,   -0.5047,   -0.7976,
-      0.312500,  0.083333,  0.334848,  -0.216506, 0.808394,  -0.1882,
-      -0.8707,   -0.4544,   0.312500,  0.166667,  0.226466,  -0.216506,
-      0.845185,  -0.1273,   -0.8707,   -0.4751,   0.291667,  0.166667,
-      0.334848,  -0.216506, 0.808394,  -0.1882,   -0.8707,   -0.4544,
-      0.312500,  0.166667,  0.382684,  -0.250000, 0.923879,  0.0041,
-      -0.9999,   0.0100,    0.312500,  0.250000,  0.258819,  -0.250000,
-      0.965926,  0.0028,    -0.9999,   0.0104,    0.291667,  0.250000,
-      0.258819,  -0.250000, 0.965926,  0.0028,    -0.9999,   0.0104,
-      0.291667,  0.250000,  0.382684,  -0.250000, 0.923879,  0.0041,
-      -0.9999,   0.0100,    0.312500,  0.250000,  0.430519,  -0.216506,
-      1.039364,  0.1944,    -0.8614,   0.4693,    0.312500,  0.333333,
-      0.291171,  -0.216506, 1.086667,  0.1315,    -0.8614,   0.4907,
-      0.291667,  0.333333,  0.430519,  -0.216506, 1.039364,  0.1944,
-      -0.8614,   0.4693,    0.312500,  0.333333,  0.465537,  -0.125000,
-      1.123905,  0.3324,    -0.4954,   0.8025,    0.312500,  0.416667,
-      0.465537,  -0.125000, 1.123905,  0.3324,    -0.4954,   0.8025,
-      0.312500,  0.416667,  0.478355,  0.000000,  1.154849,  0.3827,
-      -0.0000,   0.9239,    0.312500,  0.500000,  0.323523,  0.000000,
-      1.207407,  0.2588,    -0.0000,   0.9659,    0.291667,  0.500000,
-      0.625000,  0.000000,  1.082532,  0.5000,    -0.0000,   0.8660,
-      0.333333,  0.500000,  0.608253,  0.125000,  1.053525,  0.4343,
-      0.4954,    0.7523,    0.333333,  0.583333,  0.465537,  0.125000,
-      1.123905,  0.3324,    0.4954,    0.8025,    0.312500,  0.583333,
-      0.608253,  0.125000,  1.053525,  0.4343,    0.4954,    0.7523,
-      0.333333,  0.583333,  0.562500,  0.216506,  0.974279,  0.2540,
-      0.8614,    0.4399,    0.333333,  0.666667,  0.430519,  0.216506,
-      1.039364,  0.1944,    0.8614,    0.4693,    0.312500,  0.666667,
-      0.430519,  0.216506,  1.039364,  0.1944,    0.8614,    0.4693,
-      0.312500,  0.666667,  0.562500,  0.216506,  0.974279,  0.2540,
-      0.8614,    0.4399,    0.333333,  0.666667,  0.500000,  0.250000,
-      0.866025,  0.0054,    0.9999,    0.0093,    0.333333,  0.750000,
-      0.382684,  0.250000,  0.923879,  0.0041,    0.9999,    0.0100,
-      0.312500,  0.750000,  0.500000,  0.250000,  0.866025,  0.0054,
-      0.9999,    0.0093,    0.333333,  0.750000,  0.437500,  0.216506,
-      0.757772,  -0.2459,   0.8707,    -0.4259,   0.333333,  0.833333,
-      0.437500,  0.216506,  0.757772,  -0.2459,   0.8707,    -0.4259,
-      0.333333,  0.833333,  0.391747,  0.125000,  0.678525,  -0.4316,
-      0.5047,    -0.7476,   0.333333,  0.916667,  0.299830,  0.125000,
-      0.723854,  -0.3304,   0.5047,    -0.7976,   0.312500,  0.916667,
-      0.391747,  0.125000,  0.678525,  -0.4316,   0.5047,    -0.7476,
-      0.333333,  0.916667,  0.375000,  0.000000,  0.649519,  -0.5000,
-      -0.0000,   -0.8660,   0.333333,  1.000000,  0.287013,  0.000000,
-      0.692910,  -0.3827,   -0.0000,   -0.9239,   0.312500,  1.000000,
-      0.375000,  0.000000,  0.649519,  -0.5000,   -0.0000,   -0.8660,
-      0.333333,  0.000000,  0.391747,  -0.125000, 0.678525,  -0.4316,
-      -0.5047,   -0.7476,   0.333333,  0.083333,  0.299830,  -0.125000,
-      0.723854,  -0.3304,   -0.5047,   -0.7976,   0.312500,  0.083333,
-      0.391747,  -0.125000, 0.678525,  -0.4316,   -0.5047,   -0.7476,
-      0.333333,  0.083333,  0.437500,  -0.216506, 0.757772,  -0.2459,
-      -0.8707,   -0.4259,   0.333333,  0.166667,  0.334848,  -0.216506,
-      0.808394,  -0.1882,   -0.8707,   -0.4544,   0.312500,  0.166667,
-      0.437500,  -0.216506, 0.757772,  -0.2459,   -0.8707,   -0.4259,
-      0.333333,  0.166667,  0.500000,  -0.250000, 0.866025,  0.0054,
-      -0.9999,   0.0093,    0.333333,  0.250000,  0.382684,  -0.250000,
-      0.923879,  0.0041,    -0.9999,   0.0100,    0.312500,  0.250000,
-      0.500000,  -0.250000, 0.866025,  0.0054,    -0.9999,   0.0093,
-      0.333333,  0.250000,  0.562500,  -0.216506, 0.974279,  0.2540,
-      -0.8614,   0.4399,    0.333333,  0.333333,  0.430519,  -0.216506,
-      1.039364,  0.1944,    -0.8614,   0.4693,    0.312500,  0.333333,
-      0.562500,  -0.216506, 0.974279,  0.2540,    -0.8614,   0.4399,
-      0.333333,  0.333333,  0.608253,  -0.125000, 1.053525,  0.4343,
-      -0.4954,   0.7523,    0.333333,  0.416667,  0.465537,  -0.125000,
-      1.123905,  0.3324,    -0.4954,   0.8025,    0.312500,  0.416667,
-      0.465537,  -0.125000, 1.123905,  0.3324,    -0.4954,   0.8025,
-      0.312500,  0.416667,  0.608253,  -0.125000, 1.053525,  0.4343,
-      -0.4954,   0.7523,    0.333333,  0.416667,  0.625000,  0.000000,
-      1.082532,  0.5000,    -0.0000,   0.8660,    0.333333,  0.500000,
-      0.625000,  0.000000,  1.082532,  0.5000,    -0.0000,   0.8660,
-      0.333333,  0.500000,  0.760952,  0.000000,  0.991692,  0.6088,
-      -0.0000,   0.7934,    0.354167,  0.500000,  0.740562,  0.125000,
-      0.965120,  0.5288,    0.4954,    0.6892,    0.354167,  0.583333,
-      0.740562,  0.125000,  0.965120,  0.5288,    0.4954,    0.6892,
-      0.354167,  0.583333,  0.684856,  0.216506,  0.892523,  0.3092,
-      0.8614,    0.4030,    0.354167,  0.666667,  0.562500,  0.216506,
-      0.974279,  0.2540,    0.8614,    0.4399,    0.333333,  0.666667,
-      0.684856,  0.216506,  0.892523,  0.3092,    0.8614,    0.4030,
-      0.354167,  0.666667,  0.608761,  0.250000,  0.793353,  0.0066,
-      0.9999,    0.0085,    0.354167,  0.750000,  0.500000,  0.250000,
-      0.866025,  0.0054,    0.9999,    0.0093,    0.333333,  0.750000,
-      0.608761,  0.250000,  0.793353,  0.0066,    0.9999,    0.0085,
-      0.354167,  0.750000,  0.532666,  0.216506,  0.694184,  -0.2994,
-      0.8707,    -0.3902,   0.354167,  0.833333,  0.437500,  0.216506,
-      0.757772,  -0.2459,   0.8707,    -0.4259,   0.333333,  0.833333,
-      0.532666,  0.216506,  0.694184,  -0.2994,   0.8707,    -0.3902,
-      0.354167,  0.833333,  0.476961,  0.125000,  0.621587,  -0.5255,
-      0.5047,    -0.6849,   0.354167,  0.916667,  0.391747,  0.125000,
-      0.678525,  -0.4316,   0.5047,    -0.7476,   0.333333,  0.916667,
-      0.476961,  0.125000,  0.621587,  -0.5255,   0.5047,    -0.6849,
-      0.354167,  0.916667,  0.456571,  0.000000,  0.595015,  -0.6088,
-      -0.0000,   -0.7934,   0.354167,  1.000000,  0.375000,  0.000000,
-      0.649519,  -0.5000,   -0.0000,   -0.8660,   0.333333,  1.000000,
-      0.456571,  0.000000,  0.595015,  -0.6088,   -0.0000,   -0.7934,
-      0.354167,  0.000000,  0.476961,  -0.125000, 0.621587,  -0.5255,
-      -0.5047,   -0.6849,   0.354167,  0.083333,  0.391747,  -0.125000,
-      0.678525,  -0.4316,   -0.5047,   -0.7476,   0.333333,  0.083333,
-      0.476961,  -0.125000, 0.621587,  -0.5255,   -0.5047,   -0.6849,
-      0.354167,  0.083333,  0.532666,  -0.216506, 0.694184,  -0.2994,
-      -0.8707,   -0.3902,   0.354167,  0.166667,  0.437500,  -0.216506,
-      0.757772,  -0.2459,   -0.8707,   -0.4259,   0.333333,  0.166667,
-      0.532666,  -0.216506, 0.694184,  -0.2994,   -0.8707,   -0.3902,
-      0.354167,  0.166667,  0.608761,  -0.250000, 0.793353,  0.0066,
-      -0.9999,   0.0086,    0.354167,  0.250000,  0.500000,  -0.250000,
-      0.866025,  0.0054,    -0.9999,   0.0093,    0.333333,  0.250000,
-      0.608761,  -0.250000, 0.793353,  0.0066,    -0.9999,   0.0086,
-      0.354167,  0.250000,  0.684856,  -0.216506, 0.892523,  0.3092,
-      -0.8614,   0.4030,    0.354167,  0.333333,  0.562500,  -0.216506,
-      0.974279,  0.2540,    -0.8614,   0.4399,    0.333333,  0.333333,
-      0.562500,  -0.216506, 0.974279,  0.2540,    -0.8614,   0.4399,
-      0.333333,  0.333333,  0.684856,  -0.216506, 0.892523,  0.3092,
-      -0.8614,   0.4030,    0.354167,  0.333333,  0.740562,  -0.125000,
-      0.965120,  0.5288,    -0.4954,   0.6892,    0.354167,  0.416667,
-      0.740562,  -0.125000, 0.965120,  0.5288,    -0.4954,   0.6892,
-      0.354167,  0.416667,  0.760952,  0.000000,  0.991692,  0.6088,
-      -0.0000,   0.7934,    0.354167,  0.500000,  0.625000,  0.000000,
-      1.082532,  0.5000,    -0.0000,   0.8660,    0.333333,  0.500000,
-      0.760952,  0.000000,  0.991692,  0.6088,    -0.0000,   0.7934,
-      0.354167,  0.500000,  0.883883,  0.000000,  0.883884,  0.7071,
-      -0.0000,   0.7071,    0.375000,  0.500000,  0.860199,  0.125000,
-      0.860200,  0.6142,    0.4954,    0.6142,    0.375000,  0.583333,
-      0.860199,  0.125000,  0.860200,  0.6142,    0.4954,    0.6142,
-      0.375000,  0.583333,  0.795495,  0.216506,  0.795496,  0.3592,
-      0.8614,    0.3592,    0.375000,  0.666667,  0.684856,  0.216506,
-      0.892523,  0.3092,    0.8614,    0.4030,    0.354167,  0.666667,
-      0.684856,  0.216506,  0.892523,  0.3092,    0.8614,    0.4030,
-      0.354167,  0.666667,  0.795495,  0.216506,  0.795496,  0.3592,
-      0.8614,    0.3592,    0.375000,  0.666667,  0.707106,  0.250000,
-      0.707107,  0.0076,    0.9999,    0.0076,    0.375000,  0.750000,
-      0.608761,  0.250000,  0.793353,  0.0066,    0.9999,    0.0085,
-      0.354167,  0.750000,  0.707106,  0.250000,  0.707107,  0.0076,
-      0.9999,    0.0076,    0.375000,  0.750000,  0.618718,  0.216506,
-      0.618719,  -0.3478,   0.8707,    -0.3478,   0.375000,  0.833333,
-      0.532666,  0.216506,  0.694184,  -0.2994,   0.8707,    -0.3902,
-      0.354167,  0.833333,  0.618718,  0.216506,  0.618719,  -0.3478,
-      0.8707,    -0.3478,   0.375000,  0.833333,  0.554013,  0.125000,
-      0.554014,  -0.6104,   0.5047,    -0.6104,   0.375000,  0.916667,
-      0.554013,  0.125000,  0.554014,  -0.6104,   0.5047,    -0.6104,
-      0.375000,  0.916667,  0.530330,  0.000000,  0.530330,  -0.7071,
-      -0.0000,   -0.7071,   0.375000,  1.000000,  0.456571,  0.000000,
-      0.595015,  -0.6088,   -0.0000,   -0.7934,   0.354167,  1.000000,
-      0.530330,  0.000000,  0.530330,  -0.7071,   -0.0000,   -0.7071,
-      0.375000,  0.000000,  0.554013,  -0.125000, 0.554014,  -0.6104,
-      -0.5047,   -0.6104,   0.375000,  0.083333,  0.476961,  -0.125000,
-      0.621587,  -0.5255,   -0.5047,   -0.6849,   0.354167,  0.083333,
-      0.554013,  -0.125000, 0.554014,  -0.6104,   -0.5047,   -0.6104,
-      0.375000,  0.083333,  0.618718,  -0.216506, 0.618719,  -0.3478,
-      -0.8707,   -0.3478,   0.375000,  0.166667,  0.532666,  -0.216506,
-      0.694184,  -0.2994,   -0.8707,   -0.3902,   0.354167,  0.166667,
-      0.618718,  -0.216506, 0.618719,  -0.3478,   -0.8707,   -0.3478,
-      0.375000,  0.166667,  0.707106,  -0.250000, 0.707107,  0.0076,
-      -0.9999,   0.0076,    0.375000,  0.250000,  0.608761,  -0.250000,
-      0.793353,  0.0066,    -0.9999,   0.0086,    0.354167,  0.250000,
-      0.707106,  -0.250000, 0.707107,  0.0076,    -0.9999,   0.0076,
-      0.375000,  0.250000,  0.795495,  -0.216506, 0.795496,  0.3592,
-      -0.8614,   0.3592,    0.375000,  0.333333,  0.684856,  -0.216506,
-      0.892523,  0.3092,    -0.8614,   0.4030,    0.354167,  0.333333,
-      0.684856,  -0.216506, 0.892523,  0.3092,    -0.8614,   0.4030,
-      0.354167,  0.333333,  0.795495,  -0.216506, 0.795496,  0.3592,
-      -0.8614,   0.3592,    0.375000,  0.333333,  0.860199,  -0.125000,
-      0.860200,  0.6142,    -0.4954,   0.6142,    0.375000,  0.416667,
-      0.860199,  -0.125000, 0.860200,  0.6142,    -0.4954,   0.6142,
-      0.375000,  0.416667,  0.883883,  0.000000,  0.883884,  0.7071,
-      -0.0000,   0.7071,    0.375000,  0.500000,  0.760952,  0.000000,
-      0.991692,  0.6088,    -0.0000,   0.7934,    0.354167,  0.500000,
-      0.883883,  0.000000,  0.883884,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.991692,  0.000000,  0.760952,  0.7934,
-      -0.0000,   0.6088,    0.395833,  0.500000,  0.965119,  0.125000,
-      0.740562,  0.6892,    0.4954,    0.5288,    0.395833,  0.583333,
-      0.965119,  0.125000,  0.740562,  0.6892,    0.4954,    0.5288,
-      0.395833,  0.583333,  0.892523,  0.216506,  0.684856,  0.4030,
-      0.8614,    0.3092,    0.395833,  0.666667,  0.795495,  0.216506,
-      0.795496,  0.3592,    0.8614,    0.3592,    0.375000,  0.666667,
-      0.795495,  0.216506,  0.795496,  0.3592,    0.8614,    0.3592,
-      0.375000,  0.666667,  0.892523,  0.216506,  0.684856,  0.4030,
-      0.8614,    0.3092,    0.395833,  0.666667,  0.793353,  0.250000,
-      0.608761,  0.0086,    0.9999,    0.0066,    0.395833,  0.750000,
-      0.793353,  0.250000,  0.608761,  0.0086,    0.9999,    0.0066,
-      0.395833,  0.750000,  0.694184,  0.216506,  0.532666,  -0.3902,
-      0.8707,    -0.2994,   0.395833,  0.833333,  0.618718,  0.216506,
-      0.618719,  -0.3478,   0.8707,    -0.3478,   0.375000,  0.833333,
-      0.694184,  0.216506,  0.532666,  -0.3902,   0.8707,    -0.2994,
-      0.395833,  0.833333,  0.621587,  0.125000,  0.476961,  -0.6849,
-      0.5047,    -0.5255,   0.395833,  0.916667,  0.554013,  0.125000,
-      0.554014,  -0.6104,   0.5047,    -0.6104,   0.375000,  0.916667,
-      0.621587,  0.125000,  0.476961,  -0.6849,   0.5047,    -0.5255,
-      0.395833,  0.916667,  0.595015,  0.000000,  0.456571,  -0.7934,
-      -0.0000,   -0.6088,   0.395833,  1.000000,  0.530330,  0.000000,
-      0.530330,  -0.7071,   -0.0000,   -0.7071,   0.375000,  1.000000,
-      0.595015,  0.000000,  0.456571,  -0.7934,   -0.0000,   -0.6088,
-      0.395833,  0.000000,  0.621587,  -0.125000, 0.476961,  -0.6849,
-      -0.5047,   -0.5255,   0.395833,  0.083333,  0.554013,  -0.125000,
-      0.554014,  -0.6104,   -0.5047,   -0.6104,   0.375000,  0.083333,
-      0.554013,  -0.125000, 0.554014,  -0.6104,   -0.5047,   -0.6104,
-      0.375000,  0.083333,  0.621587,  -0.125000, 0.476961,  -0.6849,
-      -0.5047,   -0.5255,   0.395833,  0.083333,  0.694184,  -0.216506,
-      0.532666,  -0.3902,   -0.8707,   -0.2994,   0.395833,  0.166667,
-      0.618718,  -0.216506, 0.618719,  -0.3478,   -0.8707,   -0.3478,
-      0.375000,  0.166667,  0.694184,  -0.216506, 0.532666,  -0.3902,
-      -0.8707,   -0.2994,   0.395833,  0.166667,  0.793353,  -0.250000,
-      0.608761,  0.0085,    -0.9999,   0.0066,    0.395833,  0.250000,
-      0.793353,  -0.250000, 0.608761,  0.0085,    -0.9999,   0.0066,
-      0.395833,  0.250000,  0.892523,  -0.216506, 0.684856,  0.4030,
-      -0.8614,   0.3093,    0.395833,  0.333333,  0.795495,  -0.216506,
-      0.795496,  0.3592,    -0.8614,   0.3592,    0.375000,  0.333333,
-      0.892523,  -0.216506, 0.684856,  0.4030,    -0.8614,   0.3093,
-      0.395833,  0.333333,  0.965119,  -0.125000, 0.740562,  0.6892,
-      -0.4954,   0.5288,    0.395833,  0.416667,  0.860199,  -0.125000,
-      0.860200,  0.6142,    -0.4954,   0.6142,    0.375000,  0.416667,
-      0.965119,  -0.125000, 0.740562,  0.6892,    -0.4954,   0.5288,
-      0.395833,  0.416667,  0.991692,  0.000000,  0.760952,  0.7934,
-      -0.0000,   0.6088,    0.395833,  0.500000,  0.883883,  0.000000,
-      0.883884,  0.7071,    -0.0000,   0.7071,    0.375000,  0.500000,
-      1.082532,  0.000000,  0.625000,  0.8660,    -0.0000,   0.5000,
-      0.416667,  0.500000,  1.053525,  0.125000,  0.608253,  0.7523,
-      0.4954,    0.4343,    0.416667,  0.583333,  0.965119,  0.125000,
-      0.740562,  0.6892,    0.4954,    0.5288,    0.395833,  0.583333,
-      1.053525,  0.125000,  0.608253,  0.7523,    0.4954,    0.4343,
-      0.416667,  0.583333,  0.974279,  0.216506,  0.562500,  0.4399,
-      0.8614,    0.2540,    0.416667,  0.666667,  0.892523,  0.216506,
-      0.684856,  0.4030,    0.8614,    0.3092,    0.395833,  0.666667,
-      0.974279,  0.216506,  0.562500,  0.4399,    0.8614,    0.2540,
-      0.416667,  0.666667,  0.866025,  0.250000,  0.500000,  0.0093,
-      0.9999,    0.0054,    0.416667,  0.750000,  0.793353,  0.250000,
-      0.608761,  0.0086,    0.9999,    0.0066,    0.395833,  0.750000,
-      0.866025,  0.250000,  0.500000,  0.0093,    0.9999,    0.0054,
-      0.416667,  0.750000,  0.757772,  0.216506,  0.437500,  -0.4259,
-      0.8707,    -0.2459,   0.416667,  0.833333,  0.694184,  0.216506,
-      0.532666,  -0.3902,   0.8707,    -0.2994,   0.395833,  0.833333,
-      0.757772,  0.216506,  0.437500,  -0.4259,   0.8707,    -0.2459,
-      0.416667,  0.833333,  0.678525,  0.125000,  0.391747,  -0.7476,
-      0.5047,    -0.4316,   0.416667,  0.916667,  0.621587,  0.125000,
-      0.476961,  -0.6849,   0.5047,    -0.5255,   0.395833,  0.916667,
-      0.678525,  0.125000,  0.391747,  -0.7476,   0.5047,    -0.4316,
-      0.416667,  0.916667,  0.649519,  0.000000,  0.375000,  -0.8660,
-      -0.0000,   -0.5000,   0.416667,  1.000000,  0.595015,  0.000000,
-      0.456571,  -0.7934,   -0.0000,   -0.6088,   0.395833,  1.000000,
-      0.649519,  0.000000,  0.375000,  -0.8660,   -0.0000,   -0.5000,
-      0.416667,  0.000000,  0.678525,  -0.125000, 0.391747,  -0.7476,
-      -0.5047,   -0.4316,   0.416667,  0.083333,  0.621587,  -0.125000,
-      0.476961,  -0.6849,   -0.5047,   -0.5255,   0.395833,  0.083333,
-      0.621587,  -0.125000, 0.476961,  -0.6849,   -0.5047,   -0.5255,
-      0.395833,  0.083333,  0.678525,  -0.125000, 0.391747,  -0.7476,
-      -0.5047,   -0.4316,   0.416667,  0.083333,  0.757772,  -0.216506,
-      0.437500,  -0.4259,   -0.8707,   -0.2459,   0.416667,  0.166667,
-      0.757772,  -0.216506, 0.437500,  -0.4259,   -0.8707,   -0.2459,
-      0.416667,  0.166667,  0.866025,  -0.250000, 0.500000,  0.0093,
-      -0.9999,   0.0054,    0.416667,  0.250000,  0.793353,  -0.250000,
-      0.608761,  0.0085,    -0.9999,   0.0066,    0.395833,  0.250000,
-      0.866025,  -0.250000, 0.500000,  0.0093,    -0.9999,   0.0054,
-      0.416667,  0.250000,  0.974279,  -0.216506, 0.562500,  0.4399,
-      -0.8614,   0.2540,    0.416667,  0.333333,  0.892523,  -0.216506,
-      0.684856,  0.4030,    -0.8614,   0.3093,    0.395833,  0.333333,
-      0.892523,  -0.216506, 0.684856,  0.4030,    -0.8614,   0.3093,
-      0.395833,  0.333333,  0.974279,  -0.216506, 0.562500,  0.4399,
-      -0.8614,   0.2540,    0.416667,  0.333333,  1.053525,  -0.125000,
-      0.608253,  0.7523,    -0.4954,   0.4343,    0.416667,  0.416667,
-      1.053525,  -0.125000, 0.608253,  0.7523,    -0.4954,   0.4343,
-      0.416667,  0.416667,  1.082532,  0.000000,  0.625000,  0.8660,
-      -0.0000,   0.5000,    0.416667,  0.500000,  0.991692,  0.000000,
-      0.760952,  0.7934,    -0.0000,   0.6088,    0.395833,  0.500000,
-      1.154849,  0.000000,  0.478355,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  1.123905,  0.125000,  0.465537,  0.8025,
-      0.4954,    0.3324,    0.437500,  0.583333,  1.053525,  0.125000,
-      0.608253,  0.7523,    0.4954,    0.4343,    0.416667,  0.583333,
-      1.123905,  0.125000,  0.465537,  0.8025,    0.4954,    0.3324,
-      0.437500,  0.583333,  1.039364,  0.216506,  0.430519,  0.4693,
-      0.8614,    0.1944,    0.437500,  0.666667,  0.974279,  0.216506,
-      0.562500,  0.4399,    0.8614,    0.2540,    0.416667,  0.666667,
-      0.974279,  0.216506,  0.562500,  0.4399,    0.8614,    0.2540,
-      0.416667,  0.666667,  1.039364,  0.216506,  0.430519,  0.4693,
-      0.8614,    0.1944,    0.437500,  0.666667,  0.923879,  0.250000,
-      0.382684,  0.0100,    0.9999,    0.0041,    0.437500,  0.750000,
-      0.923879,  0.250000,  0.382684,  0.0100,    0.9999,    0.0041,
-      0.437500,  0.750000,  0.808394,  0.216506,  0.334848,  -0.4544,
-      0.8707,    -0.1882,   0.437500,  0.833333,  0.757772,  0.216506,
-      0.437500,  -0.4259,   0.8707,    -0.2459,   0.416667,  0.833333,
-      0.808394,  0.216506,  0.334848,  -0.4544,   0.8707,    -0.1882,
-      0.437500,  0.833333,  0.723854,  0.125000,  0.299830,  -0.7976,
-      0.5047,    -0.3304,   0.437500,  0.916667,  0.678525,  0.125000,
-      0.391747,  -0.7476,   0.5047,    -0.4316,   0.416667,  0.916667,
-      0.723854,  0.125000,  0.299830,  -0.7976,   0.5047,    -0.3304,
-      0.437500,  0.916667,  0.692910,  0.000000,  0.287013,  -0.9239,
-      -0.0000,   -0.3827,   0.437500,  1.000000,  0.649519,  0.000000,
-      0.375000,  -0.8660,   -0.0000,   -0.5000,   0.416667,  1.000000,
-      0.692910,  0.000000,  0.287013,  -0.9239,   -0.0000,   -0.3827,
-      0.437500,  0.000000,  0.723854,  -0.125000, 0.299830,  -0.7976,
-      -0.5047,   -0.3304,   0.437500,  0.083333,  0.678525,  -0.125000,
-      0.391747,  -0.7476,   -0.5047,   -0.4316,   0.416667,  0.083333,
-      0.723854,  -0.125000, 0.299830,  -0.7976,   -0.5047,   -0.3304,
-      0.437500,  0.083333,  0.808394,  -0.216506, 0.334848,  -0.4544,
-      -0.8707,   -0.1882,   0.437500,  0.166667,  0.757772,  -0.216506,
-      0.437500,  -0.4259,   -0.8707,   -0.2459,   0.416667,  0.166667,
-      0.808394,  -0.216506, 0.334848,  -0.4544,   -0.8707,   -0.1882,
-      0.437500,  0.166667,  0.923879,  -0.250000, 0.382684,  0.0100,
-      -0.9999,   0.0041,    0.437500,  0.250000,  0.866025,  -0.250000,
-      0.500000,  0.0093,    -0.9999,   0.0054,    0.416667,  0.250000,
-      0.923879,  -0.250000, 0.382684,  0.0100,    -0.9999,   0.0041,
-      0.437500,  0.250000,  1.039364,  -0.216506, 0.430519,  0.4693,
-      -0.8614,   0.1944,    0.437500,  0.333333,  0.974279,  -0.216506,
-      0.562500,  0.4399,    -0.8614,   0.2540,    0.416667,  0.333333,
-      1.039364,  -0.216506, 0.430519,  0.4693,    -0.8614,   0.1944,
-      0.437500,  0.333333,  1.123905,  -0.125000, 0.465537,  0.8025,
-      -0.4954,   0.3324,    0.437500,  0.416667,  1.053525,  -0.125000,
-      0.608253,  0.7523,    -0.4954,   0.4343,    0.416667,  0.416667,
-      1.123905,  -0.125000, 0.465537,  0.8025,    -0.4954,   0.3324,
-      0.437500,  0.416667,  1.154849,  0.000000,  0.478355,  0.9239,
-      -0.0000,   0.3827,    0.437500,  0.500000,  1.082532,  0.000000,
-      0.625000,  0.8660,    -0.0000,   0.5000,    0.416667,  0.500000,
-      1.207407,  0.000000,  0.323523,  0.9659,    -0.0000,   0.2588,
-      0.458333,  0.500000,  1.175055,  0.125000,  0.314855,  0.8391,
-      0.4954,    0.2248,    0.458333,  0.583333,  1.123905,  0.125000,
-      0.465537,  0.8025,    0.4954,    0.3324,    0.437500,  0.583333,
-      1.175055,  0.125000,  0.314855,  0.8391,    0.4954,    0.2248,
-      0.458333,  0.583333,  1.086667,  0.216506,  0.291171,  0.4907,
-      0.8614,    0.1315,    0.458333,  0.666667,  1.039364,  0.216506,
-      0.430519,  0.4693,    0.8614,    0.1944,    0.437500,  0.666667,
-      1.086667,  0.216506,  0.291171,  0.4907,    0.8614,    0.1315,
-      0.458333,  0.666667,  0.965926,  0.250000,  0.258819,  0.0104,
-      0.9999,    0.0028,    0.458333,  0.750000,  0.923879,  0.250000,
-      0.382684,  0.0100,    0.9999,    0.0041,    0.437500,  0.750000,
-      0.965926,  0.250000,  0.258819,  0.0104,    0.9999,    0.0028,
-      0.458333,  0.750000,  0.845185,  0.216506,  0.226466,  -0.4751,
-      0.8707,    -0.1273,   0.458333,  0.833333,  0.808394,  0.216506,
-      0.334848,  -0.4544,   0.8707,    -0.1882,   0.437500,  0.833333,
-      0.845185,  0.216506,  0.226466,  -0.4751,   0.8707,    -0.1273,
-      0.458333,  0.833333,  0.756797,  0.125000,  0.202783,  -0.8339,
-      0.5047,    -0.2234,   0.458333,  0.916667,  0.723854,  0.125000,
-      0.299830,  -0.7976,   0.5047,    -0.3304,   0.437500,  0.916667,
-      0.756797,  0.125000,  0.202783,  -0.8339,   0.5047,    -0.2234,
-      0.458333,  0.916667,  0.724444,  0.000000,  0.194114,  -0.9659,
-      -0.0000,   -0.2588,   0.458333,  1.000000,  0.692910,  0.000000,
-      0.287013,  -0.9239,   -0.0000,   -0.3827,   0.437500,  1.000000,
-      0.724444,  0.000000,  0.194114,  -0.9659,   -0.0000,   -0.2588,
-      0.458333,  0.000000,  0.756797,  -0.125000, 0.202783,  -0.8339,
-      -0.5047,   -0.2234,   0.458333,  0.083333,  0.723854,  -0.125000,
-      0.299830,  -0.7976,   -0.5047,   -0.3304,   0.437500,  0.083333,
-      0.723854,  -0.125000, 0.299830,  -0.7976,   -0.5047,   -0.3304,
-      0.437500,  0.083333,  0.756797,  -0.125000, 0.202783,  -0.8339,
-      -0.5047,   -0.2234,   0.458333,  0.083333,  0.845185,  -0.216506,
-      0.226466,  -0.4751,   -0.8707,   -0.1273,   0.458333,  0.166667,
-      0.845185,  -0.216506, 0.226466,  -0.4751,   -0.8707,   -0.1273,
-      0.458333,  0.166667,  0.965926,  -0.250000, 0.258819,  0.0104,
-      -0.9999,   0.0028,    0.458333,  0.250000,  0.923879,  -0.250000,
-      0.382684,  0.0100,    -0.9999,   0.0041,    0.437500,  0.250000,
-      0.965926,  -0.250000, 0.258819,  0.0104,    -0.9999,   0.0028,
-      0.458333,  0.250000,  1.086667,  -0.216506, 0.291171,  0.4907,
-      -0.8614,   0.1315,    0.458333,  0.333333,  1.039364,  -0.216506,
-      0.430519,  0.4693,    -0.8614,   0.1944,    0.437500,  0.333333,
-      1.086667,  -0.216506, 0.291171,  0.4907,    -0.8614,   0.1315,
-      0.458333,  0.333333,  1.175055,  -0.125000, 0.314855,  0.8391,
-      -0.4954,   0.2248,    0.458333,  0.416667,  1.123905,  -0.125000,
-      0.465537,  0.8025,    -0.4954,   0.3324,    0.437500,  0.416667,
-      1.175055,  -0.125000, 0.314855,  0.8391,    -0.4954,   0.2248,
-      0.458333,  0.416667,  1.207407,  0.000000,  0.323523,  0.9659,
-      -0.0000,   0.2588,    0.458333,  0.500000,  1.154849,  0.000000,
-      0.478355,  0.9239,    -0.0000,   0.3827,    0.437500,  0.500000,
-      1.207407,  0.000000,  0.323523,  0.9659,    -0.0000,   0.2588,
-      0.458333,  0.500000,  1.239306,  0.000000,  0.163158,  0.9914,
-      -0.0000,   0.1305,    0.479167,  0.500000,  1.206099,  0.125000,
-      0.158786,  0.8612,    0.4954,    0.1134,    0.479167,  0.583333,
-      1.175055,  0.125000,  0.314855,  0.8391,    0.4954,    0.2248,
-      0.458333,  0.583333,  1.206099,  0.125000,  0.158786,  0.8612,
-      0.4954,    0.1134,    0.479167,  0.583333,  1.115376,  0.216506,
-      0.146842,  0.5037,    0.8614,    0.0663,    0.479167,  0.666667,
-      1.086667,  0.216506,  0.291171,  0.4907,    0.8614,    0.1315,
-      0.458333,  0.666667,  1.115376,  0.216506,  0.146842,  0.5037,
-      0.8614,    0.0663,    0.479167,  0.666667,  0.991445,  0.250000,
-      0.130526,  0.0107,    0.9999,    0.0014,    0.479167,  0.750000,
-      0.991445,  0.250000,  0.130526,  0.0107,    0.9999,    0.0014,
-      0.479167,  0.750000,  0.867514,  0.216506,  0.114210,  -0.4876,
-      0.8707,    -0.0642,   0.479167,  0.833333,  0.845185,  0.216506,
-      0.226466,  -0.4751,   0.8707,    -0.1273,   0.458333,  0.833333,
-      0.867514,  0.216506,  0.114210,  -0.4876,   0.8707,    -0.0642,
-      0.479167,  0.833333,  0.776791,  0.125000,  0.102266,  -0.8559,
-      0.5047,    -0.1127,   0.479167,  0.916667,  0.756797,  0.125000,
-      0.202783,  -0.8339,   0.5047,    -0.2234,   0.458333,  0.916667,
-      0.756797,  0.125000,  0.202783,  -0.8339,   0.5047,    -0.2234,
-      0.458333,  0.916667,  0.776791,  0.125000,  0.102266,  -0.8559,
-      0.5047,    -0.1127,   0.479167,  0.916667,  0.743584,  0.000000,
-      0.097895,  -0.9914,   -0.0000,   -0.1305,   0.479167,  1.000000,
-      0.743584,  0.000000,  0.097895,  -0.9914,   -0.0000,   -0.1305,
-      0.479167,  0.000000,  0.776791,  -0.125000, 0.102266,  -0.8559,
-      -0.5047,   -0.1127,   0.479167,  0.083333,  0.756797,  -0.125000,
-      0.202783,  -0.8339,   -0.5047,   -0.2234,   0.458333,  0.083333,
-      0.776791,  -0.125000, 0.102266,  -0.8559,   -0.5047,   -0.1127,
-      0.479167,  0.083333,  0.867514,  -0.216506, 0.114210,  -0.4876,
-      -0.8707,   -0.0642,   0.479167,  0.166667,  0.845185,  -0.216506,
-      0.226466,  -0.4751,   -0.8707,   -0.1273,   0.458333,  0.166667,
-      0.845185,  -0.216506, 0.226466,  -0.4751,   -0.8707,   -0.1273,
-      0.458333,  0.166667,  0.867514,  -0.216506, 0.114210,  -0.4876,
-      -0.8707,   -0.0642,   0.479167,  0.166667,  0.991445,  -0.250000,
-      0.130526,  0.0107,    -0.9999,   0.0014,    0.479167,  0.250000,
-      0.991445,  -0.250000, 0.130526,  0.0107,    -0.9999,   0.0014,
-      0.479167,  0.250000,  1.115376,  -0.216506, 0.146842,  0.5037,
-      -0.8614,   0.0663,    0.479167,  0.333333,  1.086667,  -0.216506,
-      0.291171,  0.4907,    -0.8614,   0.1315,    0.458333,  0.333333,
-      1.115376,  -0.216506, 0.146842,  0.5037,    -0.8614,   0.0663,
-      0.479167,  0.333333,  1.206099,  -0.125000, 0.158786,  0.8612,
-      -0.4954,   0.1134,    0.479167,  0.416667,  1.175055,  -0.125000,
-      0.314855,  0.8391,    -0.4954,   0.2248,    0.458333,  0.416667,
-      1.206099,  -0.125000, 0.158786,  0.8612,    -0.4954,   0.1134,
-      0.479167,  0.416667,  1.239306,  0.000000,  0.163158,  0.9914,
-      -0.0000,   0.1305,    0.479167,  0.500000,  1.207407,  0.000000,
-      0.323523,  0.9659,    -0.0000,   0.2588,    0.458333,  0.500000,
-      1.250000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  1.216506,  0.125000,  0.000000,  0.8687,
-      0.4954,    -0.0000,   0.500000,  0.583333,  1.206099,  0.125000,
-      0.158786,  0.8612,    0.4954,    0.1134,    0.479167,  0.583333,
-      1.216506,  0.125000,  0.000000,  0.8687,    0.4954,    -0.0000,
-      0.500000,  0.583333,  1.125000,  0.216506,  0.000000,  0.5080,
-      0.8614,    -0.0000,   0.500000,  0.666667,  1.115376,  0.216506,
-      0.146842,  0.5037,    0.8614,    0.0663,    0.479167,  0.666667,
-      1.125000,  0.216506,  0.000000,  0.5080,    0.8614,    -0.0000,
-      0.500000,  0.666667,  1.000000,  0.250000,  0.000000,  0.0108,
-      0.9999,    -0.0000,   0.500000,  0.750000,  0.991445,  0.250000,
-      0.130526,  0.0107,    0.9999,    0.0014,    0.479167,  0.750000,
-      1.000000,  0.250000,  0.000000,  0.0108,    0.9999,    -0.0000,
-      0.500000,  0.750000,  0.875000,  0.216506,  0.000000,  -0.4918,
-      0.8707,    -0.0000,   0.500000,  0.833333,  0.867514,  0.216506,
-      0.114210,  -0.4876,   0.8707,    -0.0642,   0.479167,  0.833333,
-      0.875000,  0.216506,  0.000000,  -0.4918,   0.8707,    -0.0000,
-      0.500000,  0.833333,  0.783494,  0.125000,  0.000000,  -0.8633,
-      0.5047,    -0.0000,   0.500000,  0.916667,  0.776791,  0.125000,
-      0.102266,  -0.8559,   0.5047,    -0.1127,   0.479167,  0.916667,
-      0.783494,  0.125000,  0.000000,  -0.8633,   0.5047,    -0.0000,
-      0.500000,  0.916667,  0.750000,  0.000000,  0.000000,  -1.0000,
-      -0.0000,   -0.0000,   0.500000,  1.000000,  0.743584,  0.000000,
-      0.097895,  -0.9914,   -0.0000,   -0.1305,   0.479167,  1.000000,
-      0.743584,  0.000000,  0.097895,  -0.9914,   -0.0000,   -0.1305,
-      0.479167,  0.000000,  0.750000,  0.000000,  0.000000,  -1.0000,
-      -0.0000,   -0.0000,   0.500000,  0.000000,  0.783494,  -0.125000,
-      0.000000,  -0.8633,   -0.5047,   -0.0000,   0.500000,  0.083333,
-      0.783494,  -0.125000, 0.000000,  -0.8633,   -0.5047,   -0.0000,
-      0.500000,  0.083333,  0.875000,  -0.216506, 0.000000,  -0.4918,
-      -0.8707,   -0.0000,   0.500000,  0.166667,  0.867514,  -0.216506,
-      0.114210,  -0.4876,   -0.8707,   -0.0642,   0.479167,  0.166667,
-      0.875000,  -0.216506, 0.000000,  -0.4918,   -0.8707,   -0.0000,
-      0.500000,  0.166667,  1.000000,  -0.250000, 0.000000,  0.0108,
-      -0.9999,   -0.0000,   0.500000,  0.250000,  0.991445,  -0.250000,
-      0.130526,  0.0107,    -0.9999,   0.0014,    0.479167,  0.250000,
-      1.000000,  -0.250000, 0.000000,  0.0108,    -0.9999,   -0.0000,
-      0.500000,  0.250000,  1.125000,  -0.216506, 0.000000,  0.5080,
-      -0.8614,   -0.0000,   0.500000,  0.333333,  1.115376,  -0.216506,
-      0.146842,  0.5037,    -0.8614,   0.0663,    0.479167,  0.333333,
-      1.115376,  -0.216506, 0.146842,  0.5037,    -0.8614,   0.0663,
-      0.479167,  0.333333,  1.125000,  -0.216506, 0.000000,  0.5080,
-      -0.8614,   -0.0000,   0.500000,  0.333333,  1.216506,  -0.125000,
-      0.000000,  0.8687,    -0.4954,   -0.0000,   0.500000,  0.416667,
-      1.206099,  -0.125000, 0.158786,  0.8612,    -0.4954,   0.1134,
-      0.479167,  0.416667,  1.216506,  -0.125000, 0.000000,  0.8687,
-      -0.4954,   -0.0000,   0.500000,  0.416667,  1.250000,  0.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.500000,  0.500000,
-  };
-  const unsigned int torus_num_verts = 3456;
-
-  VAOBuilder torus_builder;
-  torus_builder.begin();
-  torus_builder.m_index_count = torus_num_verts;
-  torus_builder.add_vertex_buffer(&torus_vertex_data[0], torus_num_verts * 8);
-  torus_builder.add_vertex_attribute(0, 8 * sizeof(float), 3);
-  torus_builder.add_vertex_attribute(1, 8 * sizeof(float), 3);
-  torus_builder.add_vertex_attribute(2, 8 * sizeof(float), 2);
-
-  Shapes::s_torus_vao = torus_builder.build();
-  AABB cube_bb{{0, 0, 0}, {1, 1, 1}};
-  Shapes::s_torus_mesh = Mesh{Shapes::s_torus_vao, 36, cube_bb, cube_bb, 0};
+void provide_shape_model(AssetManager &am, const std::string &name,
+                         Mesh &mesh) {
+  Model model{};
+  model.m_meshes.push_back(mesh);
+  model.m_aabb = mesh.m_original_aabb;
 
-  Model torus_model{};
-  torus_model.m_meshes.push_back(Shapes::s_torus_mesh);
-  torus_model.m_aabb = Shapes::s_torus_mesh.m_original_aabb;
-
-  am.provide_asset<Model, AssetType::model>("torus", torus_model);
+  am.provide_asset<Model, AssetType::model>(name, model);
 }
 
-void add_sphere(AssetManager &am) {
-  float sphere_vertex_data[23040] = {
-      0.000000,  0.195090,  -0.980785, -0.0000,   0.1939,    -0.9810,
-      0.750000,  0.562500,  0.180240,  0.382683,  -0.906127, 0.1804,
-      0.3805,    -0.9070,   0.718750,  0.625000,  0.191342,  0.195090,
-      -0.961940, 0.1914,    0.1939,    -0.9622,   0.718750,  0.562500,
-      0.000000,  -0.923880, -0.382683, -0.0000,   -0.9217,   -0.3879,
-      0.750000,  0.125000,  0.038060,  -0.980785, -0.191342, 0.0392,
-      -0.9796,   -0.1971,   0.718750,  0.062500,  0.000000,  -0.980785,
-      -0.195090, -0.0000,   -0.9796,   -0.2010,   0.750000,  0.062500,
-      0.000000,  0.195090,  -0.980785, -0.0000,   0.1939,    -0.9810,
-      0.750000,  0.562500,  0.195090,  0.000000,  -0.980785, 0.1951,
-      -0.0000,   -0.9808,   0.718750,  0.500000,  0.000000,  0.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   0.750000,  0.500000,
-      0.000000,  0.980785,  -0.195090, -0.0000,   0.9796,    -0.2010,
-      0.750000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.734375,  1.000000,  0.038060,  0.980785,
-      -0.191342, 0.0392,    0.9796,    -0.1971,   0.718750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.734375,  0.000000,  0.000000,  -0.980785, -0.195090, -0.0000,
-      -0.9796,   -0.2010,   0.750000,  0.062500,  0.038060,  -0.980785,
-      -0.191342, 0.0392,    -0.9796,   -0.1971,   0.718750,  0.062500,
-      0.000000,  0.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      0.750000,  0.500000,  0.191342,  -0.195090, -0.961940, 0.1914,
-      -0.1939,   -0.9622,   0.718750,  0.437500,  0.000000,  -0.195090,
-      -0.980785, -0.0000,   -0.1939,   -0.9810,   0.750000,  0.437500,
-      0.000000,  0.923880,  -0.382683, -0.0000,   0.9217,    -0.3879,
-      0.750000,  0.875000,  0.038060,  0.980785,  -0.191342, 0.0392,
-      0.9796,    -0.1971,   0.718750,  0.937500,  0.074658,  0.923880,
-      -0.375330, 0.0757,    0.9217,    -0.3804,   0.718750,  0.875000,
-      0.000000,  -0.195090, -0.980785, -0.0000,   -0.1939,   -0.9810,
-      0.750000,  0.437500,  0.180240,  -0.382683, -0.906127, 0.1804,
-      -0.3805,   -0.9070,   0.718750,  0.375000,  0.000000,  -0.382683,
-      -0.923879, -0.0000,   -0.3805,   -0.9248,   0.750000,  0.375000,
-      0.000000,  0.831470,  -0.555570, -0.0000,   0.8286,    -0.5598,
-      0.750000,  0.812500,  0.074658,  0.923880,  -0.375330, 0.0757,
-      0.9217,    -0.3804,   0.718750,  0.875000,  0.108386,  0.831470,
-      -0.544895, 0.1092,    0.8286,    -0.5490,   0.718750,  0.812500,
-      0.000000,  -0.382683, -0.923879, -0.0000,   -0.3805,   -0.9248,
-      0.750000,  0.375000,  0.162212,  -0.555570, -0.815493, 0.1626,
-      -0.5528,   -0.8173,   0.718750,  0.312500,  0.000000,  -0.555570,
-      -0.831470, -0.0000,   -0.5528,   -0.8333,   0.750000,  0.312500,
-      0.000000,  0.707107,  -0.707107, -0.0000,   0.7041,    -0.7101,
-      0.750000,  0.750000,  0.108386,  0.831470,  -0.544895, 0.1092,
-      0.8286,    -0.5490,   0.718750,  0.812500,  0.137950,  0.707107,
-      -0.693520, 0.1385,    0.7041,    -0.6965,   0.718750,  0.750000,
-      0.000000,  -0.555570, -0.831470, -0.0000,   -0.5528,   -0.8333,
-      0.750000,  0.312500,  0.137950,  -0.707107, -0.693520, 0.1385,
-      -0.7041,   -0.6965,   0.718750,  0.250000,  0.000000,  -0.707107,
-      -0.707107, -0.0000,   -0.7041,   -0.7101,   0.750000,  0.250000,
-      0.000000,  0.555570,  -0.831470, -0.0000,   0.5528,    -0.8333,
-      0.750000,  0.687500,  0.137950,  0.707107,  -0.693520, 0.1385,
-      0.7041,    -0.6965,   0.718750,  0.750000,  0.162212,  0.555570,
-      -0.815493, 0.1626,    0.5528,    -0.8173,   0.718750,  0.687500,
-      0.000000,  -0.707107, -0.707107, -0.0000,   -0.7041,   -0.7101,
-      0.750000,  0.250000,  0.108386,  -0.831470, -0.544895, 0.1092,
-      -0.8286,   -0.5490,   0.718750,  0.187500,  0.000000,  -0.831470,
-      -0.555570, -0.0000,   -0.8286,   -0.5598,   0.750000,  0.187500,
-      0.000000,  0.382683,  -0.923879, -0.0000,   0.3805,    -0.9248,
-      0.750000,  0.625000,  0.162212,  0.555570,  -0.815493, 0.1626,
-      0.5528,    -0.8173,   0.718750,  0.687500,  0.180240,  0.382683,
-      -0.906127, 0.1804,    0.3805,    -0.9070,   0.718750,  0.625000,
-      0.000000,  -0.831470, -0.555570, -0.0000,   -0.8286,   -0.5598,
-      0.750000,  0.187500,  0.074658,  -0.923880, -0.375330, 0.0757,
-      -0.9217,   -0.3804,   0.718750,  0.125000,  0.000000,  -0.923880,
-      -0.382683, -0.0000,   -0.9217,   -0.3879,   0.750000,  0.125000,
-      0.162212,  0.555570,  -0.815493, 0.1626,    0.5528,    -0.8173,
-      0.718750,  0.687500,  0.353553,  0.382683,  -0.853553, 0.3539,
-      0.3805,    -0.8544,   0.687500,  0.625000,  0.180240,  0.382683,
-      -0.906127, 0.1804,    0.3805,    -0.9070,   0.718750,  0.625000,
-      0.074658,  -0.923880, -0.375330, 0.0757,    -0.9217,   -0.3804,
-      0.718750,  0.125000,  0.212608,  -0.831470, -0.513280, 0.2142,
-      -0.8286,   -0.5172,   0.687500,  0.187500,  0.146447,  -0.923880,
-      -0.353553, 0.1484,    -0.9217,   -0.3584,   0.687500,  0.125000,
-      0.191342,  0.195090,  -0.961940, 0.1914,    0.1939,    -0.9622,
-      0.718750,  0.562500,  0.353553,  0.382683,  -0.853553, 0.3539,
-      0.3805,    -0.8544,   0.687500,  0.625000,  0.375330,  0.195090,
-      -0.906127, 0.3754,    0.1939,    -0.9063,   0.687500,  0.562500,
-      0.074658,  -0.923880, -0.375330, 0.0757,    -0.9217,   -0.3804,
-      0.718750,  0.125000,  0.074658,  -0.980785, -0.180240, 0.0769,
-      -0.9796,   -0.1857,   0.687500,  0.062500,  0.038060,  -0.980785,
-      -0.191342, 0.0392,    -0.9796,   -0.1971,   0.718750,  0.062500,
-      0.191342,  0.195090,  -0.961940, 0.1914,    0.1939,    -0.9622,
-      0.718750,  0.562500,  0.382683,  0.000000,  -0.923879, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.195090,  0.000000,
-      -0.980785, 0.1951,    -0.0000,   -0.9808,   0.718750,  0.500000,
-      0.038060,  0.980785,  -0.191342, 0.0392,    0.9796,    -0.1971,
-      0.718750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.703125,  1.000000,  0.074658,  0.980785,
-      -0.180240, 0.0769,    0.9796,    -0.1857,   0.687500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.703125,  0.000000,  0.038060,  -0.980785, -0.191342, 0.0392,
-      -0.9796,   -0.1971,   0.718750,  0.062500,  0.074658,  -0.980785,
-      -0.180240, 0.0769,    -0.9796,   -0.1857,   0.687500,  0.062500,
-      0.195090,  0.000000,  -0.980785, 0.1951,    -0.0000,   -0.9808,
-      0.718750,  0.500000,  0.375330,  -0.195090, -0.906127, 0.3754,
-      -0.1939,   -0.9063,   0.687500,  0.437500,  0.191342,  -0.195090,
-      -0.961940, 0.1914,    -0.1939,   -0.9622,   0.718750,  0.437500,
-      0.038060,  0.980785,  -0.191342, 0.0392,    0.9796,    -0.1971,
-      0.718750,  0.937500,  0.146447,  0.923880,  -0.353553, 0.1484,
-      0.9217,    -0.3584,   0.687500,  0.875000,  0.074658,  0.923880,
-      -0.375330, 0.0757,    0.9217,    -0.3804,   0.718750,  0.875000,
-      0.191342,  -0.195090, -0.961940, 0.1914,    -0.1939,   -0.9622,
-      0.718750,  0.437500,  0.353553,  -0.382683, -0.853553, 0.3539,
-      -0.3805,   -0.8544,   0.687500,  0.375000,  0.180240,  -0.382683,
-      -0.906127, 0.1804,    -0.3805,   -0.9070,   0.718750,  0.375000,
-      0.074658,  0.923880,  -0.375330, 0.0757,    0.9217,    -0.3804,
-      0.718750,  0.875000,  0.212608,  0.831470,  -0.513280, 0.2142,
-      0.8286,    -0.5172,   0.687500,  0.812500,  0.108386,  0.831470,
-      -0.544895, 0.1092,    0.8286,    -0.5490,   0.718750,  0.812500,
-      0.180240,  -0.382683, -0.906127, 0.1804,    -0.3805,   -0.9070,
-      0.718750,  0.375000,  0.318190,  -0.555570, -0.768178, 0.3189,
-      -0.5528,   -0.7699,   0.687500,  0.312500,  0.162212,  -0.555570,
-      -0.815493, 0.1626,    -0.5528,   -0.8173,   0.718750,  0.312500,
-      0.108386,  0.831470,  -0.544895, 0.1092,    0.8286,    -0.5490,
-      0.718750,  0.812500,  0.270598,  0.707107,  -0.653281, 0.2718,
-      0.7041,    -0.6561,   0.687500,  0.750000,  0.137950,  0.707107,
-      -0.693520, 0.1385,    0.7041,    -0.6965,   0.718750,  0.750000,
-      0.162212,  -0.555570, -0.815493, 0.1626,    -0.5528,   -0.8173,
-      0.718750,  0.312500,  0.270598,  -0.707107, -0.653281, 0.2718,
-      -0.7041,   -0.6561,   0.687500,  0.250000,  0.137950,  -0.707107,
-      -0.693520, 0.1385,    -0.7041,   -0.6965,   0.718750,  0.250000,
-      0.137950,  0.707107,  -0.693520, 0.1385,    0.7041,    -0.6965,
-      0.718750,  0.750000,  0.318190,  0.555570,  -0.768178, 0.3189,
-      0.5528,    -0.7699,   0.687500,  0.687500,  0.162212,  0.555570,
-      -0.815493, 0.1626,    0.5528,    -0.8173,   0.718750,  0.687500,
-      0.108386,  -0.831470, -0.544895, 0.1092,    -0.8286,   -0.5490,
-      0.718750,  0.187500,  0.270598,  -0.707107, -0.653281, 0.2718,
-      -0.7041,   -0.6561,   0.687500,  0.250000,  0.212608,  -0.831470,
-      -0.513280, 0.2142,    -0.8286,   -0.5172,   0.687500,  0.187500,
-      0.375330,  -0.195090, -0.906127, 0.3754,    -0.1939,   -0.9063,
-      0.687500,  0.437500,  0.513280,  -0.382683, -0.768178, 0.5138,
-      -0.3805,   -0.7689,   0.656250,  0.375000,  0.353553,  -0.382683,
-      -0.853553, 0.3539,    -0.3805,   -0.8544,   0.687500,  0.375000,
-      0.146447,  0.923880,  -0.353553, 0.1484,    0.9217,    -0.3584,
-      0.687500,  0.875000,  0.308658,  0.831470,  -0.461940, 0.3110,
-      0.8286,    -0.4654,   0.656250,  0.812500,  0.212608,  0.831470,
-      -0.513280, 0.2142,    0.8286,    -0.5172,   0.687500,  0.812500,
-      0.318190,  -0.555570, -0.768178, 0.3189,    -0.5528,   -0.7699,
-      0.687500,  0.312500,  0.513280,  -0.382683, -0.768178, 0.5138,
-      -0.3805,   -0.7689,   0.656250,  0.375000,  0.461940,  -0.555570,
-      -0.691342, 0.4630,    -0.5528,   -0.6929,   0.656250,  0.312500,
-      0.212608,  0.831470,  -0.513280, 0.2142,    0.8286,    -0.5172,
-      0.687500,  0.812500,  0.392847,  0.707107,  -0.587938, 0.3945,
-      0.7041,    -0.5905,   0.656250,  0.750000,  0.270598,  0.707107,
-      -0.653281, 0.2718,    0.7041,    -0.6561,   0.687500,  0.750000,
-      0.270598,  -0.707107, -0.653281, 0.2718,    -0.7041,   -0.6561,
-      0.687500,  0.250000,  0.461940,  -0.555570, -0.691342, 0.4630,
-      -0.5528,   -0.6929,   0.656250,  0.312500,  0.392847,  -0.707107,
-      -0.587938, 0.3945,    -0.7041,   -0.5905,   0.656250,  0.250000,
-      0.270598,  0.707107,  -0.653281, 0.2718,    0.7041,    -0.6561,
-      0.687500,  0.750000,  0.461940,  0.555570,  -0.691342, 0.4630,
-      0.5528,    -0.6929,   0.656250,  0.687500,  0.318190,  0.555570,
-      -0.768178, 0.3189,    0.5528,    -0.7699,   0.687500,  0.687500,
-      0.212608,  -0.831470, -0.513280, 0.2142,    -0.8286,   -0.5172,
-      0.687500,  0.187500,  0.392847,  -0.707107, -0.587938, 0.3945,
-      -0.7041,   -0.5905,   0.656250,  0.250000,  0.308658,  -0.831470,
-      -0.461940, 0.3110,    -0.8286,   -0.4654,   0.656250,  0.187500,
-      0.318190,  0.555570,  -0.768178, 0.3189,    0.5528,    -0.7699,
-      0.687500,  0.687500,  0.513280,  0.382683,  -0.768178, 0.5138,
-      0.3805,    -0.7689,   0.656250,  0.625000,  0.353553,  0.382683,
-      -0.853553, 0.3539,    0.3805,    -0.8544,   0.687500,  0.625000,
-      0.212608,  -0.831470, -0.513280, 0.2142,    -0.8286,   -0.5172,
-      0.687500,  0.187500,  0.212608,  -0.923880, -0.318190, 0.2155,
-      -0.9217,   -0.3225,   0.656250,  0.125000,  0.146447,  -0.923880,
-      -0.353553, 0.1484,    -0.9217,   -0.3584,   0.687500,  0.125000,
-      0.353553,  0.382683,  -0.853553, 0.3539,    0.3805,    -0.8544,
-      0.687500,  0.625000,  0.544895,  0.195090,  -0.815493, 0.5450,
-      0.1939,    -0.8157,   0.656250,  0.562500,  0.375330,  0.195090,
-      -0.906127, 0.3754,    0.1939,    -0.9063,   0.687500,  0.562500,
-      0.146447,  -0.923880, -0.353553, 0.1484,    -0.9217,   -0.3584,
-      0.687500,  0.125000,  0.108386,  -0.980785, -0.162212, 0.1117,
-      -0.9796,   -0.1671,   0.656250,  0.062500,  0.074658,  -0.980785,
-      -0.180240, 0.0769,    -0.9796,   -0.1857,   0.687500,  0.062500,
-      0.375330,  0.195090,  -0.906127, 0.3754,    0.1939,    -0.9063,
-      0.687500,  0.562500,  0.555570,  0.000000,  -0.831469, 0.5556,
-      -0.0000,   -0.8315,   0.656250,  0.500000,  0.382683,  0.000000,
-      -0.923879, 0.3827,    -0.0000,   -0.9239,   0.687500,  0.500000,
-      0.074658,  0.980785,  -0.180240, 0.0769,    0.9796,    -0.1857,
-      0.687500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.671875,  1.000000,  0.108386,  0.980785,
-      -0.162212, 0.1117,    0.9796,    -0.1671,   0.656250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.671875,  0.000000,  0.074658,  -0.980785, -0.180240, 0.0769,
-      -0.9796,   -0.1857,   0.687500,  0.062500,  0.108386,  -0.980785,
-      -0.162212, 0.1117,    -0.9796,   -0.1671,   0.656250,  0.062500,
-      0.375330,  -0.195090, -0.906127, 0.3754,    -0.1939,   -0.9063,
-      0.687500,  0.437500,  0.555570,  0.000000,  -0.831469, 0.5556,
-      -0.0000,   -0.8315,   0.656250,  0.500000,  0.544895,  -0.195090,
-      -0.815493, 0.5450,    -0.1939,   -0.8157,   0.656250,  0.437500,
-      0.074658,  0.980785,  -0.180240, 0.0769,    0.9796,    -0.1857,
-      0.687500,  0.937500,  0.212608,  0.923880,  -0.318190, 0.2155,
-      0.9217,    -0.3225,   0.656250,  0.875000,  0.146447,  0.923880,
-      -0.353553, 0.1484,    0.9217,    -0.3584,   0.687500,  0.875000,
-      0.308658,  -0.831470, -0.461940, 0.3110,    -0.8286,   -0.4654,
-      0.656250,  0.187500,  0.270598,  -0.923880, -0.270598, 0.2743,
-      -0.9217,   -0.2743,   0.625000,  0.125000,  0.212608,  -0.923880,
-      -0.318190, 0.2155,    -0.9217,   -0.3225,   0.656250,  0.125000,
-      0.544895,  0.195090,  -0.815493, 0.5450,    0.1939,    -0.8157,
-      0.656250,  0.562500,  0.653281,  0.382683,  -0.653281, 0.6539,
-      0.3805,    -0.6539,   0.625000,  0.625000,  0.693520,  0.195090,
-      -0.693520, 0.6937,    0.1939,    -0.6937,   0.625000,  0.562500,
-      0.212608,  -0.923880, -0.318190, 0.2155,    -0.9217,   -0.3225,
-      0.656250,  0.125000,  0.137950,  -0.980785, -0.137950, 0.1421,
-      -0.9796,   -0.1421,   0.625000,  0.062500,  0.108386,  -0.980785,
-      -0.162212, 0.1117,    -0.9796,   -0.1671,   0.656250,  0.062500,
-      0.555570,  0.000000,  -0.831469, 0.5556,    -0.0000,   -0.8315,
-      0.656250,  0.500000,  0.693520,  0.195090,  -0.693520, 0.6937,
-      0.1939,    -0.6937,   0.625000,  0.562500,  0.707107,  0.000000,
-      -0.707107, 0.7071,    -0.0000,   -0.7071,   0.625000,  0.500000,
-      0.108386,  0.980785,  -0.162212, 0.1117,    0.9796,    -0.1671,
-      0.656250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.640625,  1.000000,  0.137950,  0.980785,
-      -0.137950, 0.1421,    0.9796,    -0.1421,   0.625000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.640625,  0.000000,  0.108386,  -0.980785, -0.162212, 0.1117,
-      -0.9796,   -0.1671,   0.656250,  0.062500,  0.137950,  -0.980785,
-      -0.137950, 0.1421,    -0.9796,   -0.1421,   0.625000,  0.062500,
-      0.555570,  0.000000,  -0.831469, 0.5556,    -0.0000,   -0.8315,
-      0.656250,  0.500000,  0.693520,  -0.195090, -0.693520, 0.6937,
-      -0.1939,   -0.6937,   0.625000,  0.437500,  0.544895,  -0.195090,
-      -0.815493, 0.5450,    -0.1939,   -0.8157,   0.656250,  0.437500,
-      0.108386,  0.980785,  -0.162212, 0.1117,    0.9796,    -0.1671,
-      0.656250,  0.937500,  0.270598,  0.923880,  -0.270598, 0.2743,
-      0.9217,    -0.2743,   0.625000,  0.875000,  0.212608,  0.923880,
-      -0.318190, 0.2155,    0.9217,    -0.3225,   0.656250,  0.875000,
-      0.544895,  -0.195090, -0.815493, 0.5450,    -0.1939,   -0.8157,
-      0.656250,  0.437500,  0.653281,  -0.382683, -0.653281, 0.6539,
-      -0.3805,   -0.6539,   0.625000,  0.375000,  0.513280,  -0.382683,
-      -0.768178, 0.5138,    -0.3805,   -0.7689,   0.656250,  0.375000,
-      0.212608,  0.923880,  -0.318190, 0.2155,    0.9217,    -0.3225,
-      0.656250,  0.875000,  0.392847,  0.831470,  -0.392847, 0.3958,
-      0.8286,    -0.3958,   0.625000,  0.812500,  0.308658,  0.831470,
-      -0.461940, 0.3110,    0.8286,    -0.4654,   0.656250,  0.812500,
-      0.461940,  -0.555570, -0.691342, 0.4630,    -0.5528,   -0.6929,
-      0.656250,  0.312500,  0.653281,  -0.382683, -0.653281, 0.6539,
-      -0.3805,   -0.6539,   0.625000,  0.375000,  0.587938,  -0.555570,
-      -0.587938, 0.5893,    -0.5528,   -0.5893,   0.625000,  0.312500,
-      0.308658,  0.831470,  -0.461940, 0.3110,    0.8286,    -0.4654,
-      0.656250,  0.812500,  0.500000,  0.707107,  -0.500000, 0.5021,
-      0.7041,    -0.5021,   0.625000,  0.750000,  0.392847,  0.707107,
-      -0.587938, 0.3945,    0.7041,    -0.5905,   0.656250,  0.750000,
-      0.461940,  -0.555570, -0.691342, 0.4630,    -0.5528,   -0.6929,
-      0.656250,  0.312500,  0.500000,  -0.707107, -0.500000, 0.5021,
-      -0.7041,   -0.5021,   0.625000,  0.250000,  0.392847,  -0.707107,
-      -0.587938, 0.3945,    -0.7041,   -0.5905,   0.656250,  0.250000,
-      0.392847,  0.707107,  -0.587938, 0.3945,    0.7041,    -0.5905,
-      0.656250,  0.750000,  0.587938,  0.555570,  -0.587938, 0.5893,
-      0.5528,    -0.5893,   0.625000,  0.687500,  0.461940,  0.555570,
-      -0.691342, 0.4630,    0.5528,    -0.6929,   0.656250,  0.687500,
-      0.392847,  -0.707107, -0.587938, 0.3945,    -0.7041,   -0.5905,
-      0.656250,  0.250000,  0.392847,  -0.831470, -0.392847, 0.3958,
-      -0.8286,   -0.3958,   0.625000,  0.187500,  0.308658,  -0.831470,
-      -0.461940, 0.3110,    -0.8286,   -0.4654,   0.656250,  0.187500,
-      0.461940,  0.555570,  -0.691342, 0.4630,    0.5528,    -0.6929,
-      0.656250,  0.687500,  0.653281,  0.382683,  -0.653281, 0.6539,
-      0.3805,    -0.6539,   0.625000,  0.625000,  0.513280,  0.382683,
-      -0.768178, 0.5138,    0.3805,    -0.7689,   0.656250,  0.625000,
-      0.270598,  0.923880,  -0.270598, 0.2743,    0.9217,    -0.2743,
-      0.625000,  0.875000,  0.461940,  0.831470,  -0.308658, 0.4654,
-      0.8286,    -0.3110,   0.593750,  0.812500,  0.392847,  0.831470,
-      -0.392847, 0.3958,    0.8286,    -0.3958,   0.625000,  0.812500,
-      0.587938,  -0.555570, -0.587938, 0.5893,    -0.5528,   -0.5893,
-      0.625000,  0.312500,  0.768178,  -0.382683, -0.513280, 0.7689,
-      -0.3805,   -0.5138,   0.593750,  0.375000,  0.691342,  -0.555570,
-      -0.461940, 0.6929,    -0.5528,   -0.4630,   0.593750,  0.312500,
-      0.392847,  0.831470,  -0.392847, 0.3958,    0.8286,    -0.3958,
-      0.625000,  0.812500,  0.587938,  0.707107,  -0.392847, 0.5905,
-      0.7041,    -0.3945,   0.593750,  0.750000,  0.500000,  0.707107,
-      -0.500000, 0.5021,    0.7041,    -0.5021,   0.625000,  0.750000,
-      0.587938,  -0.555570, -0.587938, 0.5893,    -0.5528,   -0.5893,
-      0.625000,  0.312500,  0.587938,  -0.707107, -0.392847, 0.5905,
-      -0.7041,   -0.3945,   0.593750,  0.250000,  0.500000,  -0.707107,
-      -0.500000, 0.5021,    -0.7041,   -0.5021,   0.625000,  0.250000,
-      0.587938,  0.555570,  -0.587938, 0.5893,    0.5528,    -0.5893,
-      0.625000,  0.687500,  0.587938,  0.707107,  -0.392847, 0.5905,
-      0.7041,    -0.3945,   0.593750,  0.750000,  0.691342,  0.555570,
-      -0.461940, 0.6929,    0.5528,    -0.4630,   0.593750,  0.687500,
-      0.500000,  -0.707107, -0.500000, 0.5021,    -0.7041,   -0.5021,
-      0.625000,  0.250000,  0.461940,  -0.831470, -0.308658, 0.4654,
-      -0.8286,   -0.3110,   0.593750,  0.187500,  0.392847,  -0.831470,
-      -0.392847, 0.3958,    -0.8286,   -0.3958,   0.625000,  0.187500,
-      0.587938,  0.555570,  -0.587938, 0.5893,    0.5528,    -0.5893,
-      0.625000,  0.687500,  0.768178,  0.382683,  -0.513280, 0.7689,
-      0.3805,    -0.5138,   0.593750,  0.625000,  0.653281,  0.382683,
-      -0.653281, 0.6539,    0.3805,    -0.6539,   0.625000,  0.625000,
-      0.270598,  -0.923880, -0.270598, 0.2743,    -0.9217,   -0.2743,
-      0.625000,  0.125000,  0.461940,  -0.831470, -0.308658, 0.4654,
-      -0.8286,   -0.3110,   0.593750,  0.187500,  0.318190,  -0.923880,
-      -0.212608, 0.3225,    -0.9217,   -0.2155,   0.593750,  0.125000,
-      0.693520,  0.195090,  -0.693520, 0.6937,    0.1939,    -0.6937,
-      0.625000,  0.562500,  0.768178,  0.382683,  -0.513280, 0.7689,
-      0.3805,    -0.5138,   0.593750,  0.625000,  0.815493,  0.195090,
-      -0.544895, 0.8157,    0.1939,    -0.5450,   0.593750,  0.562500,
-      0.270598,  -0.923880, -0.270598, 0.2743,    -0.9217,   -0.2743,
-      0.625000,  0.125000,  0.162212,  -0.980785, -0.108386, 0.1671,
-      -0.9796,   -0.1117,   0.593750,  0.062500,  0.137950,  -0.980785,
-      -0.137950, 0.1421,    -0.9796,   -0.1421,   0.625000,  0.062500,
-      0.707107,  0.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.815493,  0.195090,  -0.544895, 0.8157,
-      0.1939,    -0.5450,   0.593750,  0.562500,  0.831470,  0.000000,
-      -0.555570, 0.8315,    -0.0000,   -0.5556,   0.593750,  0.500000,
-      0.137950,  0.980785,  -0.137950, 0.1421,    0.9796,    -0.1421,
-      0.625000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.609375,  1.000000,  0.162212,  0.980785,
-      -0.108386, 0.1671,    0.9796,    -0.1117,   0.593750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.609375,  0.000000,  0.137950,  -0.980785, -0.137950, 0.1421,
-      -0.9796,   -0.1421,   0.625000,  0.062500,  0.162212,  -0.980785,
-      -0.108386, 0.1671,    -0.9796,   -0.1117,   0.593750,  0.062500,
-      0.707107,  0.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.815493,  -0.195090, -0.544895, 0.8157,
-      -0.1939,   -0.5450,   0.593750,  0.437500,  0.693520,  -0.195090,
-      -0.693520, 0.6937,    -0.1939,   -0.6937,   0.625000,  0.437500,
-      0.137950,  0.980785,  -0.137950, 0.1421,    0.9796,    -0.1421,
-      0.625000,  0.937500,  0.318190,  0.923880,  -0.212608, 0.3225,
-      0.9217,    -0.2155,   0.593750,  0.875000,  0.270598,  0.923880,
-      -0.270598, 0.2743,    0.9217,    -0.2743,   0.625000,  0.875000,
-      0.693520,  -0.195090, -0.693520, 0.6937,    -0.1939,   -0.6937,
-      0.625000,  0.437500,  0.768178,  -0.382683, -0.513280, 0.7689,
-      -0.3805,   -0.5138,   0.593750,  0.375000,  0.653281,  -0.382683,
-      -0.653281, 0.6539,    -0.3805,   -0.6539,   0.625000,  0.375000,
-      0.815493,  0.195090,  -0.544895, 0.8157,    0.1939,    -0.5450,
-      0.593750,  0.562500,  0.853553,  0.382683,  -0.353553, 0.8544,
-      0.3805,    -0.3539,   0.562500,  0.625000,  0.906127,  0.195090,
-      -0.375330, 0.9063,    0.1939,    -0.3754,   0.562500,  0.562500,
-      0.162212,  -0.980785, -0.108386, 0.1671,    -0.9796,   -0.1117,
-      0.593750,  0.062500,  0.353553,  -0.923880, -0.146447, 0.3584,
-      -0.9217,   -0.1484,   0.562500,  0.125000,  0.180240,  -0.980785,
-      -0.074658, 0.1857,    -0.9796,   -0.0769,   0.562500,  0.062500,
-      0.831470,  0.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.593750,  0.500000,  0.906127,  0.195090,  -0.375330, 0.9063,
-      0.1939,    -0.3754,   0.562500,  0.562500,  0.923879,  0.000000,
-      -0.382683, 0.9239,    -0.0000,   -0.3827,   0.562500,  0.500000,
-      0.162212,  0.980785,  -0.108386, 0.1671,    0.9796,    -0.1117,
-      0.593750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.578125,  1.000000,  0.180240,  0.980785,
-      -0.074658, 0.1857,    0.9796,    -0.0769,   0.562500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.578125,  0.000000,  0.162212,  -0.980785, -0.108386, 0.1671,
-      -0.9796,   -0.1117,   0.593750,  0.062500,  0.180240,  -0.980785,
-      -0.074658, 0.1857,    -0.9796,   -0.0769,   0.562500,  0.062500,
-      0.831470,  0.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.593750,  0.500000,  0.906127,  -0.195090, -0.375330, 0.9063,
-      -0.1939,   -0.3754,   0.562500,  0.437500,  0.815493,  -0.195090,
-      -0.544895, 0.8157,    -0.1939,   -0.5450,   0.593750,  0.437500,
-      0.162212,  0.980785,  -0.108386, 0.1671,    0.9796,    -0.1117,
-      0.593750,  0.937500,  0.353553,  0.923880,  -0.146447, 0.3584,
-      0.9217,    -0.1484,   0.562500,  0.875000,  0.318190,  0.923880,
-      -0.212608, 0.3225,    0.9217,    -0.2155,   0.593750,  0.875000,
-      0.815493,  -0.195090, -0.544895, 0.8157,    -0.1939,   -0.5450,
-      0.593750,  0.437500,  0.853553,  -0.382683, -0.353553, 0.8544,
-      -0.3805,   -0.3539,   0.562500,  0.375000,  0.768178,  -0.382683,
-      -0.513280, 0.7689,    -0.3805,   -0.5138,   0.593750,  0.375000,
-      0.318190,  0.923880,  -0.212608, 0.3225,    0.9217,    -0.2155,
-      0.593750,  0.875000,  0.513280,  0.831470,  -0.212607, 0.5172,
-      0.8286,    -0.2142,   0.562500,  0.812500,  0.461940,  0.831470,
-      -0.308658, 0.4654,    0.8286,    -0.3110,   0.593750,  0.812500,
-      0.691342,  -0.555570, -0.461940, 0.6929,    -0.5528,   -0.4630,
-      0.593750,  0.312500,  0.853553,  -0.382683, -0.353553, 0.8544,
-      -0.3805,   -0.3539,   0.562500,  0.375000,  0.768178,  -0.555570,
-      -0.318190, 0.7699,    -0.5528,   -0.3189,   0.562500,  0.312500,
-      0.461940,  0.831470,  -0.308658, 0.4654,    0.8286,    -0.3110,
-      0.593750,  0.812500,  0.653281,  0.707107,  -0.270598, 0.6561,
-      0.7041,    -0.2718,   0.562500,  0.750000,  0.587938,  0.707107,
-      -0.392847, 0.5905,    0.7041,    -0.3945,   0.593750,  0.750000,
-      0.691342,  -0.555570, -0.461940, 0.6929,    -0.5528,   -0.4630,
-      0.593750,  0.312500,  0.653281,  -0.707107, -0.270598, 0.6561,
-      -0.7041,   -0.2718,   0.562500,  0.250000,  0.587938,  -0.707107,
-      -0.392847, 0.5905,    -0.7041,   -0.3945,   0.593750,  0.250000,
-      0.691342,  0.555570,  -0.461940, 0.6929,    0.5528,    -0.4630,
-      0.593750,  0.687500,  0.653281,  0.707107,  -0.270598, 0.6561,
-      0.7041,    -0.2718,   0.562500,  0.750000,  0.768178,  0.555570,
-      -0.318190, 0.7699,    0.5528,    -0.3189,   0.562500,  0.687500,
-      0.587938,  -0.707107, -0.392847, 0.5905,    -0.7041,   -0.3945,
-      0.593750,  0.250000,  0.513280,  -0.831470, -0.212607, 0.5172,
-      -0.8286,   -0.2142,   0.562500,  0.187500,  0.461940,  -0.831470,
-      -0.308658, 0.4654,    -0.8286,   -0.3110,   0.593750,  0.187500,
-      0.691342,  0.555570,  -0.461940, 0.6929,    0.5528,    -0.4630,
-      0.593750,  0.687500,  0.853553,  0.382683,  -0.353553, 0.8544,
-      0.3805,    -0.3539,   0.562500,  0.625000,  0.768178,  0.382683,
-      -0.513280, 0.7689,    0.3805,    -0.5138,   0.593750,  0.625000,
-      0.461940,  -0.831470, -0.308658, 0.4654,    -0.8286,   -0.3110,
-      0.593750,  0.187500,  0.353553,  -0.923880, -0.146447, 0.3584,
-      -0.9217,   -0.1484,   0.562500,  0.125000,  0.318190,  -0.923880,
-      -0.212608, 0.3225,    -0.9217,   -0.2155,   0.593750,  0.125000,
-      0.768178,  -0.555570, -0.318190, 0.7699,    -0.5528,   -0.3189,
-      0.562500,  0.312500,  0.906127,  -0.382683, -0.180240, 0.9070,
-      -0.3805,   -0.1804,   0.531250,  0.375000,  0.815493,  -0.555570,
-      -0.162212, 0.8173,    -0.5528,   -0.1626,   0.531250,  0.312500,
-      0.513280,  0.831470,  -0.212607, 0.5172,    0.8286,    -0.2142,
-      0.562500,  0.812500,  0.693520,  0.707107,  -0.137950, 0.6965,
-      0.7041,    -0.1385,   0.531250,  0.750000,  0.653281,  0.707107,
-      -0.270598, 0.6561,    0.7041,    -0.2718,   0.562500,  0.750000,
-      0.768178,  -0.555570, -0.318190, 0.7699,    -0.5528,   -0.3189,
-      0.562500,  0.312500,  0.693520,  -0.707107, -0.137950, 0.6965,
-      -0.7041,   -0.1385,   0.531250,  0.250000,  0.653281,  -0.707107,
-      -0.270598, 0.6561,    -0.7041,   -0.2718,   0.562500,  0.250000,
-      0.768178,  0.555570,  -0.318190, 0.7699,    0.5528,    -0.3189,
-      0.562500,  0.687500,  0.693520,  0.707107,  -0.137950, 0.6965,
-      0.7041,    -0.1385,   0.531250,  0.750000,  0.815493,  0.555570,
-      -0.162212, 0.8173,    0.5528,    -0.1626,   0.531250,  0.687500,
-      0.513280,  -0.831470, -0.212607, 0.5172,    -0.8286,   -0.2142,
-      0.562500,  0.187500,  0.693520,  -0.707107, -0.137950, 0.6965,
-      -0.7041,   -0.1385,   0.531250,  0.250000,  0.544895,  -0.831470,
-      -0.108386, 0.5490,    -0.8286,   -0.1092,   0.531250,  0.187500,
-      0.768178,  0.555570,  -0.318190, 0.7699,    0.5528,    -0.3189,
-      0.562500,  0.687500,  0.906127,  0.382683,  -0.180240, 0.9070,
-      0.3805,    -0.1804,   0.531250,  0.625000,  0.853553,  0.382683,
-      -0.353553, 0.8544,    0.3805,    -0.3539,   0.562500,  0.625000,
-      0.353553,  -0.923880, -0.146447, 0.3584,    -0.9217,   -0.1484,
-      0.562500,  0.125000,  0.544895,  -0.831470, -0.108386, 0.5490,
-      -0.8286,   -0.1092,   0.531250,  0.187500,  0.375330,  -0.923880,
-      -0.074658, 0.3804,    -0.9217,   -0.0757,   0.531250,  0.125000,
-      0.906127,  0.195090,  -0.375330, 0.9063,    0.1939,    -0.3754,
-      0.562500,  0.562500,  0.906127,  0.382683,  -0.180240, 0.9070,
-      0.3805,    -0.1804,   0.531250,  0.625000,  0.961940,  0.195090,
-      -0.191342, 0.9622,    0.1939,    -0.1914,   0.531250,  0.562500,
-      0.353553,  -0.923880, -0.146447, 0.3584,    -0.9217,   -0.1484,
-      0.562500,  0.125000,  0.191342,  -0.980785, -0.038060, 0.1971,
-      -0.9796,   -0.0392,   0.531250,  0.062500,  0.180240,  -0.980785,
-      -0.074658, 0.1857,    -0.9796,   -0.0769,   0.562500,  0.062500,
-      0.923879,  0.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  0.961940,  0.195090,  -0.191342, 0.9622,
-      0.1939,    -0.1914,   0.531250,  0.562500,  0.980785,  0.000000,
-      -0.195090, 0.9808,    -0.0000,   -0.1951,   0.531250,  0.500000,
-      0.180240,  0.980785,  -0.074658, 0.1857,    0.9796,    -0.0769,
-      0.562500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.546875,  1.000000,  0.191342,  0.980785,
-      -0.038060, 0.1971,    0.9796,    -0.0392,   0.531250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.546875,  0.000000,  0.180240,  -0.980785, -0.074658, 0.1857,
-      -0.9796,   -0.0769,   0.562500,  0.062500,  0.191342,  -0.980785,
-      -0.038060, 0.1971,    -0.9796,   -0.0392,   0.531250,  0.062500,
-      0.923879,  0.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  0.961940,  -0.195090, -0.191342, 0.9622,
-      -0.1939,   -0.1914,   0.531250,  0.437500,  0.906127,  -0.195090,
-      -0.375330, 0.9063,    -0.1939,   -0.3754,   0.562500,  0.437500,
-      0.353553,  0.923880,  -0.146447, 0.3584,    0.9217,    -0.1484,
-      0.562500,  0.875000,  0.191342,  0.980785,  -0.038060, 0.1971,
-      0.9796,    -0.0392,   0.531250,  0.937500,  0.375330,  0.923880,
-      -0.074658, 0.3804,    0.9217,    -0.0757,   0.531250,  0.875000,
-      0.906127,  -0.195090, -0.375330, 0.9063,    -0.1939,   -0.3754,
-      0.562500,  0.437500,  0.906127,  -0.382683, -0.180240, 0.9070,
-      -0.3805,   -0.1804,   0.531250,  0.375000,  0.853553,  -0.382683,
-      -0.353553, 0.8544,    -0.3805,   -0.3539,   0.562500,  0.375000,
-      0.353553,  0.923880,  -0.146447, 0.3584,    0.9217,    -0.1484,
-      0.562500,  0.875000,  0.544895,  0.831470,  -0.108386, 0.5490,
-      0.8286,    -0.1092,   0.531250,  0.812500,  0.513280,  0.831470,
-      -0.212607, 0.5172,    0.8286,    -0.2142,   0.562500,  0.812500,
-      0.375330,  -0.923880, -0.074658, 0.3804,    -0.9217,   -0.0757,
-      0.531250,  0.125000,  0.195090,  -0.980785, 0.000000,  0.2010,
-      -0.9796,   -0.0000,   0.500000,  0.062500,  0.191342,  -0.980785,
-      -0.038060, 0.1971,    -0.9796,   -0.0392,   0.531250,  0.062500,
-      0.980785,  0.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.531250,  0.500000,  0.980785,  0.195090,  0.000000,  0.9810,
-      0.1939,    -0.0000,   0.500000,  0.562500,  1.000000,  0.000000,
-      0.000000,  1.0000,    -0.0000,   -0.0000,   0.500000,  0.500000,
-      0.191342,  0.980785,  -0.038060, 0.1971,    0.9796,    -0.0392,
-      0.531250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.515625,  1.000000,  0.195090,  0.980785,
-      0.000000,  0.2010,    0.9796,    -0.0000,   0.500000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.515625,  0.000000,  0.191342,  -0.980785, -0.038060, 0.1971,
-      -0.9796,   -0.0392,   0.531250,  0.062500,  0.195090,  -0.980785,
-      0.000000,  0.2010,    -0.9796,   -0.0000,   0.500000,  0.062500,
-      0.980785,  0.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.531250,  0.500000,  0.980785,  -0.195090, 0.000000,  0.9810,
-      -0.1939,   -0.0000,   0.500000,  0.437500,  0.961940,  -0.195090,
-      -0.191342, 0.9622,    -0.1939,   -0.1914,   0.531250,  0.437500,
-      0.375330,  0.923880,  -0.074658, 0.3804,    0.9217,    -0.0757,
-      0.531250,  0.875000,  0.195090,  0.980785,  0.000000,  0.2010,
-      0.9796,    -0.0000,   0.500000,  0.937500,  0.382683,  0.923880,
-      0.000000,  0.3879,    0.9217,    -0.0000,   0.500000,  0.875000,
-      0.961940,  -0.195090, -0.191342, 0.9622,    -0.1939,   -0.1914,
-      0.531250,  0.437500,  0.923879,  -0.382683, -0.000000, 0.9248,
-      -0.3805,   -0.0000,   0.500000,  0.375000,  0.906127,  -0.382683,
-      -0.180240, 0.9070,    -0.3805,   -0.1804,   0.531250,  0.375000,
-      0.375330,  0.923880,  -0.074658, 0.3804,    0.9217,    -0.0757,
-      0.531250,  0.875000,  0.555570,  0.831470,  0.000000,  0.5598,
-      0.8286,    -0.0000,   0.500000,  0.812500,  0.544895,  0.831470,
-      -0.108386, 0.5490,    0.8286,    -0.1092,   0.531250,  0.812500,
-      0.815493,  -0.555570, -0.162212, 0.8173,    -0.5528,   -0.1626,
-      0.531250,  0.312500,  0.923879,  -0.382683, -0.000000, 0.9248,
-      -0.3805,   -0.0000,   0.500000,  0.375000,  0.831469,  -0.555570,
-      0.000000,  0.8333,    -0.5528,   -0.0000,   0.500000,  0.312500,
-      0.544895,  0.831470,  -0.108386, 0.5490,    0.8286,    -0.1092,
-      0.531250,  0.812500,  0.707107,  0.707107,  -0.000000, 0.7101,
-      0.7041,    -0.0000,   0.500000,  0.750000,  0.693520,  0.707107,
-      -0.137950, 0.6965,    0.7041,    -0.1385,   0.531250,  0.750000,
-      0.815493,  -0.555570, -0.162212, 0.8173,    -0.5528,   -0.1626,
-      0.531250,  0.312500,  0.707107,  -0.707107, -0.000000, 0.7101,
-      -0.7041,   -0.0000,   0.500000,  0.250000,  0.693520,  -0.707107,
-      -0.137950, 0.6965,    -0.7041,   -0.1385,   0.531250,  0.250000,
-      0.815493,  0.555570,  -0.162212, 0.8173,    0.5528,    -0.1626,
-      0.531250,  0.687500,  0.707107,  0.707107,  -0.000000, 0.7101,
-      0.7041,    -0.0000,   0.500000,  0.750000,  0.831469,  0.555570,
-      0.000000,  0.8333,    0.5528,    -0.0000,   0.500000,  0.687500,
-      0.544895,  -0.831470, -0.108386, 0.5490,    -0.8286,   -0.1092,
-      0.531250,  0.187500,  0.707107,  -0.707107, -0.000000, 0.7101,
-      -0.7041,   -0.0000,   0.500000,  0.250000,  0.555570,  -0.831470,
-      0.000000,  0.5598,    -0.8286,   -0.0000,   0.500000,  0.187500,
-      0.815493,  0.555570,  -0.162212, 0.8173,    0.5528,    -0.1626,
-      0.531250,  0.687500,  0.923879,  0.382683,  -0.000000, 0.9248,
-      0.3805,    -0.0000,   0.500000,  0.625000,  0.906127,  0.382683,
-      -0.180240, 0.9070,    0.3805,    -0.1804,   0.531250,  0.625000,
-      0.544895,  -0.831470, -0.108386, 0.5490,    -0.8286,   -0.1092,
-      0.531250,  0.187500,  0.382683,  -0.923880, 0.000000,  0.3879,
-      -0.9217,   -0.0000,   0.500000,  0.125000,  0.375330,  -0.923880,
-      -0.074658, 0.3804,    -0.9217,   -0.0757,   0.531250,  0.125000,
-      0.961940,  0.195090,  -0.191342, 0.9622,    0.1939,    -0.1914,
-      0.531250,  0.562500,  0.923879,  0.382683,  -0.000000, 0.9248,
-      0.3805,    -0.0000,   0.500000,  0.625000,  0.980785,  0.195090,
-      0.000000,  0.9810,    0.1939,    -0.0000,   0.500000,  0.562500,
-      0.831469,  -0.555570, 0.000000,  0.8333,    -0.5528,   -0.0000,
-      0.500000,  0.312500,  0.693520,  -0.707107, 0.137950,  0.6965,
-      -0.7041,   0.1385,    0.468750,  0.250000,  0.707107,  -0.707107,
-      -0.000000, 0.7101,    -0.7041,   -0.0000,   0.500000,  0.250000,
-      0.831469,  0.555570,  0.000000,  0.8333,    0.5528,    -0.0000,
-      0.500000,  0.687500,  0.693520,  0.707107,  0.137950,  0.6965,
-      0.7041,    0.1385,    0.468750,  0.750000,  0.815493,  0.555570,
-      0.162212,  0.8173,    0.5528,    0.1626,    0.468750,  0.687500,
-      0.555570,  -0.831470, 0.000000,  0.5598,    -0.8286,   -0.0000,
-      0.500000,  0.187500,  0.693520,  -0.707107, 0.137950,  0.6965,
-      -0.7041,   0.1385,    0.468750,  0.250000,  0.544895,  -0.831470,
-      0.108386,  0.5490,    -0.8286,   0.1092,    0.468750,  0.187500,
-      0.831469,  0.555570,  0.000000,  0.8333,    0.5528,    -0.0000,
-      0.500000,  0.687500,  0.906127,  0.382683,  0.180240,  0.9070,
-      0.3805,    0.1804,    0.468750,  0.625000,  0.923879,  0.382683,
-      -0.000000, 0.9248,    0.3805,    -0.0000,   0.500000,  0.625000,
-      0.555570,  -0.831470, 0.000000,  0.5598,    -0.8286,   -0.0000,
-      0.500000,  0.187500,  0.375330,  -0.923880, 0.074658,  0.3804,
-      -0.9217,   0.0757,    0.468750,  0.125000,  0.382683,  -0.923880,
-      0.000000,  0.3879,    -0.9217,   -0.0000,   0.500000,  0.125000,
-      0.980785,  0.195090,  0.000000,  0.9810,    0.1939,    -0.0000,
-      0.500000,  0.562500,  0.906127,  0.382683,  0.180240,  0.9070,
-      0.3805,    0.1804,    0.468750,  0.625000,  0.961940,  0.195090,
-      0.191342,  0.9622,    0.1939,    0.1914,    0.468750,  0.562500,
-      0.382683,  -0.923880, 0.000000,  0.3879,    -0.9217,   -0.0000,
-      0.500000,  0.125000,  0.191342,  -0.980785, 0.038060,  0.1971,
-      -0.9796,   0.0392,    0.468750,  0.062500,  0.195090,  -0.980785,
-      0.000000,  0.2010,    -0.9796,   -0.0000,   0.500000,  0.062500,
-      1.000000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  0.961940,  0.195090,  0.191342,  0.9622,
-      0.1939,    0.1914,    0.468750,  0.562500,  0.980785,  0.000000,
-      0.195090,  0.9808,    -0.0000,   0.1951,    0.468750,  0.500000,
-      0.195090,  0.980785,  0.000000,  0.2010,    0.9796,    -0.0000,
-      0.500000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.484375,  1.000000,  0.191342,  0.980785,
-      0.038060,  0.1971,    0.9796,    0.0392,    0.468750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.484375,  0.000000,  0.195090,  -0.980785, 0.000000,  0.2010,
-      -0.9796,   -0.0000,   0.500000,  0.062500,  0.191342,  -0.980785,
-      0.038060,  0.1971,    -0.9796,   0.0392,    0.468750,  0.062500,
-      1.000000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  0.961940,  -0.195090, 0.191342,  0.9622,
-      -0.1939,   0.1914,    0.468750,  0.437500,  0.980785,  -0.195090,
-      0.000000,  0.9810,    -0.1939,   -0.0000,   0.500000,  0.437500,
-      0.195090,  0.980785,  0.000000,  0.2010,    0.9796,    -0.0000,
-      0.500000,  0.937500,  0.375330,  0.923880,  0.074658,  0.3804,
-      0.9217,    0.0757,    0.468750,  0.875000,  0.382683,  0.923880,
-      0.000000,  0.3879,    0.9217,    -0.0000,   0.500000,  0.875000,
-      0.980785,  -0.195090, 0.000000,  0.9810,    -0.1939,   -0.0000,
-      0.500000,  0.437500,  0.906127,  -0.382683, 0.180240,  0.9070,
-      -0.3805,   0.1804,    0.468750,  0.375000,  0.923879,  -0.382683,
-      -0.000000, 0.9248,    -0.3805,   -0.0000,   0.500000,  0.375000,
-      0.382683,  0.923880,  0.000000,  0.3879,    0.9217,    -0.0000,
-      0.500000,  0.875000,  0.544895,  0.831470,  0.108386,  0.5490,
-      0.8286,    0.1092,    0.468750,  0.812500,  0.555570,  0.831470,
-      0.000000,  0.5598,    0.8286,    -0.0000,   0.500000,  0.812500,
-      0.831469,  -0.555570, 0.000000,  0.8333,    -0.5528,   -0.0000,
-      0.500000,  0.312500,  0.906127,  -0.382683, 0.180240,  0.9070,
-      -0.3805,   0.1804,    0.468750,  0.375000,  0.815493,  -0.555570,
-      0.162212,  0.8173,    -0.5528,   0.1626,    0.468750,  0.312500,
-      0.555570,  0.831470,  0.000000,  0.5598,    0.8286,    -0.0000,
-      0.500000,  0.812500,  0.693520,  0.707107,  0.137950,  0.6965,
-      0.7041,    0.1385,    0.468750,  0.750000,  0.707107,  0.707107,
-      -0.000000, 0.7101,    0.7041,    -0.0000,   0.500000,  0.750000,
-      0.191342,  0.980785,  0.038060,  0.1971,    0.9796,    0.0392,
-      0.468750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.453125,  1.000000,  0.180240,  0.980785,
-      0.074658,  0.1857,    0.9796,    0.0769,    0.437500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.453125,  0.000000,  0.191342,  -0.980785, 0.038060,  0.1971,
-      -0.9796,   0.0392,    0.468750,  0.062500,  0.180240,  -0.980785,
-      0.074658,  0.1857,    -0.9796,   0.0769,    0.437500,  0.062500,
-      0.980785,  0.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.468750,  0.500000,  0.906127,  -0.195090, 0.375330,  0.9063,
-      -0.1939,   0.3754,    0.437500,  0.437500,  0.961940,  -0.195090,
-      0.191342,  0.9622,    -0.1939,   0.1914,    0.468750,  0.437500,
-      0.191342,  0.980785,  0.038060,  0.1971,    0.9796,    0.0392,
-      0.468750,  0.937500,  0.353553,  0.923880,  0.146447,  0.3584,
-      0.9217,    0.1484,    0.437500,  0.875000,  0.375330,  0.923880,
-      0.074658,  0.3804,    0.9217,    0.0757,    0.468750,  0.875000,
-      0.961940,  -0.195090, 0.191342,  0.9622,    -0.1939,   0.1914,
-      0.468750,  0.437500,  0.853553,  -0.382683, 0.353553,  0.8544,
-      -0.3805,   0.3539,    0.437500,  0.375000,  0.906127,  -0.382683,
-      0.180240,  0.9070,    -0.3805,   0.1804,    0.468750,  0.375000,
-      0.544895,  0.831470,  0.108386,  0.5490,    0.8286,    0.1092,
-      0.468750,  0.812500,  0.353553,  0.923880,  0.146447,  0.3584,
-      0.9217,    0.1484,    0.437500,  0.875000,  0.513280,  0.831470,
-      0.212608,  0.5172,    0.8286,    0.2142,    0.437500,  0.812500,
-      0.815493,  -0.555570, 0.162212,  0.8173,    -0.5528,   0.1626,
-      0.468750,  0.312500,  0.853553,  -0.382683, 0.353553,  0.8544,
-      -0.3805,   0.3539,    0.437500,  0.375000,  0.768178,  -0.555570,
-      0.318190,  0.7699,    -0.5528,   0.3189,    0.437500,  0.312500,
-      0.544895,  0.831470,  0.108386,  0.5490,    0.8286,    0.1092,
-      0.468750,  0.812500,  0.653281,  0.707107,  0.270598,  0.6561,
-      0.7041,    0.2718,    0.437500,  0.750000,  0.693520,  0.707107,
-      0.137950,  0.6965,    0.7041,    0.1385,    0.468750,  0.750000,
-      0.815493,  -0.555570, 0.162212,  0.8173,    -0.5528,   0.1626,
-      0.468750,  0.312500,  0.653281,  -0.707107, 0.270598,  0.6561,
-      -0.7041,   0.2718,    0.437500,  0.250000,  0.693520,  -0.707107,
-      0.137950,  0.6965,    -0.7041,   0.1385,    0.468750,  0.250000,
-      0.815493,  0.555570,  0.162212,  0.8173,    0.5528,    0.1626,
-      0.468750,  0.687500,  0.653281,  0.707107,  0.270598,  0.6561,
-      0.7041,    0.2718,    0.437500,  0.750000,  0.768178,  0.555570,
-      0.318190,  0.7699,    0.5528,    0.3189,    0.437500,  0.687500,
-      0.544895,  -0.831470, 0.108386,  0.5490,    -0.8286,   0.1092,
-      0.468750,  0.187500,  0.653281,  -0.707107, 0.270598,  0.6561,
-      -0.7041,   0.2718,    0.437500,  0.250000,  0.513280,  -0.831470,
-      0.212608,  0.5172,    -0.8286,   0.2142,    0.437500,  0.187500,
-      0.815493,  0.555570,  0.162212,  0.8173,    0.5528,    0.1626,
-      0.468750,  0.687500,  0.853553,  0.382683,  0.353553,  0.8544,
-      0.3805,    0.3539,    0.437500,  0.625000,  0.906127,  0.382683,
-      0.180240,  0.9070,    0.3805,    0.1804,    0.468750,  0.625000,
-      0.544895,  -0.831470, 0.108386,  0.5490,    -0.8286,   0.1092,
-      0.468750,  0.187500,  0.353553,  -0.923880, 0.146447,  0.3584,
-      -0.9217,   0.1484,    0.437500,  0.125000,  0.375330,  -0.923880,
-      0.074658,  0.3804,    -0.9217,   0.0757,    0.468750,  0.125000,
-      0.961940,  0.195090,  0.191342,  0.9622,    0.1939,    0.1914,
-      0.468750,  0.562500,  0.853553,  0.382683,  0.353553,  0.8544,
-      0.3805,    0.3539,    0.437500,  0.625000,  0.906127,  0.195090,
-      0.375330,  0.9063,    0.1939,    0.3754,    0.437500,  0.562500,
-      0.191342,  -0.980785, 0.038060,  0.1971,    -0.9796,   0.0392,
-      0.468750,  0.062500,  0.353553,  -0.923880, 0.146447,  0.3584,
-      -0.9217,   0.1484,    0.437500,  0.125000,  0.180240,  -0.980785,
-      0.074658,  0.1857,    -0.9796,   0.0769,    0.437500,  0.062500,
-      0.980785,  0.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.468750,  0.500000,  0.906127,  0.195090,  0.375330,  0.9063,
-      0.1939,    0.3754,    0.437500,  0.562500,  0.923879,  0.000000,
-      0.382683,  0.9239,    -0.0000,   0.3827,    0.437500,  0.500000,
-      0.768178,  0.555570,  0.318190,  0.7699,    0.5528,    0.3189,
-      0.437500,  0.687500,  0.587938,  0.707107,  0.392847,  0.5905,
-      0.7041,    0.3945,    0.406250,  0.750000,  0.691341,  0.555570,
-      0.461940,  0.6929,    0.5528,    0.4630,    0.406250,  0.687500,
-      0.513280,  -0.831470, 0.212608,  0.5172,    -0.8286,   0.2142,
-      0.437500,  0.187500,  0.587938,  -0.707107, 0.392847,  0.5905,
-      -0.7041,   0.3945,    0.406250,  0.250000,  0.461940,  -0.831470,
-      0.308658,  0.4654,    -0.8286,   0.3110,    0.406250,  0.187500,
-      0.768178,  0.555570,  0.318190,  0.7699,    0.5528,    0.3189,
-      0.437500,  0.687500,  0.768178,  0.382683,  0.513280,  0.7689,
-      0.3805,    0.5138,    0.406250,  0.625000,  0.853553,  0.382683,
-      0.353553,  0.8544,    0.3805,    0.3539,    0.437500,  0.625000,
-      0.513280,  -0.831470, 0.212608,  0.5172,    -0.8286,   0.2142,
-      0.437500,  0.187500,  0.318190,  -0.923880, 0.212608,  0.3225,
-      -0.9217,   0.2155,    0.406250,  0.125000,  0.353553,  -0.923880,
-      0.146447,  0.3584,    -0.9217,   0.1484,    0.437500,  0.125000,
-      0.906127,  0.195090,  0.375330,  0.9063,    0.1939,    0.3754,
-      0.437500,  0.562500,  0.768178,  0.382683,  0.513280,  0.7689,
-      0.3805,    0.5138,    0.406250,  0.625000,  0.815493,  0.195090,
-      0.544895,  0.8157,    0.1939,    0.5450,    0.406250,  0.562500,
-      0.353553,  -0.923880, 0.146447,  0.3584,    -0.9217,   0.1484,
-      0.437500,  0.125000,  0.162212,  -0.980785, 0.108386,  0.1671,
-      -0.9796,   0.1117,    0.406250,  0.062500,  0.180240,  -0.980785,
-      0.074658,  0.1857,    -0.9796,   0.0769,    0.437500,  0.062500,
-      0.923879,  0.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  0.815493,  0.195090,  0.544895,  0.8157,
-      0.1939,    0.5450,    0.406250,  0.562500,  0.831469,  0.000000,
-      0.555570,  0.8315,    -0.0000,   0.5556,    0.406250,  0.500000,
-      0.180240,  0.980785,  0.074658,  0.1857,    0.9796,    0.0769,
-      0.437500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.421875,  1.000000,  0.162212,  0.980785,
-      0.108386,  0.1671,    0.9796,    0.1117,    0.406250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.421875,  0.000000,  0.180240,  -0.980785, 0.074658,  0.1857,
-      -0.9796,   0.0769,    0.437500,  0.062500,  0.162212,  -0.980785,
-      0.108386,  0.1671,    -0.9796,   0.1117,    0.406250,  0.062500,
-      0.923879,  0.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  0.815493,  -0.195090, 0.544895,  0.8157,
-      -0.1939,   0.5450,    0.406250,  0.437500,  0.906127,  -0.195090,
-      0.375330,  0.9063,    -0.1939,   0.3754,    0.437500,  0.437500,
-      0.180240,  0.980785,  0.074658,  0.1857,    0.9796,    0.0769,
-      0.437500,  0.937500,  0.318190,  0.923880,  0.212608,  0.3225,
-      0.9217,    0.2155,    0.406250,  0.875000,  0.353553,  0.923880,
-      0.146447,  0.3584,    0.9217,    0.1484,    0.437500,  0.875000,
-      0.906127,  -0.195090, 0.375330,  0.9063,    -0.1939,   0.3754,
-      0.437500,  0.437500,  0.768178,  -0.382683, 0.513280,  0.7689,
-      -0.3805,   0.5138,    0.406250,  0.375000,  0.853553,  -0.382683,
-      0.353553,  0.8544,    -0.3805,   0.3539,    0.437500,  0.375000,
-      0.513280,  0.831470,  0.212608,  0.5172,    0.8286,    0.2142,
-      0.437500,  0.812500,  0.318190,  0.923880,  0.212608,  0.3225,
-      0.9217,    0.2155,    0.406250,  0.875000,  0.461940,  0.831470,
-      0.308658,  0.4654,    0.8286,    0.3110,    0.406250,  0.812500,
-      0.768178,  -0.555570, 0.318190,  0.7699,    -0.5528,   0.3189,
-      0.437500,  0.312500,  0.768178,  -0.382683, 0.513280,  0.7689,
-      -0.3805,   0.5138,    0.406250,  0.375000,  0.691341,  -0.555570,
-      0.461940,  0.6929,    -0.5528,   0.4630,    0.406250,  0.312500,
-      0.513280,  0.831470,  0.212608,  0.5172,    0.8286,    0.2142,
-      0.437500,  0.812500,  0.587938,  0.707107,  0.392847,  0.5905,
-      0.7041,    0.3945,    0.406250,  0.750000,  0.653281,  0.707107,
-      0.270598,  0.6561,    0.7041,    0.2718,    0.437500,  0.750000,
-      0.768178,  -0.555570, 0.318190,  0.7699,    -0.5528,   0.3189,
-      0.437500,  0.312500,  0.587938,  -0.707107, 0.392847,  0.5905,
-      -0.7041,   0.3945,    0.406250,  0.250000,  0.653281,  -0.707107,
-      0.270598,  0.6561,    -0.7041,   0.2718,    0.437500,  0.250000,
-      0.831469,  0.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.406250,  0.500000,  0.693520,  -0.195090, 0.693520,  0.6937,
-      -0.1939,   0.6937,    0.375000,  0.437500,  0.815493,  -0.195090,
-      0.544895,  0.8157,    -0.1939,   0.5450,    0.406250,  0.437500,
-      0.162212,  0.980785,  0.108386,  0.1671,    0.9796,    0.1117,
-      0.406250,  0.937500,  0.270598,  0.923880,  0.270598,  0.2743,
-      0.9217,    0.2743,    0.375000,  0.875000,  0.318190,  0.923880,
-      0.212608,  0.3225,    0.9217,    0.2155,    0.406250,  0.875000,
-      0.815493,  -0.195090, 0.544895,  0.8157,    -0.1939,   0.5450,
-      0.406250,  0.437500,  0.653281,  -0.382683, 0.653281,  0.6539,
-      -0.3805,   0.6539,    0.375000,  0.375000,  0.768178,  -0.382683,
-      0.513280,  0.7689,    -0.3805,   0.5138,    0.406250,  0.375000,
-      0.318190,  0.923880,  0.212608,  0.3225,    0.9217,    0.2155,
-      0.406250,  0.875000,  0.392847,  0.831470,  0.392847,  0.3958,
-      0.8286,    0.3958,    0.375000,  0.812500,  0.461940,  0.831470,
-      0.308658,  0.4654,    0.8286,    0.3110,    0.406250,  0.812500,
-      0.691341,  -0.555570, 0.461940,  0.6929,    -0.5528,   0.4630,
-      0.406250,  0.312500,  0.653281,  -0.382683, 0.653281,  0.6539,
-      -0.3805,   0.6539,    0.375000,  0.375000,  0.587938,  -0.555570,
-      0.587938,  0.5893,    -0.5528,   0.5893,    0.375000,  0.312500,
-      0.461940,  0.831470,  0.308658,  0.4654,    0.8286,    0.3110,
-      0.406250,  0.812500,  0.500000,  0.707107,  0.500000,  0.5021,
-      0.7041,    0.5021,    0.375000,  0.750000,  0.587938,  0.707107,
-      0.392847,  0.5905,    0.7041,    0.3945,    0.406250,  0.750000,
-      0.691341,  -0.555570, 0.461940,  0.6929,    -0.5528,   0.4630,
-      0.406250,  0.312500,  0.500000,  -0.707107, 0.500000,  0.5021,
-      -0.7041,   0.5021,    0.375000,  0.250000,  0.587938,  -0.707107,
-      0.392847,  0.5905,    -0.7041,   0.3945,    0.406250,  0.250000,
-      0.691341,  0.555570,  0.461940,  0.6929,    0.5528,    0.4630,
-      0.406250,  0.687500,  0.500000,  0.707107,  0.500000,  0.5021,
-      0.7041,    0.5021,    0.375000,  0.750000,  0.587938,  0.555570,
-      0.587938,  0.5893,    0.5528,    0.5893,    0.375000,  0.687500,
-      0.587938,  -0.707107, 0.392847,  0.5905,    -0.7041,   0.3945,
-      0.406250,  0.250000,  0.392847,  -0.831470, 0.392847,  0.3958,
-      -0.8286,   0.3958,    0.375000,  0.187500,  0.461940,  -0.831470,
-      0.308658,  0.4654,    -0.8286,   0.3110,    0.406250,  0.187500,
-      0.691341,  0.555570,  0.461940,  0.6929,    0.5528,    0.4630,
-      0.406250,  0.687500,  0.653281,  0.382683,  0.653281,  0.6539,
-      0.3805,    0.6539,    0.375000,  0.625000,  0.768178,  0.382683,
-      0.513280,  0.7689,    0.3805,    0.5138,    0.406250,  0.625000,
-      0.318190,  -0.923880, 0.212608,  0.3225,    -0.9217,   0.2155,
-      0.406250,  0.125000,  0.392847,  -0.831470, 0.392847,  0.3958,
-      -0.8286,   0.3958,    0.375000,  0.187500,  0.270598,  -0.923880,
-      0.270598,  0.2743,    -0.9217,   0.2743,    0.375000,  0.125000,
-      0.815493,  0.195090,  0.544895,  0.8157,    0.1939,    0.5450,
-      0.406250,  0.562500,  0.653281,  0.382683,  0.653281,  0.6539,
-      0.3805,    0.6539,    0.375000,  0.625000,  0.693520,  0.195090,
-      0.693520,  0.6937,    0.1939,    0.6937,    0.375000,  0.562500,
-      0.162212,  -0.980785, 0.108386,  0.1671,    -0.9796,   0.1117,
-      0.406250,  0.062500,  0.270598,  -0.923880, 0.270598,  0.2743,
-      -0.9217,   0.2743,    0.375000,  0.125000,  0.137950,  -0.980785,
-      0.137950,  0.1421,    -0.9796,   0.1421,    0.375000,  0.062500,
-      0.831469,  0.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.406250,  0.500000,  0.693520,  0.195090,  0.693520,  0.6937,
-      0.1939,    0.6937,    0.375000,  0.562500,  0.707106,  0.000000,
-      0.707107,  0.7071,    -0.0000,   0.7071,    0.375000,  0.500000,
-      0.162212,  0.980785,  0.108386,  0.1671,    0.9796,    0.1117,
-      0.406250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.390625,  1.000000,  0.137950,  0.980785,
-      0.137950,  0.1421,    0.9796,    0.1421,    0.375000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.390625,  0.000000,  0.162212,  -0.980785, 0.108386,  0.1671,
-      -0.9796,   0.1117,    0.406250,  0.062500,  0.137950,  -0.980785,
-      0.137950,  0.1421,    -0.9796,   0.1421,    0.375000,  0.062500,
-      0.392847,  -0.831470, 0.392847,  0.3958,    -0.8286,   0.3958,
-      0.375000,  0.187500,  0.392847,  -0.707107, 0.587938,  0.3945,
-      -0.7041,   0.5905,    0.343750,  0.250000,  0.308658,  -0.831470,
-      0.461940,  0.3110,    -0.8286,   0.4654,    0.343750,  0.187500,
-      0.587938,  0.555570,  0.587938,  0.5893,    0.5528,    0.5893,
-      0.375000,  0.687500,  0.513280,  0.382683,  0.768178,  0.5138,
-      0.3805,    0.7689,    0.343750,  0.625000,  0.653281,  0.382683,
-      0.653281,  0.6539,    0.3805,    0.6539,    0.375000,  0.625000,
-      0.392847,  -0.831470, 0.392847,  0.3958,    -0.8286,   0.3958,
-      0.375000,  0.187500,  0.212607,  -0.923880, 0.318190,  0.2155,
-      -0.9217,   0.3225,    0.343750,  0.125000,  0.270598,  -0.923880,
-      0.270598,  0.2743,    -0.9217,   0.2743,    0.375000,  0.125000,
-      0.693520,  0.195090,  0.693520,  0.6937,    0.1939,    0.6937,
-      0.375000,  0.562500,  0.513280,  0.382683,  0.768178,  0.5138,
-      0.3805,    0.7689,    0.343750,  0.625000,  0.544895,  0.195090,
-      0.815493,  0.5450,    0.1939,    0.8157,    0.343750,  0.562500,
-      0.270598,  -0.923880, 0.270598,  0.2743,    -0.9217,   0.2743,
-      0.375000,  0.125000,  0.108386,  -0.980785, 0.162212,  0.1117,
-      -0.9796,   0.1671,    0.343750,  0.062500,  0.137950,  -0.980785,
-      0.137950,  0.1421,    -0.9796,   0.1421,    0.375000,  0.062500,
-      0.707106,  0.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.544895,  0.195090,  0.815493,  0.5450,
-      0.1939,    0.8157,    0.343750,  0.562500,  0.555570,  0.000000,
-      0.831469,  0.5556,    -0.0000,   0.8315,    0.343750,  0.500000,
-      0.137950,  0.980785,  0.137950,  0.1421,    0.9796,    0.1421,
-      0.375000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.359375,  1.000000,  0.108386,  0.980785,
-      0.162212,  0.1117,    0.9796,    0.1671,    0.343750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.359375,  0.000000,  0.137950,  -0.980785, 0.137950,  0.1421,
-      -0.9796,   0.1421,    0.375000,  0.062500,  0.108386,  -0.980785,
-      0.162212,  0.1117,    -0.9796,   0.1671,    0.343750,  0.062500,
-      0.707106,  0.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.544895,  -0.195090, 0.815493,  0.5450,
-      -0.1939,   0.8157,    0.343750,  0.437500,  0.693520,  -0.195090,
-      0.693520,  0.6937,    -0.1939,   0.6937,    0.375000,  0.437500,
-      0.270598,  0.923880,  0.270598,  0.2743,    0.9217,    0.2743,
-      0.375000,  0.875000,  0.108386,  0.980785,  0.162212,  0.1117,
-      0.9796,    0.1671,    0.343750,  0.937500,  0.212607,  0.923880,
-      0.318190,  0.2155,    0.9217,    0.3225,    0.343750,  0.875000,
-      0.693520,  -0.195090, 0.693520,  0.6937,    -0.1939,   0.6937,
-      0.375000,  0.437500,  0.513280,  -0.382683, 0.768178,  0.5138,
-      -0.3805,   0.7689,    0.343750,  0.375000,  0.653281,  -0.382683,
-      0.653281,  0.6539,    -0.3805,   0.6539,    0.375000,  0.375000,
-      0.392847,  0.831470,  0.392847,  0.3958,    0.8286,    0.3958,
-      0.375000,  0.812500,  0.212607,  0.923880,  0.318190,  0.2155,
-      0.9217,    0.3225,    0.343750,  0.875000,  0.308658,  0.831470,
-      0.461940,  0.3110,    0.8286,    0.4654,    0.343750,  0.812500,
-      0.587938,  -0.555570, 0.587938,  0.5893,    -0.5528,   0.5893,
-      0.375000,  0.312500,  0.513280,  -0.382683, 0.768178,  0.5138,
-      -0.3805,   0.7689,    0.343750,  0.375000,  0.461940,  -0.555570,
-      0.691342,  0.4630,    -0.5528,   0.6929,    0.343750,  0.312500,
-      0.392847,  0.831470,  0.392847,  0.3958,    0.8286,    0.3958,
-      0.375000,  0.812500,  0.392847,  0.707107,  0.587938,  0.3945,
-      0.7041,    0.5905,    0.343750,  0.750000,  0.500000,  0.707107,
-      0.500000,  0.5021,    0.7041,    0.5021,    0.375000,  0.750000,
-      0.587938,  -0.555570, 0.587938,  0.5893,    -0.5528,   0.5893,
-      0.375000,  0.312500,  0.392847,  -0.707107, 0.587938,  0.3945,
-      -0.7041,   0.5905,    0.343750,  0.250000,  0.500000,  -0.707107,
-      0.500000,  0.5021,    -0.7041,   0.5021,    0.375000,  0.250000,
-      0.587938,  0.555570,  0.587938,  0.5893,    0.5528,    0.5893,
-      0.375000,  0.687500,  0.392847,  0.707107,  0.587938,  0.3945,
-      0.7041,    0.5905,    0.343750,  0.750000,  0.461940,  0.555570,
-      0.691342,  0.4630,    0.5528,    0.6929,    0.343750,  0.687500,
-      0.108386,  0.980785,  0.162212,  0.1117,    0.9796,    0.1671,
-      0.343750,  0.937500,  0.146447,  0.923880,  0.353553,  0.1484,
-      0.9217,    0.3584,    0.312500,  0.875000,  0.212607,  0.923880,
-      0.318190,  0.2155,    0.9217,    0.3225,    0.343750,  0.875000,
-      0.544895,  -0.195090, 0.815493,  0.5450,    -0.1939,   0.8157,
-      0.343750,  0.437500,  0.353553,  -0.382683, 0.853553,  0.3539,
-      -0.3805,   0.8544,    0.312500,  0.375000,  0.513280,  -0.382683,
-      0.768178,  0.5138,    -0.3805,   0.7689,    0.343750,  0.375000,
-      0.212607,  0.923880,  0.318190,  0.2155,    0.9217,    0.3225,
-      0.343750,  0.875000,  0.212607,  0.831470,  0.513280,  0.2142,
-      0.8286,    0.5172,    0.312500,  0.812500,  0.308658,  0.831470,
-      0.461940,  0.3110,    0.8286,    0.4654,    0.343750,  0.812500,
-      0.461940,  -0.555570, 0.691342,  0.4630,    -0.5528,   0.6929,
-      0.343750,  0.312500,  0.353553,  -0.382683, 0.853553,  0.3539,
-      -0.3805,   0.8544,    0.312500,  0.375000,  0.318189,  -0.555570,
-      0.768178,  0.3189,    -0.5528,   0.7699,    0.312500,  0.312500,
-      0.308658,  0.831470,  0.461940,  0.3110,    0.8286,    0.4654,
-      0.343750,  0.812500,  0.270598,  0.707107,  0.653281,  0.2718,
-      0.7041,    0.6561,    0.312500,  0.750000,  0.392847,  0.707107,
-      0.587938,  0.3945,    0.7041,    0.5905,    0.343750,  0.750000,
-      0.461940,  -0.555570, 0.691342,  0.4630,    -0.5528,   0.6929,
-      0.343750,  0.312500,  0.270598,  -0.707107, 0.653281,  0.2718,
-      -0.7041,   0.6561,    0.312500,  0.250000,  0.392847,  -0.707107,
-      0.587938,  0.3945,    -0.7041,   0.5905,    0.343750,  0.250000,
-      0.461940,  0.555570,  0.691342,  0.4630,    0.5528,    0.6929,
-      0.343750,  0.687500,  0.270598,  0.707107,  0.653281,  0.2718,
-      0.7041,    0.6561,    0.312500,  0.750000,  0.318189,  0.555570,
-      0.768178,  0.3189,    0.5528,    0.7699,    0.312500,  0.687500,
-      0.308658,  -0.831470, 0.461940,  0.3110,    -0.8286,   0.4654,
-      0.343750,  0.187500,  0.270598,  -0.707107, 0.653281,  0.2718,
-      -0.7041,   0.6561,    0.312500,  0.250000,  0.212607,  -0.831470,
-      0.513280,  0.2142,    -0.8286,   0.5172,    0.312500,  0.187500,
-      0.461940,  0.555570,  0.691342,  0.4630,    0.5528,    0.6929,
-      0.343750,  0.687500,  0.353553,  0.382683,  0.853553,  0.3539,
-      0.3805,    0.8544,    0.312500,  0.625000,  0.513280,  0.382683,
-      0.768178,  0.5138,    0.3805,    0.7689,    0.343750,  0.625000,
-      0.308658,  -0.831470, 0.461940,  0.3110,    -0.8286,   0.4654,
-      0.343750,  0.187500,  0.146447,  -0.923880, 0.353553,  0.1484,
-      -0.9217,   0.3584,    0.312500,  0.125000,  0.212607,  -0.923880,
-      0.318190,  0.2155,    -0.9217,   0.3225,    0.343750,  0.125000,
-      0.544895,  0.195090,  0.815493,  0.5450,    0.1939,    0.8157,
-      0.343750,  0.562500,  0.353553,  0.382683,  0.853553,  0.3539,
-      0.3805,    0.8544,    0.312500,  0.625000,  0.375330,  0.195090,
-      0.906127,  0.3754,    0.1939,    0.9063,    0.312500,  0.562500,
-      0.212607,  -0.923880, 0.318190,  0.2155,    -0.9217,   0.3225,
-      0.343750,  0.125000,  0.074658,  -0.980785, 0.180240,  0.0769,
-      -0.9796,   0.1857,    0.312500,  0.062500,  0.108386,  -0.980785,
-      0.162212,  0.1117,    -0.9796,   0.1671,    0.343750,  0.062500,
-      0.555570,  0.000000,  0.831469,  0.5556,    -0.0000,   0.8315,
-      0.343750,  0.500000,  0.375330,  0.195090,  0.906127,  0.3754,
-      0.1939,    0.9063,    0.312500,  0.562500,  0.382683,  0.000000,
-      0.923879,  0.3827,    -0.0000,   0.9239,    0.312500,  0.500000,
-      0.108386,  0.980785,  0.162212,  0.1117,    0.9796,    0.1671,
-      0.343750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.328125,  1.000000,  0.074658,  0.980785,
-      0.180240,  0.0769,    0.9796,    0.1857,    0.312500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.328125,  0.000000,  0.108386,  -0.980785, 0.162212,  0.1117,
-      -0.9796,   0.1671,    0.343750,  0.062500,  0.074658,  -0.980785,
-      0.180240,  0.0769,    -0.9796,   0.1857,    0.312500,  0.062500,
-      0.555570,  0.000000,  0.831469,  0.5556,    -0.0000,   0.8315,
-      0.343750,  0.500000,  0.375330,  -0.195090, 0.906127,  0.3754,
-      -0.1939,   0.9063,    0.312500,  0.437500,  0.544895,  -0.195090,
-      0.815493,  0.5450,    -0.1939,   0.8157,    0.343750,  0.437500,
-      0.318189,  0.555570,  0.768178,  0.3189,    0.5528,    0.7699,
-      0.312500,  0.687500,  0.180240,  0.382683,  0.906127,  0.1804,
-      0.3805,    0.9070,    0.281250,  0.625000,  0.353553,  0.382683,
-      0.853553,  0.3539,    0.3805,    0.8544,    0.312500,  0.625000,
-      0.212607,  -0.831470, 0.513280,  0.2142,    -0.8286,   0.5172,
-      0.312500,  0.187500,  0.074658,  -0.923880, 0.375330,  0.0757,
-      -0.9217,   0.3804,    0.281250,  0.125000,  0.146447,  -0.923880,
-      0.353553,  0.1484,    -0.9217,   0.3584,    0.312500,  0.125000,
-      0.375330,  0.195090,  0.906127,  0.3754,    0.1939,    0.9063,
-      0.312500,  0.562500,  0.180240,  0.382683,  0.906127,  0.1804,
-      0.3805,    0.9070,    0.281250,  0.625000,  0.191342,  0.195090,
-      0.961939,  0.1914,    0.1939,    0.9622,    0.281250,  0.562500,
-      0.146447,  -0.923880, 0.353553,  0.1484,    -0.9217,   0.3584,
-      0.312500,  0.125000,  0.038060,  -0.980785, 0.191342,  0.0392,
-      -0.9796,   0.1971,    0.281250,  0.062500,  0.074658,  -0.980785,
-      0.180240,  0.0769,    -0.9796,   0.1857,    0.312500,  0.062500,
-      0.382683,  0.000000,  0.923879,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.191342,  0.195090,  0.961939,  0.1914,
-      0.1939,    0.9622,    0.281250,  0.562500,  0.195090,  0.000000,
-      0.980785,  0.1951,    -0.0000,   0.9808,    0.281250,  0.500000,
-      0.074658,  0.980785,  0.180240,  0.0769,    0.9796,    0.1857,
-      0.312500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.296875,  1.000000,  0.038060,  0.980785,
-      0.191342,  0.0392,    0.9796,    0.1971,    0.281250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.296875,  0.000000,  0.074658,  -0.980785, 0.180240,  0.0769,
-      -0.9796,   0.1857,    0.312500,  0.062500,  0.038060,  -0.980785,
-      0.191342,  0.0392,    -0.9796,   0.1971,    0.281250,  0.062500,
-      0.382683,  0.000000,  0.923879,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.191342,  -0.195090, 0.961939,  0.1914,
-      -0.1939,   0.9622,    0.281250,  0.437500,  0.375330,  -0.195090,
-      0.906127,  0.3754,    -0.1939,   0.9063,    0.312500,  0.437500,
-      0.074658,  0.980785,  0.180240,  0.0769,    0.9796,    0.1857,
-      0.312500,  0.937500,  0.074658,  0.923880,  0.375330,  0.0757,
-      0.9217,    0.3804,    0.281250,  0.875000,  0.146447,  0.923880,
-      0.353553,  0.1484,    0.9217,    0.3584,    0.312500,  0.875000,
-      0.375330,  -0.195090, 0.906127,  0.3754,    -0.1939,   0.9063,
-      0.312500,  0.437500,  0.180240,  -0.382683, 0.906127,  0.1804,
-      -0.3805,   0.9070,    0.281250,  0.375000,  0.353553,  -0.382683,
-      0.853553,  0.3539,    -0.3805,   0.8544,    0.312500,  0.375000,
-      0.146447,  0.923880,  0.353553,  0.1484,    0.9217,    0.3584,
-      0.312500,  0.875000,  0.108386,  0.831470,  0.544895,  0.1092,
-      0.8286,    0.5490,    0.281250,  0.812500,  0.212607,  0.831470,
-      0.513280,  0.2142,    0.8286,    0.5172,    0.312500,  0.812500,
-      0.318189,  -0.555570, 0.768178,  0.3189,    -0.5528,   0.7699,
-      0.312500,  0.312500,  0.180240,  -0.382683, 0.906127,  0.1804,
-      -0.3805,   0.9070,    0.281250,  0.375000,  0.162212,  -0.555570,
-      0.815493,  0.1626,    -0.5528,   0.8173,    0.281250,  0.312500,
-      0.212607,  0.831470,  0.513280,  0.2142,    0.8286,    0.5172,
-      0.312500,  0.812500,  0.137950,  0.707107,  0.693520,  0.1385,
-      0.7041,    0.6965,    0.281250,  0.750000,  0.270598,  0.707107,
-      0.653281,  0.2718,    0.7041,    0.6561,    0.312500,  0.750000,
-      0.318189,  -0.555570, 0.768178,  0.3189,    -0.5528,   0.7699,
-      0.312500,  0.312500,  0.137950,  -0.707107, 0.693520,  0.1385,
-      -0.7041,   0.6965,    0.281250,  0.250000,  0.270598,  -0.707107,
-      0.653281,  0.2718,    -0.7041,   0.6561,    0.312500,  0.250000,
-      0.318189,  0.555570,  0.768178,  0.3189,    0.5528,    0.7699,
-      0.312500,  0.687500,  0.137950,  0.707107,  0.693520,  0.1385,
-      0.7041,    0.6965,    0.281250,  0.750000,  0.162212,  0.555570,
-      0.815493,  0.1626,    0.5528,    0.8173,    0.281250,  0.687500,
-      0.212607,  -0.831470, 0.513280,  0.2142,    -0.8286,   0.5172,
-      0.312500,  0.187500,  0.137950,  -0.707107, 0.693520,  0.1385,
-      -0.7041,   0.6965,    0.281250,  0.250000,  0.108386,  -0.831470,
-      0.544895,  0.1092,    -0.8286,   0.5490,    0.281250,  0.187500,
-      0.191342,  -0.195090, 0.961939,  0.1914,    -0.1939,   0.9622,
-      0.281250,  0.437500,  0.000000,  -0.382683, 0.923879,  -0.0000,
-      -0.3805,   0.9248,    0.250000,  0.375000,  0.180240,  -0.382683,
-      0.906127,  0.1804,    -0.3805,   0.9070,    0.281250,  0.375000,
-      0.108386,  0.831470,  0.544895,  0.1092,    0.8286,    0.5490,
-      0.281250,  0.812500,  -0.000000, 0.923880,  0.382683,  -0.0000,
-      0.9217,    0.3879,    0.250000,  0.875000,  -0.000000, 0.831470,
-      0.555570,  -0.0000,   0.8286,    0.5598,    0.250000,  0.812500,
-      0.162212,  -0.555570, 0.815493,  0.1626,    -0.5528,   0.8173,
-      0.281250,  0.312500,  0.000000,  -0.382683, 0.923879,  -0.0000,
-      -0.3805,   0.9248,    0.250000,  0.375000,  -0.000000, -0.555570,
-      0.831469,  -0.0000,   -0.5528,   0.8333,    0.250000,  0.312500,
-      0.108386,  0.831470,  0.544895,  0.1092,    0.8286,    0.5490,
-      0.281250,  0.812500,  -0.000000, 0.707107,  0.707107,  -0.0000,
-      0.7041,    0.7101,    0.250000,  0.750000,  0.137950,  0.707107,
-      0.693520,  0.1385,    0.7041,    0.6965,    0.281250,  0.750000,
-      0.162212,  -0.555570, 0.815493,  0.1626,    -0.5528,   0.8173,
-      0.281250,  0.312500,  -0.000000, -0.707107, 0.707107,  -0.0000,
-      -0.7041,   0.7101,    0.250000,  0.250000,  0.137950,  -0.707107,
-      0.693520,  0.1385,    -0.7041,   0.6965,    0.281250,  0.250000,
-      0.162212,  0.555570,  0.815493,  0.1626,    0.5528,    0.8173,
-      0.281250,  0.687500,  -0.000000, 0.707107,  0.707107,  -0.0000,
-      0.7041,    0.7101,    0.250000,  0.750000,  -0.000000, 0.555570,
-      0.831469,  -0.0000,   0.5528,    0.8333,    0.250000,  0.687500,
-      0.108386,  -0.831470, 0.544895,  0.1092,    -0.8286,   0.5490,
-      0.281250,  0.187500,  -0.000000, -0.707107, 0.707107,  -0.0000,
-      -0.7041,   0.7101,    0.250000,  0.250000,  -0.000000, -0.831470,
-      0.555570,  -0.0000,   -0.8286,   0.5598,    0.250000,  0.187500,
-      0.162212,  0.555570,  0.815493,  0.1626,    0.5528,    0.8173,
-      0.281250,  0.687500,  0.000000,  0.382683,  0.923879,  -0.0000,
-      0.3805,    0.9248,    0.250000,  0.625000,  0.180240,  0.382683,
-      0.906127,  0.1804,    0.3805,    0.9070,    0.281250,  0.625000,
-      0.108386,  -0.831470, 0.544895,  0.1092,    -0.8286,   0.5490,
-      0.281250,  0.187500,  -0.000000, -0.923880, 0.382683,  -0.0000,
-      -0.9217,   0.3879,    0.250000,  0.125000,  0.074658,  -0.923880,
-      0.375330,  0.0757,    -0.9217,   0.3804,    0.281250,  0.125000,
-      0.191342,  0.195090,  0.961939,  0.1914,    0.1939,    0.9622,
-      0.281250,  0.562500,  0.000000,  0.382683,  0.923879,  -0.0000,
-      0.3805,    0.9248,    0.250000,  0.625000,  -0.000000, 0.195090,
-      0.980785,  -0.0000,   0.1939,    0.9810,    0.250000,  0.562500,
-      0.038060,  -0.980785, 0.191342,  0.0392,    -0.9796,   0.1971,
-      0.281250,  0.062500,  -0.000000, -0.923880, 0.382683,  -0.0000,
-      -0.9217,   0.3879,    0.250000,  0.125000,  -0.000000, -0.980785,
-      0.195090,  -0.0000,   -0.9796,   0.2010,    0.250000,  0.062500,
-      0.195090,  0.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.281250,  0.500000,  -0.000000, 0.195090,  0.980785,  -0.0000,
-      0.1939,    0.9810,    0.250000,  0.562500,  -0.000000, 0.000000,
-      0.999999,  -0.0000,   -0.0000,   1.0000,    0.250000,  0.500000,
-      0.038060,  0.980785,  0.191342,  0.0392,    0.9796,    0.1971,
-      0.281250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.265625,  1.000000,  -0.000000, 0.980785,
-      0.195090,  -0.0000,   0.9796,    0.2010,    0.250000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.265625,  0.000000,  0.038060,  -0.980785, 0.191342,  0.0392,
-      -0.9796,   0.1971,    0.281250,  0.062500,  -0.000000, -0.980785,
-      0.195090,  -0.0000,   -0.9796,   0.2010,    0.250000,  0.062500,
-      0.195090,  0.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.281250,  0.500000,  -0.000000, -0.195090, 0.980785,  -0.0000,
-      -0.1939,   0.9810,    0.250000,  0.437500,  0.191342,  -0.195090,
-      0.961939,  0.1914,    -0.1939,   0.9622,    0.281250,  0.437500,
-      0.038060,  0.980785,  0.191342,  0.0392,    0.9796,    0.1971,
-      0.281250,  0.937500,  -0.000000, 0.923880,  0.382683,  -0.0000,
-      0.9217,    0.3879,    0.250000,  0.875000,  0.074658,  0.923880,
-      0.375330,  0.0757,    0.9217,    0.3804,    0.281250,  0.875000,
-      -0.000000, -0.831470, 0.555570,  -0.0000,   -0.8286,   0.5598,
-      0.250000,  0.187500,  -0.074658, -0.923880, 0.375330,  -0.0757,
-      -0.9217,   0.3804,    0.218750,  0.125000,  -0.000000, -0.923880,
-      0.382683,  -0.0000,   -0.9217,   0.3879,    0.250000,  0.125000,
-      -0.000000, 0.195090,  0.980785,  -0.0000,   0.1939,    0.9810,
-      0.250000,  0.562500,  -0.180240, 0.382683,  0.906127,  -0.1804,
-      0.3805,    0.9070,    0.218750,  0.625000,  -0.191342, 0.195090,
-      0.961939,  -0.1914,   0.1939,    0.9622,    0.218750,  0.562500,
-      -0.000000, -0.923880, 0.382683,  -0.0000,   -0.9217,   0.3879,
-      0.250000,  0.125000,  -0.038060, -0.980785, 0.191342,  -0.0392,
-      -0.9796,   0.1971,    0.218750,  0.062500,  -0.000000, -0.980785,
-      0.195090,  -0.0000,   -0.9796,   0.2010,    0.250000,  0.062500,
-      -0.000000, 0.000000,  0.999999,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  -0.191342, 0.195090,  0.961939,  -0.1914,
-      0.1939,    0.9622,    0.218750,  0.562500,  -0.195091, 0.000000,
-      0.980785,  -0.1951,   -0.0000,   0.9808,    0.218750,  0.500000,
-      -0.000000, 0.980785,  0.195090,  -0.0000,   0.9796,    0.2010,
-      0.250000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.234375,  1.000000,  -0.038060, 0.980785,
-      0.191342,  -0.0392,   0.9796,    0.1971,    0.218750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.234375,  0.000000,  -0.000000, -0.980785, 0.195090,  -0.0000,
-      -0.9796,   0.2010,    0.250000,  0.062500,  -0.038060, -0.980785,
-      0.191342,  -0.0392,   -0.9796,   0.1971,    0.218750,  0.062500,
-      -0.000000, 0.000000,  0.999999,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  -0.191342, -0.195090, 0.961939,  -0.1914,
-      -0.1939,   0.9622,    0.218750,  0.437500,  -0.000000, -0.195090,
-      0.980785,  -0.0000,   -0.1939,   0.9810,    0.250000,  0.437500,
-      -0.000000, 0.980785,  0.195090,  -0.0000,   0.9796,    0.2010,
-      0.250000,  0.937500,  -0.074658, 0.923880,  0.375330,  -0.0757,
-      0.9217,    0.3804,    0.218750,  0.875000,  -0.000000, 0.923880,
-      0.382683,  -0.0000,   0.9217,    0.3879,    0.250000,  0.875000,
-      -0.000000, -0.195090, 0.980785,  -0.0000,   -0.1939,   0.9810,
-      0.250000,  0.437500,  -0.180240, -0.382683, 0.906127,  -0.1804,
-      -0.3805,   0.9070,    0.218750,  0.375000,  0.000000,  -0.382683,
-      0.923879,  -0.0000,   -0.3805,   0.9248,    0.250000,  0.375000,
-      -0.000000, 0.923880,  0.382683,  -0.0000,   0.9217,    0.3879,
-      0.250000,  0.875000,  -0.108386, 0.831470,  0.544895,  -0.1092,
-      0.8286,    0.5490,    0.218750,  0.812500,  -0.000000, 0.831470,
-      0.555570,  -0.0000,   0.8286,    0.5598,    0.250000,  0.812500,
-      -0.000000, -0.555570, 0.831469,  -0.0000,   -0.5528,   0.8333,
-      0.250000,  0.312500,  -0.180240, -0.382683, 0.906127,  -0.1804,
-      -0.3805,   0.9070,    0.218750,  0.375000,  -0.162212, -0.555570,
-      0.815493,  -0.1626,   -0.5528,   0.8173,    0.218750,  0.312500,
-      -0.000000, 0.831470,  0.555570,  -0.0000,   0.8286,    0.5598,
-      0.250000,  0.812500,  -0.137950, 0.707107,  0.693520,  -0.1385,
-      0.7041,    0.6965,    0.218750,  0.750000,  -0.000000, 0.707107,
-      0.707107,  -0.0000,   0.7041,    0.7101,    0.250000,  0.750000,
-      -0.000000, -0.555570, 0.831469,  -0.0000,   -0.5528,   0.8333,
-      0.250000,  0.312500,  -0.137950, -0.707107, 0.693520,  -0.1385,
-      -0.7041,   0.6965,    0.218750,  0.250000,  -0.000000, -0.707107,
-      0.707107,  -0.0000,   -0.7041,   0.7101,    0.250000,  0.250000,
-      -0.000000, 0.555570,  0.831469,  -0.0000,   0.5528,    0.8333,
-      0.250000,  0.687500,  -0.137950, 0.707107,  0.693520,  -0.1385,
-      0.7041,    0.6965,    0.218750,  0.750000,  -0.162212, 0.555570,
-      0.815493,  -0.1626,   0.5528,    0.8173,    0.218750,  0.687500,
-      -0.000000, -0.831470, 0.555570,  -0.0000,   -0.8286,   0.5598,
-      0.250000,  0.187500,  -0.137950, -0.707107, 0.693520,  -0.1385,
-      -0.7041,   0.6965,    0.218750,  0.250000,  -0.108386, -0.831470,
-      0.544895,  -0.1092,   -0.8286,   0.5490,    0.218750,  0.187500,
-      -0.000000, 0.555570,  0.831469,  -0.0000,   0.5528,    0.8333,
-      0.250000,  0.687500,  -0.180240, 0.382683,  0.906127,  -0.1804,
-      0.3805,    0.9070,    0.218750,  0.625000,  0.000000,  0.382683,
-      0.923879,  -0.0000,   0.3805,    0.9248,    0.250000,  0.625000,
-      -0.162212, -0.555570, 0.815493,  -0.1626,   -0.5528,   0.8173,
-      0.218750,  0.312500,  -0.353553, -0.382683, 0.853553,  -0.3539,
-      -0.3805,   0.8544,    0.187500,  0.375000,  -0.318190, -0.555570,
-      0.768177,  -0.3189,   -0.5528,   0.7699,    0.187500,  0.312500,
-      -0.108386, 0.831470,  0.544895,  -0.1092,   0.8286,    0.5490,
-      0.218750,  0.812500,  -0.270598, 0.707107,  0.653281,  -0.2718,
-      0.7041,    0.6561,    0.187500,  0.750000,  -0.137950, 0.707107,
-      0.693520,  -0.1385,   0.7041,    0.6965,    0.218750,  0.750000,
-      -0.162212, -0.555570, 0.815493,  -0.1626,   -0.5528,   0.8173,
-      0.218750,  0.312500,  -0.270598, -0.707107, 0.653281,  -0.2718,
-      -0.7041,   0.6561,    0.187500,  0.250000,  -0.137950, -0.707107,
-      0.693520,  -0.1385,   -0.7041,   0.6965,    0.218750,  0.250000,
-      -0.162212, 0.555570,  0.815493,  -0.1626,   0.5528,    0.8173,
-      0.218750,  0.687500,  -0.270598, 0.707107,  0.653281,  -0.2718,
-      0.7041,    0.6561,    0.187500,  0.750000,  -0.318190, 0.555570,
-      0.768177,  -0.3189,   0.5528,    0.7699,    0.187500,  0.687500,
-      -0.108386, -0.831470, 0.544895,  -0.1092,   -0.8286,   0.5490,
-      0.218750,  0.187500,  -0.270598, -0.707107, 0.653281,  -0.2718,
-      -0.7041,   0.6561,    0.187500,  0.250000,  -0.212608, -0.831470,
-      0.513280,  -0.2142,   -0.8286,   0.5172,    0.187500,  0.187500,
-      -0.162212, 0.555570,  0.815493,  -0.1626,   0.5528,    0.8173,
-      0.218750,  0.687500,  -0.353553, 0.382683,  0.853553,  -0.3539,
-      0.3805,    0.8544,    0.187500,  0.625000,  -0.180240, 0.382683,
-      0.906127,  -0.1804,   0.3805,    0.9070,    0.218750,  0.625000,
-      -0.108386, -0.831470, 0.544895,  -0.1092,   -0.8286,   0.5490,
-      0.218750,  0.187500,  -0.146447, -0.923880, 0.353553,  -0.1484,
-      -0.9217,   0.3584,    0.187500,  0.125000,  -0.074658, -0.923880,
-      0.375330,  -0.0757,   -0.9217,   0.3804,    0.218750,  0.125000,
-      -0.191342, 0.195090,  0.961939,  -0.1914,   0.1939,    0.9622,
-      0.218750,  0.562500,  -0.353553, 0.382683,  0.853553,  -0.3539,
-      0.3805,    0.8544,    0.187500,  0.625000,  -0.375330, 0.195090,
-      0.906127,  -0.3754,   0.1939,    0.9063,    0.187500,  0.562500,
-      -0.074658, -0.923880, 0.375330,  -0.0757,   -0.9217,   0.3804,
-      0.218750,  0.125000,  -0.074658, -0.980785, 0.180240,  -0.0769,
-      -0.9796,   0.1857,    0.187500,  0.062500,  -0.038060, -0.980785,
-      0.191342,  -0.0392,   -0.9796,   0.1971,    0.218750,  0.062500,
-      -0.195091, 0.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.218750,  0.500000,  -0.375330, 0.195090,  0.906127,  -0.3754,
-      0.1939,    0.9063,    0.187500,  0.562500,  -0.382683, 0.000000,
-      0.923879,  -0.3827,   -0.0000,   0.9239,    0.187500,  0.500000,
-      -0.038060, 0.980785,  0.191342,  -0.0392,   0.9796,    0.1971,
-      0.218750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.203125,  1.000000,  -0.074658, 0.980785,
-      0.180240,  -0.0769,   0.9796,    0.1857,    0.187500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.203125,  0.000000,  -0.038060, -0.980785, 0.191342,  -0.0392,
-      -0.9796,   0.1971,    0.218750,  0.062500,  -0.074658, -0.980785,
-      0.180240,  -0.0769,   -0.9796,   0.1857,    0.187500,  0.062500,
-      -0.195091, 0.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.218750,  0.500000,  -0.375330, -0.195090, 0.906127,  -0.3754,
-      -0.1939,   0.9063,    0.187500,  0.437500,  -0.191342, -0.195090,
-      0.961939,  -0.1914,   -0.1939,   0.9622,    0.218750,  0.437500,
-      -0.074658, 0.923880,  0.375330,  -0.0757,   0.9217,    0.3804,
-      0.218750,  0.875000,  -0.074658, 0.980785,  0.180240,  -0.0769,
-      0.9796,    0.1857,    0.187500,  0.937500,  -0.146447, 0.923880,
-      0.353553,  -0.1484,   0.9217,    0.3584,    0.187500,  0.875000,
-      -0.191342, -0.195090, 0.961939,  -0.1914,   -0.1939,   0.9622,
-      0.218750,  0.437500,  -0.353553, -0.382683, 0.853553,  -0.3539,
-      -0.3805,   0.8544,    0.187500,  0.375000,  -0.180240, -0.382683,
-      0.906127,  -0.1804,   -0.3805,   0.9070,    0.218750,  0.375000,
-      -0.074658, 0.923880,  0.375330,  -0.0757,   0.9217,    0.3804,
-      0.218750,  0.875000,  -0.212608, 0.831470,  0.513280,  -0.2142,
-      0.8286,    0.5172,    0.187500,  0.812500,  -0.108386, 0.831470,
-      0.544895,  -0.1092,   0.8286,    0.5490,    0.218750,  0.812500,
-      -0.074658, -0.980785, 0.180240,  -0.0769,   -0.9796,   0.1857,
-      0.187500,  0.062500,  -0.212608, -0.923880, 0.318190,  -0.2155,
-      -0.9217,   0.3225,    0.156250,  0.125000,  -0.108386, -0.980785,
-      0.162212,  -0.1117,   -0.9796,   0.1671,    0.156250,  0.062500,
-      -0.382683, 0.000000,  0.923879,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.544895, 0.195090,  0.815493,  -0.5450,
-      0.1939,    0.8157,    0.156250,  0.562500,  -0.555570, 0.000000,
-      0.831469,  -0.5556,   -0.0000,   0.8315,    0.156250,  0.500000,
-      -0.074658, 0.980785,  0.180240,  -0.0769,   0.9796,    0.1857,
-      0.187500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.171875,  1.000000,  -0.108386, 0.980785,
-      0.162212,  -0.1117,   0.9796,    0.1671,    0.156250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.171875,  0.000000,  -0.074658, -0.980785, 0.180240,  -0.0769,
-      -0.9796,   0.1857,    0.187500,  0.062500,  -0.108386, -0.980785,
-      0.162212,  -0.1117,   -0.9796,   0.1671,    0.156250,  0.062500,
-      -0.382683, 0.000000,  0.923879,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.544895, -0.195090, 0.815493,  -0.5450,
-      -0.1939,   0.8157,    0.156250,  0.437500,  -0.375330, -0.195090,
-      0.906127,  -0.3754,   -0.1939,   0.9063,    0.187500,  0.437500,
-      -0.146447, 0.923880,  0.353553,  -0.1484,   0.9217,    0.3584,
-      0.187500,  0.875000,  -0.108386, 0.980785,  0.162212,  -0.1117,
-      0.9796,    0.1671,    0.156250,  0.937500,  -0.212608, 0.923880,
-      0.318190,  -0.2155,   0.9217,    0.3225,    0.156250,  0.875000,
-      -0.375330, -0.195090, 0.906127,  -0.3754,   -0.1939,   0.9063,
-      0.187500,  0.437500,  -0.513280, -0.382683, 0.768178,  -0.5138,
-      -0.3805,   0.7689,    0.156250,  0.375000,  -0.353553, -0.382683,
-      0.853553,  -0.3539,   -0.3805,   0.8544,    0.187500,  0.375000,
-      -0.146447, 0.923880,  0.353553,  -0.1484,   0.9217,    0.3584,
-      0.187500,  0.875000,  -0.308658, 0.831470,  0.461939,  -0.3110,
-      0.8286,    0.4654,    0.156250,  0.812500,  -0.212608, 0.831470,
-      0.513280,  -0.2142,   0.8286,    0.5172,    0.187500,  0.812500,
-      -0.318190, -0.555570, 0.768177,  -0.3189,   -0.5528,   0.7699,
-      0.187500,  0.312500,  -0.513280, -0.382683, 0.768178,  -0.5138,
-      -0.3805,   0.7689,    0.156250,  0.375000,  -0.461940, -0.555570,
-      0.691341,  -0.4630,   -0.5528,   0.6929,    0.156250,  0.312500,
-      -0.212608, 0.831470,  0.513280,  -0.2142,   0.8286,    0.5172,
-      0.187500,  0.812500,  -0.392847, 0.707107,  0.587938,  -0.3945,
-      0.7041,    0.5905,    0.156250,  0.750000,  -0.270598, 0.707107,
-      0.653281,  -0.2718,   0.7041,    0.6561,    0.187500,  0.750000,
-      -0.318190, -0.555570, 0.768177,  -0.3189,   -0.5528,   0.7699,
-      0.187500,  0.312500,  -0.392847, -0.707107, 0.587938,  -0.3945,
-      -0.7041,   0.5905,    0.156250,  0.250000,  -0.270598, -0.707107,
-      0.653281,  -0.2718,   -0.7041,   0.6561,    0.187500,  0.250000,
-      -0.318190, 0.555570,  0.768177,  -0.3189,   0.5528,    0.7699,
-      0.187500,  0.687500,  -0.392847, 0.707107,  0.587938,  -0.3945,
-      0.7041,    0.5905,    0.156250,  0.750000,  -0.461940, 0.555570,
-      0.691341,  -0.4630,   0.5528,    0.6929,    0.156250,  0.687500,
-      -0.212608, -0.831470, 0.513280,  -0.2142,   -0.8286,   0.5172,
-      0.187500,  0.187500,  -0.392847, -0.707107, 0.587938,  -0.3945,
-      -0.7041,   0.5905,    0.156250,  0.250000,  -0.308658, -0.831470,
-      0.461939,  -0.3110,   -0.8286,   0.4654,    0.156250,  0.187500,
-      -0.318190, 0.555570,  0.768177,  -0.3189,   0.5528,    0.7699,
-      0.187500,  0.687500,  -0.513280, 0.382683,  0.768178,  -0.5138,
-      0.3805,    0.7689,    0.156250,  0.625000,  -0.353553, 0.382683,
-      0.853553,  -0.3539,   0.3805,    0.8544,    0.187500,  0.625000,
-      -0.212608, -0.831470, 0.513280,  -0.2142,   -0.8286,   0.5172,
-      0.187500,  0.187500,  -0.212608, -0.923880, 0.318190,  -0.2155,
-      -0.9217,   0.3225,    0.156250,  0.125000,  -0.146447, -0.923880,
-      0.353553,  -0.1484,   -0.9217,   0.3584,    0.187500,  0.125000,
-      -0.375330, 0.195090,  0.906127,  -0.3754,   0.1939,    0.9063,
-      0.187500,  0.562500,  -0.513280, 0.382683,  0.768178,  -0.5138,
-      0.3805,    0.7689,    0.156250,  0.625000,  -0.544895, 0.195090,
-      0.815493,  -0.5450,   0.1939,    0.8157,    0.156250,  0.562500,
-      -0.308658, 0.831470,  0.461939,  -0.3110,   0.8286,    0.4654,
-      0.156250,  0.812500,  -0.500000, 0.707107,  0.500000,  -0.5021,
-      0.7041,    0.5021,    0.125000,  0.750000,  -0.392847, 0.707107,
-      0.587938,  -0.3945,   0.7041,    0.5905,    0.156250,  0.750000,
-      -0.461940, -0.555570, 0.691341,  -0.4630,   -0.5528,   0.6929,
-      0.156250,  0.312500,  -0.500000, -0.707107, 0.500000,  -0.5021,
-      -0.7041,   0.5021,    0.125000,  0.250000,  -0.392847, -0.707107,
-      0.587938,  -0.3945,   -0.7041,   0.5905,    0.156250,  0.250000,
-      -0.461940, 0.555570,  0.691341,  -0.4630,   0.5528,    0.6929,
-      0.156250,  0.687500,  -0.500000, 0.707107,  0.500000,  -0.5021,
-      0.7041,    0.5021,    0.125000,  0.750000,  -0.587938, 0.555570,
-      0.587937,  -0.5893,   0.5528,    0.5893,    0.125000,  0.687500,
-      -0.308658, -0.831470, 0.461939,  -0.3110,   -0.8286,   0.4654,
-      0.156250,  0.187500,  -0.500000, -0.707107, 0.500000,  -0.5021,
-      -0.7041,   0.5021,    0.125000,  0.250000,  -0.392847, -0.831470,
-      0.392847,  -0.3958,   -0.8286,   0.3958,    0.125000,  0.187500,
-      -0.461940, 0.555570,  0.691341,  -0.4630,   0.5528,    0.6929,
-      0.156250,  0.687500,  -0.653281, 0.382683,  0.653281,  -0.6539,
-      0.3805,    0.6539,    0.125000,  0.625000,  -0.513280, 0.382683,
-      0.768178,  -0.5138,   0.3805,    0.7689,    0.156250,  0.625000,
-      -0.308658, -0.831470, 0.461939,  -0.3110,   -0.8286,   0.4654,
-      0.156250,  0.187500,  -0.270598, -0.923880, 0.270598,  -0.2743,
-      -0.9217,   0.2743,    0.125000,  0.125000,  -0.212608, -0.923880,
-      0.318190,  -0.2155,   -0.9217,   0.3225,    0.156250,  0.125000,
-      -0.544895, 0.195090,  0.815493,  -0.5450,   0.1939,    0.8157,
-      0.156250,  0.562500,  -0.653281, 0.382683,  0.653281,  -0.6539,
-      0.3805,    0.6539,    0.125000,  0.625000,  -0.693520, 0.195090,
-      0.693520,  -0.6937,   0.1939,    0.6937,    0.125000,  0.562500,
-      -0.108386, -0.980785, 0.162212,  -0.1117,   -0.9796,   0.1671,
-      0.156250,  0.062500,  -0.270598, -0.923880, 0.270598,  -0.2743,
-      -0.9217,   0.2743,    0.125000,  0.125000,  -0.137950, -0.980785,
-      0.137950,  -0.1421,   -0.9796,   0.1421,    0.125000,  0.062500,
-      -0.555570, 0.000000,  0.831469,  -0.5556,   -0.0000,   0.8315,
-      0.156250,  0.500000,  -0.693520, 0.195090,  0.693520,  -0.6937,
-      0.1939,    0.6937,    0.125000,  0.562500,  -0.707106, 0.000000,
-      0.707106,  -0.7071,   -0.0000,   0.7071,    0.125000,  0.500000,
-      -0.108386, 0.980785,  0.162212,  -0.1117,   0.9796,    0.1671,
-      0.156250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.140625,  1.000000,  -0.137950, 0.980785,
-      0.137950,  -0.1421,   0.9796,    0.1421,    0.125000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.140625,  0.000000,  -0.108386, -0.980785, 0.162212,  -0.1117,
-      -0.9796,   0.1671,    0.156250,  0.062500,  -0.137950, -0.980785,
-      0.137950,  -0.1421,   -0.9796,   0.1421,    0.125000,  0.062500,
-      -0.555570, 0.000000,  0.831469,  -0.5556,   -0.0000,   0.8315,
-      0.156250,  0.500000,  -0.693520, -0.195090, 0.693520,  -0.6937,
-      -0.1939,   0.6937,    0.125000,  0.437500,  -0.544895, -0.195090,
-      0.815493,  -0.5450,   -0.1939,   0.8157,    0.156250,  0.437500,
-      -0.108386, 0.980785,  0.162212,  -0.1117,   0.9796,    0.1671,
-      0.156250,  0.937500,  -0.270598, 0.923880,  0.270598,  -0.2743,
-      0.9217,    0.2743,    0.125000,  0.875000,  -0.212608, 0.923880,
-      0.318190,  -0.2155,   0.9217,    0.3225,    0.156250,  0.875000,
-      -0.544895, -0.195090, 0.815493,  -0.5450,   -0.1939,   0.8157,
-      0.156250,  0.437500,  -0.653281, -0.382683, 0.653281,  -0.6539,
-      -0.3805,   0.6539,    0.125000,  0.375000,  -0.513280, -0.382683,
-      0.768178,  -0.5138,   -0.3805,   0.7689,    0.156250,  0.375000,
-      -0.212608, 0.923880,  0.318190,  -0.2155,   0.9217,    0.3225,
-      0.156250,  0.875000,  -0.392847, 0.831470,  0.392847,  -0.3958,
-      0.8286,    0.3958,    0.125000,  0.812500,  -0.308658, 0.831470,
-      0.461939,  -0.3110,   0.8286,    0.4654,    0.156250,  0.812500,
-      -0.461940, -0.555570, 0.691341,  -0.4630,   -0.5528,   0.6929,
-      0.156250,  0.312500,  -0.653281, -0.382683, 0.653281,  -0.6539,
-      -0.3805,   0.6539,    0.125000,  0.375000,  -0.587938, -0.555570,
-      0.587937,  -0.5893,   -0.5528,   0.5893,    0.125000,  0.312500,
-      -0.707106, 0.000000,  0.707106,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.815493, 0.195090,  0.544895,  -0.8157,
-      0.1939,    0.5450,    0.093750,  0.562500,  -0.831469, 0.000000,
-      0.555569,  -0.8315,   -0.0000,   0.5556,    0.093750,  0.500000,
-      -0.137950, 0.980785,  0.137950,  -0.1421,   0.9796,    0.1421,
-      0.125000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.109375,  1.000000,  -0.162212, 0.980785,
-      0.108386,  -0.1671,   0.9796,    0.1117,    0.093750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.109375,  0.000000,  -0.137950, -0.980785, 0.137950,  -0.1421,
-      -0.9796,   0.1421,    0.125000,  0.062500,  -0.162212, -0.980785,
-      0.108386,  -0.1671,   -0.9796,   0.1117,    0.093750,  0.062500,
-      -0.707106, 0.000000,  0.707106,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.815493, -0.195090, 0.544895,  -0.8157,
-      -0.1939,   0.5450,    0.093750,  0.437500,  -0.693520, -0.195090,
-      0.693520,  -0.6937,   -0.1939,   0.6937,    0.125000,  0.437500,
-      -0.137950, 0.980785,  0.137950,  -0.1421,   0.9796,    0.1421,
-      0.125000,  0.937500,  -0.318190, 0.923880,  0.212607,  -0.3225,
-      0.9217,    0.2155,    0.093750,  0.875000,  -0.270598, 0.923880,
-      0.270598,  -0.2743,   0.9217,    0.2743,    0.125000,  0.875000,
-      -0.693520, -0.195090, 0.693520,  -0.6937,   -0.1939,   0.6937,
-      0.125000,  0.437500,  -0.768177, -0.382683, 0.513280,  -0.7689,
-      -0.3805,   0.5138,    0.093750,  0.375000,  -0.653281, -0.382683,
-      0.653281,  -0.6539,   -0.3805,   0.6539,    0.125000,  0.375000,
-      -0.270598, 0.923880,  0.270598,  -0.2743,   0.9217,    0.2743,
-      0.125000,  0.875000,  -0.461940, 0.831470,  0.308658,  -0.4654,
-      0.8286,    0.3110,    0.093750,  0.812500,  -0.392847, 0.831470,
-      0.392847,  -0.3958,   0.8286,    0.3958,    0.125000,  0.812500,
-      -0.587938, -0.555570, 0.587937,  -0.5893,   -0.5528,   0.5893,
-      0.125000,  0.312500,  -0.768177, -0.382683, 0.513280,  -0.7689,
-      -0.3805,   0.5138,    0.093750,  0.375000,  -0.691341, -0.555570,
-      0.461939,  -0.6929,   -0.5528,   0.4630,    0.093750,  0.312500,
-      -0.392847, 0.831470,  0.392847,  -0.3958,   0.8286,    0.3958,
-      0.125000,  0.812500,  -0.587938, 0.707107,  0.392847,  -0.5905,
-      0.7041,    0.3945,    0.093750,  0.750000,  -0.500000, 0.707107,
-      0.500000,  -0.5021,   0.7041,    0.5021,    0.125000,  0.750000,
-      -0.587938, -0.555570, 0.587937,  -0.5893,   -0.5528,   0.5893,
-      0.125000,  0.312500,  -0.587938, -0.707107, 0.392847,  -0.5905,
-      -0.7041,   0.3945,    0.093750,  0.250000,  -0.500000, -0.707107,
-      0.500000,  -0.5021,   -0.7041,   0.5021,    0.125000,  0.250000,
-      -0.587938, 0.555570,  0.587937,  -0.5893,   0.5528,    0.5893,
-      0.125000,  0.687500,  -0.587938, 0.707107,  0.392847,  -0.5905,
-      0.7041,    0.3945,    0.093750,  0.750000,  -0.691341, 0.555570,
-      0.461939,  -0.6929,   0.5528,    0.4630,    0.093750,  0.687500,
-      -0.392847, -0.831470, 0.392847,  -0.3958,   -0.8286,   0.3958,
-      0.125000,  0.187500,  -0.587938, -0.707107, 0.392847,  -0.5905,
-      -0.7041,   0.3945,    0.093750,  0.250000,  -0.461940, -0.831470,
-      0.308658,  -0.4654,   -0.8286,   0.3110,    0.093750,  0.187500,
-      -0.587938, 0.555570,  0.587937,  -0.5893,   0.5528,    0.5893,
-      0.125000,  0.687500,  -0.768177, 0.382683,  0.513280,  -0.7689,
-      0.3805,    0.5138,    0.093750,  0.625000,  -0.653281, 0.382683,
-      0.653281,  -0.6539,   0.3805,    0.6539,    0.125000,  0.625000,
-      -0.392847, -0.831470, 0.392847,  -0.3958,   -0.8286,   0.3958,
-      0.125000,  0.187500,  -0.318190, -0.923880, 0.212607,  -0.3225,
-      -0.9217,   0.2155,    0.093750,  0.125000,  -0.270598, -0.923880,
-      0.270598,  -0.2743,   -0.9217,   0.2743,    0.125000,  0.125000,
-      -0.693520, 0.195090,  0.693520,  -0.6937,   0.1939,    0.6937,
-      0.125000,  0.562500,  -0.768177, 0.382683,  0.513280,  -0.7689,
-      0.3805,    0.5138,    0.093750,  0.625000,  -0.815493, 0.195090,
-      0.544895,  -0.8157,   0.1939,    0.5450,    0.093750,  0.562500,
-      -0.270598, -0.923880, 0.270598,  -0.2743,   -0.9217,   0.2743,
-      0.125000,  0.125000,  -0.162212, -0.980785, 0.108386,  -0.1671,
-      -0.9796,   0.1117,    0.093750,  0.062500,  -0.137950, -0.980785,
-      0.137950,  -0.1421,   -0.9796,   0.1421,    0.125000,  0.062500,
-      -0.691341, -0.555570, 0.461939,  -0.6929,   -0.5528,   0.4630,
-      0.093750,  0.312500,  -0.653281, -0.707107, 0.270598,  -0.6561,
-      -0.7041,   0.2718,    0.062500,  0.250000,  -0.587938, -0.707107,
-      0.392847,  -0.5905,   -0.7041,   0.3945,    0.093750,  0.250000,
-      -0.587938, 0.707107,  0.392847,  -0.5905,   0.7041,    0.3945,
-      0.093750,  0.750000,  -0.768177, 0.555570,  0.318189,  -0.7699,
-      0.5528,    0.3189,    0.062500,  0.687500,  -0.691341, 0.555570,
-      0.461939,  -0.6929,   0.5528,    0.4630,    0.093750,  0.687500,
-      -0.461940, -0.831470, 0.308658,  -0.4654,   -0.8286,   0.3110,
-      0.093750,  0.187500,  -0.653281, -0.707107, 0.270598,  -0.6561,
-      -0.7041,   0.2718,    0.062500,  0.250000,  -0.513280, -0.831470,
-      0.212607,  -0.5172,   -0.8286,   0.2142,    0.062500,  0.187500,
-      -0.691341, 0.555570,  0.461939,  -0.6929,   0.5528,    0.4630,
-      0.093750,  0.687500,  -0.853553, 0.382683,  0.353553,  -0.8544,
-      0.3805,    0.3539,    0.062500,  0.625000,  -0.768177, 0.382683,
-      0.513280,  -0.7689,   0.3805,    0.5138,    0.093750,  0.625000,
-      -0.461940, -0.831470, 0.308658,  -0.4654,   -0.8286,   0.3110,
-      0.093750,  0.187500,  -0.353553, -0.923880, 0.146447,  -0.3584,
-      -0.9217,   0.1484,    0.062500,  0.125000,  -0.318190, -0.923880,
-      0.212607,  -0.3225,   -0.9217,   0.2155,    0.093750,  0.125000,
-      -0.815493, 0.195090,  0.544895,  -0.8157,   0.1939,    0.5450,
-      0.093750,  0.562500,  -0.853553, 0.382683,  0.353553,  -0.8544,
-      0.3805,    0.3539,    0.062500,  0.625000,  -0.906127, 0.195090,
-      0.375330,  -0.9063,   0.1939,    0.3754,    0.062500,  0.562500,
-      -0.318190, -0.923880, 0.212607,  -0.3225,   -0.9217,   0.2155,
-      0.093750,  0.125000,  -0.180240, -0.980785, 0.074658,  -0.1857,
-      -0.9796,   0.0769,    0.062500,  0.062500,  -0.162212, -0.980785,
-      0.108386,  -0.1671,   -0.9796,   0.1117,    0.093750,  0.062500,
-      -0.831469, 0.000000,  0.555569,  -0.8315,   -0.0000,   0.5556,
-      0.093750,  0.500000,  -0.906127, 0.195090,  0.375330,  -0.9063,
-      0.1939,    0.3754,    0.062500,  0.562500,  -0.923879, 0.000000,
-      0.382683,  -0.9239,   -0.0000,   0.3827,    0.062500,  0.500000,
-      -0.162212, 0.980785,  0.108386,  -0.1671,   0.9796,    0.1117,
-      0.093750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.078125,  1.000000,  -0.180240, 0.980785,
-      0.074658,  -0.1857,   0.9796,    0.0769,    0.062500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.078125,  0.000000,  -0.162212, -0.980785, 0.108386,  -0.1671,
-      -0.9796,   0.1117,    0.093750,  0.062500,  -0.180240, -0.980785,
-      0.074658,  -0.1857,   -0.9796,   0.0769,    0.062500,  0.062500,
-      -0.831469, 0.000000,  0.555569,  -0.8315,   -0.0000,   0.5556,
-      0.093750,  0.500000,  -0.906127, -0.195090, 0.375330,  -0.9063,
-      -0.1939,   0.3754,    0.062500,  0.437500,  -0.815493, -0.195090,
-      0.544895,  -0.8157,   -0.1939,   0.5450,    0.093750,  0.437500,
-      -0.162212, 0.980785,  0.108386,  -0.1671,   0.9796,    0.1117,
-      0.093750,  0.937500,  -0.353553, 0.923880,  0.146447,  -0.3584,
-      0.9217,    0.1484,    0.062500,  0.875000,  -0.318190, 0.923880,
-      0.212607,  -0.3225,   0.9217,    0.2155,    0.093750,  0.875000,
-      -0.815493, -0.195090, 0.544895,  -0.8157,   -0.1939,   0.5450,
-      0.093750,  0.437500,  -0.853553, -0.382683, 0.353553,  -0.8544,
-      -0.3805,   0.3539,    0.062500,  0.375000,  -0.768177, -0.382683,
-      0.513280,  -0.7689,   -0.3805,   0.5138,    0.093750,  0.375000,
-      -0.318190, 0.923880,  0.212607,  -0.3225,   0.9217,    0.2155,
-      0.093750,  0.875000,  -0.513280, 0.831470,  0.212607,  -0.5172,
-      0.8286,    0.2142,    0.062500,  0.812500,  -0.461940, 0.831470,
-      0.308658,  -0.4654,   0.8286,    0.3110,    0.093750,  0.812500,
-      -0.691341, -0.555570, 0.461939,  -0.6929,   -0.5528,   0.4630,
-      0.093750,  0.312500,  -0.853553, -0.382683, 0.353553,  -0.8544,
-      -0.3805,   0.3539,    0.062500,  0.375000,  -0.768177, -0.555570,
-      0.318189,  -0.7699,   -0.5528,   0.3189,    0.062500,  0.312500,
-      -0.461940, 0.831470,  0.308658,  -0.4654,   0.8286,    0.3110,
-      0.093750,  0.812500,  -0.653281, 0.707107,  0.270598,  -0.6561,
-      0.7041,    0.2718,    0.062500,  0.750000,  -0.587938, 0.707107,
-      0.392847,  -0.5905,   0.7041,    0.3945,    0.093750,  0.750000,
-      -0.180240, 0.980785,  0.074658,  -0.1857,   0.9796,    0.0769,
-      0.062500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.046875,  1.000000,  -0.191342, 0.980785,
-      0.038060,  -0.1971,   0.9796,    0.0392,    0.031250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.046875,  0.000000,  -0.180240, -0.980785, 0.074658,  -0.1857,
-      -0.9796,   0.0769,    0.062500,  0.062500,  -0.191342, -0.980785,
-      0.038060,  -0.1971,   -0.9796,   0.0392,    0.031250,  0.062500,
-      -0.923879, 0.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -0.961939, -0.195090, 0.191341,  -0.9622,
-      -0.1939,   0.1914,    0.031250,  0.437500,  -0.906127, -0.195090,
-      0.375330,  -0.9063,   -0.1939,   0.3754,    0.062500,  0.437500,
-      -0.180240, 0.980785,  0.074658,  -0.1857,   0.9796,    0.0769,
-      0.062500,  0.937500,  -0.375330, 0.923880,  0.074658,  -0.3804,
-      0.9217,    0.0757,    0.031250,  0.875000,  -0.353553, 0.923880,
-      0.146447,  -0.3584,   0.9217,    0.1484,    0.062500,  0.875000,
-      -0.906127, -0.195090, 0.375330,  -0.9063,   -0.1939,   0.3754,
-      0.062500,  0.437500,  -0.906127, -0.382683, 0.180240,  -0.9070,
-      -0.3805,   0.1804,    0.031250,  0.375000,  -0.853553, -0.382683,
-      0.353553,  -0.8544,   -0.3805,   0.3539,    0.062500,  0.375000,
-      -0.353553, 0.923880,  0.146447,  -0.3584,   0.9217,    0.1484,
-      0.062500,  0.875000,  -0.544895, 0.831470,  0.108386,  -0.5490,
-      0.8286,    0.1092,    0.031250,  0.812500,  -0.513280, 0.831470,
-      0.212607,  -0.5172,   0.8286,    0.2142,    0.062500,  0.812500,
-      -0.768177, -0.555570, 0.318189,  -0.7699,   -0.5528,   0.3189,
-      0.062500,  0.312500,  -0.906127, -0.382683, 0.180240,  -0.9070,
-      -0.3805,   0.1804,    0.031250,  0.375000,  -0.815493, -0.555570,
-      0.162211,  -0.8173,   -0.5528,   0.1626,    0.031250,  0.312500,
-      -0.513280, 0.831470,  0.212607,  -0.5172,   0.8286,    0.2142,
-      0.062500,  0.812500,  -0.693520, 0.707107,  0.137950,  -0.6965,
-      0.7041,    0.1385,    0.031250,  0.750000,  -0.653281, 0.707107,
-      0.270598,  -0.6561,   0.7041,    0.2718,    0.062500,  0.750000,
-      -0.768177, -0.555570, 0.318189,  -0.7699,   -0.5528,   0.3189,
-      0.062500,  0.312500,  -0.693520, -0.707107, 0.137950,  -0.6965,
-      -0.7041,   0.1385,    0.031250,  0.250000,  -0.653281, -0.707107,
-      0.270598,  -0.6561,   -0.7041,   0.2718,    0.062500,  0.250000,
-      -0.768177, 0.555570,  0.318189,  -0.7699,   0.5528,    0.3189,
-      0.062500,  0.687500,  -0.693520, 0.707107,  0.137950,  -0.6965,
-      0.7041,    0.1385,    0.031250,  0.750000,  -0.815493, 0.555570,
-      0.162211,  -0.8173,   0.5528,    0.1626,    0.031250,  0.687500,
-      -0.513280, -0.831470, 0.212607,  -0.5172,   -0.8286,   0.2142,
-      0.062500,  0.187500,  -0.693520, -0.707107, 0.137950,  -0.6965,
-      -0.7041,   0.1385,    0.031250,  0.250000,  -0.544895, -0.831470,
-      0.108386,  -0.5490,   -0.8286,   0.1092,    0.031250,  0.187500,
-      -0.768177, 0.555570,  0.318189,  -0.7699,   0.5528,    0.3189,
-      0.062500,  0.687500,  -0.906127, 0.382683,  0.180240,  -0.9070,
-      0.3805,    0.1804,    0.031250,  0.625000,  -0.853553, 0.382683,
-      0.353553,  -0.8544,   0.3805,    0.3539,    0.062500,  0.625000,
-      -0.513280, -0.831470, 0.212607,  -0.5172,   -0.8286,   0.2142,
-      0.062500,  0.187500,  -0.375330, -0.923880, 0.074658,  -0.3804,
-      -0.9217,   0.0757,    0.031250,  0.125000,  -0.353553, -0.923880,
-      0.146447,  -0.3584,   -0.9217,   0.1484,    0.062500,  0.125000,
-      -0.906127, 0.195090,  0.375330,  -0.9063,   0.1939,    0.3754,
-      0.062500,  0.562500,  -0.906127, 0.382683,  0.180240,  -0.9070,
-      0.3805,    0.1804,    0.031250,  0.625000,  -0.961939, 0.195090,
-      0.191341,  -0.9622,   0.1939,    0.1914,    0.031250,  0.562500,
-      -0.353553, -0.923880, 0.146447,  -0.3584,   -0.9217,   0.1484,
-      0.062500,  0.125000,  -0.191342, -0.980785, 0.038060,  -0.1971,
-      -0.9796,   0.0392,    0.031250,  0.062500,  -0.180240, -0.980785,
-      0.074658,  -0.1857,   -0.9796,   0.0769,    0.062500,  0.062500,
-      -0.923879, 0.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -0.961939, 0.195090,  0.191341,  -0.9622,
-      0.1939,    0.1914,    0.031250,  0.562500,  -0.980784, 0.000000,
-      0.195090,  -0.9808,   -0.0000,   0.1951,    0.031250,  0.500000,
-      -0.815493, 0.555570,  0.162211,  -0.8173,   0.5528,    0.1626,
-      0.031250,  0.687500,  -0.707107, 0.707107,  -0.000000, -0.7101,
-      0.7041,    -0.0000,   0.000000,  0.750000,  -0.831469, 0.555570,
-      -0.000000, -0.8333,   0.5528,    -0.0000,   0.000000,  0.687500,
-      -0.544895, -0.831470, 0.108386,  -0.5490,   -0.8286,   0.1092,
-      0.031250,  0.187500,  -0.707107, -0.707107, -0.000000, -0.7101,
-      -0.7041,   -0.0000,   0.000000,  0.250000,  -0.555570, -0.831470,
-      -0.000000, -0.5598,   -0.8286,   -0.0000,   0.000000,  0.187500,
-      -0.815493, 0.555570,  0.162211,  -0.8173,   0.5528,    0.1626,
-      0.031250,  0.687500,  -0.923879, 0.382683,  -0.000000, -0.9248,
-      0.3805,    -0.0000,   0.000000,  0.625000,  -0.906127, 0.382683,
-      0.180240,  -0.9070,   0.3805,    0.1804,    0.031250,  0.625000,
-      -0.544895, -0.831470, 0.108386,  -0.5490,   -0.8286,   0.1092,
-      0.031250,  0.187500,  -0.382683, -0.923880, -0.000000, -0.3879,
-      -0.9217,   -0.0000,   0.000000,  0.125000,  -0.375330, -0.923880,
-      0.074658,  -0.3804,   -0.9217,   0.0757,    0.031250,  0.125000,
-      -0.961939, 0.195090,  0.191341,  -0.9622,   0.1939,    0.1914,
-      0.031250,  0.562500,  -0.923879, 0.382683,  -0.000000, -0.9248,
-      0.3805,    -0.0000,   0.000000,  0.625000,  -0.980785, 0.195090,
-      -0.000000, -0.9810,   0.1939,    -0.0000,   0.000000,  0.562500,
-      -0.375330, -0.923880, 0.074658,  -0.3804,   -0.9217,   0.0757,
-      0.031250,  0.125000,  -0.195090, -0.980785, -0.000000, -0.2010,
-      -0.9796,   -0.0000,   0.000000,  0.062500,  -0.191342, -0.980785,
-      0.038060,  -0.1971,   -0.9796,   0.0392,    0.031250,  0.062500,
-      -0.980784, 0.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.031250,  0.500000,  -0.980785, 0.195090,  -0.000000, -0.9810,
-      0.1939,    -0.0000,   0.000000,  0.562500,  -0.999999, 0.000000,
-      -0.000000, -1.0000,   -0.0000,   -0.0000,   0.000000,  0.500000,
-      -0.191342, 0.980785,  0.038060,  -0.1971,   0.9796,    0.0392,
-      0.031250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.015625,  1.000000,  -0.195090, 0.980785,
-      -0.000000, -0.2010,   0.9796,    -0.0000,   0.000000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.015625,  0.000000,  -0.191342, -0.980785, 0.038060,  -0.1971,
-      -0.9796,   0.0392,    0.031250,  0.062500,  -0.195090, -0.980785,
-      -0.000000, -0.2010,   -0.9796,   -0.0000,   0.000000,  0.062500,
-      -0.980784, 0.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.031250,  0.500000,  -0.980785, -0.195090, -0.000000, -0.9810,
-      -0.1939,   -0.0000,   0.000000,  0.437500,  -0.961939, -0.195090,
-      0.191341,  -0.9622,   -0.1939,   0.1914,    0.031250,  0.437500,
-      -0.191342, 0.980785,  0.038060,  -0.1971,   0.9796,    0.0392,
-      0.031250,  0.937500,  -0.382683, 0.923880,  -0.000000, -0.3879,
-      0.9217,    -0.0000,   0.000000,  0.875000,  -0.375330, 0.923880,
-      0.074658,  -0.3804,   0.9217,    0.0757,    0.031250,  0.875000,
-      -0.961939, -0.195090, 0.191341,  -0.9622,   -0.1939,   0.1914,
-      0.031250,  0.437500,  -0.923879, -0.382683, -0.000000, -0.9248,
-      -0.3805,   -0.0000,   0.000000,  0.375000,  -0.906127, -0.382683,
-      0.180240,  -0.9070,   -0.3805,   0.1804,    0.031250,  0.375000,
-      -0.544895, 0.831470,  0.108386,  -0.5490,   0.8286,    0.1092,
-      0.031250,  0.812500,  -0.382683, 0.923880,  -0.000000, -0.3879,
-      0.9217,    -0.0000,   0.000000,  0.875000,  -0.555570, 0.831470,
-      -0.000000, -0.5598,   0.8286,    -0.0000,   0.000000,  0.812500,
-      -0.815493, -0.555570, 0.162211,  -0.8173,   -0.5528,   0.1626,
-      0.031250,  0.312500,  -0.923879, -0.382683, -0.000000, -0.9248,
-      -0.3805,   -0.0000,   0.000000,  0.375000,  -0.831469, -0.555570,
-      -0.000000, -0.8333,   -0.5528,   -0.0000,   0.000000,  0.312500,
-      -0.544895, 0.831470,  0.108386,  -0.5490,   0.8286,    0.1092,
-      0.031250,  0.812500,  -0.707107, 0.707107,  -0.000000, -0.7101,
-      0.7041,    -0.0000,   0.000000,  0.750000,  -0.693520, 0.707107,
-      0.137950,  -0.6965,   0.7041,    0.1385,    0.031250,  0.750000,
-      -0.815493, -0.555570, 0.162211,  -0.8173,   -0.5528,   0.1626,
-      0.031250,  0.312500,  -0.707107, -0.707107, -0.000000, -0.7101,
-      -0.7041,   -0.0000,   0.000000,  0.250000,  -0.693520, -0.707107,
-      0.137950,  -0.6965,   -0.7041,   0.1385,    0.031250,  0.250000,
-      -0.999999, 0.000000,  -0.000000, -1.0000,   -0.0000,   -0.0000,
-      1.000000,  0.500000,  -0.961939, -0.195090, -0.191342, -0.9622,
-      -0.1939,   -0.1914,   0.968750,  0.437500,  -0.980785, -0.195090,
-      -0.000000, -0.9810,   -0.1939,   -0.0000,   1.000000,  0.437500,
-      -0.195090, 0.980785,  -0.000000, -0.2010,   0.9796,    -0.0000,
-      1.000000,  0.937500,  -0.375330, 0.923880,  -0.074658, -0.3804,
-      0.9217,    -0.0757,   0.968750,  0.875000,  -0.382683, 0.923880,
-      -0.000000, -0.3879,   0.9217,    -0.0000,   1.000000,  0.875000,
-      -0.980785, -0.195090, -0.000000, -0.9810,   -0.1939,   -0.0000,
-      1.000000,  0.437500,  -0.906127, -0.382683, -0.180240, -0.9070,
-      -0.3805,   -0.1804,   0.968750,  0.375000,  -0.923879, -0.382683,
-      -0.000000, -0.9248,   -0.3805,   -0.0000,   1.000000,  0.375000,
-      -0.555570, 0.831470,  -0.000000, -0.5598,   0.8286,    -0.0000,
-      1.000000,  0.812500,  -0.375330, 0.923880,  -0.074658, -0.3804,
-      0.9217,    -0.0757,   0.968750,  0.875000,  -0.544895, 0.831470,
-      -0.108386, -0.5490,   0.8286,    -0.1092,   0.968750,  0.812500,
-      -0.831469, -0.555570, -0.000000, -0.8333,   -0.5528,   -0.0000,
-      1.000000,  0.312500,  -0.906127, -0.382683, -0.180240, -0.9070,
-      -0.3805,   -0.1804,   0.968750,  0.375000,  -0.815493, -0.555570,
-      -0.162212, -0.8173,   -0.5528,   -0.1626,   0.968750,  0.312500,
-      -0.555570, 0.831470,  -0.000000, -0.5598,   0.8286,    -0.0000,
-      1.000000,  0.812500,  -0.693520, 0.707107,  -0.137950, -0.6965,
-      0.7041,    -0.1385,   0.968750,  0.750000,  -0.707107, 0.707107,
-      -0.000000, -0.7101,   0.7041,    -0.0000,   1.000000,  0.750000,
-      -0.831469, -0.555570, -0.000000, -0.8333,   -0.5528,   -0.0000,
-      1.000000,  0.312500,  -0.693520, -0.707107, -0.137950, -0.6965,
-      -0.7041,   -0.1385,   0.968750,  0.250000,  -0.707107, -0.707107,
-      -0.000000, -0.7101,   -0.7041,   -0.0000,   1.000000,  0.250000,
-      -0.831469, 0.555570,  -0.000000, -0.8333,   0.5528,    -0.0000,
-      1.000000,  0.687500,  -0.693520, 0.707107,  -0.137950, -0.6965,
-      0.7041,    -0.1385,   0.968750,  0.750000,  -0.815493, 0.555570,
-      -0.162212, -0.8173,   0.5528,    -0.1626,   0.968750,  0.687500,
-      -0.555570, -0.831470, -0.000000, -0.5598,   -0.8286,   -0.0000,
-      1.000000,  0.187500,  -0.693520, -0.707107, -0.137950, -0.6965,
-      -0.7041,   -0.1385,   0.968750,  0.250000,  -0.544895, -0.831470,
-      -0.108386, -0.5490,   -0.8286,   -0.1092,   0.968750,  0.187500,
-      -0.831469, 0.555570,  -0.000000, -0.8333,   0.5528,    -0.0000,
-      1.000000,  0.687500,  -0.906127, 0.382683,  -0.180240, -0.9070,
-      0.3805,    -0.1804,   0.968750,  0.625000,  -0.923879, 0.382683,
-      -0.000000, -0.9248,   0.3805,    -0.0000,   1.000000,  0.625000,
-      -0.555570, -0.831470, -0.000000, -0.5598,   -0.8286,   -0.0000,
-      1.000000,  0.187500,  -0.375330, -0.923880, -0.074658, -0.3804,
-      -0.9217,   -0.0757,   0.968750,  0.125000,  -0.382683, -0.923880,
-      -0.000000, -0.3879,   -0.9217,   -0.0000,   1.000000,  0.125000,
-      -0.980785, 0.195090,  -0.000000, -0.9810,   0.1939,    -0.0000,
-      1.000000,  0.562500,  -0.906127, 0.382683,  -0.180240, -0.9070,
-      0.3805,    -0.1804,   0.968750,  0.625000,  -0.961939, 0.195090,
-      -0.191342, -0.9622,   0.1939,    -0.1914,   0.968750,  0.562500,
-      -0.382683, -0.923880, -0.000000, -0.3879,   -0.9217,   -0.0000,
-      1.000000,  0.125000,  -0.191342, -0.980785, -0.038060, -0.1971,
-      -0.9796,   -0.0392,   0.968750,  0.062500,  -0.195090, -0.980785,
-      -0.000000, -0.2010,   -0.9796,   -0.0000,   1.000000,  0.062500,
-      -0.999999, 0.000000,  -0.000000, -1.0000,   -0.0000,   -0.0000,
-      1.000000,  0.500000,  -0.961939, 0.195090,  -0.191342, -0.9622,
-      0.1939,    -0.1914,   0.968750,  0.562500,  -0.980784, 0.000000,
-      -0.195091, -0.9808,   -0.0000,   -0.1951,   0.968750,  0.500000,
-      -0.195090, 0.980785,  -0.000000, -0.2010,   0.9796,    -0.0000,
-      1.000000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.984375,  1.000000,  -0.191342, 0.980785,
-      -0.038060, -0.1971,   0.9796,    -0.0392,   0.968750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.984375,  0.000000,  -0.195090, -0.980785, -0.000000, -0.2010,
-      -0.9796,   -0.0000,   1.000000,  0.062500,  -0.191342, -0.980785,
-      -0.038060, -0.1971,   -0.9796,   -0.0392,   0.968750,  0.062500,
-      -0.544895, -0.831470, -0.108386, -0.5490,   -0.8286,   -0.1092,
-      0.968750,  0.187500,  -0.653281, -0.707107, -0.270598, -0.6561,
-      -0.7041,   -0.2718,   0.937500,  0.250000,  -0.513279, -0.831470,
-      -0.212607, -0.5172,   -0.8286,   -0.2142,   0.937500,  0.187500,
-      -0.815493, 0.555570,  -0.162212, -0.8173,   0.5528,    -0.1626,
-      0.968750,  0.687500,  -0.853553, 0.382683,  -0.353553, -0.8544,
-      0.3805,    -0.3539,   0.937500,  0.625000,  -0.906127, 0.382683,
-      -0.180240, -0.9070,   0.3805,    -0.1804,   0.968750,  0.625000,
-      -0.544895, -0.831470, -0.108386, -0.5490,   -0.8286,   -0.1092,
-      0.968750,  0.187500,  -0.353553, -0.923880, -0.146447, -0.3584,
-      -0.9217,   -0.1484,   0.937500,  0.125000,  -0.375330, -0.923880,
-      -0.074658, -0.3804,   -0.9217,   -0.0757,   0.968750,  0.125000,
-      -0.961939, 0.195090,  -0.191342, -0.9622,   0.1939,    -0.1914,
-      0.968750,  0.562500,  -0.853553, 0.382683,  -0.353553, -0.8544,
-      0.3805,    -0.3539,   0.937500,  0.625000,  -0.906127, 0.195090,
-      -0.375330, -0.9063,   0.1939,    -0.3754,   0.937500,  0.562500,
-      -0.375330, -0.923880, -0.074658, -0.3804,   -0.9217,   -0.0757,
-      0.968750,  0.125000,  -0.180240, -0.980785, -0.074658, -0.1857,
-      -0.9796,   -0.0769,   0.937500,  0.062500,  -0.191342, -0.980785,
-      -0.038060, -0.1971,   -0.9796,   -0.0392,   0.968750,  0.062500,
-      -0.980784, 0.000000,  -0.195091, -0.9808,   -0.0000,   -0.1951,
-      0.968750,  0.500000,  -0.906127, 0.195090,  -0.375330, -0.9063,
-      0.1939,    -0.3754,   0.937500,  0.562500,  -0.923878, 0.000000,
-      -0.382683, -0.9239,   -0.0000,   -0.3827,   0.937500,  0.500000,
-      -0.191342, 0.980785,  -0.038060, -0.1971,   0.9796,    -0.0392,
-      0.968750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.953125,  1.000000,  -0.180240, 0.980785,
-      -0.074658, -0.1857,   0.9796,    -0.0769,   0.937500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.953125,  0.000000,  -0.191342, -0.980785, -0.038060, -0.1971,
-      -0.9796,   -0.0392,   0.968750,  0.062500,  -0.180240, -0.980785,
-      -0.074658, -0.1857,   -0.9796,   -0.0769,   0.937500,  0.062500,
-      -0.980784, 0.000000,  -0.195091, -0.9808,   -0.0000,   -0.1951,
-      0.968750,  0.500000,  -0.906127, -0.195090, -0.375330, -0.9063,
-      -0.1939,   -0.3754,   0.937500,  0.437500,  -0.961939, -0.195090,
-      -0.191342, -0.9622,   -0.1939,   -0.1914,   0.968750,  0.437500,
-      -0.191342, 0.980785,  -0.038060, -0.1971,   0.9796,    -0.0392,
-      0.968750,  0.937500,  -0.353553, 0.923880,  -0.146447, -0.3584,
-      0.9217,    -0.1484,   0.937500,  0.875000,  -0.375330, 0.923880,
-      -0.074658, -0.3804,   0.9217,    -0.0757,   0.968750,  0.875000,
-      -0.961939, -0.195090, -0.191342, -0.9622,   -0.1939,   -0.1914,
-      0.968750,  0.437500,  -0.853553, -0.382683, -0.353553, -0.8544,
-      -0.3805,   -0.3539,   0.937500,  0.375000,  -0.906127, -0.382683,
-      -0.180240, -0.9070,   -0.3805,   -0.1804,   0.968750,  0.375000,
-      -0.544895, 0.831470,  -0.108386, -0.5490,   0.8286,    -0.1092,
-      0.968750,  0.812500,  -0.353553, 0.923880,  -0.146447, -0.3584,
-      0.9217,    -0.1484,   0.937500,  0.875000,  -0.513279, 0.831470,
-      -0.212607, -0.5172,   0.8286,    -0.2142,   0.937500,  0.812500,
-      -0.815493, -0.555570, -0.162212, -0.8173,   -0.5528,   -0.1626,
-      0.968750,  0.312500,  -0.853553, -0.382683, -0.353553, -0.8544,
-      -0.3805,   -0.3539,   0.937500,  0.375000,  -0.768177, -0.555570,
-      -0.318190, -0.7699,   -0.5528,   -0.3189,   0.937500,  0.312500,
-      -0.544895, 0.831470,  -0.108386, -0.5490,   0.8286,    -0.1092,
-      0.968750,  0.812500,  -0.653281, 0.707107,  -0.270598, -0.6561,
-      0.7041,    -0.2718,   0.937500,  0.750000,  -0.693520, 0.707107,
-      -0.137950, -0.6965,   0.7041,    -0.1385,   0.968750,  0.750000,
-      -0.815493, -0.555570, -0.162212, -0.8173,   -0.5528,   -0.1626,
-      0.968750,  0.312500,  -0.653281, -0.707107, -0.270598, -0.6561,
-      -0.7041,   -0.2718,   0.937500,  0.250000,  -0.693520, -0.707107,
-      -0.137950, -0.6965,   -0.7041,   -0.1385,   0.968750,  0.250000,
-      -0.815493, 0.555570,  -0.162212, -0.8173,   0.5528,    -0.1626,
-      0.968750,  0.687500,  -0.653281, 0.707107,  -0.270598, -0.6561,
-      0.7041,    -0.2718,   0.937500,  0.750000,  -0.768177, 0.555570,
-      -0.318190, -0.7699,   0.5528,    -0.3189,   0.937500,  0.687500,
-      -0.906127, -0.195090, -0.375330, -0.9063,   -0.1939,   -0.3754,
-      0.937500,  0.437500,  -0.768177, -0.382683, -0.513280, -0.7689,
-      -0.3805,   -0.5138,   0.906250,  0.375000,  -0.853553, -0.382683,
-      -0.353553, -0.8544,   -0.3805,   -0.3539,   0.937500,  0.375000,
-      -0.353553, 0.923880,  -0.146447, -0.3584,   0.9217,    -0.1484,
-      0.937500,  0.875000,  -0.461939, 0.831470,  -0.308658, -0.4654,
-      0.8286,    -0.3110,   0.906250,  0.812500,  -0.513279, 0.831470,
-      -0.212607, -0.5172,   0.8286,    -0.2142,   0.937500,  0.812500,
-      -0.768177, -0.555570, -0.318190, -0.7699,   -0.5528,   -0.3189,
-      0.937500,  0.312500,  -0.768177, -0.382683, -0.513280, -0.7689,
-      -0.3805,   -0.5138,   0.906250,  0.375000,  -0.691341, -0.555570,
-      -0.461940, -0.6929,   -0.5528,   -0.4630,   0.906250,  0.312500,
-      -0.513279, 0.831470,  -0.212607, -0.5172,   0.8286,    -0.2142,
-      0.937500,  0.812500,  -0.587938, 0.707107,  -0.392847, -0.5905,
-      0.7041,    -0.3945,   0.906250,  0.750000,  -0.653281, 0.707107,
-      -0.270598, -0.6561,   0.7041,    -0.2718,   0.937500,  0.750000,
-      -0.768177, -0.555570, -0.318190, -0.7699,   -0.5528,   -0.3189,
-      0.937500,  0.312500,  -0.587938, -0.707107, -0.392847, -0.5905,
-      -0.7041,   -0.3945,   0.906250,  0.250000,  -0.653281, -0.707107,
-      -0.270598, -0.6561,   -0.7041,   -0.2718,   0.937500,  0.250000,
-      -0.768177, 0.555570,  -0.318190, -0.7699,   0.5528,    -0.3189,
-      0.937500,  0.687500,  -0.587938, 0.707107,  -0.392847, -0.5905,
-      0.7041,    -0.3945,   0.906250,  0.750000,  -0.691341, 0.555570,
-      -0.461940, -0.6929,   0.5528,    -0.4630,   0.906250,  0.687500,
-      -0.513279, -0.831470, -0.212607, -0.5172,   -0.8286,   -0.2142,
-      0.937500,  0.187500,  -0.587938, -0.707107, -0.392847, -0.5905,
-      -0.7041,   -0.3945,   0.906250,  0.250000,  -0.461939, -0.831470,
-      -0.308658, -0.4654,   -0.8286,   -0.3110,   0.906250,  0.187500,
-      -0.768177, 0.555570,  -0.318190, -0.7699,   0.5528,    -0.3189,
-      0.937500,  0.687500,  -0.768177, 0.382683,  -0.513280, -0.7689,
-      0.3805,    -0.5138,   0.906250,  0.625000,  -0.853553, 0.382683,
-      -0.353553, -0.8544,   0.3805,    -0.3539,   0.937500,  0.625000,
-      -0.353553, -0.923880, -0.146447, -0.3584,   -0.9217,   -0.1484,
-      0.937500,  0.125000,  -0.461939, -0.831470, -0.308658, -0.4654,
-      -0.8286,   -0.3110,   0.906250,  0.187500,  -0.318189, -0.923880,
-      -0.212607, -0.3225,   -0.9217,   -0.2155,   0.906250,  0.125000,
-      -0.906127, 0.195090,  -0.375330, -0.9063,   0.1939,    -0.3754,
-      0.937500,  0.562500,  -0.768177, 0.382683,  -0.513280, -0.7689,
-      0.3805,    -0.5138,   0.906250,  0.625000,  -0.815493, 0.195090,
-      -0.544895, -0.8157,   0.1939,    -0.5450,   0.906250,  0.562500,
-      -0.353553, -0.923880, -0.146447, -0.3584,   -0.9217,   -0.1484,
-      0.937500,  0.125000,  -0.162212, -0.980785, -0.108386, -0.1671,
-      -0.9796,   -0.1117,   0.906250,  0.062500,  -0.180240, -0.980785,
-      -0.074658, -0.1857,   -0.9796,   -0.0769,   0.937500,  0.062500,
-      -0.923878, 0.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -0.815493, 0.195090,  -0.544895, -0.8157,
-      0.1939,    -0.5450,   0.906250,  0.562500,  -0.831468, 0.000000,
-      -0.555570, -0.8315,   -0.0000,   -0.5556,   0.906250,  0.500000,
-      -0.180240, 0.980785,  -0.074658, -0.1857,   0.9796,    -0.0769,
-      0.937500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.921875,  1.000000,  -0.162212, 0.980785,
-      -0.108386, -0.1671,   0.9796,    -0.1117,   0.906250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.921875,  0.000000,  -0.180240, -0.980785, -0.074658, -0.1857,
-      -0.9796,   -0.0769,   0.937500,  0.062500,  -0.162212, -0.980785,
-      -0.108386, -0.1671,   -0.9796,   -0.1117,   0.906250,  0.062500,
-      -0.923878, 0.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -0.815493, -0.195090, -0.544895, -0.8157,
-      -0.1939,   -0.5450,   0.906250,  0.437500,  -0.906127, -0.195090,
-      -0.375330, -0.9063,   -0.1939,   -0.3754,   0.937500,  0.437500,
-      -0.353553, 0.923880,  -0.146447, -0.3584,   0.9217,    -0.1484,
-      0.937500,  0.875000,  -0.162212, 0.980785,  -0.108386, -0.1671,
-      0.9796,    -0.1117,   0.906250,  0.937500,  -0.318189, 0.923880,
-      -0.212607, -0.3225,   0.9217,    -0.2155,   0.906250,  0.875000,
-      -0.461939, -0.831470, -0.308658, -0.4654,   -0.8286,   -0.3110,
-      0.906250,  0.187500,  -0.270598, -0.923880, -0.270598, -0.2743,
-      -0.9217,   -0.2743,   0.875000,  0.125000,  -0.318189, -0.923880,
-      -0.212607, -0.3225,   -0.9217,   -0.2155,   0.906250,  0.125000,
-      -0.815493, 0.195090,  -0.544895, -0.8157,   0.1939,    -0.5450,
-      0.906250,  0.562500,  -0.653281, 0.382683,  -0.653281, -0.6539,
-      0.3805,    -0.6539,   0.875000,  0.625000,  -0.693519, 0.195090,
-      -0.693520, -0.6937,   0.1939,    -0.6937,   0.875000,  0.562500,
-      -0.318189, -0.923880, -0.212607, -0.3225,   -0.9217,   -0.2155,
-      0.906250,  0.125000,  -0.137950, -0.980785, -0.137950, -0.1421,
-      -0.9796,   -0.1421,   0.875000,  0.062500,  -0.162212, -0.980785,
-      -0.108386, -0.1671,   -0.9796,   -0.1117,   0.906250,  0.062500,
-      -0.831468, 0.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.906250,  0.500000,  -0.693519, 0.195090,  -0.693520, -0.6937,
-      0.1939,    -0.6937,   0.875000,  0.562500,  -0.707106, 0.000000,
-      -0.707106, -0.7071,   -0.0000,   -0.7071,   0.875000,  0.500000,
-      -0.162212, 0.980785,  -0.108386, -0.1671,   0.9796,    -0.1117,
-      0.906250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.890625,  1.000000,  -0.137950, 0.980785,
-      -0.137950, -0.1421,   0.9796,    -0.1421,   0.875000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.890625,  0.000000,  -0.162212, -0.980785, -0.108386, -0.1671,
-      -0.9796,   -0.1117,   0.906250,  0.062500,  -0.137950, -0.980785,
-      -0.137950, -0.1421,   -0.9796,   -0.1421,   0.875000,  0.062500,
-      -0.831468, 0.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.906250,  0.500000,  -0.693519, -0.195090, -0.693520, -0.6937,
-      -0.1939,   -0.6937,   0.875000,  0.437500,  -0.815493, -0.195090,
-      -0.544895, -0.8157,   -0.1939,   -0.5450,   0.906250,  0.437500,
-      -0.162212, 0.980785,  -0.108386, -0.1671,   0.9796,    -0.1117,
-      0.906250,  0.937500,  -0.270598, 0.923880,  -0.270598, -0.2743,
-      0.9217,    -0.2743,   0.875000,  0.875000,  -0.318189, 0.923880,
-      -0.212607, -0.3225,   0.9217,    -0.2155,   0.906250,  0.875000,
-      -0.815493, -0.195090, -0.544895, -0.8157,   -0.1939,   -0.5450,
-      0.906250,  0.437500,  -0.653281, -0.382683, -0.653281, -0.6539,
-      -0.3805,   -0.6539,   0.875000,  0.375000,  -0.768177, -0.382683,
-      -0.513280, -0.7689,   -0.3805,   -0.5138,   0.906250,  0.375000,
-      -0.461939, 0.831470,  -0.308658, -0.4654,   0.8286,    -0.3110,
-      0.906250,  0.812500,  -0.270598, 0.923880,  -0.270598, -0.2743,
-      0.9217,    -0.2743,   0.875000,  0.875000,  -0.392847, 0.831470,
-      -0.392847, -0.3958,   0.8286,    -0.3958,   0.875000,  0.812500,
-      -0.691341, -0.555570, -0.461940, -0.6929,   -0.5528,   -0.4630,
-      0.906250,  0.312500,  -0.653281, -0.382683, -0.653281, -0.6539,
-      -0.3805,   -0.6539,   0.875000,  0.375000,  -0.587937, -0.555570,
-      -0.587938, -0.5893,   -0.5528,   -0.5893,   0.875000,  0.312500,
-      -0.461939, 0.831470,  -0.308658, -0.4654,   0.8286,    -0.3110,
-      0.906250,  0.812500,  -0.500000, 0.707107,  -0.500000, -0.5021,
-      0.7041,    -0.5021,   0.875000,  0.750000,  -0.587938, 0.707107,
-      -0.392847, -0.5905,   0.7041,    -0.3945,   0.906250,  0.750000,
-      -0.691341, -0.555570, -0.461940, -0.6929,   -0.5528,   -0.4630,
-      0.906250,  0.312500,  -0.500000, -0.707107, -0.500000, -0.5021,
-      -0.7041,   -0.5021,   0.875000,  0.250000,  -0.587938, -0.707107,
-      -0.392847, -0.5905,   -0.7041,   -0.3945,   0.906250,  0.250000,
-      -0.691341, 0.555570,  -0.461940, -0.6929,   0.5528,    -0.4630,
-      0.906250,  0.687500,  -0.500000, 0.707107,  -0.500000, -0.5021,
-      0.7041,    -0.5021,   0.875000,  0.750000,  -0.587937, 0.555570,
-      -0.587938, -0.5893,   0.5528,    -0.5893,   0.875000,  0.687500,
-      -0.461939, -0.831470, -0.308658, -0.4654,   -0.8286,   -0.3110,
-      0.906250,  0.187500,  -0.500000, -0.707107, -0.500000, -0.5021,
-      -0.7041,   -0.5021,   0.875000,  0.250000,  -0.392847, -0.831470,
-      -0.392847, -0.3958,   -0.8286,   -0.3958,   0.875000,  0.187500,
-      -0.691341, 0.555570,  -0.461940, -0.6929,   0.5528,    -0.4630,
-      0.906250,  0.687500,  -0.653281, 0.382683,  -0.653281, -0.6539,
-      0.3805,    -0.6539,   0.875000,  0.625000,  -0.768177, 0.382683,
-      -0.513280, -0.7689,   0.3805,    -0.5138,   0.906250,  0.625000,
-      -0.392847, 0.831470,  -0.392847, -0.3958,   0.8286,    -0.3958,
-      0.875000,  0.812500,  -0.212607, 0.923880,  -0.318190, -0.2155,
-      0.9217,    -0.3225,   0.843750,  0.875000,  -0.308658, 0.831470,
-      -0.461939, -0.3110,   0.8286,    -0.4654,   0.843750,  0.812500,
-      -0.587937, -0.555570, -0.587938, -0.5893,   -0.5528,   -0.5893,
-      0.875000,  0.312500,  -0.513280, -0.382683, -0.768177, -0.5138,
-      -0.3805,   -0.7689,   0.843750,  0.375000,  -0.461939, -0.555570,
-      -0.691341, -0.4630,   -0.5528,   -0.6929,   0.843750,  0.312500,
-      -0.392847, 0.831470,  -0.392847, -0.3958,   0.8286,    -0.3958,
-      0.875000,  0.812500,  -0.392847, 0.707107,  -0.587938, -0.3945,
-      0.7041,    -0.5905,   0.843750,  0.750000,  -0.500000, 0.707107,
-      -0.500000, -0.5021,   0.7041,    -0.5021,   0.875000,  0.750000,
-      -0.587937, -0.555570, -0.587938, -0.5893,   -0.5528,   -0.5893,
-      0.875000,  0.312500,  -0.392847, -0.707107, -0.587938, -0.3945,
-      -0.7041,   -0.5905,   0.843750,  0.250000,  -0.500000, -0.707107,
-      -0.500000, -0.5021,   -0.7041,   -0.5021,   0.875000,  0.250000,
-      -0.587937, 0.555570,  -0.587938, -0.5893,   0.5528,    -0.5893,
-      0.875000,  0.687500,  -0.392847, 0.707107,  -0.587938, -0.3945,
-      0.7041,    -0.5905,   0.843750,  0.750000,  -0.461939, 0.555570,
-      -0.691341, -0.4630,   0.5528,    -0.6929,   0.843750,  0.687500,
-      -0.392847, -0.831470, -0.392847, -0.3958,   -0.8286,   -0.3958,
-      0.875000,  0.187500,  -0.392847, -0.707107, -0.587938, -0.3945,
-      -0.7041,   -0.5905,   0.843750,  0.250000,  -0.308658, -0.831470,
-      -0.461939, -0.3110,   -0.8286,   -0.4654,   0.843750,  0.187500,
-      -0.587937, 0.555570,  -0.587938, -0.5893,   0.5528,    -0.5893,
-      0.875000,  0.687500,  -0.513280, 0.382683,  -0.768177, -0.5138,
-      0.3805,    -0.7689,   0.843750,  0.625000,  -0.653281, 0.382683,
-      -0.653281, -0.6539,   0.3805,    -0.6539,   0.875000,  0.625000,
-      -0.392847, -0.831470, -0.392847, -0.3958,   -0.8286,   -0.3958,
-      0.875000,  0.187500,  -0.212607, -0.923880, -0.318190, -0.2155,
-      -0.9217,   -0.3225,   0.843750,  0.125000,  -0.270598, -0.923880,
-      -0.270598, -0.2743,   -0.9217,   -0.2743,   0.875000,  0.125000,
-      -0.693519, 0.195090,  -0.693520, -0.6937,   0.1939,    -0.6937,
-      0.875000,  0.562500,  -0.513280, 0.382683,  -0.768177, -0.5138,
-      0.3805,    -0.7689,   0.843750,  0.625000,  -0.544895, 0.195090,
-      -0.815493, -0.5450,   0.1939,    -0.8157,   0.843750,  0.562500,
-      -0.270598, -0.923880, -0.270598, -0.2743,   -0.9217,   -0.2743,
-      0.875000,  0.125000,  -0.108386, -0.980785, -0.162212, -0.1117,
-      -0.9796,   -0.1671,   0.843750,  0.062500,  -0.137950, -0.980785,
-      -0.137950, -0.1421,   -0.9796,   -0.1421,   0.875000,  0.062500,
-      -0.707106, 0.000000,  -0.707106, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.544895, 0.195090,  -0.815493, -0.5450,
-      0.1939,    -0.8157,   0.843750,  0.562500,  -0.555569, 0.000000,
-      -0.831469, -0.5556,   -0.0000,   -0.8315,   0.843750,  0.500000,
-      -0.137950, 0.980785,  -0.137950, -0.1421,   0.9796,    -0.1421,
-      0.875000,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.859375,  1.000000,  -0.108386, 0.980785,
-      -0.162212, -0.1117,   0.9796,    -0.1671,   0.843750,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.859375,  0.000000,  -0.137950, -0.980785, -0.137950, -0.1421,
-      -0.9796,   -0.1421,   0.875000,  0.062500,  -0.108386, -0.980785,
-      -0.162212, -0.1117,   -0.9796,   -0.1671,   0.843750,  0.062500,
-      -0.707106, 0.000000,  -0.707106, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.544895, -0.195090, -0.815493, -0.5450,
-      -0.1939,   -0.8157,   0.843750,  0.437500,  -0.693519, -0.195090,
-      -0.693520, -0.6937,   -0.1939,   -0.6937,   0.875000,  0.437500,
-      -0.137950, 0.980785,  -0.137950, -0.1421,   0.9796,    -0.1421,
-      0.875000,  0.937500,  -0.212607, 0.923880,  -0.318190, -0.2155,
-      0.9217,    -0.3225,   0.843750,  0.875000,  -0.270598, 0.923880,
-      -0.270598, -0.2743,   0.9217,    -0.2743,   0.875000,  0.875000,
-      -0.693519, -0.195090, -0.693520, -0.6937,   -0.1939,   -0.6937,
-      0.875000,  0.437500,  -0.513280, -0.382683, -0.768177, -0.5138,
-      -0.3805,   -0.7689,   0.843750,  0.375000,  -0.653281, -0.382683,
-      -0.653281, -0.6539,   -0.3805,   -0.6539,   0.875000,  0.375000,
-      -0.544895, 0.195090,  -0.815493, -0.5450,   0.1939,    -0.8157,
-      0.843750,  0.562500,  -0.353553, 0.382683,  -0.853553, -0.3539,
-      0.3805,    -0.8544,   0.812500,  0.625000,  -0.375330, 0.195090,
-      -0.906127, -0.3754,   0.1939,    -0.9063,   0.812500,  0.562500,
-      -0.212607, -0.923880, -0.318190, -0.2155,   -0.9217,   -0.3225,
-      0.843750,  0.125000,  -0.074658, -0.980785, -0.180240, -0.0769,
-      -0.9796,   -0.1857,   0.812500,  0.062500,  -0.108386, -0.980785,
-      -0.162212, -0.1117,   -0.9796,   -0.1671,   0.843750,  0.062500,
-      -0.555569, 0.000000,  -0.831469, -0.5556,   -0.0000,   -0.8315,
-      0.843750,  0.500000,  -0.375330, 0.195090,  -0.906127, -0.3754,
-      0.1939,    -0.9063,   0.812500,  0.562500,  -0.382683, 0.000000,
-      -0.923879, -0.3827,   -0.0000,   -0.9239,   0.812500,  0.500000,
-      -0.108386, 0.980785,  -0.162212, -0.1117,   0.9796,    -0.1671,
-      0.843750,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.828125,  1.000000,  -0.074658, 0.980785,
-      -0.180240, -0.0769,   0.9796,    -0.1857,   0.812500,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.828125,  0.000000,  -0.108386, -0.980785, -0.162212, -0.1117,
-      -0.9796,   -0.1671,   0.843750,  0.062500,  -0.074658, -0.980785,
-      -0.180240, -0.0769,   -0.9796,   -0.1857,   0.812500,  0.062500,
-      -0.555569, 0.000000,  -0.831469, -0.5556,   -0.0000,   -0.8315,
-      0.843750,  0.500000,  -0.375330, -0.195090, -0.906127, -0.3754,
-      -0.1939,   -0.9063,   0.812500,  0.437500,  -0.544895, -0.195090,
-      -0.815493, -0.5450,   -0.1939,   -0.8157,   0.843750,  0.437500,
-      -0.212607, 0.923880,  -0.318190, -0.2155,   0.9217,    -0.3225,
-      0.843750,  0.875000,  -0.074658, 0.980785,  -0.180240, -0.0769,
-      0.9796,    -0.1857,   0.812500,  0.937500,  -0.146446, 0.923880,
-      -0.353553, -0.1484,   0.9217,    -0.3584,   0.812500,  0.875000,
-      -0.544895, -0.195090, -0.815493, -0.5450,   -0.1939,   -0.8157,
-      0.843750,  0.437500,  -0.353553, -0.382683, -0.853553, -0.3539,
-      -0.3805,   -0.8544,   0.812500,  0.375000,  -0.513280, -0.382683,
-      -0.768177, -0.5138,   -0.3805,   -0.7689,   0.843750,  0.375000,
-      -0.212607, 0.923880,  -0.318190, -0.2155,   0.9217,    -0.3225,
-      0.843750,  0.875000,  -0.212607, 0.831470,  -0.513279, -0.2142,
-      0.8286,    -0.5172,   0.812500,  0.812500,  -0.308658, 0.831470,
-      -0.461939, -0.3110,   0.8286,    -0.4654,   0.843750,  0.812500,
-      -0.461939, -0.555570, -0.691341, -0.4630,   -0.5528,   -0.6929,
-      0.843750,  0.312500,  -0.353553, -0.382683, -0.853553, -0.3539,
-      -0.3805,   -0.8544,   0.812500,  0.375000,  -0.318189, -0.555570,
-      -0.768177, -0.3189,   -0.5528,   -0.7699,   0.812500,  0.312500,
-      -0.308658, 0.831470,  -0.461939, -0.3110,   0.8286,    -0.4654,
-      0.843750,  0.812500,  -0.270598, 0.707107,  -0.653281, -0.2718,
-      0.7041,    -0.6561,   0.812500,  0.750000,  -0.392847, 0.707107,
-      -0.587938, -0.3945,   0.7041,    -0.5905,   0.843750,  0.750000,
-      -0.461939, -0.555570, -0.691341, -0.4630,   -0.5528,   -0.6929,
-      0.843750,  0.312500,  -0.270598, -0.707107, -0.653281, -0.2718,
-      -0.7041,   -0.6561,   0.812500,  0.250000,  -0.392847, -0.707107,
-      -0.587938, -0.3945,   -0.7041,   -0.5905,   0.843750,  0.250000,
-      -0.461939, 0.555570,  -0.691341, -0.4630,   0.5528,    -0.6929,
-      0.843750,  0.687500,  -0.270598, 0.707107,  -0.653281, -0.2718,
-      0.7041,    -0.6561,   0.812500,  0.750000,  -0.318189, 0.555570,
-      -0.768177, -0.3189,   0.5528,    -0.7699,   0.812500,  0.687500,
-      -0.308658, -0.831470, -0.461939, -0.3110,   -0.8286,   -0.4654,
-      0.843750,  0.187500,  -0.270598, -0.707107, -0.653281, -0.2718,
-      -0.7041,   -0.6561,   0.812500,  0.250000,  -0.212607, -0.831470,
-      -0.513279, -0.2142,   -0.8286,   -0.5172,   0.812500,  0.187500,
-      -0.461939, 0.555570,  -0.691341, -0.4630,   0.5528,    -0.6929,
-      0.843750,  0.687500,  -0.353553, 0.382683,  -0.853553, -0.3539,
-      0.3805,    -0.8544,   0.812500,  0.625000,  -0.513280, 0.382683,
-      -0.768177, -0.5138,   0.3805,    -0.7689,   0.843750,  0.625000,
-      -0.308658, -0.831470, -0.461939, -0.3110,   -0.8286,   -0.4654,
-      0.843750,  0.187500,  -0.146446, -0.923880, -0.353553, -0.1484,
-      -0.9217,   -0.3584,   0.812500,  0.125000,  -0.212607, -0.923880,
-      -0.318190, -0.2155,   -0.9217,   -0.3225,   0.843750,  0.125000,
-      -0.318189, -0.555570, -0.768177, -0.3189,   -0.5528,   -0.7699,
-      0.812500,  0.312500,  -0.180240, -0.382683, -0.906127, -0.1804,
-      -0.3805,   -0.9070,   0.781250,  0.375000,  -0.162211, -0.555570,
-      -0.815493, -0.1626,   -0.5528,   -0.8173,   0.781250,  0.312500,
-      -0.212607, 0.831470,  -0.513279, -0.2142,   0.8286,    -0.5172,
-      0.812500,  0.812500,  -0.137950, 0.707107,  -0.693520, -0.1385,
-      0.7041,    -0.6965,   0.781250,  0.750000,  -0.270598, 0.707107,
-      -0.653281, -0.2718,   0.7041,    -0.6561,   0.812500,  0.750000,
-      -0.318189, -0.555570, -0.768177, -0.3189,   -0.5528,   -0.7699,
-      0.812500,  0.312500,  -0.137950, -0.707107, -0.693520, -0.1385,
-      -0.7041,   -0.6965,   0.781250,  0.250000,  -0.270598, -0.707107,
-      -0.653281, -0.2718,   -0.7041,   -0.6561,   0.812500,  0.250000,
-      -0.318189, 0.555570,  -0.768177, -0.3189,   0.5528,    -0.7699,
-      0.812500,  0.687500,  -0.137950, 0.707107,  -0.693520, -0.1385,
-      0.7041,    -0.6965,   0.781250,  0.750000,  -0.162211, 0.555570,
-      -0.815493, -0.1626,   0.5528,    -0.8173,   0.781250,  0.687500,
-      -0.212607, -0.831470, -0.513279, -0.2142,   -0.8286,   -0.5172,
-      0.812500,  0.187500,  -0.137950, -0.707107, -0.693520, -0.1385,
-      -0.7041,   -0.6965,   0.781250,  0.250000,  -0.108386, -0.831470,
-      -0.544895, -0.1092,   -0.8286,   -0.5490,   0.781250,  0.187500,
-      -0.318189, 0.555570,  -0.768177, -0.3189,   0.5528,    -0.7699,
-      0.812500,  0.687500,  -0.180240, 0.382683,  -0.906127, -0.1804,
-      0.3805,    -0.9070,   0.781250,  0.625000,  -0.353553, 0.382683,
-      -0.853553, -0.3539,   0.3805,    -0.8544,   0.812500,  0.625000,
-      -0.212607, -0.831470, -0.513279, -0.2142,   -0.8286,   -0.5172,
-      0.812500,  0.187500,  -0.074658, -0.923880, -0.375330, -0.0757,
-      -0.9217,   -0.3804,   0.781250,  0.125000,  -0.146446, -0.923880,
-      -0.353553, -0.1484,   -0.9217,   -0.3584,   0.812500,  0.125000,
-      -0.375330, 0.195090,  -0.906127, -0.3754,   0.1939,    -0.9063,
-      0.812500,  0.562500,  -0.180240, 0.382683,  -0.906127, -0.1804,
-      0.3805,    -0.9070,   0.781250,  0.625000,  -0.191341, 0.195090,
-      -0.961939, -0.1914,   0.1939,    -0.9622,   0.781250,  0.562500,
-      -0.074658, -0.980785, -0.180240, -0.0769,   -0.9796,   -0.1857,
-      0.812500,  0.062500,  -0.074658, -0.923880, -0.375330, -0.0757,
-      -0.9217,   -0.3804,   0.781250,  0.125000,  -0.038060, -0.980785,
-      -0.191342, -0.0392,   -0.9796,   -0.1971,   0.781250,  0.062500,
-      -0.382683, 0.000000,  -0.923879, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.191341, 0.195090,  -0.961939, -0.1914,
-      0.1939,    -0.9622,   0.781250,  0.562500,  -0.195090, 0.000000,
-      -0.980784, -0.1951,   -0.0000,   -0.9808,   0.781250,  0.500000,
-      -0.074658, 0.980785,  -0.180240, -0.0769,   0.9796,    -0.1857,
-      0.812500,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.796875,  1.000000,  -0.038060, 0.980785,
-      -0.191342, -0.0392,   0.9796,    -0.1971,   0.781250,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.796875,  0.000000,  -0.074658, -0.980785, -0.180240, -0.0769,
-      -0.9796,   -0.1857,   0.812500,  0.062500,  -0.038060, -0.980785,
-      -0.191342, -0.0392,   -0.9796,   -0.1971,   0.781250,  0.062500,
-      -0.382683, 0.000000,  -0.923879, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.191341, -0.195090, -0.961939, -0.1914,
-      -0.1939,   -0.9622,   0.781250,  0.437500,  -0.375330, -0.195090,
-      -0.906127, -0.3754,   -0.1939,   -0.9063,   0.812500,  0.437500,
-      -0.074658, 0.980785,  -0.180240, -0.0769,   0.9796,    -0.1857,
-      0.812500,  0.937500,  -0.074658, 0.923880,  -0.375330, -0.0757,
-      0.9217,    -0.3804,   0.781250,  0.875000,  -0.146446, 0.923880,
-      -0.353553, -0.1484,   0.9217,    -0.3584,   0.812500,  0.875000,
-      -0.375330, -0.195090, -0.906127, -0.3754,   -0.1939,   -0.9063,
-      0.812500,  0.437500,  -0.180240, -0.382683, -0.906127, -0.1804,
-      -0.3805,   -0.9070,   0.781250,  0.375000,  -0.353553, -0.382683,
-      -0.853553, -0.3539,   -0.3805,   -0.8544,   0.812500,  0.375000,
-      -0.212607, 0.831470,  -0.513279, -0.2142,   0.8286,    -0.5172,
-      0.812500,  0.812500,  -0.074658, 0.923880,  -0.375330, -0.0757,
-      0.9217,    -0.3804,   0.781250,  0.875000,  -0.108386, 0.831470,
-      -0.544895, -0.1092,   0.8286,    -0.5490,   0.781250,  0.812500,
-      -0.074658, -0.923880, -0.375330, -0.0757,   -0.9217,   -0.3804,
-      0.781250,  0.125000,  0.000000,  -0.980785, -0.195090, -0.0000,
-      -0.9796,   -0.2010,   0.750000,  0.062500,  -0.038060, -0.980785,
-      -0.191342, -0.0392,   -0.9796,   -0.1971,   0.781250,  0.062500,
-      -0.195090, 0.000000,  -0.980784, -0.1951,   -0.0000,   -0.9808,
-      0.781250,  0.500000,  0.000000,  0.195090,  -0.980785, -0.0000,
-      0.1939,    -0.9810,   0.750000,  0.562500,  0.000000,  0.000000,
-      -1.000000, -0.0000,   -0.0000,   -1.0000,   0.750000,  0.500000,
-      -0.038060, 0.980785,  -0.191342, -0.0392,   0.9796,    -0.1971,
-      0.781250,  0.937500,  0.000000,  1.000000,  0.000000,  -0.0000,
-      1.0000,    -0.0000,   0.765625,  1.000000,  0.000000,  0.980785,
-      -0.195090, -0.0000,   0.9796,    -0.2010,   0.750000,  0.937500,
-      0.000000,  -1.000000, 0.000000,  -0.0000,   -1.0000,   -0.0000,
-      0.765625,  0.000000,  -0.038060, -0.980785, -0.191342, -0.0392,
-      -0.9796,   -0.1971,   0.781250,  0.062500,  0.000000,  -0.980785,
-      -0.195090, -0.0000,   -0.9796,   -0.2010,   0.750000,  0.062500,
-      -0.195090, 0.000000,  -0.980784, -0.1951,   -0.0000,   -0.9808,
-      0.781250,  0.500000,  0.000000,  -0.195090, -0.980785, -0.0000,
-      -0.1939,   -0.9810,   0.750000,  0.437500,  -0.191341, -0.195090,
-      -0.961939, -0.1914,   -0.1939,   -0.9622,   0.781250,  0.437500,
-      -0.074658, 0.923880,  -0.375330, -0.0757,   0.9217,    -0.3804,
-      0.781250,  0.875000,  0.000000,  0.980785,  -0.195090, -0.0000,
-      0.9796,    -0.2010,   0.750000,  0.937500,  0.000000,  0.923880,
-      -0.382683, -0.0000,   0.9217,    -0.3879,   0.750000,  0.875000,
-      -0.191341, -0.195090, -0.961939, -0.1914,   -0.1939,   -0.9622,
-      0.781250,  0.437500,  0.000000,  -0.382683, -0.923879, -0.0000,
-      -0.3805,   -0.9248,   0.750000,  0.375000,  -0.180240, -0.382683,
-      -0.906127, -0.1804,   -0.3805,   -0.9070,   0.781250,  0.375000,
-      -0.108386, 0.831470,  -0.544895, -0.1092,   0.8286,    -0.5490,
-      0.781250,  0.812500,  0.000000,  0.923880,  -0.382683, -0.0000,
-      0.9217,    -0.3879,   0.750000,  0.875000,  0.000000,  0.831470,
-      -0.555570, -0.0000,   0.8286,    -0.5598,   0.750000,  0.812500,
-      -0.180240, -0.382683, -0.906127, -0.1804,   -0.3805,   -0.9070,
-      0.781250,  0.375000,  0.000000,  -0.555570, -0.831470, -0.0000,
-      -0.5528,   -0.8333,   0.750000,  0.312500,  -0.162211, -0.555570,
-      -0.815493, -0.1626,   -0.5528,   -0.8173,   0.781250,  0.312500,
-      -0.137950, 0.707107,  -0.693520, -0.1385,   0.7041,    -0.6965,
-      0.781250,  0.750000,  0.000000,  0.831470,  -0.555570, -0.0000,
-      0.8286,    -0.5598,   0.750000,  0.812500,  0.000000,  0.707107,
-      -0.707107, -0.0000,   0.7041,    -0.7101,   0.750000,  0.750000,
-      -0.162211, -0.555570, -0.815493, -0.1626,   -0.5528,   -0.8173,
-      0.781250,  0.312500,  0.000000,  -0.707107, -0.707107, -0.0000,
-      -0.7041,   -0.7101,   0.750000,  0.250000,  -0.137950, -0.707107,
-      -0.693520, -0.1385,   -0.7041,   -0.6965,   0.781250,  0.250000,
-      -0.162211, 0.555570,  -0.815493, -0.1626,   0.5528,    -0.8173,
-      0.781250,  0.687500,  0.000000,  0.707107,  -0.707107, -0.0000,
-      0.7041,    -0.7101,   0.750000,  0.750000,  0.000000,  0.555570,
-      -0.831470, -0.0000,   0.5528,    -0.8333,   0.750000,  0.687500,
-      -0.108386, -0.831470, -0.544895, -0.1092,   -0.8286,   -0.5490,
-      0.781250,  0.187500,  0.000000,  -0.707107, -0.707107, -0.0000,
-      -0.7041,   -0.7101,   0.750000,  0.250000,  0.000000,  -0.831470,
-      -0.555570, -0.0000,   -0.8286,   -0.5598,   0.750000,  0.187500,
-      -0.180240, 0.382683,  -0.906127, -0.1804,   0.3805,    -0.9070,
-      0.781250,  0.625000,  0.000000,  0.555570,  -0.831470, -0.0000,
-      0.5528,    -0.8333,   0.750000,  0.687500,  0.000000,  0.382683,
-      -0.923879, -0.0000,   0.3805,    -0.9248,   0.750000,  0.625000,
-      -0.108386, -0.831470, -0.544895, -0.1092,   -0.8286,   -0.5490,
-      0.781250,  0.187500,  0.000000,  -0.923880, -0.382683, -0.0000,
-      -0.9217,   -0.3879,   0.750000,  0.125000,  -0.074658, -0.923880,
-      -0.375330, -0.0757,   -0.9217,   -0.3804,   0.781250,  0.125000,
-      -0.191341, 0.195090,  -0.961939, -0.1914,   0.1939,    -0.9622,
-      0.781250,  0.562500,  0.000000,  0.382683,  -0.923879, -0.0000,
-      0.3805,    -0.9248,   0.750000,  0.625000,  0.000000,  0.195090,
-      -0.980785, -0.0000,   0.1939,    -0.9810,   0.750000,  0.562500,
-      0.000000,  0.195090,  -0.980785, -0.0000,   0.1939,    -0.9810,
-      0.750000,  0.562500,  0.000000,  0.382683,  -0.923879, -0.0000,
-      0.3805,    -0.9248,   0.750000,  0.625000,  0.180240,  0.382683,
-      -0.906127, 0.1804,    0.3805,    -0.9070,   0.718750,  0.625000,
-      0.000000,  -0.923880, -0.382683, -0.0000,   -0.9217,   -0.3879,
-      0.750000,  0.125000,  0.074658,  -0.923880, -0.375330, 0.0757,
-      -0.9217,   -0.3804,   0.718750,  0.125000,  0.038060,  -0.980785,
-      -0.191342, 0.0392,    -0.9796,   -0.1971,   0.718750,  0.062500,
-      0.000000,  0.195090,  -0.980785, -0.0000,   0.1939,    -0.9810,
-      0.750000,  0.562500,  0.191342,  0.195090,  -0.961940, 0.1914,
-      0.1939,    -0.9622,   0.718750,  0.562500,  0.195090,  0.000000,
-      -0.980785, 0.1951,    -0.0000,   -0.9808,   0.718750,  0.500000,
-      0.000000,  0.000000,  -1.000000, -0.0000,   -0.0000,   -1.0000,
-      0.750000,  0.500000,  0.195090,  0.000000,  -0.980785, 0.1951,
-      -0.0000,   -0.9808,   0.718750,  0.500000,  0.191342,  -0.195090,
-      -0.961940, 0.1914,    -0.1939,   -0.9622,   0.718750,  0.437500,
-      0.000000,  0.923880,  -0.382683, -0.0000,   0.9217,    -0.3879,
-      0.750000,  0.875000,  0.000000,  0.980785,  -0.195090, -0.0000,
-      0.9796,    -0.2010,   0.750000,  0.937500,  0.038060,  0.980785,
-      -0.191342, 0.0392,    0.9796,    -0.1971,   0.718750,  0.937500,
-      0.000000,  -0.195090, -0.980785, -0.0000,   -0.1939,   -0.9810,
-      0.750000,  0.437500,  0.191342,  -0.195090, -0.961940, 0.1914,
-      -0.1939,   -0.9622,   0.718750,  0.437500,  0.180240,  -0.382683,
-      -0.906127, 0.1804,    -0.3805,   -0.9070,   0.718750,  0.375000,
-      0.000000,  0.831470,  -0.555570, -0.0000,   0.8286,    -0.5598,
-      0.750000,  0.812500,  0.000000,  0.923880,  -0.382683, -0.0000,
-      0.9217,    -0.3879,   0.750000,  0.875000,  0.074658,  0.923880,
-      -0.375330, 0.0757,    0.9217,    -0.3804,   0.718750,  0.875000,
-      0.000000,  -0.382683, -0.923879, -0.0000,   -0.3805,   -0.9248,
-      0.750000,  0.375000,  0.180240,  -0.382683, -0.906127, 0.1804,
-      -0.3805,   -0.9070,   0.718750,  0.375000,  0.162212,  -0.555570,
-      -0.815493, 0.1626,    -0.5528,   -0.8173,   0.718750,  0.312500,
-      0.000000,  0.707107,  -0.707107, -0.0000,   0.7041,    -0.7101,
-      0.750000,  0.750000,  0.000000,  0.831470,  -0.555570, -0.0000,
-      0.8286,    -0.5598,   0.750000,  0.812500,  0.108386,  0.831470,
-      -0.544895, 0.1092,    0.8286,    -0.5490,   0.718750,  0.812500,
-      0.000000,  -0.555570, -0.831470, -0.0000,   -0.5528,   -0.8333,
-      0.750000,  0.312500,  0.162212,  -0.555570, -0.815493, 0.1626,
-      -0.5528,   -0.8173,   0.718750,  0.312500,  0.137950,  -0.707107,
-      -0.693520, 0.1385,    -0.7041,   -0.6965,   0.718750,  0.250000,
-      0.000000,  0.555570,  -0.831470, -0.0000,   0.5528,    -0.8333,
-      0.750000,  0.687500,  0.000000,  0.707107,  -0.707107, -0.0000,
-      0.7041,    -0.7101,   0.750000,  0.750000,  0.137950,  0.707107,
-      -0.693520, 0.1385,    0.7041,    -0.6965,   0.718750,  0.750000,
-      0.000000,  -0.707107, -0.707107, -0.0000,   -0.7041,   -0.7101,
-      0.750000,  0.250000,  0.137950,  -0.707107, -0.693520, 0.1385,
-      -0.7041,   -0.6965,   0.718750,  0.250000,  0.108386,  -0.831470,
-      -0.544895, 0.1092,    -0.8286,   -0.5490,   0.718750,  0.187500,
-      0.000000,  0.382683,  -0.923879, -0.0000,   0.3805,    -0.9248,
-      0.750000,  0.625000,  0.000000,  0.555570,  -0.831470, -0.0000,
-      0.5528,    -0.8333,   0.750000,  0.687500,  0.162212,  0.555570,
-      -0.815493, 0.1626,    0.5528,    -0.8173,   0.718750,  0.687500,
-      0.000000,  -0.831470, -0.555570, -0.0000,   -0.8286,   -0.5598,
-      0.750000,  0.187500,  0.108386,  -0.831470, -0.544895, 0.1092,
-      -0.8286,   -0.5490,   0.718750,  0.187500,  0.074658,  -0.923880,
-      -0.375330, 0.0757,    -0.9217,   -0.3804,   0.718750,  0.125000,
-      0.162212,  0.555570,  -0.815493, 0.1626,    0.5528,    -0.8173,
-      0.718750,  0.687500,  0.318190,  0.555570,  -0.768178, 0.3189,
-      0.5528,    -0.7699,   0.687500,  0.687500,  0.353553,  0.382683,
-      -0.853553, 0.3539,    0.3805,    -0.8544,   0.687500,  0.625000,
-      0.074658,  -0.923880, -0.375330, 0.0757,    -0.9217,   -0.3804,
-      0.718750,  0.125000,  0.108386,  -0.831470, -0.544895, 0.1092,
-      -0.8286,   -0.5490,   0.718750,  0.187500,  0.212608,  -0.831470,
-      -0.513280, 0.2142,    -0.8286,   -0.5172,   0.687500,  0.187500,
-      0.191342,  0.195090,  -0.961940, 0.1914,    0.1939,    -0.9622,
-      0.718750,  0.562500,  0.180240,  0.382683,  -0.906127, 0.1804,
-      0.3805,    -0.9070,   0.718750,  0.625000,  0.353553,  0.382683,
-      -0.853553, 0.3539,    0.3805,    -0.8544,   0.687500,  0.625000,
-      0.074658,  -0.923880, -0.375330, 0.0757,    -0.9217,   -0.3804,
-      0.718750,  0.125000,  0.146447,  -0.923880, -0.353553, 0.1484,
-      -0.9217,   -0.3584,   0.687500,  0.125000,  0.074658,  -0.980785,
-      -0.180240, 0.0769,    -0.9796,   -0.1857,   0.687500,  0.062500,
-      0.191342,  0.195090,  -0.961940, 0.1914,    0.1939,    -0.9622,
-      0.718750,  0.562500,  0.375330,  0.195090,  -0.906127, 0.3754,
-      0.1939,    -0.9063,   0.687500,  0.562500,  0.382683,  0.000000,
-      -0.923879, 0.3827,    -0.0000,   -0.9239,   0.687500,  0.500000,
-      0.195090,  0.000000,  -0.980785, 0.1951,    -0.0000,   -0.9808,
-      0.718750,  0.500000,  0.382683,  0.000000,  -0.923879, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.375330,  -0.195090,
-      -0.906127, 0.3754,    -0.1939,   -0.9063,   0.687500,  0.437500,
-      0.038060,  0.980785,  -0.191342, 0.0392,    0.9796,    -0.1971,
-      0.718750,  0.937500,  0.074658,  0.980785,  -0.180240, 0.0769,
-      0.9796,    -0.1857,   0.687500,  0.937500,  0.146447,  0.923880,
-      -0.353553, 0.1484,    0.9217,    -0.3584,   0.687500,  0.875000,
-      0.191342,  -0.195090, -0.961940, 0.1914,    -0.1939,   -0.9622,
-      0.718750,  0.437500,  0.375330,  -0.195090, -0.906127, 0.3754,
-      -0.1939,   -0.9063,   0.687500,  0.437500,  0.353553,  -0.382683,
-      -0.853553, 0.3539,    -0.3805,   -0.8544,   0.687500,  0.375000,
-      0.074658,  0.923880,  -0.375330, 0.0757,    0.9217,    -0.3804,
-      0.718750,  0.875000,  0.146447,  0.923880,  -0.353553, 0.1484,
-      0.9217,    -0.3584,   0.687500,  0.875000,  0.212608,  0.831470,
-      -0.513280, 0.2142,    0.8286,    -0.5172,   0.687500,  0.812500,
-      0.180240,  -0.382683, -0.906127, 0.1804,    -0.3805,   -0.9070,
-      0.718750,  0.375000,  0.353553,  -0.382683, -0.853553, 0.3539,
-      -0.3805,   -0.8544,   0.687500,  0.375000,  0.318190,  -0.555570,
-      -0.768178, 0.3189,    -0.5528,   -0.7699,   0.687500,  0.312500,
-      0.108386,  0.831470,  -0.544895, 0.1092,    0.8286,    -0.5490,
-      0.718750,  0.812500,  0.212608,  0.831470,  -0.513280, 0.2142,
-      0.8286,    -0.5172,   0.687500,  0.812500,  0.270598,  0.707107,
-      -0.653281, 0.2718,    0.7041,    -0.6561,   0.687500,  0.750000,
-      0.162212,  -0.555570, -0.815493, 0.1626,    -0.5528,   -0.8173,
-      0.718750,  0.312500,  0.318190,  -0.555570, -0.768178, 0.3189,
-      -0.5528,   -0.7699,   0.687500,  0.312500,  0.270598,  -0.707107,
-      -0.653281, 0.2718,    -0.7041,   -0.6561,   0.687500,  0.250000,
-      0.137950,  0.707107,  -0.693520, 0.1385,    0.7041,    -0.6965,
-      0.718750,  0.750000,  0.270598,  0.707107,  -0.653281, 0.2718,
-      0.7041,    -0.6561,   0.687500,  0.750000,  0.318190,  0.555570,
-      -0.768178, 0.3189,    0.5528,    -0.7699,   0.687500,  0.687500,
-      0.108386,  -0.831470, -0.544895, 0.1092,    -0.8286,   -0.5490,
-      0.718750,  0.187500,  0.137950,  -0.707107, -0.693520, 0.1385,
-      -0.7041,   -0.6965,   0.718750,  0.250000,  0.270598,  -0.707107,
-      -0.653281, 0.2718,    -0.7041,   -0.6561,   0.687500,  0.250000,
-      0.375330,  -0.195090, -0.906127, 0.3754,    -0.1939,   -0.9063,
-      0.687500,  0.437500,  0.544895,  -0.195090, -0.815493, 0.5450,
-      -0.1939,   -0.8157,   0.656250,  0.437500,  0.513280,  -0.382683,
-      -0.768178, 0.5138,    -0.3805,   -0.7689,   0.656250,  0.375000,
-      0.146447,  0.923880,  -0.353553, 0.1484,    0.9217,    -0.3584,
-      0.687500,  0.875000,  0.212608,  0.923880,  -0.318190, 0.2155,
-      0.9217,    -0.3225,   0.656250,  0.875000,  0.308658,  0.831470,
-      -0.461940, 0.3110,    0.8286,    -0.4654,   0.656250,  0.812500,
-      0.318190,  -0.555570, -0.768178, 0.3189,    -0.5528,   -0.7699,
-      0.687500,  0.312500,  0.353553,  -0.382683, -0.853553, 0.3539,
-      -0.3805,   -0.8544,   0.687500,  0.375000,  0.513280,  -0.382683,
-      -0.768178, 0.5138,    -0.3805,   -0.7689,   0.656250,  0.375000,
-      0.212608,  0.831470,  -0.513280, 0.2142,    0.8286,    -0.5172,
-      0.687500,  0.812500,  0.308658,  0.831470,  -0.461940, 0.3110,
-      0.8286,    -0.4654,   0.656250,  0.812500,  0.392847,  0.707107,
-      -0.587938, 0.3945,    0.7041,    -0.5905,   0.656250,  0.750000,
-      0.270598,  -0.707107, -0.653281, 0.2718,    -0.7041,   -0.6561,
-      0.687500,  0.250000,  0.318190,  -0.555570, -0.768178, 0.3189,
-      -0.5528,   -0.7699,   0.687500,  0.312500,  0.461940,  -0.555570,
-      -0.691342, 0.4630,    -0.5528,   -0.6929,   0.656250,  0.312500,
-      0.270598,  0.707107,  -0.653281, 0.2718,    0.7041,    -0.6561,
-      0.687500,  0.750000,  0.392847,  0.707107,  -0.587938, 0.3945,
-      0.7041,    -0.5905,   0.656250,  0.750000,  0.461940,  0.555570,
-      -0.691342, 0.4630,    0.5528,    -0.6929,   0.656250,  0.687500,
-      0.212608,  -0.831470, -0.513280, 0.2142,    -0.8286,   -0.5172,
-      0.687500,  0.187500,  0.270598,  -0.707107, -0.653281, 0.2718,
-      -0.7041,   -0.6561,   0.687500,  0.250000,  0.392847,  -0.707107,
-      -0.587938, 0.3945,    -0.7041,   -0.5905,   0.656250,  0.250000,
-      0.318190,  0.555570,  -0.768178, 0.3189,    0.5528,    -0.7699,
-      0.687500,  0.687500,  0.461940,  0.555570,  -0.691342, 0.4630,
-      0.5528,    -0.6929,   0.656250,  0.687500,  0.513280,  0.382683,
-      -0.768178, 0.5138,    0.3805,    -0.7689,   0.656250,  0.625000,
-      0.212608,  -0.831470, -0.513280, 0.2142,    -0.8286,   -0.5172,
-      0.687500,  0.187500,  0.308658,  -0.831470, -0.461940, 0.3110,
-      -0.8286,   -0.4654,   0.656250,  0.187500,  0.212608,  -0.923880,
-      -0.318190, 0.2155,    -0.9217,   -0.3225,   0.656250,  0.125000,
-      0.353553,  0.382683,  -0.853553, 0.3539,    0.3805,    -0.8544,
-      0.687500,  0.625000,  0.513280,  0.382683,  -0.768178, 0.5138,
-      0.3805,    -0.7689,   0.656250,  0.625000,  0.544895,  0.195090,
-      -0.815493, 0.5450,    0.1939,    -0.8157,   0.656250,  0.562500,
-      0.146447,  -0.923880, -0.353553, 0.1484,    -0.9217,   -0.3584,
-      0.687500,  0.125000,  0.212608,  -0.923880, -0.318190, 0.2155,
-      -0.9217,   -0.3225,   0.656250,  0.125000,  0.108386,  -0.980785,
-      -0.162212, 0.1117,    -0.9796,   -0.1671,   0.656250,  0.062500,
-      0.375330,  0.195090,  -0.906127, 0.3754,    0.1939,    -0.9063,
-      0.687500,  0.562500,  0.544895,  0.195090,  -0.815493, 0.5450,
-      0.1939,    -0.8157,   0.656250,  0.562500,  0.555570,  0.000000,
-      -0.831469, 0.5556,    -0.0000,   -0.8315,   0.656250,  0.500000,
-      0.375330,  -0.195090, -0.906127, 0.3754,    -0.1939,   -0.9063,
-      0.687500,  0.437500,  0.382683,  0.000000,  -0.923879, 0.3827,
-      -0.0000,   -0.9239,   0.687500,  0.500000,  0.555570,  0.000000,
-      -0.831469, 0.5556,    -0.0000,   -0.8315,   0.656250,  0.500000,
-      0.074658,  0.980785,  -0.180240, 0.0769,    0.9796,    -0.1857,
-      0.687500,  0.937500,  0.108386,  0.980785,  -0.162212, 0.1117,
-      0.9796,    -0.1671,   0.656250,  0.937500,  0.212608,  0.923880,
-      -0.318190, 0.2155,    0.9217,    -0.3225,   0.656250,  0.875000,
-      0.308658,  -0.831470, -0.461940, 0.3110,    -0.8286,   -0.4654,
-      0.656250,  0.187500,  0.392847,  -0.831470, -0.392847, 0.3958,
-      -0.8286,   -0.3958,   0.625000,  0.187500,  0.270598,  -0.923880,
-      -0.270598, 0.2743,    -0.9217,   -0.2743,   0.625000,  0.125000,
-      0.544895,  0.195090,  -0.815493, 0.5450,    0.1939,    -0.8157,
-      0.656250,  0.562500,  0.513280,  0.382683,  -0.768178, 0.5138,
-      0.3805,    -0.7689,   0.656250,  0.625000,  0.653281,  0.382683,
-      -0.653281, 0.6539,    0.3805,    -0.6539,   0.625000,  0.625000,
-      0.212608,  -0.923880, -0.318190, 0.2155,    -0.9217,   -0.3225,
-      0.656250,  0.125000,  0.270598,  -0.923880, -0.270598, 0.2743,
-      -0.9217,   -0.2743,   0.625000,  0.125000,  0.137950,  -0.980785,
-      -0.137950, 0.1421,    -0.9796,   -0.1421,   0.625000,  0.062500,
-      0.555570,  0.000000,  -0.831469, 0.5556,    -0.0000,   -0.8315,
-      0.656250,  0.500000,  0.544895,  0.195090,  -0.815493, 0.5450,
-      0.1939,    -0.8157,   0.656250,  0.562500,  0.693520,  0.195090,
-      -0.693520, 0.6937,    0.1939,    -0.6937,   0.625000,  0.562500,
-      0.555570,  0.000000,  -0.831469, 0.5556,    -0.0000,   -0.8315,
-      0.656250,  0.500000,  0.707107,  0.000000,  -0.707107, 0.7071,
-      -0.0000,   -0.7071,   0.625000,  0.500000,  0.693520,  -0.195090,
-      -0.693520, 0.6937,    -0.1939,   -0.6937,   0.625000,  0.437500,
-      0.108386,  0.980785,  -0.162212, 0.1117,    0.9796,    -0.1671,
-      0.656250,  0.937500,  0.137950,  0.980785,  -0.137950, 0.1421,
-      0.9796,    -0.1421,   0.625000,  0.937500,  0.270598,  0.923880,
-      -0.270598, 0.2743,    0.9217,    -0.2743,   0.625000,  0.875000,
-      0.544895,  -0.195090, -0.815493, 0.5450,    -0.1939,   -0.8157,
-      0.656250,  0.437500,  0.693520,  -0.195090, -0.693520, 0.6937,
-      -0.1939,   -0.6937,   0.625000,  0.437500,  0.653281,  -0.382683,
-      -0.653281, 0.6539,    -0.3805,   -0.6539,   0.625000,  0.375000,
-      0.212608,  0.923880,  -0.318190, 0.2155,    0.9217,    -0.3225,
-      0.656250,  0.875000,  0.270598,  0.923880,  -0.270598, 0.2743,
-      0.9217,    -0.2743,   0.625000,  0.875000,  0.392847,  0.831470,
-      -0.392847, 0.3958,    0.8286,    -0.3958,   0.625000,  0.812500,
-      0.461940,  -0.555570, -0.691342, 0.4630,    -0.5528,   -0.6929,
-      0.656250,  0.312500,  0.513280,  -0.382683, -0.768178, 0.5138,
-      -0.3805,   -0.7689,   0.656250,  0.375000,  0.653281,  -0.382683,
-      -0.653281, 0.6539,    -0.3805,   -0.6539,   0.625000,  0.375000,
-      0.308658,  0.831470,  -0.461940, 0.3110,    0.8286,    -0.4654,
-      0.656250,  0.812500,  0.392847,  0.831470,  -0.392847, 0.3958,
-      0.8286,    -0.3958,   0.625000,  0.812500,  0.500000,  0.707107,
-      -0.500000, 0.5021,    0.7041,    -0.5021,   0.625000,  0.750000,
-      0.461940,  -0.555570, -0.691342, 0.4630,    -0.5528,   -0.6929,
-      0.656250,  0.312500,  0.587938,  -0.555570, -0.587938, 0.5893,
-      -0.5528,   -0.5893,   0.625000,  0.312500,  0.500000,  -0.707107,
-      -0.500000, 0.5021,    -0.7041,   -0.5021,   0.625000,  0.250000,
-      0.392847,  0.707107,  -0.587938, 0.3945,    0.7041,    -0.5905,
-      0.656250,  0.750000,  0.500000,  0.707107,  -0.500000, 0.5021,
-      0.7041,    -0.5021,   0.625000,  0.750000,  0.587938,  0.555570,
-      -0.587938, 0.5893,    0.5528,    -0.5893,   0.625000,  0.687500,
-      0.392847,  -0.707107, -0.587938, 0.3945,    -0.7041,   -0.5905,
-      0.656250,  0.250000,  0.500000,  -0.707107, -0.500000, 0.5021,
-      -0.7041,   -0.5021,   0.625000,  0.250000,  0.392847,  -0.831470,
-      -0.392847, 0.3958,    -0.8286,   -0.3958,   0.625000,  0.187500,
-      0.461940,  0.555570,  -0.691342, 0.4630,    0.5528,    -0.6929,
-      0.656250,  0.687500,  0.587938,  0.555570,  -0.587938, 0.5893,
-      0.5528,    -0.5893,   0.625000,  0.687500,  0.653281,  0.382683,
-      -0.653281, 0.6539,    0.3805,    -0.6539,   0.625000,  0.625000,
-      0.270598,  0.923880,  -0.270598, 0.2743,    0.9217,    -0.2743,
-      0.625000,  0.875000,  0.318190,  0.923880,  -0.212608, 0.3225,
-      0.9217,    -0.2155,   0.593750,  0.875000,  0.461940,  0.831470,
-      -0.308658, 0.4654,    0.8286,    -0.3110,   0.593750,  0.812500,
-      0.587938,  -0.555570, -0.587938, 0.5893,    -0.5528,   -0.5893,
-      0.625000,  0.312500,  0.653281,  -0.382683, -0.653281, 0.6539,
-      -0.3805,   -0.6539,   0.625000,  0.375000,  0.768178,  -0.382683,
-      -0.513280, 0.7689,    -0.3805,   -0.5138,   0.593750,  0.375000,
-      0.392847,  0.831470,  -0.392847, 0.3958,    0.8286,    -0.3958,
-      0.625000,  0.812500,  0.461940,  0.831470,  -0.308658, 0.4654,
-      0.8286,    -0.3110,   0.593750,  0.812500,  0.587938,  0.707107,
-      -0.392847, 0.5905,    0.7041,    -0.3945,   0.593750,  0.750000,
-      0.587938,  -0.555570, -0.587938, 0.5893,    -0.5528,   -0.5893,
-      0.625000,  0.312500,  0.691342,  -0.555570, -0.461940, 0.6929,
-      -0.5528,   -0.4630,   0.593750,  0.312500,  0.587938,  -0.707107,
-      -0.392847, 0.5905,    -0.7041,   -0.3945,   0.593750,  0.250000,
-      0.587938,  0.555570,  -0.587938, 0.5893,    0.5528,    -0.5893,
-      0.625000,  0.687500,  0.500000,  0.707107,  -0.500000, 0.5021,
-      0.7041,    -0.5021,   0.625000,  0.750000,  0.587938,  0.707107,
-      -0.392847, 0.5905,    0.7041,    -0.3945,   0.593750,  0.750000,
-      0.500000,  -0.707107, -0.500000, 0.5021,    -0.7041,   -0.5021,
-      0.625000,  0.250000,  0.587938,  -0.707107, -0.392847, 0.5905,
-      -0.7041,   -0.3945,   0.593750,  0.250000,  0.461940,  -0.831470,
-      -0.308658, 0.4654,    -0.8286,   -0.3110,   0.593750,  0.187500,
-      0.587938,  0.555570,  -0.587938, 0.5893,    0.5528,    -0.5893,
-      0.625000,  0.687500,  0.691342,  0.555570,  -0.461940, 0.6929,
-      0.5528,    -0.4630,   0.593750,  0.687500,  0.768178,  0.382683,
-      -0.513280, 0.7689,    0.3805,    -0.5138,   0.593750,  0.625000,
-      0.270598,  -0.923880, -0.270598, 0.2743,    -0.9217,   -0.2743,
-      0.625000,  0.125000,  0.392847,  -0.831470, -0.392847, 0.3958,
-      -0.8286,   -0.3958,   0.625000,  0.187500,  0.461940,  -0.831470,
-      -0.308658, 0.4654,    -0.8286,   -0.3110,   0.593750,  0.187500,
-      0.693520,  0.195090,  -0.693520, 0.6937,    0.1939,    -0.6937,
-      0.625000,  0.562500,  0.653281,  0.382683,  -0.653281, 0.6539,
-      0.3805,    -0.6539,   0.625000,  0.625000,  0.768178,  0.382683,
-      -0.513280, 0.7689,    0.3805,    -0.5138,   0.593750,  0.625000,
-      0.270598,  -0.923880, -0.270598, 0.2743,    -0.9217,   -0.2743,
-      0.625000,  0.125000,  0.318190,  -0.923880, -0.212608, 0.3225,
-      -0.9217,   -0.2155,   0.593750,  0.125000,  0.162212,  -0.980785,
-      -0.108386, 0.1671,    -0.9796,   -0.1117,   0.593750,  0.062500,
-      0.707107,  0.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.693520,  0.195090,  -0.693520, 0.6937,
-      0.1939,    -0.6937,   0.625000,  0.562500,  0.815493,  0.195090,
-      -0.544895, 0.8157,    0.1939,    -0.5450,   0.593750,  0.562500,
-      0.707107,  0.000000,  -0.707107, 0.7071,    -0.0000,   -0.7071,
-      0.625000,  0.500000,  0.831470,  0.000000,  -0.555570, 0.8315,
-      -0.0000,   -0.5556,   0.593750,  0.500000,  0.815493,  -0.195090,
-      -0.544895, 0.8157,    -0.1939,   -0.5450,   0.593750,  0.437500,
-      0.137950,  0.980785,  -0.137950, 0.1421,    0.9796,    -0.1421,
-      0.625000,  0.937500,  0.162212,  0.980785,  -0.108386, 0.1671,
-      0.9796,    -0.1117,   0.593750,  0.937500,  0.318190,  0.923880,
-      -0.212608, 0.3225,    0.9217,    -0.2155,   0.593750,  0.875000,
-      0.693520,  -0.195090, -0.693520, 0.6937,    -0.1939,   -0.6937,
-      0.625000,  0.437500,  0.815493,  -0.195090, -0.544895, 0.8157,
-      -0.1939,   -0.5450,   0.593750,  0.437500,  0.768178,  -0.382683,
-      -0.513280, 0.7689,    -0.3805,   -0.5138,   0.593750,  0.375000,
-      0.815493,  0.195090,  -0.544895, 0.8157,    0.1939,    -0.5450,
-      0.593750,  0.562500,  0.768178,  0.382683,  -0.513280, 0.7689,
-      0.3805,    -0.5138,   0.593750,  0.625000,  0.853553,  0.382683,
-      -0.353553, 0.8544,    0.3805,    -0.3539,   0.562500,  0.625000,
-      0.162212,  -0.980785, -0.108386, 0.1671,    -0.9796,   -0.1117,
-      0.593750,  0.062500,  0.318190,  -0.923880, -0.212608, 0.3225,
-      -0.9217,   -0.2155,   0.593750,  0.125000,  0.353553,  -0.923880,
-      -0.146447, 0.3584,    -0.9217,   -0.1484,   0.562500,  0.125000,
-      0.831470,  0.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.593750,  0.500000,  0.815493,  0.195090,  -0.544895, 0.8157,
-      0.1939,    -0.5450,   0.593750,  0.562500,  0.906127,  0.195090,
-      -0.375330, 0.9063,    0.1939,    -0.3754,   0.562500,  0.562500,
-      0.831470,  0.000000,  -0.555570, 0.8315,    -0.0000,   -0.5556,
-      0.593750,  0.500000,  0.923879,  0.000000,  -0.382683, 0.9239,
-      -0.0000,   -0.3827,   0.562500,  0.500000,  0.906127,  -0.195090,
-      -0.375330, 0.9063,    -0.1939,   -0.3754,   0.562500,  0.437500,
-      0.162212,  0.980785,  -0.108386, 0.1671,    0.9796,    -0.1117,
-      0.593750,  0.937500,  0.180240,  0.980785,  -0.074658, 0.1857,
-      0.9796,    -0.0769,   0.562500,  0.937500,  0.353553,  0.923880,
-      -0.146447, 0.3584,    0.9217,    -0.1484,   0.562500,  0.875000,
-      0.815493,  -0.195090, -0.544895, 0.8157,    -0.1939,   -0.5450,
-      0.593750,  0.437500,  0.906127,  -0.195090, -0.375330, 0.9063,
-      -0.1939,   -0.3754,   0.562500,  0.437500,  0.853553,  -0.382683,
-      -0.353553, 0.8544,    -0.3805,   -0.3539,   0.562500,  0.375000,
-      0.318190,  0.923880,  -0.212608, 0.3225,    0.9217,    -0.2155,
-      0.593750,  0.875000,  0.353553,  0.923880,  -0.146447, 0.3584,
-      0.9217,    -0.1484,   0.562500,  0.875000,  0.513280,  0.831470,
-      -0.212607, 0.5172,    0.8286,    -0.2142,   0.562500,  0.812500,
-      0.691342,  -0.555570, -0.461940, 0.6929,    -0.5528,   -0.4630,
-      0.593750,  0.312500,  0.768178,  -0.382683, -0.513280, 0.7689,
-      -0.3805,   -0.5138,   0.593750,  0.375000,  0.853553,  -0.382683,
-      -0.353553, 0.8544,    -0.3805,   -0.3539,   0.562500,  0.375000,
-      0.461940,  0.831470,  -0.308658, 0.4654,    0.8286,    -0.3110,
-      0.593750,  0.812500,  0.513280,  0.831470,  -0.212607, 0.5172,
-      0.8286,    -0.2142,   0.562500,  0.812500,  0.653281,  0.707107,
-      -0.270598, 0.6561,    0.7041,    -0.2718,   0.562500,  0.750000,
-      0.691342,  -0.555570, -0.461940, 0.6929,    -0.5528,   -0.4630,
-      0.593750,  0.312500,  0.768178,  -0.555570, -0.318190, 0.7699,
-      -0.5528,   -0.3189,   0.562500,  0.312500,  0.653281,  -0.707107,
-      -0.270598, 0.6561,    -0.7041,   -0.2718,   0.562500,  0.250000,
-      0.691342,  0.555570,  -0.461940, 0.6929,    0.5528,    -0.4630,
-      0.593750,  0.687500,  0.587938,  0.707107,  -0.392847, 0.5905,
-      0.7041,    -0.3945,   0.593750,  0.750000,  0.653281,  0.707107,
-      -0.270598, 0.6561,    0.7041,    -0.2718,   0.562500,  0.750000,
-      0.587938,  -0.707107, -0.392847, 0.5905,    -0.7041,   -0.3945,
-      0.593750,  0.250000,  0.653281,  -0.707107, -0.270598, 0.6561,
-      -0.7041,   -0.2718,   0.562500,  0.250000,  0.513280,  -0.831470,
-      -0.212607, 0.5172,    -0.8286,   -0.2142,   0.562500,  0.187500,
-      0.691342,  0.555570,  -0.461940, 0.6929,    0.5528,    -0.4630,
-      0.593750,  0.687500,  0.768178,  0.555570,  -0.318190, 0.7699,
-      0.5528,    -0.3189,   0.562500,  0.687500,  0.853553,  0.382683,
-      -0.353553, 0.8544,    0.3805,    -0.3539,   0.562500,  0.625000,
-      0.461940,  -0.831470, -0.308658, 0.4654,    -0.8286,   -0.3110,
-      0.593750,  0.187500,  0.513280,  -0.831470, -0.212607, 0.5172,
-      -0.8286,   -0.2142,   0.562500,  0.187500,  0.353553,  -0.923880,
-      -0.146447, 0.3584,    -0.9217,   -0.1484,   0.562500,  0.125000,
-      0.768178,  -0.555570, -0.318190, 0.7699,    -0.5528,   -0.3189,
-      0.562500,  0.312500,  0.853553,  -0.382683, -0.353553, 0.8544,
-      -0.3805,   -0.3539,   0.562500,  0.375000,  0.906127,  -0.382683,
-      -0.180240, 0.9070,    -0.3805,   -0.1804,   0.531250,  0.375000,
-      0.513280,  0.831470,  -0.212607, 0.5172,    0.8286,    -0.2142,
-      0.562500,  0.812500,  0.544895,  0.831470,  -0.108386, 0.5490,
-      0.8286,    -0.1092,   0.531250,  0.812500,  0.693520,  0.707107,
-      -0.137950, 0.6965,    0.7041,    -0.1385,   0.531250,  0.750000,
-      0.768178,  -0.555570, -0.318190, 0.7699,    -0.5528,   -0.3189,
-      0.562500,  0.312500,  0.815493,  -0.555570, -0.162212, 0.8173,
-      -0.5528,   -0.1626,   0.531250,  0.312500,  0.693520,  -0.707107,
-      -0.137950, 0.6965,    -0.7041,   -0.1385,   0.531250,  0.250000,
-      0.768178,  0.555570,  -0.318190, 0.7699,    0.5528,    -0.3189,
-      0.562500,  0.687500,  0.653281,  0.707107,  -0.270598, 0.6561,
-      0.7041,    -0.2718,   0.562500,  0.750000,  0.693520,  0.707107,
-      -0.137950, 0.6965,    0.7041,    -0.1385,   0.531250,  0.750000,
-      0.513280,  -0.831470, -0.212607, 0.5172,    -0.8286,   -0.2142,
-      0.562500,  0.187500,  0.653281,  -0.707107, -0.270598, 0.6561,
-      -0.7041,   -0.2718,   0.562500,  0.250000,  0.693520,  -0.707107,
-      -0.137950, 0.6965,    -0.7041,   -0.1385,   0.531250,  0.250000,
-      0.768178,  0.555570,  -0.318190, 0.7699,    0.5528,    -0.3189,
-      0.562500,  0.687500,  0.815493,  0.555570,  -0.162212, 0.8173,
-      0.5528,    -0.1626,   0.531250,  0.687500,  0.906127,  0.382683,
-      -0.180240, 0.9070,    0.3805,    -0.1804,   0.531250,  0.625000,
-      0.353553,  -0.923880, -0.146447, 0.3584,    -0.9217,   -0.1484,
-      0.562500,  0.125000,  0.513280,  -0.831470, -0.212607, 0.5172,
-      -0.8286,   -0.2142,   0.562500,  0.187500,  0.544895,  -0.831470,
-      -0.108386, 0.5490,    -0.8286,   -0.1092,   0.531250,  0.187500,
-      0.906127,  0.195090,  -0.375330, 0.9063,    0.1939,    -0.3754,
-      0.562500,  0.562500,  0.853553,  0.382683,  -0.353553, 0.8544,
-      0.3805,    -0.3539,   0.562500,  0.625000,  0.906127,  0.382683,
-      -0.180240, 0.9070,    0.3805,    -0.1804,   0.531250,  0.625000,
-      0.353553,  -0.923880, -0.146447, 0.3584,    -0.9217,   -0.1484,
-      0.562500,  0.125000,  0.375330,  -0.923880, -0.074658, 0.3804,
-      -0.9217,   -0.0757,   0.531250,  0.125000,  0.191342,  -0.980785,
-      -0.038060, 0.1971,    -0.9796,   -0.0392,   0.531250,  0.062500,
-      0.923879,  0.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  0.906127,  0.195090,  -0.375330, 0.9063,
-      0.1939,    -0.3754,   0.562500,  0.562500,  0.961940,  0.195090,
-      -0.191342, 0.9622,    0.1939,    -0.1914,   0.531250,  0.562500,
-      0.923879,  0.000000,  -0.382683, 0.9239,    -0.0000,   -0.3827,
-      0.562500,  0.500000,  0.980785,  0.000000,  -0.195090, 0.9808,
-      -0.0000,   -0.1951,   0.531250,  0.500000,  0.961940,  -0.195090,
-      -0.191342, 0.9622,    -0.1939,   -0.1914,   0.531250,  0.437500,
-      0.353553,  0.923880,  -0.146447, 0.3584,    0.9217,    -0.1484,
-      0.562500,  0.875000,  0.180240,  0.980785,  -0.074658, 0.1857,
-      0.9796,    -0.0769,   0.562500,  0.937500,  0.191342,  0.980785,
-      -0.038060, 0.1971,    0.9796,    -0.0392,   0.531250,  0.937500,
-      0.906127,  -0.195090, -0.375330, 0.9063,    -0.1939,   -0.3754,
-      0.562500,  0.437500,  0.961940,  -0.195090, -0.191342, 0.9622,
-      -0.1939,   -0.1914,   0.531250,  0.437500,  0.906127,  -0.382683,
-      -0.180240, 0.9070,    -0.3805,   -0.1804,   0.531250,  0.375000,
-      0.353553,  0.923880,  -0.146447, 0.3584,    0.9217,    -0.1484,
-      0.562500,  0.875000,  0.375330,  0.923880,  -0.074658, 0.3804,
-      0.9217,    -0.0757,   0.531250,  0.875000,  0.544895,  0.831470,
-      -0.108386, 0.5490,    0.8286,    -0.1092,   0.531250,  0.812500,
-      0.375330,  -0.923880, -0.074658, 0.3804,    -0.9217,   -0.0757,
-      0.531250,  0.125000,  0.382683,  -0.923880, 0.000000,  0.3879,
-      -0.9217,   -0.0000,   0.500000,  0.125000,  0.195090,  -0.980785,
-      0.000000,  0.2010,    -0.9796,   -0.0000,   0.500000,  0.062500,
-      0.980785,  0.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.531250,  0.500000,  0.961940,  0.195090,  -0.191342, 0.9622,
-      0.1939,    -0.1914,   0.531250,  0.562500,  0.980785,  0.195090,
-      0.000000,  0.9810,    0.1939,    -0.0000,   0.500000,  0.562500,
-      0.980785,  0.000000,  -0.195090, 0.9808,    -0.0000,   -0.1951,
-      0.531250,  0.500000,  1.000000,  0.000000,  0.000000,  1.0000,
-      -0.0000,   -0.0000,   0.500000,  0.500000,  0.980785,  -0.195090,
-      0.000000,  0.9810,    -0.1939,   -0.0000,   0.500000,  0.437500,
-      0.375330,  0.923880,  -0.074658, 0.3804,    0.9217,    -0.0757,
-      0.531250,  0.875000,  0.191342,  0.980785,  -0.038060, 0.1971,
-      0.9796,    -0.0392,   0.531250,  0.937500,  0.195090,  0.980785,
-      0.000000,  0.2010,    0.9796,    -0.0000,   0.500000,  0.937500,
-      0.961940,  -0.195090, -0.191342, 0.9622,    -0.1939,   -0.1914,
-      0.531250,  0.437500,  0.980785,  -0.195090, 0.000000,  0.9810,
-      -0.1939,   -0.0000,   0.500000,  0.437500,  0.923879,  -0.382683,
-      -0.000000, 0.9248,    -0.3805,   -0.0000,   0.500000,  0.375000,
-      0.375330,  0.923880,  -0.074658, 0.3804,    0.9217,    -0.0757,
-      0.531250,  0.875000,  0.382683,  0.923880,  0.000000,  0.3879,
-      0.9217,    -0.0000,   0.500000,  0.875000,  0.555570,  0.831470,
-      0.000000,  0.5598,    0.8286,    -0.0000,   0.500000,  0.812500,
-      0.815493,  -0.555570, -0.162212, 0.8173,    -0.5528,   -0.1626,
-      0.531250,  0.312500,  0.906127,  -0.382683, -0.180240, 0.9070,
-      -0.3805,   -0.1804,   0.531250,  0.375000,  0.923879,  -0.382683,
-      -0.000000, 0.9248,    -0.3805,   -0.0000,   0.500000,  0.375000,
-      0.544895,  0.831470,  -0.108386, 0.5490,    0.8286,    -0.1092,
-      0.531250,  0.812500,  0.555570,  0.831470,  0.000000,  0.5598,
-      0.8286,    -0.0000,   0.500000,  0.812500,  0.707107,  0.707107,
-      -0.000000, 0.7101,    0.7041,    -0.0000,   0.500000,  0.750000,
-      0.815493,  -0.555570, -0.162212, 0.8173,    -0.5528,   -0.1626,
-      0.531250,  0.312500,  0.831469,  -0.555570, 0.000000,  0.8333,
-      -0.5528,   -0.0000,   0.500000,  0.312500,  0.707107,  -0.707107,
-      -0.000000, 0.7101,    -0.7041,   -0.0000,   0.500000,  0.250000,
-      0.815493,  0.555570,  -0.162212, 0.8173,    0.5528,    -0.1626,
-      0.531250,  0.687500,  0.693520,  0.707107,  -0.137950, 0.6965,
-      0.7041,    -0.1385,   0.531250,  0.750000,  0.707107,  0.707107,
-      -0.000000, 0.7101,    0.7041,    -0.0000,   0.500000,  0.750000,
-      0.544895,  -0.831470, -0.108386, 0.5490,    -0.8286,   -0.1092,
-      0.531250,  0.187500,  0.693520,  -0.707107, -0.137950, 0.6965,
-      -0.7041,   -0.1385,   0.531250,  0.250000,  0.707107,  -0.707107,
-      -0.000000, 0.7101,    -0.7041,   -0.0000,   0.500000,  0.250000,
-      0.815493,  0.555570,  -0.162212, 0.8173,    0.5528,    -0.1626,
-      0.531250,  0.687500,  0.831469,  0.555570,  0.000000,  0.8333,
-      0.5528,    -0.0000,   0.500000,  0.687500,  0.923879,  0.382683,
-      -0.000000, 0.9248,    0.3805,    -0.0000,   0.500000,  0.625000,
-      0.544895,  -0.831470, -0.108386, 0.5490,    -0.8286,   -0.1092,
-      0.531250,  0.187500,  0.555570,  -0.831470, 0.000000,  0.5598,
-      -0.8286,   -0.0000,   0.500000,  0.187500,  0.382683,  -0.923880,
-      0.000000,  0.3879,    -0.9217,   -0.0000,   0.500000,  0.125000,
-      0.961940,  0.195090,  -0.191342, 0.9622,    0.1939,    -0.1914,
-      0.531250,  0.562500,  0.906127,  0.382683,  -0.180240, 0.9070,
-      0.3805,    -0.1804,   0.531250,  0.625000,  0.923879,  0.382683,
-      -0.000000, 0.9248,    0.3805,    -0.0000,   0.500000,  0.625000,
-      0.831469,  -0.555570, 0.000000,  0.8333,    -0.5528,   -0.0000,
-      0.500000,  0.312500,  0.815493,  -0.555570, 0.162212,  0.8173,
-      -0.5528,   0.1626,    0.468750,  0.312500,  0.693520,  -0.707107,
-      0.137950,  0.6965,    -0.7041,   0.1385,    0.468750,  0.250000,
-      0.831469,  0.555570,  0.000000,  0.8333,    0.5528,    -0.0000,
-      0.500000,  0.687500,  0.707107,  0.707107,  -0.000000, 0.7101,
-      0.7041,    -0.0000,   0.500000,  0.750000,  0.693520,  0.707107,
-      0.137950,  0.6965,    0.7041,    0.1385,    0.468750,  0.750000,
-      0.555570,  -0.831470, 0.000000,  0.5598,    -0.8286,   -0.0000,
-      0.500000,  0.187500,  0.707107,  -0.707107, -0.000000, 0.7101,
-      -0.7041,   -0.0000,   0.500000,  0.250000,  0.693520,  -0.707107,
-      0.137950,  0.6965,    -0.7041,   0.1385,    0.468750,  0.250000,
-      0.831469,  0.555570,  0.000000,  0.8333,    0.5528,    -0.0000,
-      0.500000,  0.687500,  0.815493,  0.555570,  0.162212,  0.8173,
-      0.5528,    0.1626,    0.468750,  0.687500,  0.906127,  0.382683,
-      0.180240,  0.9070,    0.3805,    0.1804,    0.468750,  0.625000,
-      0.555570,  -0.831470, 0.000000,  0.5598,    -0.8286,   -0.0000,
-      0.500000,  0.187500,  0.544895,  -0.831470, 0.108386,  0.5490,
-      -0.8286,   0.1092,    0.468750,  0.187500,  0.375330,  -0.923880,
-      0.074658,  0.3804,    -0.9217,   0.0757,    0.468750,  0.125000,
-      0.980785,  0.195090,  0.000000,  0.9810,    0.1939,    -0.0000,
-      0.500000,  0.562500,  0.923879,  0.382683,  -0.000000, 0.9248,
-      0.3805,    -0.0000,   0.500000,  0.625000,  0.906127,  0.382683,
-      0.180240,  0.9070,    0.3805,    0.1804,    0.468750,  0.625000,
-      0.382683,  -0.923880, 0.000000,  0.3879,    -0.9217,   -0.0000,
-      0.500000,  0.125000,  0.375330,  -0.923880, 0.074658,  0.3804,
-      -0.9217,   0.0757,    0.468750,  0.125000,  0.191342,  -0.980785,
-      0.038060,  0.1971,    -0.9796,   0.0392,    0.468750,  0.062500,
-      1.000000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  0.980785,  0.195090,  0.000000,  0.9810,
-      0.1939,    -0.0000,   0.500000,  0.562500,  0.961940,  0.195090,
-      0.191342,  0.9622,    0.1939,    0.1914,    0.468750,  0.562500,
-      1.000000,  0.000000,  0.000000,  1.0000,    -0.0000,   -0.0000,
-      0.500000,  0.500000,  0.980785,  0.000000,  0.195090,  0.9808,
-      -0.0000,   0.1951,    0.468750,  0.500000,  0.961940,  -0.195090,
-      0.191342,  0.9622,    -0.1939,   0.1914,    0.468750,  0.437500,
-      0.195090,  0.980785,  0.000000,  0.2010,    0.9796,    -0.0000,
-      0.500000,  0.937500,  0.191342,  0.980785,  0.038060,  0.1971,
-      0.9796,    0.0392,    0.468750,  0.937500,  0.375330,  0.923880,
-      0.074658,  0.3804,    0.9217,    0.0757,    0.468750,  0.875000,
-      0.980785,  -0.195090, 0.000000,  0.9810,    -0.1939,   -0.0000,
-      0.500000,  0.437500,  0.961940,  -0.195090, 0.191342,  0.9622,
-      -0.1939,   0.1914,    0.468750,  0.437500,  0.906127,  -0.382683,
-      0.180240,  0.9070,    -0.3805,   0.1804,    0.468750,  0.375000,
-      0.382683,  0.923880,  0.000000,  0.3879,    0.9217,    -0.0000,
-      0.500000,  0.875000,  0.375330,  0.923880,  0.074658,  0.3804,
-      0.9217,    0.0757,    0.468750,  0.875000,  0.544895,  0.831470,
-      0.108386,  0.5490,    0.8286,    0.1092,    0.468750,  0.812500,
-      0.831469,  -0.555570, 0.000000,  0.8333,    -0.5528,   -0.0000,
-      0.500000,  0.312500,  0.923879,  -0.382683, -0.000000, 0.9248,
-      -0.3805,   -0.0000,   0.500000,  0.375000,  0.906127,  -0.382683,
-      0.180240,  0.9070,    -0.3805,   0.1804,    0.468750,  0.375000,
-      0.555570,  0.831470,  0.000000,  0.5598,    0.8286,    -0.0000,
-      0.500000,  0.812500,  0.544895,  0.831470,  0.108386,  0.5490,
-      0.8286,    0.1092,    0.468750,  0.812500,  0.693520,  0.707107,
-      0.137950,  0.6965,    0.7041,    0.1385,    0.468750,  0.750000,
-      0.980785,  0.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.468750,  0.500000,  0.923879,  0.000000,  0.382683,  0.9239,
-      -0.0000,   0.3827,    0.437500,  0.500000,  0.906127,  -0.195090,
-      0.375330,  0.9063,    -0.1939,   0.3754,    0.437500,  0.437500,
-      0.191342,  0.980785,  0.038060,  0.1971,    0.9796,    0.0392,
-      0.468750,  0.937500,  0.180240,  0.980785,  0.074658,  0.1857,
-      0.9796,    0.0769,    0.437500,  0.937500,  0.353553,  0.923880,
-      0.146447,  0.3584,    0.9217,    0.1484,    0.437500,  0.875000,
-      0.961940,  -0.195090, 0.191342,  0.9622,    -0.1939,   0.1914,
-      0.468750,  0.437500,  0.906127,  -0.195090, 0.375330,  0.9063,
-      -0.1939,   0.3754,    0.437500,  0.437500,  0.853553,  -0.382683,
-      0.353553,  0.8544,    -0.3805,   0.3539,    0.437500,  0.375000,
-      0.544895,  0.831470,  0.108386,  0.5490,    0.8286,    0.1092,
-      0.468750,  0.812500,  0.375330,  0.923880,  0.074658,  0.3804,
-      0.9217,    0.0757,    0.468750,  0.875000,  0.353553,  0.923880,
-      0.146447,  0.3584,    0.9217,    0.1484,    0.437500,  0.875000,
-      0.815493,  -0.555570, 0.162212,  0.8173,    -0.5528,   0.1626,
-      0.468750,  0.312500,  0.906127,  -0.382683, 0.180240,  0.9070,
-      -0.3805,   0.1804,    0.468750,  0.375000,  0.853553,  -0.382683,
-      0.353553,  0.8544,    -0.3805,   0.3539,    0.437500,  0.375000,
-      0.544895,  0.831470,  0.108386,  0.5490,    0.8286,    0.1092,
-      0.468750,  0.812500,  0.513280,  0.831470,  0.212608,  0.5172,
-      0.8286,    0.2142,    0.437500,  0.812500,  0.653281,  0.707107,
-      0.270598,  0.6561,    0.7041,    0.2718,    0.437500,  0.750000,
-      0.815493,  -0.555570, 0.162212,  0.8173,    -0.5528,   0.1626,
-      0.468750,  0.312500,  0.768178,  -0.555570, 0.318190,  0.7699,
-      -0.5528,   0.3189,    0.437500,  0.312500,  0.653281,  -0.707107,
-      0.270598,  0.6561,    -0.7041,   0.2718,    0.437500,  0.250000,
-      0.815493,  0.555570,  0.162212,  0.8173,    0.5528,    0.1626,
-      0.468750,  0.687500,  0.693520,  0.707107,  0.137950,  0.6965,
-      0.7041,    0.1385,    0.468750,  0.750000,  0.653281,  0.707107,
-      0.270598,  0.6561,    0.7041,    0.2718,    0.437500,  0.750000,
-      0.544895,  -0.831470, 0.108386,  0.5490,    -0.8286,   0.1092,
-      0.468750,  0.187500,  0.693520,  -0.707107, 0.137950,  0.6965,
-      -0.7041,   0.1385,    0.468750,  0.250000,  0.653281,  -0.707107,
-      0.270598,  0.6561,    -0.7041,   0.2718,    0.437500,  0.250000,
-      0.815493,  0.555570,  0.162212,  0.8173,    0.5528,    0.1626,
-      0.468750,  0.687500,  0.768178,  0.555570,  0.318190,  0.7699,
-      0.5528,    0.3189,    0.437500,  0.687500,  0.853553,  0.382683,
-      0.353553,  0.8544,    0.3805,    0.3539,    0.437500,  0.625000,
-      0.544895,  -0.831470, 0.108386,  0.5490,    -0.8286,   0.1092,
-      0.468750,  0.187500,  0.513280,  -0.831470, 0.212608,  0.5172,
-      -0.8286,   0.2142,    0.437500,  0.187500,  0.353553,  -0.923880,
-      0.146447,  0.3584,    -0.9217,   0.1484,    0.437500,  0.125000,
-      0.961940,  0.195090,  0.191342,  0.9622,    0.1939,    0.1914,
-      0.468750,  0.562500,  0.906127,  0.382683,  0.180240,  0.9070,
-      0.3805,    0.1804,    0.468750,  0.625000,  0.853553,  0.382683,
-      0.353553,  0.8544,    0.3805,    0.3539,    0.437500,  0.625000,
-      0.191342,  -0.980785, 0.038060,  0.1971,    -0.9796,   0.0392,
-      0.468750,  0.062500,  0.375330,  -0.923880, 0.074658,  0.3804,
-      -0.9217,   0.0757,    0.468750,  0.125000,  0.353553,  -0.923880,
-      0.146447,  0.3584,    -0.9217,   0.1484,    0.437500,  0.125000,
-      0.980785,  0.000000,  0.195090,  0.9808,    -0.0000,   0.1951,
-      0.468750,  0.500000,  0.961940,  0.195090,  0.191342,  0.9622,
-      0.1939,    0.1914,    0.468750,  0.562500,  0.906127,  0.195090,
-      0.375330,  0.9063,    0.1939,    0.3754,    0.437500,  0.562500,
-      0.768178,  0.555570,  0.318190,  0.7699,    0.5528,    0.3189,
-      0.437500,  0.687500,  0.653281,  0.707107,  0.270598,  0.6561,
-      0.7041,    0.2718,    0.437500,  0.750000,  0.587938,  0.707107,
-      0.392847,  0.5905,    0.7041,    0.3945,    0.406250,  0.750000,
-      0.513280,  -0.831470, 0.212608,  0.5172,    -0.8286,   0.2142,
-      0.437500,  0.187500,  0.653281,  -0.707107, 0.270598,  0.6561,
-      -0.7041,   0.2718,    0.437500,  0.250000,  0.587938,  -0.707107,
-      0.392847,  0.5905,    -0.7041,   0.3945,    0.406250,  0.250000,
-      0.768178,  0.555570,  0.318190,  0.7699,    0.5528,    0.3189,
-      0.437500,  0.687500,  0.691341,  0.555570,  0.461940,  0.6929,
-      0.5528,    0.4630,    0.406250,  0.687500,  0.768178,  0.382683,
-      0.513280,  0.7689,    0.3805,    0.5138,    0.406250,  0.625000,
-      0.513280,  -0.831470, 0.212608,  0.5172,    -0.8286,   0.2142,
-      0.437500,  0.187500,  0.461940,  -0.831470, 0.308658,  0.4654,
-      -0.8286,   0.3110,    0.406250,  0.187500,  0.318190,  -0.923880,
-      0.212608,  0.3225,    -0.9217,   0.2155,    0.406250,  0.125000,
-      0.906127,  0.195090,  0.375330,  0.9063,    0.1939,    0.3754,
-      0.437500,  0.562500,  0.853553,  0.382683,  0.353553,  0.8544,
-      0.3805,    0.3539,    0.437500,  0.625000,  0.768178,  0.382683,
-      0.513280,  0.7689,    0.3805,    0.5138,    0.406250,  0.625000,
-      0.353553,  -0.923880, 0.146447,  0.3584,    -0.9217,   0.1484,
-      0.437500,  0.125000,  0.318190,  -0.923880, 0.212608,  0.3225,
-      -0.9217,   0.2155,    0.406250,  0.125000,  0.162212,  -0.980785,
-      0.108386,  0.1671,    -0.9796,   0.1117,    0.406250,  0.062500,
-      0.923879,  0.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  0.906127,  0.195090,  0.375330,  0.9063,
-      0.1939,    0.3754,    0.437500,  0.562500,  0.815493,  0.195090,
-      0.544895,  0.8157,    0.1939,    0.5450,    0.406250,  0.562500,
-      0.923879,  0.000000,  0.382683,  0.9239,    -0.0000,   0.3827,
-      0.437500,  0.500000,  0.831469,  0.000000,  0.555570,  0.8315,
-      -0.0000,   0.5556,    0.406250,  0.500000,  0.815493,  -0.195090,
-      0.544895,  0.8157,    -0.1939,   0.5450,    0.406250,  0.437500,
-      0.180240,  0.980785,  0.074658,  0.1857,    0.9796,    0.0769,
-      0.437500,  0.937500,  0.162212,  0.980785,  0.108386,  0.1671,
-      0.9796,    0.1117,    0.406250,  0.937500,  0.318190,  0.923880,
-      0.212608,  0.3225,    0.9217,    0.2155,    0.406250,  0.875000,
-      0.906127,  -0.195090, 0.375330,  0.9063,    -0.1939,   0.3754,
-      0.437500,  0.437500,  0.815493,  -0.195090, 0.544895,  0.8157,
-      -0.1939,   0.5450,    0.406250,  0.437500,  0.768178,  -0.382683,
-      0.513280,  0.7689,    -0.3805,   0.5138,    0.406250,  0.375000,
-      0.513280,  0.831470,  0.212608,  0.5172,    0.8286,    0.2142,
-      0.437500,  0.812500,  0.353553,  0.923880,  0.146447,  0.3584,
-      0.9217,    0.1484,    0.437500,  0.875000,  0.318190,  0.923880,
-      0.212608,  0.3225,    0.9217,    0.2155,    0.406250,  0.875000,
-      0.768178,  -0.555570, 0.318190,  0.7699,    -0.5528,   0.3189,
-      0.437500,  0.312500,  0.853553,  -0.382683, 0.353553,  0.8544,
-      -0.3805,   0.3539,    0.437500,  0.375000,  0.768178,  -0.382683,
-      0.513280,  0.7689,    -0.3805,   0.5138,    0.406250,  0.375000,
-      0.513280,  0.831470,  0.212608,  0.5172,    0.8286,    0.2142,
-      0.437500,  0.812500,  0.461940,  0.831470,  0.308658,  0.4654,
-      0.8286,    0.3110,    0.406250,  0.812500,  0.587938,  0.707107,
-      0.392847,  0.5905,    0.7041,    0.3945,    0.406250,  0.750000,
-      0.768178,  -0.555570, 0.318190,  0.7699,    -0.5528,   0.3189,
-      0.437500,  0.312500,  0.691341,  -0.555570, 0.461940,  0.6929,
-      -0.5528,   0.4630,    0.406250,  0.312500,  0.587938,  -0.707107,
-      0.392847,  0.5905,    -0.7041,   0.3945,    0.406250,  0.250000,
-      0.831469,  0.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.406250,  0.500000,  0.707106,  0.000000,  0.707107,  0.7071,
-      -0.0000,   0.7071,    0.375000,  0.500000,  0.693520,  -0.195090,
-      0.693520,  0.6937,    -0.1939,   0.6937,    0.375000,  0.437500,
-      0.162212,  0.980785,  0.108386,  0.1671,    0.9796,    0.1117,
-      0.406250,  0.937500,  0.137950,  0.980785,  0.137950,  0.1421,
-      0.9796,    0.1421,    0.375000,  0.937500,  0.270598,  0.923880,
-      0.270598,  0.2743,    0.9217,    0.2743,    0.375000,  0.875000,
-      0.815493,  -0.195090, 0.544895,  0.8157,    -0.1939,   0.5450,
-      0.406250,  0.437500,  0.693520,  -0.195090, 0.693520,  0.6937,
-      -0.1939,   0.6937,    0.375000,  0.437500,  0.653281,  -0.382683,
-      0.653281,  0.6539,    -0.3805,   0.6539,    0.375000,  0.375000,
-      0.318190,  0.923880,  0.212608,  0.3225,    0.9217,    0.2155,
-      0.406250,  0.875000,  0.270598,  0.923880,  0.270598,  0.2743,
-      0.9217,    0.2743,    0.375000,  0.875000,  0.392847,  0.831470,
-      0.392847,  0.3958,    0.8286,    0.3958,    0.375000,  0.812500,
-      0.691341,  -0.555570, 0.461940,  0.6929,    -0.5528,   0.4630,
-      0.406250,  0.312500,  0.768178,  -0.382683, 0.513280,  0.7689,
-      -0.3805,   0.5138,    0.406250,  0.375000,  0.653281,  -0.382683,
-      0.653281,  0.6539,    -0.3805,   0.6539,    0.375000,  0.375000,
-      0.461940,  0.831470,  0.308658,  0.4654,    0.8286,    0.3110,
-      0.406250,  0.812500,  0.392847,  0.831470,  0.392847,  0.3958,
-      0.8286,    0.3958,    0.375000,  0.812500,  0.500000,  0.707107,
-      0.500000,  0.5021,    0.7041,    0.5021,    0.375000,  0.750000,
-      0.691341,  -0.555570, 0.461940,  0.6929,    -0.5528,   0.4630,
-      0.406250,  0.312500,  0.587938,  -0.555570, 0.587938,  0.5893,
-      -0.5528,   0.5893,    0.375000,  0.312500,  0.500000,  -0.707107,
-      0.500000,  0.5021,    -0.7041,   0.5021,    0.375000,  0.250000,
-      0.691341,  0.555570,  0.461940,  0.6929,    0.5528,    0.4630,
-      0.406250,  0.687500,  0.587938,  0.707107,  0.392847,  0.5905,
-      0.7041,    0.3945,    0.406250,  0.750000,  0.500000,  0.707107,
-      0.500000,  0.5021,    0.7041,    0.5021,    0.375000,  0.750000,
-      0.587938,  -0.707107, 0.392847,  0.5905,    -0.7041,   0.3945,
-      0.406250,  0.250000,  0.500000,  -0.707107, 0.500000,  0.5021,
-      -0.7041,   0.5021,    0.375000,  0.250000,  0.392847,  -0.831470,
-      0.392847,  0.3958,    -0.8286,   0.3958,    0.375000,  0.187500,
-      0.691341,  0.555570,  0.461940,  0.6929,    0.5528,    0.4630,
-      0.406250,  0.687500,  0.587938,  0.555570,  0.587938,  0.5893,
-      0.5528,    0.5893,    0.375000,  0.687500,  0.653281,  0.382683,
-      0.653281,  0.6539,    0.3805,    0.6539,    0.375000,  0.625000,
-      0.318190,  -0.923880, 0.212608,  0.3225,    -0.9217,   0.2155,
-      0.406250,  0.125000,  0.461940,  -0.831470, 0.308658,  0.4654,
-      -0.8286,   0.3110,    0.406250,  0.187500,  0.392847,  -0.831470,
-      0.392847,  0.3958,    -0.8286,   0.3958,    0.375000,  0.187500,
-      0.815493,  0.195090,  0.544895,  0.8157,    0.1939,    0.5450,
-      0.406250,  0.562500,  0.768178,  0.382683,  0.513280,  0.7689,
-      0.3805,    0.5138,    0.406250,  0.625000,  0.653281,  0.382683,
-      0.653281,  0.6539,    0.3805,    0.6539,    0.375000,  0.625000,
-      0.162212,  -0.980785, 0.108386,  0.1671,    -0.9796,   0.1117,
-      0.406250,  0.062500,  0.318190,  -0.923880, 0.212608,  0.3225,
-      -0.9217,   0.2155,    0.406250,  0.125000,  0.270598,  -0.923880,
-      0.270598,  0.2743,    -0.9217,   0.2743,    0.375000,  0.125000,
-      0.831469,  0.000000,  0.555570,  0.8315,    -0.0000,   0.5556,
-      0.406250,  0.500000,  0.815493,  0.195090,  0.544895,  0.8157,
-      0.1939,    0.5450,    0.406250,  0.562500,  0.693520,  0.195090,
-      0.693520,  0.6937,    0.1939,    0.6937,    0.375000,  0.562500,
-      0.392847,  -0.831470, 0.392847,  0.3958,    -0.8286,   0.3958,
-      0.375000,  0.187500,  0.500000,  -0.707107, 0.500000,  0.5021,
-      -0.7041,   0.5021,    0.375000,  0.250000,  0.392847,  -0.707107,
-      0.587938,  0.3945,    -0.7041,   0.5905,    0.343750,  0.250000,
-      0.587938,  0.555570,  0.587938,  0.5893,    0.5528,    0.5893,
-      0.375000,  0.687500,  0.461940,  0.555570,  0.691342,  0.4630,
-      0.5528,    0.6929,    0.343750,  0.687500,  0.513280,  0.382683,
-      0.768178,  0.5138,    0.3805,    0.7689,    0.343750,  0.625000,
-      0.392847,  -0.831470, 0.392847,  0.3958,    -0.8286,   0.3958,
-      0.375000,  0.187500,  0.308658,  -0.831470, 0.461940,  0.3110,
-      -0.8286,   0.4654,    0.343750,  0.187500,  0.212607,  -0.923880,
-      0.318190,  0.2155,    -0.9217,   0.3225,    0.343750,  0.125000,
-      0.693520,  0.195090,  0.693520,  0.6937,    0.1939,    0.6937,
-      0.375000,  0.562500,  0.653281,  0.382683,  0.653281,  0.6539,
-      0.3805,    0.6539,    0.375000,  0.625000,  0.513280,  0.382683,
-      0.768178,  0.5138,    0.3805,    0.7689,    0.343750,  0.625000,
-      0.270598,  -0.923880, 0.270598,  0.2743,    -0.9217,   0.2743,
-      0.375000,  0.125000,  0.212607,  -0.923880, 0.318190,  0.2155,
-      -0.9217,   0.3225,    0.343750,  0.125000,  0.108386,  -0.980785,
-      0.162212,  0.1117,    -0.9796,   0.1671,    0.343750,  0.062500,
-      0.707106,  0.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.693520,  0.195090,  0.693520,  0.6937,
-      0.1939,    0.6937,    0.375000,  0.562500,  0.544895,  0.195090,
-      0.815493,  0.5450,    0.1939,    0.8157,    0.343750,  0.562500,
-      0.707106,  0.000000,  0.707107,  0.7071,    -0.0000,   0.7071,
-      0.375000,  0.500000,  0.555570,  0.000000,  0.831469,  0.5556,
-      -0.0000,   0.8315,    0.343750,  0.500000,  0.544895,  -0.195090,
-      0.815493,  0.5450,    -0.1939,   0.8157,    0.343750,  0.437500,
-      0.270598,  0.923880,  0.270598,  0.2743,    0.9217,    0.2743,
-      0.375000,  0.875000,  0.137950,  0.980785,  0.137950,  0.1421,
-      0.9796,    0.1421,    0.375000,  0.937500,  0.108386,  0.980785,
-      0.162212,  0.1117,    0.9796,    0.1671,    0.343750,  0.937500,
-      0.693520,  -0.195090, 0.693520,  0.6937,    -0.1939,   0.6937,
-      0.375000,  0.437500,  0.544895,  -0.195090, 0.815493,  0.5450,
-      -0.1939,   0.8157,    0.343750,  0.437500,  0.513280,  -0.382683,
-      0.768178,  0.5138,    -0.3805,   0.7689,    0.343750,  0.375000,
-      0.392847,  0.831470,  0.392847,  0.3958,    0.8286,    0.3958,
-      0.375000,  0.812500,  0.270598,  0.923880,  0.270598,  0.2743,
-      0.9217,    0.2743,    0.375000,  0.875000,  0.212607,  0.923880,
-      0.318190,  0.2155,    0.9217,    0.3225,    0.343750,  0.875000,
-      0.587938,  -0.555570, 0.587938,  0.5893,    -0.5528,   0.5893,
-      0.375000,  0.312500,  0.653281,  -0.382683, 0.653281,  0.6539,
-      -0.3805,   0.6539,    0.375000,  0.375000,  0.513280,  -0.382683,
-      0.768178,  0.5138,    -0.3805,   0.7689,    0.343750,  0.375000,
-      0.392847,  0.831470,  0.392847,  0.3958,    0.8286,    0.3958,
-      0.375000,  0.812500,  0.308658,  0.831470,  0.461940,  0.3110,
-      0.8286,    0.4654,    0.343750,  0.812500,  0.392847,  0.707107,
-      0.587938,  0.3945,    0.7041,    0.5905,    0.343750,  0.750000,
-      0.587938,  -0.555570, 0.587938,  0.5893,    -0.5528,   0.5893,
-      0.375000,  0.312500,  0.461940,  -0.555570, 0.691342,  0.4630,
-      -0.5528,   0.6929,    0.343750,  0.312500,  0.392847,  -0.707107,
-      0.587938,  0.3945,    -0.7041,   0.5905,    0.343750,  0.250000,
-      0.587938,  0.555570,  0.587938,  0.5893,    0.5528,    0.5893,
-      0.375000,  0.687500,  0.500000,  0.707107,  0.500000,  0.5021,
-      0.7041,    0.5021,    0.375000,  0.750000,  0.392847,  0.707107,
-      0.587938,  0.3945,    0.7041,    0.5905,    0.343750,  0.750000,
-      0.108386,  0.980785,  0.162212,  0.1117,    0.9796,    0.1671,
-      0.343750,  0.937500,  0.074658,  0.980785,  0.180240,  0.0769,
-      0.9796,    0.1857,    0.312500,  0.937500,  0.146447,  0.923880,
-      0.353553,  0.1484,    0.9217,    0.3584,    0.312500,  0.875000,
-      0.544895,  -0.195090, 0.815493,  0.5450,    -0.1939,   0.8157,
-      0.343750,  0.437500,  0.375330,  -0.195090, 0.906127,  0.3754,
-      -0.1939,   0.9063,    0.312500,  0.437500,  0.353553,  -0.382683,
-      0.853553,  0.3539,    -0.3805,   0.8544,    0.312500,  0.375000,
-      0.212607,  0.923880,  0.318190,  0.2155,    0.9217,    0.3225,
-      0.343750,  0.875000,  0.146447,  0.923880,  0.353553,  0.1484,
-      0.9217,    0.3584,    0.312500,  0.875000,  0.212607,  0.831470,
-      0.513280,  0.2142,    0.8286,    0.5172,    0.312500,  0.812500,
-      0.461940,  -0.555570, 0.691342,  0.4630,    -0.5528,   0.6929,
-      0.343750,  0.312500,  0.513280,  -0.382683, 0.768178,  0.5138,
-      -0.3805,   0.7689,    0.343750,  0.375000,  0.353553,  -0.382683,
-      0.853553,  0.3539,    -0.3805,   0.8544,    0.312500,  0.375000,
-      0.308658,  0.831470,  0.461940,  0.3110,    0.8286,    0.4654,
-      0.343750,  0.812500,  0.212607,  0.831470,  0.513280,  0.2142,
-      0.8286,    0.5172,    0.312500,  0.812500,  0.270598,  0.707107,
-      0.653281,  0.2718,    0.7041,    0.6561,    0.312500,  0.750000,
-      0.461940,  -0.555570, 0.691342,  0.4630,    -0.5528,   0.6929,
-      0.343750,  0.312500,  0.318189,  -0.555570, 0.768178,  0.3189,
-      -0.5528,   0.7699,    0.312500,  0.312500,  0.270598,  -0.707107,
-      0.653281,  0.2718,    -0.7041,   0.6561,    0.312500,  0.250000,
-      0.461940,  0.555570,  0.691342,  0.4630,    0.5528,    0.6929,
-      0.343750,  0.687500,  0.392847,  0.707107,  0.587938,  0.3945,
-      0.7041,    0.5905,    0.343750,  0.750000,  0.270598,  0.707107,
-      0.653281,  0.2718,    0.7041,    0.6561,    0.312500,  0.750000,
-      0.308658,  -0.831470, 0.461940,  0.3110,    -0.8286,   0.4654,
-      0.343750,  0.187500,  0.392847,  -0.707107, 0.587938,  0.3945,
-      -0.7041,   0.5905,    0.343750,  0.250000,  0.270598,  -0.707107,
-      0.653281,  0.2718,    -0.7041,   0.6561,    0.312500,  0.250000,
-      0.461940,  0.555570,  0.691342,  0.4630,    0.5528,    0.6929,
-      0.343750,  0.687500,  0.318189,  0.555570,  0.768178,  0.3189,
-      0.5528,    0.7699,    0.312500,  0.687500,  0.353553,  0.382683,
-      0.853553,  0.3539,    0.3805,    0.8544,    0.312500,  0.625000,
-      0.308658,  -0.831470, 0.461940,  0.3110,    -0.8286,   0.4654,
-      0.343750,  0.187500,  0.212607,  -0.831470, 0.513280,  0.2142,
-      -0.8286,   0.5172,    0.312500,  0.187500,  0.146447,  -0.923880,
-      0.353553,  0.1484,    -0.9217,   0.3584,    0.312500,  0.125000,
-      0.544895,  0.195090,  0.815493,  0.5450,    0.1939,    0.8157,
-      0.343750,  0.562500,  0.513280,  0.382683,  0.768178,  0.5138,
-      0.3805,    0.7689,    0.343750,  0.625000,  0.353553,  0.382683,
-      0.853553,  0.3539,    0.3805,    0.8544,    0.312500,  0.625000,
-      0.212607,  -0.923880, 0.318190,  0.2155,    -0.9217,   0.3225,
-      0.343750,  0.125000,  0.146447,  -0.923880, 0.353553,  0.1484,
-      -0.9217,   0.3584,    0.312500,  0.125000,  0.074658,  -0.980785,
-      0.180240,  0.0769,    -0.9796,   0.1857,    0.312500,  0.062500,
-      0.555570,  0.000000,  0.831469,  0.5556,    -0.0000,   0.8315,
-      0.343750,  0.500000,  0.544895,  0.195090,  0.815493,  0.5450,
-      0.1939,    0.8157,    0.343750,  0.562500,  0.375330,  0.195090,
-      0.906127,  0.3754,    0.1939,    0.9063,    0.312500,  0.562500,
-      0.555570,  0.000000,  0.831469,  0.5556,    -0.0000,   0.8315,
-      0.343750,  0.500000,  0.382683,  0.000000,  0.923879,  0.3827,
-      -0.0000,   0.9239,    0.312500,  0.500000,  0.375330,  -0.195090,
-      0.906127,  0.3754,    -0.1939,   0.9063,    0.312500,  0.437500,
-      0.318189,  0.555570,  0.768178,  0.3189,    0.5528,    0.7699,
-      0.312500,  0.687500,  0.162212,  0.555570,  0.815493,  0.1626,
-      0.5528,    0.8173,    0.281250,  0.687500,  0.180240,  0.382683,
-      0.906127,  0.1804,    0.3805,    0.9070,    0.281250,  0.625000,
-      0.212607,  -0.831470, 0.513280,  0.2142,    -0.8286,   0.5172,
-      0.312500,  0.187500,  0.108386,  -0.831470, 0.544895,  0.1092,
-      -0.8286,   0.5490,    0.281250,  0.187500,  0.074658,  -0.923880,
-      0.375330,  0.0757,    -0.9217,   0.3804,    0.281250,  0.125000,
-      0.375330,  0.195090,  0.906127,  0.3754,    0.1939,    0.9063,
-      0.312500,  0.562500,  0.353553,  0.382683,  0.853553,  0.3539,
-      0.3805,    0.8544,    0.312500,  0.625000,  0.180240,  0.382683,
-      0.906127,  0.1804,    0.3805,    0.9070,    0.281250,  0.625000,
-      0.146447,  -0.923880, 0.353553,  0.1484,    -0.9217,   0.3584,
-      0.312500,  0.125000,  0.074658,  -0.923880, 0.375330,  0.0757,
-      -0.9217,   0.3804,    0.281250,  0.125000,  0.038060,  -0.980785,
-      0.191342,  0.0392,    -0.9796,   0.1971,    0.281250,  0.062500,
-      0.382683,  0.000000,  0.923879,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.375330,  0.195090,  0.906127,  0.3754,
-      0.1939,    0.9063,    0.312500,  0.562500,  0.191342,  0.195090,
-      0.961939,  0.1914,    0.1939,    0.9622,    0.281250,  0.562500,
-      0.382683,  0.000000,  0.923879,  0.3827,    -0.0000,   0.9239,
-      0.312500,  0.500000,  0.195090,  0.000000,  0.980785,  0.1951,
-      -0.0000,   0.9808,    0.281250,  0.500000,  0.191342,  -0.195090,
-      0.961939,  0.1914,    -0.1939,   0.9622,    0.281250,  0.437500,
-      0.074658,  0.980785,  0.180240,  0.0769,    0.9796,    0.1857,
-      0.312500,  0.937500,  0.038060,  0.980785,  0.191342,  0.0392,
-      0.9796,    0.1971,    0.281250,  0.937500,  0.074658,  0.923880,
-      0.375330,  0.0757,    0.9217,    0.3804,    0.281250,  0.875000,
-      0.375330,  -0.195090, 0.906127,  0.3754,    -0.1939,   0.9063,
-      0.312500,  0.437500,  0.191342,  -0.195090, 0.961939,  0.1914,
-      -0.1939,   0.9622,    0.281250,  0.437500,  0.180240,  -0.382683,
-      0.906127,  0.1804,    -0.3805,   0.9070,    0.281250,  0.375000,
-      0.146447,  0.923880,  0.353553,  0.1484,    0.9217,    0.3584,
-      0.312500,  0.875000,  0.074658,  0.923880,  0.375330,  0.0757,
-      0.9217,    0.3804,    0.281250,  0.875000,  0.108386,  0.831470,
-      0.544895,  0.1092,    0.8286,    0.5490,    0.281250,  0.812500,
-      0.318189,  -0.555570, 0.768178,  0.3189,    -0.5528,   0.7699,
-      0.312500,  0.312500,  0.353553,  -0.382683, 0.853553,  0.3539,
-      -0.3805,   0.8544,    0.312500,  0.375000,  0.180240,  -0.382683,
-      0.906127,  0.1804,    -0.3805,   0.9070,    0.281250,  0.375000,
-      0.212607,  0.831470,  0.513280,  0.2142,    0.8286,    0.5172,
-      0.312500,  0.812500,  0.108386,  0.831470,  0.544895,  0.1092,
-      0.8286,    0.5490,    0.281250,  0.812500,  0.137950,  0.707107,
-      0.693520,  0.1385,    0.7041,    0.6965,    0.281250,  0.750000,
-      0.318189,  -0.555570, 0.768178,  0.3189,    -0.5528,   0.7699,
-      0.312500,  0.312500,  0.162212,  -0.555570, 0.815493,  0.1626,
-      -0.5528,   0.8173,    0.281250,  0.312500,  0.137950,  -0.707107,
-      0.693520,  0.1385,    -0.7041,   0.6965,    0.281250,  0.250000,
-      0.318189,  0.555570,  0.768178,  0.3189,    0.5528,    0.7699,
-      0.312500,  0.687500,  0.270598,  0.707107,  0.653281,  0.2718,
-      0.7041,    0.6561,    0.312500,  0.750000,  0.137950,  0.707107,
-      0.693520,  0.1385,    0.7041,    0.6965,    0.281250,  0.750000,
-      0.212607,  -0.831470, 0.513280,  0.2142,    -0.8286,   0.5172,
-      0.312500,  0.187500,  0.270598,  -0.707107, 0.653281,  0.2718,
-      -0.7041,   0.6561,    0.312500,  0.250000,  0.137950,  -0.707107,
-      0.693520,  0.1385,    -0.7041,   0.6965,    0.281250,  0.250000,
-      0.191342,  -0.195090, 0.961939,  0.1914,    -0.1939,   0.9622,
-      0.281250,  0.437500,  -0.000000, -0.195090, 0.980785,  -0.0000,
-      -0.1939,   0.9810,    0.250000,  0.437500,  0.000000,  -0.382683,
-      0.923879,  -0.0000,   -0.3805,   0.9248,    0.250000,  0.375000,
-      0.108386,  0.831470,  0.544895,  0.1092,    0.8286,    0.5490,
-      0.281250,  0.812500,  0.074658,  0.923880,  0.375330,  0.0757,
-      0.9217,    0.3804,    0.281250,  0.875000,  -0.000000, 0.923880,
-      0.382683,  -0.0000,   0.9217,    0.3879,    0.250000,  0.875000,
-      0.162212,  -0.555570, 0.815493,  0.1626,    -0.5528,   0.8173,
-      0.281250,  0.312500,  0.180240,  -0.382683, 0.906127,  0.1804,
-      -0.3805,   0.9070,    0.281250,  0.375000,  0.000000,  -0.382683,
-      0.923879,  -0.0000,   -0.3805,   0.9248,    0.250000,  0.375000,
-      0.108386,  0.831470,  0.544895,  0.1092,    0.8286,    0.5490,
-      0.281250,  0.812500,  -0.000000, 0.831470,  0.555570,  -0.0000,
-      0.8286,    0.5598,    0.250000,  0.812500,  -0.000000, 0.707107,
-      0.707107,  -0.0000,   0.7041,    0.7101,    0.250000,  0.750000,
-      0.162212,  -0.555570, 0.815493,  0.1626,    -0.5528,   0.8173,
-      0.281250,  0.312500,  -0.000000, -0.555570, 0.831469,  -0.0000,
-      -0.5528,   0.8333,    0.250000,  0.312500,  -0.000000, -0.707107,
-      0.707107,  -0.0000,   -0.7041,   0.7101,    0.250000,  0.250000,
-      0.162212,  0.555570,  0.815493,  0.1626,    0.5528,    0.8173,
-      0.281250,  0.687500,  0.137950,  0.707107,  0.693520,  0.1385,
-      0.7041,    0.6965,    0.281250,  0.750000,  -0.000000, 0.707107,
-      0.707107,  -0.0000,   0.7041,    0.7101,    0.250000,  0.750000,
-      0.108386,  -0.831470, 0.544895,  0.1092,    -0.8286,   0.5490,
-      0.281250,  0.187500,  0.137950,  -0.707107, 0.693520,  0.1385,
-      -0.7041,   0.6965,    0.281250,  0.250000,  -0.000000, -0.707107,
-      0.707107,  -0.0000,   -0.7041,   0.7101,    0.250000,  0.250000,
-      0.162212,  0.555570,  0.815493,  0.1626,    0.5528,    0.8173,
-      0.281250,  0.687500,  -0.000000, 0.555570,  0.831469,  -0.0000,
-      0.5528,    0.8333,    0.250000,  0.687500,  0.000000,  0.382683,
-      0.923879,  -0.0000,   0.3805,    0.9248,    0.250000,  0.625000,
-      0.108386,  -0.831470, 0.544895,  0.1092,    -0.8286,   0.5490,
-      0.281250,  0.187500,  -0.000000, -0.831470, 0.555570,  -0.0000,
-      -0.8286,   0.5598,    0.250000,  0.187500,  -0.000000, -0.923880,
-      0.382683,  -0.0000,   -0.9217,   0.3879,    0.250000,  0.125000,
-      0.191342,  0.195090,  0.961939,  0.1914,    0.1939,    0.9622,
-      0.281250,  0.562500,  0.180240,  0.382683,  0.906127,  0.1804,
-      0.3805,    0.9070,    0.281250,  0.625000,  0.000000,  0.382683,
-      0.923879,  -0.0000,   0.3805,    0.9248,    0.250000,  0.625000,
-      0.038060,  -0.980785, 0.191342,  0.0392,    -0.9796,   0.1971,
-      0.281250,  0.062500,  0.074658,  -0.923880, 0.375330,  0.0757,
-      -0.9217,   0.3804,    0.281250,  0.125000,  -0.000000, -0.923880,
-      0.382683,  -0.0000,   -0.9217,   0.3879,    0.250000,  0.125000,
-      0.195090,  0.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.281250,  0.500000,  0.191342,  0.195090,  0.961939,  0.1914,
-      0.1939,    0.9622,    0.281250,  0.562500,  -0.000000, 0.195090,
-      0.980785,  -0.0000,   0.1939,    0.9810,    0.250000,  0.562500,
-      0.195090,  0.000000,  0.980785,  0.1951,    -0.0000,   0.9808,
-      0.281250,  0.500000,  -0.000000, 0.000000,  0.999999,  -0.0000,
-      -0.0000,   1.0000,    0.250000,  0.500000,  -0.000000, -0.195090,
-      0.980785,  -0.0000,   -0.1939,   0.9810,    0.250000,  0.437500,
-      0.038060,  0.980785,  0.191342,  0.0392,    0.9796,    0.1971,
-      0.281250,  0.937500,  -0.000000, 0.980785,  0.195090,  -0.0000,
-      0.9796,    0.2010,    0.250000,  0.937500,  -0.000000, 0.923880,
-      0.382683,  -0.0000,   0.9217,    0.3879,    0.250000,  0.875000,
-      -0.000000, -0.831470, 0.555570,  -0.0000,   -0.8286,   0.5598,
-      0.250000,  0.187500,  -0.108386, -0.831470, 0.544895,  -0.1092,
-      -0.8286,   0.5490,    0.218750,  0.187500,  -0.074658, -0.923880,
-      0.375330,  -0.0757,   -0.9217,   0.3804,    0.218750,  0.125000,
-      -0.000000, 0.195090,  0.980785,  -0.0000,   0.1939,    0.9810,
-      0.250000,  0.562500,  0.000000,  0.382683,  0.923879,  -0.0000,
-      0.3805,    0.9248,    0.250000,  0.625000,  -0.180240, 0.382683,
-      0.906127,  -0.1804,   0.3805,    0.9070,    0.218750,  0.625000,
-      -0.000000, -0.923880, 0.382683,  -0.0000,   -0.9217,   0.3879,
-      0.250000,  0.125000,  -0.074658, -0.923880, 0.375330,  -0.0757,
-      -0.9217,   0.3804,    0.218750,  0.125000,  -0.038060, -0.980785,
-      0.191342,  -0.0392,   -0.9796,   0.1971,    0.218750,  0.062500,
-      -0.000000, 0.000000,  0.999999,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  -0.000000, 0.195090,  0.980785,  -0.0000,
-      0.1939,    0.9810,    0.250000,  0.562500,  -0.191342, 0.195090,
-      0.961939,  -0.1914,   0.1939,    0.9622,    0.218750,  0.562500,
-      -0.000000, 0.000000,  0.999999,  -0.0000,   -0.0000,   1.0000,
-      0.250000,  0.500000,  -0.195091, 0.000000,  0.980785,  -0.1951,
-      -0.0000,   0.9808,    0.218750,  0.500000,  -0.191342, -0.195090,
-      0.961939,  -0.1914,   -0.1939,   0.9622,    0.218750,  0.437500,
-      -0.000000, 0.980785,  0.195090,  -0.0000,   0.9796,    0.2010,
-      0.250000,  0.937500,  -0.038060, 0.980785,  0.191342,  -0.0392,
-      0.9796,    0.1971,    0.218750,  0.937500,  -0.074658, 0.923880,
-      0.375330,  -0.0757,   0.9217,    0.3804,    0.218750,  0.875000,
-      -0.000000, -0.195090, 0.980785,  -0.0000,   -0.1939,   0.9810,
-      0.250000,  0.437500,  -0.191342, -0.195090, 0.961939,  -0.1914,
-      -0.1939,   0.9622,    0.218750,  0.437500,  -0.180240, -0.382683,
-      0.906127,  -0.1804,   -0.3805,   0.9070,    0.218750,  0.375000,
-      -0.000000, 0.923880,  0.382683,  -0.0000,   0.9217,    0.3879,
-      0.250000,  0.875000,  -0.074658, 0.923880,  0.375330,  -0.0757,
-      0.9217,    0.3804,    0.218750,  0.875000,  -0.108386, 0.831470,
-      0.544895,  -0.1092,   0.8286,    0.5490,    0.218750,  0.812500,
-      -0.000000, -0.555570, 0.831469,  -0.0000,   -0.5528,   0.8333,
-      0.250000,  0.312500,  0.000000,  -0.382683, 0.923879,  -0.0000,
-      -0.3805,   0.9248,    0.250000,  0.375000,  -0.180240, -0.382683,
-      0.906127,  -0.1804,   -0.3805,   0.9070,    0.218750,  0.375000,
-      -0.000000, 0.831470,  0.555570,  -0.0000,   0.8286,    0.5598,
-      0.250000,  0.812500,  -0.108386, 0.831470,  0.544895,  -0.1092,
-      0.8286,    0.5490,    0.218750,  0.812500,  -0.137950, 0.707107,
-      0.693520,  -0.1385,   0.7041,    0.6965,    0.218750,  0.750000,
-      -0.000000, -0.555570, 0.831469,  -0.0000,   -0.5528,   0.8333,
-      0.250000,  0.312500,  -0.162212, -0.555570, 0.815493,  -0.1626,
-      -0.5528,   0.8173,    0.218750,  0.312500,  -0.137950, -0.707107,
-      0.693520,  -0.1385,   -0.7041,   0.6965,    0.218750,  0.250000,
-      -0.000000, 0.555570,  0.831469,  -0.0000,   0.5528,    0.8333,
-      0.250000,  0.687500,  -0.000000, 0.707107,  0.707107,  -0.0000,
-      0.7041,    0.7101,    0.250000,  0.750000,  -0.137950, 0.707107,
-      0.693520,  -0.1385,   0.7041,    0.6965,    0.218750,  0.750000,
-      -0.000000, -0.831470, 0.555570,  -0.0000,   -0.8286,   0.5598,
-      0.250000,  0.187500,  -0.000000, -0.707107, 0.707107,  -0.0000,
-      -0.7041,   0.7101,    0.250000,  0.250000,  -0.137950, -0.707107,
-      0.693520,  -0.1385,   -0.7041,   0.6965,    0.218750,  0.250000,
-      -0.000000, 0.555570,  0.831469,  -0.0000,   0.5528,    0.8333,
-      0.250000,  0.687500,  -0.162212, 0.555570,  0.815493,  -0.1626,
-      0.5528,    0.8173,    0.218750,  0.687500,  -0.180240, 0.382683,
-      0.906127,  -0.1804,   0.3805,    0.9070,    0.218750,  0.625000,
-      -0.162212, -0.555570, 0.815493,  -0.1626,   -0.5528,   0.8173,
-      0.218750,  0.312500,  -0.180240, -0.382683, 0.906127,  -0.1804,
-      -0.3805,   0.9070,    0.218750,  0.375000,  -0.353553, -0.382683,
-      0.853553,  -0.3539,   -0.3805,   0.8544,    0.187500,  0.375000,
-      -0.108386, 0.831470,  0.544895,  -0.1092,   0.8286,    0.5490,
-      0.218750,  0.812500,  -0.212608, 0.831470,  0.513280,  -0.2142,
-      0.8286,    0.5172,    0.187500,  0.812500,  -0.270598, 0.707107,
-      0.653281,  -0.2718,   0.7041,    0.6561,    0.187500,  0.750000,
-      -0.162212, -0.555570, 0.815493,  -0.1626,   -0.5528,   0.8173,
-      0.218750,  0.312500,  -0.318190, -0.555570, 0.768177,  -0.3189,
-      -0.5528,   0.7699,    0.187500,  0.312500,  -0.270598, -0.707107,
-      0.653281,  -0.2718,   -0.7041,   0.6561,    0.187500,  0.250000,
-      -0.162212, 0.555570,  0.815493,  -0.1626,   0.5528,    0.8173,
-      0.218750,  0.687500,  -0.137950, 0.707107,  0.693520,  -0.1385,
-      0.7041,    0.6965,    0.218750,  0.750000,  -0.270598, 0.707107,
-      0.653281,  -0.2718,   0.7041,    0.6561,    0.187500,  0.750000,
-      -0.108386, -0.831470, 0.544895,  -0.1092,   -0.8286,   0.5490,
-      0.218750,  0.187500,  -0.137950, -0.707107, 0.693520,  -0.1385,
-      -0.7041,   0.6965,    0.218750,  0.250000,  -0.270598, -0.707107,
-      0.653281,  -0.2718,   -0.7041,   0.6561,    0.187500,  0.250000,
-      -0.162212, 0.555570,  0.815493,  -0.1626,   0.5528,    0.8173,
-      0.218750,  0.687500,  -0.318190, 0.555570,  0.768177,  -0.3189,
-      0.5528,    0.7699,    0.187500,  0.687500,  -0.353553, 0.382683,
-      0.853553,  -0.3539,   0.3805,    0.8544,    0.187500,  0.625000,
-      -0.108386, -0.831470, 0.544895,  -0.1092,   -0.8286,   0.5490,
-      0.218750,  0.187500,  -0.212608, -0.831470, 0.513280,  -0.2142,
-      -0.8286,   0.5172,    0.187500,  0.187500,  -0.146447, -0.923880,
-      0.353553,  -0.1484,   -0.9217,   0.3584,    0.187500,  0.125000,
-      -0.191342, 0.195090,  0.961939,  -0.1914,   0.1939,    0.9622,
-      0.218750,  0.562500,  -0.180240, 0.382683,  0.906127,  -0.1804,
-      0.3805,    0.9070,    0.218750,  0.625000,  -0.353553, 0.382683,
-      0.853553,  -0.3539,   0.3805,    0.8544,    0.187500,  0.625000,
-      -0.074658, -0.923880, 0.375330,  -0.0757,   -0.9217,   0.3804,
-      0.218750,  0.125000,  -0.146447, -0.923880, 0.353553,  -0.1484,
-      -0.9217,   0.3584,    0.187500,  0.125000,  -0.074658, -0.980785,
-      0.180240,  -0.0769,   -0.9796,   0.1857,    0.187500,  0.062500,
-      -0.195091, 0.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.218750,  0.500000,  -0.191342, 0.195090,  0.961939,  -0.1914,
-      0.1939,    0.9622,    0.218750,  0.562500,  -0.375330, 0.195090,
-      0.906127,  -0.3754,   0.1939,    0.9063,    0.187500,  0.562500,
-      -0.195091, 0.000000,  0.980785,  -0.1951,   -0.0000,   0.9808,
-      0.218750,  0.500000,  -0.382683, 0.000000,  0.923879,  -0.3827,
-      -0.0000,   0.9239,    0.187500,  0.500000,  -0.375330, -0.195090,
-      0.906127,  -0.3754,   -0.1939,   0.9063,    0.187500,  0.437500,
-      -0.074658, 0.923880,  0.375330,  -0.0757,   0.9217,    0.3804,
-      0.218750,  0.875000,  -0.038060, 0.980785,  0.191342,  -0.0392,
-      0.9796,    0.1971,    0.218750,  0.937500,  -0.074658, 0.980785,
-      0.180240,  -0.0769,   0.9796,    0.1857,    0.187500,  0.937500,
-      -0.191342, -0.195090, 0.961939,  -0.1914,   -0.1939,   0.9622,
-      0.218750,  0.437500,  -0.375330, -0.195090, 0.906127,  -0.3754,
-      -0.1939,   0.9063,    0.187500,  0.437500,  -0.353553, -0.382683,
-      0.853553,  -0.3539,   -0.3805,   0.8544,    0.187500,  0.375000,
-      -0.074658, 0.923880,  0.375330,  -0.0757,   0.9217,    0.3804,
-      0.218750,  0.875000,  -0.146447, 0.923880,  0.353553,  -0.1484,
-      0.9217,    0.3584,    0.187500,  0.875000,  -0.212608, 0.831470,
-      0.513280,  -0.2142,   0.8286,    0.5172,    0.187500,  0.812500,
-      -0.074658, -0.980785, 0.180240,  -0.0769,   -0.9796,   0.1857,
-      0.187500,  0.062500,  -0.146447, -0.923880, 0.353553,  -0.1484,
-      -0.9217,   0.3584,    0.187500,  0.125000,  -0.212608, -0.923880,
-      0.318190,  -0.2155,   -0.9217,   0.3225,    0.156250,  0.125000,
-      -0.382683, 0.000000,  0.923879,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.375330, 0.195090,  0.906127,  -0.3754,
-      0.1939,    0.9063,    0.187500,  0.562500,  -0.544895, 0.195090,
-      0.815493,  -0.5450,   0.1939,    0.8157,    0.156250,  0.562500,
-      -0.382683, 0.000000,  0.923879,  -0.3827,   -0.0000,   0.9239,
-      0.187500,  0.500000,  -0.555570, 0.000000,  0.831469,  -0.5556,
-      -0.0000,   0.8315,    0.156250,  0.500000,  -0.544895, -0.195090,
-      0.815493,  -0.5450,   -0.1939,   0.8157,    0.156250,  0.437500,
-      -0.146447, 0.923880,  0.353553,  -0.1484,   0.9217,    0.3584,
-      0.187500,  0.875000,  -0.074658, 0.980785,  0.180240,  -0.0769,
-      0.9796,    0.1857,    0.187500,  0.937500,  -0.108386, 0.980785,
-      0.162212,  -0.1117,   0.9796,    0.1671,    0.156250,  0.937500,
-      -0.375330, -0.195090, 0.906127,  -0.3754,   -0.1939,   0.9063,
-      0.187500,  0.437500,  -0.544895, -0.195090, 0.815493,  -0.5450,
-      -0.1939,   0.8157,    0.156250,  0.437500,  -0.513280, -0.382683,
-      0.768178,  -0.5138,   -0.3805,   0.7689,    0.156250,  0.375000,
-      -0.146447, 0.923880,  0.353553,  -0.1484,   0.9217,    0.3584,
-      0.187500,  0.875000,  -0.212608, 0.923880,  0.318190,  -0.2155,
-      0.9217,    0.3225,    0.156250,  0.875000,  -0.308658, 0.831470,
-      0.461939,  -0.3110,   0.8286,    0.4654,    0.156250,  0.812500,
-      -0.318190, -0.555570, 0.768177,  -0.3189,   -0.5528,   0.7699,
-      0.187500,  0.312500,  -0.353553, -0.382683, 0.853553,  -0.3539,
-      -0.3805,   0.8544,    0.187500,  0.375000,  -0.513280, -0.382683,
-      0.768178,  -0.5138,   -0.3805,   0.7689,    0.156250,  0.375000,
-      -0.212608, 0.831470,  0.513280,  -0.2142,   0.8286,    0.5172,
-      0.187500,  0.812500,  -0.308658, 0.831470,  0.461939,  -0.3110,
-      0.8286,    0.4654,    0.156250,  0.812500,  -0.392847, 0.707107,
-      0.587938,  -0.3945,   0.7041,    0.5905,    0.156250,  0.750000,
-      -0.318190, -0.555570, 0.768177,  -0.3189,   -0.5528,   0.7699,
-      0.187500,  0.312500,  -0.461940, -0.555570, 0.691341,  -0.4630,
-      -0.5528,   0.6929,    0.156250,  0.312500,  -0.392847, -0.707107,
-      0.587938,  -0.3945,   -0.7041,   0.5905,    0.156250,  0.250000,
-      -0.318190, 0.555570,  0.768177,  -0.3189,   0.5528,    0.7699,
-      0.187500,  0.687500,  -0.270598, 0.707107,  0.653281,  -0.2718,
-      0.7041,    0.6561,    0.187500,  0.750000,  -0.392847, 0.707107,
-      0.587938,  -0.3945,   0.7041,    0.5905,    0.156250,  0.750000,
-      -0.212608, -0.831470, 0.513280,  -0.2142,   -0.8286,   0.5172,
-      0.187500,  0.187500,  -0.270598, -0.707107, 0.653281,  -0.2718,
-      -0.7041,   0.6561,    0.187500,  0.250000,  -0.392847, -0.707107,
-      0.587938,  -0.3945,   -0.7041,   0.5905,    0.156250,  0.250000,
-      -0.318190, 0.555570,  0.768177,  -0.3189,   0.5528,    0.7699,
-      0.187500,  0.687500,  -0.461940, 0.555570,  0.691341,  -0.4630,
-      0.5528,    0.6929,    0.156250,  0.687500,  -0.513280, 0.382683,
-      0.768178,  -0.5138,   0.3805,    0.7689,    0.156250,  0.625000,
-      -0.212608, -0.831470, 0.513280,  -0.2142,   -0.8286,   0.5172,
-      0.187500,  0.187500,  -0.308658, -0.831470, 0.461939,  -0.3110,
-      -0.8286,   0.4654,    0.156250,  0.187500,  -0.212608, -0.923880,
-      0.318190,  -0.2155,   -0.9217,   0.3225,    0.156250,  0.125000,
-      -0.375330, 0.195090,  0.906127,  -0.3754,   0.1939,    0.9063,
-      0.187500,  0.562500,  -0.353553, 0.382683,  0.853553,  -0.3539,
-      0.3805,    0.8544,    0.187500,  0.625000,  -0.513280, 0.382683,
-      0.768178,  -0.5138,   0.3805,    0.7689,    0.156250,  0.625000,
-      -0.308658, 0.831470,  0.461939,  -0.3110,   0.8286,    0.4654,
-      0.156250,  0.812500,  -0.392847, 0.831470,  0.392847,  -0.3958,
-      0.8286,    0.3958,    0.125000,  0.812500,  -0.500000, 0.707107,
-      0.500000,  -0.5021,   0.7041,    0.5021,    0.125000,  0.750000,
-      -0.461940, -0.555570, 0.691341,  -0.4630,   -0.5528,   0.6929,
-      0.156250,  0.312500,  -0.587938, -0.555570, 0.587937,  -0.5893,
-      -0.5528,   0.5893,    0.125000,  0.312500,  -0.500000, -0.707107,
-      0.500000,  -0.5021,   -0.7041,   0.5021,    0.125000,  0.250000,
-      -0.461940, 0.555570,  0.691341,  -0.4630,   0.5528,    0.6929,
-      0.156250,  0.687500,  -0.392847, 0.707107,  0.587938,  -0.3945,
-      0.7041,    0.5905,    0.156250,  0.750000,  -0.500000, 0.707107,
-      0.500000,  -0.5021,   0.7041,    0.5021,    0.125000,  0.750000,
-      -0.308658, -0.831470, 0.461939,  -0.3110,   -0.8286,   0.4654,
-      0.156250,  0.187500,  -0.392847, -0.707107, 0.587938,  -0.3945,
-      -0.7041,   0.5905,    0.156250,  0.250000,  -0.500000, -0.707107,
-      0.500000,  -0.5021,   -0.7041,   0.5021,    0.125000,  0.250000,
-      -0.461940, 0.555570,  0.691341,  -0.4630,   0.5528,    0.6929,
-      0.156250,  0.687500,  -0.587938, 0.555570,  0.587937,  -0.5893,
-      0.5528,    0.5893,    0.125000,  0.687500,  -0.653281, 0.382683,
-      0.653281,  -0.6539,   0.3805,    0.6539,    0.125000,  0.625000,
-      -0.308658, -0.831470, 0.461939,  -0.3110,   -0.8286,   0.4654,
-      0.156250,  0.187500,  -0.392847, -0.831470, 0.392847,  -0.3958,
-      -0.8286,   0.3958,    0.125000,  0.187500,  -0.270598, -0.923880,
-      0.270598,  -0.2743,   -0.9217,   0.2743,    0.125000,  0.125000,
-      -0.544895, 0.195090,  0.815493,  -0.5450,   0.1939,    0.8157,
-      0.156250,  0.562500,  -0.513280, 0.382683,  0.768178,  -0.5138,
-      0.3805,    0.7689,    0.156250,  0.625000,  -0.653281, 0.382683,
-      0.653281,  -0.6539,   0.3805,    0.6539,    0.125000,  0.625000,
-      -0.108386, -0.980785, 0.162212,  -0.1117,   -0.9796,   0.1671,
-      0.156250,  0.062500,  -0.212608, -0.923880, 0.318190,  -0.2155,
-      -0.9217,   0.3225,    0.156250,  0.125000,  -0.270598, -0.923880,
-      0.270598,  -0.2743,   -0.9217,   0.2743,    0.125000,  0.125000,
-      -0.555570, 0.000000,  0.831469,  -0.5556,   -0.0000,   0.8315,
-      0.156250,  0.500000,  -0.544895, 0.195090,  0.815493,  -0.5450,
-      0.1939,    0.8157,    0.156250,  0.562500,  -0.693520, 0.195090,
-      0.693520,  -0.6937,   0.1939,    0.6937,    0.125000,  0.562500,
-      -0.555570, 0.000000,  0.831469,  -0.5556,   -0.0000,   0.8315,
-      0.156250,  0.500000,  -0.707106, 0.000000,  0.707106,  -0.7071,
-      -0.0000,   0.7071,    0.125000,  0.500000,  -0.693520, -0.195090,
-      0.693520,  -0.6937,   -0.1939,   0.6937,    0.125000,  0.437500,
-      -0.108386, 0.980785,  0.162212,  -0.1117,   0.9796,    0.1671,
-      0.156250,  0.937500,  -0.137950, 0.980785,  0.137950,  -0.1421,
-      0.9796,    0.1421,    0.125000,  0.937500,  -0.270598, 0.923880,
-      0.270598,  -0.2743,   0.9217,    0.2743,    0.125000,  0.875000,
-      -0.544895, -0.195090, 0.815493,  -0.5450,   -0.1939,   0.8157,
-      0.156250,  0.437500,  -0.693520, -0.195090, 0.693520,  -0.6937,
-      -0.1939,   0.6937,    0.125000,  0.437500,  -0.653281, -0.382683,
-      0.653281,  -0.6539,   -0.3805,   0.6539,    0.125000,  0.375000,
-      -0.212608, 0.923880,  0.318190,  -0.2155,   0.9217,    0.3225,
-      0.156250,  0.875000,  -0.270598, 0.923880,  0.270598,  -0.2743,
-      0.9217,    0.2743,    0.125000,  0.875000,  -0.392847, 0.831470,
-      0.392847,  -0.3958,   0.8286,    0.3958,    0.125000,  0.812500,
-      -0.461940, -0.555570, 0.691341,  -0.4630,   -0.5528,   0.6929,
-      0.156250,  0.312500,  -0.513280, -0.382683, 0.768178,  -0.5138,
-      -0.3805,   0.7689,    0.156250,  0.375000,  -0.653281, -0.382683,
-      0.653281,  -0.6539,   -0.3805,   0.6539,    0.125000,  0.375000,
-      -0.707106, 0.000000,  0.707106,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.693520, 0.195090,  0.693520,  -0.6937,
-      0.1939,    0.6937,    0.125000,  0.562500,  -0.815493, 0.195090,
-      0.544895,  -0.8157,   0.1939,    0.5450,    0.093750,  0.562500,
-      -0.707106, 0.000000,  0.707106,  -0.7071,   -0.0000,   0.7071,
-      0.125000,  0.500000,  -0.831469, 0.000000,  0.555569,  -0.8315,
-      -0.0000,   0.5556,    0.093750,  0.500000,  -0.815493, -0.195090,
-      0.544895,  -0.8157,   -0.1939,   0.5450,    0.093750,  0.437500,
-      -0.137950, 0.980785,  0.137950,  -0.1421,   0.9796,    0.1421,
-      0.125000,  0.937500,  -0.162212, 0.980785,  0.108386,  -0.1671,
-      0.9796,    0.1117,    0.093750,  0.937500,  -0.318190, 0.923880,
-      0.212607,  -0.3225,   0.9217,    0.2155,    0.093750,  0.875000,
-      -0.693520, -0.195090, 0.693520,  -0.6937,   -0.1939,   0.6937,
-      0.125000,  0.437500,  -0.815493, -0.195090, 0.544895,  -0.8157,
-      -0.1939,   0.5450,    0.093750,  0.437500,  -0.768177, -0.382683,
-      0.513280,  -0.7689,   -0.3805,   0.5138,    0.093750,  0.375000,
-      -0.270598, 0.923880,  0.270598,  -0.2743,   0.9217,    0.2743,
-      0.125000,  0.875000,  -0.318190, 0.923880,  0.212607,  -0.3225,
-      0.9217,    0.2155,    0.093750,  0.875000,  -0.461940, 0.831470,
-      0.308658,  -0.4654,   0.8286,    0.3110,    0.093750,  0.812500,
-      -0.587938, -0.555570, 0.587937,  -0.5893,   -0.5528,   0.5893,
-      0.125000,  0.312500,  -0.653281, -0.382683, 0.653281,  -0.6539,
-      -0.3805,   0.6539,    0.125000,  0.375000,  -0.768177, -0.382683,
-      0.513280,  -0.7689,   -0.3805,   0.5138,    0.093750,  0.375000,
-      -0.392847, 0.831470,  0.392847,  -0.3958,   0.8286,    0.3958,
-      0.125000,  0.812500,  -0.461940, 0.831470,  0.308658,  -0.4654,
-      0.8286,    0.3110,    0.093750,  0.812500,  -0.587938, 0.707107,
-      0.392847,  -0.5905,   0.7041,    0.3945,    0.093750,  0.750000,
-      -0.587938, -0.555570, 0.587937,  -0.5893,   -0.5528,   0.5893,
-      0.125000,  0.312500,  -0.691341, -0.555570, 0.461939,  -0.6929,
-      -0.5528,   0.4630,    0.093750,  0.312500,  -0.587938, -0.707107,
-      0.392847,  -0.5905,   -0.7041,   0.3945,    0.093750,  0.250000,
-      -0.587938, 0.555570,  0.587937,  -0.5893,   0.5528,    0.5893,
-      0.125000,  0.687500,  -0.500000, 0.707107,  0.500000,  -0.5021,
-      0.7041,    0.5021,    0.125000,  0.750000,  -0.587938, 0.707107,
-      0.392847,  -0.5905,   0.7041,    0.3945,    0.093750,  0.750000,
-      -0.392847, -0.831470, 0.392847,  -0.3958,   -0.8286,   0.3958,
-      0.125000,  0.187500,  -0.500000, -0.707107, 0.500000,  -0.5021,
-      -0.7041,   0.5021,    0.125000,  0.250000,  -0.587938, -0.707107,
-      0.392847,  -0.5905,   -0.7041,   0.3945,    0.093750,  0.250000,
-      -0.587938, 0.555570,  0.587937,  -0.5893,   0.5528,    0.5893,
-      0.125000,  0.687500,  -0.691341, 0.555570,  0.461939,  -0.6929,
-      0.5528,    0.4630,    0.093750,  0.687500,  -0.768177, 0.382683,
-      0.513280,  -0.7689,   0.3805,    0.5138,    0.093750,  0.625000,
-      -0.392847, -0.831470, 0.392847,  -0.3958,   -0.8286,   0.3958,
-      0.125000,  0.187500,  -0.461940, -0.831470, 0.308658,  -0.4654,
-      -0.8286,   0.3110,    0.093750,  0.187500,  -0.318190, -0.923880,
-      0.212607,  -0.3225,   -0.9217,   0.2155,    0.093750,  0.125000,
-      -0.693520, 0.195090,  0.693520,  -0.6937,   0.1939,    0.6937,
-      0.125000,  0.562500,  -0.653281, 0.382683,  0.653281,  -0.6539,
-      0.3805,    0.6539,    0.125000,  0.625000,  -0.768177, 0.382683,
-      0.513280,  -0.7689,   0.3805,    0.5138,    0.093750,  0.625000,
-      -0.270598, -0.923880, 0.270598,  -0.2743,   -0.9217,   0.2743,
-      0.125000,  0.125000,  -0.318190, -0.923880, 0.212607,  -0.3225,
-      -0.9217,   0.2155,    0.093750,  0.125000,  -0.162212, -0.980785,
-      0.108386,  -0.1671,   -0.9796,   0.1117,    0.093750,  0.062500,
-      -0.691341, -0.555570, 0.461939,  -0.6929,   -0.5528,   0.4630,
-      0.093750,  0.312500,  -0.768177, -0.555570, 0.318189,  -0.7699,
-      -0.5528,   0.3189,    0.062500,  0.312500,  -0.653281, -0.707107,
-      0.270598,  -0.6561,   -0.7041,   0.2718,    0.062500,  0.250000,
-      -0.587938, 0.707107,  0.392847,  -0.5905,   0.7041,    0.3945,
-      0.093750,  0.750000,  -0.653281, 0.707107,  0.270598,  -0.6561,
-      0.7041,    0.2718,    0.062500,  0.750000,  -0.768177, 0.555570,
-      0.318189,  -0.7699,   0.5528,    0.3189,    0.062500,  0.687500,
-      -0.461940, -0.831470, 0.308658,  -0.4654,   -0.8286,   0.3110,
-      0.093750,  0.187500,  -0.587938, -0.707107, 0.392847,  -0.5905,
-      -0.7041,   0.3945,    0.093750,  0.250000,  -0.653281, -0.707107,
-      0.270598,  -0.6561,   -0.7041,   0.2718,    0.062500,  0.250000,
-      -0.691341, 0.555570,  0.461939,  -0.6929,   0.5528,    0.4630,
-      0.093750,  0.687500,  -0.768177, 0.555570,  0.318189,  -0.7699,
-      0.5528,    0.3189,    0.062500,  0.687500,  -0.853553, 0.382683,
-      0.353553,  -0.8544,   0.3805,    0.3539,    0.062500,  0.625000,
-      -0.461940, -0.831470, 0.308658,  -0.4654,   -0.8286,   0.3110,
-      0.093750,  0.187500,  -0.513280, -0.831470, 0.212607,  -0.5172,
-      -0.8286,   0.2142,    0.062500,  0.187500,  -0.353553, -0.923880,
-      0.146447,  -0.3584,   -0.9217,   0.1484,    0.062500,  0.125000,
-      -0.815493, 0.195090,  0.544895,  -0.8157,   0.1939,    0.5450,
-      0.093750,  0.562500,  -0.768177, 0.382683,  0.513280,  -0.7689,
-      0.3805,    0.5138,    0.093750,  0.625000,  -0.853553, 0.382683,
-      0.353553,  -0.8544,   0.3805,    0.3539,    0.062500,  0.625000,
-      -0.318190, -0.923880, 0.212607,  -0.3225,   -0.9217,   0.2155,
-      0.093750,  0.125000,  -0.353553, -0.923880, 0.146447,  -0.3584,
-      -0.9217,   0.1484,    0.062500,  0.125000,  -0.180240, -0.980785,
-      0.074658,  -0.1857,   -0.9796,   0.0769,    0.062500,  0.062500,
-      -0.831469, 0.000000,  0.555569,  -0.8315,   -0.0000,   0.5556,
-      0.093750,  0.500000,  -0.815493, 0.195090,  0.544895,  -0.8157,
-      0.1939,    0.5450,    0.093750,  0.562500,  -0.906127, 0.195090,
-      0.375330,  -0.9063,   0.1939,    0.3754,    0.062500,  0.562500,
-      -0.831469, 0.000000,  0.555569,  -0.8315,   -0.0000,   0.5556,
-      0.093750,  0.500000,  -0.923879, 0.000000,  0.382683,  -0.9239,
-      -0.0000,   0.3827,    0.062500,  0.500000,  -0.906127, -0.195090,
-      0.375330,  -0.9063,   -0.1939,   0.3754,    0.062500,  0.437500,
-      -0.162212, 0.980785,  0.108386,  -0.1671,   0.9796,    0.1117,
-      0.093750,  0.937500,  -0.180240, 0.980785,  0.074658,  -0.1857,
-      0.9796,    0.0769,    0.062500,  0.937500,  -0.353553, 0.923880,
-      0.146447,  -0.3584,   0.9217,    0.1484,    0.062500,  0.875000,
-      -0.815493, -0.195090, 0.544895,  -0.8157,   -0.1939,   0.5450,
-      0.093750,  0.437500,  -0.906127, -0.195090, 0.375330,  -0.9063,
-      -0.1939,   0.3754,    0.062500,  0.437500,  -0.853553, -0.382683,
-      0.353553,  -0.8544,   -0.3805,   0.3539,    0.062500,  0.375000,
-      -0.318190, 0.923880,  0.212607,  -0.3225,   0.9217,    0.2155,
-      0.093750,  0.875000,  -0.353553, 0.923880,  0.146447,  -0.3584,
-      0.9217,    0.1484,    0.062500,  0.875000,  -0.513280, 0.831470,
-      0.212607,  -0.5172,   0.8286,    0.2142,    0.062500,  0.812500,
-      -0.691341, -0.555570, 0.461939,  -0.6929,   -0.5528,   0.4630,
-      0.093750,  0.312500,  -0.768177, -0.382683, 0.513280,  -0.7689,
-      -0.3805,   0.5138,    0.093750,  0.375000,  -0.853553, -0.382683,
-      0.353553,  -0.8544,   -0.3805,   0.3539,    0.062500,  0.375000,
-      -0.461940, 0.831470,  0.308658,  -0.4654,   0.8286,    0.3110,
-      0.093750,  0.812500,  -0.513280, 0.831470,  0.212607,  -0.5172,
-      0.8286,    0.2142,    0.062500,  0.812500,  -0.653281, 0.707107,
-      0.270598,  -0.6561,   0.7041,    0.2718,    0.062500,  0.750000,
-      -0.923879, 0.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -0.980784, 0.000000,  0.195090,  -0.9808,
-      -0.0000,   0.1951,    0.031250,  0.500000,  -0.961939, -0.195090,
-      0.191341,  -0.9622,   -0.1939,   0.1914,    0.031250,  0.437500,
-      -0.180240, 0.980785,  0.074658,  -0.1857,   0.9796,    0.0769,
-      0.062500,  0.937500,  -0.191342, 0.980785,  0.038060,  -0.1971,
-      0.9796,    0.0392,    0.031250,  0.937500,  -0.375330, 0.923880,
-      0.074658,  -0.3804,   0.9217,    0.0757,    0.031250,  0.875000,
-      -0.906127, -0.195090, 0.375330,  -0.9063,   -0.1939,   0.3754,
-      0.062500,  0.437500,  -0.961939, -0.195090, 0.191341,  -0.9622,
-      -0.1939,   0.1914,    0.031250,  0.437500,  -0.906127, -0.382683,
-      0.180240,  -0.9070,   -0.3805,   0.1804,    0.031250,  0.375000,
-      -0.353553, 0.923880,  0.146447,  -0.3584,   0.9217,    0.1484,
-      0.062500,  0.875000,  -0.375330, 0.923880,  0.074658,  -0.3804,
-      0.9217,    0.0757,    0.031250,  0.875000,  -0.544895, 0.831470,
-      0.108386,  -0.5490,   0.8286,    0.1092,    0.031250,  0.812500,
-      -0.768177, -0.555570, 0.318189,  -0.7699,   -0.5528,   0.3189,
-      0.062500,  0.312500,  -0.853553, -0.382683, 0.353553,  -0.8544,
-      -0.3805,   0.3539,    0.062500,  0.375000,  -0.906127, -0.382683,
-      0.180240,  -0.9070,   -0.3805,   0.1804,    0.031250,  0.375000,
-      -0.513280, 0.831470,  0.212607,  -0.5172,   0.8286,    0.2142,
-      0.062500,  0.812500,  -0.544895, 0.831470,  0.108386,  -0.5490,
-      0.8286,    0.1092,    0.031250,  0.812500,  -0.693520, 0.707107,
-      0.137950,  -0.6965,   0.7041,    0.1385,    0.031250,  0.750000,
-      -0.768177, -0.555570, 0.318189,  -0.7699,   -0.5528,   0.3189,
-      0.062500,  0.312500,  -0.815493, -0.555570, 0.162211,  -0.8173,
-      -0.5528,   0.1626,    0.031250,  0.312500,  -0.693520, -0.707107,
-      0.137950,  -0.6965,   -0.7041,   0.1385,    0.031250,  0.250000,
-      -0.768177, 0.555570,  0.318189,  -0.7699,   0.5528,    0.3189,
-      0.062500,  0.687500,  -0.653281, 0.707107,  0.270598,  -0.6561,
-      0.7041,    0.2718,    0.062500,  0.750000,  -0.693520, 0.707107,
-      0.137950,  -0.6965,   0.7041,    0.1385,    0.031250,  0.750000,
-      -0.513280, -0.831470, 0.212607,  -0.5172,   -0.8286,   0.2142,
-      0.062500,  0.187500,  -0.653281, -0.707107, 0.270598,  -0.6561,
-      -0.7041,   0.2718,    0.062500,  0.250000,  -0.693520, -0.707107,
-      0.137950,  -0.6965,   -0.7041,   0.1385,    0.031250,  0.250000,
-      -0.768177, 0.555570,  0.318189,  -0.7699,   0.5528,    0.3189,
-      0.062500,  0.687500,  -0.815493, 0.555570,  0.162211,  -0.8173,
-      0.5528,    0.1626,    0.031250,  0.687500,  -0.906127, 0.382683,
-      0.180240,  -0.9070,   0.3805,    0.1804,    0.031250,  0.625000,
-      -0.513280, -0.831470, 0.212607,  -0.5172,   -0.8286,   0.2142,
-      0.062500,  0.187500,  -0.544895, -0.831470, 0.108386,  -0.5490,
-      -0.8286,   0.1092,    0.031250,  0.187500,  -0.375330, -0.923880,
-      0.074658,  -0.3804,   -0.9217,   0.0757,    0.031250,  0.125000,
-      -0.906127, 0.195090,  0.375330,  -0.9063,   0.1939,    0.3754,
-      0.062500,  0.562500,  -0.853553, 0.382683,  0.353553,  -0.8544,
-      0.3805,    0.3539,    0.062500,  0.625000,  -0.906127, 0.382683,
-      0.180240,  -0.9070,   0.3805,    0.1804,    0.031250,  0.625000,
-      -0.353553, -0.923880, 0.146447,  -0.3584,   -0.9217,   0.1484,
-      0.062500,  0.125000,  -0.375330, -0.923880, 0.074658,  -0.3804,
-      -0.9217,   0.0757,    0.031250,  0.125000,  -0.191342, -0.980785,
-      0.038060,  -0.1971,   -0.9796,   0.0392,    0.031250,  0.062500,
-      -0.923879, 0.000000,  0.382683,  -0.9239,   -0.0000,   0.3827,
-      0.062500,  0.500000,  -0.906127, 0.195090,  0.375330,  -0.9063,
-      0.1939,    0.3754,    0.062500,  0.562500,  -0.961939, 0.195090,
-      0.191341,  -0.9622,   0.1939,    0.1914,    0.031250,  0.562500,
-      -0.815493, 0.555570,  0.162211,  -0.8173,   0.5528,    0.1626,
-      0.031250,  0.687500,  -0.693520, 0.707107,  0.137950,  -0.6965,
-      0.7041,    0.1385,    0.031250,  0.750000,  -0.707107, 0.707107,
-      -0.000000, -0.7101,   0.7041,    -0.0000,   0.000000,  0.750000,
-      -0.544895, -0.831470, 0.108386,  -0.5490,   -0.8286,   0.1092,
-      0.031250,  0.187500,  -0.693520, -0.707107, 0.137950,  -0.6965,
-      -0.7041,   0.1385,    0.031250,  0.250000,  -0.707107, -0.707107,
-      -0.000000, -0.7101,   -0.7041,   -0.0000,   0.000000,  0.250000,
-      -0.815493, 0.555570,  0.162211,  -0.8173,   0.5528,    0.1626,
-      0.031250,  0.687500,  -0.831469, 0.555570,  -0.000000, -0.8333,
-      0.5528,    -0.0000,   0.000000,  0.687500,  -0.923879, 0.382683,
-      -0.000000, -0.9248,   0.3805,    -0.0000,   0.000000,  0.625000,
-      -0.544895, -0.831470, 0.108386,  -0.5490,   -0.8286,   0.1092,
-      0.031250,  0.187500,  -0.555570, -0.831470, -0.000000, -0.5598,
-      -0.8286,   -0.0000,   0.000000,  0.187500,  -0.382683, -0.923880,
-      -0.000000, -0.3879,   -0.9217,   -0.0000,   0.000000,  0.125000,
-      -0.961939, 0.195090,  0.191341,  -0.9622,   0.1939,    0.1914,
-      0.031250,  0.562500,  -0.906127, 0.382683,  0.180240,  -0.9070,
-      0.3805,    0.1804,    0.031250,  0.625000,  -0.923879, 0.382683,
-      -0.000000, -0.9248,   0.3805,    -0.0000,   0.000000,  0.625000,
-      -0.375330, -0.923880, 0.074658,  -0.3804,   -0.9217,   0.0757,
-      0.031250,  0.125000,  -0.382683, -0.923880, -0.000000, -0.3879,
-      -0.9217,   -0.0000,   0.000000,  0.125000,  -0.195090, -0.980785,
-      -0.000000, -0.2010,   -0.9796,   -0.0000,   0.000000,  0.062500,
-      -0.980784, 0.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.031250,  0.500000,  -0.961939, 0.195090,  0.191341,  -0.9622,
-      0.1939,    0.1914,    0.031250,  0.562500,  -0.980785, 0.195090,
-      -0.000000, -0.9810,   0.1939,    -0.0000,   0.000000,  0.562500,
-      -0.980784, 0.000000,  0.195090,  -0.9808,   -0.0000,   0.1951,
-      0.031250,  0.500000,  -0.999999, 0.000000,  -0.000000, -1.0000,
-      -0.0000,   -0.0000,   0.000000,  0.500000,  -0.980785, -0.195090,
-      -0.000000, -0.9810,   -0.1939,   -0.0000,   0.000000,  0.437500,
-      -0.191342, 0.980785,  0.038060,  -0.1971,   0.9796,    0.0392,
-      0.031250,  0.937500,  -0.195090, 0.980785,  -0.000000, -0.2010,
-      0.9796,    -0.0000,   0.000000,  0.937500,  -0.382683, 0.923880,
-      -0.000000, -0.3879,   0.9217,    -0.0000,   0.000000,  0.875000,
-      -0.961939, -0.195090, 0.191341,  -0.9622,   -0.1939,   0.1914,
-      0.031250,  0.437500,  -0.980785, -0.195090, -0.000000, -0.9810,
-      -0.1939,   -0.0000,   0.000000,  0.437500,  -0.923879, -0.382683,
-      -0.000000, -0.9248,   -0.3805,   -0.0000,   0.000000,  0.375000,
-      -0.544895, 0.831470,  0.108386,  -0.5490,   0.8286,    0.1092,
-      0.031250,  0.812500,  -0.375330, 0.923880,  0.074658,  -0.3804,
-      0.9217,    0.0757,    0.031250,  0.875000,  -0.382683, 0.923880,
-      -0.000000, -0.3879,   0.9217,    -0.0000,   0.000000,  0.875000,
-      -0.815493, -0.555570, 0.162211,  -0.8173,   -0.5528,   0.1626,
-      0.031250,  0.312500,  -0.906127, -0.382683, 0.180240,  -0.9070,
-      -0.3805,   0.1804,    0.031250,  0.375000,  -0.923879, -0.382683,
-      -0.000000, -0.9248,   -0.3805,   -0.0000,   0.000000,  0.375000,
-      -0.544895, 0.831470,  0.108386,  -0.5490,   0.8286,    0.1092,
-      0.031250,  0.812500,  -0.555570, 0.831470,  -0.000000, -0.5598,
-      0.8286,    -0.0000,   0.000000,  0.812500,  -0.707107, 0.707107,
-      -0.000000, -0.7101,   0.7041,    -0.0000,   0.000000,  0.750000,
-      -0.815493, -0.555570, 0.162211,  -0.8173,   -0.5528,   0.1626,
-      0.031250,  0.312500,  -0.831469, -0.555570, -0.000000, -0.8333,
-      -0.5528,   -0.0000,   0.000000,  0.312500,  -0.707107, -0.707107,
-      -0.000000, -0.7101,   -0.7041,   -0.0000,   0.000000,  0.250000,
-      -0.999999, 0.000000,  -0.000000, -1.0000,   -0.0000,   -0.0000,
-      1.000000,  0.500000,  -0.980784, 0.000000,  -0.195091, -0.9808,
-      -0.0000,   -0.1951,   0.968750,  0.500000,  -0.961939, -0.195090,
-      -0.191342, -0.9622,   -0.1939,   -0.1914,   0.968750,  0.437500,
-      -0.195090, 0.980785,  -0.000000, -0.2010,   0.9796,    -0.0000,
-      1.000000,  0.937500,  -0.191342, 0.980785,  -0.038060, -0.1971,
-      0.9796,    -0.0392,   0.968750,  0.937500,  -0.375330, 0.923880,
-      -0.074658, -0.3804,   0.9217,    -0.0757,   0.968750,  0.875000,
-      -0.980785, -0.195090, -0.000000, -0.9810,   -0.1939,   -0.0000,
-      1.000000,  0.437500,  -0.961939, -0.195090, -0.191342, -0.9622,
-      -0.1939,   -0.1914,   0.968750,  0.437500,  -0.906127, -0.382683,
-      -0.180240, -0.9070,   -0.3805,   -0.1804,   0.968750,  0.375000,
-      -0.555570, 0.831470,  -0.000000, -0.5598,   0.8286,    -0.0000,
-      1.000000,  0.812500,  -0.382683, 0.923880,  -0.000000, -0.3879,
-      0.9217,    -0.0000,   1.000000,  0.875000,  -0.375330, 0.923880,
-      -0.074658, -0.3804,   0.9217,    -0.0757,   0.968750,  0.875000,
-      -0.831469, -0.555570, -0.000000, -0.8333,   -0.5528,   -0.0000,
-      1.000000,  0.312500,  -0.923879, -0.382683, -0.000000, -0.9248,
-      -0.3805,   -0.0000,   1.000000,  0.375000,  -0.906127, -0.382683,
-      -0.180240, -0.9070,   -0.3805,   -0.1804,   0.968750,  0.375000,
-      -0.555570, 0.831470,  -0.000000, -0.5598,   0.8286,    -0.0000,
-      1.000000,  0.812500,  -0.544895, 0.831470,  -0.108386, -0.5490,
-      0.8286,    -0.1092,   0.968750,  0.812500,  -0.693520, 0.707107,
-      -0.137950, -0.6965,   0.7041,    -0.1385,   0.968750,  0.750000,
-      -0.831469, -0.555570, -0.000000, -0.8333,   -0.5528,   -0.0000,
-      1.000000,  0.312500,  -0.815493, -0.555570, -0.162212, -0.8173,
-      -0.5528,   -0.1626,   0.968750,  0.312500,  -0.693520, -0.707107,
-      -0.137950, -0.6965,   -0.7041,   -0.1385,   0.968750,  0.250000,
-      -0.831469, 0.555570,  -0.000000, -0.8333,   0.5528,    -0.0000,
-      1.000000,  0.687500,  -0.707107, 0.707107,  -0.000000, -0.7101,
-      0.7041,    -0.0000,   1.000000,  0.750000,  -0.693520, 0.707107,
-      -0.137950, -0.6965,   0.7041,    -0.1385,   0.968750,  0.750000,
-      -0.555570, -0.831470, -0.000000, -0.5598,   -0.8286,   -0.0000,
-      1.000000,  0.187500,  -0.707107, -0.707107, -0.000000, -0.7101,
-      -0.7041,   -0.0000,   1.000000,  0.250000,  -0.693520, -0.707107,
-      -0.137950, -0.6965,   -0.7041,   -0.1385,   0.968750,  0.250000,
-      -0.831469, 0.555570,  -0.000000, -0.8333,   0.5528,    -0.0000,
-      1.000000,  0.687500,  -0.815493, 0.555570,  -0.162212, -0.8173,
-      0.5528,    -0.1626,   0.968750,  0.687500,  -0.906127, 0.382683,
-      -0.180240, -0.9070,   0.3805,    -0.1804,   0.968750,  0.625000,
-      -0.555570, -0.831470, -0.000000, -0.5598,   -0.8286,   -0.0000,
-      1.000000,  0.187500,  -0.544895, -0.831470, -0.108386, -0.5490,
-      -0.8286,   -0.1092,   0.968750,  0.187500,  -0.375330, -0.923880,
-      -0.074658, -0.3804,   -0.9217,   -0.0757,   0.968750,  0.125000,
-      -0.980785, 0.195090,  -0.000000, -0.9810,   0.1939,    -0.0000,
-      1.000000,  0.562500,  -0.923879, 0.382683,  -0.000000, -0.9248,
-      0.3805,    -0.0000,   1.000000,  0.625000,  -0.906127, 0.382683,
-      -0.180240, -0.9070,   0.3805,    -0.1804,   0.968750,  0.625000,
-      -0.382683, -0.923880, -0.000000, -0.3879,   -0.9217,   -0.0000,
-      1.000000,  0.125000,  -0.375330, -0.923880, -0.074658, -0.3804,
-      -0.9217,   -0.0757,   0.968750,  0.125000,  -0.191342, -0.980785,
-      -0.038060, -0.1971,   -0.9796,   -0.0392,   0.968750,  0.062500,
-      -0.999999, 0.000000,  -0.000000, -1.0000,   -0.0000,   -0.0000,
-      1.000000,  0.500000,  -0.980785, 0.195090,  -0.000000, -0.9810,
-      0.1939,    -0.0000,   1.000000,  0.562500,  -0.961939, 0.195090,
-      -0.191342, -0.9622,   0.1939,    -0.1914,   0.968750,  0.562500,
-      -0.544895, -0.831470, -0.108386, -0.5490,   -0.8286,   -0.1092,
-      0.968750,  0.187500,  -0.693520, -0.707107, -0.137950, -0.6965,
-      -0.7041,   -0.1385,   0.968750,  0.250000,  -0.653281, -0.707107,
-      -0.270598, -0.6561,   -0.7041,   -0.2718,   0.937500,  0.250000,
-      -0.815493, 0.555570,  -0.162212, -0.8173,   0.5528,    -0.1626,
-      0.968750,  0.687500,  -0.768177, 0.555570,  -0.318190, -0.7699,
-      0.5528,    -0.3189,   0.937500,  0.687500,  -0.853553, 0.382683,
-      -0.353553, -0.8544,   0.3805,    -0.3539,   0.937500,  0.625000,
-      -0.544895, -0.831470, -0.108386, -0.5490,   -0.8286,   -0.1092,
-      0.968750,  0.187500,  -0.513279, -0.831470, -0.212607, -0.5172,
-      -0.8286,   -0.2142,   0.937500,  0.187500,  -0.353553, -0.923880,
-      -0.146447, -0.3584,   -0.9217,   -0.1484,   0.937500,  0.125000,
-      -0.961939, 0.195090,  -0.191342, -0.9622,   0.1939,    -0.1914,
-      0.968750,  0.562500,  -0.906127, 0.382683,  -0.180240, -0.9070,
-      0.3805,    -0.1804,   0.968750,  0.625000,  -0.853553, 0.382683,
-      -0.353553, -0.8544,   0.3805,    -0.3539,   0.937500,  0.625000,
-      -0.375330, -0.923880, -0.074658, -0.3804,   -0.9217,   -0.0757,
-      0.968750,  0.125000,  -0.353553, -0.923880, -0.146447, -0.3584,
-      -0.9217,   -0.1484,   0.937500,  0.125000,  -0.180240, -0.980785,
-      -0.074658, -0.1857,   -0.9796,   -0.0769,   0.937500,  0.062500,
-      -0.980784, 0.000000,  -0.195091, -0.9808,   -0.0000,   -0.1951,
-      0.968750,  0.500000,  -0.961939, 0.195090,  -0.191342, -0.9622,
-      0.1939,    -0.1914,   0.968750,  0.562500,  -0.906127, 0.195090,
-      -0.375330, -0.9063,   0.1939,    -0.3754,   0.937500,  0.562500,
-      -0.980784, 0.000000,  -0.195091, -0.9808,   -0.0000,   -0.1951,
-      0.968750,  0.500000,  -0.923878, 0.000000,  -0.382683, -0.9239,
-      -0.0000,   -0.3827,   0.937500,  0.500000,  -0.906127, -0.195090,
-      -0.375330, -0.9063,   -0.1939,   -0.3754,   0.937500,  0.437500,
-      -0.191342, 0.980785,  -0.038060, -0.1971,   0.9796,    -0.0392,
-      0.968750,  0.937500,  -0.180240, 0.980785,  -0.074658, -0.1857,
-      0.9796,    -0.0769,   0.937500,  0.937500,  -0.353553, 0.923880,
-      -0.146447, -0.3584,   0.9217,    -0.1484,   0.937500,  0.875000,
-      -0.961939, -0.195090, -0.191342, -0.9622,   -0.1939,   -0.1914,
-      0.968750,  0.437500,  -0.906127, -0.195090, -0.375330, -0.9063,
-      -0.1939,   -0.3754,   0.937500,  0.437500,  -0.853553, -0.382683,
-      -0.353553, -0.8544,   -0.3805,   -0.3539,   0.937500,  0.375000,
-      -0.544895, 0.831470,  -0.108386, -0.5490,   0.8286,    -0.1092,
-      0.968750,  0.812500,  -0.375330, 0.923880,  -0.074658, -0.3804,
-      0.9217,    -0.0757,   0.968750,  0.875000,  -0.353553, 0.923880,
-      -0.146447, -0.3584,   0.9217,    -0.1484,   0.937500,  0.875000,
-      -0.815493, -0.555570, -0.162212, -0.8173,   -0.5528,   -0.1626,
-      0.968750,  0.312500,  -0.906127, -0.382683, -0.180240, -0.9070,
-      -0.3805,   -0.1804,   0.968750,  0.375000,  -0.853553, -0.382683,
-      -0.353553, -0.8544,   -0.3805,   -0.3539,   0.937500,  0.375000,
-      -0.544895, 0.831470,  -0.108386, -0.5490,   0.8286,    -0.1092,
-      0.968750,  0.812500,  -0.513279, 0.831470,  -0.212607, -0.5172,
-      0.8286,    -0.2142,   0.937500,  0.812500,  -0.653281, 0.707107,
-      -0.270598, -0.6561,   0.7041,    -0.2718,   0.937500,  0.750000,
-      -0.815493, -0.555570, -0.162212, -0.8173,   -0.5528,   -0.1626,
-      0.968750,  0.312500,  -0.768177, -0.555570, -0.318190, -0.7699,
-      -0.5528,   -0.3189,   0.937500,  0.312500,  -0.653281, -0.707107,
-      -0.270598, -0.6561,   -0.7041,   -0.2718,   0.937500,  0.250000,
-      -0.815493, 0.555570,  -0.162212, -0.8173,   0.5528,    -0.1626,
-      0.968750,  0.687500,  -0.693520, 0.707107,  -0.137950, -0.6965,
-      0.7041,    -0.1385,   0.968750,  0.750000,  -0.653281, 0.707107,
-      -0.270598, -0.6561,   0.7041,    -0.2718,   0.937500,  0.750000,
-      -0.906127, -0.195090, -0.375330, -0.9063,   -0.1939,   -0.3754,
-      0.937500,  0.437500,  -0.815493, -0.195090, -0.544895, -0.8157,
-      -0.1939,   -0.5450,   0.906250,  0.437500,  -0.768177, -0.382683,
-      -0.513280, -0.7689,   -0.3805,   -0.5138,   0.906250,  0.375000,
-      -0.353553, 0.923880,  -0.146447, -0.3584,   0.9217,    -0.1484,
-      0.937500,  0.875000,  -0.318189, 0.923880,  -0.212607, -0.3225,
-      0.9217,    -0.2155,   0.906250,  0.875000,  -0.461939, 0.831470,
-      -0.308658, -0.4654,   0.8286,    -0.3110,   0.906250,  0.812500,
-      -0.768177, -0.555570, -0.318190, -0.7699,   -0.5528,   -0.3189,
-      0.937500,  0.312500,  -0.853553, -0.382683, -0.353553, -0.8544,
-      -0.3805,   -0.3539,   0.937500,  0.375000,  -0.768177, -0.382683,
-      -0.513280, -0.7689,   -0.3805,   -0.5138,   0.906250,  0.375000,
-      -0.513279, 0.831470,  -0.212607, -0.5172,   0.8286,    -0.2142,
-      0.937500,  0.812500,  -0.461939, 0.831470,  -0.308658, -0.4654,
-      0.8286,    -0.3110,   0.906250,  0.812500,  -0.587938, 0.707107,
-      -0.392847, -0.5905,   0.7041,    -0.3945,   0.906250,  0.750000,
-      -0.768177, -0.555570, -0.318190, -0.7699,   -0.5528,   -0.3189,
-      0.937500,  0.312500,  -0.691341, -0.555570, -0.461940, -0.6929,
-      -0.5528,   -0.4630,   0.906250,  0.312500,  -0.587938, -0.707107,
-      -0.392847, -0.5905,   -0.7041,   -0.3945,   0.906250,  0.250000,
-      -0.768177, 0.555570,  -0.318190, -0.7699,   0.5528,    -0.3189,
-      0.937500,  0.687500,  -0.653281, 0.707107,  -0.270598, -0.6561,
-      0.7041,    -0.2718,   0.937500,  0.750000,  -0.587938, 0.707107,
-      -0.392847, -0.5905,   0.7041,    -0.3945,   0.906250,  0.750000,
-      -0.513279, -0.831470, -0.212607, -0.5172,   -0.8286,   -0.2142,
-      0.937500,  0.187500,  -0.653281, -0.707107, -0.270598, -0.6561,
-      -0.7041,   -0.2718,   0.937500,  0.250000,  -0.587938, -0.707107,
-      -0.392847, -0.5905,   -0.7041,   -0.3945,   0.906250,  0.250000,
-      -0.768177, 0.555570,  -0.318190, -0.7699,   0.5528,    -0.3189,
-      0.937500,  0.687500,  -0.691341, 0.555570,  -0.461940, -0.6929,
-      0.5528,    -0.4630,   0.906250,  0.687500,  -0.768177, 0.382683,
-      -0.513280, -0.7689,   0.3805,    -0.5138,   0.906250,  0.625000,
-      -0.353553, -0.923880, -0.146447, -0.3584,   -0.9217,   -0.1484,
-      0.937500,  0.125000,  -0.513279, -0.831470, -0.212607, -0.5172,
-      -0.8286,   -0.2142,   0.937500,  0.187500,  -0.461939, -0.831470,
-      -0.308658, -0.4654,   -0.8286,   -0.3110,   0.906250,  0.187500,
-      -0.906127, 0.195090,  -0.375330, -0.9063,   0.1939,    -0.3754,
-      0.937500,  0.562500,  -0.853553, 0.382683,  -0.353553, -0.8544,
-      0.3805,    -0.3539,   0.937500,  0.625000,  -0.768177, 0.382683,
-      -0.513280, -0.7689,   0.3805,    -0.5138,   0.906250,  0.625000,
-      -0.353553, -0.923880, -0.146447, -0.3584,   -0.9217,   -0.1484,
-      0.937500,  0.125000,  -0.318189, -0.923880, -0.212607, -0.3225,
-      -0.9217,   -0.2155,   0.906250,  0.125000,  -0.162212, -0.980785,
-      -0.108386, -0.1671,   -0.9796,   -0.1117,   0.906250,  0.062500,
-      -0.923878, 0.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -0.906127, 0.195090,  -0.375330, -0.9063,
-      0.1939,    -0.3754,   0.937500,  0.562500,  -0.815493, 0.195090,
-      -0.544895, -0.8157,   0.1939,    -0.5450,   0.906250,  0.562500,
-      -0.923878, 0.000000,  -0.382683, -0.9239,   -0.0000,   -0.3827,
-      0.937500,  0.500000,  -0.831468, 0.000000,  -0.555570, -0.8315,
-      -0.0000,   -0.5556,   0.906250,  0.500000,  -0.815493, -0.195090,
-      -0.544895, -0.8157,   -0.1939,   -0.5450,   0.906250,  0.437500,
-      -0.353553, 0.923880,  -0.146447, -0.3584,   0.9217,    -0.1484,
-      0.937500,  0.875000,  -0.180240, 0.980785,  -0.074658, -0.1857,
-      0.9796,    -0.0769,   0.937500,  0.937500,  -0.162212, 0.980785,
-      -0.108386, -0.1671,   0.9796,    -0.1117,   0.906250,  0.937500,
-      -0.461939, -0.831470, -0.308658, -0.4654,   -0.8286,   -0.3110,
-      0.906250,  0.187500,  -0.392847, -0.831470, -0.392847, -0.3958,
-      -0.8286,   -0.3958,   0.875000,  0.187500,  -0.270598, -0.923880,
-      -0.270598, -0.2743,   -0.9217,   -0.2743,   0.875000,  0.125000,
-      -0.815493, 0.195090,  -0.544895, -0.8157,   0.1939,    -0.5450,
-      0.906250,  0.562500,  -0.768177, 0.382683,  -0.513280, -0.7689,
-      0.3805,    -0.5138,   0.906250,  0.625000,  -0.653281, 0.382683,
-      -0.653281, -0.6539,   0.3805,    -0.6539,   0.875000,  0.625000,
-      -0.318189, -0.923880, -0.212607, -0.3225,   -0.9217,   -0.2155,
-      0.906250,  0.125000,  -0.270598, -0.923880, -0.270598, -0.2743,
-      -0.9217,   -0.2743,   0.875000,  0.125000,  -0.137950, -0.980785,
-      -0.137950, -0.1421,   -0.9796,   -0.1421,   0.875000,  0.062500,
-      -0.831468, 0.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.906250,  0.500000,  -0.815493, 0.195090,  -0.544895, -0.8157,
-      0.1939,    -0.5450,   0.906250,  0.562500,  -0.693519, 0.195090,
-      -0.693520, -0.6937,   0.1939,    -0.6937,   0.875000,  0.562500,
-      -0.831468, 0.000000,  -0.555570, -0.8315,   -0.0000,   -0.5556,
-      0.906250,  0.500000,  -0.707106, 0.000000,  -0.707106, -0.7071,
-      -0.0000,   -0.7071,   0.875000,  0.500000,  -0.693519, -0.195090,
-      -0.693520, -0.6937,   -0.1939,   -0.6937,   0.875000,  0.437500,
-      -0.162212, 0.980785,  -0.108386, -0.1671,   0.9796,    -0.1117,
-      0.906250,  0.937500,  -0.137950, 0.980785,  -0.137950, -0.1421,
-      0.9796,    -0.1421,   0.875000,  0.937500,  -0.270598, 0.923880,
-      -0.270598, -0.2743,   0.9217,    -0.2743,   0.875000,  0.875000,
-      -0.815493, -0.195090, -0.544895, -0.8157,   -0.1939,   -0.5450,
-      0.906250,  0.437500,  -0.693519, -0.195090, -0.693520, -0.6937,
-      -0.1939,   -0.6937,   0.875000,  0.437500,  -0.653281, -0.382683,
-      -0.653281, -0.6539,   -0.3805,   -0.6539,   0.875000,  0.375000,
-      -0.461939, 0.831470,  -0.308658, -0.4654,   0.8286,    -0.3110,
-      0.906250,  0.812500,  -0.318189, 0.923880,  -0.212607, -0.3225,
-      0.9217,    -0.2155,   0.906250,  0.875000,  -0.270598, 0.923880,
-      -0.270598, -0.2743,   0.9217,    -0.2743,   0.875000,  0.875000,
-      -0.691341, -0.555570, -0.461940, -0.6929,   -0.5528,   -0.4630,
-      0.906250,  0.312500,  -0.768177, -0.382683, -0.513280, -0.7689,
-      -0.3805,   -0.5138,   0.906250,  0.375000,  -0.653281, -0.382683,
-      -0.653281, -0.6539,   -0.3805,   -0.6539,   0.875000,  0.375000,
-      -0.461939, 0.831470,  -0.308658, -0.4654,   0.8286,    -0.3110,
-      0.906250,  0.812500,  -0.392847, 0.831470,  -0.392847, -0.3958,
-      0.8286,    -0.3958,   0.875000,  0.812500,  -0.500000, 0.707107,
-      -0.500000, -0.5021,   0.7041,    -0.5021,   0.875000,  0.750000,
-      -0.691341, -0.555570, -0.461940, -0.6929,   -0.5528,   -0.4630,
-      0.906250,  0.312500,  -0.587937, -0.555570, -0.587938, -0.5893,
-      -0.5528,   -0.5893,   0.875000,  0.312500,  -0.500000, -0.707107,
-      -0.500000, -0.5021,   -0.7041,   -0.5021,   0.875000,  0.250000,
-      -0.691341, 0.555570,  -0.461940, -0.6929,   0.5528,    -0.4630,
-      0.906250,  0.687500,  -0.587938, 0.707107,  -0.392847, -0.5905,
-      0.7041,    -0.3945,   0.906250,  0.750000,  -0.500000, 0.707107,
-      -0.500000, -0.5021,   0.7041,    -0.5021,   0.875000,  0.750000,
-      -0.461939, -0.831470, -0.308658, -0.4654,   -0.8286,   -0.3110,
-      0.906250,  0.187500,  -0.587938, -0.707107, -0.392847, -0.5905,
-      -0.7041,   -0.3945,   0.906250,  0.250000,  -0.500000, -0.707107,
-      -0.500000, -0.5021,   -0.7041,   -0.5021,   0.875000,  0.250000,
-      -0.691341, 0.555570,  -0.461940, -0.6929,   0.5528,    -0.4630,
-      0.906250,  0.687500,  -0.587937, 0.555570,  -0.587938, -0.5893,
-      0.5528,    -0.5893,   0.875000,  0.687500,  -0.653281, 0.382683,
-      -0.653281, -0.6539,   0.3805,    -0.6539,   0.875000,  0.625000,
-      -0.392847, 0.831470,  -0.392847, -0.3958,   0.8286,    -0.3958,
-      0.875000,  0.812500,  -0.270598, 0.923880,  -0.270598, -0.2743,
-      0.9217,    -0.2743,   0.875000,  0.875000,  -0.212607, 0.923880,
-      -0.318190, -0.2155,   0.9217,    -0.3225,   0.843750,  0.875000,
-      -0.587937, -0.555570, -0.587938, -0.5893,   -0.5528,   -0.5893,
-      0.875000,  0.312500,  -0.653281, -0.382683, -0.653281, -0.6539,
-      -0.3805,   -0.6539,   0.875000,  0.375000,  -0.513280, -0.382683,
-      -0.768177, -0.5138,   -0.3805,   -0.7689,   0.843750,  0.375000,
-      -0.392847, 0.831470,  -0.392847, -0.3958,   0.8286,    -0.3958,
-      0.875000,  0.812500,  -0.308658, 0.831470,  -0.461939, -0.3110,
-      0.8286,    -0.4654,   0.843750,  0.812500,  -0.392847, 0.707107,
-      -0.587938, -0.3945,   0.7041,    -0.5905,   0.843750,  0.750000,
-      -0.587937, -0.555570, -0.587938, -0.5893,   -0.5528,   -0.5893,
-      0.875000,  0.312500,  -0.461939, -0.555570, -0.691341, -0.4630,
-      -0.5528,   -0.6929,   0.843750,  0.312500,  -0.392847, -0.707107,
-      -0.587938, -0.3945,   -0.7041,   -0.5905,   0.843750,  0.250000,
-      -0.587937, 0.555570,  -0.587938, -0.5893,   0.5528,    -0.5893,
-      0.875000,  0.687500,  -0.500000, 0.707107,  -0.500000, -0.5021,
-      0.7041,    -0.5021,   0.875000,  0.750000,  -0.392847, 0.707107,
-      -0.587938, -0.3945,   0.7041,    -0.5905,   0.843750,  0.750000,
-      -0.392847, -0.831470, -0.392847, -0.3958,   -0.8286,   -0.3958,
-      0.875000,  0.187500,  -0.500000, -0.707107, -0.500000, -0.5021,
-      -0.7041,   -0.5021,   0.875000,  0.250000,  -0.392847, -0.707107,
-      -0.587938, -0.3945,   -0.7041,   -0.5905,   0.843750,  0.250000,
-      -0.587937, 0.555570,  -0.587938, -0.5893,   0.5528,    -0.5893,
-      0.875000,  0.687500,  -0.461939, 0.555570,  -0.691341, -0.4630,
-      0.5528,    -0.6929,   0.843750,  0.687500,  -0.513280, 0.382683,
-      -0.768177, -0.5138,   0.3805,    -0.7689,   0.843750,  0.625000,
-      -0.392847, -0.831470, -0.392847, -0.3958,   -0.8286,   -0.3958,
-      0.875000,  0.187500,  -0.308658, -0.831470, -0.461939, -0.3110,
-      -0.8286,   -0.4654,   0.843750,  0.187500,  -0.212607, -0.923880,
-      -0.318190, -0.2155,   -0.9217,   -0.3225,   0.843750,  0.125000,
-      -0.693519, 0.195090,  -0.693520, -0.6937,   0.1939,    -0.6937,
-      0.875000,  0.562500,  -0.653281, 0.382683,  -0.653281, -0.6539,
-      0.3805,    -0.6539,   0.875000,  0.625000,  -0.513280, 0.382683,
-      -0.768177, -0.5138,   0.3805,    -0.7689,   0.843750,  0.625000,
-      -0.270598, -0.923880, -0.270598, -0.2743,   -0.9217,   -0.2743,
-      0.875000,  0.125000,  -0.212607, -0.923880, -0.318190, -0.2155,
-      -0.9217,   -0.3225,   0.843750,  0.125000,  -0.108386, -0.980785,
-      -0.162212, -0.1117,   -0.9796,   -0.1671,   0.843750,  0.062500,
-      -0.707106, 0.000000,  -0.707106, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.693519, 0.195090,  -0.693520, -0.6937,
-      0.1939,    -0.6937,   0.875000,  0.562500,  -0.544895, 0.195090,
-      -0.815493, -0.5450,   0.1939,    -0.8157,   0.843750,  0.562500,
-      -0.707106, 0.000000,  -0.707106, -0.7071,   -0.0000,   -0.7071,
-      0.875000,  0.500000,  -0.555569, 0.000000,  -0.831469, -0.5556,
-      -0.0000,   -0.8315,   0.843750,  0.500000,  -0.544895, -0.195090,
-      -0.815493, -0.5450,   -0.1939,   -0.8157,   0.843750,  0.437500,
-      -0.137950, 0.980785,  -0.137950, -0.1421,   0.9796,    -0.1421,
-      0.875000,  0.937500,  -0.108386, 0.980785,  -0.162212, -0.1117,
-      0.9796,    -0.1671,   0.843750,  0.937500,  -0.212607, 0.923880,
-      -0.318190, -0.2155,   0.9217,    -0.3225,   0.843750,  0.875000,
-      -0.693519, -0.195090, -0.693520, -0.6937,   -0.1939,   -0.6937,
-      0.875000,  0.437500,  -0.544895, -0.195090, -0.815493, -0.5450,
-      -0.1939,   -0.8157,   0.843750,  0.437500,  -0.513280, -0.382683,
-      -0.768177, -0.5138,   -0.3805,   -0.7689,   0.843750,  0.375000,
-      -0.544895, 0.195090,  -0.815493, -0.5450,   0.1939,    -0.8157,
-      0.843750,  0.562500,  -0.513280, 0.382683,  -0.768177, -0.5138,
-      0.3805,    -0.7689,   0.843750,  0.625000,  -0.353553, 0.382683,
-      -0.853553, -0.3539,   0.3805,    -0.8544,   0.812500,  0.625000,
-      -0.212607, -0.923880, -0.318190, -0.2155,   -0.9217,   -0.3225,
-      0.843750,  0.125000,  -0.146446, -0.923880, -0.353553, -0.1484,
-      -0.9217,   -0.3584,   0.812500,  0.125000,  -0.074658, -0.980785,
-      -0.180240, -0.0769,   -0.9796,   -0.1857,   0.812500,  0.062500,
-      -0.555569, 0.000000,  -0.831469, -0.5556,   -0.0000,   -0.8315,
-      0.843750,  0.500000,  -0.544895, 0.195090,  -0.815493, -0.5450,
-      0.1939,    -0.8157,   0.843750,  0.562500,  -0.375330, 0.195090,
-      -0.906127, -0.3754,   0.1939,    -0.9063,   0.812500,  0.562500,
-      -0.555569, 0.000000,  -0.831469, -0.5556,   -0.0000,   -0.8315,
-      0.843750,  0.500000,  -0.382683, 0.000000,  -0.923879, -0.3827,
-      -0.0000,   -0.9239,   0.812500,  0.500000,  -0.375330, -0.195090,
-      -0.906127, -0.3754,   -0.1939,   -0.9063,   0.812500,  0.437500,
-      -0.212607, 0.923880,  -0.318190, -0.2155,   0.9217,    -0.3225,
-      0.843750,  0.875000,  -0.108386, 0.980785,  -0.162212, -0.1117,
-      0.9796,    -0.1671,   0.843750,  0.937500,  -0.074658, 0.980785,
-      -0.180240, -0.0769,   0.9796,    -0.1857,   0.812500,  0.937500,
-      -0.544895, -0.195090, -0.815493, -0.5450,   -0.1939,   -0.8157,
-      0.843750,  0.437500,  -0.375330, -0.195090, -0.906127, -0.3754,
-      -0.1939,   -0.9063,   0.812500,  0.437500,  -0.353553, -0.382683,
-      -0.853553, -0.3539,   -0.3805,   -0.8544,   0.812500,  0.375000,
-      -0.212607, 0.923880,  -0.318190, -0.2155,   0.9217,    -0.3225,
-      0.843750,  0.875000,  -0.146446, 0.923880,  -0.353553, -0.1484,
-      0.9217,    -0.3584,   0.812500,  0.875000,  -0.212607, 0.831470,
-      -0.513279, -0.2142,   0.8286,    -0.5172,   0.812500,  0.812500,
-      -0.461939, -0.555570, -0.691341, -0.4630,   -0.5528,   -0.6929,
-      0.843750,  0.312500,  -0.513280, -0.382683, -0.768177, -0.5138,
-      -0.3805,   -0.7689,   0.843750,  0.375000,  -0.353553, -0.382683,
-      -0.853553, -0.3539,   -0.3805,   -0.8544,   0.812500,  0.375000,
-      -0.308658, 0.831470,  -0.461939, -0.3110,   0.8286,    -0.4654,
-      0.843750,  0.812500,  -0.212607, 0.831470,  -0.513279, -0.2142,
-      0.8286,    -0.5172,   0.812500,  0.812500,  -0.270598, 0.707107,
-      -0.653281, -0.2718,   0.7041,    -0.6561,   0.812500,  0.750000,
-      -0.461939, -0.555570, -0.691341, -0.4630,   -0.5528,   -0.6929,
-      0.843750,  0.312500,  -0.318189, -0.555570, -0.768177, -0.3189,
-      -0.5528,   -0.7699,   0.812500,  0.312500,  -0.270598, -0.707107,
-      -0.653281, -0.2718,   -0.7041,   -0.6561,   0.812500,  0.250000,
-      -0.461939, 0.555570,  -0.691341, -0.4630,   0.5528,    -0.6929,
-      0.843750,  0.687500,  -0.392847, 0.707107,  -0.587938, -0.3945,
-      0.7041,    -0.5905,   0.843750,  0.750000,  -0.270598, 0.707107,
-      -0.653281, -0.2718,   0.7041,    -0.6561,   0.812500,  0.750000,
-      -0.308658, -0.831470, -0.461939, -0.3110,   -0.8286,   -0.4654,
-      0.843750,  0.187500,  -0.392847, -0.707107, -0.587938, -0.3945,
-      -0.7041,   -0.5905,   0.843750,  0.250000,  -0.270598, -0.707107,
-      -0.653281, -0.2718,   -0.7041,   -0.6561,   0.812500,  0.250000,
-      -0.461939, 0.555570,  -0.691341, -0.4630,   0.5528,    -0.6929,
-      0.843750,  0.687500,  -0.318189, 0.555570,  -0.768177, -0.3189,
-      0.5528,    -0.7699,   0.812500,  0.687500,  -0.353553, 0.382683,
-      -0.853553, -0.3539,   0.3805,    -0.8544,   0.812500,  0.625000,
-      -0.308658, -0.831470, -0.461939, -0.3110,   -0.8286,   -0.4654,
-      0.843750,  0.187500,  -0.212607, -0.831470, -0.513279, -0.2142,
-      -0.8286,   -0.5172,   0.812500,  0.187500,  -0.146446, -0.923880,
-      -0.353553, -0.1484,   -0.9217,   -0.3584,   0.812500,  0.125000,
-      -0.318189, -0.555570, -0.768177, -0.3189,   -0.5528,   -0.7699,
-      0.812500,  0.312500,  -0.353553, -0.382683, -0.853553, -0.3539,
-      -0.3805,   -0.8544,   0.812500,  0.375000,  -0.180240, -0.382683,
-      -0.906127, -0.1804,   -0.3805,   -0.9070,   0.781250,  0.375000,
-      -0.212607, 0.831470,  -0.513279, -0.2142,   0.8286,    -0.5172,
-      0.812500,  0.812500,  -0.108386, 0.831470,  -0.544895, -0.1092,
-      0.8286,    -0.5490,   0.781250,  0.812500,  -0.137950, 0.707107,
-      -0.693520, -0.1385,   0.7041,    -0.6965,   0.781250,  0.750000,
-      -0.318189, -0.555570, -0.768177, -0.3189,   -0.5528,   -0.7699,
-      0.812500,  0.312500,  -0.162211, -0.555570, -0.815493, -0.1626,
-      -0.5528,   -0.8173,   0.781250,  0.312500,  -0.137950, -0.707107,
-      -0.693520, -0.1385,   -0.7041,   -0.6965,   0.781250,  0.250000,
-      -0.318189, 0.555570,  -0.768177, -0.3189,   0.5528,    -0.7699,
-      0.812500,  0.687500,  -0.270598, 0.707107,  -0.653281, -0.2718,
-      0.7041,    -0.6561,   0.812500,  0.750000,  -0.137950, 0.707107,
-      -0.693520, -0.1385,   0.7041,    -0.6965,   0.781250,  0.750000,
-      -0.212607, -0.831470, -0.513279, -0.2142,   -0.8286,   -0.5172,
-      0.812500,  0.187500,  -0.270598, -0.707107, -0.653281, -0.2718,
-      -0.7041,   -0.6561,   0.812500,  0.250000,  -0.137950, -0.707107,
-      -0.693520, -0.1385,   -0.7041,   -0.6965,   0.781250,  0.250000,
-      -0.318189, 0.555570,  -0.768177, -0.3189,   0.5528,    -0.7699,
-      0.812500,  0.687500,  -0.162211, 0.555570,  -0.815493, -0.1626,
-      0.5528,    -0.8173,   0.781250,  0.687500,  -0.180240, 0.382683,
-      -0.906127, -0.1804,   0.3805,    -0.9070,   0.781250,  0.625000,
-      -0.212607, -0.831470, -0.513279, -0.2142,   -0.8286,   -0.5172,
-      0.812500,  0.187500,  -0.108386, -0.831470, -0.544895, -0.1092,
-      -0.8286,   -0.5490,   0.781250,  0.187500,  -0.074658, -0.923880,
-      -0.375330, -0.0757,   -0.9217,   -0.3804,   0.781250,  0.125000,
-      -0.375330, 0.195090,  -0.906127, -0.3754,   0.1939,    -0.9063,
-      0.812500,  0.562500,  -0.353553, 0.382683,  -0.853553, -0.3539,
-      0.3805,    -0.8544,   0.812500,  0.625000,  -0.180240, 0.382683,
-      -0.906127, -0.1804,   0.3805,    -0.9070,   0.781250,  0.625000,
-      -0.074658, -0.980785, -0.180240, -0.0769,   -0.9796,   -0.1857,
-      0.812500,  0.062500,  -0.146446, -0.923880, -0.353553, -0.1484,
-      -0.9217,   -0.3584,   0.812500,  0.125000,  -0.074658, -0.923880,
-      -0.375330, -0.0757,   -0.9217,   -0.3804,   0.781250,  0.125000,
-      -0.382683, 0.000000,  -0.923879, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.375330, 0.195090,  -0.906127, -0.3754,
-      0.1939,    -0.9063,   0.812500,  0.562500,  -0.191341, 0.195090,
-      -0.961939, -0.1914,   0.1939,    -0.9622,   0.781250,  0.562500,
-      -0.382683, 0.000000,  -0.923879, -0.3827,   -0.0000,   -0.9239,
-      0.812500,  0.500000,  -0.195090, 0.000000,  -0.980784, -0.1951,
-      -0.0000,   -0.9808,   0.781250,  0.500000,  -0.191341, -0.195090,
-      -0.961939, -0.1914,   -0.1939,   -0.9622,   0.781250,  0.437500,
-      -0.074658, 0.980785,  -0.180240, -0.0769,   0.9796,    -0.1857,
-      0.812500,  0.937500,  -0.038060, 0.980785,  -0.191342, -0.0392,
-      0.9796,    -0.1971,   0.781250,  0.937500,  -0.074658, 0.923880,
-      -0.375330, -0.0757,   0.9217,    -0.3804,   0.781250,  0.875000,
-      -0.375330, -0.195090, -0.906127, -0.3754,   -0.1939,   -0.9063,
-      0.812500,  0.437500,  -0.191341, -0.195090, -0.961939, -0.1914,
-      -0.1939,   -0.9622,   0.781250,  0.437500,  -0.180240, -0.382683,
-      -0.906127, -0.1804,   -0.3805,   -0.9070,   0.781250,  0.375000,
-      -0.212607, 0.831470,  -0.513279, -0.2142,   0.8286,    -0.5172,
-      0.812500,  0.812500,  -0.146446, 0.923880,  -0.353553, -0.1484,
-      0.9217,    -0.3584,   0.812500,  0.875000,  -0.074658, 0.923880,
-      -0.375330, -0.0757,   0.9217,    -0.3804,   0.781250,  0.875000,
-      -0.074658, -0.923880, -0.375330, -0.0757,   -0.9217,   -0.3804,
-      0.781250,  0.125000,  0.000000,  -0.923880, -0.382683, -0.0000,
-      -0.9217,   -0.3879,   0.750000,  0.125000,  0.000000,  -0.980785,
-      -0.195090, -0.0000,   -0.9796,   -0.2010,   0.750000,  0.062500,
-      -0.195090, 0.000000,  -0.980784, -0.1951,   -0.0000,   -0.9808,
-      0.781250,  0.500000,  -0.191341, 0.195090,  -0.961939, -0.1914,
-      0.1939,    -0.9622,   0.781250,  0.562500,  0.000000,  0.195090,
-      -0.980785, -0.0000,   0.1939,    -0.9810,   0.750000,  0.562500,
-      -0.195090, 0.000000,  -0.980784, -0.1951,   -0.0000,   -0.9808,
-      0.781250,  0.500000,  0.000000,  0.000000,  -1.000000, -0.0000,
-      -0.0000,   -1.0000,   0.750000,  0.500000,  0.000000,  -0.195090,
-      -0.980785, -0.0000,   -0.1939,   -0.9810,   0.750000,  0.437500,
-      -0.074658, 0.923880,  -0.375330, -0.0757,   0.9217,    -0.3804,
-      0.781250,  0.875000,  -0.038060, 0.980785,  -0.191342, -0.0392,
-      0.9796,    -0.1971,   0.781250,  0.937500,  0.000000,  0.980785,
-      -0.195090, -0.0000,   0.9796,    -0.2010,   0.750000,  0.937500,
-      -0.191341, -0.195090, -0.961939, -0.1914,   -0.1939,   -0.9622,
-      0.781250,  0.437500,  0.000000,  -0.195090, -0.980785, -0.0000,
-      -0.1939,   -0.9810,   0.750000,  0.437500,  0.000000,  -0.382683,
-      -0.923879, -0.0000,   -0.3805,   -0.9248,   0.750000,  0.375000,
-      -0.108386, 0.831470,  -0.544895, -0.1092,   0.8286,    -0.5490,
-      0.781250,  0.812500,  -0.074658, 0.923880,  -0.375330, -0.0757,
-      0.9217,    -0.3804,   0.781250,  0.875000,  0.000000,  0.923880,
-      -0.382683, -0.0000,   0.9217,    -0.3879,   0.750000,  0.875000,
-      -0.180240, -0.382683, -0.906127, -0.1804,   -0.3805,   -0.9070,
-      0.781250,  0.375000,  0.000000,  -0.382683, -0.923879, -0.0000,
-      -0.3805,   -0.9248,   0.750000,  0.375000,  0.000000,  -0.555570,
-      -0.831470, -0.0000,   -0.5528,   -0.8333,   0.750000,  0.312500,
-      -0.137950, 0.707107,  -0.693520, -0.1385,   0.7041,    -0.6965,
-      0.781250,  0.750000,  -0.108386, 0.831470,  -0.544895, -0.1092,
-      0.8286,    -0.5490,   0.781250,  0.812500,  0.000000,  0.831470,
-      -0.555570, -0.0000,   0.8286,    -0.5598,   0.750000,  0.812500,
-      -0.162211, -0.555570, -0.815493, -0.1626,   -0.5528,   -0.8173,
-      0.781250,  0.312500,  0.000000,  -0.555570, -0.831470, -0.0000,
-      -0.5528,   -0.8333,   0.750000,  0.312500,  0.000000,  -0.707107,
-      -0.707107, -0.0000,   -0.7041,   -0.7101,   0.750000,  0.250000,
-      -0.162211, 0.555570,  -0.815493, -0.1626,   0.5528,    -0.8173,
-      0.781250,  0.687500,  -0.137950, 0.707107,  -0.693520, -0.1385,
-      0.7041,    -0.6965,   0.781250,  0.750000,  0.000000,  0.707107,
-      -0.707107, -0.0000,   0.7041,    -0.7101,   0.750000,  0.750000,
-      -0.108386, -0.831470, -0.544895, -0.1092,   -0.8286,   -0.5490,
-      0.781250,  0.187500,  -0.137950, -0.707107, -0.693520, -0.1385,
-      -0.7041,   -0.6965,   0.781250,  0.250000,  0.000000,  -0.707107,
-      -0.707107, -0.0000,   -0.7041,   -0.7101,   0.750000,  0.250000,
-      -0.180240, 0.382683,  -0.906127, -0.1804,   0.3805,    -0.9070,
-      0.781250,  0.625000,  -0.162211, 0.555570,  -0.815493, -0.1626,
-      0.5528,    -0.8173,   0.781250,  0.687500,  0.000000,  0.555570,
-      -0.831470, -0.0000,   0.5528,    -0.8333,   0.750000,  0.687500,
-      -0.108386, -0.831470, -0.544895, -0.1092,   -0.8286,   -0.5490,
-      0.781250,  0.187500,  0.000000,  -0.831470, -0.555570, -0.0000,
-      -0.8286,   -0.5598,   0.750000,  0.187500,  0.000000,  -0.923880,
-      -0.382683, -0.0000,   -0.9217,   -0.3879,   0.750000,  0.125000,
-      -0.191341, 0.195090,  -0.961939, -0.1914,   0.1939,    -0.9622,
-      0.781250,  0.562500,  -0.180240, 0.382683,  -0.906127, -0.1804,
-      0.3805,    -0.9070,   0.781250,  0.625000,  0.000000,  0.382683,
-      -0.923879, -0.0000,   0.3805,    -0.9248,   0.750000,  0.625000,
-  };
-  const unsigned int sphere_num_verts = 2880;
-  VAOBuilder sphere_builder;
-  sphere_builder.begin();
-  sphere_builder.m_index_count = sphere_num_verts;
-  sphere_builder.add_vertex_buffer(&sphere_vertex_data[0], 23040);
-  sphere_builder.add_vertex_attribute(0, 8 * sizeof(float), 3);
-  sphere_builder.add_vertex_attribute(1, 8 * sizeof(float), 3);
-  sphere_builder.add_vertex_attribute(2, 8 * sizeof(float), 2);
-
-  Shapes::s_sphere_vao = sphere_builder.build();
-  AABB sphere_bb{{0, 0, 0}, {1, 1, 1}};
-  Shapes::s_sphere_mesh =
-      Mesh{Shapes::s_sphere_vao, sphere_num_verts, sphere_bb, sphere_bb, 0};
-
-  Model sphere_model{};
-  sphere_model.m_meshes.push_back(Shapes::s_sphere_mesh);
-  sphere_model.m_aabb = Shapes::s_sphere_mesh.m_original_aabb;
-
-  am.provide_asset<Model, AssetType::model>("sphere", sphere_model);
+void add_primitives(AssetManager &am) {
+  ZoneScoped;
+  std::vector<float> vertices;
+  std::vector<uint32_t> indices;
+  vertices.reserve((s_cube_shape.vertex_count + s_sphere_shape.vertex_count +
+                    s_cylinder_shape.vertex_count + s_cone_shape.vertex_count +
+                    s_torus_shape.vertex_count) *
+                   ShapeGen::s_vertex_stride);
+  indices.reserve(s_cube_shape.index_count + s_sphere_shape.index_count +
+                  s_cylinder_shape.index_count + s_cone_shape.index_count +
+                  s_torus_shape.index_count);
+
+  Shapes::s_cube_mesh = append_shape(s_cube_shape, vertices, indices);
+  Shapes::s_sphere_mesh = append_shape(s_sphere_shape, vertices, indices);
+  Shapes::s_cylinder_mesh = append_shape(s_cylinder_shape, vertices, indices);
+  Shapes::s_cone_mesh = append_shape(s_cone_shape, vertices, indices);
+  Shapes::s_torus_mesh = append_shape(s_torus_shape, vertices, indices);
+
+  // every primitive lives in one vertex + index buffer pair, meshes only
+  // differ by index offset / count
+  const uint32_t stride = ShapeGen::s_vertex_stride * sizeof(float);
+  VAOBuilder primitives_builder;
+  primitives_builder.begin();
+  primitives_builder.add_vertex_buffer(vertices.data(),
+                                       static_cast<uint32_t>(vertices.size()));
+  primitives_builder.add_vertex_attribute(0, stride, 3);
+  primitives_builder.add_vertex_attribute(1, stride, 3);
+  primitives_builder.add_vertex_attribute(2, stride, 2);
+  primitives_builder.add_index_buffer(indices);
+  Shapes::s_primitives_vao = primitives_builder.build();
+
+  use_shared_vao(Shapes::s_cube_mesh, Shapes::s_primitives_vao);
+  use_shared_vao(Shapes::s_sphere_mesh, Shapes::s_primitives_vao);
+  use_shared_vao(Shapes::s_cylinder_mesh, Shapes::s_primitives_vao);
+  use_shared_vao(Shapes::s_cone_mesh, Shapes::s_primitives_vao);
+  use_shared_vao(Shapes::s_torus_mesh, Shapes::s_primitives_vao);
+
+  Shapes::s_cube_vao = Shapes::s_cube_mesh.m_vao;
+  Shapes::s_sphere_vao = Shapes::s_sphere_mesh.m_vao;
+  Shapes::s_cylinder_vao = Shapes::s_cylinder_mesh.m_vao;
+  Shapes::s_cone_vao = Shapes::s_cone_mesh.m_vao;
+  Shapes::s_torus_vao = Shapes::s_torus_mesh.m_vao;
+
+  provide_shape_model(am, "cube", Shapes::s_cube_mesh);
+  provide_shape_model(am, "sphere", Shapes::s_sphere_mesh);
+  provide_shape_model(am, "cylinder", Shapes::s_cylinder_mesh);
+  provide_shape_model(am, "cone", Shapes::s_cone_mesh);
+  provide_shape_model(am, "torus", Shapes::s_torus_mesh);
 }
 
 void add_cube_pos_only() {
@@ -9486,10 +227,6 @@ void Shapes::init_built_in_assets(AssetManager &am) {
   ZoneScoped;
   add_screen_quad();
   add_cube_pos_only();
-  add_cube(am);
-  add_sphere(am);
-  add_cylinder(am);
-  add_cone(am);
-  add_torus(am);
+  add_primitives(am);
 }
 } // namespace gem
\ No newline at end of file
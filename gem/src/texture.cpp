@@ -4,16 +4,19 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include "gem/backend.h"
 #include "gem/gl/gl_dbg.h"
+#include "gem/gl/gl_state.h"
+#include "gem/gl/gl_texture_streamer.h"
 #include "gem/profile.h"
 #include "gem/stb_image.h"
 #include "gem/texture.h"
+#include "gem/texture_compression.h"
 #include "gem/utils.h"
 
 namespace gem {
 
 Texture::Texture() { ZoneScoped; }
 
-Texture::Texture(const std::string &path) {
+Texture::Texture(const std::string &path, TextureMapType map_type) {
   ZoneScoped;
   std::string compressed_format_type = "";
   int block_size = -1;
@@ -23,7 +26,7 @@ Texture::Texture(const std::string &path) {
   if (path.find("dds") != std::string::npos) {
     load_texture_gli(data);
   } else {
-    load_texture_stbi(data);
+    load_texture_stbi(data, map_type);
   }
 }
 
@@ -33,29 +36,26 @@ Texture::Texture(const std::string &path, std::vector<unsigned char> data) {
 
 Texture::~Texture() { ZoneScoped; }
 
-void Texture::bind_sampler(GLenum texture_slot, GLenum texture_target) {
+void Texture::bind_sampler(GLenum texture_slot) {
   ZoneScoped;
-  bind_sampler_handle(m_handle, texture_slot, texture_target);
+  bind_sampler_handle(m_handle, texture_slot);
 }
 
-void Texture::bind_sampler_handle(gl_handle handle, GLenum texture_slot,
-                                  GLenum texture_target) {
+void Texture::bind_sampler_handle(gl_handle handle, GLenum texture_slot) {
   ZoneScoped;
-  glAssert(glActiveTexture(texture_slot));
-  glAssert(glBindTexture(texture_target, handle));
+  GLState::bind_texture(texture_slot - GL_TEXTURE0, handle);
 }
 
 void Texture::bind_image_handle(gl_handle handle, uint32_t binding,
                                 uint32_t mip_level, GLenum format) {
   ZoneScoped;
-  glAssert(glBindImageTexture(binding, handle, mip_level, GL_TRUE, 0,
-                              GL_READ_WRITE, format));
+  GLState::bind_image(binding, handle, mip_level, true, 0, GL_READ_WRITE,
+                      format);
 }
 
 void Texture::unbind_image(uint32_t binding) {
   ZoneScoped;
-  glAssert(
-      glBindImageTexture(binding, 0, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA8));
+  GLState::bind_image(binding, 0, 0, false, 0, GL_READ_WRITE, GL_RGBA8);
 }
 
 Texture Texture::from_data(unsigned int *data, unsigned int count, int width,
@@ -64,6 +64,8 @@ Texture Texture::from_data(unsigned int *data, unsigned int count, int width,
   Texture t{};
   glGenTextures(1, &t.m_handle);
   glBindTexture(GL_TEXTURE_2D, t.m_handle);
+  // edits through the active unit, which the state cache never changes
+  GLState::invalidate_texture_unit(0);
 
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -87,6 +89,7 @@ Texture Texture::create_3d_texture(glm::ivec3 dim, GLenum format,
   Texture t{};
   glAssert(glGenTextures(1, &t.m_handle));
   glAssert(glBindTexture(GL_TEXTURE_3D, t.m_handle));
+  GLState::invalidate_texture_unit(0);
 
   glAssert(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, wrap_mode));
   glAssert(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrap_mode));
@@ -111,6 +114,7 @@ Texture Texture::create_3d_texture_empty(glm::ivec3 dim, GLenum format,
   Texture t{};
   glAssert(glGenTextures(1, &t.m_handle));
   glAssert(glBindTexture(GL_TEXTURE_3D, t.m_handle));
+  GLState::invalidate_texture_unit(0);
 
   glAssert(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, wrap_mode));
   glAssert(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrap_mode));
@@ -130,20 +134,43 @@ Texture Texture::create_3d_texture_empty(glm::ivec3 dim, GLenum format,
   return t;
 }
 
-void Texture::load_texture_stbi(std::vector<unsigned char> &data) {
+void Texture::load_texture_stbi(std::vector<unsigned char> &data,
+                                TextureMapType map_type) {
   ZoneScoped;
-  // TODO: Split up STBI and GLI CPU loading and GL submission
-  //  STBI CPU processing taking 22ms in release, only 2ms to submit to GPU
   m_mode = Mode::stb;
+  m_cpu_data.mip_chain = nullptr;
   unsigned char *stbi_data = nullptr;
 
   stbi_set_flip_vertically_on_load(1);
+  // always expand to rgba8 so the mip filter / encoders see one layout
   stbi_data = stbi_load_from_memory(data.data(), data.size(), &m_width,
-                                    &m_height, &m_num_channels, 0);
+                                    &m_height, &m_num_channels, 4);
   if (!stbi_data) {
     return;
   }
-  m_cpu_data.stb_data = stbi_data;
+
+  bool has_alpha = false;
+  if (m_num_channels == 2 || m_num_channels == 4) {
+    const size_t texel_count = static_cast<size_t>(m_width) * m_height;
+    for (size_t i = 0; i < texel_count && !has_alpha; i++) {
+      has_alpha = stbi_data[i * 4 + 3] != 255;
+    }
+  }
+
+  TextureMipChain *chain = new TextureMipChain();
+  chain->m_levels = TextureCompression::generate_mips(
+      stbi_data, m_width, m_height, map_type == TextureMapType::normal);
+  stbi_image_free(stbi_data);
+
+  if (s_block_compress) {
+    ZoneScopedN("Block Compress");
+    chain->m_block_format =
+        TextureCompression::get_block_format(map_type, has_alpha);
+    for (auto &level : chain->m_levels) {
+      level.m_data = TextureCompression::encode(level, chain->m_block_format);
+    }
+  }
+  m_cpu_data.mip_chain = chain;
 }
 
 void Texture::load_texture_gli(std::vector<unsigned char> &data) {
@@ -160,26 +187,143 @@ void Texture::load_texture_gli(std::vector<unsigned char> &data) {
 }
 void Texture::release() {
   ZoneScoped;
-  glDeleteTextures(1, &m_handle);
+  // textures loaded but never submitted still own their chain
+  if (m_mode == Mode::stb && m_cpu_data.mip_chain != nullptr) {
+    GLTextureStreamer::unregister_texture(this);
+    delete m_cpu_data.mip_chain;
+    m_cpu_data.mip_chain = nullptr;
+  }
+  if (m_handle != INVALID_GL_HANDLE) {
+    glDeleteTextures(1, &m_handle);
+    m_handle = INVALID_GL_HANDLE;
+  }
+}
+
+bool Texture::is_streamed() const {
+  return m_mode == Mode::stb && m_handle != INVALID_GL_HANDLE &&
+         m_cpu_data.mip_chain != nullptr;
+}
+
+u64 Texture::get_mip_level_size(i32 level) const {
+  return m_cpu_data.mip_chain->m_levels[level].m_data.size();
+}
+
+void Texture::upload_mip_level(i32 level) {
+  ZoneScoped;
+  upload_stream_level(level);
+  m_stream_resident_level = level;
+  apply_stream_lod();
+}
+
+void Texture::evict_mip_level(i32 level) {
+  ZoneScoped;
+  m_stream_resident_level = level + 1;
+  apply_stream_lod();
+  // the allocation stays, the driver may drop the contents
+  glAssert(glInvalidateTexImage(m_handle, level));
+}
+
+i32 Texture::get_resident_level() const {
+  return is_streamed() ? m_stream_resident_level : 0;
+}
+
+void Texture::freeze_stream_lod() {
+  if (!is_streamed() || m_stream_lod_frozen) {
+    return;
+  }
+  glAssert(glTextureParameteri(m_handle, GL_TEXTURE_BASE_LEVEL, 0));
+  glAssert(glTextureParameterf(m_handle, GL_TEXTURE_MIN_LOD, -1000.0f));
+  m_stream_lod_frozen = true;
+}
+
+void Texture::upload_stream_level(i32 level) {
+  ZoneScoped;
+  TextureMipChain *chain = m_cpu_data.mip_chain;
+  const TextureMip &mip = chain->m_levels[level];
+  if (chain->m_block_format == TextureBlockFormat::none) {
+    glAssert(glTextureSubImage2D(m_handle, level, 0, 0, mip.m_width,
+                                 mip.m_height, GL_RGBA, GL_UNSIGNED_BYTE,
+                                 mip.m_data.data()));
+  } else {
+    glAssert(glCompressedTextureSubImage2D(
+        m_handle, level, 0, 0, mip.m_width, mip.m_height,
+        chain->get_gl_internal_format(),
+        static_cast<GLsizei>(mip.m_data.size()), mip.m_data.data()));
+  }
+}
+
+void Texture::apply_stream_lod() {
+  if (m_stream_lod_frozen) {
+    return;
+  }
+  glAssert(glTextureParameteri(m_handle, GL_TEXTURE_BASE_LEVEL,
+                               m_stream_resident_level));
+  glAssert(glTextureParameterf(m_handle, GL_TEXTURE_MIN_LOD,
+                               static_cast<float>(m_stream_resident_level)));
 }
 
 void Texture::submit_to_gpu() {
   if (m_mode == Mode::stb) {
     ZoneScopedN("STBI Submit to GPU");
+    TextureMipChain *chain = m_cpu_data.mip_chain;
+    if (chain == nullptr || chain->m_levels.empty()) {
+      spdlog::error("texture::submit_to_gpu : no cpu mip chain to submit");
+      return;
+    }
+
+    const GLenum internal_format = chain->get_gl_internal_format();
+    const GLsizei level_count = static_cast<GLsizei>(chain->m_levels.size());
+    const i32 tail_level = GLTextureStreamer::get_tail_level(*chain);
+
+    if (GLTextureStreamer::s_enabled && tail_level > 0) {
+      // only the mip tail goes up now, the streamer brings in the rest
+      glAssert(glCreateTextures(GL_TEXTURE_2D, 1, &m_handle));
+      glAssert(glTextureParameteri(m_handle, GL_TEXTURE_WRAP_S, GL_REPEAT));
+      glAssert(glTextureParameteri(m_handle, GL_TEXTURE_WRAP_T, GL_REPEAT));
+      glAssert(glTextureParameteri(m_handle, GL_TEXTURE_MIN_FILTER,
+                                   GL_LINEAR_MIPMAP_LINEAR));
+      glAssert(
+          glTextureParameteri(m_handle, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+      glAssert(glTextureStorage2D(m_handle, level_count, internal_format,
+                                  m_width, m_height));
+      for (i32 level = tail_level; level < level_count; level++) {
+        upload_stream_level(level);
+      }
+      m_stream_resident_level = tail_level;
+      m_stream_requested_level = tail_level;
+      m_stream_lod_frozen = false;
+      apply_stream_lod();
+      GLTextureStreamer::register_texture(this);
+      return;
+    }
+
     glGenTextures(1, &m_handle);
     glBindTexture(GL_TEXTURE_2D, m_handle);
+    GLState::invalidate_texture_unit(0);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
                     GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    GLenum format = m_num_channels == 4 ? GL_RGBA : GL_RGB;
-
-    glTexImage2D(GL_TEXTURE_2D, 0, format, m_width, m_height, 0, format,
-                 GL_UNSIGNED_BYTE, m_cpu_data.stb_data);
-    glGenerateMipmap(GL_TEXTURE_2D);
-    stbi_image_free(m_cpu_data.stb_data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level_count - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    // mips are generated on the loader thread, no glGenerateMipmap here
+    glTexStorage2D(GL_TEXTURE_2D, level_count, internal_format, m_width,
+                   m_height);
+    for (GLsizei level = 0; level < level_count; level++) {
+      TextureMip &mip = chain->m_levels[level];
+      if (chain->m_block_format == TextureBlockFormat::none) {
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, mip.m_width, mip.m_height,
+                        GL_RGBA, GL_UNSIGNED_BYTE, mip.m_data.data());
+      } else {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, mip.m_width,
+                                  mip.m_height, internal_format,
+                                  static_cast<GLsizei>(mip.m_data.size()),
+                                  mip.m_data.data());
+      }
+    }
+    delete chain;
+    m_cpu_data.mip_chain = nullptr;
   } else if (m_mode == Mode::gli) {
     ZoneScopedN("GLI Submit to GPU");
     gli::gl GL(gli::gl::PROFILE_GL33);
@@ -189,6 +333,7 @@ void Texture::submit_to_gpu() {
 
     glGenTextures(1, &m_handle);
     glBindTexture(target, m_handle);
+    GLState::invalidate_texture_unit(0);
     glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
     glTexParameteri(target, GL_TEXTURE_MAX_LEVEL,
                     static_cast<GLint>(m_cpu_data.gli_data->levels() - 1));
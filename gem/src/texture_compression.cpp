@@ -0,0 +1,340 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "gem/texture_compression.h"
+#include "gem/profile.h"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define GEM_TEXTURE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace gem {
+
+GLenum TextureMipChain::get_gl_internal_format() const {
+  switch (m_block_format) {
+  case TextureBlockFormat::bc1:
+    return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+  case TextureBlockFormat::bc3:
+    return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+  case TextureBlockFormat::bc5:
+    return GL_COMPRESSED_RG_RGTC2;
+  default:
+    return GL_RGBA8;
+  }
+}
+
+void box_filter_row(const u8 *row0, const u8 *row1, i32 src_width, u8 *dst,
+                    i32 dst_width) {
+  i32 x = 0;
+#ifdef GEM_TEXTURE_SSE2
+  // two output texels per iteration, needs 4 source texels on each row
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i round = _mm_set1_epi16(2);
+  for (; x + 1 < dst_width && (x * 2 + 3) < src_width; x += 2) {
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 8));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 8));
+
+    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(r0, zero),
+                               _mm_unpacklo_epi8(r1, zero));
+    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(r0, zero),
+                               _mm_unpackhi_epi8(r1, zero));
+    // sum horizontally adjacent texels
+    lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+    hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+
+    __m128i sum = _mm_unpacklo_epi64(lo, hi);
+    sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + x * 4),
+                     _mm_packus_epi16(sum, zero));
+  }
+#endif
+  for (; x < dst_width; x++) {
+    const i32 x0 = std::min(x * 2, src_width - 1);
+    const i32 x1 = std::min(x * 2 + 1, src_width - 1);
+    for (i32 c = 0; c < 4; c++) {
+      const u32 sum = row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] +
+                      row1[x1 * 4 + c];
+      dst[x * 4 + c] = static_cast<u8>((sum + 2) / 4);
+    }
+  }
+}
+
+TextureMip TextureCompression::downsample(const TextureMip &src,
+                                          bool renormalize) {
+  ZoneScoped;
+  TextureMip dst{};
+  dst.m_width = std::max(1, src.m_width / 2);
+  dst.m_height = std::max(1, src.m_height / 2);
+  dst.m_data.resize(static_cast<size_t>(dst.m_width) * dst.m_height * 4);
+
+  const size_t src_pitch = static_cast<size_t>(src.m_width) * 4;
+  for (i32 y = 0; y < dst.m_height; y++) {
+    const i32 y0 = std::min(y * 2, src.m_height - 1);
+    const i32 y1 = std::min(y * 2 + 1, src.m_height - 1);
+    box_filter_row(&src.m_data[y0 * src_pitch], &src.m_data[y1 * src_pitch],
+                   src.m_width, &dst.m_data[y * dst.m_width * 4], dst.m_width);
+  }
+
+  if (renormalize) {
+    for (size_t i = 0; i < dst.m_data.size(); i += 4) {
+      float n[3];
+      for (int c = 0; c < 3; c++) {
+        n[c] = dst.m_data[i + c] / 127.5f - 1.0f;
+      }
+      const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+      if (len < 1e-5f) {
+        continue;
+      }
+      for (int c = 0; c < 3; c++) {
+        dst.m_data[i + c] = static_cast<u8>(
+            std::clamp((n[c] / len + 1.0f) * 127.5f + 0.5f, 0.0f, 255.0f));
+      }
+    }
+  }
+  return dst;
+}
+
+std::vector<TextureMip> TextureCompression::generate_mips(const u8 *rgba,
+                                                          i32 width, i32 height,
+                                                          bool renormalize) {
+  ZoneScoped;
+  std::vector<TextureMip> levels;
+  TextureMip base{};
+  base.m_width = width;
+  base.m_height = height;
+  base.m_data.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+  levels.push_back(std::move(base));
+
+  while (levels.back().m_width > 1 || levels.back().m_height > 1) {
+    levels.push_back(downsample(levels.back(), renormalize));
+  }
+  return levels;
+}
+
+void TextureCompression::init_gl_support() {
+  ZoneScoped;
+  s_s3tc_supported = GLEW_EXT_texture_compression_s3tc;
+  if (!s_s3tc_supported) {
+    spdlog::info("texture compression : no S3TC, colour textures load "
+                 "uncompressed");
+  }
+}
+
+TextureBlockFormat TextureCompression::get_block_format(TextureMapType map_type,
+                                                        bool has_alpha) {
+  switch (map_type) {
+  case TextureMapType::normal:
+    // tangent space z is reconstructed in the shader
+    return TextureBlockFormat::bc5;
+  default:
+    if (!s_s3tc_supported) {
+      return TextureBlockFormat::none;
+    }
+    return has_alpha ? TextureBlockFormat::bc3 : TextureBlockFormat::bc1;
+  }
+}
+
+u32 TextureCompression::get_block_size(TextureBlockFormat format) {
+  switch (format) {
+  case TextureBlockFormat::bc1:
+    return 8;
+  case TextureBlockFormat::bc3:
+  case TextureBlockFormat::bc5:
+    return 16;
+  default:
+    return 0;
+  }
+}
+
+std::vector<u8> TextureCompression::encode(const TextureMip &level,
+                                           TextureBlockFormat format) {
+  ZoneScoped;
+  if (format == TextureBlockFormat::none) {
+    return level.m_data;
+  }
+
+  const i32 blocks_x = (level.m_width + 3) / 4;
+  const i32 blocks_y = (level.m_height + 3) / 4;
+  const u32 block_size = get_block_size(format);
+  std::vector<u8> out(static_cast<size_t>(blocks_x) * blocks_y * block_size);
+
+  u8 block[64];
+  for (i32 by = 0; by < blocks_y; by++) {
+    for (i32 bx = 0; bx < blocks_x; bx++) {
+      // clamp reads so levels smaller than 4x4 replicate their edge texels
+      for (i32 py = 0; py < 4; py++) {
+        const i32 y = std::min(by * 4 + py, level.m_height - 1);
+        for (i32 px = 0; px < 4; px++) {
+          const i32 x = std::min(bx * 4 + px, level.m_width - 1);
+          std::memcpy(&block[(py * 4 + px) * 4],
+                      &level.m_data[(static_cast<size_t>(y) * level.m_width + x) * 4],
+                      4);
+        }
+      }
+
+      u8 *dst = &out[(static_cast<size_t>(by) * blocks_x + bx) * block_size];
+      switch (format) {
+      case TextureBlockFormat::bc1:
+        encode_bc1_block(block, dst);
+        break;
+      case TextureBlockFormat::bc3:
+        encode_bc3_block(block, dst);
+        break;
+      case TextureBlockFormat::bc5:
+        encode_bc5_block(block, dst);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  return out;
+}
+
+u16 pack_565(const i32 *rgb) {
+  const u16 r = static_cast<u16>((rgb[0] * 31 + 127) / 255);
+  const u16 g = static_cast<u16>((rgb[1] * 63 + 127) / 255);
+  const u16 b = static_cast<u16>((rgb[2] * 31 + 127) / 255);
+  return static_cast<u16>((r << 11) | (g << 5) | b);
+}
+
+void unpack_565(u16 c, i32 *rgb) {
+  const i32 r = (c >> 11) & 31;
+  const i32 g = (c >> 5) & 63;
+  const i32 b = c & 31;
+  rgb[0] = (r << 3) | (r >> 2);
+  rgb[1] = (g << 2) | (g >> 4);
+  rgb[2] = (b << 3) | (b >> 2);
+}
+
+void TextureCompression::encode_bc1_block(const u8 *block, u8 *out) {
+  i32 min[3] = {255, 255, 255};
+  i32 max[3] = {0, 0, 0};
+  i32 mean[3] = {0, 0, 0};
+  for (i32 i = 0; i < 16; i++) {
+    for (i32 c = 0; c < 3; c++) {
+      min[c] = std::min<i32>(min[c], block[i * 4 + c]);
+      max[c] = std::max<i32>(max[c], block[i * 4 + c]);
+      mean[c] += block[i * 4 + c];
+    }
+  }
+  for (i32 c = 0; c < 3; c++) {
+    mean[c] = (mean[c] + 8) / 16;
+  }
+
+  // pick the bounding box diagonal that best follows the colour distribution
+  i32 cov_rg = 0;
+  i32 cov_rb = 0;
+  for (i32 i = 0; i < 16; i++) {
+    const i32 r = block[i * 4 + 0] - mean[0];
+    cov_rg += r * (block[i * 4 + 1] - mean[1]);
+    cov_rb += r * (block[i * 4 + 2] - mean[2]);
+  }
+  if (cov_rg < 0) {
+    std::swap(min[1], max[1]);
+  }
+  if (cov_rb < 0) {
+    std::swap(min[2], max[2]);
+  }
+
+  // inset the endpoints slightly to reduce the error of the extremes
+  for (i32 c = 0; c < 3; c++) {
+    const i32 inset = (max[c] - min[c]) / 16;
+    max[c] -= inset;
+    min[c] += inset;
+  }
+
+  u16 c0 = pack_565(max);
+  u16 c1 = pack_565(min);
+  if (c0 < c1) {
+    std::swap(c0, c1);
+  }
+
+  out[0] = static_cast<u8>(c0 & 0xFF);
+  out[1] = static_cast<u8>(c0 >> 8);
+  out[2] = static_cast<u8>(c1 & 0xFF);
+  out[3] = static_cast<u8>(c1 >> 8);
+
+  u32 indices = 0;
+  if (c0 != c1) {
+    i32 palette[4][3];
+    unpack_565(c0, palette[0]);
+    unpack_565(c1, palette[1]);
+    for (i32 c = 0; c < 3; c++) {
+      palette[2][c] = (palette[0][c] * 2 + palette[1][c]) / 3;
+      palette[3][c] = (palette[0][c] + palette[1][c] * 2) / 3;
+    }
+
+    for (i32 i = 0; i < 16; i++) {
+      u32 best = 0;
+      i32 best_dist = INT32_MAX;
+      for (u32 p = 0; p < 4; p++) {
+        i32 dist = 0;
+        for (i32 c = 0; c < 3; c++) {
+          const i32 d = block[i * 4 + c] - palette[p][c];
+          dist += d * d;
+        }
+        if (dist < best_dist) {
+          best_dist = dist;
+          best = p;
+        }
+      }
+      indices |= best << (i * 2);
+    }
+  }
+
+  out[4] = static_cast<u8>(indices & 0xFF);
+  out[5] = static_cast<u8>((indices >> 8) & 0xFF);
+  out[6] = static_cast<u8>((indices >> 16) & 0xFF);
+  out[7] = static_cast<u8>((indices >> 24) & 0xFF);
+}
+
+void TextureCompression::encode_bc4_block(const u8 *block, u32 channel,
+                                          u8 *out) {
+  i32 min = 255;
+  i32 max = 0;
+  for (i32 i = 0; i < 16; i++) {
+    min = std::min<i32>(min, block[i * 4 + channel]);
+    max = std::max<i32>(max, block[i * 4 + channel]);
+  }
+
+  // a0 > a1 selects the 8 value interpolation mode
+  out[0] = static_cast<u8>(max);
+  out[1] = static_cast<u8>(min);
+
+  u64 indices = 0;
+  if (max != min) {
+    const i32 range = max - min;
+    for (i32 i = 0; i < 16; i++) {
+      const i32 level =
+          ((block[i * 4 + channel] - min) * 7 + range / 2) / range;
+      u64 index = 0;
+      if (level == 7) {
+        index = 0;
+      } else if (level == 0) {
+        index = 1;
+      } else {
+        index = static_cast<u64>(8 - level);
+      }
+      indices |= index << (i * 3);
+    }
+  }
+
+  for (i32 i = 0; i < 6; i++) {
+    out[2 + i] = static_cast<u8>((indices >> (i * 8)) & 0xFF);
+  }
+}
+
+void TextureCompression::encode_bc3_block(const u8 *block, u8 *out) {
+  encode_bc4_block(block, 3, out);
+  encode_bc1_block(block, out + 8);
+}
+
+void TextureCompression::encode_bc5_block(const u8 *block, u8 *out) {
+  encode_bc4_block(block, 0, out);
+  encode_bc4_block(block, 1, out + 8);
+}
+} // namespace gem
@@ -51,15 +51,14 @@ void Utils::save_binary_to_path(const std::string &path,
                                 std::vector<u8> &bytes) {
   ZoneScoped;
   {
-    std::ofstream out(path);
+    std::ofstream out(path, std::ios::binary);
 
     if (!out.is_open()) {
       return;
     }
 
-    for (u8 b : bytes) {
-      out << b;
-    }
+    out.write(reinterpret_cast<const char *>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size()));
   }
 }
 
@@ -1,29 +1,36 @@
 #include "gem/vertex.h"
+#include "gem/gl/gl_state.h"
 #include "gem/profile.h"
 
 namespace gem {
 
 void VAO::use() {
   ZoneScoped;
-  glBindVertexArray(m_vao_id);
+  GLState::bind_vertex_array(m_vao_id);
 }
 void VAO::release() {
   ZoneScoped;
+  if (!m_owns_buffers) {
+    return;
+  }
   if (m_ibo > 0) {
     glDeleteBuffers(1, &m_ibo);
   }
   if (!m_vbos.empty()) {
     glDeleteBuffers(m_vbos.size(), m_vbos.data());
   }
+  GLState::invalidate();
   glDeleteVertexArrays(1, &m_vao_id);
 }
 void VAO::draw() {
   use();
   if (m_ibo != INVALID_GL_HANDLE) {
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_index_count),
-                   GL_UNSIGNED_INT, 0);
+                   GL_UNSIGNED_INT,
+                   (void *)(sizeof(uint32_t) * m_index_offset));
   } else {
-    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_index_count));
+    glDrawArrays(GL_TRIANGLES, static_cast<GLint>(m_index_offset),
+                 static_cast<GLsizei>(m_index_count));
   }
 }
 
@@ -33,7 +40,7 @@ void VAOBuilder::begin() {
   m_ibo = INVALID_GL_HANDLE;
   m_vbos.clear();
   glGenVertexArrays(1, &m_vao);
-  glBindVertexArray(m_vao);
+  GLState::bind_vertex_array(m_vao);
 }
 
 void VAOBuilder::add_index_buffer(uint32_t *data, uint32_t data_count) {
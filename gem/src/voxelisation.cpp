@@ -211,8 +211,7 @@ void Voxel::GridVisualizer::dispatch_draw(Voxel::Grid &vg, Camera &cam) {
   vs.set_vec3("u_aabb.min", vg.current_bounding_box.m_min);
   vs.set_vec3("u_aabb.max", vg.current_bounding_box.m_max);
   vs.set_int("u_volume", 0);
-  Texture::bind_sampler_handle(vg.voxel_texture.m_handle, GL_TEXTURE0,
-                               GL_TEXTURE_3D);
+  Texture::bind_sampler_handle(vg.voxel_texture.m_handle, GL_TEXTURE0);
   glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(m_index_count),
                           GL_UNSIGNED_INT, GL_ZERO, m_total_invocations);
   Texture::bind_sampler_handle(0, GL_TEXTURE0);
@@ -1,5 +1,534 @@
 #include "gem/gem.h"
+#include "gem/shape_gen.h"
+#include "gem/culling.h"
+#include "gem/dynamic_resolution.h"
+#include "gem/gl/gl_draw_list.h"
+#include "gem/parallel.h"
+#include "gem/texture_compression.h"
 #include "gem_test.h"
+#include "gtc/matrix_transform.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <tuple>
+
+// indices in range, bounds enclose the vertices tightly, normals are unit
+template <typename _Shape>
+static bool check_shape(const _Shape &shape, u32 vertex_count,
+                        u32 index_count) {
+  if (_Shape::vertex_count != vertex_count ||
+      _Shape::index_count != index_count || index_count % 3 != 0) {
+    return false;
+  }
+  for (u32 index : shape.m_indices) {
+    if (index >= _Shape::vertex_count) {
+      return false;
+    }
+  }
+
+  constexpr u32 stride = gem::ShapeGen::s_vertex_stride;
+  float min[3] = {INFINITY, INFINITY, INFINITY};
+  float max[3] = {-INFINITY, -INFINITY, -INFINITY};
+  for (u32 v = 0; v < _Shape::vertex_count; v++) {
+    const float *vertex = &shape.m_vertices[v * stride];
+    for (u32 axis = 0; axis < 3; axis++) {
+      min[axis] = std::min(min[axis], vertex[axis]);
+      max[axis] = std::max(max[axis], vertex[axis]);
+    }
+    const float length = std::sqrt(vertex[3] * vertex[3] +
+                                   vertex[4] * vertex[4] +
+                                   vertex[5] * vertex[5]);
+    if (std::abs(length - 1.0f) > 1e-3f) {
+      return false;
+    }
+  }
+  for (u32 axis = 0; axis < 3; axis++) {
+    if (std::abs(min[axis] - shape.m_min[axis]) > 1e-3f ||
+        std::abs(max[axis] - shape.m_max[axis]) > 1e-3f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// every compiled cull path against scalar, whole batches and ranges that
+// start and end off lane boundaries
+static bool check_cull_paths(u32 count, u32 seed) {
+  using SimdPath = gem::FrustumCuller::SimdPath;
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> size(0.05f, 8.0f);
+  std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+  gem::FrustumCuller culler{};
+  culler.resize(count);
+  for (u32 i = 0; i < count; i++) {
+    const glm::vec3 half(size(rng), size(rng), size(rng));
+    const glm::mat4 model = glm::rotate(
+        glm::translate(glm::mat4(1.0f),
+                       glm::vec3(position(rng), position(rng), position(rng))),
+        angle(rng), glm::normalize(glm::vec3(0.3f, 1.0f, -0.2f)));
+    culler.set(i, gem::AABB{-half, half}, model);
+  }
+
+  const glm::mat4 view_proj =
+      glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 50.0f) *
+      glm::lookAt(glm::vec3(5.0f, 2.0f, 5.0f), glm::vec3(0.0f),
+                  glm::vec3(0.0f, 1.0f, 0.0f));
+  const std::array<glm::vec4, 6> planes =
+      gem::Utils::get_planes_from_view_proj(view_proj);
+
+  std::vector<u8> expected(count), result(count);
+  const u32 expected_count =
+      culler.cull(planes, expected.data(), 0, count, SimdPath::scalar);
+  for (SimdPath path : {SimdPath::sse, SimdPath::avx}) {
+    if (!gem::FrustumCuller::has_path(path)) {
+      continue;
+    }
+    std::fill(result.begin(), result.end(), u8{0xff});
+    if (culler.cull(planes, result.data(), 0, count, path) !=
+            expected_count ||
+        result != expected) {
+      return false;
+    }
+    std::fill(result.begin(), result.end(), u8{0xff});
+    u32 ranged_count = 0;
+    for (u32 first = 0; first < count; first += 11) {
+      ranged_count += culler.cull(planes, result.data(), first,
+                                  std::min(count, first + 11), path);
+    }
+    if (ranged_count != expected_count || result != expected) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// none of these are a multiple of either lane count
+static constexpr std::array<u32, 6> s_cull_test_counts = {1, 3, 7, 13, 29,
+                                                          1001};
+
+// radix_sort against std::stable_sort, m_entity records the input order.
+// shared_mask bits are the same in every key, whole shared bytes take the
+// byte skip path
+static bool check_radix_sort(u32 count, u64 shared_mask, u32 seed) {
+  std::mt19937_64 rng(seed);
+  const u64 shared = rng();
+  std::vector<gem::DrawPacket> packets(count), scratch;
+  for (u32 i = 0; i < count; i++) {
+    // few distinct low keys so equal keys show up
+    const u64 key = rng() & ~u64{0xF0};
+    packets[i].m_key = (key & ~shared_mask) | (shared & shared_mask);
+    packets[i].m_entity = i;
+  }
+  std::vector<gem::DrawPacket> expected = packets;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const gem::DrawPacket &a, const gem::DrawPacket &b) {
+                     return a.m_key < b.m_key;
+                   });
+  gem::GLDrawList::radix_sort(packets, scratch);
+  if (packets.size() != count || scratch.size() != count) {
+    return false;
+  }
+  for (u32 i = 0; i < count; i++) {
+    if (packets[i].m_key != expected[i].m_key ||
+        packets[i].m_entity != expected[i].m_entity) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// random keys, shared high bytes, shared middle bytes, one distinct byte,
+// every key equal
+static constexpr std::array<u64, 5> s_sort_test_masks = {
+    0, 0xFFFF000000000000, 0x0000FFFFFFFF0000, ~u64{0xFF}, ~u64{0}};
+
+// key order is the order of (pass, shader, material, vao, depth)
+static bool check_draw_keys(u32 seed) {
+  std::mt19937 rng(seed);
+  using Fields = std::tuple<u32, u32, u32, u32, u32>;
+  std::vector<Fields> fields(512);
+  for (Fields &field : fields) {
+    // narrow ranges so fields tie and the next one decides
+    field = Fields(rng() % 6, rng() % 4 << 8, rng() % 4 << 12,
+                   rng() % 4 << 14, rng() % 4 << 16);
+  }
+  for (const Fields &a : fields) {
+    const u64 key_a = gem::GLDrawList::make_key(
+        std::get<0>(a), std::get<1>(a), std::get<2>(a), std::get<3>(a),
+        std::get<4>(a));
+    for (const Fields &b : fields) {
+      const u64 key_b = gem::GLDrawList::make_key(
+          std::get<0>(b), std::get<1>(b), std::get<2>(b), std::get<3>(b),
+          std::get<4>(b));
+      if ((a < b) != (key_a < key_b) || (a == b) != (key_a == key_b)) {
+        return false;
+      }
+    }
+  }
+
+  // a field past its width doesn't reach the one above it
+  const u32 ones = ~0u;
+  const u64 all = gem::GLDrawList::make_key(0, ones, ones, ones, ones);
+  const u64 fields_only[] = {
+      gem::GLDrawList::make_key(0, ones, 0, 0, 0),
+      gem::GLDrawList::make_key(0, 0, ones, 0, 0),
+      gem::GLDrawList::make_key(0, 0, 0, ones, 0),
+      gem::GLDrawList::make_key(0, 0, 0, 0, ones)};
+  u64 combined = 0;
+  for (u64 field : fields_only) {
+    if ((combined & field) != 0) {
+      return false;
+    }
+    combined |= field;
+  }
+  return combined == all && all >> 60 == 0 &&
+         gem::GLDrawList::make_key(5, 0, 0, 0, 0) >> 60 == 5;
+}
+
+// every index runs once, in at most get_thread_count() aligned ranges. no
+// indices is a single empty range
+static bool check_for_ranges(u32 count, u32 min_range, u32 alignment) {
+  std::vector<std::atomic<u32>> hits(count);
+  std::vector<std::atomic<u32>> range_hits(gem::Parallel::get_thread_count());
+  std::atomic<bool> aligned = true;
+  const u32 ranges = gem::Parallel::for_ranges(
+      count, min_range,
+      [&](u32 first, u32 last, u32 range) {
+        if (range >= range_hits.size() || first % alignment != 0 ||
+            (last != count && last % alignment != 0) || first > last ||
+            (first == last && count > 0)) {
+          aligned = false;
+          return;
+        }
+        range_hits[range]++;
+        for (u32 i = first; i < last; i++) {
+          hits[i]++;
+        }
+      },
+      alignment);
+  if (!aligned || ranges > gem::Parallel::get_thread_count() ||
+      (count > 0 && ranges == 0) || (count <= min_range && ranges > 1)) {
+    return false;
+  }
+  for (u32 range = 0; range < range_hits.size(); range++) {
+    if (range_hits[range] != (range < ranges ? 1u : 0u)) {
+      return false;
+    }
+  }
+  for (const std::atomic<u32> &hit : hits) {
+    if (hit != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// count, min range, alignment
+static constexpr std::array<std::array<u32, 3>, 7> s_range_test_cases = {{
+    {0, 1, 1},
+    {1, 1, 1},
+    {7, 64, 1},
+    {1000, 1, 1},
+    {1001, 16, 8},
+    {4099, 256, 4},
+    {100000, 1024, 8},
+}};
+
+// a pass costing base_ms at scale 1, as pixel count goes with scale squared
+static float resolution_pass_ms(float base_ms, float scale) {
+  return base_ms * scale * scale;
+}
+
+static bool check_dynamic_resolution() {
+  gem::DynamicResolution resolution;
+  const u32 vxgi = resolution.add_pass("vxgi", 1.0f, 0.5f, 1.0f);
+  const u32 ssr = resolution.add_pass("ssr", 2.0f, 0.25f, 1.0f);
+  const u32 idle = resolution.add_pass("idle", 0.75f, 0.5f, 1.0f);
+  if (resolution.get_scale(ssr) != 1.0f) {
+    return false;
+  }
+
+  // within tolerance, or disabled, nothing moves
+  resolution.set_gpu_time(vxgi, 8.0f);
+  resolution.set_gpu_time(ssr, 4.0f);
+  resolution.update(resolution.m_target_frame_ms * 1.02f);
+  resolution.m_enabled = false;
+  resolution.update(resolution.m_target_frame_ms * 3.0f);
+  resolution.m_enabled = true;
+  if (resolution.get_scale(vxgi) != 1.0f ||
+      resolution.get_scale(ssr) != 1.0f) {
+    return false;
+  }
+
+  // 8 ms of other work, the passes have to make up the rest
+  const float fixed_ms = 8.0f, vxgi_ms = 10.0f, ssr_ms = 6.0f;
+  for (u32 frame = 0; frame < 64; frame++) {
+    const float vxgi_frame_ms =
+        resolution_pass_ms(vxgi_ms, resolution.get_scale(vxgi));
+    const float ssr_frame_ms =
+        resolution_pass_ms(ssr_ms, resolution.get_scale(ssr));
+    const float previous_vxgi = resolution.get_scale(vxgi);
+    resolution.set_gpu_time(vxgi, vxgi_frame_ms);
+    resolution.set_gpu_time(ssr, ssr_frame_ms);
+    resolution.update(fixed_ms + vxgi_frame_ms + ssr_frame_ms);
+    // over budget, scales only come down
+    if (resolution.get_scale(vxgi) > previous_vxgi) {
+      return false;
+    }
+  }
+  const float settled_ms =
+      fixed_ms + resolution_pass_ms(vxgi_ms, resolution.get_scale(vxgi)) +
+      resolution_pass_ms(ssr_ms, resolution.get_scale(ssr));
+  if (std::abs(settled_ms - resolution.m_target_frame_ms) >
+      resolution.m_target_frame_ms * resolution.m_tolerance * 1.5f) {
+    return false;
+  }
+  // a pass without a timing keeps its scale
+  if (resolution.get_scale(idle) != 0.75f) {
+    return false;
+  }
+
+  // far over budget, clamped to the minimum
+  for (u32 frame = 0; frame < 64; frame++) {
+    resolution.set_gpu_time(vxgi, 40.0f);
+    resolution.set_gpu_time(ssr, 40.0f);
+    resolution.update(100.0f);
+  }
+  if (resolution.get_scale(vxgi) != 0.5f ||
+      resolution.get_scale(ssr) != 0.25f) {
+    return false;
+  }
+
+  // far under budget, back up to the maximum
+  for (u32 frame = 0; frame < 64; frame++) {
+    resolution.set_gpu_time(vxgi, 0.5f);
+    resolution.set_gpu_time(ssr, 0.5f);
+    resolution.update(2.0f);
+  }
+  return resolution.get_scale(vxgi) == 1.0f &&
+         resolution.get_scale(ssr) == 1.0f;
+}
+
+// reference decoders, the spec's interpolation on 8 bit endpoints
+static void decode_bc1_block(const u8 *in, u8 *rgba) {
+  const u16 c[2] = {static_cast<u16>(in[0] | in[1] << 8),
+                    static_cast<u16>(in[2] | in[3] << 8)};
+  i32 palette[4][3];
+  for (u32 e = 0; e < 2; e++) {
+    const i32 r = c[e] >> 11 & 31, g = c[e] >> 5 & 63, b = c[e] & 31;
+    palette[e][0] = r << 3 | r >> 2;
+    palette[e][1] = g << 2 | g >> 4;
+    palette[e][2] = b << 3 | b >> 2;
+  }
+  for (u32 ch = 0; ch < 3; ch++) {
+    if (c[0] > c[1]) {
+      palette[2][ch] = (palette[0][ch] * 2 + palette[1][ch]) / 3;
+      palette[3][ch] = (palette[0][ch] + palette[1][ch] * 2) / 3;
+    } else {
+      palette[2][ch] = (palette[0][ch] + palette[1][ch]) / 2;
+      palette[3][ch] = 0;
+    }
+  }
+  const u32 indices = in[4] | in[5] << 8 | in[6] << 16 | u32{in[7]} << 24;
+  for (u32 i = 0; i < 16; i++) {
+    for (u32 ch = 0; ch < 3; ch++) {
+      rgba[i * 4 + ch] = static_cast<u8>(palette[indices >> (i * 2) & 3][ch]);
+    }
+  }
+}
+
+static void decode_bc4_block(const u8 *in, u32 channel, u8 *rgba) {
+  i32 values[8] = {in[0], in[1]};
+  for (i32 i = 2; i < 8; i++) {
+    values[i] = in[0] > in[1] ? ((8 - i) * in[0] + (i - 1) * in[1]) / 7
+                : i < 6       ? ((6 - i) * in[0] + (i - 1) * in[1]) / 5
+                : i == 6      ? 0
+                              : 255;
+  }
+  u64 indices = 0;
+  for (u32 i = 0; i < 6; i++) {
+    indices |= u64{in[2 + i]} << (i * 8);
+  }
+  for (u32 i = 0; i < 16; i++) {
+    rgba[i * 4 + channel] = static_cast<u8>(values[indices >> (i * 3) & 7]);
+  }
+}
+
+// largest per channel error of an encode / decode round trip, over the
+// channels the format keeps
+static i32 get_block_round_trip_error(const gem::TextureMip &level,
+                                      gem::TextureBlockFormat format) {
+  using gem::TextureBlockFormat;
+  const std::vector<u8> encoded =
+      gem::TextureCompression::encode(level, format);
+  const i32 blocks_x = (level.m_width + 3) / 4;
+  const i32 blocks_y = (level.m_height + 3) / 4;
+  const u32 block_size = gem::TextureCompression::get_block_size(format);
+  if (encoded.size() != static_cast<size_t>(blocks_x) * blocks_y * block_size) {
+    return 256;
+  }
+
+  i32 error = 0;
+  u8 decoded[64];
+  for (i32 by = 0; by < blocks_y; by++) {
+    for (i32 bx = 0; bx < blocks_x; bx++) {
+      const u8 *block = &encoded[(by * blocks_x + bx) * block_size];
+      u32 channels = 0;
+      if (format == TextureBlockFormat::bc1) {
+        decode_bc1_block(block, decoded);
+        channels = 3;
+      } else if (format == TextureBlockFormat::bc3) {
+        decode_bc4_block(block, 3, decoded);
+        decode_bc1_block(block + 8, decoded);
+        channels = 4;
+      } else {
+        decode_bc4_block(block, 0, decoded);
+        decode_bc4_block(block + 8, 1, decoded);
+        channels = 2;
+      }
+      // texels past the edge are clamped copies, only real ones count
+      for (i32 py = 0; py < 4 && by * 4 + py < level.m_height; py++) {
+        for (i32 px = 0; px < 4 && bx * 4 + px < level.m_width; px++) {
+          const u8 *texel = &level.m_data[((by * 4 + py) * level.m_width +
+                                           bx * 4 + px) * 4];
+          for (u32 ch = 0; ch < channels; ch++) {
+            const i32 channel_error = std::abs(decoded[(py * 4 + px) * 4 + ch] -
+                                               texel[ch]);
+            error = std::max(error, channel_error);
+          }
+        }
+      }
+    }
+  }
+  return error;
+}
+
+// solid when gradient is false, otherwise every channel ramps along x or y
+static gem::TextureMip make_test_level(i32 width, i32 height, bool gradient,
+                                       const std::array<u8, 4> &colour) {
+  gem::TextureMip level{};
+  level.m_width = width;
+  level.m_height = height;
+  level.m_data.resize(static_cast<size_t>(width) * height * 4);
+  for (i32 y = 0; y < height; y++) {
+    for (i32 x = 0; x < width; x++) {
+      u8 *texel = &level.m_data[(y * width + x) * 4];
+      for (u32 ch = 0; ch < 4; ch++) {
+        texel[ch] = colour[ch];
+      }
+      if (gradient) {
+        // rgb along one line through colour space so bc1 can follow it, r
+        // and g independent for bc5, alpha along y
+        const i32 t = x * 255 / std::max(width - 1, 1);
+        texel[0] = static_cast<u8>(t);
+        texel[1] = static_cast<u8>(255 - t / 2);
+        texel[2] = static_cast<u8>(t / 4 + 32);
+        texel[3] = static_cast<u8>(y * 255 / std::max(height - 1, 1));
+      }
+    }
+  }
+  return level;
+}
+
+static constexpr std::array<std::array<u8, 4>, 4> s_block_test_colours = {{
+    {200, 100, 50, 255},
+    {0, 0, 0, 0},
+    {255, 255, 255, 128},
+    {17, 240, 3, 77},
+}};
+
+// worst case error of a channel, 565 endpoints for bc1 or 8 bit interpolated
+// values for bc4, on solid blocks and smooth gradients
+static bool check_block_round_trips() {
+  using gem::TextureBlockFormat;
+  for (TextureBlockFormat format :
+       {TextureBlockFormat::bc1, TextureBlockFormat::bc3,
+        TextureBlockFormat::bc5}) {
+    for (const std::array<u8, 4> &colour : s_block_test_colours) {
+      // uneven sizes cover partial edge blocks
+      for (i32 size : {1, 4, 6, 16}) {
+        if (get_block_round_trip_error(
+                make_test_level(size, size, false, colour), format) > 4) {
+          return false;
+        }
+      }
+    }
+    // 64 texels wide, 16 levels of each channel across a block
+    const i32 gradient_error = get_block_round_trip_error(
+        make_test_level(64, 30, true, s_block_test_colours[0]), format);
+    if (gradient_error > 8) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// downsample against the scalar box filter, sizes either side of what the
+// SSE2 path handles per iteration
+static bool check_downsample(i32 width, i32 height, u32 seed) {
+  std::mt19937 rng(seed);
+  gem::TextureMip level{};
+  level.m_width = width;
+  level.m_height = height;
+  level.m_data.resize(static_cast<size_t>(width) * height * 4);
+  for (u8 &value : level.m_data) {
+    value = static_cast<u8>(rng());
+  }
+
+  const gem::TextureMip result =
+      gem::TextureCompression::downsample(level, false);
+  const i32 dst_width = std::max(1, width / 2);
+  const i32 dst_height = std::max(1, height / 2);
+  if (result.m_width != dst_width || result.m_height != dst_height) {
+    return false;
+  }
+  for (i32 y = 0; y < dst_height; y++) {
+    const i32 y0 = std::min(y * 2, height - 1);
+    const i32 y1 = std::min(y * 2 + 1, height - 1);
+    for (i32 x = 0; x < dst_width; x++) {
+      const i32 x0 = std::min(x * 2, width - 1);
+      const i32 x1 = std::min(x * 2 + 1, width - 1);
+      for (i32 ch = 0; ch < 4; ch++) {
+        const u32 sum = level.m_data[(y0 * width + x0) * 4 + ch] +
+                        level.m_data[(y0 * width + x1) * 4 + ch] +
+                        level.m_data[(y1 * width + x0) * 4 + ch] +
+                        level.m_data[(y1 * width + x1) * 4 + ch];
+        if (result.m_data[(y * dst_width + x) * 4 + ch] != (sum + 2) / 4) {
+          return false;
+        }
+      }
+    }
+  }
+
+  // a solid level stays solid all the way down
+  const gem::TextureMip solid =
+      make_test_level(width, height, false, s_block_test_colours[3]);
+  for (const gem::TextureMip &mip : gem::TextureCompression::generate_mips(
+           solid.m_data.data(), width, height)) {
+    for (size_t i = 0; i < mip.m_data.size(); i++) {
+      if (mip.m_data[i] != s_block_test_colours[3][i % 4]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// width, height
+static constexpr std::array<std::array<i32, 2>, 8> s_downsample_test_sizes = {{
+    {1, 1},
+    {2, 2},
+    {3, 1},
+    {5, 7},
+    {8, 2},
+    {9, 9},
+    {33, 6},
+    {64, 64},
+}};
 
 BEGIN_TESTS()
 
@@ -19,4 +548,97 @@ TEST("Test Test 2",
   return TEST_RESULT::PASS;
 })
 
+TEST("Shape Gen Indices In Range",
+{
+  // the tessellations add_primitives uses
+  static constexpr auto cube = gem::ShapeGen::Cube::generate();
+  static constexpr auto sphere = (gem::ShapeGen::UVSphere<32, 16>::generate());
+  static constexpr auto cylinder = gem::ShapeGen::Cylinder<32>::generate();
+  static constexpr auto cone = gem::ShapeGen::Cone<32>::generate();
+  static constexpr auto torus = (gem::ShapeGen::Torus<48, 12>::generate());
+
+  if (!check_shape(cube, 24, 36) || !check_shape(sphere, 561, 2880) ||
+      !check_shape(cylinder, 134, 384) || !check_shape(cone, 99, 192) ||
+      !check_shape(torus, 637, 3456)) {
+    return TEST_RESULT::FAIL;
+  }
+  return TEST_RESULT::PASS;
+})
+
+TEST("String Hash Matches Compile Time Hash",
+{
+  constexpr gem::HashString literal("shaders/gbuffer.shader");
+  if (gem::HashUtils::get_string_hash("shaders/gbuffer.shader") !=
+      literal.m_value) {
+    return TEST_RESULT::FAIL;
+  }
+  // shader sources run to tens of kilobytes
+  const std::string source(1 << 20, 'x');
+  if (gem::HashUtils::get_string_hash(source) ==
+      gem::HashUtils::get_string_hash(source.substr(1))) {
+    return TEST_RESULT::FAIL;
+  }
+  return TEST_RESULT::PASS;
+})
+
+TEST("Frustum Cull SIMD Matches Scalar",
+{
+  for (u32 count : s_cull_test_counts) {
+    if (!check_cull_paths(count, count * 7919u)) {
+      return TEST_RESULT::FAIL;
+    }
+  }
+  return TEST_RESULT::PASS;
+})
+
+TEST("Draw List Radix Sort Matches std::sort",
+{
+  for (u64 shared_mask : s_sort_test_masks) {
+    for (u32 count : s_cull_test_counts) {
+      if (!check_radix_sort(count, shared_mask, count)) {
+        return TEST_RESULT::FAIL;
+      }
+    }
+  }
+  if (!check_radix_sort(0, 0, 0)) {
+    return TEST_RESULT::FAIL;
+  }
+  return TEST_RESULT::PASS;
+})
+
+TEST("Draw List Key Layout",
+{
+  return check_draw_keys(17) ? TEST_RESULT::PASS : TEST_RESULT::FAIL;
+})
+
+TEST("Parallel Ranges Cover Every Index Once",
+{
+  for (const auto &test_case : s_range_test_cases) {
+    if (!check_for_ranges(test_case[0], test_case[1], test_case[2])) {
+      return TEST_RESULT::FAIL;
+    }
+  }
+  return TEST_RESULT::PASS;
+})
+
+TEST("Dynamic Resolution Settles On Target",
+{
+  return check_dynamic_resolution() ? TEST_RESULT::PASS : TEST_RESULT::FAIL;
+})
+
+TEST("Block Compression Round Trip",
+{
+  return check_block_round_trips() ? TEST_RESULT::PASS : TEST_RESULT::FAIL;
+})
+
+TEST("Downsample Matches Scalar Box Filter",
+{
+  for (const auto &size : s_downsample_test_sizes) {
+    if (!check_downsample(size[0], size[1], size[0] * 31u + size[1])) {
+      return TEST_RESULT::FAIL;
+    }
+  }
+  return TEST_RESULT::PASS;
+})
+
 RUN_TESTS()
\ No newline at end of file
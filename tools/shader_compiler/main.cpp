@@ -0,0 +1,123 @@
+#include "gem/gl/gl_shader.h"
+#include "gem/hash_string.h"
+#include "gem/utils.h"
+#include "spdlog/spdlog.h"
+#include <cstdlib>
+#include <filesystem>
+#include <unordered_set>
+
+using namespace gem;
+
+// Offline shader build step. Each stage of every composite shader is
+// preprocessed and split exactly as GLShader does at runtime, then compiled
+// to GL flavoured SPIR-V and validated. Output files are named after the
+// hash of the stage source so the runtime only picks up a binary that
+// matches the GLSL it would otherwise compile. Binaries in the output
+// directory that this run didn't produce are from sources that have since
+// changed and are removed.
+
+struct StageInfo {
+  GLShader::stage m_stage;
+  const char *m_glslang_stage;
+};
+
+static const StageInfo s_stages[] = {
+    {GLShader::stage::vertex, "vert"},
+    {GLShader::stage::geometry, "geom"},
+    {GLShader::stage::fragment, "frag"},
+    {GLShader::stage::compute, "comp"}};
+
+static bool compile_stage(const std::string &glslang, const std::string &source,
+                          const char *glslang_stage,
+                          const std::filesystem::path &output_dir,
+                          std::unordered_set<std::string> &outputs) {
+  const std::string name =
+      fmt::format("{:016x}", HashUtils::get_string_hash(source));
+  const std::filesystem::path glsl_path =
+      output_dir / (name + "." + glslang_stage);
+  const std::filesystem::path spv_path = output_dir / (name + ".spv");
+  outputs.insert(spv_path.filename().string());
+
+  Utils::save_string_to_path(glsl_path.string(), source);
+  // -G targets GL rather than vulkan, loose uniforms are given locations and
+  // bindings automatically, --spirv-val runs the SPIRV-Tools validator
+  const std::string command = fmt::format(
+      "\"{}\" -G --aml --amb --spirv-val -S {} -o \"{}\" \"{}\"", glslang,
+      glslang_stage, spv_path.string(), glsl_path.string());
+  const int result = std::system(command.c_str());
+  std::filesystem::remove(glsl_path);
+
+  if (result != 0) {
+    std::filesystem::remove(spv_path);
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    spdlog::error("usage : gem-shader-compiler <shader dir> <output dir> "
+                  "[glslangValidator]");
+    return 1;
+  }
+
+  const std::filesystem::path shader_dir = argv[1];
+  const std::filesystem::path output_dir = argv[2];
+  const std::string glslang = argc > 3 ? argv[3] : "glslangValidator";
+  GLShader::s_include_directory = shader_dir.string();
+
+  std::error_code ec;
+  std::filesystem::create_directories(output_dir, ec);
+  if (ec) {
+    spdlog::error("failed to create {} : {}", output_dir.string(),
+                  ec.message());
+    return 1;
+  }
+
+  u32 compiled = 0;
+  u32 failed = 0;
+  std::unordered_set<std::string> outputs;
+  for (auto &entry : std::filesystem::directory_iterator(shader_dir)) {
+    if (!entry.is_regular_file() || entry.path().extension() != ".shader") {
+      continue;
+    }
+
+    const std::string path = entry.path().generic_string();
+    const std::string source =
+        GLShader::preprocess(Utils::load_string_from_path(path), path);
+    if (source.find("#pragma no_spirv") != std::string::npos) {
+      spdlog::info("{} : skipped, uses features without a GL SPIR-V path",
+                   path);
+      continue;
+    }
+
+    auto stages = GLShader::split_composite_shader(source);
+    for (const StageInfo &info : s_stages) {
+      auto it = stages.find(info.m_stage);
+      if (it == stages.end()) {
+        continue;
+      }
+      if (compile_stage(glslang, it->second, info.m_glslang_stage, output_dir,
+                        outputs)) {
+        compiled++;
+      } else {
+        spdlog::error("{} : {} stage failed to compile", path,
+                      info.m_glslang_stage);
+        failed++;
+      }
+    }
+  }
+
+  u32 removed = 0;
+  for (auto &entry : std::filesystem::directory_iterator(output_dir)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".spv" &&
+        outputs.count(entry.path().filename().string()) == 0) {
+      std::filesystem::remove(entry.path(), ec);
+      removed += ec ? 0 : 1;
+    }
+  }
+
+  spdlog::info("compiled {} stages, {} failed, {} stale removed", compiled,
+               failed, removed);
+  return failed == 0 ? 0 : 1;
+}